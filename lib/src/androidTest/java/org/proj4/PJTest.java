@@ -0,0 +1,103 @@
+package org.proj4;
+
+import org.junit.Test;
+import org.junit.runner.RunWith;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+
+import androidx.test.ext.junit.runners.AndroidJUnit4;
+import androidx.test.filters.SmallTest;
+
+import static org.junit.Assert.assertArrayEquals;
+
+@RunWith(AndroidJUnit4.class)
+public class PJTest {
+
+    static {
+        System.loadLibrary("android_spatialite");
+    }
+
+    private static final String WGS84 = "+proj=longlat +datum=WGS84 +no_defs";
+    private static final String UTM32 = "+proj=utm +zone=32 +datum=WGS84 +units=m +no_defs";
+    private static final String WEB_MERCATOR = "+proj=merc +a=6378137 +b=6378137 +lat_ts=0.0"
+            + " +lon_0=0.0 +x_0=0.0 +y_0=0 +k=1.0 +units=m +nadgrids=@null +wktext +no_defs";
+
+    private static double[] coordinates(int numPts) {
+        double[] coords = new double[numPts * 2];
+        for (int i = 0; i < numPts; i++) {
+            coords[i * 2] = 9 + (i % 100) * 0.01;
+            coords[i * 2 + 1] = 45 + (i / 100) * 0.01;
+        }
+        return coords;
+    }
+
+    private static void assertDirectMatchesArray(int numPts, int numThreads) throws Exception {
+        PJ src = new PJ(WGS84);
+        PJ dst = new PJ(UTM32);
+        double[] expected = coordinates(numPts);
+        src.transform(dst, 2, expected, 0, numPts);
+
+        DoubleBuffer buffer = ByteBuffer.allocateDirect(numPts * 2 * 8)
+                .order(ByteOrder.nativeOrder()).asDoubleBuffer();
+        buffer.put(coordinates(numPts));
+        src.transform(dst, 2, buffer, 0, numPts, numThreads);
+        double[] actual = new double[numPts * 2];
+        buffer.rewind();
+        buffer.get(actual);
+        assertArrayEquals(expected, actual, 1e-6);
+    }
+
+    /**
+     * A batch goes through the Proj4 batch kernels, while a single point goes through
+     * the generic per-point path: both must give exactly the same coordinates.
+     */
+    private static void assertBatchMatchesPointwise(String source, String target, int dimension,
+                                                    int numPts) throws Exception {
+        PJ src = new PJ(source);
+        PJ dst = new PJ(target);
+        double[] batch = new double[numPts * dimension];
+        for (int i = 0; i < numPts; i++) {
+            batch[i * dimension] = 9 + (i % 100) * 0.01;
+            batch[i * dimension + 1] = 45 + (i / 100) * 0.01;
+            for (int k = 2; k < dimension; k++) {
+                batch[i * dimension + k] = 100 + i;
+            }
+        }
+        if (src.getType() != PJ.Type.GEOGRAPHIC) {
+            new PJ(WGS84).transform(src, dimension, batch, 0, numPts);
+        }
+        double[] pointwise = batch.clone();
+        src.transform(dst, dimension, batch, 0, numPts);
+        for (int i = 0; i < numPts; i++) {
+            src.transform(dst, dimension, pointwise, i * dimension, 1);
+        }
+        assertArrayEquals(pointwise, batch, 0);
+    }
+
+    @SmallTest
+    @Test
+    public void testTransform_BatchMatchesPointwise() throws Exception {
+        assertBatchMatchesPointwise(WGS84, UTM32, 2, 1000);
+        assertBatchMatchesPointwise(UTM32, WGS84, 2, 1000);
+        assertBatchMatchesPointwise(WGS84, UTM32, 3, 257);
+        assertBatchMatchesPointwise(WGS84, WEB_MERCATOR, 2, 513);
+        assertBatchMatchesPointwise(WEB_MERCATOR, WGS84, 4, 700);
+    }
+
+    @SmallTest
+    @Test
+    public void testTransformDirect_SmallBatch() throws Exception {
+        // below the per-thread minimum: done by the calling thread alone
+        assertDirectMatchesArray(1, 0);
+        assertDirectMatchesArray(100, 0);
+        assertDirectMatchesArray(100, 4);
+    }
+
+    @SmallTest
+    @Test
+    public void testTransformDirect_Threaded() throws Exception {
+        assertDirectMatchesArray(40000, 4);
+    }
+}
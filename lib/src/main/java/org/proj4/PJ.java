@@ -32,6 +32,10 @@
  */
 package org.proj4;
 
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
 
 /**
  * Wraps the <a href="http://proj.osgeo.org/">Proj4</a> {@code PJ} native data structure.
@@ -330,6 +334,71 @@ public class PJ {
     public native void transform(PJ target, int dimension, double[] coordinates, int offset, int numPts)
             throws PJException;
 
+    /**
+     * Transforms in-place the coordinates in the given direct buffer. This method works like
+     * {@link #transform(org.proj4.PJ, int, double[], int, int)}, except that the native code
+     * reads and writes the buffer memory directly. No JVM critical section is entered, so the
+     * garbage collector is not blocked during the operation, and large batches can be split
+     * between native threads. Each thread uses its own copy of the source and target
+     * {@code PJ} structures.
+     *
+     * @param  target The target CRS.
+     * @param  dimension The dimension of each coordinate value. Must be in the [2-{@value #DIMENSION_MAX}] range.
+     * @param  coordinates A direct buffer of (<var>x</var>,<var>y</var>,&lt;<var>z</var>&gt;,&hellip;) tuples.
+     *         The buffer position and limit are ignored.
+     * @param  offset Index of the first coordinate in the given buffer.
+     * @param  numPts Number of points to transform.
+     * @param  numThreads Maximal number of threads to use, or 0 for the number of available processors.
+     *         Small batches are always transformed by the calling thread alone.
+     * @throws NullPointerException If the {@code target} or {@code coordinates} argument is null.
+     * @throws IllegalArgumentException If the buffer is not direct or not in native byte order.
+     * @throws IndexOutOfBoundsException if the {@code offset} or {@code numPts} arguments are invalid.
+     * @throws org.proj4.PJException If the operation failed for an other reason (provided by Proj4).
+     */
+    public void transform(PJ target, int dimension, DoubleBuffer coordinates, int offset, int numPts, int numThreads)
+            throws PJException {
+        if (coordinates != null && (!coordinates.isDirect() || coordinates.order() != ByteOrder.nativeOrder())) {
+            throw new IllegalArgumentException("The coordinates buffer must be direct and in native byte order.");
+        }
+        transformDirect(target, dimension, coordinates, (coordinates != null) ? coordinates.capacity() : 0,
+                offset, numPts, numThreads);
+    }
+
+    /**
+     * Transforms in-place the coordinates in the given direct byte buffer, viewed as a sequence
+     * of doubles in native byte order. See
+     * {@link #transform(org.proj4.PJ, int, DoubleBuffer, int, int, int)} for details.
+     *
+     * @param  target The target CRS.
+     * @param  dimension The dimension of each coordinate value. Must be in the [2-{@value #DIMENSION_MAX}] range.
+     * @param  coordinates A direct buffer of (<var>x</var>,<var>y</var>,&lt;<var>z</var>&gt;,&hellip;) tuples.
+     *         The buffer position and limit are ignored.
+     * @param  offset Index of the first coordinate in the given buffer, counted in doubles (not bytes).
+     * @param  numPts Number of points to transform.
+     * @param  numThreads Maximal number of threads to use, or 0 for the number of available processors.
+     * @throws NullPointerException If the {@code target} or {@code coordinates} argument is null.
+     * @throws IllegalArgumentException If the buffer is not direct or not in native byte order.
+     * @throws IndexOutOfBoundsException if the {@code offset} or {@code numPts} arguments are invalid.
+     * @throws org.proj4.PJException If the operation failed for an other reason (provided by Proj4).
+     */
+    public void transform(PJ target, int dimension, ByteBuffer coordinates, int offset, int numPts, int numThreads)
+            throws PJException {
+        if (coordinates != null && (!coordinates.isDirect() || coordinates.order() != ByteOrder.nativeOrder())) {
+            throw new IllegalArgumentException("The coordinates buffer must be direct and in native byte order.");
+        }
+        transformDirect(target, dimension, coordinates, (coordinates != null) ? coordinates.capacity() / 8 : 0,
+                offset, numPts, numThreads);
+    }
+
+    /**
+     * Transforms in-place the coordinates in the given direct buffer. The buffer type and byte
+     * order have been verified by the caller.
+     *
+     * @param  capacity The buffer capacity, in number of doubles.
+     */
+    private native void transformDirect(PJ target, int dimension, Buffer coordinates, int capacity,
+            int offset, int numPts, int numThreads) throws PJException;
+
     /**
      * Returns a description of the last error that occurred, or {@code null} if none.
      *
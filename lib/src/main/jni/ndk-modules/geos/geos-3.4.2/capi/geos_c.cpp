@@ -791,6 +791,18 @@ GEOSCoordSeq_getDimensions(const CoordinateSequence *s, unsigned int *dims)
     return GEOSCoordSeq_getDimensions_r( handle, s, dims );
 }
 
+CoordinateSequence *
+GEOSCoordSeq_copyFromBuffer(const double *buf, unsigned int size, int hasZ, int hasM)
+{
+    return GEOSCoordSeq_copyFromBuffer_r( handle, buf, size, hasZ, hasM );
+}
+
+int
+GEOSCoordSeq_copyToBuffer(const CoordinateSequence *s, double *buf, int hasZ, int hasM)
+{
+    return GEOSCoordSeq_copyToBuffer_r( handle, s, buf, hasZ, hasM );
+}
+
 void
 GEOSCoordSeq_destroy(CoordinateSequence *s)
 {
@@ -86,6 +86,9 @@ extern "C" {
 #define GEOS_CAPI_FIRST_INTERFACE GEOS_CAPI_VERSION_MAJOR
 #define GEOS_CAPI_LAST_INTERFACE (GEOS_CAPI_VERSION_MAJOR+GEOS_CAPI_VERSION_MINOR)
 
+/* bulk Coordinate Sequence copy (backported from the 3.10 C-API) */
+#define GEOS_CAPI_COORDSEQ_BUFFER 1
+
 /************************************************************************
  *
  * (Abstract) type definitions
@@ -341,6 +344,35 @@ extern int GEOS_DLL GEOSCoordSeq_getDimensions_r(GEOSContextHandle_t handle,
                                                  const GEOSCoordSequence* s,
                                                  unsigned int *dims);
 
+/*
+ * Create a Coordinate Sequence copying ``size'' interleaved coordinates
+ * from ``buf'' (x, y [, z] [, m] for each coordinate); M values
+ * are skipped. Return NULL on exception.
+ */
+extern GEOSCoordSequence GEOS_DLL *GEOSCoordSeq_copyFromBuffer(
+                                                const double* buf,
+                                                unsigned int size,
+                                                int hasZ, int hasM);
+
+extern GEOSCoordSequence GEOS_DLL *GEOSCoordSeq_copyFromBuffer_r(
+                                                GEOSContextHandle_t handle,
+                                                const double* buf,
+                                                unsigned int size,
+                                                int hasZ, int hasM);
+
+/*
+ * Copy all the coordinates of a Coordinate Sequence into ``buf''
+ * as interleaved x, y [, z] [, m] values; M is always set to NaN.
+ * Return 0 on exception.
+ */
+extern int GEOS_DLL GEOSCoordSeq_copyToBuffer(const GEOSCoordSequence* s,
+	double* buf, int hasZ, int hasM);
+
+extern int GEOS_DLL GEOSCoordSeq_copyToBuffer_r(GEOSContextHandle_t handle,
+                                                const GEOSCoordSequence* s,
+                                                double* buf,
+                                                int hasZ, int hasM);
+
 /************************************************************************
  *
  *  Linear referencing functions -- there are more, but these are
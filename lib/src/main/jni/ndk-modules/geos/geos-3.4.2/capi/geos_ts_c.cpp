@@ -116,6 +116,7 @@ using geos::geom::Geometry;
 using geos::geom::LineString;
 using geos::geom::Polygon;
 using geos::geom::CoordinateSequence;
+using geos::geom::Coordinate;
 using geos::geom::GeometryFactory;
 
 using geos::io::WKTReader;
@@ -3680,6 +3681,94 @@ GEOSCoordSeq_getDimensions_r(GEOSContextHandle_t extHandle, const CoordinateSequ
     return 0;
 }
 
+CoordinateSequence *
+GEOSCoordSeq_copyFromBuffer_r(GEOSContextHandle_t extHandle, const double *buf,
+                              unsigned int size, int hasZ, int hasM)
+{
+    assert(0 != buf || 0 == size);
+
+    if ( 0 == extHandle )
+    {
+        return NULL;
+    }
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized )
+    {
+        return NULL;
+    }
+
+    try
+    {
+        const std::size_t stride = 2 + (hasZ ? 1 : 0) + (hasM ? 1 : 0);
+        std::vector<Coordinate> *coords = new std::vector<Coordinate>(size);
+        for (std::size_t i = 0; i < size; i++, buf += stride)
+        {
+            Coordinate &c = (*coords)[i];
+            c.x = buf[0];
+            c.y = buf[1];
+            if ( hasZ ) c.z = buf[2];
+        }
+        const GeometryFactory *gf = handle->geomFactory;
+        return gf->getCoordinateSequenceFactory()->create(coords, hasZ ? 3 : 2);
+    }
+    catch (const std::exception &e)
+    {
+        handle->ERROR_MESSAGE("%s", e.what());
+    }
+    catch (...)
+    {
+        handle->ERROR_MESSAGE("Unknown exception thrown");
+    }
+
+    return NULL;
+}
+
+int
+GEOSCoordSeq_copyToBuffer_r(GEOSContextHandle_t extHandle,
+                            const CoordinateSequence *cs, double *buf,
+                            int hasZ, int hasM)
+{
+    assert(0 != cs);
+
+    if ( 0 == extHandle )
+    {
+        return 0;
+    }
+
+    GEOSContextHandleInternal_t *handle = 0;
+    handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    if ( 0 == handle->initialized )
+    {
+        return 0;
+    }
+
+    try
+    {
+        const std::size_t size = cs->getSize();
+        for (std::size_t i = 0; i < size; i++)
+        {
+            const Coordinate &c = cs->getAt(i);
+            *buf++ = c.x;
+            *buf++ = c.y;
+            if ( hasZ ) *buf++ = c.z;
+            if ( hasM ) *buf++ = DoubleNotANumber;
+        }
+        return 1;
+    }
+    catch (const std::exception &e)
+    {
+        handle->ERROR_MESSAGE("%s", e.what());
+    }
+    catch (...)
+    {
+        handle->ERROR_MESSAGE("Unknown exception thrown");
+    }
+
+    return 0;
+}
+
 void
 GEOSCoordSeq_destroy_r(GEOSContextHandle_t extHandle, CoordinateSequence *s)
 {
@@ -45,7 +45,7 @@ LOCAL_CFLAGS    := \
 # - Ewkt.c,geoJSON.c,Gml.c,Kml.c,vanuatuWkt.c
 # - lex.Ewkt.c,lex.geoJSON.c,lex.Gml.c,lex.Kml.c,lex.VanuatuWkt.c
 # 20150607 - ENABLE_GCP=1: 'GPL v2.0 or any subsequent version'
-# 'srsinit/epsg_update' is not included, since it is not needed in the library [tools to create the epsg_inlined_*.c files]
+# 'srsinit/epsg_update' is not included, since it is not needed in the library [tools to create the epsg_packed.c file]
 LOCAL_C_INCLUDES := \
  $(SQLITE_PATH) \
  $(SPATIALITE_PATH) \
@@ -84,6 +84,7 @@ LOCAL_SRC_FILES := \
  $(SPATIALITE_PATH)/src/gaiageo/gg_kml.c \
  $(SPATIALITE_PATH)/src/gaiageo/gg_lwgeom.c \
  $(SPATIALITE_PATH)/src/gaiageo/gg_matrix.c \
+ $(SPATIALITE_PATH)/src/gaiageo/gg_kernels.c \
  $(SPATIALITE_PATH)/src/gaiageo/gg_relations.c \
  $(SPATIALITE_PATH)/src/gaiageo/gg_relations_ext.c \
  $(SPATIALITE_PATH)/src/gaiageo/gg_shape.c \
@@ -125,62 +126,15 @@ LOCAL_SRC_FILES := \
  $(SPATIALITE_PATH)/src/spatialite/virtualelementary.c \
  $(SPATIALITE_PATH)/src/spatialite/virtualfdo.c \
  $(SPATIALITE_PATH)/src/spatialite/virtualgpkg.c \
+ $(SPATIALITE_PATH)/src/spatialite/virtualknn.c \
+ $(SPATIALITE_PATH)/src/spatialite/virtualspatialjoin.c \
+ $(SPATIALITE_PATH)/src/spatialite/virtualspatiallayer.c \
  $(SPATIALITE_PATH)/src/spatialite/virtualnetwork.c \
  $(SPATIALITE_PATH)/src/spatialite/virtualshape.c \
  $(SPATIALITE_PATH)/src/spatialite/virtualspatialindex.c \
  $(SPATIALITE_PATH)/src/spatialite/virtualXL.c \
  $(SPATIALITE_PATH)/src/spatialite/virtualxpath.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_00.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_01.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_02.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_03.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_04.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_05.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_06.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_07.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_08.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_09.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_10.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_11.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_12.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_13.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_14.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_15.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_16.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_17.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_18.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_19.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_20.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_21.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_22.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_23.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_24.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_25.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_26.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_27.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_28.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_29.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_30.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_31.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_32.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_33.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_34.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_35.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_36.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_37.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_38.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_39.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_40.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_41.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_42.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_43.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_44.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_45.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_46.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_extra.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_prussian.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_wgs84_00.c \
- $(SPATIALITE_PATH)/src/srsinit/epsg_inlined_wgs84_01.c \
+ $(SPATIALITE_PATH)/src/srsinit/epsg_packed.c \
  $(SPATIALITE_PATH)/src/srsinit/srs_init.c \
  $(SPATIALITE_PATH)/src/versioninfo/version.c \
  $(SPATIALITE_PATH)/src/virtualtext/virtualtext.c \
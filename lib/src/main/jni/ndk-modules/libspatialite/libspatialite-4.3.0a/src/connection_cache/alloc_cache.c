@@ -231,6 +231,7 @@ spatialite_alloc_connection ()
     struct splite_internal_cache *cache = NULL;
     struct splite_geos_cache_item *p;
     struct splite_xmlSchema_cache_item *p_xmlSchema;
+    struct splite_proj_cache_item *p_proj;
     int pool_index;
 
 /* attempting to implicitly initialize the library */
@@ -292,6 +293,38 @@ spatialite_alloc_connection ()
 	  p_xmlSchema->parserCtxt = NULL;
 	  p_xmlSchema->schema = NULL;
       }
+    for (i = 0; i < MAX_PROJ_CACHE; i++)
+      {
+	  /* initializing the PROJ.4 cache */
+	  p_proj = &(cache->projCache[i]);
+	  p_proj->srid_from = -1;
+	  p_proj->srid_to = -1;
+	  p_proj->gpkg_amphibious = 0;
+	  p_proj->proj_from = NULL;
+	  p_proj->proj_to = NULL;
+	  p_proj->from_cs = NULL;
+	  p_proj->to_cs = NULL;
+	  p_proj->from_angle = 0;
+	  p_proj->to_angle = 0;
+	  p_proj->last_used = 0;
+	  p_proj->generation = 0;
+	  p_proj->serial = 0;
+      }
+    cache->projCacheClock = 0;
+    cache->projCacheHits = 0;
+    cache->projCacheMisses = 0;
+    for (i = 0; i < MAX_APPROX_CACHE; i++)
+      {
+	  /* initializing the Transform approximations cache */
+	  cache->approxCache[i].pair_serial = 0;
+	  cache->approxCache[i].last_used = 0;
+      }
+    for (i = 0; i < SRS_CATALOG_BUCKETS; i++)
+	cache->srsCatalog[i] = NULL;	/* initializing the SRS catalogue */
+    cache->srsChanges = -1;
+    cache->srsDataVersion = -1;
+    cache->srsSchemaVersion = -1;
+    cache->srsGeneration = 1;
 
 #include "cache_aux_3.h"
 
@@ -340,11 +373,15 @@ free_internal_cache (struct splite_internal_cache *cache)
 #endif
 
 #ifndef OMIT_PROJ
+    splite_reset_proj_cache (cache);
     if (cache->PROJ_handle != NULL)
 	pj_ctx_free (cache->PROJ_handle);
     cache->PROJ_handle = NULL;
 #endif
 
+/* freeing the SRS catalogue */
+    splite_reset_srs_catalog (cache);
+
 /* freeing the XML error buffers */
     gaiaOutBufferReset (cache->xmlParsingErrors);
     gaiaOutBufferReset (cache->xmlSchemaValidationErrors);
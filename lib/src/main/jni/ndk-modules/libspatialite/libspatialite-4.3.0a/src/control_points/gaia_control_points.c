@@ -1309,4 +1309,171 @@ gaiaPolynomialToMatrix (const unsigned char *iblob, int iblob_sz,
     return 0;
 }
 
+SPATIALITE_PRIVATE int
+splite_fit_approx_cache_item (struct splite_approx_cache_item *p, int count,
+			      const double *x0, const double *y0,
+			      const double *x1, const double *y1, int order)
+{
+/* 
+/ fitting a Polynomial on a tile of the Transform approximations cache
+/
+/ both source and target coords are centered and scaled to about
+/ [-1,1] before solving, so that the normal equations stay well 
+/ conditioned even for large coords (e.g. UTM northings); the target
+/ scaling is then folded back into the coeffs, which apply directly
+/ to normalized source coords
+*/
+    int i;
+    int ret;
+    int max;
+    double tminx;
+    double tminy;
+    double tmaxx;
+    double tmaxy;
+    double tx0;
+    double ty0;
+    double tscale;
+    double E12[20];
+    double N12[20];
+    double E21[20];
+    double N21[20];
+    struct Control_Points cp;
+    if (p == NULL || count < 1 || order < 1 || order > 3)
+	return 0;
+    tminx = x1[0];
+    tmaxx = x1[0];
+    tminy = y1[0];
+    tmaxy = y1[0];
+    for (i = 1; i < count; i++)
+      {
+	  if (x1[i] < tminx)
+	      tminx = x1[i];
+	  if (x1[i] > tmaxx)
+	      tmaxx = x1[i];
+	  if (y1[i] < tminy)
+	      tminy = y1[i];
+	  if (y1[i] > tmaxy)
+	      tmaxy = y1[i];
+      }
+    tx0 = tminx + ((tmaxx - tminx) / 2.0);
+    ty0 = tminy + ((tmaxy - tminy) / 2.0);
+    tscale = (tmaxx - tminx) / 2.0;
+    if ((tmaxy - tminy) / 2.0 > tscale)
+	tscale = (tmaxy - tminy) / 2.0;
+    if (tscale <= 0.0)
+	return 0;
+
+    cp.count = count;
+    cp.e1 = malloc (sizeof (double) * count);
+    cp.n1 = malloc (sizeof (double) * count);
+    cp.e2 = malloc (sizeof (double) * count);
+    cp.n2 = malloc (sizeof (double) * count);
+    cp.status = malloc (sizeof (int) * count);
+    if (cp.e1 == NULL || cp.n1 == NULL || cp.e2 == NULL || cp.n2 == NULL
+	|| cp.status == NULL)
+      {
+	  free_control_points_2d (&cp);
+	  return 0;
+      }
+    for (i = 0; i < count; i++)
+      {
+	  cp.e1[i] = (x0[i] - p->x0) / p->scale;
+	  cp.n1[i] = (y0[i] - p->y0) / p->scale;
+	  cp.e2[i] = (x1[i] - tx0) / tscale;
+	  cp.n2[i] = (y1[i] - ty0) / tscale;
+	  cp.status[i] = 1;
+      }
+    ret = gcp_I_compute_georef_equations (&cp, E12, N12, E21, N21, order);
+    free_control_points_2d (&cp);
+    if (ret <= 0)
+	return 0;
+
+    max = ((order + 1) * (order + 2)) / 2;
+    for (i = 0; i < max; i++)
+      {
+	  p->E[i] = E12[i] * tscale;
+	  p->N[i] = N12[i] * tscale;
+      }
+    p->E[0] += tx0;
+    p->N[0] += ty0;
+    p->order = order;
+    return 1;
+}
+
+static void
+approx_transform_coords (struct splite_approx_cache_item *p, double *coords,
+			 int points, int dims)
+{
+/* evaluating the fitted Polynomial on a Coords array [in place] */
+    int iv;
+    double x;
+    double y;
+    double rscale = 1.0 / p->scale;
+    for (iv = 0; iv < points; iv++)
+      {
+	  double *xy = coords + (iv * dims);
+	  gcp_I_georef ((xy[0] - p->x0) * rscale, (xy[1] - p->y0) * rscale,
+			&x, &y, p->E, p->N, p->order);
+	  xy[0] = x;
+	  xy[1] = y;
+      }
+}
+
+SPATIALITE_PRIVATE void *
+splite_transform_approx_cache_item (struct splite_approx_cache_item *p,
+				    const void *org)
+{
+/* reprojecting a Geometry by using a fitted Polynomial approximation */
+    int ib;
+    int dims;
+    gaiaPointPtr point;
+    gaiaLinestringPtr line;
+    gaiaPolygonPtr polyg;
+    gaiaRingPtr ring;
+    gaiaGeomCollPtr geom;
+    if (p == NULL || p->order < 1 || org == NULL)
+	return NULL;
+    geom = gaiaCloneGeomColl ((gaiaGeomCollPtr) org);
+    if (geom == NULL)
+	return NULL;
+    if (geom->DimensionModel == GAIA_XY_Z_M)
+	dims = 4;
+    else if (geom->DimensionModel == GAIA_XY_Z
+	     || geom->DimensionModel == GAIA_XY_M)
+	dims = 3;
+    else
+	dims = 2;
+    point = geom->FirstPoint;
+    while (point)
+      {
+	  double xy[2];
+	  xy[0] = point->X;
+	  xy[1] = point->Y;
+	  approx_transform_coords (p, xy, 1, 2);
+	  point->X = xy[0];
+	  point->Y = xy[1];
+	  point = point->Next;
+      }
+    line = geom->FirstLinestring;
+    while (line)
+      {
+	  approx_transform_coords (p, line->Coords, line->Points, dims);
+	  line = line->Next;
+      }
+    polyg = geom->FirstPolygon;
+    while (polyg)
+      {
+	  ring = polyg->Exterior;
+	  approx_transform_coords (p, ring->Coords, ring->Points, dims);
+	  for (ib = 0; ib < polyg->NumInteriors; ib++)
+	    {
+		ring = polyg->Interiors + ib;
+		approx_transform_coords (p, ring->Coords, ring->Points, dims);
+	    }
+	  polyg = polyg->Next;
+      }
+    gaiaMbrGeometry (geom);
+    return geom;
+}
+
 #endif /* end including GCO */
@@ -58,122 +58,25 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <spatialite/sqlite.h>
 
 #include <spatialite/gaiageo.h>
+#include <spatialite_private.h>
 
 GAIAGEO_DECLARE double
 gaiaMeasureLength (int dims, double *coords, int vert)
 {
 /* computes the total length */
-    double lung = 0.0;
-    double xx1;
-    double xx2;
-    double yy1;
-    double yy2;
-    double x;
-    double y;
-    double z;
-    double m;
-    double dist;
-    int ind;
     if (vert <= 0)
-	return lung;
-    if (dims == GAIA_XY_Z)
-      {
-	  gaiaGetPointXYZ (coords, 0, &xx1, &yy1, &z);
-      }
-    else if (dims == GAIA_XY_M)
-      {
-	  gaiaGetPointXYM (coords, 0, &xx1, &yy1, &m);
-      }
-    else if (dims == GAIA_XY_Z_M)
-      {
-	  gaiaGetPointXYZM (coords, 0, &xx1, &yy1, &z, &m);
-      }
-    else
-      {
-	  gaiaGetPoint (coords, 0, &xx1, &yy1);
-      }
-    for (ind = 1; ind < vert; ind++)
-      {
-	  if (dims == GAIA_XY_Z)
-	    {
-		gaiaGetPointXYZ (coords, ind, &xx2, &yy2, &z);
-	    }
-	  else if (dims == GAIA_XY_M)
-	    {
-		gaiaGetPointXYM (coords, ind, &xx2, &yy2, &m);
-	    }
-	  else if (dims == GAIA_XY_Z_M)
-	    {
-		gaiaGetPointXYZM (coords, ind, &xx2, &yy2, &z, &m);
-	    }
-	  else
-	    {
-		gaiaGetPoint (coords, ind, &xx2, &yy2);
-	    }
-	  x = xx1 - xx2;
-	  y = yy1 - yy2;
-	  dist = sqrt ((x * x) + (y * y));
-	  lung += dist;
-	  xx1 = xx2;
-	  yy1 = yy2;
-      }
-    return lung;
+	return 0.0;
+    return gaiaCoordsLength (coords, vert, dims);
 }
 
 GAIAGEO_DECLARE double
 gaiaMeasureArea (gaiaRingPtr ring)
 {
 /* computes the area */
-    int iv;
-    double xx;
-    double yy;
-    double x;
-    double y;
-    double z;
-    double m;
-    double area = 0.0;
     if (!ring)
 	return 0.0;
-    if (ring->DimensionModel == GAIA_XY_Z)
-      {
-	  gaiaGetPointXYZ (ring->Coords, 0, &xx, &yy, &z);
-      }
-    else if (ring->DimensionModel == GAIA_XY_M)
-      {
-	  gaiaGetPointXYM (ring->Coords, 0, &xx, &yy, &m);
-      }
-    else if (ring->DimensionModel == GAIA_XY_Z_M)
-      {
-	  gaiaGetPointXYZM (ring->Coords, 0, &xx, &yy, &z, &m);
-      }
-    else
-      {
-	  gaiaGetPoint (ring->Coords, 0, &xx, &yy);
-      }
-    for (iv = 1; iv < ring->Points; iv++)
-      {
-	  if (ring->DimensionModel == GAIA_XY_Z)
-	    {
-		gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
-	    }
-	  else if (ring->DimensionModel == GAIA_XY_M)
-	    {
-		gaiaGetPointXYM (ring->Coords, iv, &x, &y, &m);
-	    }
-	  else if (ring->DimensionModel == GAIA_XY_Z_M)
-	    {
-		gaiaGetPointXYZM (ring->Coords, iv, &x, &y, &z, &m);
-	    }
-	  else
-	    {
-		gaiaGetPoint (ring->Coords, iv, &x, &y);
-	    }
-	  area += ((xx * y) - (x * yy));
-	  xx = x;
-	  yy = y;
-      }
-    area /= 2.0;
-    return fabs (area);
+    return fabs (gaiaCoordsSignedArea
+		 (ring->Coords, ring->Points, ring->DimensionModel));
 }
 
 GAIAGEO_DECLARE void
@@ -54,6 +54,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include "config.h"
 #endif
 
+#include <spatialite_private.h>
 #include <spatialite/sqlite.h>
 #include <spatialite/debug.h>
 
@@ -1860,6 +1861,8 @@ findEwktSrid (const char *buffer, int *base_offset)
 		in++;
 		continue;
 	    }
+	  if (out - dummy >= (int) sizeof (dummy) - 1)
+	      return -1;	/* too long: surely not a valid SRID prefix */
 	  *out++ = *in++;
       }
     *out = '\0';
@@ -1880,9 +1883,10 @@ findEwktSrid (const char *buffer, int *base_offset)
     return atoi (dummy + 5);
 }
 
-gaiaGeomCollPtr
-gaiaParseEWKT (const unsigned char *dirty_buffer)
+static gaiaGeomCollPtr
+ewktParseEWKT (const unsigned char *dirty_buffer)
 {
+/* the full Flex/Lemon based EWKT parser */
     void *pParser = ParseAlloc (malloc);
     /* Linked-list of token values */
     ewktFlexToken *tokens = malloc (sizeof (ewktFlexToken));
@@ -1968,6 +1972,29 @@ gaiaParseEWKT (const unsigned char *dirty_buffer)
     return str_data.result;
 }
 
+gaiaGeomCollPtr
+gaiaParseEWKT (const unsigned char *dirty_buffer)
+{
+    gaiaGeomCollPtr geom;
+    int srid;
+    int base_offset;
+
+/* attempting first to use the single-pass parser */
+    srid = findEwktSrid ((char *) dirty_buffer, &base_offset);
+    geom = gaiaFastParseWkt (dirty_buffer + base_offset, 1);
+    if (geom == NULL)
+	return ewktParseEWKT (dirty_buffer);
+
+    if (!ewktCheckValidity (geom))
+      {
+	  gaiaFreeGeomColl (geom);
+	  return NULL;
+      }
+    gaiaMbrGeometry (geom);
+    geom->Srid = srid;
+    return geom;
+}
+
 
 /*
 ** CAVEAT: we must now undefine any Lemon/Flex own macro
@@ -54,6 +54,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include "config.h"
 #endif
 
+#include <spatialite_private.h>
 #include <spatialite/sqlite.h>
 #include <spatialite/debug.h>
 
@@ -1281,9 +1282,10 @@ geoJSON_cleanup (geoJsonFlexToken * token)
     return 0;
 }
 
-gaiaGeomCollPtr
-gaiaParseGeoJSON (const unsigned char *dirty_buffer)
+static gaiaGeomCollPtr
+geoJsonParseGeoJSON (const unsigned char *dirty_buffer)
 {
+/* the full Flex/Lemon based GeoJSON parser */
     void *pParser = ParseAlloc (malloc);
     /* Linked-list of token values */
     geoJsonFlexToken *tokens = malloc (sizeof (geoJsonFlexToken));
@@ -1366,6 +1368,25 @@ gaiaParseGeoJSON (const unsigned char *dirty_buffer)
     return str_data.result;
 }
 
+gaiaGeomCollPtr
+gaiaParseGeoJSON (const unsigned char *dirty_buffer)
+{
+    gaiaGeomCollPtr geom;
+
+/* attempting first to use the single-pass parser */
+    geom = gaiaFastParseGeoJSON (dirty_buffer);
+    if (geom == NULL)
+	return geoJsonParseGeoJSON (dirty_buffer);
+
+    if (!geoJsonCheckValidity (geom))
+      {
+	  gaiaFreeGeomColl (geom);
+	  return NULL;
+      }
+    gaiaMbrGeometry (geom);
+    return geom;
+}
+
 
 /*
 ** CAVEAT: we must now undefine any Lemon/Flex own macro
@@ -59,6 +59,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <spatialite/sqlite.h>
 
 #include <spatialite/gaiageo.h>
+#include <spatialite_private.h>
 
 #define DEG2RAD	0.0174532925199432958
 #define PI	3.14159265358979323846
@@ -149,58 +150,56 @@ gaiaEllipseParams (const char *name, double *a, double *b, double *rf)
     return 0;
 }
 
-GAIAGEO_DECLARE double
-gaiaGreatCircleDistance (double a, double b, double lat1, double lon1,
-			 double lat2, double lon2)
+struct geodesic_ellipsoid
 {
-/*
-/ Calculate great-circle distance (in m) between two points specified by 
-/ latitude/longitude (in decimal degrees) using Aviation Formulary
-/
-/ http://williams.best.vwh.net/avform.htm#Dist
-/
+/* ellipsoid constants shared by all the Vincenty kernels */
+    double a;			/* equatorial radius - meters */
+    double b;			/* polar radius - meters */
+    double f;			/* flattening */
+    double one_minus_f;
+    double ep2;			/* second eccentricity squared */
+};
+
+static void
+geodesic_ellipsoid_init (struct geodesic_ellipsoid *ell, double a, double b,
+			 double rf)
+{
+/* precomputing the ellipsoid constants once per call */
+    ell->a = a;
+    ell->b = b;
+    ell->f = 1.0 / rf;
+    ell->one_minus_f = 1.0 - ell->f;
+    ell->ep2 = (a * a - b * b) / (b * b);
+}
+
+static void
+geodesic_reduced_latitude (const struct geodesic_ellipsoid *ell, double lat,
+			   double *sinU, double *cosU)
+{
+/* 
+/ computing sin/cos of the reduced latitude U = atan((1-f) * tan(lat));
+/ using the identities cos(atan(x)) = 1/sqrt(1+x^2) and 
+/ sin(atan(x)) = x * cos(atan(x)) saves three transcendental calls
 */
-    double latrad1 = lat1 * DEG2RAD;
-    double lonrad1 = lon1 * DEG2RAD;
-    double latrad2 = lat2 * DEG2RAD;
-    double lonrad2 = lon2 * DEG2RAD;
-    double avg_radius;
-    double k1 = (sin ((latrad1 - latrad2) / 2.0));
-    double k2 = (sin ((lonrad1 - lonrad2) / 2.0));
-    double dist;
-    dist =
-	2.0 * asin (sqrt (k1 * k1 + cos (latrad1) * cos (latrad2) * k2 * k2));
-    if (dist < 0.0)
-	dist = dist + PI;
-    if (a == b)
-	avg_radius = a;
-    else
-	avg_radius = (2.0 * a + b) / 3.0;
-    dist = dist * avg_radius;
-    return dist;
+    double tanU = ell->one_minus_f * tan (lat * DEG2RAD);
+    *cosU = 1.0 / sqrt (1.0 + tanU * tanU);
+    *sinU = tanU * *cosU;
 }
 
-GAIAGEO_DECLARE double
-gaiaGeodesicDistance (double a, double b, double rf, double lat1, double lon1,
-		      double lat2, double lon2)
+static double
+vincenty_inverse (const struct geodesic_ellipsoid *ell, double sinU1,
+		  double cosU1, double sinU2, double cosU2, double L)
 {
 /*
-/ Calculate geodesic distance (in m) 
-/ between two points specified by latitude/longitude 
-/ (in decimal degrees) using Vincenty inverse formula for ellipsoids
+/ Vincenty inverse formula for ellipsoids: core iteration
 /
 / based on original JavaScript by (c) Chris Veness 2002-2008 
 / http://www.movable-type.co.uk/scripts/latlong-vincenty.html
 /
+/ both reduced latitudes are expected to be already resolved 
+/ into their sin/cos pairs; L is the longitude difference (radians)
 */
-    double f = 1.0 / rf;
-    double L = (lon2 - lon1) * DEG2RAD;
-    double U1 = atan ((1.0 - f) * tan (lat1 * DEG2RAD));
-    double U2 = atan ((1.0 - f) * tan (lat2 * DEG2RAD));
-    double sinU1 = sin (U1);
-    double cosU1 = cos (U1);
-    double sinU2 = sin (U2);
-    double cosU2 = cos (U2);
+    double f = ell->f;
     double lambda = L;
     double lambdaP;
     double sinLambda;
@@ -250,7 +249,7 @@ gaiaGeodesicDistance (double a, double b, double rf, double lat1, double lon1,
     while (fabs (lambda - lambdaP) > 1e-12 && --iterLimit > 0);
     if (iterLimit == 0)
 	return -1.0;		/* formula failed to converge */
-    uSq = cosSqAlpha * (a * a - b * b) / (b * b);
+    uSq = cosSqAlpha * ell->ep2;
     A = 1.0 + uSq / 16384.0 * (4096.0 +
 			       uSq * (-768.0 + uSq * (320.0 - 175.0 * uSq)));
     B = uSq / 1024.0 * (256.0 + uSq * (-128.0 + uSq * (74.0 - 47.0 * uSq)));
@@ -265,10 +264,186 @@ gaiaGeodesicDistance (double a, double b, double rf, double lat1, double lon1,
 									cos2SigmaM
 									*
 									cos2SigmaM)));
-    s = b * A * (sigma - deltaSigma);
+    s = ell->b * A * (sigma - deltaSigma);
     return s;
 }
 
+static double
+great_circle_radius (double a, double b)
+{
+/* the average radius used by all the Great Circle kernels */
+    if (a == b)
+	return a;
+    return (2.0 * a + b) / 3.0;
+}
+
+static double
+great_circle_angle (double latrad1, double coslat1, double lonrad1,
+		    double latrad2, double coslat2, double lonrad2)
+{
+/* 
+/ haversine central angle between two points; the cosine of 
+/ both latitudes is expected to be already resolved
+*/
+    double k1 = (sin ((latrad1 - latrad2) / 2.0));
+    double k2 = (sin ((lonrad1 - lonrad2) / 2.0));
+    double dist = 2.0 * asin (sqrt (k1 * k1 + coslat1 * coslat2 * k2 * k2));
+    if (dist < 0.0)
+	dist = dist + PI;
+    return dist;
+}
+
+GAIAGEO_DECLARE double
+gaiaGreatCircleDistance (double a, double b, double lat1, double lon1,
+			 double lat2, double lon2)
+{
+/*
+/ Calculate great-circle distance (in m) between two points specified by 
+/ latitude/longitude (in decimal degrees) using Aviation Formulary
+/
+/ http://williams.best.vwh.net/avform.htm#Dist
+/
+*/
+    double latrad1 = lat1 * DEG2RAD;
+    double lonrad1 = lon1 * DEG2RAD;
+    double latrad2 = lat2 * DEG2RAD;
+    double lonrad2 = lon2 * DEG2RAD;
+    double dist = great_circle_angle (latrad1, cos (latrad1), lonrad1,
+				      latrad2, cos (latrad2), lonrad2);
+    return dist * great_circle_radius (a, b);
+}
+
+GAIAGEO_DECLARE double
+gaiaGeodesicDistance (double a, double b, double rf, double lat1, double lon1,
+		      double lat2, double lon2)
+{
+/*
+/ Calculate geodesic distance (in m) 
+/ between two points specified by latitude/longitude 
+/ (in decimal degrees) using Vincenty inverse formula for ellipsoids
+*/
+    struct geodesic_ellipsoid ell;
+    double sinU1;
+    double cosU1;
+    double sinU2;
+    double cosU2;
+    geodesic_ellipsoid_init (&ell, a, b, rf);
+    geodesic_reduced_latitude (&ell, lat1, &sinU1, &cosU1);
+    geodesic_reduced_latitude (&ell, lat2, &sinU2, &cosU2);
+    return vincenty_inverse (&ell, sinU1, cosU1, sinU2, cosU2,
+			     (lon2 - lon1) * DEG2RAD);
+}
+
+static void
+great_circle_half_angles (double latrad, double lonrad, double *values,
+			  int count, int index)
+{
+/* storing the terms of the expanded haversine formula for a Point */
+    values[index] = sin (latrad / 2.0);
+    values[count + index] = cos (latrad / 2.0);
+    values[(2 * count) + index] = sin (lonrad / 2.0);
+    values[(3 * count) + index] = cos (lonrad / 2.0);
+    values[(4 * count) + index] = cos (latrad);
+}
+
+GAIAGEO_DECLARE int
+gaiaGreatCircleDistanceMatrix (double a, double b, const double *coords1,
+			       int n1, const double *coords2, int n2,
+			       double *matrix)
+{
+/*
+/ computing all the Great Circle distances between two sets of Points
+/
+/ sin((lat1 - lat2) / 2) and sin((lon1 - lon2) / 2) are expanded as
+/ differences of products, so that once all the half angles have been
+/ resolved each cell only needs a square root and an arc sine
+*/
+    int i;
+    int j;
+    double radius = great_circle_radius (a, b);
+    double *set2;
+    double point1[5];
+    double *row;
+    if (coords1 == NULL || coords2 == NULL || matrix == NULL || n1 < 1
+	|| n2 < 1)
+	return 0;
+    set2 = malloc (sizeof (double) * n2 * 5);
+    if (set2 == NULL)
+	return 0;
+    for (j = 0; j < n2; j++)
+      {
+	  /* resolving the second set just once */
+	  great_circle_half_angles (coords2[(j * 2) + 1] * DEG2RAD,
+				    coords2[j * 2] * DEG2RAD, set2, n2, j);
+      }
+    for (i = 0; i < n1; i++)
+      {
+	  great_circle_half_angles (coords1[(i * 2) + 1] * DEG2RAD,
+				    coords1[i * 2] * DEG2RAD, point1, 1, 0);
+	  row = matrix + ((size_t) i * n2);
+	  gaiaCoordsHaversineRow (point1, set2, n2, row);
+	  for (j = 0; j < n2; j++)
+	    {
+		/* rounding could slightly exceed 1 for antipodal Points */
+		double h = (row[j] > 1.0) ? 1.0 : row[j];
+		row[j] = 2.0 * asin (h) * radius;
+	    }
+      }
+    free (set2);
+    return 1;
+}
+
+GAIAGEO_DECLARE int
+gaiaGeodesicDistanceMatrix (double a, double b, double rf,
+			    const double *coords1, int n1,
+			    const double *coords2, int n2, double *matrix)
+{
+/* computing all the Geodesic distances between two sets of Points */
+    struct geodesic_ellipsoid ell;
+    int i;
+    int j;
+    int ok = 1;
+    double *cache;
+    double *sinU2;
+    double *cosU2;
+    double sinU1;
+    double cosU1;
+    double lon1;
+    double *row;
+    if (coords1 == NULL || coords2 == NULL || matrix == NULL || n1 < 1
+	|| n2 < 1)
+	return 0;
+    cache = malloc (sizeof (double) * n2 * 2);
+    if (cache == NULL)
+	return 0;
+    sinU2 = cache;
+    cosU2 = cache + n2;
+    geodesic_ellipsoid_init (&ell, a, b, rf);
+    for (j = 0; j < n2; j++)
+      {
+	  /* resolving the second set just once */
+	  geodesic_reduced_latitude (&ell, coords2[(j * 2) + 1], sinU2 + j,
+				     cosU2 + j);
+      }
+    for (i = 0; i < n1; i++)
+      {
+	  lon1 = coords1[i * 2];
+	  geodesic_reduced_latitude (&ell, coords1[(i * 2) + 1], &sinU1,
+				     &cosU1);
+	  row = matrix + ((size_t) i * n2);
+	  for (j = 0; j < n2; j++)
+	    {
+		row[j] =
+		    vincenty_inverse (&ell, sinU1, cosU1, sinU2[j], cosU2[j],
+				      (coords2[j * 2] - lon1) * DEG2RAD);
+		if (row[j] < 0.0)
+		    ok = 0;
+	    }
+      }
+    free (cache);
+    return ok;
+}
+
 GAIAGEO_DECLARE void
 gaiaFree (void *ptr)
 {
@@ -278,86 +453,309 @@ gaiaFree (void *ptr)
     free (ptr);
 }
 
+static double
+geodesic_min_radius (double a, double b)
+{
+/* 
+/ the smallest radius of curvature of the ellipsoid (meridional at the
+/ equator): any ellipsoidal distance is >= this radius times the 
+/ spherical central angle between the same lat/lon pairs
+*/
+    return b * b / a;
+}
+
+static double
+geodesic_max_radius (double a, double b)
+{
+/* the largest radius of curvature of the ellipsoid (at the poles) */
+    return a * a / b;
+}
+
+static double
+geodesic_lon_gap (double lon, double minx, double maxx)
+{
+/* angular gap (degrees) between some longitude and an interval, wrapping */
+    double gap = 360.0;
+    double d;
+    int k;
+    for (k = -1; k <= 1; k++)
+      {
+	  double x = lon + (k * 360.0);
+	  if (x >= minx && x <= maxx)
+	      return 0.0;
+	  d = (x < minx) ? minx - x : x - maxx;
+	  if (d < gap)
+	      gap = d;
+      }
+    if (gap > 180.0)
+	gap = 180.0;
+    return gap;
+}
+
+GAIAGEO_DECLARE int
+gaiaGeodesicSearchWindows (double a, double b, double lat, double lon,
+			   double radius, double *minx, double *miny,
+			   double *maxx, double *maxy)
+{
+/*
+/ computing the lat/lon search window(s) fully containing all the 
+/ points falling within some distance (in m) from a reference point
+/
+/ the window is the bounding box of a spherical cap: its longitude 
+/ half-width widens with latitude, it becomes a full longitude band
+/ when the cap includes a Pole, and it is split in two when crossing
+/ the antimeridian
+*/
+    double delta;
+    double dlat;
+    double dlon;
+    double lat_min;
+    double lat_max;
+    double x;
+    if (radius < 0.0 || lat < -90.0 || lat > 90.0)
+	return 0;
+    delta = (radius / geodesic_min_radius (a, b)) * (180.0 / PI);
+    dlat = delta;
+    lat_min = lat - dlat;
+    lat_max = lat + dlat;
+    if (lat_min <= -90.0 || lat_max >= 90.0 || delta >= 90.0)
+	dlon = 180.0;
+    else
+      {
+	  x = sin (delta * DEG2RAD) / cos (lat * DEG2RAD);
+	  if (x >= 1.0)
+	      dlon = 180.0;
+	  else
+	      dlon = asin (x) * (180.0 / PI);
+      }
+    if (lat_min < -90.0)
+	lat_min = -90.0;
+    if (lat_max > 90.0)
+	lat_max = 90.0;
+    miny[0] = lat_min;
+    maxy[0] = lat_max;
+    miny[1] = lat_min;
+    maxy[1] = lat_max;
+    if (dlon >= 180.0)
+      {
+	  /* full longitude band */
+	  minx[0] = -180.0;
+	  maxx[0] = 180.0;
+	  return 1;
+      }
+    minx[0] = lon - dlon;
+    maxx[0] = lon + dlon;
+    if (minx[0] < -180.0)
+      {
+	  /* crossing the antimeridian westward */
+	  minx[1] = minx[0] + 360.0;
+	  maxx[1] = 180.0;
+	  minx[0] = -180.0;
+	  return 2;
+      }
+    if (maxx[0] > 180.0)
+      {
+	  /* crossing the antimeridian eastward */
+	  minx[1] = -180.0;
+	  maxx[1] = maxx[0] - 360.0;
+	  maxx[0] = 180.0;
+	  return 2;
+      }
+    return 1;
+}
+
+GAIAGEO_DECLARE double
+gaiaGeodesicMbrMinDistance (double a, double b, double lat, double lon,
+			    double minx, double miny, double maxx, double maxy)
+{
+/*
+/ computing a lower bound (in m) of the distance between a point 
+/ and any other point contained within a lat/lon MBR
+/
+/ the exact spherical distance from the MBR is computed: if the
+/ longitude falls outside the MBR the nearest point lies on its
+/ nearest bounding meridian, at the foot of the perpendicular 
+/ (clamped to the MBR latitude range)
+*/
+    double dlon = geodesic_lon_gap (lon, minx, maxx);
+    double latrad = lat * DEG2RAD;
+    double foot;
+    double angle;
+    if (dlon == 0.0)
+      {
+	  /* just the gap between parallels */
+	  if (lat < miny)
+	      angle = (miny - lat) * DEG2RAD;
+	  else if (lat > maxy)
+	      angle = (lat - maxy) * DEG2RAD;
+	  else
+	      return 0.0;
+	  return angle * geodesic_min_radius (a, b);
+      }
+    if (dlon >= 90.0)
+	foot = (lat < 0.0) ? -90.0 : 90.0;
+    else
+	foot = atan (tan (latrad) / cos (dlon * DEG2RAD)) * (180.0 / PI);
+    if (foot < miny)
+	foot = miny;
+    if (foot > maxy)
+	foot = maxy;
+    foot *= DEG2RAD;
+    angle =
+	great_circle_angle (latrad, cos (latrad), 0.0, foot, cos (foot),
+			    dlon * DEG2RAD);
+    return angle * geodesic_min_radius (a, b);
+}
+
+GAIAGEO_DECLARE int
+gaiaGeodesicDistWithin (double a, double b, double rf, double lat1,
+			double lon1, double lat2, double lon2, double radius,
+			int use_ellipsoid)
+{
+/*
+/ checks if the distance between two points is <= radius (in m)
+/
+/ the cheap spherical angle brackets the ellipsoidal distance between
+/ the smallest and largest radius of curvature, so the Vincenty 
+/ formula is only required for pairs falling within that narrow band
+*/
+    double latrad1 = lat1 * DEG2RAD;
+    double latrad2 = lat2 * DEG2RAD;
+    double angle;
+    double dist;
+    if (radius < 0.0)
+	return 0;
+    angle = great_circle_angle (latrad1, cos (latrad1), lon1 * DEG2RAD,
+				latrad2, cos (latrad2), lon2 * DEG2RAD);
+    if (!use_ellipsoid)
+	return (angle * great_circle_radius (a, b) <= radius) ? 1 : 0;
+    if (angle * geodesic_min_radius (a, b) > radius)
+	return 0;
+    if (angle * geodesic_max_radius (a, b) <= radius)
+	return 1;
+    dist = gaiaGeodesicDistance (a, b, rf, lat1, lon1, lat2, lon2);
+    if (dist < 0.0)
+      {
+	  /* failed to converge: nearly antipodal points */
+	  dist = angle * great_circle_radius (a, b);
+      }
+    return (dist <= radius) ? 1 : 0;
+}
+
+static void
+geodesic_get_xy (int dims, const double *coords, int iv, double *x,
+		 double *y)
+{
+/* fetching the X,Y coords of some Vertex, whatever the dimensions */
+    int stride;
+    switch (dims)
+      {
+      case GAIA_XY_Z:
+      case GAIA_XY_M:
+	  stride = 3;
+	  break;
+      case GAIA_XY_Z_M:
+	  stride = 4;
+	  break;
+      default:
+	  stride = 2;
+	  break;
+      }
+    *x = coords[iv * stride];
+    *y = coords[(iv * stride) + 1];
+}
+
 GAIAGEO_DECLARE double
 gaiaGreatCircleTotalLength (double a, double b, int dims, double *coords,
 			    int vert)
 {
-/* computing the GreatCircle total length for some Linestring/Ring */
+/* 
+/ computing the GreatCircle total length for some Linestring/Ring
+/
+/ each Vertex is converted into radians (and its latitude cosine
+/ is resolved) just once, then carried over to the next segment
+*/
     int iv;
-    double x1 = 0.0;
-    double y1 = 0.0;
+    double x1;
+    double y1;
     double x2;
     double y2;
-    double z;
-    double m;
-    double len = 0.0;
-    for (iv = 0; iv < vert; iv++)
+    double latrad1;
+    double lonrad1;
+    double coslat1;
+    double latrad2;
+    double lonrad2;
+    double coslat2;
+    double angle = 0.0;
+    if (vert < 2)
+	return 0.0;
+    geodesic_get_xy (dims, coords, 0, &x1, &y1);
+    latrad1 = y1 * DEG2RAD;
+    lonrad1 = x1 * DEG2RAD;
+    coslat1 = cos (latrad1);
+    for (iv = 1; iv < vert; iv++)
       {
-	  if (dims == GAIA_XY_Z)
-	    {
-		gaiaGetPointXYZ (coords, iv, &x2, &y2, &z);
-	    }
-	  else if (dims == GAIA_XY_M)
-	    {
-		gaiaGetPointXYM (coords, iv, &x2, &y2, &m);
-	    }
-	  else if (dims == GAIA_XY_Z_M)
-	    {
-		gaiaGetPointXYZM (coords, iv, &x2, &y2, &z, &m);
-	    }
-	  else
-	    {
-		gaiaGetPoint (coords, iv, &x2, &y2);
-	    }
-	  if (iv > 0)
-	      len += gaiaGreatCircleDistance (a, b, y1, x1, y2, x2);
+	  geodesic_get_xy (dims, coords, iv, &x2, &y2);
+	  if (x2 == x1 && y2 == y1)
+	      continue;		/* repeated Vertex */
+	  latrad2 = y2 * DEG2RAD;
+	  lonrad2 = x2 * DEG2RAD;
+	  coslat2 = cos (latrad2);
+	  angle +=
+	      great_circle_angle (latrad1, coslat1, lonrad1, latrad2, coslat2,
+				  lonrad2);
 	  x1 = x2;
 	  y1 = y2;
+	  latrad1 = latrad2;
+	  lonrad1 = lonrad2;
+	  coslat1 = coslat2;
       }
-    return len;
+    return angle * great_circle_radius (a, b);
 }
 
 GAIAGEO_DECLARE double
 gaiaGeodesicTotalLength (double a, double b, double rf, int dims,
 			 double *coords, int vert)
 {
-/* computing the Geodesic total length for some Linestring/Ring */
+/* 
+/ computing the Geodesic total length for some Linestring/Ring
+/
+/ the ellipsoid constants are resolved once per call, and the
+/ reduced latitude of each Vertex is computed just once and then
+/ carried over to the next segment
+*/
+    struct geodesic_ellipsoid ell;
     int iv;
-    double x1 = 0.0;
-    double y1 = 0.0;
+    double x1;
+    double y1;
     double x2;
     double y2;
-    double z;
-    double m;
+    double sinU1;
+    double cosU1;
+    double sinU2;
+    double cosU2;
     double l;
     double len = 0.0;
-    for (iv = 0; iv < vert; iv++)
+    if (vert < 2)
+	return 0.0;
+    geodesic_ellipsoid_init (&ell, a, b, rf);
+    geodesic_get_xy (dims, coords, 0, &x1, &y1);
+    geodesic_reduced_latitude (&ell, y1, &sinU1, &cosU1);
+    for (iv = 1; iv < vert; iv++)
       {
-	  if (dims == GAIA_XY_Z)
-	    {
-		gaiaGetPointXYZ (coords, iv, &x2, &y2, &z);
-	    }
-	  else if (dims == GAIA_XY_M)
-	    {
-		gaiaGetPointXYM (coords, iv, &x2, &y2, &m);
-	    }
-	  else if (dims == GAIA_XY_Z_M)
-	    {
-		gaiaGetPointXYZM (coords, iv, &x2, &y2, &z, &m);
-	    }
-	  else
-	    {
-		gaiaGetPoint (coords, iv, &x2, &y2);
-	    }
-	  if (iv > 0)
-	    {
-		l = gaiaGeodesicDistance (a, b, rf, y1, x1, y2, x2);
-		if (l < 0.0)
-		    return -1.0;
-		len += l;
-	    }
+	  geodesic_get_xy (dims, coords, iv, &x2, &y2);
+	  if (x2 == x1 && y2 == y1)
+	      continue;		/* repeated Vertex */
+	  geodesic_reduced_latitude (&ell, y2, &sinU2, &cosU2);
+	  l = vincenty_inverse (&ell, sinU1, cosU1, sinU2, cosU2,
+				(x2 - x1) * DEG2RAD);
+	  if (l < 0.0)
+	      return -1.0;
+	  len += l;
 	  x1 = x2;
 	  y1 = y2;
+	  sinU1 = sinU2;
+	  cosU1 = cosU2;
       }
     return len;
 }
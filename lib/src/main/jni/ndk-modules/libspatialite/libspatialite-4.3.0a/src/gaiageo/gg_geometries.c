@@ -59,6 +59,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <spatialite/sqlite.h>
 
 #include <spatialite/gaiageo.h>
+#include <spatialite_private.h>
 
 GAIAGEO_DECLARE gaiaPointPtr
 gaiaAllocPoint (double x, double y)
@@ -2234,84 +2235,16 @@ GAIAGEO_DECLARE void
 gaiaMbrLinestring (gaiaLinestringPtr line)
 {
 /* computes the MBR for this linestring */
-    int iv;
-    double x;
-    double y;
-    double z;
-    double m;
-    line->MinX = DBL_MAX;
-    line->MinY = DBL_MAX;
-    line->MaxX = -DBL_MAX;
-    line->MaxY = -DBL_MAX;
-    for (iv = 0; iv < line->Points; iv++)
-      {
-	  if (line->DimensionModel == GAIA_XY_Z)
-	    {
-		gaiaGetPointXYZ (line->Coords, iv, &x, &y, &z);
-	    }
-	  else if (line->DimensionModel == GAIA_XY_M)
-	    {
-		gaiaGetPointXYM (line->Coords, iv, &x, &y, &m);
-	    }
-	  else if (line->DimensionModel == GAIA_XY_Z_M)
-	    {
-		gaiaGetPointXYZM (line->Coords, iv, &x, &y, &z, &m);
-	    }
-	  else
-	    {
-		gaiaGetPoint (line->Coords, iv, &x, &y);
-	    }
-	  if (x < line->MinX)
-	      line->MinX = x;
-	  if (y < line->MinY)
-	      line->MinY = y;
-	  if (x > line->MaxX)
-	      line->MaxX = x;
-	  if (y > line->MaxY)
-	      line->MaxY = y;
-      }
+    gaiaCoordsMbr (line->Coords, line->Points, line->DimensionModel,
+		   &(line->MinX), &(line->MinY), &(line->MaxX), &(line->MaxY));
 }
 
 GAIAGEO_DECLARE void
 gaiaMbrRing (gaiaRingPtr rng)
 {
 /* computes the MBR for this ring */
-    int iv;
-    double x;
-    double y;
-    double z;
-    double m;
-    rng->MinX = DBL_MAX;
-    rng->MinY = DBL_MAX;
-    rng->MaxX = -DBL_MAX;
-    rng->MaxY = -DBL_MAX;
-    for (iv = 0; iv < rng->Points; iv++)
-      {
-	  if (rng->DimensionModel == GAIA_XY_Z)
-	    {
-		gaiaGetPointXYZ (rng->Coords, iv, &x, &y, &z);
-	    }
-	  else if (rng->DimensionModel == GAIA_XY_M)
-	    {
-		gaiaGetPointXYM (rng->Coords, iv, &x, &y, &m);
-	    }
-	  else if (rng->DimensionModel == GAIA_XY_Z_M)
-	    {
-		gaiaGetPointXYZM (rng->Coords, iv, &x, &y, &z, &m);
-	    }
-	  else
-	    {
-		gaiaGetPoint (rng->Coords, iv, &x, &y);
-	    }
-	  if (x < rng->MinX)
-	      rng->MinX = x;
-	  if (y < rng->MinY)
-	      rng->MinY = y;
-	  if (x > rng->MaxX)
-	      rng->MaxX = x;
-	  if (y > rng->MaxY)
-	      rng->MaxY = y;
-      }
+    gaiaCoordsMbr (rng->Coords, rng->Points, rng->DimensionModel,
+		   &(rng->MinX), &(rng->MinY), &(rng->MaxX), &(rng->MaxY));
 }
 
 GAIAGEO_DECLARE void
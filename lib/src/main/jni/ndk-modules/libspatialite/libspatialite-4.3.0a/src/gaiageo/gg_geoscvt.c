@@ -64,6 +64,158 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_GEOS		/* including GEOS */
 
+#if defined(GEOS_CAPI_COORDSEQ_BUFFER) || GEOS_VERSION_MAJOR > 3 || (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 10)
+/* GEOS supports bulk copying of whole Coordinate Sequences */
+#define GAIA_GEOS_BULK_COORDS
+#endif
+
+static GEOSCoordSequence *
+toGeosCoordSeq (GEOSContextHandle_t handle, const double *coords,
+		int points, int dimension_model, unsigned int dims,
+		int close_ring)
+{
+/* copying a GAIA coordinate array into a GEOS Coordinate Sequence */
+    int iv;
+    int n_points = points;
+    int has_z = 0;
+    int has_m = 0;
+    int stride;
+    const double *p;
+    GEOSCoordSequence *cs;
+    if (dimension_model == GAIA_XY_Z || dimension_model == GAIA_XY_Z_M)
+	has_z = 1;
+    if (dimension_model == GAIA_XY_M || dimension_model == GAIA_XY_Z_M)
+	has_m = 1;
+    stride = 2 + has_z + has_m;
+#ifdef GAIA_GEOS_BULK_COORDS
+    if (!close_ring && dims == (unsigned int) (has_z ? 3 : 2))
+      {
+	  /* the GAIA coordinate array can be directly copied as a whole */
+	  if (handle != NULL)
+	      return GEOSCoordSeq_copyFromBuffer_r (handle, coords, points,
+						    has_z, has_m);
+	  return GEOSCoordSeq_copyFromBuffer (coords, points, has_z, has_m);
+      }
+#endif
+    if (close_ring)
+	n_points++;
+    if (handle != NULL)
+	cs = GEOSCoordSeq_create_r (handle, n_points, dims);
+    else
+	cs = GEOSCoordSeq_create (n_points, dims);
+    if (cs == NULL)
+	return NULL;
+    for (iv = 0; iv < n_points; iv++)
+      {
+	  /* the closing vertex (if any) repeats the first one */
+	  p = coords + (stride * ((iv < points) ? iv : 0));
+	  if (handle != NULL)
+	    {
+		GEOSCoordSeq_setX_r (handle, cs, iv, p[0]);
+		GEOSCoordSeq_setY_r (handle, cs, iv, p[1]);
+		if (has_z)
+		    GEOSCoordSeq_setZ_r (handle, cs, iv, p[2]);
+	    }
+	  else
+	    {
+		GEOSCoordSeq_setX (cs, iv, p[0]);
+		GEOSCoordSeq_setY (cs, iv, p[1]);
+		if (has_z)
+		    GEOSCoordSeq_setZ (cs, iv, p[2]);
+	    }
+      }
+    return cs;
+}
+
+static GEOSGeometry *
+toGeosPoint (GEOSContextHandle_t handle, gaiaPointPtr pt, int dimension_model,
+	     unsigned int dims)
+{
+/* converting a GAIA Point into a GEOS Point */
+    double coords[3];
+    GEOSCoordSequence *cs;
+    coords[0] = pt->X;
+    coords[1] = pt->Y;
+    coords[2] = pt->Z;
+    if (dimension_model == GAIA_XY_Z || dimension_model == GAIA_XY_Z_M)
+	cs = toGeosCoordSeq (handle, coords, 1, GAIA_XY_Z, dims, 0);
+    else
+	cs = toGeosCoordSeq (handle, coords, 1, GAIA_XY, dims, 0);
+    if (cs == NULL)
+	return NULL;
+    if (handle != NULL)
+	return GEOSGeom_createPoint_r (handle, cs);
+    return GEOSGeom_createPoint (cs);
+}
+
+static GEOSGeometry *
+toGeosLinestring (GEOSContextHandle_t handle, gaiaLinestringPtr ln,
+		  unsigned int dims)
+{
+/* converting a GAIA Linestring into a GEOS Linestring */
+    GEOSCoordSequence *cs =
+	toGeosCoordSeq (handle, ln->Coords, ln->Points, ln->DimensionModel,
+			dims, 0);
+    if (cs == NULL)
+	return NULL;
+    if (handle != NULL)
+	return GEOSGeom_createLineString_r (handle, cs);
+    return GEOSGeom_createLineString (cs);
+}
+
+static GEOSGeometry *
+toGeosRing (const void *cache, GEOSContextHandle_t handle, gaiaRingPtr rng,
+	    unsigned int dims)
+{
+/* converting a GAIA Ring into a GEOS LinearRing */
+    int not_closed;
+    GEOSCoordSequence *cs;
+    if (cache != NULL)
+	not_closed = gaiaIsNotClosedRing_r (cache, rng);
+    else
+	not_closed = gaiaIsNotClosedRing (rng);
+    cs = toGeosCoordSeq (handle, rng->Coords, rng->Points,
+			 rng->DimensionModel, dims, not_closed);
+    if (cs == NULL)
+	return NULL;
+    if (handle != NULL)
+	return GEOSGeom_createLinearRing_r (handle, cs);
+    return GEOSGeom_createLinearRing (cs);
+}
+
+static GEOSGeometry *
+toGeosPolygon (const void *cache, GEOSContextHandle_t handle,
+	       gaiaPolygonPtr pg, unsigned int dims)
+{
+/* converting a GAIA Polygon into a GEOS Polygon */
+    int ib;
+    GEOSGeometry *geos;
+    GEOSGeometry *geos_ext;
+    GEOSGeometry **geos_holes = NULL;
+    geos_ext = toGeosRing (cache, handle, pg->Exterior, dims);
+    if (geos_ext == NULL)
+	return NULL;
+    if (pg->NumInteriors > 0)
+      {
+	  geos_holes = malloc (sizeof (GEOSGeometry *) * pg->NumInteriors);
+	  for (ib = 0; ib < pg->NumInteriors; ib++)
+	    {
+		/* interior rings */
+		*(geos_holes + ib) =
+		    toGeosRing (cache, handle, pg->Interiors + ib, dims);
+	    }
+      }
+    if (handle != NULL)
+	geos =
+	    GEOSGeom_createPolygon_r (handle, geos_ext, geos_holes,
+				      pg->NumInteriors);
+    else
+	geos = GEOSGeom_createPolygon (geos_ext, geos_holes, pg->NumInteriors);
+    if (geos_holes)
+	free (geos_holes);
+    return geos;
+}
+
 static GEOSGeometry *
 toGeosGeometry (const void *cache, GEOSContextHandle_t handle,
 		const gaiaGeomCollPtr gaia, int mode)
@@ -75,28 +227,12 @@ toGeosGeometry (const void *cache, GEOSContextHandle_t handle,
     int type;
     int geos_type;
     unsigned int dims;
-    int iv;
-    int ib;
     int nItem;
-    double x;
-    double y;
-    double z;
-    double m;
-    double x0 = 0.0;
-    double y0 = 0.0;
-    double z0 = 0.0;
     gaiaPointPtr pt;
     gaiaLinestringPtr ln;
     gaiaPolygonPtr pg;
-    gaiaRingPtr rng;
     GEOSGeometry *geos = NULL;
-    GEOSGeometry *geos_ext;
-    GEOSGeometry *geos_int;
-    GEOSGeometry *geos_item;
-    GEOSGeometry **geos_holes;
     GEOSGeometry **geos_coll;
-    GEOSCoordSequence *cs;
-    int ring_points;
     int n_items;
     if (!gaia)
 	return NULL;
@@ -193,455 +329,17 @@ toGeosGeometry (const void *cache, GEOSContextHandle_t handle,
       {
       case GAIA_POINT:
 	  if (mode == GAIA2GEOS_ALL || mode == GAIA2GEOS_ONLY_POINTS)
-	    {
-		pt = gaia->FirstPoint;
-		if (handle != NULL)
-		  {
-		      cs = GEOSCoordSeq_create_r (handle, 1, dims);
-		      switch (gaia->DimensionModel)
-			{
-			case GAIA_XY_Z:
-			case GAIA_XY_Z_M:
-			    GEOSCoordSeq_setX_r (handle, cs, 0, pt->X);
-			    GEOSCoordSeq_setY_r (handle, cs, 0, pt->Y);
-			    GEOSCoordSeq_setZ_r (handle, cs, 0, pt->Z);
-			    break;
-			default:
-			    GEOSCoordSeq_setX_r (handle, cs, 0, pt->X);
-			    GEOSCoordSeq_setY_r (handle, cs, 0, pt->Y);
-			    break;
-			};
-		      geos = GEOSGeom_createPoint_r (handle, cs);
-		  }
-		else
-		  {
-		      cs = GEOSCoordSeq_create (1, dims);
-		      switch (gaia->DimensionModel)
-			{
-			case GAIA_XY_Z:
-			case GAIA_XY_Z_M:
-			    GEOSCoordSeq_setX (cs, 0, pt->X);
-			    GEOSCoordSeq_setY (cs, 0, pt->Y);
-			    GEOSCoordSeq_setZ (cs, 0, pt->Z);
-			    break;
-			default:
-			    GEOSCoordSeq_setX (cs, 0, pt->X);
-			    GEOSCoordSeq_setY (cs, 0, pt->Y);
-			    break;
-			};
-		      geos = GEOSGeom_createPoint (cs);
-		  }
-	    }
+	      geos =
+		  toGeosPoint (handle, gaia->FirstPoint, gaia->DimensionModel,
+			       dims);
 	  break;
       case GAIA_LINESTRING:
 	  if (mode == GAIA2GEOS_ALL || mode == GAIA2GEOS_ONLY_LINESTRINGS)
-	    {
-		ln = gaia->FirstLinestring;
-		if (handle != NULL)
-		    cs = GEOSCoordSeq_create_r (handle, ln->Points, dims);
-		else
-		    cs = GEOSCoordSeq_create (ln->Points, dims);
-		for (iv = 0; iv < ln->Points; iv++)
-		  {
-		      switch (ln->DimensionModel)
-			{
-			case GAIA_XY_Z:
-			    gaiaGetPointXYZ (ln->Coords, iv, &x, &y, &z);
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_setX_r (handle, cs, iv, x);
-				  GEOSCoordSeq_setY_r (handle, cs, iv, y);
-				  GEOSCoordSeq_setZ_r (handle, cs, iv, z);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_setX (cs, iv, x);
-				  GEOSCoordSeq_setY (cs, iv, y);
-				  GEOSCoordSeq_setZ (cs, iv, z);
-			      }
-			    break;
-			case GAIA_XY_M:
-			    gaiaGetPointXYM (ln->Coords, iv, &x, &y, &m);
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_setX_r (handle, cs, iv, x);
-				  GEOSCoordSeq_setY_r (handle, cs, iv, y);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_setX (cs, iv, x);
-				  GEOSCoordSeq_setY (cs, iv, y);
-			      }
-			    break;
-			case GAIA_XY_Z_M:
-			    gaiaGetPointXYZM (ln->Coords, iv, &x, &y, &z, &m);
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_setX_r (handle, cs, iv, x);
-				  GEOSCoordSeq_setY_r (handle, cs, iv, y);
-				  GEOSCoordSeq_setZ_r (handle, cs, iv, z);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_setX (cs, iv, x);
-				  GEOSCoordSeq_setY (cs, iv, y);
-				  GEOSCoordSeq_setZ (cs, iv, z);
-			      }
-			    break;
-			default:
-			    gaiaGetPoint (ln->Coords, iv, &x, &y);
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_setX_r (handle, cs, iv, x);
-				  GEOSCoordSeq_setY_r (handle, cs, iv, y);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_setX (cs, iv, x);
-				  GEOSCoordSeq_setY (cs, iv, y);
-			      }
-			    break;
-			};
-		  }
-		if (handle != NULL)
-		    geos = GEOSGeom_createLineString_r (handle, cs);
-		else
-		    geos = GEOSGeom_createLineString (cs);
-	    }
+	      geos = toGeosLinestring (handle, gaia->FirstLinestring, dims);
 	  break;
       case GAIA_POLYGON:
 	  if (mode == GAIA2GEOS_ALL || mode == GAIA2GEOS_ONLY_POLYGONS)
-	    {
-		pg = gaia->FirstPolygon;
-		rng = pg->Exterior;
-		/* exterior ring */
-		ring_points = rng->Points;
-		if (cache)
-		  {
-		      if (gaiaIsNotClosedRing_r (cache, rng))
-			  ring_points++;
-		  }
-		else
-		  {
-		      if (gaiaIsNotClosedRing (rng))
-			  ring_points++;
-		  }
-		if (handle != NULL)
-		    cs = GEOSCoordSeq_create_r (handle, ring_points, dims);
-		else
-		    cs = GEOSCoordSeq_create (ring_points, dims);
-		for (iv = 0; iv < rng->Points; iv++)
-		  {
-		      switch (rng->DimensionModel)
-			{
-			case GAIA_XY_Z:
-			    gaiaGetPointXYZ (rng->Coords, iv, &x, &y, &z);
-			    if (iv == 0)
-			      {
-				  /* saving the first vertex */
-				  x0 = x;
-				  y0 = y;
-				  z0 = z;
-			      }
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_setX_r (handle, cs, iv, x);
-				  GEOSCoordSeq_setY_r (handle, cs, iv, y);
-				  GEOSCoordSeq_setZ_r (handle, cs, iv, z);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_setX (cs, iv, x);
-				  GEOSCoordSeq_setY (cs, iv, y);
-				  GEOSCoordSeq_setZ (cs, iv, z);
-			      }
-			    break;
-			case GAIA_XY_M:
-			    gaiaGetPointXYM (rng->Coords, iv, &x, &y, &m);
-			    if (iv == 0)
-			      {
-				  /* saving the first vertex */
-				  x0 = x;
-				  y0 = y;
-			      }
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_setX_r (handle, cs, iv, x);
-				  GEOSCoordSeq_setY_r (handle, cs, iv, y);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_setX (cs, iv, x);
-				  GEOSCoordSeq_setY (cs, iv, y);
-			      }
-			    break;
-			case GAIA_XY_Z_M:
-			    gaiaGetPointXYZM (rng->Coords, iv, &x, &y, &z, &m);
-			    if (iv == 0)
-			      {
-				  /* saving the first vertex */
-				  x0 = x;
-				  y0 = y;
-				  z0 = z;
-			      }
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_setX_r (handle, cs, iv, x);
-				  GEOSCoordSeq_setY_r (handle, cs, iv, y);
-				  GEOSCoordSeq_setZ_r (handle, cs, iv, z);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_setX (cs, iv, x);
-				  GEOSCoordSeq_setY (cs, iv, y);
-				  GEOSCoordSeq_setZ (cs, iv, z);
-			      }
-			    break;
-			default:
-			    gaiaGetPoint (rng->Coords, iv, &x, &y);
-			    if (iv == 0)
-			      {
-				  /* saving the first vertex */
-				  x0 = x;
-				  y0 = y;
-			      }
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_setX_r (handle, cs, iv, x);
-				  GEOSCoordSeq_setY_r (handle, cs, iv, y);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_setX (cs, iv, x);
-				  GEOSCoordSeq_setY (cs, iv, y);
-			      }
-			    break;
-			};
-		  }
-		if (ring_points > rng->Points)
-		  {
-		      /* ensuring Ring's closure */
-		      iv = ring_points - 1;
-		      switch (rng->DimensionModel)
-			{
-			case GAIA_XY_Z:
-			case GAIA_XY_Z_M:
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_setX_r (handle, cs, iv, x0);
-				  GEOSCoordSeq_setY_r (handle, cs, iv, y0);
-				  GEOSCoordSeq_setZ_r (handle, cs, iv, z0);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_setX (cs, iv, x0);
-				  GEOSCoordSeq_setY (cs, iv, y0);
-				  GEOSCoordSeq_setZ (cs, iv, z0);
-			      }
-			    break;
-			default:
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_setX_r (handle, cs, iv, x0);
-				  GEOSCoordSeq_setY_r (handle, cs, iv, y0);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_setX (cs, iv, x0);
-				  GEOSCoordSeq_setY (cs, iv, y0);
-			      }
-			    break;
-			};
-		  }
-		if (handle != NULL)
-		    geos_ext = GEOSGeom_createLinearRing_r (handle, cs);
-		else
-		    geos_ext = GEOSGeom_createLinearRing (cs);
-		geos_holes = NULL;
-		if (pg->NumInteriors > 0)
-		  {
-		      geos_holes =
-			  malloc (sizeof (GEOSGeometry *) * pg->NumInteriors);
-		      for (ib = 0; ib < pg->NumInteriors; ib++)
-			{
-			    /* interior ring */
-			    rng = pg->Interiors + ib;
-			    ring_points = rng->Points;
-			    if (cache != NULL)
-			      {
-				  if (gaiaIsNotClosedRing_r (cache, rng))
-				      ring_points++;
-			      }
-			    else
-			      {
-				  if (gaiaIsNotClosedRing (rng))
-				      ring_points++;
-			      }
-			    if (handle != NULL)
-				cs = GEOSCoordSeq_create_r (handle, ring_points,
-							    dims);
-			    else
-				cs = GEOSCoordSeq_create (ring_points, dims);
-			    for (iv = 0; iv < rng->Points; iv++)
-			      {
-				  switch (rng->DimensionModel)
-				    {
-				    case GAIA_XY_Z:
-					gaiaGetPointXYZ (rng->Coords, iv, &x,
-							 &y, &z);
-					if (iv == 0)
-					  {
-					      /* saving the first vertex */
-					      x0 = x;
-					      y0 = y;
-					      z0 = z;
-					  }
-					if (handle != NULL)
-					  {
-					      GEOSCoordSeq_setX_r (handle, cs,
-								   iv, x);
-					      GEOSCoordSeq_setY_r (handle, cs,
-								   iv, y);
-					      GEOSCoordSeq_setZ_r (handle, cs,
-								   iv, z);
-					  }
-					else
-					  {
-					      GEOSCoordSeq_setX (cs, iv, x);
-					      GEOSCoordSeq_setY (cs, iv, y);
-					      GEOSCoordSeq_setZ (cs, iv, z);
-					  }
-					break;
-				    case GAIA_XY_M:
-					gaiaGetPointXYM (rng->Coords, iv, &x,
-							 &y, &m);
-					if (iv == 0)
-					  {
-					      /* saving the first vertex */
-					      x0 = x;
-					      y0 = y;
-					  }
-					if (handle != NULL)
-					  {
-					      GEOSCoordSeq_setX_r (handle, cs,
-								   iv, x);
-					      GEOSCoordSeq_setY_r (handle, cs,
-								   iv, y);
-					  }
-					else
-					  {
-					      GEOSCoordSeq_setX (cs, iv, x);
-					      GEOSCoordSeq_setY (cs, iv, y);
-					  }
-					break;
-				    case GAIA_XY_Z_M:
-					gaiaGetPointXYZM (rng->Coords, iv, &x,
-							  &y, &z, &m);
-					if (iv == 0)
-					  {
-					      /* saving the first vertex */
-					      x0 = x;
-					      y0 = y;
-					      z0 = z;
-					  }
-					if (handle != NULL)
-					  {
-					      GEOSCoordSeq_setX_r (handle, cs,
-								   iv, x);
-					      GEOSCoordSeq_setY_r (handle, cs,
-								   iv, y);
-					      GEOSCoordSeq_setZ_r (handle, cs,
-								   iv, z);
-					  }
-					else
-					  {
-					      GEOSCoordSeq_setX (cs, iv, x);
-					      GEOSCoordSeq_setY (cs, iv, y);
-					      GEOSCoordSeq_setZ (cs, iv, z);
-					  }
-					break;
-				    default:
-					gaiaGetPoint (rng->Coords, iv, &x, &y);
-					if (iv == 0)
-					  {
-					      /* saving the first vertex */
-					      x0 = x;
-					      y0 = y;
-					  }
-					if (handle != NULL)
-					  {
-					      GEOSCoordSeq_setX_r (handle, cs,
-								   iv, x);
-					      GEOSCoordSeq_setY_r (handle, cs,
-								   iv, y);
-					  }
-					else
-					  {
-					      GEOSCoordSeq_setX (cs, iv, x);
-					      GEOSCoordSeq_setY (cs, iv, y);
-					  }
-					break;
-				    };
-			      }
-			    if (ring_points > rng->Points)
-			      {
-				  /* ensuring Ring's closure */
-				  iv = ring_points - 1;
-				  switch (rng->DimensionModel)
-				    {
-				    case GAIA_XY_Z:
-				    case GAIA_XY_Z_M:
-					if (handle != NULL)
-					  {
-					      GEOSCoordSeq_setX_r (handle, cs,
-								   iv, x0);
-					      GEOSCoordSeq_setY_r (handle, cs,
-								   iv, y0);
-					      GEOSCoordSeq_setZ_r (handle, cs,
-								   iv, z0);
-					  }
-					else
-					  {
-					      GEOSCoordSeq_setX (cs, iv, x0);
-					      GEOSCoordSeq_setY (cs, iv, y0);
-					      GEOSCoordSeq_setZ (cs, iv, z0);
-					  }
-					break;
-				    default:
-					if (handle != NULL)
-					  {
-					      GEOSCoordSeq_setX_r (handle, cs,
-								   iv, x0);
-					      GEOSCoordSeq_setY_r (handle, cs,
-								   iv, y0);
-					  }
-					else
-					  {
-					      GEOSCoordSeq_setX (cs, iv, x0);
-					      GEOSCoordSeq_setY (cs, iv, y0);
-					  }
-					break;
-				    };
-			      }
-			    if (handle != NULL)
-				geos_int =
-				    GEOSGeom_createLinearRing_r (handle, cs);
-			    else
-				geos_int = GEOSGeom_createLinearRing (cs);
-			    *(geos_holes + ib) = geos_int;
-			}
-		  }
-		if (handle != NULL)
-		    geos =
-			GEOSGeom_createPolygon_r (handle, geos_ext, geos_holes,
-						  pg->NumInteriors);
-		else
-		    geos =
-			GEOSGeom_createPolygon (geos_ext, geos_holes,
-						pg->NumInteriors);
-		if (geos_holes)
-		    free (geos_holes);
-	    }
+	      geos = toGeosPolygon (cache, handle, gaia->FirstPolygon, dims);
 	  break;
       case GAIA_MULTIPOINT:
       case GAIA_MULTILINESTRING:
@@ -674,45 +372,8 @@ toGeosGeometry (const void *cache, GEOSContextHandle_t handle,
 		pt = gaia->FirstPoint;
 		while (pt)
 		  {
-		      if (handle != NULL)
-			  cs = GEOSCoordSeq_create_r (handle, 1, dims);
-		      else
-			  cs = GEOSCoordSeq_create (1, dims);
-		      switch (pt->DimensionModel)
-			{
-			case GAIA_XY_Z:
-			case GAIA_XY_Z_M:
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_setX_r (handle, cs, 0, pt->X);
-				  GEOSCoordSeq_setY_r (handle, cs, 0, pt->Y);
-				  GEOSCoordSeq_setZ_r (handle, cs, 0, pt->Z);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_setX (cs, 0, pt->X);
-				  GEOSCoordSeq_setY (cs, 0, pt->Y);
-				  GEOSCoordSeq_setZ (cs, 0, pt->Z);
-			      }
-			    break;
-			default:
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_setX_r (handle, cs, 0, pt->X);
-				  GEOSCoordSeq_setY_r (handle, cs, 0, pt->Y);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_setX (cs, 0, pt->X);
-				  GEOSCoordSeq_setY (cs, 0, pt->Y);
-			      }
-			    break;
-			};
-		      if (handle != NULL)
-			  geos_item = GEOSGeom_createPoint_r (handle, cs);
-		      else
-			  geos_item = GEOSGeom_createPoint (cs);
-		      *(geos_coll + nItem++) = geos_item;
+		      *(geos_coll + nItem++) =
+			  toGeosPoint (handle, pt, gaia->DimensionModel, dims);
 		      pt = pt->Next;
 		  }
 	    }
@@ -721,78 +382,8 @@ toGeosGeometry (const void *cache, GEOSContextHandle_t handle,
 		ln = gaia->FirstLinestring;
 		while (ln)
 		  {
-		      if (handle != NULL)
-			  cs = GEOSCoordSeq_create_r (handle, ln->Points, dims);
-		      else
-			  cs = GEOSCoordSeq_create (ln->Points, dims);
-		      for (iv = 0; iv < ln->Points; iv++)
-			{
-			    switch (ln->DimensionModel)
-			      {
-			      case GAIA_XY_Z:
-				  gaiaGetPointXYZ (ln->Coords, iv, &x, &y, &z);
-				  if (handle != NULL)
-				    {
-					GEOSCoordSeq_setX_r (handle, cs, iv, x);
-					GEOSCoordSeq_setY_r (handle, cs, iv, y);
-					GEOSCoordSeq_setZ_r (handle, cs, iv, z);
-				    }
-				  else
-				    {
-					GEOSCoordSeq_setX (cs, iv, x);
-					GEOSCoordSeq_setY (cs, iv, y);
-					GEOSCoordSeq_setZ (cs, iv, z);
-				    }
-				  break;
-			      case GAIA_XY_M:
-				  gaiaGetPointXYM (ln->Coords, iv, &x, &y, &m);
-				  if (handle != NULL)
-				    {
-					GEOSCoordSeq_setX_r (handle, cs, iv, x);
-					GEOSCoordSeq_setY_r (handle, cs, iv, y);
-				    }
-				  else
-				    {
-					GEOSCoordSeq_setX (cs, iv, x);
-					GEOSCoordSeq_setY (cs, iv, y);
-				    }
-				  break;
-			      case GAIA_XY_Z_M:
-				  gaiaGetPointXYZM (ln->Coords, iv, &x, &y, &z,
-						    &m);
-				  if (handle != NULL)
-				    {
-					GEOSCoordSeq_setX_r (handle, cs, iv, x);
-					GEOSCoordSeq_setY_r (handle, cs, iv, y);
-					GEOSCoordSeq_setZ_r (handle, cs, iv, z);
-				    }
-				  else
-				    {
-					GEOSCoordSeq_setX (cs, iv, x);
-					GEOSCoordSeq_setY (cs, iv, y);
-					GEOSCoordSeq_setZ (cs, iv, z);
-				    }
-				  break;
-			      default:
-				  gaiaGetPoint (ln->Coords, iv, &x, &y);
-				  if (handle != NULL)
-				    {
-					GEOSCoordSeq_setX_r (handle, cs, iv, x);
-					GEOSCoordSeq_setY_r (handle, cs, iv, y);
-				    }
-				  else
-				    {
-					GEOSCoordSeq_setX (cs, iv, x);
-					GEOSCoordSeq_setY (cs, iv, y);
-				    }
-				  break;
-			      };
-			}
-		      if (handle != NULL)
-			  geos_item = GEOSGeom_createLineString_r (handle, cs);
-		      else
-			  geos_item = GEOSGeom_createLineString (cs);
-		      *(geos_coll + nItem++) = geos_item;
+		      *(geos_coll + nItem++) =
+			  toGeosLinestring (handle, ln, dims);
 		      ln = ln->Next;
 		  }
 	    }
@@ -801,378 +392,8 @@ toGeosGeometry (const void *cache, GEOSContextHandle_t handle,
 		pg = gaia->FirstPolygon;
 		while (pg)
 		  {
-		      rng = pg->Exterior;
-		      /* exterior ring */
-		      ring_points = rng->Points;
-		      if (cache != NULL)
-			{
-			    if (gaiaIsNotClosedRing_r (handle, rng))
-				ring_points++;
-			}
-		      else
-			{
-			    if (gaiaIsNotClosedRing (rng))
-				ring_points++;
-			}
-		      if (handle != NULL)
-			  cs = GEOSCoordSeq_create_r (handle, ring_points,
-						      dims);
-		      else
-			  cs = GEOSCoordSeq_create (ring_points, dims);
-		      for (iv = 0; iv < rng->Points; iv++)
-			{
-			    switch (rng->DimensionModel)
-			      {
-			      case GAIA_XY_Z:
-				  gaiaGetPointXYZ (rng->Coords, iv, &x, &y, &z);
-				  if (iv == 0)
-				    {
-					/* saving the first vertex */
-					x0 = x;
-					y0 = y;
-					z0 = z;
-				    }
-				  if (handle != NULL)
-				    {
-					GEOSCoordSeq_setX_r (handle, cs, iv, x);
-					GEOSCoordSeq_setY_r (handle, cs, iv, y);
-					GEOSCoordSeq_setZ_r (handle, cs, iv, z);
-				    }
-				  else
-				    {
-					GEOSCoordSeq_setX (cs, iv, x);
-					GEOSCoordSeq_setY (cs, iv, y);
-					GEOSCoordSeq_setZ (cs, iv, z);
-				    }
-				  break;
-			      case GAIA_XY_M:
-				  gaiaGetPointXYM (rng->Coords, iv, &x, &y, &m);
-				  if (iv == 0)
-				    {
-					/* saving the first vertex */
-					x0 = x;
-					y0 = y;
-				    }
-				  if (handle != NULL)
-				    {
-					GEOSCoordSeq_setX_r (handle, cs, iv, x);
-					GEOSCoordSeq_setY_r (handle, cs, iv, y);
-				    }
-				  else
-				    {
-					GEOSCoordSeq_setX (cs, iv, x);
-					GEOSCoordSeq_setY (cs, iv, y);
-				    }
-				  break;
-			      case GAIA_XY_Z_M:
-				  gaiaGetPointXYZM (rng->Coords, iv, &x, &y, &z,
-						    &m);
-				  if (iv == 0)
-				    {
-					/* saving the first vertex */
-					x0 = x;
-					y0 = y;
-					z0 = z;
-				    }
-				  if (handle != NULL)
-				    {
-					GEOSCoordSeq_setX_r (handle, cs, iv, x);
-					GEOSCoordSeq_setY_r (handle, cs, iv, y);
-					GEOSCoordSeq_setZ_r (handle, cs, iv, z);
-				    }
-				  else
-				    {
-					GEOSCoordSeq_setX (cs, iv, x);
-					GEOSCoordSeq_setY (cs, iv, y);
-					GEOSCoordSeq_setZ (cs, iv, z);
-				    }
-				  break;
-			      default:
-				  gaiaGetPoint (rng->Coords, iv, &x, &y);
-				  if (iv == 0)
-				    {
-					/* saving the first vertex */
-					x0 = x;
-					y0 = y;
-				    }
-				  if (handle != NULL)
-				    {
-					GEOSCoordSeq_setX_r (handle, cs, iv, x);
-					GEOSCoordSeq_setY_r (handle, cs, iv, y);
-				    }
-				  else
-				    {
-					GEOSCoordSeq_setX (cs, iv, x);
-					GEOSCoordSeq_setY (cs, iv, y);
-				    }
-				  break;
-			      };
-			}
-		      if (ring_points > rng->Points)
-			{
-			    /* ensuring Ring's closure */
-			    iv = ring_points - 1;
-			    switch (rng->DimensionModel)
-			      {
-			      case GAIA_XY_Z:
-			      case GAIA_XY_Z_M:
-				  if (handle != NULL)
-				    {
-					GEOSCoordSeq_setX_r (handle, cs, iv,
-							     x0);
-					GEOSCoordSeq_setY_r (handle, cs, iv,
-							     y0);
-					GEOSCoordSeq_setZ_r (handle, cs, iv,
-							     z0);
-				    }
-				  else
-				    {
-					GEOSCoordSeq_setX (cs, iv, x0);
-					GEOSCoordSeq_setY (cs, iv, y0);
-					GEOSCoordSeq_setZ (cs, iv, z0);
-				    }
-				  break;
-			      default:
-				  if (handle != NULL)
-				    {
-					GEOSCoordSeq_setX_r (handle, cs, iv,
-							     x0);
-					GEOSCoordSeq_setY_r (handle, cs, iv,
-							     y0);
-				    }
-				  else
-				    {
-					GEOSCoordSeq_setX (cs, iv, x0);
-					GEOSCoordSeq_setY (cs, iv, y0);
-				    }
-				  break;
-			      };
-			}
-		      if (handle != NULL)
-			  geos_ext = GEOSGeom_createLinearRing_r (handle, cs);
-		      else
-			  geos_ext = GEOSGeom_createLinearRing (cs);
-		      geos_holes = NULL;
-		      if (pg->NumInteriors > 0)
-			{
-			    geos_holes =
-				malloc (sizeof (GEOSGeometry *) *
-					pg->NumInteriors);
-			    for (ib = 0; ib < pg->NumInteriors; ib++)
-			      {
-				  /* interior ring */
-				  rng = pg->Interiors + ib;
-				  ring_points = rng->Points;
-				  if (cache != NULL)
-				    {
-					if (gaiaIsNotClosedRing_r (cache, rng))
-					    ring_points++;
-				    }
-				  else
-				    {
-					if (gaiaIsNotClosedRing (rng))
-					    ring_points++;
-				    }
-				  if (handle != NULL)
-				      cs = GEOSCoordSeq_create_r (handle,
-								  ring_points,
-								  dims);
-				  else
-				      cs = GEOSCoordSeq_create (ring_points,
-								dims);
-				  for (iv = 0; iv < rng->Points; iv++)
-				    {
-					switch (rng->DimensionModel)
-					  {
-					  case GAIA_XY_Z:
-					      gaiaGetPointXYZ (rng->Coords, iv,
-							       &x, &y, &z);
-					      if (iv == 0)
-						{
-						    /* saving the first vertex */
-						    x0 = x;
-						    y0 = y;
-						    z0 = z;
-						}
-					      if (handle != NULL)
-						{
-						    GEOSCoordSeq_setX_r (handle,
-									 cs, iv,
-									 x);
-						    GEOSCoordSeq_setY_r (handle,
-									 cs, iv,
-									 y);
-						    GEOSCoordSeq_setZ_r (handle,
-									 cs, iv,
-									 z);
-						}
-					      else
-						{
-						    GEOSCoordSeq_setX (cs, iv,
-								       x);
-						    GEOSCoordSeq_setY (cs, iv,
-								       y);
-						    GEOSCoordSeq_setZ (cs, iv,
-								       z);
-						}
-					      break;
-					  case GAIA_XY_M:
-					      gaiaGetPointXYM (rng->Coords, iv,
-							       &x, &y, &m);
-					      if (iv == 0)
-						{
-						    /* saving the first vertex */
-						    x0 = x;
-						    y0 = y;
-						}
-					      if (handle != NULL)
-						{
-						    GEOSCoordSeq_setX_r (handle,
-									 cs, iv,
-									 x);
-						    GEOSCoordSeq_setY_r (handle,
-									 cs, iv,
-									 y);
-						}
-					      else
-						{
-						    GEOSCoordSeq_setX (cs, iv,
-								       x);
-						    GEOSCoordSeq_setY (cs, iv,
-								       y);
-						}
-					      break;
-					  case GAIA_XY_Z_M:
-					      gaiaGetPointXYZM (rng->Coords, iv,
-								&x, &y, &z, &m);
-					      if (iv == 0)
-						{
-						    /* saving the first vertex */
-						    x0 = x;
-						    y0 = y;
-						    z0 = z;
-						}
-					      if (handle != NULL)
-						{
-						    GEOSCoordSeq_setX_r (handle,
-									 cs, iv,
-									 x);
-						    GEOSCoordSeq_setY_r (handle,
-									 cs, iv,
-									 y);
-						    GEOSCoordSeq_setZ_r (handle,
-									 cs, iv,
-									 z);
-						}
-					      else
-						{
-						    GEOSCoordSeq_setX (cs, iv,
-								       x);
-						    GEOSCoordSeq_setY (cs, iv,
-								       y);
-						    GEOSCoordSeq_setZ (cs, iv,
-								       z);
-						}
-					      break;
-					  default:
-					      gaiaGetPoint (rng->Coords, iv, &x,
-							    &y);
-					      if (iv == 0)
-						{
-						    /* saving the first vertex */
-						    x0 = x;
-						    y0 = y;
-						}
-					      if (handle != NULL)
-						{
-						    GEOSCoordSeq_setX_r (handle,
-									 cs, iv,
-									 x);
-						    GEOSCoordSeq_setY_r (handle,
-									 cs, iv,
-									 y);
-						}
-					      else
-						{
-						    GEOSCoordSeq_setX (cs, iv,
-								       x);
-						    GEOSCoordSeq_setY (cs, iv,
-								       y);
-						}
-					      break;
-					  };
-				    }
-				  if (ring_points > rng->Points)
-				    {
-					/* ensuring Ring's closure */
-					iv = ring_points - 1;
-					switch (rng->DimensionModel)
-					  {
-					  case GAIA_XY_Z:
-					  case GAIA_XY_Z_M:
-					      if (handle != NULL)
-						{
-						    GEOSCoordSeq_setX_r (handle,
-									 cs, iv,
-									 x0);
-						    GEOSCoordSeq_setY_r (handle,
-									 cs, iv,
-									 y0);
-						    GEOSCoordSeq_setZ_r (handle,
-									 cs, iv,
-									 z0);
-						}
-					      else
-						{
-						    GEOSCoordSeq_setX (cs, iv,
-								       x0);
-						    GEOSCoordSeq_setY (cs, iv,
-								       y0);
-						    GEOSCoordSeq_setZ (cs, iv,
-								       z0);
-						}
-					      break;
-					  default:
-					      if (handle != NULL)
-						{
-						    GEOSCoordSeq_setX_r (handle,
-									 cs, iv,
-									 x0);
-						    GEOSCoordSeq_setY_r (handle,
-									 cs, iv,
-									 y0);
-						}
-					      else
-						{
-						    GEOSCoordSeq_setX (cs, iv,
-								       x0);
-						    GEOSCoordSeq_setY (cs, iv,
-								       y0);
-						}
-					      break;
-					  };
-				    }
-				  if (handle != NULL)
-				      geos_int =
-					  GEOSGeom_createLinearRing_r (handle,
-								       cs);
-				  else
-				      geos_int = GEOSGeom_createLinearRing (cs);
-				  *(geos_holes + ib) = geos_int;
-			      }
-			}
-		      if (handle != NULL)
-			  geos_item =
-			      GEOSGeom_createPolygon_r (handle, geos_ext,
-							geos_holes,
-							pg->NumInteriors);
-		      else
-			  geos_item =
-			      GEOSGeom_createPolygon (geos_ext, geos_holes,
-						      pg->NumInteriors);
-		      if (geos_holes)
-			  free (geos_holes);
-		      *(geos_coll + nItem++) = geos_item;
+		      *(geos_coll + nItem++) =
+			  toGeosPolygon (cache, handle, pg, dims);
 		      pg = pg->Next;
 		  }
 	    }
@@ -1205,6 +426,182 @@ toGeosGeometry (const void *cache, GEOSContextHandle_t handle,
     return geos;
 }
 
+static void
+fromGeosCoordSeq (GEOSContextHandle_t handle, const GEOSCoordSequence * cs,
+		  double *coords, unsigned int points, int dimension_model)
+{
+/* copying a GEOS Coordinate Sequence into a GAIA coordinate array */
+    unsigned int dims;
+    unsigned int iv;
+    int has_z = 0;
+    int has_m = 0;
+    int stride;
+    double *p;
+    double x;
+    double y;
+    double z;
+    if (dimension_model == GAIA_XY_Z || dimension_model == GAIA_XY_Z_M)
+	has_z = 1;
+    if (dimension_model == GAIA_XY_M || dimension_model == GAIA_XY_Z_M)
+	has_m = 1;
+    stride = 2 + has_z + has_m;
+    if (handle != NULL)
+	GEOSCoordSeq_getDimensions_r (handle, cs, &dims);
+    else
+	GEOSCoordSeq_getDimensions (cs, &dims);
+#ifdef GAIA_GEOS_BULK_COORDS
+    if (handle != NULL)
+	iv = GEOSCoordSeq_copyToBuffer_r (handle, cs, coords, has_z, has_m);
+    else
+	iv = GEOSCoordSeq_copyToBuffer (cs, coords, has_z, has_m);
+    if (iv)
+      {
+	  /* the whole Coordinate Sequence has been directly copied */
+	  if ((has_z && dims != 3) || has_m)
+	    {
+		/* GEOS has no M values; Z is undefined for 2D sequences */
+		for (iv = 0, p = coords; iv < points; iv++, p += stride)
+		  {
+		      if (has_z && dims != 3)
+			  p[2] = 0.0;
+		      if (has_m)
+			  p[stride - 1] = 0.0;
+		  }
+	    }
+	  return;
+      }
+#endif
+    for (iv = 0, p = coords; iv < points; iv++, p += stride)
+      {
+	  if (handle != NULL)
+	    {
+		GEOSCoordSeq_getX_r (handle, cs, iv, &x);
+		GEOSCoordSeq_getY_r (handle, cs, iv, &y);
+		if (dims == 3)
+		    GEOSCoordSeq_getZ_r (handle, cs, iv, &z);
+		else
+		    z = 0.0;
+	    }
+	  else
+	    {
+		GEOSCoordSeq_getX (cs, iv, &x);
+		GEOSCoordSeq_getY (cs, iv, &y);
+		if (dims == 3)
+		    GEOSCoordSeq_getZ (cs, iv, &z);
+		else
+		    z = 0.0;
+	    }
+	  p[0] = x;
+	  p[1] = y;
+	  if (has_z)
+	      p[2] = z;
+	  if (has_m)
+	      p[stride - 1] = 0.0;
+      }
+}
+
+static const GEOSCoordSequence *
+fromGeosGetCoordSeq (GEOSContextHandle_t handle, const GEOSGeometry * geos,
+		     unsigned int *points)
+{
+/* retrieving the Coordinate Sequence of some GEOS Point/Linestring/Ring */
+    const GEOSCoordSequence *cs;
+    *points = 0;
+    if (handle != NULL)
+      {
+	  cs = GEOSGeom_getCoordSeq_r (handle, geos);
+	  if (cs != NULL)
+	      GEOSCoordSeq_getSize_r (handle, cs, points);
+      }
+    else
+      {
+	  cs = GEOSGeom_getCoordSeq (geos);
+	  if (cs != NULL)
+	      GEOSCoordSeq_getSize (cs, points);
+      }
+    return cs;
+}
+
+static void
+fromGeosPoint (GEOSContextHandle_t handle, gaiaGeomCollPtr gaia,
+	       const GEOSGeometry * geos, const int dimension_model)
+{
+/* adding a GEOS Point to a GAIA Geometry */
+    unsigned int points;
+    double coords[4];
+    const GEOSCoordSequence *cs = fromGeosGetCoordSeq (handle, geos, &points);
+    if (cs == NULL || points < 1)
+	return;
+    fromGeosCoordSeq (handle, cs, coords, 1, dimension_model);
+    if (dimension_model == GAIA_XY_Z)
+	gaiaAddPointToGeomCollXYZ (gaia, coords[0], coords[1], coords[2]);
+    else if (dimension_model == GAIA_XY_M)
+	gaiaAddPointToGeomCollXYM (gaia, coords[0], coords[1], coords[2]);
+    else if (dimension_model == GAIA_XY_Z_M)
+	gaiaAddPointToGeomCollXYZM (gaia, coords[0], coords[1], coords[2],
+				    coords[3]);
+    else
+	gaiaAddPointToGeomColl (gaia, coords[0], coords[1]);
+}
+
+static void
+fromGeosLinestring (GEOSContextHandle_t handle, gaiaGeomCollPtr gaia,
+		    const GEOSGeometry * geos, const int dimension_model)
+{
+/* adding a GEOS Linestring to a GAIA Geometry */
+    unsigned int points;
+    gaiaLinestringPtr ln;
+    const GEOSCoordSequence *cs = fromGeosGetCoordSeq (handle, geos, &points);
+    if (cs == NULL)
+	return;
+    ln = gaiaAddLinestringToGeomColl (gaia, points);
+    fromGeosCoordSeq (handle, cs, ln->Coords, points, dimension_model);
+}
+
+static void
+fromGeosPolygon (GEOSContextHandle_t handle, gaiaGeomCollPtr gaia,
+		 const GEOSGeometry * geos, const int dimension_model)
+{
+/* adding a GEOS Polygon to a GAIA Geometry */
+    int ib;
+    int holes;
+    unsigned int points;
+    const GEOSGeometry *geos_ring;
+    const GEOSCoordSequence *cs;
+    gaiaPolygonPtr pg;
+    gaiaRingPtr rng;
+    /* exterior ring */
+    if (handle != NULL)
+      {
+	  holes = GEOSGetNumInteriorRings_r (handle, geos);
+	  geos_ring = GEOSGetExteriorRing_r (handle, geos);
+      }
+    else
+      {
+	  holes = GEOSGetNumInteriorRings (geos);
+	  geos_ring = GEOSGetExteriorRing (geos);
+      }
+    cs = fromGeosGetCoordSeq (handle, geos_ring, &points);
+    if (cs == NULL)
+	return;
+    pg = gaiaAddPolygonToGeomColl (gaia, points, holes);
+    rng = pg->Exterior;
+    fromGeosCoordSeq (handle, cs, rng->Coords, points, dimension_model);
+    for (ib = 0; ib < holes; ib++)
+      {
+	  /* interior rings */
+	  if (handle != NULL)
+	      geos_ring = GEOSGetInteriorRingN_r (handle, geos, ib);
+	  else
+	      geos_ring = GEOSGetInteriorRingN (geos, ib);
+	  cs = fromGeosGetCoordSeq (handle, geos_ring, &points);
+	  rng = gaiaAddInteriorRing (pg, ib, (cs == NULL) ? 0 : points);
+	  if (cs != NULL)
+	      fromGeosCoordSeq (handle, cs, rng->Coords, points,
+				dimension_model);
+      }
+}
+
 static gaiaGeomCollPtr
 fromGeosGeometry (GEOSContextHandle_t handle, const GEOSGeometry * geos,
 		  const int dimension_model)
@@ -1212,26 +609,12 @@ fromGeosGeometry (GEOSContextHandle_t handle, const GEOSGeometry * geos,
 /* converting a GEOS Geometry into a GAIA Geometry */
     int type;
     int itemType;
-    unsigned int dims;
-    int iv;
-    int ib;
     int it;
     int sub_it;
     int nItems;
     int nSubItems;
-    int holes;
-    unsigned int points;
-    double x;
-    double y;
-    double z;
-    const GEOSCoordSequence *cs;
-    const GEOSGeometry *geos_ring;
     const GEOSGeometry *geos_item;
-    const GEOSGeometry *geos_sub_item;
     gaiaGeomCollPtr gaia = NULL;
-    gaiaLinestringPtr ln;
-    gaiaPolygonPtr pg;
-    gaiaRingPtr rng;
     if (!geos)
 	return NULL;
     if (handle != NULL)
@@ -1241,300 +624,43 @@ fromGeosGeometry (GEOSContextHandle_t handle, const GEOSGeometry * geos,
     switch (type)
       {
       case GEOS_POINT:
-	  if (dimension_model == GAIA_XY_Z)
-	      gaia = gaiaAllocGeomCollXYZ ();
-	  else if (dimension_model == GAIA_XY_M)
-	      gaia = gaiaAllocGeomCollXYM ();
-	  else if (dimension_model == GAIA_XY_Z_M)
-	      gaia = gaiaAllocGeomCollXYZM ();
-	  else
-	      gaia = gaiaAllocGeomColl ();
+      case GEOS_LINESTRING:
+      case GEOS_POLYGON:
+      case GEOS_MULTIPOINT:
+      case GEOS_MULTILINESTRING:
+      case GEOS_MULTIPOLYGON:
+      case GEOS_GEOMETRYCOLLECTION:
+	  break;
+      default:
+	  return NULL;
+      };
+    if (dimension_model == GAIA_XY_Z)
+	gaia = gaiaAllocGeomCollXYZ ();
+    else if (dimension_model == GAIA_XY_M)
+	gaia = gaiaAllocGeomCollXYM ();
+    else if (dimension_model == GAIA_XY_Z_M)
+	gaia = gaiaAllocGeomCollXYZM ();
+    else
+	gaia = gaiaAllocGeomColl ();
+    if (handle != NULL)
+	gaia->Srid = GEOSGetSRID_r (handle, geos);
+    else
+	gaia->Srid = GEOSGetSRID (geos);
+    switch (type)
+      {
+      case GEOS_POINT:
 	  gaia->DeclaredType = GAIA_POINT;
-	  if (handle != NULL)
-	    {
-		gaia->Srid = GEOSGetSRID_r (handle, geos);
-		cs = GEOSGeom_getCoordSeq_r (handle, geos);
-		GEOSCoordSeq_getDimensions_r (handle, cs, &dims);
-	    }
-	  else
-	    {
-		gaia->Srid = GEOSGetSRID (geos);
-		cs = GEOSGeom_getCoordSeq (geos);
-		GEOSCoordSeq_getDimensions (cs, &dims);
-	    }
-	  if (dims == 3)
-	    {
-		if (handle != NULL)
-		  {
-		      GEOSCoordSeq_getX_r (handle, cs, 0, &x);
-		      GEOSCoordSeq_getY_r (handle, cs, 0, &y);
-		      GEOSCoordSeq_getZ_r (handle, cs, 0, &z);
-		  }
-		else
-		  {
-		      GEOSCoordSeq_getX (cs, 0, &x);
-		      GEOSCoordSeq_getY (cs, 0, &y);
-		      GEOSCoordSeq_getZ (cs, 0, &z);
-		  }
-	    }
-	  else
-	    {
-		if (handle != NULL)
-		  {
-		      GEOSCoordSeq_getX_r (handle, cs, 0, &x);
-		      GEOSCoordSeq_getY_r (handle, cs, 0, &y);
-		  }
-		else
-		  {
-		      GEOSCoordSeq_getX (cs, 0, &x);
-		      GEOSCoordSeq_getY (cs, 0, &y);
-		  }
-		z = 0.0;
-	    }
-	  if (dimension_model == GAIA_XY_Z)
-	      gaiaAddPointToGeomCollXYZ (gaia, x, y, z);
-	  else if (dimension_model == GAIA_XY_M)
-	      gaiaAddPointToGeomCollXYM (gaia, x, y, 0.0);
-	  else if (dimension_model == GAIA_XY_Z_M)
-	      gaiaAddPointToGeomCollXYZM (gaia, x, y, z, 0.0);
-	  else
-	      gaiaAddPointToGeomColl (gaia, x, y);
+	  fromGeosPoint (handle, gaia, geos, dimension_model);
 	  break;
       case GEOS_LINESTRING:
-	  if (dimension_model == GAIA_XY_Z)
-	      gaia = gaiaAllocGeomCollXYZ ();
-	  else if (dimension_model == GAIA_XY_M)
-	      gaia = gaiaAllocGeomCollXYM ();
-	  else if (dimension_model == GAIA_XY_Z_M)
-	      gaia = gaiaAllocGeomCollXYZM ();
-	  else
-	      gaia = gaiaAllocGeomColl ();
 	  gaia->DeclaredType = GAIA_LINESTRING;
-	  if (handle != NULL)
-	    {
-		gaia->Srid = GEOSGetSRID_r (handle, geos);
-		cs = GEOSGeom_getCoordSeq_r (handle, geos);
-		GEOSCoordSeq_getDimensions_r (handle, cs, &dims);
-		GEOSCoordSeq_getSize_r (handle, cs, &points);
-	    }
-	  else
-	    {
-		gaia->Srid = GEOSGetSRID (geos);
-		cs = GEOSGeom_getCoordSeq (geos);
-		GEOSCoordSeq_getDimensions (cs, &dims);
-		GEOSCoordSeq_getSize (cs, &points);
-	    }
-	  ln = gaiaAddLinestringToGeomColl (gaia, points);
-	  for (iv = 0; iv < (int) points; iv++)
-	    {
-		if (dims == 3)
-		  {
-		      if (handle != NULL)
-			{
-			    GEOSCoordSeq_getX_r (handle, cs, iv, &x);
-			    GEOSCoordSeq_getY_r (handle, cs, iv, &y);
-			    GEOSCoordSeq_getZ_r (handle, cs, iv, &z);
-			}
-		      else
-			{
-			    GEOSCoordSeq_getX (cs, iv, &x);
-			    GEOSCoordSeq_getY (cs, iv, &y);
-			    GEOSCoordSeq_getZ (cs, iv, &z);
-			}
-		  }
-		else
-		  {
-		      if (handle != NULL)
-			{
-			    GEOSCoordSeq_getX_r (handle, cs, iv, &x);
-			    GEOSCoordSeq_getY_r (handle, cs, iv, &y);
-			}
-		      else
-			{
-			    GEOSCoordSeq_getX (cs, iv, &x);
-			    GEOSCoordSeq_getY (cs, iv, &y);
-			}
-		      z = 0.0;
-		  }
-		if (dimension_model == GAIA_XY_Z)
-		  {
-		      gaiaSetPointXYZ (ln->Coords, iv, x, y, z);
-		  }
-		else if (dimension_model == GAIA_XY_M)
-		  {
-		      gaiaSetPointXYM (ln->Coords, iv, x, y, 0.0);
-		  }
-		else if (dimension_model == GAIA_XY_Z_M)
-		  {
-		      gaiaSetPointXYZM (ln->Coords, iv, x, y, z, 0.0);
-		  }
-		else
-		  {
-		      gaiaSetPoint (ln->Coords, iv, x, y);
-		  }
-	    }
+	  fromGeosLinestring (handle, gaia, geos, dimension_model);
 	  break;
       case GEOS_POLYGON:
-	  if (dimension_model == GAIA_XY_Z)
-	      gaia = gaiaAllocGeomCollXYZ ();
-	  else if (dimension_model == GAIA_XY_M)
-	      gaia = gaiaAllocGeomCollXYM ();
-	  else if (dimension_model == GAIA_XY_Z_M)
-	      gaia = gaiaAllocGeomCollXYZM ();
-	  else
-	      gaia = gaiaAllocGeomColl ();
 	  gaia->DeclaredType = GAIA_POLYGON;
-	  if (handle != NULL)
-	      gaia->Srid = GEOSGetSRID_r (handle, geos);
-	  else
-	      gaia->Srid = GEOSGetSRID (geos);
-	  /* exterior ring */
-	  if (handle != NULL)
-	    {
-		holes = GEOSGetNumInteriorRings_r (handle, geos);
-		geos_ring = GEOSGetExteriorRing_r (handle, geos);
-		cs = GEOSGeom_getCoordSeq_r (handle, geos_ring);
-		GEOSCoordSeq_getDimensions_r (handle, cs, &dims);
-		GEOSCoordSeq_getSize_r (handle, cs, &points);
-	    }
-	  else
-	    {
-		holes = GEOSGetNumInteriorRings (geos);
-		geos_ring = GEOSGetExteriorRing (geos);
-		cs = GEOSGeom_getCoordSeq (geos_ring);
-		GEOSCoordSeq_getDimensions (cs, &dims);
-		GEOSCoordSeq_getSize (cs, &points);
-	    }
-	  pg = gaiaAddPolygonToGeomColl (gaia, points, holes);
-	  rng = pg->Exterior;
-	  for (iv = 0; iv < (int) points; iv++)
-	    {
-		if (dims == 3)
-		  {
-		      if (handle != NULL)
-			{
-			    GEOSCoordSeq_getX_r (handle, cs, iv, &x);
-			    GEOSCoordSeq_getY_r (handle, cs, iv, &y);
-			    GEOSCoordSeq_getZ_r (handle, cs, iv, &z);
-			}
-		      else
-			{
-			    GEOSCoordSeq_getX (cs, iv, &x);
-			    GEOSCoordSeq_getY (cs, iv, &y);
-			    GEOSCoordSeq_getZ (cs, iv, &z);
-			}
-		  }
-		else
-		  {
-		      if (handle != NULL)
-			{
-			    GEOSCoordSeq_getX_r (handle, cs, iv, &x);
-			    GEOSCoordSeq_getY_r (handle, cs, iv, &y);
-			}
-		      else
-			{
-			    GEOSCoordSeq_getX (cs, iv, &x);
-			    GEOSCoordSeq_getY (cs, iv, &y);
-			}
-		      z = 0.0;
-		  }
-		if (dimension_model == GAIA_XY_Z)
-		  {
-		      gaiaSetPointXYZ (rng->Coords, iv, x, y, z);
-		  }
-		else if (dimension_model == GAIA_XY_M)
-		  {
-		      gaiaSetPointXYM (rng->Coords, iv, x, y, 0.0);
-		  }
-		else if (dimension_model == GAIA_XY_Z_M)
-		  {
-		      gaiaSetPointXYZM (rng->Coords, iv, x, y, z, 0.0);
-		  }
-		else
-		  {
-		      gaiaSetPoint (rng->Coords, iv, x, y);
-		  }
-	    }
-	  for (ib = 0; ib < holes; ib++)
-	    {
-		/* interior rings */
-		if (handle != NULL)
-		  {
-		      geos_ring = GEOSGetInteriorRingN_r (handle, geos, ib);
-		      cs = GEOSGeom_getCoordSeq_r (handle, geos_ring);
-		      GEOSCoordSeq_getDimensions_r (handle, cs, &dims);
-		      GEOSCoordSeq_getSize_r (handle, cs, &points);
-		  }
-		else
-		  {
-		      geos_ring = GEOSGetInteriorRingN (geos, ib);
-		      cs = GEOSGeom_getCoordSeq (geos_ring);
-		      GEOSCoordSeq_getDimensions (cs, &dims);
-		      GEOSCoordSeq_getSize (cs, &points);
-		  }
-		rng = gaiaAddInteriorRing (pg, ib, points);
-		for (iv = 0; iv < (int) points; iv++)
-		  {
-		      if (dims == 3)
-			{
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_getX_r (handle, cs, iv, &x);
-				  GEOSCoordSeq_getY_r (handle, cs, iv, &y);
-				  GEOSCoordSeq_getZ_r (handle, cs, iv, &z);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_getX (cs, iv, &x);
-				  GEOSCoordSeq_getY (cs, iv, &y);
-				  GEOSCoordSeq_getZ (cs, iv, &z);
-			      }
-			}
-		      else
-			{
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_getX_r (handle, cs, iv, &x);
-				  GEOSCoordSeq_getY_r (handle, cs, iv, &y);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_getX (cs, iv, &x);
-				  GEOSCoordSeq_getY (cs, iv, &y);
-			      }
-			    z = 0.0;
-			}
-		      if (dimension_model == GAIA_XY_Z)
-			{
-			    gaiaSetPointXYZ (rng->Coords, iv, x, y, z);
-			}
-		      else if (dimension_model == GAIA_XY_M)
-			{
-			    gaiaSetPointXYM (rng->Coords, iv, x, y, 0.0);
-			}
-		      else if (dimension_model == GAIA_XY_Z_M)
-			{
-			    gaiaSetPointXYZM (rng->Coords, iv, x, y, z, 0.0);
-			}
-		      else
-			{
-			    gaiaSetPoint (rng->Coords, iv, x, y);
-			}
-		  }
-	    }
+	  fromGeosPolygon (handle, gaia, geos, dimension_model);
 	  break;
-      case GEOS_MULTIPOINT:
-      case GEOS_MULTILINESTRING:
-      case GEOS_MULTIPOLYGON:
-      case GEOS_GEOMETRYCOLLECTION:
-	  if (dimension_model == GAIA_XY_Z)
-	      gaia = gaiaAllocGeomCollXYZ ();
-	  else if (dimension_model == GAIA_XY_M)
-	      gaia = gaiaAllocGeomCollXYM ();
-	  else if (dimension_model == GAIA_XY_Z_M)
-	      gaia = gaiaAllocGeomCollXYZM ();
-	  else
-	      gaia = gaiaAllocGeomColl ();
+      default:
 	  if (type == GEOS_MULTIPOINT)
 	      gaia->DeclaredType = GAIA_MULTIPOINT;
 	  else if (type == GEOS_MULTILINESTRING)
@@ -1544,15 +670,9 @@ fromGeosGeometry (GEOSContextHandle_t handle, const GEOSGeometry * geos,
 	  else
 	      gaia->DeclaredType = GAIA_GEOMETRYCOLLECTION;
 	  if (handle != NULL)
-	    {
-		gaia->Srid = GEOSGetSRID_r (handle, geos);
-		nItems = GEOSGetNumGeometries_r (handle, geos);
-	    }
+	      nItems = GEOSGetNumGeometries_r (handle, geos);
 	  else
-	    {
-		gaia->Srid = GEOSGetSRID (geos);
-		nItems = GEOSGetNumGeometries (geos);
-	    }
+	      nItems = GEOSGetNumGeometries (geos);
 	  for (it = 0; it < nItems; it++)
 	    {
 		/* looping on elementaty geometries */
@@ -1569,122 +689,11 @@ fromGeosGeometry (GEOSContextHandle_t handle, const GEOSGeometry * geos,
 		switch (itemType)
 		  {
 		  case GEOS_POINT:
-		      if (handle != NULL)
-			{
-			    cs = GEOSGeom_getCoordSeq_r (handle, geos_item);
-			    GEOSCoordSeq_getDimensions_r (handle, cs, &dims);
-			}
-		      else
-			{
-			    cs = GEOSGeom_getCoordSeq (geos_item);
-			    GEOSCoordSeq_getDimensions (cs, &dims);
-			}
-		      if (dims == 3)
-			{
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_getX_r (handle, cs, 0, &x);
-				  GEOSCoordSeq_getY_r (handle, cs, 0, &y);
-				  GEOSCoordSeq_getZ_r (handle, cs, 0, &z);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_getX (cs, 0, &x);
-				  GEOSCoordSeq_getY (cs, 0, &y);
-				  GEOSCoordSeq_getZ (cs, 0, &z);
-			      }
-			}
-		      else
-			{
-			    if (handle != NULL)
-			      {
-				  GEOSCoordSeq_getX_r (handle, cs, 0, &x);
-				  GEOSCoordSeq_getY_r (handle, cs, 0, &y);
-			      }
-			    else
-			      {
-				  GEOSCoordSeq_getX (cs, 0, &x);
-				  GEOSCoordSeq_getY (cs, 0, &y);
-			      }
-			    z = 0.0;
-			}
-		      if (dimension_model == GAIA_XY_Z)
-			  gaiaAddPointToGeomCollXYZ (gaia, x, y, z);
-		      else if (dimension_model == GAIA_XY_M)
-			  gaiaAddPointToGeomCollXYM (gaia, x, y, 0.0);
-		      else if (dimension_model == GAIA_XY_Z_M)
-			  gaiaAddPointToGeomCollXYZM (gaia, x, y, z, 0.0);
-		      else
-			  gaiaAddPointToGeomColl (gaia, x, y);
+		      fromGeosPoint (handle, gaia, geos_item, dimension_model);
 		      break;
 		  case GEOS_LINESTRING:
-		      if (handle != NULL)
-			{
-			    cs = GEOSGeom_getCoordSeq_r (handle, geos_item);
-			    GEOSCoordSeq_getDimensions_r (handle, cs, &dims);
-			    GEOSCoordSeq_getSize_r (handle, cs, &points);
-			}
-		      else
-			{
-			    cs = GEOSGeom_getCoordSeq (geos_item);
-			    GEOSCoordSeq_getDimensions (cs, &dims);
-			    GEOSCoordSeq_getSize (cs, &points);
-			}
-		      ln = gaiaAddLinestringToGeomColl (gaia, points);
-		      for (iv = 0; iv < (int) points; iv++)
-			{
-			    if (dims == 3)
-			      {
-				  if (handle != NULL)
-				    {
-					GEOSCoordSeq_getX_r (handle, cs, iv,
-							     &x);
-					GEOSCoordSeq_getY_r (handle, cs, iv,
-							     &y);
-					GEOSCoordSeq_getZ_r (handle, cs, iv,
-							     &z);
-				    }
-				  else
-				    {
-					GEOSCoordSeq_getX (cs, iv, &x);
-					GEOSCoordSeq_getY (cs, iv, &y);
-					GEOSCoordSeq_getZ (cs, iv, &z);
-				    }
-			      }
-			    else
-			      {
-				  if (handle != NULL)
-				    {
-					GEOSCoordSeq_getX_r (handle, cs, iv,
-							     &x);
-					GEOSCoordSeq_getY_r (handle, cs, iv,
-							     &y);
-				    }
-				  else
-				    {
-					GEOSCoordSeq_getX (cs, iv, &x);
-					GEOSCoordSeq_getY (cs, iv, &y);
-				    }
-				  z = 0.0;
-			      }
-			    if (dimension_model == GAIA_XY_Z)
-			      {
-				  gaiaSetPointXYZ (ln->Coords, iv, x, y, z);
-			      }
-			    else if (dimension_model == GAIA_XY_M)
-			      {
-				  gaiaSetPointXYM (ln->Coords, iv, x, y, 0.0);
-			      }
-			    else if (dimension_model == GAIA_XY_Z_M)
-			      {
-				  gaiaSetPointXYZM (ln->Coords, iv, x, y, z,
-						    0.0);
-			      }
-			    else
-			      {
-				  gaiaSetPoint (ln->Coords, iv, x, y);
-			      }
-			}
+		      fromGeosLinestring (handle, gaia, geos_item,
+					  dimension_model);
 		      break;
 		  case GEOS_MULTILINESTRING:
 		      if (handle != NULL)
@@ -1696,239 +705,20 @@ fromGeosGeometry (GEOSContextHandle_t handle, const GEOSGeometry * geos,
 			{
 			    /* looping on elementaty geometries */
 			    if (handle != NULL)
-			      {
-				  geos_sub_item =
-				      GEOSGetGeometryN_r (handle, geos_item,
-							  sub_it);
-				  cs = GEOSGeom_getCoordSeq_r (handle,
-							       geos_sub_item);
-				  GEOSCoordSeq_getDimensions_r (handle, cs,
-								&dims);
-				  GEOSCoordSeq_getSize_r (handle, cs, &points);
-			      }
+				fromGeosLinestring (handle, gaia,
+						    GEOSGetGeometryN_r (handle,
+									geos_item,
+									sub_it),
+						    dimension_model);
 			    else
-			      {
-				  geos_sub_item =
-				      GEOSGetGeometryN (geos_item, sub_it);
-				  cs = GEOSGeom_getCoordSeq (geos_sub_item);
-				  GEOSCoordSeq_getDimensions (cs, &dims);
-				  GEOSCoordSeq_getSize (cs, &points);
-			      }
-			    ln = gaiaAddLinestringToGeomColl (gaia, points);
-			    for (iv = 0; iv < (int) points; iv++)
-			      {
-				  if (dims == 3)
-				    {
-					if (handle != NULL)
-					  {
-					      GEOSCoordSeq_getX_r (handle, cs,
-								   iv, &x);
-					      GEOSCoordSeq_getY_r (handle, cs,
-								   iv, &y);
-					      GEOSCoordSeq_getZ_r (handle, cs,
-								   iv, &z);
-					  }
-					else
-					  {
-					      GEOSCoordSeq_getX (cs, iv, &x);
-					      GEOSCoordSeq_getY (cs, iv, &y);
-					      GEOSCoordSeq_getZ (cs, iv, &z);
-					  }
-				    }
-				  else
-				    {
-					if (handle != NULL)
-					  {
-					      GEOSCoordSeq_getX_r (handle, cs,
-								   iv, &x);
-					      GEOSCoordSeq_getY_r (handle, cs,
-								   iv, &y);
-					  }
-					else
-					  {
-					      GEOSCoordSeq_getX (cs, iv, &x);
-					      GEOSCoordSeq_getY (cs, iv, &y);
-					  }
-					z = 0.0;
-				    }
-				  if (dimension_model == GAIA_XY_Z)
-				    {
-					gaiaSetPointXYZ (ln->Coords, iv, x, y,
-							 z);
-				    }
-				  else if (dimension_model == GAIA_XY_M)
-				    {
-					gaiaSetPointXYM (ln->Coords, iv, x, y,
-							 0.0);
-				    }
-				  else if (dimension_model == GAIA_XY_Z_M)
-				    {
-					gaiaSetPointXYZM (ln->Coords, iv, x, y,
-							  z, 0.0);
-				    }
-				  else
-				    {
-					gaiaSetPoint (ln->Coords, iv, x, y);
-				    }
-			      }
+				fromGeosLinestring (handle, gaia,
+						    GEOSGetGeometryN
+						    (geos_item, sub_it),
+						    dimension_model);
 			}
 		      break;
 		  case GEOS_POLYGON:
-		      /* exterior ring */
-		      if (handle != NULL)
-			{
-			    holes =
-				GEOSGetNumInteriorRings_r (handle, geos_item);
-			    geos_ring =
-				GEOSGetExteriorRing_r (handle, geos_item);
-			    cs = GEOSGeom_getCoordSeq_r (handle, geos_ring);
-			    GEOSCoordSeq_getDimensions_r (handle, cs, &dims);
-			    GEOSCoordSeq_getSize_r (handle, cs, &points);
-			}
-		      else
-			{
-			    holes = GEOSGetNumInteriorRings (geos_item);
-			    geos_ring = GEOSGetExteriorRing (geos_item);
-			    cs = GEOSGeom_getCoordSeq (geos_ring);
-			    GEOSCoordSeq_getDimensions (cs, &dims);
-			    GEOSCoordSeq_getSize (cs, &points);
-			}
-		      pg = gaiaAddPolygonToGeomColl (gaia, points, holes);
-		      rng = pg->Exterior;
-		      for (iv = 0; iv < (int) points; iv++)
-			{
-			    if (dims == 3)
-			      {
-				  if (handle != NULL)
-				    {
-					GEOSCoordSeq_getX_r (handle, cs, iv,
-							     &x);
-					GEOSCoordSeq_getY_r (handle, cs, iv,
-							     &y);
-					GEOSCoordSeq_getZ_r (handle, cs, iv,
-							     &z);
-				    }
-				  else
-				    {
-					GEOSCoordSeq_getX (cs, iv, &x);
-					GEOSCoordSeq_getY (cs, iv, &y);
-					GEOSCoordSeq_getZ (cs, iv, &z);
-				    }
-			      }
-			    else
-			      {
-				  if (handle != NULL)
-				    {
-					GEOSCoordSeq_getX_r (handle, cs, iv,
-							     &x);
-					GEOSCoordSeq_getY_r (handle, cs, iv,
-							     &y);
-				    }
-				  else
-				    {
-					GEOSCoordSeq_getX (cs, iv, &x);
-					GEOSCoordSeq_getY (cs, iv, &y);
-				    }
-				  z = 0.0;
-			      }
-			    if (dimension_model == GAIA_XY_Z)
-			      {
-				  gaiaSetPointXYZ (rng->Coords, iv, x, y, z);
-			      }
-			    else if (dimension_model == GAIA_XY_M)
-			      {
-				  gaiaSetPointXYM (rng->Coords, iv, x, y, 0.0);
-			      }
-			    else if (dimension_model == GAIA_XY_Z_M)
-			      {
-				  gaiaSetPointXYZM (rng->Coords, iv, x, y, z,
-						    0.0);
-			      }
-			    else
-			      {
-				  gaiaSetPoint (rng->Coords, iv, x, y);
-			      }
-			}
-		      for (ib = 0; ib < holes; ib++)
-			{
-			    /* interior rings */
-			    if (handle != NULL)
-			      {
-				  geos_ring =
-				      GEOSGetInteriorRingN_r (handle, geos_item,
-							      ib);
-				  cs = GEOSGeom_getCoordSeq_r (handle,
-							       geos_ring);
-				  GEOSCoordSeq_getDimensions_r (handle, cs,
-								&dims);
-				  GEOSCoordSeq_getSize_r (handle, cs, &points);
-			      }
-			    else
-			      {
-				  geos_ring =
-				      GEOSGetInteriorRingN (geos_item, ib);
-				  cs = GEOSGeom_getCoordSeq (geos_ring);
-				  GEOSCoordSeq_getDimensions (cs, &dims);
-				  GEOSCoordSeq_getSize (cs, &points);
-			      }
-			    rng = gaiaAddInteriorRing (pg, ib, points);
-			    for (iv = 0; iv < (int) points; iv++)
-			      {
-				  if (dims == 3)
-				    {
-					if (handle != NULL)
-					  {
-					      GEOSCoordSeq_getX_r (handle, cs,
-								   iv, &x);
-					      GEOSCoordSeq_getY_r (handle, cs,
-								   iv, &y);
-					      GEOSCoordSeq_getZ_r (handle, cs,
-								   iv, &z);
-					  }
-					else
-					  {
-					      GEOSCoordSeq_getX (cs, iv, &x);
-					      GEOSCoordSeq_getY (cs, iv, &y);
-					      GEOSCoordSeq_getZ (cs, iv, &z);
-					  }
-				    }
-				  else
-				    {
-					if (handle != NULL)
-					  {
-					      GEOSCoordSeq_getX_r (handle, cs,
-								   iv, &x);
-					      GEOSCoordSeq_getY_r (handle, cs,
-								   iv, &y);
-					  }
-					else
-					  {
-					      GEOSCoordSeq_getX (cs, iv, &x);
-					      GEOSCoordSeq_getY (cs, iv, &y);
-					  }
-					z = 0.0;
-				    }
-				  if (dimension_model == GAIA_XY_Z)
-				    {
-					gaiaSetPointXYZ (rng->Coords, iv, x, y,
-							 z);
-				    }
-				  else if (dimension_model == GAIA_XY_M)
-				    {
-					gaiaSetPointXYM (rng->Coords, iv, x, y,
-							 0.0);
-				    }
-				  else if (dimension_model == GAIA_XY_Z_M)
-				    {
-					gaiaSetPointXYZM (rng->Coords, iv, x, y,
-							  z, 0.0);
-				    }
-				  else
-				    {
-					gaiaSetPoint (rng->Coords, iv, x, y);
-				    }
-			      }
-			}
+		      fromGeosPolygon (handle, gaia, geos_item, dimension_model);
 		      break;
 		  };
 	    }
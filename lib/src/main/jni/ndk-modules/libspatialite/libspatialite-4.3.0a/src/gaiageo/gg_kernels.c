@@ -0,0 +1,915 @@
+/*
+
+ gg_kernels.c -- Gaia vectorized coordinate kernels
+
+ version 4.3, 2015 June 29
+
+ Author: Sandro Furieri a.furieri@lqt.it
+
+ ------------------------------------------------------------------------------
+
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+
+Portions created by the Initial Developer are Copyright (C) 2008-2015
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+
+*/
+
+/*
+/
+/ all kernels below operate on the interleaved Coords arrays used by
+/ Linestrings and Rings; whatever is the DimensionModel the X and Y
+/ values of each vertex are always adjacent, so a single 128 bit
+/ register exactly holds one XY pair and Z/M values are simply
+/ skipped by the stride.
+/
+/ the vectorized kernels perform exactly the same IEEE operations
+/ (in the same order) as the scalar ones, so they always return
+/ bit-identical results: setting SPATIALITE_SIMD=scalar in the
+/ environment forces the scalar kernels anyway.
+/
+*/
+
+#include <sys/types.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "config-msvc.h"
+#else
+#include "config.h"
+#endif
+
+#include <spatialite/sqlite.h>
+
+#include <spatialite/gaiageo.h>
+#include <spatialite_private.h>
+
+#ifdef _WIN32
+#define strcasecmp	_stricmp
+#endif /* not WIN32 */
+
+#ifndef OMIT_SIMD		/* SIMD kernels are enabled */
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define GAIA_SIMD_NEON
+#include <arm_neon.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GAIA_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+#endif /* end SIMD conditional */
+
+/* floating point contraction (FMA) must be disabled, otherwise the
+   scalar and vectorized kernels could round differently */
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+struct gaia_coords_kernels
+{
+/* a set of coordinate kernels */
+    const char *name;
+    void (*mbr) (const double *coords, int points, int stride, double *mbr);
+    void (*shift) (double *coords, int points, int stride, double shift_x,
+		   double shift_y);
+    void (*scale) (double *coords, int points, int stride, double scale_x,
+		   double scale_y);
+    void (*rotate) (double *coords, int points, int stride, double cosine,
+		    double sine);
+    void (*affine) (double *coords, int points, int stride,
+		    const double *matrix);
+    double (*length) (const double *coords, int points, int stride);
+    double (*area) (const double *coords, int points, int stride);
+    void (*haversine) (const double *point, const double *set, int count,
+		       double *row);
+};
+
+static int
+coords_stride (int dimension_model)
+{
+/* number of doubles for each vertex */
+    switch (dimension_model)
+      {
+      case GAIA_XY_Z:
+      case GAIA_XY_M:
+	  return 3;
+      case GAIA_XY_Z_M:
+	  return 4;
+      };
+    return 2;
+}
+
+static void
+scalar_mbr (const double *coords, int points, int stride, double *mbr)
+{
+/* scalar kernel: MBR */
+    int iv;
+    double x;
+    double y;
+    double min_x = DBL_MAX;
+    double min_y = DBL_MAX;
+    double max_x = -DBL_MAX;
+    double max_y = -DBL_MAX;
+    const double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+      {
+	  x = p[0];
+	  y = p[1];
+	  if (x < min_x)
+	      min_x = x;
+	  if (y < min_y)
+	      min_y = y;
+	  if (x > max_x)
+	      max_x = x;
+	  if (y > max_y)
+	      max_y = y;
+      }
+    mbr[0] = min_x;
+    mbr[1] = min_y;
+    mbr[2] = max_x;
+    mbr[3] = max_y;
+}
+
+static void
+scalar_shift (double *coords, int points, int stride, double shift_x,
+	      double shift_y)
+{
+/* scalar kernel: shifting */
+    int iv;
+    double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+      {
+	  p[0] += shift_x;
+	  p[1] += shift_y;
+      }
+}
+
+static void
+scalar_scale (double *coords, int points, int stride, double scale_x,
+	      double scale_y)
+{
+/* scalar kernel: scaling */
+    int iv;
+    double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+      {
+	  p[0] *= scale_x;
+	  p[1] *= scale_y;
+      }
+}
+
+static void
+scalar_rotate (double *coords, int points, int stride, double cosine,
+	       double sine)
+{
+/* scalar kernel: rotating */
+    int iv;
+    double x;
+    double y;
+    double minus_sine = -sine;
+    double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+      {
+	  /* y*cos + x*(-sin) is exactly the same as y*cos - x*sin */
+	  x = p[0];
+	  y = p[1];
+	  p[0] = (x * cosine) + (y * sine);
+	  p[1] = (y * cosine) + (x * minus_sine);
+      }
+}
+
+static void
+scalar_affine (double *coords, int points, int stride, const double *matrix)
+{
+/* scalar kernel: 2D Affine Transform [xx, xy, yx, yy, xoff, yoff] */
+    int iv;
+    double x;
+    double y;
+    double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+      {
+	  x = p[0];
+	  y = p[1];
+	  p[0] = (matrix[0] * x) + (matrix[1] * y) + matrix[4];
+	  p[1] = (matrix[2] * x) + (matrix[3] * y) + matrix[5];
+      }
+}
+
+static double
+scalar_length (const double *coords, int points, int stride)
+{
+/* scalar kernel: total length */
+    int iv;
+    double x;
+    double y;
+    double lung = 0.0;
+    const double *p0 = coords;
+    const double *p1 = coords + stride;
+    for (iv = 1; iv < points; iv++, p0 += stride, p1 += stride)
+      {
+	  x = p0[0] - p1[0];
+	  y = p0[1] - p1[1];
+	  x *= x;
+	  y *= y;
+	  lung += sqrt (x + y);
+      }
+    return lung;
+}
+
+static double
+scalar_area (const double *coords, int points, int stride)
+{
+/* scalar kernel: signed area */
+    int iv;
+    double a;
+    double b;
+    double area = 0.0;
+    const double *p0 = coords;
+    const double *p1 = coords + stride;
+    for (iv = 1; iv < points; iv++, p0 += stride, p1 += stride)
+      {
+	  a = p0[0] * p1[1];
+	  b = p0[1] * p1[0];
+	  area += a - b;
+      }
+    return area / 2.0;
+}
+
+static double
+haversine_cell (const double *point, const double *set, int count, int j)
+{
+/*
+/ the square root of the haversine term between a Point and the J-th
+/ Point of a set; see gaiaCoordsHaversineRow() for the layout
+*/
+    double k1 = point[0] * set[count + j] - point[1] * set[j];
+    double k2 =
+	point[2] * set[(3 * count) + j] - point[3] * set[(2 * count) + j];
+    return sqrt (k1 * k1 + point[4] * set[(4 * count) + j] * k2 * k2);
+}
+
+static void
+scalar_haversine (const double *point, const double *set, int count,
+		  double *row)
+{
+/* scalar kernel: haversine terms of a Point against a set of Points */
+    int j;
+    for (j = 0; j < count; j++)
+	row[j] = haversine_cell (point, set, count, j);
+}
+
+static const struct gaia_coords_kernels scalar_kernels = {
+    "scalar",
+    scalar_mbr,
+    scalar_shift,
+    scalar_scale,
+    scalar_rotate,
+    scalar_affine,
+    scalar_length,
+    scalar_area,
+    scalar_haversine
+};
+
+#ifdef GAIA_SIMD_SSE2		/* SSE2 kernels */
+
+static void
+simd_mbr (const double *coords, int points, int stride, double *mbr)
+{
+/* SSE2 kernel: MBR */
+    int iv;
+    __m128d v;
+    __m128d vmin = _mm_set1_pd (DBL_MAX);
+    __m128d vmax = _mm_set1_pd (-DBL_MAX);
+    const double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+      {
+	  /* MINPD/MAXPD return the second operand on ties and NaNs,
+	     exactly as the scalar "if (x < min) min = x" does */
+	  v = _mm_loadu_pd (p);
+	  vmin = _mm_min_pd (v, vmin);
+	  vmax = _mm_max_pd (v, vmax);
+      }
+    _mm_storeu_pd (mbr, vmin);
+    _mm_storeu_pd (mbr + 2, vmax);
+}
+
+static void
+simd_shift (double *coords, int points, int stride, double shift_x,
+	    double shift_y)
+{
+/* SSE2 kernel: shifting */
+    int iv;
+    __m128d shift = _mm_set_pd (shift_y, shift_x);
+    double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+	_mm_storeu_pd (p, _mm_add_pd (_mm_loadu_pd (p), shift));
+}
+
+static void
+simd_scale (double *coords, int points, int stride, double scale_x,
+	    double scale_y)
+{
+/* SSE2 kernel: scaling */
+    int iv;
+    __m128d scale = _mm_set_pd (scale_y, scale_x);
+    double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+	_mm_storeu_pd (p, _mm_mul_pd (_mm_loadu_pd (p), scale));
+}
+
+static void
+simd_rotate (double *coords, int points, int stride, double cosine,
+	     double sine)
+{
+/* SSE2 kernel: rotating */
+    int iv;
+    __m128d v;
+    __m128d swapped;
+    __m128d vcos = _mm_set1_pd (cosine);
+    __m128d vsin = _mm_set_pd (-sine, sine);
+    double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+      {
+	  v = _mm_loadu_pd (p);
+	  swapped = _mm_shuffle_pd (v, v, 1);
+	  v = _mm_add_pd (_mm_mul_pd (v, vcos), _mm_mul_pd (swapped, vsin));
+	  _mm_storeu_pd (p, v);
+      }
+}
+
+static void
+simd_affine (double *coords, int points, int stride, const double *matrix)
+{
+/* SSE2 kernel: 2D Affine Transform */
+    int iv;
+    __m128d v;
+    __m128d col_x = _mm_set_pd (matrix[2], matrix[0]);
+    __m128d col_y = _mm_set_pd (matrix[3], matrix[1]);
+    __m128d off = _mm_set_pd (matrix[5], matrix[4]);
+    double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+      {
+	  v = _mm_loadu_pd (p);
+	  v = _mm_add_pd (_mm_add_pd
+			  (_mm_mul_pd (col_x, _mm_unpacklo_pd (v, v)),
+			   _mm_mul_pd (col_y, _mm_unpackhi_pd (v, v))), off);
+	  _mm_storeu_pd (p, v);
+      }
+}
+
+static double
+simd_length (const double *coords, int points, int stride)
+{
+/* SSE2 kernel: total length - two square roots at once */
+    int iv;
+    __m128d p0;
+    __m128d p1;
+    __m128d p2;
+    __m128d d0;
+    __m128d d1;
+    double dist[2];
+    double lung = 0.0;
+    if (points < 2)
+	return lung;
+    p0 = _mm_loadu_pd (coords);
+    for (iv = 1; iv + 1 < points; iv += 2)
+      {
+	  p1 = _mm_loadu_pd (coords + (iv * stride));
+	  p2 = _mm_loadu_pd (coords + ((iv + 1) * stride));
+	  d0 = _mm_sub_pd (p0, p1);
+	  d1 = _mm_sub_pd (p1, p2);
+	  d0 = _mm_mul_pd (d0, d0);
+	  d1 = _mm_mul_pd (d1, d1);
+	  d0 = _mm_add_pd (_mm_unpacklo_pd (d0, d1), _mm_unpackhi_pd (d0, d1));
+	  _mm_storeu_pd (dist, _mm_sqrt_pd (d0));
+	  lung += dist[0];
+	  lung += dist[1];
+	  p0 = p2;
+      }
+    if (iv < points)
+      {
+	  /* the last odd segment */
+	  d0 = _mm_sub_pd (p0, _mm_loadu_pd (coords + (iv * stride)));
+	  _mm_storeu_pd (dist, _mm_mul_pd (d0, d0));
+	  lung += sqrt (dist[0] + dist[1]);
+      }
+    return lung;
+}
+
+static double
+simd_area (const double *coords, int points, int stride)
+{
+/* SSE2 kernel: signed area - two cross products at once */
+    int iv;
+    __m128d p0;
+    __m128d p1;
+    __m128d p2;
+    __m128d c0;
+    __m128d c1;
+    double term[2];
+    double area = 0.0;
+    if (points < 2)
+	return area;
+    p0 = _mm_loadu_pd (coords);
+    for (iv = 1; iv + 1 < points; iv += 2)
+      {
+	  p1 = _mm_loadu_pd (coords + (iv * stride));
+	  p2 = _mm_loadu_pd (coords + ((iv + 1) * stride));
+	  c0 = _mm_mul_pd (p0, _mm_shuffle_pd (p1, p1, 1));
+	  c1 = _mm_mul_pd (p1, _mm_shuffle_pd (p2, p2, 1));
+	  c0 = _mm_sub_pd (_mm_unpacklo_pd (c0, c1), _mm_unpackhi_pd (c0, c1));
+	  _mm_storeu_pd (term, c0);
+	  area += term[0];
+	  area += term[1];
+	  p0 = p2;
+      }
+    if (iv < points)
+      {
+	  /* the last odd segment */
+	  p1 = _mm_loadu_pd (coords + (iv * stride));
+	  _mm_storeu_pd (term, _mm_mul_pd (p0, _mm_shuffle_pd (p1, p1, 1)));
+	  area += term[0] - term[1];
+      }
+    return area / 2.0;
+}
+
+static void
+simd_haversine (const double *point, const double *set, int count,
+		double *row)
+{
+/* SSE2 kernel: haversine terms - two Points of the set at once */
+    int j;
+    __m128d k1;
+    __m128d k2;
+    __m128d sin_lat = _mm_set1_pd (point[0]);
+    __m128d cos_lat = _mm_set1_pd (point[1]);
+    __m128d sin_lon = _mm_set1_pd (point[2]);
+    __m128d cos_lon = _mm_set1_pd (point[3]);
+    __m128d cos_phi = _mm_set1_pd (point[4]);
+    for (j = 0; j + 1 < count; j += 2)
+      {
+	  k1 = _mm_sub_pd (_mm_mul_pd (sin_lat,
+				       _mm_loadu_pd (set + count + j)),
+			   _mm_mul_pd (cos_lat, _mm_loadu_pd (set + j)));
+	  k2 = _mm_sub_pd (_mm_mul_pd
+			   (sin_lon, _mm_loadu_pd (set + (3 * count) + j)),
+			   _mm_mul_pd (cos_lon,
+				       _mm_loadu_pd (set + (2 * count) + j)));
+	  k2 = _mm_mul_pd (_mm_mul_pd
+			   (_mm_mul_pd
+			    (cos_phi, _mm_loadu_pd (set + (4 * count) + j)),
+			    k2), k2);
+	  _mm_storeu_pd (row + j,
+			 _mm_sqrt_pd (_mm_add_pd (_mm_mul_pd (k1, k1), k2)));
+      }
+    if (j < count)
+	row[j] = haversine_cell (point, set, count, j);
+}
+
+#define GAIA_SIMD_NAME	"sse2"
+
+#endif /* end SSE2 kernels */
+
+#ifdef GAIA_SIMD_NEON		/* NEON kernels */
+
+static void
+simd_mbr (const double *coords, int points, int stride, double *mbr)
+{
+/* NEON kernel: MBR */
+    int iv;
+    float64x2_t v;
+    float64x2_t vmin = vdupq_n_f64 (DBL_MAX);
+    float64x2_t vmax = vdupq_n_f64 (-DBL_MAX);
+    const double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+      {
+	  /* explicit compare and select: FMIN/FMAXNM would not handle
+	     ties and NaNs exactly as the scalar "if (x < min) min = x" */
+	  v = vld1q_f64 (p);
+	  vmin = vbslq_f64 (vcltq_f64 (v, vmin), v, vmin);
+	  vmax = vbslq_f64 (vcgtq_f64 (v, vmax), v, vmax);
+      }
+    vst1q_f64 (mbr, vmin);
+    vst1q_f64 (mbr + 2, vmax);
+}
+
+static float64x2_t
+neon_pair (double lo, double hi)
+{
+/* building a vector from two values */
+    double pair[2];
+    pair[0] = lo;
+    pair[1] = hi;
+    return vld1q_f64 (pair);
+}
+
+static void
+simd_shift (double *coords, int points, int stride, double shift_x,
+	    double shift_y)
+{
+/* NEON kernel: shifting */
+    int iv;
+    float64x2_t shift = neon_pair (shift_x, shift_y);
+    double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+	vst1q_f64 (p, vaddq_f64 (vld1q_f64 (p), shift));
+}
+
+static void
+simd_scale (double *coords, int points, int stride, double scale_x,
+	    double scale_y)
+{
+/* NEON kernel: scaling */
+    int iv;
+    float64x2_t scale = neon_pair (scale_x, scale_y);
+    double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+	vst1q_f64 (p, vmulq_f64 (vld1q_f64 (p), scale));
+}
+
+static void
+simd_rotate (double *coords, int points, int stride, double cosine,
+	     double sine)
+{
+/* NEON kernel: rotating */
+    int iv;
+    float64x2_t v;
+    float64x2_t vcos = vdupq_n_f64 (cosine);
+    float64x2_t vsin = neon_pair (sine, -sine);
+    double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+      {
+	  v = vld1q_f64 (p);
+	  v = vaddq_f64 (vmulq_f64 (v, vcos),
+			 vmulq_f64 (vextq_f64 (v, v, 1), vsin));
+	  vst1q_f64 (p, v);
+      }
+}
+
+static void
+simd_affine (double *coords, int points, int stride, const double *matrix)
+{
+/* NEON kernel: 2D Affine Transform */
+    int iv;
+    float64x2_t v;
+    float64x2_t col_x = neon_pair (matrix[0], matrix[2]);
+    float64x2_t col_y = neon_pair (matrix[1], matrix[3]);
+    float64x2_t off = neon_pair (matrix[4], matrix[5]);
+    double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+      {
+	  v = vld1q_f64 (p);
+	  v = vaddq_f64 (vaddq_f64
+			 (vmulq_f64 (col_x, vdupq_laneq_f64 (v, 0)),
+			  vmulq_f64 (col_y, vdupq_laneq_f64 (v, 1))), off);
+	  vst1q_f64 (p, v);
+      }
+}
+
+static double
+simd_length (const double *coords, int points, int stride)
+{
+/* NEON kernel: total length - two square roots at once */
+    int iv;
+    float64x2_t p0;
+    float64x2_t p1;
+    float64x2_t p2;
+    float64x2_t d0;
+    float64x2_t d1;
+    double dist[2];
+    double lung = 0.0;
+    if (points < 2)
+	return lung;
+    p0 = vld1q_f64 (coords);
+    for (iv = 1; iv + 1 < points; iv += 2)
+      {
+	  p1 = vld1q_f64 (coords + (iv * stride));
+	  p2 = vld1q_f64 (coords + ((iv + 1) * stride));
+	  d0 = vsubq_f64 (p0, p1);
+	  d1 = vsubq_f64 (p1, p2);
+	  d0 = vmulq_f64 (d0, d0);
+	  d1 = vmulq_f64 (d1, d1);
+	  d0 = vaddq_f64 (vzip1q_f64 (d0, d1), vzip2q_f64 (d0, d1));
+	  vst1q_f64 (dist, vsqrtq_f64 (d0));
+	  lung += dist[0];
+	  lung += dist[1];
+	  p0 = p2;
+      }
+    if (iv < points)
+      {
+	  /* the last odd segment */
+	  d0 = vsubq_f64 (p0, vld1q_f64 (coords + (iv * stride)));
+	  vst1q_f64 (dist, vmulq_f64 (d0, d0));
+	  lung += sqrt (dist[0] + dist[1]);
+      }
+    return lung;
+}
+
+static double
+simd_area (const double *coords, int points, int stride)
+{
+/* NEON kernel: signed area - two cross products at once */
+    int iv;
+    float64x2_t p0;
+    float64x2_t p1;
+    float64x2_t p2;
+    float64x2_t c0;
+    float64x2_t c1;
+    double term[2];
+    double area = 0.0;
+    if (points < 2)
+	return area;
+    p0 = vld1q_f64 (coords);
+    for (iv = 1; iv + 1 < points; iv += 2)
+      {
+	  p1 = vld1q_f64 (coords + (iv * stride));
+	  p2 = vld1q_f64 (coords + ((iv + 1) * stride));
+	  c0 = vmulq_f64 (p0, vextq_f64 (p1, p1, 1));
+	  c1 = vmulq_f64 (p1, vextq_f64 (p2, p2, 1));
+	  c0 = vsubq_f64 (vzip1q_f64 (c0, c1), vzip2q_f64 (c0, c1));
+	  vst1q_f64 (term, c0);
+	  area += term[0];
+	  area += term[1];
+	  p0 = p2;
+      }
+    if (iv < points)
+      {
+	  /* the last odd segment */
+	  p1 = vld1q_f64 (coords + (iv * stride));
+	  vst1q_f64 (term, vmulq_f64 (p0, vextq_f64 (p1, p1, 1)));
+	  area += term[0] - term[1];
+      }
+    return area / 2.0;
+}
+
+static void
+simd_haversine (const double *point, const double *set, int count,
+		double *row)
+{
+/* NEON kernel: haversine terms - two Points of the set at once */
+    int j;
+    float64x2_t k1;
+    float64x2_t k2;
+    float64x2_t sin_lat = vdupq_n_f64 (point[0]);
+    float64x2_t cos_lat = vdupq_n_f64 (point[1]);
+    float64x2_t sin_lon = vdupq_n_f64 (point[2]);
+    float64x2_t cos_lon = vdupq_n_f64 (point[3]);
+    float64x2_t cos_phi = vdupq_n_f64 (point[4]);
+    for (j = 0; j + 1 < count; j += 2)
+      {
+	  k1 = vsubq_f64 (vmulq_f64 (sin_lat, vld1q_f64 (set + count + j)),
+			  vmulq_f64 (cos_lat, vld1q_f64 (set + j)));
+	  k2 = vsubq_f64 (vmulq_f64
+			  (sin_lon, vld1q_f64 (set + (3 * count) + j)),
+			  vmulq_f64 (cos_lon,
+				     vld1q_f64 (set + (2 * count) + j)));
+	  k2 = vmulq_f64 (vmulq_f64
+			  (vmulq_f64
+			   (cos_phi, vld1q_f64 (set + (4 * count) + j)), k2),
+			  k2);
+	  vst1q_f64 (row + j, vsqrtq_f64 (vaddq_f64 (vmulq_f64 (k1, k1), k2)));
+      }
+    if (j < count)
+	row[j] = haversine_cell (point, set, count, j);
+}
+
+#define GAIA_SIMD_NAME	"neon"
+
+#endif /* end NEON kernels */
+
+#ifdef GAIA_SIMD_NAME
+static const struct gaia_coords_kernels simd_kernels = {
+    GAIA_SIMD_NAME,
+    simd_mbr,
+    simd_shift,
+    simd_scale,
+    simd_rotate,
+    simd_affine,
+    simd_length,
+    simd_area,
+    simd_haversine
+};
+#endif
+
+static const struct gaia_coords_kernels *
+coords_kernels (void)
+{
+/* selecting the kernels once and forever */
+    static const struct gaia_coords_kernels *kernels = NULL;
+#ifdef GAIA_SIMD_NAME
+    const char *mode;
+#endif
+    if (kernels != NULL)
+	return kernels;
+#ifdef GAIA_SIMD_NAME
+    mode = getenv ("SPATIALITE_SIMD");
+    if (mode != NULL && strcasecmp (mode, "scalar") == 0)
+	kernels = &scalar_kernels;
+    else
+	kernels = &simd_kernels;
+#else
+    kernels = &scalar_kernels;
+#endif
+    return kernels;
+}
+
+GAIAGEO_DECLARE const char *
+gaiaCoordsKernelsName (void)
+{
+/* returns the name of the currently active kernels */
+    return coords_kernels ()->name;
+}
+
+SPATIALITE_PRIVATE void
+gaiaCoordsMbr (const double *coords, int points, int dimension_model,
+	       double *min_x, double *min_y, double *max_x, double *max_y)
+{
+/* computes the MBR of a Coords array */
+    double mbr[4];
+    coords_kernels ()->mbr (coords, points, coords_stride (dimension_model),
+			    mbr);
+    *min_x = mbr[0];
+    *min_y = mbr[1];
+    *max_x = mbr[2];
+    *max_y = mbr[3];
+}
+
+SPATIALITE_PRIVATE void
+gaiaCoordsShift (double *coords, int points, int dimension_model,
+		 double shift_x, double shift_y)
+{
+/* shifting all XY values of a Coords array */
+    coords_kernels ()->shift (coords, points, coords_stride (dimension_model),
+			      shift_x, shift_y);
+}
+
+SPATIALITE_PRIVATE void
+gaiaCoordsScale (double *coords, int points, int dimension_model,
+		 double scale_x, double scale_y)
+{
+/* scaling all XY values of a Coords array */
+    coords_kernels ()->scale (coords, points, coords_stride (dimension_model),
+			      scale_x, scale_y);
+}
+
+SPATIALITE_PRIVATE void
+gaiaCoordsRotate (double *coords, int points, int dimension_model,
+		  double cosine, double sine)
+{
+/* rotating all XY values of a Coords array */
+    coords_kernels ()->rotate (coords, points,
+			       coords_stride (dimension_model), cosine, sine);
+}
+
+SPATIALITE_PRIVATE void
+gaiaCoordsAffine2D (double *coords, int points, int dimension_model,
+		    const double *matrix)
+{
+/* applying a 2D Affine Transform to all XY values of a Coords array */
+    coords_kernels ()->affine (coords, points,
+			       coords_stride (dimension_model), matrix);
+}
+
+SPATIALITE_PRIVATE double
+gaiaCoordsLength (const double *coords, int points, int dimension_model)
+{
+/* computes the total length of a Coords array */
+    return coords_kernels ()->length (coords, points,
+				      coords_stride (dimension_model));
+}
+
+SPATIALITE_PRIVATE double
+gaiaCoordsSignedArea (const double *coords, int points, int dimension_model)
+{
+/* computes the signed area of a closed Coords array */
+    return coords_kernels ()->area (coords, points,
+				    coords_stride (dimension_model));
+}
+
+SPATIALITE_PRIVATE void
+gaiaCoordsHaversineRow (const double *point, const double *set, int count,
+			double *row)
+{
+/*
+/ computes the square roots of the haversine terms between a Point and
+/ each one of a set of COUNT Points (all angles are in radians):
+/ - POINT is {sin(lat/2), cos(lat/2), sin(lon/2), cos(lon/2), cos(lat)}
+/ - SET holds the same five values, as five consecutive arrays
+*/
+    coords_kernels ()->haversine (point, set, count, row);
+}
+
+SPATIALITE_PRIVATE float
+gaiaFloatRoundDown (double value)
+{
+/* 
+/ DOUBLE to FLOAT conversion always rounding towards -Infinity: the
+/ nearest FLOAT not greater than VALUE
+/
+/ this rounding is monotonic, as all FLOAT MBR indices (R*Tree,
+/ MbrCache, Quantized MBR) require so to always return a superset
+/ of the exact matches
+*/
+    float f = (float) value;
+    if (f > value)
+	f = nextafterf (f, -FLT_MAX);
+    return f;
+}
+
+SPATIALITE_PRIVATE float
+gaiaFloatRoundUp (double value)
+{
+/* 
+/ DOUBLE to FLOAT conversion always rounding towards +Infinity: the
+/ nearest FLOAT not lesser than VALUE
+*/
+    float f = (float) value;
+    if (f < value)
+	f = nextafterf (f, FLT_MAX);
+    return f;
+}
+
+SPATIALITE_PRIVATE unsigned int
+gaiaHilbertKey (double x, double y, double origin_x, double origin_y,
+		double scale_x, double scale_y)
+{
+/* 
+/ Hilbert curve distance of a Point on a 65536 x 65536 grid: the grid
+/ cell is (value - origin) * scale, clamped to the grid borders (NaN
+/ values fall into the first cell)
+/
+/ shared by all the Hilbert sorted structures (MbrCache, deferred
+/ R*Tree updates, ClusterTable) so that they all agree on the order
+*/
+    unsigned int hx;
+    unsigned int hy;
+    unsigned int rx;
+    unsigned int ry;
+    unsigned int s;
+    unsigned int t;
+    unsigned int d = 0;
+    double cx = (x - origin_x) * scale_x;
+    double cy = (y - origin_y) * scale_y;
+    if (!(cx >= 0.0))
+	cx = 0.0;		/* also intercepting NaN */
+    if (!(cy >= 0.0))
+	cy = 0.0;
+    if (cx > 65535.0)
+	cx = 65535.0;
+    if (cy > 65535.0)
+	cy = 65535.0;
+    hx = (unsigned int) cx;
+    hy = (unsigned int) cy;
+    for (s = 32768; s > 0; s /= 2)
+      {
+	  rx = (hx & s) > 0;
+	  ry = (hy & s) > 0;
+	  d += s * s * ((3 * rx) ^ ry);
+	  if (ry == 0)
+	    {
+		/* rotating the quadrant */
+		if (rx == 1)
+		  {
+		      hx = 65535 - hx;
+		      hy = 65535 - hy;
+		  }
+		t = hx;
+		hx = hy;
+		hy = t;
+	    }
+      }
+    return d;
+}
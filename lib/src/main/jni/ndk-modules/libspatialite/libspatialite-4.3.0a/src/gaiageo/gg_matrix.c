@@ -433,12 +433,84 @@ gaia_point_transform2D (struct at_matrix *matrix, double *x, double *y)
     *y = (matrix->yx * x0) + (matrix->yy * y0) + matrix->yoff;
 }
 
+static void
+matrix_transform_coords (struct at_matrix *matrix, const double *in_coords,
+			 int in_dims, double *out_coords, int out_dims,
+			 int points)
+{
+/* applying an Affine Transform to a whole Coords array */
+    int iv;
+    double x;
+    double y;
+    double z;
+    double m;
+    double matrix2D[6];
+    int stride = 0;
+    if (in_dims == out_dims && in_dims == GAIA_XY)
+	stride = 2;
+    if (in_dims == out_dims && in_dims == GAIA_XY_M)
+	stride = 3;
+    if (stride > 0)
+      {
+	  /* 2D: copying all values, then transforming XY at once */
+	  memcpy (out_coords, in_coords, sizeof (double) * stride * points);
+	  matrix2D[0] = matrix->xx;
+	  matrix2D[1] = matrix->xy;
+	  matrix2D[2] = matrix->yx;
+	  matrix2D[3] = matrix->yy;
+	  matrix2D[4] = matrix->xoff;
+	  matrix2D[5] = matrix->yoff;
+	  gaiaCoordsAffine2D (out_coords, points, out_dims, matrix2D);
+	  return;
+      }
+    for (iv = 0; iv < points; iv++)
+      {
+	  z = 0.0;
+	  m = 0.0;
+	  if (in_dims == GAIA_XY_Z)
+	    {
+		gaiaGetPointXYZ (in_coords, iv, &x, &y, &z);
+	    }
+	  else if (in_dims == GAIA_XY_M)
+	    {
+		gaiaGetPointXYM (in_coords, iv, &x, &y, &m);
+	    }
+	  else if (in_dims == GAIA_XY_Z_M)
+	    {
+		gaiaGetPointXYZM (in_coords, iv, &x, &y, &z, &m);
+	    }
+	  else
+	    {
+		gaiaGetPoint (in_coords, iv, &x, &y);
+	    }
+	  if (out_dims == GAIA_XY_Z || out_dims == GAIA_XY_Z_M)
+	      gaia_point_transform3D (matrix, &x, &y, &z);
+	  else
+	      gaia_point_transform2D (matrix, &x, &y);
+	  if (out_dims == GAIA_XY_Z)
+	    {
+		gaiaSetPointXYZ (out_coords, iv, x, y, z);
+	    }
+	  else if (out_dims == GAIA_XY_M)
+	    {
+		gaiaSetPointXYM (out_coords, iv, x, y, m);
+	    }
+	  else if (out_dims == GAIA_XY_Z_M)
+	    {
+		gaiaSetPointXYZM (out_coords, iv, x, y, z, m);
+	    }
+	  else
+	    {
+		gaiaSetPoint (out_coords, iv, x, y);
+	    }
+      }
+}
+
 GAIAMATRIX_DECLARE gaiaGeomCollPtr
 gaia_matrix_transform_geometry (gaiaGeomCollPtr geom,
 				const unsigned char *blob, int blob_sz)
 {
 /* transforming a Geometry by applying an Affine Transform Matrix */
-    int iv;
     int ib;
     double x;
     double y;
@@ -517,48 +589,9 @@ gaia_matrix_transform_geometry (gaiaGeomCollPtr geom,
       {
 	  /* copying LINESTRINGs */
 	  new_line = gaiaAddLinestringToGeomColl (new_geom, line->Points);
-	  for (iv = 0; iv < line->Points; iv++)
-	    {
-		z = 0.0;
-		m = 0.0;
-		if (line->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaGetPointXYZ (line->Coords, iv, &x, &y, &z);
-		  }
-		else if (line->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaGetPointXYM (line->Coords, iv, &x, &y, &m);
-		  }
-		else if (line->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaGetPointXYZM (line->Coords, iv, &x, &y, &z, &m);
-		  }
-		else
-		  {
-		      gaiaGetPoint (line->Coords, iv, &x, &y);
-		  }
-		if (new_line->DimensionModel == GAIA_XY_Z
-		    || new_line->DimensionModel == GAIA_XY_Z_M)
-		    gaia_point_transform3D (&matrix, &x, &y, &z);
-		else
-		    gaia_point_transform2D (&matrix, &x, &y);
-		if (new_line->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaSetPointXYZ (new_line->Coords, iv, x, y, z);
-		  }
-		else if (new_line->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaSetPointXYM (new_line->Coords, iv, x, y, m);
-		  }
-		else if (new_line->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaSetPointXYZM (new_line->Coords, iv, x, y, z, m);
-		  }
-		else
-		  {
-		      gaiaSetPoint (new_line->Coords, iv, x, y);
-		  }
-	    }
+	  matrix_transform_coords (&matrix, line->Coords, line->DimensionModel,
+				   new_line->Coords, new_line->DimensionModel,
+				   line->Points);
 	  line = line->Next;
       }
 
@@ -572,96 +605,17 @@ gaia_matrix_transform_geometry (gaiaGeomCollPtr geom,
 					polyg->NumInteriors);
 	  o_ring = new_polyg->Exterior;
 	  /* copying points for the EXTERIOR RING */
-	  for (iv = 0; iv < o_ring->Points; iv++)
-	    {
-		z = 0.0;
-		m = 0.0;
-		if (i_ring->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaGetPointXYZ (i_ring->Coords, iv, &x, &y, &z);
-		  }
-		else if (i_ring->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaGetPointXYM (i_ring->Coords, iv, &x, &y, &m);
-		  }
-		else if (i_ring->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaGetPointXYZM (i_ring->Coords, iv, &x, &y, &z, &m);
-		  }
-		else
-		  {
-		      gaiaGetPoint (i_ring->Coords, iv, &x, &y);
-		  }
-		if (o_ring->DimensionModel == GAIA_XY_Z
-		    || o_ring->DimensionModel == GAIA_XY_Z_M)
-		    gaia_point_transform3D (&matrix, &x, &y, &z);
-		else
-		    gaia_point_transform2D (&matrix, &x, &y);
-		if (o_ring->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaSetPointXYZ (o_ring->Coords, iv, x, y, z);
-		  }
-		else if (o_ring->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaSetPointXYM (o_ring->Coords, iv, x, y, m);
-		  }
-		else if (o_ring->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaSetPointXYZM (o_ring->Coords, iv, x, y, z, m);
-		  }
-		else
-		  {
-		      gaiaSetPoint (o_ring->Coords, iv, x, y);
-		  }
-	    }
+	  matrix_transform_coords (&matrix, i_ring->Coords,
+				   i_ring->DimensionModel, o_ring->Coords,
+				   o_ring->DimensionModel, o_ring->Points);
 	  for (ib = 0; ib < new_polyg->NumInteriors; ib++)
 	    {
 		/* copying each INTERIOR RING [if any] */
 		i_ring = polyg->Interiors + ib;
 		o_ring = gaiaAddInteriorRing (new_polyg, ib, i_ring->Points);
-		for (iv = 0; iv < o_ring->Points; iv++)
-		  {
-		      z = 0.0;
-		      m = 0.0;
-		      if (i_ring->DimensionModel == GAIA_XY_Z)
-			{
-			    gaiaGetPointXYZ (i_ring->Coords, iv, &x, &y, &z);
-			}
-		      else if (i_ring->DimensionModel == GAIA_XY_M)
-			{
-			    gaiaGetPointXYM (i_ring->Coords, iv, &x, &y, &m);
-			}
-		      else if (i_ring->DimensionModel == GAIA_XY_Z_M)
-			{
-			    gaiaGetPointXYZM (i_ring->Coords, iv, &x, &y, &z,
-					      &m);
-			}
-		      else
-			{
-			    gaiaGetPoint (i_ring->Coords, iv, &x, &y);
-			}
-		      if (o_ring->DimensionModel == GAIA_XY_Z
-			  || o_ring->DimensionModel == GAIA_XY_Z_M)
-			  gaia_point_transform3D (&matrix, &x, &y, &z);
-		      else
-			  gaia_point_transform2D (&matrix, &x, &y);
-		      if (o_ring->DimensionModel == GAIA_XY_Z)
-			{
-			    gaiaSetPointXYZ (o_ring->Coords, iv, x, y, z);
-			}
-		      else if (o_ring->DimensionModel == GAIA_XY_M)
-			{
-			    gaiaSetPointXYM (o_ring->Coords, iv, x, y, m);
-			}
-		      else if (o_ring->DimensionModel == GAIA_XY_Z_M)
-			{
-			    gaiaSetPointXYZM (o_ring->Coords, iv, x, y, z, m);
-			}
-		      else
-			{
-			    gaiaSetPoint (o_ring->Coords, iv, x, y);
-			}
-		  }
+		matrix_transform_coords (&matrix, i_ring->Coords,
+					 i_ring->DimensionModel, o_ring->Coords,
+					 o_ring->DimensionModel, o_ring->Points);
 	    }
 	  polyg = polyg->Next;
       }
@@ -245,11 +245,6 @@ gaiaShiftCoords (gaiaGeomCollPtr geom, double shift_x, double shift_y)
 {
 /* returns a geometry that is the old geometry with required shifting applied to coordinates */
     int ib;
-    int iv;
-    double x;
-    double y;
-    double z;
-    double m;
     gaiaPointPtr point;
     gaiaPolygonPtr polyg;
     gaiaLinestringPtr line;
@@ -268,43 +263,8 @@ gaiaShiftCoords (gaiaGeomCollPtr geom, double shift_x, double shift_y)
     while (line)
       {
 	  /* shifting LINESTRINGs */
-	  for (iv = 0; iv < line->Points; iv++)
-	    {
-		if (line->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaGetPointXYZ (line->Coords, iv, &x, &y, &z);
-		  }
-		else if (line->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaGetPointXYM (line->Coords, iv, &x, &y, &m);
-		  }
-		else if (line->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaGetPointXYZM (line->Coords, iv, &x, &y, &z, &m);
-		  }
-		else
-		  {
-		      gaiaGetPoint (line->Coords, iv, &x, &y);
-		  }
-		x += shift_x;
-		y += shift_y;
-		if (line->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaSetPointXYZ (line->Coords, iv, x, y, z);
-		  }
-		else if (line->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaSetPointXYM (line->Coords, iv, x, y, m);
-		  }
-		else if (line->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaSetPointXYZM (line->Coords, iv, x, y, z, m);
-		  }
-		else
-		  {
-		      gaiaSetPoint (line->Coords, iv, x, y);
-		  }
-	    }
+	  gaiaCoordsShift (line->Coords, line->Points, line->DimensionModel,
+			   shift_x, shift_y);
 	  line = line->Next;
       }
     polyg = geom->FirstPolygon;
@@ -312,85 +272,14 @@ gaiaShiftCoords (gaiaGeomCollPtr geom, double shift_x, double shift_y)
       {
 	  /* shifting POLYGONs */
 	  ring = polyg->Exterior;
-	  for (iv = 0; iv < ring->Points; iv++)
-	    {
-		/* shifting the EXTERIOR RING */
-		if (ring->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
-		  }
-		else if (ring->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaGetPointXYM (ring->Coords, iv, &x, &y, &m);
-		  }
-		else if (ring->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaGetPointXYZM (ring->Coords, iv, &x, &y, &z, &m);
-		  }
-		else
-		  {
-		      gaiaGetPoint (ring->Coords, iv, &x, &y);
-		  }
-		x += shift_x;
-		y += shift_y;
-		if (ring->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaSetPointXYZ (ring->Coords, iv, x, y, z);
-		  }
-		else if (ring->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaSetPointXYM (ring->Coords, iv, x, y, m);
-		  }
-		else if (ring->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaSetPointXYZM (ring->Coords, iv, x, y, z, m);
-		  }
-		else
-		  {
-		      gaiaSetPoint (ring->Coords, iv, x, y);
-		  }
-	    }
+	  gaiaCoordsShift (ring->Coords, ring->Points, ring->DimensionModel,
+			   shift_x, shift_y);
 	  for (ib = 0; ib < polyg->NumInteriors; ib++)
 	    {
 		/* shifting the INTERIOR RINGs */
 		ring = polyg->Interiors + ib;
-		for (iv = 0; iv < ring->Points; iv++)
-		  {
-		      if (ring->DimensionModel == GAIA_XY_Z)
-			{
-			    gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
-			}
-		      else if (ring->DimensionModel == GAIA_XY_M)
-			{
-			    gaiaGetPointXYM (ring->Coords, iv, &x, &y, &m);
-			}
-		      else if (ring->DimensionModel == GAIA_XY_Z_M)
-			{
-			    gaiaGetPointXYZM (ring->Coords, iv, &x, &y, &z, &m);
-			}
-		      else
-			{
-			    gaiaGetPoint (ring->Coords, iv, &x, &y);
-			}
-		      x += shift_x;
-		      y += shift_y;
-		      if (ring->DimensionModel == GAIA_XY_Z)
-			{
-			    gaiaSetPointXYZ (ring->Coords, iv, x, y, z);
-			}
-		      else if (ring->DimensionModel == GAIA_XY_M)
-			{
-			    gaiaSetPointXYM (ring->Coords, iv, x, y, m);
-			}
-		      else if (ring->DimensionModel == GAIA_XY_Z_M)
-			{
-			    gaiaSetPointXYZM (ring->Coords, iv, x, y, z, m);
-			}
-		      else
-			{
-			    gaiaSetPoint (ring->Coords, iv, x, y);
-			}
-		  }
+		gaiaCoordsShift (ring->Coords, ring->Points,
+				 ring->DimensionModel, shift_x, shift_y);
 	    }
 	  polyg = polyg->Next;
       }
@@ -930,11 +819,6 @@ gaiaScaleCoords (gaiaGeomCollPtr geom, double scale_x, double scale_y)
 {
 /* returns a geometry that is the old geometry with required scaling applied to coordinates */
     int ib;
-    int iv;
-    double x;
-    double y;
-    double z;
-    double m;
     gaiaPointPtr point;
     gaiaPolygonPtr polyg;
     gaiaLinestringPtr line;
@@ -953,6 +837,112 @@ gaiaScaleCoords (gaiaGeomCollPtr geom, double scale_x, double scale_y)
     while (line)
       {
 	  /* scaling LINESTRINGs */
+	  gaiaCoordsScale (line->Coords, line->Points, line->DimensionModel,
+			   scale_x, scale_y);
+	  line = line->Next;
+      }
+    polyg = geom->FirstPolygon;
+    while (polyg)
+      {
+	  /* scaling POLYGONs */
+	  ring = polyg->Exterior;
+	  gaiaCoordsScale (ring->Coords, ring->Points, ring->DimensionModel,
+			   scale_x, scale_y);
+	  for (ib = 0; ib < polyg->NumInteriors; ib++)
+	    {
+		/* scaling the INTERIOR RINGs */
+		ring = polyg->Interiors + ib;
+		gaiaCoordsScale (ring->Coords, ring->Points,
+				 ring->DimensionModel, scale_x, scale_y);
+	    }
+	  polyg = polyg->Next;
+      }
+    gaiaMbrGeometry (geom);
+}
+
+GAIAGEO_DECLARE void
+gaiaRotateCoords (gaiaGeomCollPtr geom, double angle)
+{
+/* returns a geometry that is the old geometry with required rotation applied to coordinates */
+    int ib;
+    double x;
+    double y;
+    double rad = angle * 0.0174532925199432958;
+    double cosine = cos (rad);
+    double sine = sin (rad);
+    gaiaPointPtr point;
+    gaiaPolygonPtr polyg;
+    gaiaLinestringPtr line;
+    gaiaRingPtr ring;
+    if (!geom)
+	return;
+    point = geom->FirstPoint;
+    while (point)
+      {
+	  /* rotating POINTs */
+	  x = point->X;
+	  y = point->Y;
+	  point->X = (x * cosine) + (y * sine);
+	  point->Y = (y * cosine) - (x * sine);
+	  point = point->Next;
+      }
+    line = geom->FirstLinestring;
+    while (line)
+      {
+	  /* rotating LINESTRINGs */
+	  gaiaCoordsRotate (line->Coords, line->Points, line->DimensionModel,
+			   cosine, sine);
+	  line = line->Next;
+      }
+    polyg = geom->FirstPolygon;
+    while (polyg)
+      {
+	  /* rotating POLYGONs */
+	  ring = polyg->Exterior;
+	  gaiaCoordsRotate (ring->Coords, ring->Points, ring->DimensionModel,
+			   cosine, sine);
+	  for (ib = 0; ib < polyg->NumInteriors; ib++)
+	    {
+		/* rotating the INTERIOR RINGs */
+		ring = polyg->Interiors + ib;
+		gaiaCoordsRotate (ring->Coords, ring->Points,
+				 ring->DimensionModel, cosine, sine);
+	    }
+	  polyg = polyg->Next;
+      }
+    gaiaMbrGeometry (geom);
+}
+
+GAIAGEO_DECLARE void
+gaiaReflectCoords (gaiaGeomCollPtr geom, int x_axis, int y_axis)
+{
+/* returns a geometry that is the old geometry with required reflection applied to coordinates */
+    int ib;
+    int iv;
+    double x;
+    double y;
+    double z = 0.0;
+    double m = 0.0;
+    gaiaPointPtr point;
+    gaiaPolygonPtr polyg;
+    gaiaLinestringPtr line;
+    gaiaRingPtr ring;
+    if (!geom)
+	return;
+    point = geom->FirstPoint;
+    while (point)
+      {
+	  /* reflecting POINTs */
+	  if (x_axis)
+	      point->X *= -1.0;
+	  if (y_axis)
+	      point->Y *= -1.0;
+	  point = point->Next;
+      }
+    line = geom->FirstLinestring;
+    while (line)
+      {
+	  /* reflecting LINESTRINGs */
 	  for (iv = 0; iv < line->Points; iv++)
 	    {
 		if (line->DimensionModel == GAIA_XY_Z)
@@ -971,8 +961,10 @@ gaiaScaleCoords (gaiaGeomCollPtr geom, double scale_x, double scale_y)
 		  {
 		      gaiaGetPoint (line->Coords, iv, &x, &y);
 		  }
-		x *= scale_x;
-		y *= scale_y;
+		if (x_axis)
+		    x *= -1.0;
+		if (y_axis)
+		    y *= -1.0;
 		if (line->DimensionModel == GAIA_XY_Z)
 		  {
 		      gaiaSetPointXYZ (line->Coords, iv, x, y, z);
@@ -995,11 +987,11 @@ gaiaScaleCoords (gaiaGeomCollPtr geom, double scale_x, double scale_y)
     polyg = geom->FirstPolygon;
     while (polyg)
       {
-	  /* scaling POLYGONs */
+	  /* reflecting POLYGONs */
 	  ring = polyg->Exterior;
 	  for (iv = 0; iv < ring->Points; iv++)
 	    {
-		/* scaling the EXTERIOR RING */
+		/* reflecting the EXTERIOR RING */
 		if (ring->DimensionModel == GAIA_XY_Z)
 		  {
 		      gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
@@ -1016,8 +1008,10 @@ gaiaScaleCoords (gaiaGeomCollPtr geom, double scale_x, double scale_y)
 		  {
 		      gaiaGetPoint (ring->Coords, iv, &x, &y);
 		  }
-		x *= scale_x;
-		y *= scale_y;
+		if (x_axis)
+		    x *= -1.0;
+		if (y_axis)
+		    y *= -1.0;
 		if (ring->DimensionModel == GAIA_XY_Z)
 		  {
 		      gaiaSetPointXYZ (ring->Coords, iv, x, y, z);
@@ -1037,7 +1031,7 @@ gaiaScaleCoords (gaiaGeomCollPtr geom, double scale_x, double scale_y)
 	    }
 	  for (ib = 0; ib < polyg->NumInteriors; ib++)
 	    {
-		/* scaling the INTERIOR RINGs */
+		/* reflecting the INTERIOR RINGs */
 		ring = polyg->Interiors + ib;
 		for (iv = 0; iv < ring->Points; iv++)
 		  {
@@ -1057,8 +1051,10 @@ gaiaScaleCoords (gaiaGeomCollPtr geom, double scale_x, double scale_y)
 			{
 			    gaiaGetPoint (ring->Coords, iv, &x, &y);
 			}
-		      x *= scale_x;
-		      y *= scale_y;
+		      if (x_axis)
+			  x *= -1.0;
+		      if (y_axis)
+			  y *= -1.0;
 		      if (ring->DimensionModel == GAIA_XY_Z)
 			{
 			    gaiaSetPointXYZ (ring->Coords, iv, x, y, z);
@@ -1083,20 +1079,16 @@ gaiaScaleCoords (gaiaGeomCollPtr geom, double scale_x, double scale_y)
 }
 
 GAIAGEO_DECLARE void
-gaiaRotateCoords (gaiaGeomCollPtr geom, double angle)
+gaiaSwapCoords (gaiaGeomCollPtr geom)
 {
-/* returns a geometry that is the old geometry with required rotation applied to coordinates */
+/* returns a geometry that is the old geometry with swapped x- and y-coordinates */
     int ib;
     int iv;
     double x;
     double y;
     double z;
     double m;
-    double nx;
-    double ny;
-    double rad = angle * 0.0174532925199432958;
-    double cosine = cos (rad);
-    double sine = sin (rad);
+    double sv;
     gaiaPointPtr point;
     gaiaPolygonPtr polyg;
     gaiaLinestringPtr line;
@@ -1106,17 +1098,16 @@ gaiaRotateCoords (gaiaGeomCollPtr geom, double angle)
     point = geom->FirstPoint;
     while (point)
       {
-	  /* shifting POINTs */
-	  x = point->X;
-	  y = point->Y;
-	  point->X = (x * cosine) + (y * sine);
-	  point->Y = (y * cosine) - (x * sine);
+	  /* swapping POINTs */
+	  sv = point->X;
+	  point->X = point->Y;
+	  point->Y = sv;
 	  point = point->Next;
       }
     line = geom->FirstLinestring;
     while (line)
       {
-	  /* rotating LINESTRINGs */
+	  /* swapping LINESTRINGs */
 	  for (iv = 0; iv < line->Points; iv++)
 	    {
 		if (line->DimensionModel == GAIA_XY_Z)
@@ -1135,176 +1126,16 @@ gaiaRotateCoords (gaiaGeomCollPtr geom, double angle)
 		  {
 		      gaiaGetPoint (line->Coords, iv, &x, &y);
 		  }
-		nx = (x * cosine) + (y * sine);
-		ny = (y * cosine) - (x * sine);
+		sv = x;
+		x = y;
+		y = sv;
 		if (line->DimensionModel == GAIA_XY_Z)
 		  {
-		      gaiaSetPointXYZ (line->Coords, iv, nx, ny, z);
+		      gaiaSetPointXYZ (line->Coords, iv, x, y, z);
 		  }
 		else if (line->DimensionModel == GAIA_XY_M)
 		  {
-		      gaiaSetPointXYM (line->Coords, iv, nx, ny, m);
-		  }
-		else if (line->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaSetPointXYZM (line->Coords, iv, nx, ny, z, m);
-		  }
-		else
-		  {
-		      gaiaSetPoint (line->Coords, iv, nx, ny);
-		  }
-	    }
-	  line = line->Next;
-      }
-    polyg = geom->FirstPolygon;
-    while (polyg)
-      {
-	  /* rotating POLYGONs */
-	  ring = polyg->Exterior;
-	  for (iv = 0; iv < ring->Points; iv++)
-	    {
-		/* rotating the EXTERIOR RING */
-		if (ring->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
-		  }
-		else if (ring->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaGetPointXYM (ring->Coords, iv, &x, &y, &m);
-		  }
-		else if (ring->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaGetPointXYZM (ring->Coords, iv, &x, &y, &z, &m);
-		  }
-		else
-		  {
-		      gaiaGetPoint (ring->Coords, iv, &x, &y);
-		  }
-		nx = (x * cosine) + (y * sine);
-		ny = (y * cosine) - (x * sine);
-		if (ring->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaSetPointXYZ (ring->Coords, iv, nx, ny, z);
-		  }
-		else if (ring->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaSetPointXYM (ring->Coords, iv, nx, ny, m);
-		  }
-		else if (ring->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaSetPointXYZM (ring->Coords, iv, nx, ny, z, m);
-		  }
-		else
-		  {
-		      gaiaSetPoint (ring->Coords, iv, nx, ny);
-		  }
-	    }
-	  for (ib = 0; ib < polyg->NumInteriors; ib++)
-	    {
-		/* rotating the INTERIOR RINGs */
-		ring = polyg->Interiors + ib;
-		for (iv = 0; iv < ring->Points; iv++)
-		  {
-		      if (ring->DimensionModel == GAIA_XY_Z)
-			{
-			    gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
-			}
-		      else if (ring->DimensionModel == GAIA_XY_M)
-			{
-			    gaiaGetPointXYM (ring->Coords, iv, &x, &y, &m);
-			}
-		      else if (ring->DimensionModel == GAIA_XY_Z_M)
-			{
-			    gaiaGetPointXYZM (ring->Coords, iv, &x, &y, &z, &m);
-			}
-		      else
-			{
-			    gaiaGetPoint (ring->Coords, iv, &x, &y);
-			}
-		      nx = (x * cosine) + (y * sine);
-		      ny = (y * cosine) - (x * sine);
-		      if (ring->DimensionModel == GAIA_XY_Z)
-			{
-			    gaiaSetPointXYZ (ring->Coords, iv, nx, ny, z);
-			}
-		      else if (ring->DimensionModel == GAIA_XY_M)
-			{
-			    gaiaSetPointXYM (ring->Coords, iv, nx, ny, m);
-			}
-		      else if (ring->DimensionModel == GAIA_XY_Z_M)
-			{
-			    gaiaSetPointXYZM (ring->Coords, iv, nx, ny, z, m);
-			}
-		      else
-			{
-			    gaiaSetPoint (ring->Coords, iv, nx, ny);
-			}
-		  }
-	    }
-	  polyg = polyg->Next;
-      }
-    gaiaMbrGeometry (geom);
-}
-
-GAIAGEO_DECLARE void
-gaiaReflectCoords (gaiaGeomCollPtr geom, int x_axis, int y_axis)
-{
-/* returns a geometry that is the old geometry with required reflection applied to coordinates */
-    int ib;
-    int iv;
-    double x;
-    double y;
-    double z = 0.0;
-    double m = 0.0;
-    gaiaPointPtr point;
-    gaiaPolygonPtr polyg;
-    gaiaLinestringPtr line;
-    gaiaRingPtr ring;
-    if (!geom)
-	return;
-    point = geom->FirstPoint;
-    while (point)
-      {
-	  /* reflecting POINTs */
-	  if (x_axis)
-	      point->X *= -1.0;
-	  if (y_axis)
-	      point->Y *= -1.0;
-	  point = point->Next;
-      }
-    line = geom->FirstLinestring;
-    while (line)
-      {
-	  /* reflecting LINESTRINGs */
-	  for (iv = 0; iv < line->Points; iv++)
-	    {
-		if (line->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaGetPointXYZ (line->Coords, iv, &x, &y, &z);
-		  }
-		else if (line->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaGetPointXYM (line->Coords, iv, &x, &y, &m);
-		  }
-		else if (line->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaGetPointXYZM (line->Coords, iv, &x, &y, &z, &m);
-		  }
-		else
-		  {
-		      gaiaGetPoint (line->Coords, iv, &x, &y);
-		  }
-		if (x_axis)
-		    x *= -1.0;
-		if (y_axis)
-		    y *= -1.0;
-		if (line->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaSetPointXYZ (line->Coords, iv, x, y, z);
-		  }
-		else if (line->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaSetPointXYM (line->Coords, iv, x, y, m);
+		      gaiaSetPointXYM (line->Coords, iv, x, y, m);
 		  }
 		else if (line->DimensionModel == GAIA_XY_Z_M)
 		  {
@@ -1320,11 +1151,11 @@ gaiaReflectCoords (gaiaGeomCollPtr geom, int x_axis, int y_axis)
     polyg = geom->FirstPolygon;
     while (polyg)
       {
-	  /* reflecting POLYGONs */
+	  /* swapping POLYGONs */
 	  ring = polyg->Exterior;
 	  for (iv = 0; iv < ring->Points; iv++)
 	    {
-		/* reflecting the EXTERIOR RING */
+		/* shifting the EXTERIOR RING */
 		if (ring->DimensionModel == GAIA_XY_Z)
 		  {
 		      gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
@@ -1341,10 +1172,9 @@ gaiaReflectCoords (gaiaGeomCollPtr geom, int x_axis, int y_axis)
 		  {
 		      gaiaGetPoint (ring->Coords, iv, &x, &y);
 		  }
-		if (x_axis)
-		    x *= -1.0;
-		if (y_axis)
-		    y *= -1.0;
+		sv = x;
+		x = y;
+		y = sv;
 		if (ring->DimensionModel == GAIA_XY_Z)
 		  {
 		      gaiaSetPointXYZ (ring->Coords, iv, x, y, z);
@@ -1364,7 +1194,7 @@ gaiaReflectCoords (gaiaGeomCollPtr geom, int x_axis, int y_axis)
 	    }
 	  for (ib = 0; ib < polyg->NumInteriors; ib++)
 	    {
-		/* reflecting the INTERIOR RINGs */
+		/* swapping the INTERIOR RINGs */
 		ring = polyg->Interiors + ib;
 		for (iv = 0; iv < ring->Points; iv++)
 		  {
@@ -1384,10 +1214,9 @@ gaiaReflectCoords (gaiaGeomCollPtr geom, int x_axis, int y_axis)
 			{
 			    gaiaGetPoint (ring->Coords, iv, &x, &y);
 			}
-		      if (x_axis)
-			  x *= -1.0;
-		      if (y_axis)
-			  y *= -1.0;
+		      sv = x;
+		      x = y;
+		      y = sv;
 		      if (ring->DimensionModel == GAIA_XY_Z)
 			{
 			    gaiaSetPointXYZ (ring->Coords, iv, x, y, z);
@@ -1411,212 +1240,121 @@ gaiaReflectCoords (gaiaGeomCollPtr geom, int x_axis, int y_axis)
     gaiaMbrGeometry (geom);
 }
 
-GAIAGEO_DECLARE void
-gaiaSwapCoords (gaiaGeomCollPtr geom)
+#ifndef OMIT_PROJ		/* including PROJ.4 */
+
+static int
+gaiaIsLongLat (char *str)
 {
-/* returns a geometry that is the old geometry with swapped x- and y-coordinates */
-    int ib;
+/* checks if we have to do with ANGLES if +proj=longlat is defined */
+    if (strstr (str, "+proj=longlat") != NULL)
+	return 1;
+    return 0;
+}
+
+GAIAGEO_DECLARE double
+gaiaRadsToDegs (double rads)
+{
+/* converts an ANGLE from radians to degrees */
+    return rads * RAD_TO_DEG;
+}
+
+GAIAGEO_DECLARE double
+gaiaDegsToRads (double degs)
+{
+/* converts an ANGLE from degrees to radians */
+    return degs * DEG_TO_RAD;
+}
+
+static void
+transform_gather (const double *coords, int dimension_model, int points,
+		  double *xx, double *yy, double *zz)
+{
+/* copying the vertices of a Linestring or Ring into the transform buffer */
     int iv;
-    double x;
-    double y;
-    double z;
+    int dims = 2;
+    int has_z = 0;
+    if (dimension_model == GAIA_XY_Z)
+      {
+	  dims = 3;
+	  has_z = 1;
+      }
+    else if (dimension_model == GAIA_XY_M)
+	dims = 3;
+    else if (dimension_model == GAIA_XY_Z_M)
+      {
+	  dims = 4;
+	  has_z = 1;
+      }
+    for (iv = 0; iv < points; iv++)
+      {
+	  xx[iv] = coords[iv * dims];
+	  yy[iv] = coords[iv * dims + 1];
+	  zz[iv] = has_z ? coords[iv * dims + 2] : 0.0;
+      }
+}
+
+static void
+transform_scatter (const double *src, int src_model, double *dst,
+		   int dst_model, int points, const double *xx,
+		   const double *yy, const double *zz)
+{
+/* copying reprojected vertices back into a Linestring or Ring */
+    int iv;
+    int src_dims = 2;
+    int m_pos = -1;
     double m;
-    double sv;
-    gaiaPointPtr point;
-    gaiaPolygonPtr polyg;
-    gaiaLinestringPtr line;
-    gaiaRingPtr ring;
-    if (!geom)
-	return;
-    point = geom->FirstPoint;
-    while (point)
+    if (src_model == GAIA_XY_Z)
+	src_dims = 3;
+    else if (src_model == GAIA_XY_M)
       {
-	  /* swapping POINTs */
-	  sv = point->X;
-	  point->X = point->Y;
-	  point->Y = sv;
-	  point = point->Next;
+	  src_dims = 3;
+	  m_pos = 2;
       }
-    line = geom->FirstLinestring;
-    while (line)
+    else if (src_model == GAIA_XY_Z_M)
       {
-	  /* swapping LINESTRINGs */
-	  for (iv = 0; iv < line->Points; iv++)
+	  src_dims = 4;
+	  m_pos = 3;
+      }
+    for (iv = 0; iv < points; iv++)
+      {
+	  m = (m_pos < 0) ? 0.0 : src[iv * src_dims + m_pos];
+	  if (dst_model == GAIA_XY_Z)
 	    {
-		if (line->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaGetPointXYZ (line->Coords, iv, &x, &y, &z);
-		  }
-		else if (line->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaGetPointXYM (line->Coords, iv, &x, &y, &m);
-		  }
-		else if (line->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaGetPointXYZM (line->Coords, iv, &x, &y, &z, &m);
-		  }
-		else
-		  {
-		      gaiaGetPoint (line->Coords, iv, &x, &y);
-		  }
-		sv = x;
-		x = y;
-		y = sv;
-		if (line->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaSetPointXYZ (line->Coords, iv, x, y, z);
-		  }
-		else if (line->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaSetPointXYM (line->Coords, iv, x, y, m);
-		  }
-		else if (line->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaSetPointXYZM (line->Coords, iv, x, y, z, m);
-		  }
-		else
-		  {
-		      gaiaSetPoint (line->Coords, iv, x, y);
-		  }
+		gaiaSetPointXYZ (dst, iv, xx[iv], yy[iv], zz[iv]);
 	    }
-	  line = line->Next;
-      }
-    polyg = geom->FirstPolygon;
-    while (polyg)
-      {
-	  /* swapping POLYGONs */
-	  ring = polyg->Exterior;
-	  for (iv = 0; iv < ring->Points; iv++)
+	  else if (dst_model == GAIA_XY_M)
 	    {
-		/* shifting the EXTERIOR RING */
-		if (ring->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
-		  }
-		else if (ring->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaGetPointXYM (ring->Coords, iv, &x, &y, &m);
-		  }
-		else if (ring->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaGetPointXYZM (ring->Coords, iv, &x, &y, &z, &m);
-		  }
-		else
-		  {
-		      gaiaGetPoint (ring->Coords, iv, &x, &y);
-		  }
-		sv = x;
-		x = y;
-		y = sv;
-		if (ring->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaSetPointXYZ (ring->Coords, iv, x, y, z);
-		  }
-		else if (ring->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaSetPointXYM (ring->Coords, iv, x, y, m);
-		  }
-		else if (ring->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaSetPointXYZM (ring->Coords, iv, x, y, z, m);
-		  }
-		else
-		  {
-		      gaiaSetPoint (ring->Coords, iv, x, y);
-		  }
+		gaiaSetPointXYM (dst, iv, xx[iv], yy[iv], m);
 	    }
-	  for (ib = 0; ib < polyg->NumInteriors; ib++)
+	  else if (dst_model == GAIA_XY_Z_M)
 	    {
-		/* swapping the INTERIOR RINGs */
-		ring = polyg->Interiors + ib;
-		for (iv = 0; iv < ring->Points; iv++)
-		  {
-		      if (ring->DimensionModel == GAIA_XY_Z)
-			{
-			    gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
-			}
-		      else if (ring->DimensionModel == GAIA_XY_M)
-			{
-			    gaiaGetPointXYM (ring->Coords, iv, &x, &y, &m);
-			}
-		      else if (ring->DimensionModel == GAIA_XY_Z_M)
-			{
-			    gaiaGetPointXYZM (ring->Coords, iv, &x, &y, &z, &m);
-			}
-		      else
-			{
-			    gaiaGetPoint (ring->Coords, iv, &x, &y);
-			}
-		      sv = x;
-		      x = y;
-		      y = sv;
-		      if (ring->DimensionModel == GAIA_XY_Z)
-			{
-			    gaiaSetPointXYZ (ring->Coords, iv, x, y, z);
-			}
-		      else if (ring->DimensionModel == GAIA_XY_M)
-			{
-			    gaiaSetPointXYM (ring->Coords, iv, x, y, m);
-			}
-		      else if (ring->DimensionModel == GAIA_XY_Z_M)
-			{
-			    gaiaSetPointXYZM (ring->Coords, iv, x, y, z, m);
-			}
-		      else
-			{
-			    gaiaSetPoint (ring->Coords, iv, x, y);
-			}
-		  }
+		gaiaSetPointXYZM (dst, iv, xx[iv], yy[iv], zz[iv], m);
+	    }
+	  else
+	    {
+		gaiaSetPoint (dst, iv, xx[iv], yy[iv]);
 	    }
-	  polyg = polyg->Next;
       }
-    gaiaMbrGeometry (geom);
-}
-
-#ifndef OMIT_PROJ		/* including PROJ.4 */
-
-static int
-gaiaIsLongLat (char *str)
-{
-/* checks if we have to do with ANGLES if +proj=longlat is defined */
-    if (strstr (str, "+proj=longlat") != NULL)
-	return 1;
-    return 0;
-}
-
-GAIAGEO_DECLARE double
-gaiaRadsToDegs (double rads)
-{
-/* converts an ANGLE from radians to degrees */
-    return rads * RAD_TO_DEG;
-}
-
-GAIAGEO_DECLARE double
-gaiaDegsToRads (double degs)
-{
-/* converts an ANGLE from degrees to radians */
-    return degs * DEG_TO_RAD;
 }
 
 static gaiaGeomCollPtr
-gaiaTransformCommon (projCtx handle, gaiaGeomCollPtr org, char *proj_from,
-		     char *proj_to)
+gaiaTransformProj (gaiaGeomCollPtr org, projPJ from_cs, projPJ to_cs,
+		   int from_angle, int to_angle)
 {
-/* creates a new GEOMETRY reprojecting coordinates from the original one */
+/*
+/ creates a new GEOMETRY reprojecting coordinates from the original one;
+/ all vertices are gathered into a single X/Y/Z buffer, so that the whole
+/ Geometry is reprojected by a single pj_transform() call
+*/
     int ib;
-    int cnt;
     int i;
+    int cnt = 0;
+    int pos;
+    int has_z = 0;
+    double *buf;
     double *xx;
     double *yy;
     double *zz;
-    double *mm = NULL;
-    double x;
-    double y;
-    double z = 0.0;
-    double m = 0.0;
-    int error = 0;
-    int from_angle;
-    int to_angle;
     gaiaPointPtr pt;
     gaiaLinestringPtr ln;
     gaiaLinestringPtr dst_ln;
@@ -1624,30 +1362,7 @@ gaiaTransformCommon (projCtx handle, gaiaGeomCollPtr org, char *proj_from,
     gaiaPolygonPtr dst_pg;
     gaiaRingPtr rng;
     gaiaRingPtr dst_rng;
-    projPJ from_cs;
-    projPJ to_cs;
     gaiaGeomCollPtr dst;
-    if (handle != NULL)
-      {
-	  from_cs = pj_init_plus_ctx (handle, proj_from);
-	  to_cs = pj_init_plus_ctx (handle, proj_to);
-      }
-    else
-      {
-	  from_cs = pj_init_plus (proj_from);
-	  to_cs = pj_init_plus (proj_to);
-      }
-    if (!from_cs)
-      {
-	  if (to_cs)
-	      pj_free (to_cs);
-	  return NULL;
-      }
-    if (!to_cs)
-      {
-	  pj_free (from_cs);
-	  return NULL;
-      }
     if (org->DimensionModel == GAIA_XY_Z)
 	dst = gaiaAllocGeomCollXYZ ();
     else if (org->DimensionModel == GAIA_XY_M)
@@ -1656,468 +1371,183 @@ gaiaTransformCommon (projCtx handle, gaiaGeomCollPtr org, char *proj_from,
 	dst = gaiaAllocGeomCollXYZM ();
     else
 	dst = gaiaAllocGeomColl ();
-/* setting up projection parameters */
-    from_angle = gaiaIsLongLat (proj_from);
-    to_angle = gaiaIsLongLat (proj_to);
-    cnt = 0;
+    if (org->DimensionModel == GAIA_XY_Z
+	|| org->DimensionModel == GAIA_XY_Z_M)
+	has_z = 1;
+
+/* counting all vertices */
     pt = org->FirstPoint;
     while (pt)
       {
-	  /* counting POINTs */
 	  cnt++;
 	  pt = pt->Next;
       }
-    if (cnt)
-      {
-	  /* reprojecting POINTs */
-	  xx = malloc (sizeof (double) * cnt);
-	  yy = malloc (sizeof (double) * cnt);
-	  zz = malloc (sizeof (double) * cnt);
-	  if (org->DimensionModel == GAIA_XY_M
-	      || org->DimensionModel == GAIA_XY_Z_M)
-	      mm = malloc (sizeof (double) * cnt);
-	  i = 0;
-	  pt = org->FirstPoint;
-	  while (pt)
-	    {
-		/* inserting points to be converted in temporary arrays */
-		if (from_angle)
-		  {
-		      xx[i] = gaiaDegsToRads (pt->X);
-		      yy[i] = gaiaDegsToRads (pt->Y);
-		  }
-		else
-		  {
-		      xx[i] = pt->X;
-		      yy[i] = pt->Y;
-		  }
-		if (org->DimensionModel == GAIA_XY_Z
-		    || org->DimensionModel == GAIA_XY_Z_M)
-		    zz[i] = pt->Z;
-		else
-		    zz[i] = 0.0;
-		if (org->DimensionModel == GAIA_XY_M
-		    || org->DimensionModel == GAIA_XY_Z_M)
-		    mm[i] = pt->M;
-		i++;
-		pt = pt->Next;
-	    }
-	  /* applying reprojection        */
-	  if (pj_transform (from_cs, to_cs, cnt, 0, xx, yy, zz) == 0)
-	    {
-		/* inserting the reprojected POINTs in the new GEOMETRY */
-		for (i = 0; i < cnt; i++)
-		  {
-		      if (to_angle)
-			{
-			    x = gaiaRadsToDegs (xx[i]);
-			    y = gaiaRadsToDegs (yy[i]);
-			}
-		      else
-			{
-			    x = xx[i];
-			    y = yy[i];
-			}
-		      if (org->DimensionModel == GAIA_XY_Z
-			  || org->DimensionModel == GAIA_XY_Z_M)
-			  z = zz[i];
-		      else
-			  z = 0.0;
-		      if (org->DimensionModel == GAIA_XY_M
-			  || org->DimensionModel == GAIA_XY_Z_M)
-			  m = mm[i];
-		      else
-			  m = 0.0;
-		      if (dst->DimensionModel == GAIA_XY_Z)
-			  gaiaAddPointToGeomCollXYZ (dst, x, y, z);
-		      else if (dst->DimensionModel == GAIA_XY_M)
-			  gaiaAddPointToGeomCollXYM (dst, x, y, m);
-		      else if (dst->DimensionModel == GAIA_XY_Z_M)
-			  gaiaAddPointToGeomCollXYZM (dst, x, y, z, m);
-		      else
-			  gaiaAddPointToGeomColl (dst, x, y);
-		  }
-	    }
-	  else
-	      error = 1;
-	  free (xx);
-	  free (yy);
-	  free (zz);
-	  if (org->DimensionModel == GAIA_XY_M
-	      || org->DimensionModel == GAIA_XY_Z_M)
-	      free (mm);
-      }
-    if (error)
+    ln = org->FirstLinestring;
+    while (ln)
+      {
+	  cnt += ln->Points;
+	  ln = ln->Next;
+      }
+    pg = org->FirstPolygon;
+    while (pg)
+      {
+	  cnt += pg->Exterior->Points;
+	  for (ib = 0; ib < pg->NumInteriors; ib++)
+	      cnt += (pg->Interiors + ib)->Points;
+	  pg = pg->Next;
+      }
+    if (cnt == 0)
 	goto stop;
+
+/* gathering all vertices into the transform buffer */
+    buf = malloc (sizeof (double) * cnt * 3);
+    xx = buf;
+    yy = buf + cnt;
+    zz = buf + (cnt * 2);
+    pos = 0;
+    pt = org->FirstPoint;
+    while (pt)
+      {
+	  xx[pos] = pt->X;
+	  yy[pos] = pt->Y;
+	  zz[pos] = has_z ? pt->Z : 0.0;
+	  pos++;
+	  pt = pt->Next;
+      }
     ln = org->FirstLinestring;
     while (ln)
       {
-	  /* reprojecting LINESTRINGs */
-	  cnt = ln->Points;
-	  xx = malloc (sizeof (double) * cnt);
-	  yy = malloc (sizeof (double) * cnt);
-	  zz = malloc (sizeof (double) * cnt);
-	  if (ln->DimensionModel == GAIA_XY_M
-	      || ln->DimensionModel == GAIA_XY_Z_M)
-	      mm = malloc (sizeof (double) * cnt);
-	  for (i = 0; i < cnt; i++)
-	    {
-		/* inserting points to be converted in temporary arrays */
-		if (ln->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaGetPointXYZ (ln->Coords, i, &x, &y, &z);
-		  }
-		else if (ln->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaGetPointXYM (ln->Coords, i, &x, &y, &m);
-		  }
-		else if (ln->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaGetPointXYZM (ln->Coords, i, &x, &y, &z, &m);
-		  }
-		else
-		  {
-		      gaiaGetPoint (ln->Coords, i, &x, &y);
-		  }
-		if (from_angle)
-		  {
-		      xx[i] = gaiaDegsToRads (x);
-		      yy[i] = gaiaDegsToRads (y);
-		  }
-		else
-		  {
-		      xx[i] = x;
-		      yy[i] = y;
-		  }
-		if (ln->DimensionModel == GAIA_XY_Z
-		    || ln->DimensionModel == GAIA_XY_Z_M)
-		    zz[i] = z;
-		else
-		    zz[i] = 0.0;
-		if (ln->DimensionModel == GAIA_XY_M
-		    || ln->DimensionModel == GAIA_XY_Z_M)
-		    mm[i] = m;
-	    }
-	  /* applying reprojection        */
-	  if (pj_transform (from_cs, to_cs, cnt, 0, xx, yy, zz) == 0)
-	    {
-		/* inserting the reprojected LINESTRING in the new GEOMETRY */
-		dst_ln = gaiaAddLinestringToGeomColl (dst, cnt);
-		for (i = 0; i < cnt; i++)
-		  {
-		      /* setting LINESTRING points */
-		      if (to_angle)
-			{
-			    x = gaiaRadsToDegs (xx[i]);
-			    y = gaiaRadsToDegs (yy[i]);
-			}
-		      else
-			{
-			    x = xx[i];
-			    y = yy[i];
-			}
-		      if (ln->DimensionModel == GAIA_XY_Z
-			  || ln->DimensionModel == GAIA_XY_Z_M)
-			  z = zz[i];
-		      else
-			  z = 0.0;
-		      if (ln->DimensionModel == GAIA_XY_M
-			  || ln->DimensionModel == GAIA_XY_Z_M)
-			  m = mm[i];
-		      else
-			  m = 0.0;
-		      if (dst_ln->DimensionModel == GAIA_XY_Z)
-			{
-			    gaiaSetPointXYZ (dst_ln->Coords, i, x, y, z);
-			}
-		      else if (dst_ln->DimensionModel == GAIA_XY_M)
-			{
-			    gaiaSetPointXYM (dst_ln->Coords, i, x, y, m);
-			}
-		      else if (dst_ln->DimensionModel == GAIA_XY_Z_M)
-			{
-			    gaiaSetPointXYZM (dst_ln->Coords, i, x, y, z, m);
-			}
-		      else
-			{
-			    gaiaSetPoint (dst_ln->Coords, i, x, y);
-			}
-		  }
-	    }
-	  else
-	      error = 1;
-	  free (xx);
-	  free (yy);
-	  free (zz);
-	  if (ln->DimensionModel == GAIA_XY_M
-	      || ln->DimensionModel == GAIA_XY_Z_M)
-	      free (mm);
-	  if (error)
-	      goto stop;
+	  transform_gather (ln->Coords, ln->DimensionModel, ln->Points,
+			    xx + pos, yy + pos, zz + pos);
+	  pos += ln->Points;
 	  ln = ln->Next;
       }
     pg = org->FirstPolygon;
     while (pg)
       {
-	  /* reprojecting POLYGONs */
 	  rng = pg->Exterior;
-	  cnt = rng->Points;
-	  dst_pg = gaiaAddPolygonToGeomColl (dst, cnt, pg->NumInteriors);
-	  xx = malloc (sizeof (double) * cnt);
-	  yy = malloc (sizeof (double) * cnt);
-	  zz = malloc (sizeof (double) * cnt);
-	  if (rng->DimensionModel == GAIA_XY_M
-	      || rng->DimensionModel == GAIA_XY_Z_M)
-	      mm = malloc (sizeof (double) * cnt);
-	  for (i = 0; i < cnt; i++)
-	    {
-		/* inserting points to be converted in temporary arrays [EXTERIOR RING] */
-		if (rng->DimensionModel == GAIA_XY_Z)
-		  {
-		      gaiaGetPointXYZ (rng->Coords, i, &x, &y, &z);
-		  }
-		else if (rng->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaGetPointXYM (rng->Coords, i, &x, &y, &m);
-		  }
-		else if (rng->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      gaiaGetPointXYZM (rng->Coords, i, &x, &y, &z, &m);
-		  }
-		else
-		  {
-		      gaiaGetPoint (rng->Coords, i, &x, &y);
-		  }
-		if (from_angle)
-		  {
-		      xx[i] = gaiaDegsToRads (x);
-		      yy[i] = gaiaDegsToRads (y);
-		  }
-		else
-		  {
-		      xx[i] = x;
-		      yy[i] = y;
-		  }
-		if (rng->DimensionModel == GAIA_XY_Z
-		    || rng->DimensionModel == GAIA_XY_Z_M)
-		    zz[i] = z;
-		else
-		    zz[i] = 0.0;
-		if (rng->DimensionModel == GAIA_XY_M
-		    || rng->DimensionModel == GAIA_XY_Z_M)
-		    mm[i] = m;
-	    }
-	  /* applying reprojection        */
-	  if (pj_transform (from_cs, to_cs, cnt, 0, xx, yy, zz) == 0)
+	  transform_gather (rng->Coords, rng->DimensionModel, rng->Points,
+			    xx + pos, yy + pos, zz + pos);
+	  pos += rng->Points;
+	  for (ib = 0; ib < pg->NumInteriors; ib++)
 	    {
-		/* inserting the reprojected POLYGON in the new GEOMETRY */
-		dst_rng = dst_pg->Exterior;
-		for (i = 0; i < cnt; i++)
-		  {
-		      /* setting EXTERIOR RING points */
-		      if (to_angle)
-			{
-			    x = gaiaRadsToDegs (xx[i]);
-			    y = gaiaRadsToDegs (yy[i]);
-			}
-		      else
-			{
-			    x = xx[i];
-			    y = yy[i];
-			}
-		      if (rng->DimensionModel == GAIA_XY_Z
-			  || rng->DimensionModel == GAIA_XY_Z_M)
-			  z = zz[i];
-		      else
-			  z = 0.0;
-		      if (rng->DimensionModel == GAIA_XY_M
-			  || rng->DimensionModel == GAIA_XY_Z_M)
-			  m = mm[i];
-		      else
-			  m = 0.0;
-		      if (dst_rng->DimensionModel == GAIA_XY_Z)
-			{
-			    gaiaSetPointXYZ (dst_rng->Coords, i, x, y, z);
-			}
-		      else if (dst_rng->DimensionModel == GAIA_XY_M)
-			{
-			    gaiaSetPointXYM (dst_rng->Coords, i, x, y, m);
-			}
-		      else if (dst_rng->DimensionModel == GAIA_XY_Z_M)
-			{
-			    gaiaSetPointXYZM (dst_rng->Coords, i, x, y, z, m);
-			}
-		      else
-			{
-			    gaiaSetPoint (dst_rng->Coords, i, x, y);
-			}
-		  }
+		rng = pg->Interiors + ib;
+		transform_gather (rng->Coords, rng->DimensionModel,
+				  rng->Points, xx + pos, yy + pos, zz + pos);
+		pos += rng->Points;
 	    }
+	  pg = pg->Next;
+      }
+
+/* applying reprojection (X and Y are contiguous in the buffer) */
+    if (from_angle)
+      {
+	  for (i = 0; i < cnt * 2; i++)
+	      buf[i] *= DEG_TO_RAD;
+      }
+    if (pj_transform (from_cs, to_cs, cnt, 1, xx, yy, zz) != 0)
+      {
+	  /* some error occurred: returning an empty Geometry */
+	  free (buf);
+	  goto stop;
+      }
+    if (to_angle)
+      {
+	  for (i = 0; i < cnt * 2; i++)
+	      buf[i] *= RAD_TO_DEG;
+      }
+
+/* inserting the reprojected vertices into the new GEOMETRY */
+    pos = 0;
+    pt = org->FirstPoint;
+    while (pt)
+      {
+	  if (dst->DimensionModel == GAIA_XY_Z)
+	      gaiaAddPointToGeomCollXYZ (dst, xx[pos], yy[pos], zz[pos]);
+	  else if (dst->DimensionModel == GAIA_XY_M)
+	      gaiaAddPointToGeomCollXYM (dst, xx[pos], yy[pos], pt->M);
+	  else if (dst->DimensionModel == GAIA_XY_Z_M)
+	      gaiaAddPointToGeomCollXYZM (dst, xx[pos], yy[pos], zz[pos],
+					  pt->M);
 	  else
-	      error = 1;
-	  free (xx);
-	  free (yy);
-	  free (zz);
-	  if (rng->DimensionModel == GAIA_XY_M
-	      || rng->DimensionModel == GAIA_XY_Z_M)
-	      free (mm);
-	  if (error)
-	      goto stop;
+	      gaiaAddPointToGeomColl (dst, xx[pos], yy[pos]);
+	  pos++;
+	  pt = pt->Next;
+      }
+    ln = org->FirstLinestring;
+    while (ln)
+      {
+	  dst_ln = gaiaAddLinestringToGeomColl (dst, ln->Points);
+	  transform_scatter (ln->Coords, ln->DimensionModel, dst_ln->Coords,
+			     dst_ln->DimensionModel, ln->Points, xx + pos,
+			     yy + pos, zz + pos);
+	  pos += ln->Points;
+	  ln = ln->Next;
+      }
+    pg = org->FirstPolygon;
+    while (pg)
+      {
+	  rng = pg->Exterior;
+	  dst_pg = gaiaAddPolygonToGeomColl (dst, rng->Points, pg->NumInteriors);
+	  dst_rng = dst_pg->Exterior;
+	  transform_scatter (rng->Coords, rng->DimensionModel, dst_rng->Coords,
+			     dst_rng->DimensionModel, rng->Points, xx + pos,
+			     yy + pos, zz + pos);
+	  pos += rng->Points;
 	  for (ib = 0; ib < pg->NumInteriors; ib++)
 	    {
-		/* processing INTERIOR RINGS */
 		rng = pg->Interiors + ib;
-		cnt = rng->Points;
-		xx = malloc (sizeof (double) * cnt);
-		yy = malloc (sizeof (double) * cnt);
-		zz = malloc (sizeof (double) * cnt);
-		if (rng->DimensionModel == GAIA_XY_M
-		    || rng->DimensionModel == GAIA_XY_Z_M)
-		    mm = malloc (sizeof (double) * cnt);
-		for (i = 0; i < cnt; i++)
-		  {
-		      /* inserting points to be converted in temporary arrays [INTERIOR RING] */
-		      if (rng->DimensionModel == GAIA_XY_Z)
-			{
-			    gaiaGetPointXYZ (rng->Coords, i, &x, &y, &z);
-			}
-		      else if (rng->DimensionModel == GAIA_XY_M)
-			{
-			    gaiaGetPointXYM (rng->Coords, i, &x, &y, &m);
-			}
-		      else if (rng->DimensionModel == GAIA_XY_Z_M)
-			{
-			    gaiaGetPointXYZM (rng->Coords, i, &x, &y, &z, &m);
-			}
-		      else
-			{
-			    gaiaGetPoint (rng->Coords, i, &x, &y);
-			}
-		      if (from_angle)
-			{
-			    xx[i] = gaiaDegsToRads (x);
-			    yy[i] = gaiaDegsToRads (y);
-			}
-		      else
-			{
-			    xx[i] = x;
-			    yy[i] = y;
-			}
-		      if (rng->DimensionModel == GAIA_XY_Z
-			  || rng->DimensionModel == GAIA_XY_Z_M)
-			  zz[i] = z;
-		      else
-			  zz[i] = 0.0;
-		      if (rng->DimensionModel == GAIA_XY_M
-			  || rng->DimensionModel == GAIA_XY_Z_M)
-			  mm[i] = m;
-		  }
-		/* applying reprojection        */
-		if (pj_transform (from_cs, to_cs, cnt, 0, xx, yy, zz) == 0)
-		  {
-		      /* inserting the reprojected POLYGON in the new GEOMETRY */
-		      dst_rng = gaiaAddInteriorRing (dst_pg, ib, cnt);
-		      for (i = 0; i < cnt; i++)
-			{
-			    /* setting INTERIOR RING points */
-			    if (to_angle)
-			      {
-				  x = gaiaRadsToDegs (xx[i]);
-				  y = gaiaRadsToDegs (yy[i]);
-			      }
-			    else
-			      {
-				  x = xx[i];
-				  y = yy[i];
-			      }
-			    if (rng->DimensionModel == GAIA_XY_Z
-				|| rng->DimensionModel == GAIA_XY_Z_M)
-				z = zz[i];
-			    else
-				z = 0.0;
-			    if (rng->DimensionModel == GAIA_XY_M
-				|| rng->DimensionModel == GAIA_XY_Z_M)
-				m = mm[i];
-			    else
-				m = 0.0;
-			    if (dst_rng->DimensionModel == GAIA_XY_Z)
-			      {
-				  gaiaSetPointXYZ (dst_rng->Coords, i, x, y, z);
-			      }
-			    else if (dst_rng->DimensionModel == GAIA_XY_M)
-			      {
-				  gaiaSetPointXYM (dst_rng->Coords, i, x, y, m);
-			      }
-			    else if (dst_rng->DimensionModel == GAIA_XY_Z_M)
-			      {
-				  gaiaSetPointXYZM (dst_rng->Coords, i, x, y, z,
-						    m);
-			      }
-			    else
-			      {
-				  gaiaSetPoint (dst_rng->Coords, i, x, y);
-			      }
-			}
-		  }
-		else
-		    error = 1;
-		free (xx);
-		free (yy);
-		free (zz);
-		if (rng->DimensionModel == GAIA_XY_M
-		    || rng->DimensionModel == GAIA_XY_Z_M)
-		    free (mm);
-		if (error)
-		    goto stop;
+		dst_rng = gaiaAddInteriorRing (dst_pg, ib, rng->Points);
+		transform_scatter (rng->Coords, rng->DimensionModel,
+				   dst_rng->Coords, dst_rng->DimensionModel,
+				   rng->Points, xx + pos, yy + pos, zz + pos);
+		pos += rng->Points;
 	    }
 	  pg = pg->Next;
       }
-/* destroying the PROJ4 params */
+    free (buf);
+
   stop:
-    pj_free (from_cs);
-    pj_free (to_cs);
-    if (error)
-      {
-	  /* some error occurred */
-	  gaiaPointPtr pP;
-	  gaiaPointPtr pPn;
-	  gaiaLinestringPtr pL;
-	  gaiaLinestringPtr pLn;
-	  gaiaPolygonPtr pA;
-	  gaiaPolygonPtr pAn;
-	  pP = dst->FirstPoint;
-	  while (pP != NULL)
-	    {
-		pPn = pP->Next;
-		gaiaFreePoint (pP);
-		pP = pPn;
-	    }
-	  pL = dst->FirstLinestring;
-	  while (pL != NULL)
-	    {
-		pLn = pL->Next;
-		gaiaFreeLinestring (pL);
-		pL = pLn;
-	    }
-	  pA = dst->FirstPolygon;
-	  while (pA != NULL)
-	    {
-		pAn = pA->Next;
-		gaiaFreePolygon (pA);
-		pA = pAn;
-	    }
-	  dst->FirstPoint = NULL;
-	  dst->LastPoint = NULL;
-	  dst->FirstLinestring = NULL;
-	  dst->LastLinestring = NULL;
-	  dst->FirstPolygon = NULL;
-	  dst->LastPolygon = NULL;
+    gaiaMbrGeometry (dst);
+    dst->DeclaredType = org->DeclaredType;
+    return dst;
+}
+
+static gaiaGeomCollPtr
+gaiaTransformCommon (projCtx handle, gaiaGeomCollPtr org, char *proj_from,
+		     char *proj_to)
+{
+/* creates a new GEOMETRY reprojecting coordinates from the original one */
+    projPJ from_cs;
+    projPJ to_cs;
+    gaiaGeomCollPtr dst;
+    if (handle != NULL)
+      {
+	  from_cs = pj_init_plus_ctx (handle, proj_from);
+	  to_cs = pj_init_plus_ctx (handle, proj_to);
+      }
+    else
+      {
+	  from_cs = pj_init_plus (proj_from);
+	  to_cs = pj_init_plus (proj_to);
+      }
+    if (!from_cs)
+      {
+	  if (to_cs)
+	      pj_free (to_cs);
+	  return NULL;
       }
-    if (dst)
+    if (!to_cs)
       {
-	  gaiaMbrGeometry (dst);
-	  dst->DeclaredType = org->DeclaredType;
+	  pj_free (from_cs);
+	  return NULL;
       }
+    dst =
+	gaiaTransformProj (org, from_cs, to_cs, gaiaIsLongLat (proj_from),
+			   gaiaIsLongLat (proj_to));
+/* destroying the PROJ4 params */
+    pj_free (from_cs);
+    pj_free (to_cs);
     return dst;
 }
 
@@ -2145,4 +1575,242 @@ gaiaTransform_r (const void *p_cache, gaiaGeomCollPtr org, char *proj_from,
     return gaiaTransformCommon (handle, org, proj_from, proj_to);
 }
 
+
+SPATIALITE_PRIVATE void
+splite_free_proj_cache_item (struct splite_proj_cache_item *p)
+{
+/* freeing a PROJ.4 cache item */
+    if (p->from_cs != NULL)
+	pj_free (p->from_cs);
+    if (p->to_cs != NULL)
+	pj_free (p->to_cs);
+    if (p->proj_from != NULL)
+	free (p->proj_from);
+    if (p->proj_to != NULL)
+	free (p->proj_to);
+    p->srid_from = -1;
+    p->srid_to = -1;
+    p->gpkg_amphibious = 0;
+    p->proj_from = NULL;
+    p->proj_to = NULL;
+    p->from_cs = NULL;
+    p->to_cs = NULL;
+    p->last_used = 0;
+    p->generation = 0;
+    p->serial = 0;
+}
+
+SPATIALITE_PRIVATE void
+splite_reset_proj_cache (const void *p_cache)
+{
+/* discarding all PROJ.4 cache items and resetting the statistics */
+    int i;
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) p_cache;
+    if (cache == NULL)
+	return;
+    for (i = 0; i < MAX_PROJ_CACHE; i++)
+	splite_free_proj_cache_item (&(cache->projCache[i]));
+    for (i = 0; i < MAX_APPROX_CACHE; i++)
+      {
+	  cache->approxCache[i].pair_serial = 0;
+	  cache->approxCache[i].last_used = 0;
+      }
+    cache->projCacheClock = 0;
+    cache->projCacheHits = 0;
+    cache->projCacheMisses = 0;
+}
+
+SPATIALITE_PRIVATE struct splite_proj_cache_item *
+splite_find_proj_cache_item (const void *p_cache, int srid_from, int srid_to,
+			     int gpkg_amphibious)
+{
+/* searching the PROJ.4 cache for some SRID pair [LRU] */
+    int i;
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) p_cache;
+    if (cache == NULL)
+	return NULL;
+    for (i = 0; i < MAX_PROJ_CACHE; i++)
+      {
+	  struct splite_proj_cache_item *p = &(cache->projCache[i]);
+	  if (p->from_cs == NULL)
+	      continue;
+	  if (p->srid_from == srid_from && p->srid_to == srid_to
+	      && p->gpkg_amphibious == gpkg_amphibious)
+	    {
+		cache->projCacheClock += 1;
+		p->last_used = cache->projCacheClock;
+		return p;
+	    }
+      }
+    return NULL;
+}
+
+SPATIALITE_PRIVATE struct splite_proj_cache_item *
+splite_store_proj_cache_item (const void *p_cache, int srid_from,
+			      int srid_to, int gpkg_amphibious,
+			      const char *proj_from, const char *proj_to,
+			      unsigned int generation)
+{
+/* 
+/ initializing a PROJ.4 pair and storing it into the cache,
+/ evicting the least recently used item when the cache is full
+*/
+    int i;
+    int len;
+    projPJ from_cs;
+    projPJ to_cs;
+    struct splite_proj_cache_item *p = NULL;
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) p_cache;
+    if (cache == NULL)
+	return NULL;
+    if (cache->PROJ_handle == NULL)
+	return NULL;
+    from_cs = pj_init_plus_ctx (cache->PROJ_handle, proj_from);
+    to_cs = pj_init_plus_ctx (cache->PROJ_handle, proj_to);
+    if (!from_cs || !to_cs)
+      {
+	  if (from_cs)
+	      pj_free (from_cs);
+	  if (to_cs)
+	      pj_free (to_cs);
+	  return NULL;
+      }
+    for (i = 0; i < MAX_PROJ_CACHE; i++)
+      {
+	  /* searching the same SRID pair, a free slot or the LRU item */
+	  struct splite_proj_cache_item *pc = &(cache->projCache[i]);
+	  if (pc->srid_from == srid_from && pc->srid_to == srid_to
+	      && pc->gpkg_amphibious == gpkg_amphibious)
+	    {
+		p = pc;
+		break;
+	    }
+	  if (p == NULL)
+	      p = pc;
+	  else if (p->from_cs != NULL
+		   && (pc->from_cs == NULL || pc->last_used < p->last_used))
+	      p = pc;
+      }
+    splite_free_proj_cache_item (p);
+    p->srid_from = srid_from;
+    p->srid_to = srid_to;
+    p->gpkg_amphibious = gpkg_amphibious;
+    len = strlen (proj_from);
+    p->proj_from = malloc (len + 1);
+    strcpy (p->proj_from, proj_from);
+    len = strlen (proj_to);
+    p->proj_to = malloc (len + 1);
+    strcpy (p->proj_to, proj_to);
+    p->from_cs = from_cs;
+    p->to_cs = to_cs;
+    p->from_angle = gaiaIsLongLat ((char *) proj_from);
+    p->to_angle = gaiaIsLongLat ((char *) proj_to);
+    p->generation = generation;
+    cache->projCacheClock += 1;
+    p->last_used = cache->projCacheClock;
+/* any approximation fitted on a previous pair will never match again */
+    p->serial = cache->projCacheClock;
+    return p;
+}
+
+SPATIALITE_PRIVATE void *
+splite_transform_proj_cache_item (struct splite_proj_cache_item *p,
+				  const void *org)
+{
+/* reprojecting a Geometry by using a cached PROJ.4 pair */
+    if (p == NULL || p->from_cs == NULL || p->to_cs == NULL)
+	return NULL;
+    return gaiaTransformProj ((gaiaGeomCollPtr) org, p->from_cs, p->to_cs,
+			      p->from_angle, p->to_angle);
+}
+
+SPATIALITE_PRIVATE struct splite_approx_cache_item *
+splite_find_approx_cache_item (const void *p_cache, unsigned int pair_serial,
+			       double max_error, double minx, double miny,
+			       double maxx, double maxy, double cell_minx,
+			       double cell_miny, double cell_size)
+{
+/* 
+/ searching the approximations cache for a tile covering some BBOX
+/
+/ a fitted tile is returned whatever its size; a tile known to be
+/ not approximable is only returned if it's exactly the requested one
+*/
+    int i;
+    struct splite_approx_cache_item *found = NULL;
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) p_cache;
+    if (cache == NULL)
+	return NULL;
+    for (i = 0; i < MAX_APPROX_CACHE; i++)
+      {
+	  struct splite_approx_cache_item *p = &(cache->approxCache[i]);
+	  if (p->pair_serial == 0 || p->pair_serial != pair_serial
+	      || p->max_error != max_error)
+	      continue;
+	  if (p->order > 0)
+	    {
+		if (minx >= p->minx && maxx <= p->minx + p->size
+		    && miny >= p->miny && maxy <= p->miny + p->size)
+		  {
+		      found = p;
+		      break;
+		  }
+	    }
+	  else if (p->minx == cell_minx && p->miny == cell_miny
+		   && p->size == cell_size)
+	      found = p;
+      }
+    if (found != NULL)
+      {
+	  cache->projCacheClock += 1;
+	  found->last_used = cache->projCacheClock;
+      }
+    return found;
+}
+
+SPATIALITE_PRIVATE struct splite_approx_cache_item *
+splite_store_approx_cache_item (const void *p_cache, unsigned int pair_serial,
+				double max_error, double cell_minx,
+				double cell_miny, double cell_size)
+{
+/* 
+/ storing a tile into the approximations cache, evicting the least
+/ recently used item when the cache is full
+/ the tile is initially marked as not approximable
+*/
+    int i;
+    struct splite_approx_cache_item *p = NULL;
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) p_cache;
+    if (cache == NULL)
+	return NULL;
+    for (i = 0; i < MAX_APPROX_CACHE; i++)
+      {
+	  struct splite_approx_cache_item *pc = &(cache->approxCache[i]);
+	  if (pc->pair_serial == 0)
+	    {
+		p = pc;
+		break;
+	    }
+	  if (p == NULL || pc->last_used < p->last_used)
+	      p = pc;
+      }
+    p->pair_serial = pair_serial;
+    p->max_error = max_error;
+    p->minx = cell_minx;
+    p->miny = cell_miny;
+    p->size = cell_size;
+    p->order = 0;
+    p->x0 = cell_minx + (cell_size / 2.0);
+    p->y0 = cell_miny + (cell_size / 2.0);
+    p->scale = cell_size / 2.0;
+    cache->projCacheClock += 1;
+    p->last_used = cache->projCacheClock;
+    return p;
+}
+
 #endif /* end including PROJ.4 */
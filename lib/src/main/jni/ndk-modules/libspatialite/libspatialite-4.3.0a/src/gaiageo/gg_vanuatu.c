@@ -57,6 +57,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include "config.h"
 #endif
 
+#include <spatialite_private.h>
 #include <spatialite/sqlite.h>
 #include <spatialite/debug.h>
 
@@ -1856,9 +1857,10 @@ vanuatu_cleanup (vanuatuFlexToken * token)
     return 0;
 }
 
-gaiaGeomCollPtr
-gaiaParseWkt (const unsigned char *dirty_buffer, short type)
+static gaiaGeomCollPtr
+vanuatuParseWkt (const unsigned char *dirty_buffer, short type)
 {
+/* the full Flex/Lemon based WKT parser */
     void *pParser = ParseAlloc (malloc);
     /* Linked-list of token values */
     vanuatuFlexToken *tokens = malloc (sizeof (vanuatuFlexToken));
@@ -1959,6 +1961,31 @@ gaiaParseWkt (const unsigned char *dirty_buffer, short type)
     return str_data.result;
 }
 
+gaiaGeomCollPtr
+gaiaParseWkt (const unsigned char *dirty_buffer, short type)
+{
+    gaiaGeomCollPtr geom;
+
+/* attempting first to use the single-pass parser */
+    geom = gaiaFastParseWkt (dirty_buffer, 0);
+    if (geom == NULL)
+	return vanuatuParseWkt (dirty_buffer, type);
+
+    if (!vanuatuCheckValidity (geom))
+      {
+	  gaiaFreeGeomColl (geom);
+	  return NULL;
+      }
+    if (type >= 0 && geom->DeclaredType != type)
+      {
+	  /* invalid CLASS TYPE for request */
+	  gaiaFreeGeomColl (geom);
+	  return NULL;
+      }
+    gaiaMbrGeometry (geom);
+    return geom;
+}
+
 /******************************************************************************
 ** This is the end of the code that was created by Team Vanuatu 
 ** of The University of Toronto.
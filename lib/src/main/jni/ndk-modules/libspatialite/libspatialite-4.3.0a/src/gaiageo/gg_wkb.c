@@ -47,6 +47,8 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <stdlib.h>
 #include <stdio.h>
 #include <float.h>
+#include <math.h>
+#include <limits.h>
 #include <string.h>
 
 #if defined(_WIN32) && !defined(__MINGW32__)
@@ -972,6 +974,246 @@ ParseCompressedWkbPolygonZM (gaiaGeomCollPtr geo)
       }
 }
 
+/*
+/ QUANTIZED Linestrings and Rings are encoded as follows:
+/
+/ int32  number of points
+/ byte   XY decimal digits
+/ byte   Z decimal digits
+/ byte   M decimal digits
+/ byte   reserved (always 0)
+/ int32  block size (0 = no block index)
+/ int32  offsets of blocks #1 ... #n-1 [only if block size > 0]
+/ int32  payload length
+/ payload: for each vertex and for each ordinate the difference from
+/          the previous value (integer units of 10^-digits) encoded as
+/          a zig-zag varint; the first vertex of each block is always
+/          referred to zero, so that each block can be decoded alone
+*/
+
+struct gaia_quantized_seq
+{
+/* a QUANTIZED Linestring / Ring */
+    int points;
+    int stride;
+    double factor[4];
+    int block_size;
+    const unsigned char *index;
+    const unsigned char *payload;
+    int payload_len;
+};
+
+static const double gaia_quantized_pow10[16] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+    1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15
+};
+
+static const unsigned char *
+quantized_get_varint (const unsigned char *p, sqlite3_int64 * value)
+{
+/* decoding a zig-zag varint */
+    sqlite3_uint64 v = 0;
+    int shift = 0;
+    while (*p & 0x80)
+      {
+	  if (shift < 64)
+	      v |= (sqlite3_uint64) (*p & 0x7f) << shift;
+	  shift += 7;
+	  p++;
+      }
+    if (shift < 64)
+	v |= (sqlite3_uint64) (*p) << shift;
+    *value = (sqlite3_int64) (v >> 1) ^ -((sqlite3_int64) (v & 1));
+    return p + 1;
+}
+
+static const unsigned char *
+quantized_get_varint_checked (const unsigned char *p, const unsigned char *end,
+			      sqlite3_int64 * value)
+{
+/* decoding a zig-zag varint - not trusting the buffer */
+    const unsigned char *q = p;
+    while (q < end && (*q & 0x80))
+	q++;
+    if (q >= end)
+	return NULL;		/* truncated varint */
+    return quantized_get_varint (p, value);
+}
+
+static int
+quantized_dims_factors (int dims, const unsigned char *digits,
+			struct gaia_quantized_seq *seq)
+{
+/* setting up the scale factors for each ordinate */
+    if (digits[0] > 15 || digits[1] > 15 || digits[2] > 15)
+	return 0;
+    seq->factor[0] = gaia_quantized_pow10[digits[0]];
+    seq->factor[1] = gaia_quantized_pow10[digits[0]];
+    switch (dims)
+      {
+      case GAIA_XY_Z:
+	  seq->stride = 3;
+	  seq->factor[2] = gaia_quantized_pow10[digits[1]];
+	  break;
+      case GAIA_XY_M:
+	  seq->stride = 3;
+	  seq->factor[2] = gaia_quantized_pow10[digits[2]];
+	  break;
+      case GAIA_XY_Z_M:
+	  seq->stride = 4;
+	  seq->factor[2] = gaia_quantized_pow10[digits[1]];
+	  seq->factor[3] = gaia_quantized_pow10[digits[2]];
+	  break;
+      default:
+	  seq->stride = 2;
+	  break;
+      };
+    return 1;
+}
+
+static int
+quantized_seq_header (const unsigned char *blob, unsigned long size,
+		      unsigned long *offset, int dims, int endian,
+		      int endian_arch, struct gaia_quantized_seq *seq)
+{
+/* parsing the header of a QUANTIZED Linestring / Ring */
+    unsigned long off = *offset;
+    int blocks;
+    if (size < off + 12)
+	return 0;
+    seq->points = gaiaImport32 (blob + off, endian, endian_arch);
+    if (!quantized_dims_factors (dims, blob + off + 4, seq))
+	return 0;
+    seq->block_size = gaiaImport32 (blob + off + 8, endian, endian_arch);
+    off += 12;
+    if (seq->points < 0 || seq->block_size < 0)
+	return 0;
+    blocks = 0;
+    if (seq->block_size > 0 && seq->points > 0)
+	blocks = ((seq->points - 1) / seq->block_size);
+    if ((size - off) / 4 < (unsigned long) blocks + 1)
+	return 0;
+    seq->index = blob + off;
+    off += 4 * blocks;
+    seq->payload_len = gaiaImport32 (blob + off, endian, endian_arch);
+    off += 4;
+    if (seq->payload_len < 0 || size - off < (unsigned long) seq->payload_len)
+	return 0;
+    /* any ordinate requires at least one byte */
+    if (seq->payload_len / seq->stride < seq->points)
+	return 0;
+    seq->payload = blob + off;
+    *offset = off + seq->payload_len;
+    return 1;
+}
+
+static int
+quantized_seq_validate (struct gaia_quantized_seq *seq)
+{
+/* checking that the payload exactly contains all the expected varints */
+    int i;
+    int count = 0;
+    for (i = 0; i < seq->payload_len; i++)
+      {
+	  if ((seq->payload[i] & 0x80) == 0)
+	      count++;
+      }
+    if (count != seq->points * seq->stride)
+	return 0;
+    if (seq->payload_len > 0 && (seq->payload[seq->payload_len - 1] & 0x80))
+	return 0;
+    return 1;
+}
+
+static void
+quantized_seq_decode (struct gaia_quantized_seq *seq, double *coords)
+{
+/* decoding all vertices of a [validated] QUANTIZED Linestring / Ring */
+    int iv;
+    int ic;
+    int countdown = 0;
+    sqlite3_int64 delta;
+    sqlite3_int64 last[4];
+    const unsigned char *p = seq->payload;
+    double *out = coords;
+    for (iv = 0; iv < seq->points; iv++)
+      {
+	  if (countdown == 0)
+	    {
+		/* starting a new block */
+		last[0] = 0;
+		last[1] = 0;
+		last[2] = 0;
+		last[3] = 0;
+		countdown =
+		    (seq->block_size > 0) ? seq->block_size : seq->points;
+	    }
+	  countdown--;
+	  for (ic = 0; ic < seq->stride; ic++)
+	    {
+		p = quantized_get_varint (p, &delta);
+		last[ic] += delta;
+		*out++ = (double) (last[ic]) / seq->factor[ic];
+	    }
+      }
+}
+
+static void
+ParseQuantizedWkbLine (gaiaGeomCollPtr geo)
+{
+/* decodes a QUANTIZED LINESTRING from WKB */
+    struct gaia_quantized_seq seq;
+    gaiaLinestringPtr line;
+    unsigned long offset = geo->offset;
+    if (!quantized_seq_header
+	(geo->blob, geo->size, &offset, geo->DimensionModel, geo->endian,
+	 geo->endian_arch, &seq))
+	return;
+    if (!quantized_seq_validate (&seq))
+	return;
+    line = gaiaAddLinestringToGeomColl (geo, seq.points);
+    quantized_seq_decode (&seq, line->Coords);
+    geo->offset = offset;
+}
+
+static void
+ParseQuantizedWkbPolygon (gaiaGeomCollPtr geo)
+{
+/* decodes a QUANTIZED POLYGON from WKB */
+    int rings;
+    int ib;
+    struct gaia_quantized_seq seq;
+    gaiaPolygonPtr polyg = NULL;
+    gaiaRingPtr ring;
+    unsigned long offset;
+    if (geo->size < geo->offset + 4)
+	return;
+    rings =
+	gaiaImport32 (geo->blob + geo->offset, geo->endian, geo->endian_arch);
+    geo->offset += 4;
+    if (rings < 1 || (geo->size - geo->offset) / 16 < (unsigned long) rings)
+	return;			/* any Ring requires at least 16 bytes */
+    for (ib = 0; ib < rings; ib++)
+      {
+	  offset = geo->offset;
+	  if (!quantized_seq_header
+	      (geo->blob, geo->size, &offset, geo->DimensionModel, geo->endian,
+	       geo->endian_arch, &seq))
+	      return;
+	  if (!quantized_seq_validate (&seq))
+	      return;
+	  if (ib == 0)
+	    {
+		polyg = gaiaAddPolygonToGeomColl (geo, seq.points, rings - 1);
+		ring = polyg->Exterior;
+	    }
+	  else
+	      ring = gaiaAddInteriorRing (polyg, ib - 1, seq.points);
+	  quantized_seq_decode (&seq, ring->Coords);
+	  geo->offset = offset;
+      }
+}
+
 static void
 ParseWkbGeometry (gaiaGeomCollPtr geo, int isWKB)
 {
@@ -1065,6 +1307,18 @@ ParseWkbGeometry (gaiaGeomCollPtr geo, int isWKB)
 	    case GAIA_COMPRESSED_POLYGONZM:
 		ParseCompressedWkbPolygonZM (geo);
 		break;
+	    case GAIA_QUANTIZED_LINESTRING:
+	    case GAIA_QUANTIZED_LINESTRINGZ:
+	    case GAIA_QUANTIZED_LINESTRINGM:
+	    case GAIA_QUANTIZED_LINESTRINGZM:
+		ParseQuantizedWkbLine (geo);
+		break;
+	    case GAIA_QUANTIZED_POLYGON:
+	    case GAIA_QUANTIZED_POLYGONZ:
+	    case GAIA_QUANTIZED_POLYGONM:
+	    case GAIA_QUANTIZED_POLYGONZM:
+		ParseQuantizedWkbPolygon (geo);
+		break;
 	    default:
 		break;
 	    };
@@ -1131,6 +1385,8 @@ gaiaFromSpatiaLiteBlobWkbEx (const unsigned char *blob, unsigned int size,
       case GAIA_GEOMETRYCOLLECTIONZ:
       case GAIA_COMPRESSED_LINESTRINGZ:
       case GAIA_COMPRESSED_POLYGONZ:
+      case GAIA_QUANTIZED_LINESTRINGZ:
+      case GAIA_QUANTIZED_POLYGONZ:
 	  geo->DimensionModel = GAIA_XY_Z;
 	  break;
       case GAIA_POINTM:
@@ -1142,6 +1398,8 @@ gaiaFromSpatiaLiteBlobWkbEx (const unsigned char *blob, unsigned int size,
       case GAIA_GEOMETRYCOLLECTIONM:
       case GAIA_COMPRESSED_LINESTRINGM:
       case GAIA_COMPRESSED_POLYGONM:
+      case GAIA_QUANTIZED_LINESTRINGM:
+      case GAIA_QUANTIZED_POLYGONM:
 	  geo->DimensionModel = GAIA_XY_M;
 	  break;
       case GAIA_POINTZM:
@@ -1153,6 +1411,8 @@ gaiaFromSpatiaLiteBlobWkbEx (const unsigned char *blob, unsigned int size,
       case GAIA_GEOMETRYCOLLECTIONZM:
       case GAIA_COMPRESSED_LINESTRINGZM:
       case GAIA_COMPRESSED_POLYGONZM:
+      case GAIA_QUANTIZED_LINESTRINGZM:
+      case GAIA_QUANTIZED_POLYGONZM:
 	  geo->DimensionModel = GAIA_XY_Z_M;
 	  break;
       default:
@@ -1222,6 +1482,18 @@ gaiaFromSpatiaLiteBlobWkbEx (const unsigned char *blob, unsigned int size,
       case GAIA_COMPRESSED_POLYGONZM:
 	  ParseCompressedWkbPolygonZM (geo);
 	  break;
+      case GAIA_QUANTIZED_LINESTRING:
+      case GAIA_QUANTIZED_LINESTRINGZ:
+      case GAIA_QUANTIZED_LINESTRINGM:
+      case GAIA_QUANTIZED_LINESTRINGZM:
+	  ParseQuantizedWkbLine (geo);
+	  break;
+      case GAIA_QUANTIZED_POLYGON:
+      case GAIA_QUANTIZED_POLYGONZ:
+      case GAIA_QUANTIZED_POLYGONM:
+      case GAIA_QUANTIZED_POLYGONZM:
+	  ParseQuantizedWkbPolygon (geo);
+	  break;
       case GAIA_MULTIPOINT:
       case GAIA_MULTIPOINTZ:
       case GAIA_MULTIPOINTM:
@@ -1264,6 +1536,10 @@ gaiaFromSpatiaLiteBlobWkbEx (const unsigned char *blob, unsigned int size,
       case GAIA_COMPRESSED_LINESTRINGZ:
       case GAIA_COMPRESSED_LINESTRINGM:
       case GAIA_COMPRESSED_LINESTRINGZM:
+      case GAIA_QUANTIZED_LINESTRING:
+      case GAIA_QUANTIZED_LINESTRINGZ:
+      case GAIA_QUANTIZED_LINESTRINGM:
+      case GAIA_QUANTIZED_LINESTRINGZM:
 	  geo->DeclaredType = GAIA_LINESTRING;
 	  break;
       case GAIA_POLYGON:
@@ -1274,6 +1550,10 @@ gaiaFromSpatiaLiteBlobWkbEx (const unsigned char *blob, unsigned int size,
       case GAIA_COMPRESSED_POLYGONZ:
       case GAIA_COMPRESSED_POLYGONM:
       case GAIA_COMPRESSED_POLYGONZM:
+      case GAIA_QUANTIZED_POLYGON:
+      case GAIA_QUANTIZED_POLYGONZ:
+      case GAIA_QUANTIZED_POLYGONM:
+      case GAIA_QUANTIZED_POLYGONZM:
 	  geo->DeclaredType = GAIA_POLYGON;
 	  break;
       case GAIA_MULTIPOINT:
@@ -1317,6 +1597,130 @@ gaiaFromSpatiaLiteBlobWkb (const unsigned char *blob, unsigned int size)
     return gaiaFromSpatiaLiteBlobWkbEx (blob, size, 0, 0);
 }
 
+GAIAGEO_DECLARE gaiaGeomCollPtr
+gaiaPointNFromQuantizedBlob (const unsigned char *blob, unsigned int size,
+			     int vertex)
+{
+/* extracting a single vertex from a QUANTIZED LINESTRING BLOB */
+    int type;
+    int dims;
+    int little_endian;
+    int endian_arch = gaiaEndianArch ();
+    int block;
+    int skip;
+    int ic;
+    unsigned long offset = 43;
+    sqlite3_int64 delta;
+    sqlite3_int64 last[4];
+    double coords[4];
+    const unsigned char *p;
+    const unsigned char *end;
+    struct gaia_quantized_seq seq;
+    gaiaGeomCollPtr geo;
+
+    if (size < 45)
+	return NULL;		/* cannot be an internal BLOB WKB geometry */
+    if (*(blob + 0) != GAIA_MARK_START)
+	return NULL;		/* failed to recognize START signature */
+    if (*(blob + (size - 1)) != GAIA_MARK_END)
+	return NULL;		/* failed to recognize END signature */
+    if (*(blob + 38) != GAIA_MARK_MBR)
+	return NULL;		/* failed to recognize MBR signature */
+    if (*(blob + 1) == GAIA_LITTLE_ENDIAN)
+	little_endian = 1;
+    else if (*(blob + 1) == GAIA_BIG_ENDIAN)
+	little_endian = 0;
+    else
+	return NULL;		/* unknown encoding; nor little-endian neither big-endian */
+    type = gaiaImport32 (blob + 39, little_endian, endian_arch);
+    switch (type)
+      {
+      case GAIA_QUANTIZED_LINESTRING:
+	  dims = GAIA_XY;
+	  break;
+      case GAIA_QUANTIZED_LINESTRINGZ:
+	  dims = GAIA_XY_Z;
+	  break;
+      case GAIA_QUANTIZED_LINESTRINGM:
+	  dims = GAIA_XY_M;
+	  break;
+      case GAIA_QUANTIZED_LINESTRINGZM:
+	  dims = GAIA_XY_Z_M;
+	  break;
+      default:
+	  return NULL;		/* not a QUANTIZED LINESTRING */
+      };
+    if (!quantized_seq_header
+	(blob, size, &offset, dims, little_endian, endian_arch, &seq))
+	return NULL;
+    if (vertex < 0)
+	vertex = seq.points - 1;
+    if (vertex < 0 || vertex >= seq.points)
+	return NULL;
+
+/* positioning on the block containing the required vertex */
+    p = seq.payload;
+    skip = vertex;
+    if (seq.block_size > 0)
+      {
+	  block = vertex / seq.block_size;
+	  skip = vertex % seq.block_size;
+	  if (block > 0)
+	    {
+		offset =
+		    gaiaImport32 (seq.index + (4 * (block - 1)), little_endian,
+				  endian_arch);
+		if (offset >= (unsigned long) seq.payload_len)
+		    return NULL;
+		p += offset;
+	    }
+      }
+    end = seq.payload + seq.payload_len;
+    last[0] = 0;
+    last[1] = 0;
+    last[2] = 0;
+    last[3] = 0;
+    for (; skip >= 0; skip--)
+      {
+	  for (ic = 0; ic < seq.stride; ic++)
+	    {
+		p = quantized_get_varint_checked (p, end, &delta);
+		if (p == NULL)
+		    return NULL;
+		last[ic] += delta;
+	    }
+      }
+    for (ic = 0; ic < seq.stride; ic++)
+	coords[ic] = (double) (last[ic]) / seq.factor[ic];
+
+/* building the POINT */
+    if (dims == GAIA_XY_Z)
+      {
+	  geo = gaiaAllocGeomCollXYZ ();
+	  gaiaAddPointToGeomCollXYZ (geo, coords[0], coords[1], coords[2]);
+      }
+    else if (dims == GAIA_XY_M)
+      {
+	  geo = gaiaAllocGeomCollXYM ();
+	  gaiaAddPointToGeomCollXYM (geo, coords[0], coords[1], coords[2]);
+      }
+    else if (dims == GAIA_XY_Z_M)
+      {
+	  geo = gaiaAllocGeomCollXYZM ();
+	  gaiaAddPointToGeomCollXYZM (geo, coords[0], coords[1], coords[2],
+				      coords[3]);
+      }
+    else
+      {
+	  geo = gaiaAllocGeomColl ();
+	  gaiaAddPointToGeomColl (geo, coords[0], coords[1]);
+      }
+    geo->Srid = gaiaImport32 (blob + 2, little_endian, endian_arch);
+    geo->DeclaredType = GAIA_POINT;
+    gaiaMbrGeometry (geo);
+    return geo;
+}
+
 GAIAGEO_DECLARE gaiaGeomCollPtr
 gaiaFromSpatiaLiteBlobMbr (const unsigned char *blob, unsigned int size)
 {
@@ -3487,6 +3891,376 @@ gaiaToCompressedBlobWkb (gaiaGeomCollPtr geom, unsigned char **result,
       };
 }
 
+static unsigned char *
+quantized_put_varint (unsigned char *p, sqlite3_int64 value)
+{
+/* encoding a zig-zag varint */
+    sqlite3_uint64 v =
+	((sqlite3_uint64) value << 1) ^ (sqlite3_uint64) (value >> 63);
+    while (v >= 0x80)
+      {
+	  *p++ = (unsigned char) ((v & 0x7f) | 0x80);
+	  v >>= 7;
+      }
+    *p++ = (unsigned char) v;
+    return p;
+}
+
+static int
+quantized_round_coords (double *coords, int points, int stride,
+			const double *factor)
+{
+/* snapping all coords on the quantization grid */
+    int iv;
+    int ic;
+    double v;
+    for (iv = 0; iv < points; iv++)
+      {
+	  for (ic = 0; ic < stride; ic++)
+	    {
+		v = *coords * factor[ic];
+		if (!(fabs (v) < 4.5e15))
+		    return 0;	/* NaN, Infinity or overflow */
+		*coords++ = floor (v + 0.5) / factor[ic];
+	    }
+      }
+    return 1;
+}
+
+static unsigned long
+quantized_seq_max_size (int points, int stride, int block_size)
+{
+/* computing the max size required by a QUANTIZED Linestring / Ring */
+    unsigned long sz = 16;
+    if (block_size > 0 && points > 0)
+	sz += 4 * ((points - 1) / block_size);
+    return sz + ((unsigned long) points * stride * 10);
+}
+
+static unsigned char *
+quantized_put_seq (unsigned char *p, const double *coords, int points,
+		   struct gaia_quantized_seq *seq, const unsigned char *digits,
+		   int endian_arch)
+{
+/* encoding a QUANTIZED Linestring / Ring */
+    int iv;
+    int ic;
+    int blocks = 0;
+    int countdown = 0;
+    sqlite3_int64 q;
+    sqlite3_int64 last[4];
+    unsigned char *index;
+    unsigned char *payload;
+    unsigned char *out;
+    if (seq->block_size > 0 && points > 0)
+	blocks = (points - 1) / seq->block_size;
+    gaiaExport32 (p, points, 1, endian_arch);	/* # points */
+    *(p + 4) = digits[0];
+    *(p + 5) = digits[1];
+    *(p + 6) = digits[2];
+    *(p + 7) = 0;
+    gaiaExport32 (p + 8, seq->block_size, 1, endian_arch);	/* block size */
+    index = p + 12;
+    payload = index + (4 * blocks) + 4;
+    out = payload;
+    for (iv = 0; iv < points; iv++)
+      {
+	  if (countdown == 0)
+	    {
+		/* starting a new block */
+		if (iv > 0)
+		  {
+		      gaiaExport32 (index, (int) (out - payload), 1,
+				    endian_arch);
+		      index += 4;
+		  }
+		last[0] = 0;
+		last[1] = 0;
+		last[2] = 0;
+		last[3] = 0;
+		countdown = (seq->block_size > 0) ? seq->block_size : points;
+	    }
+	  countdown--;
+	  for (ic = 0; ic < seq->stride; ic++)
+	    {
+		q = (sqlite3_int64) floor (*coords++ * seq->factor[ic] + 0.5);
+		out = quantized_put_varint (out, q - last[ic]);
+		last[ic] = q;
+	    }
+      }
+    gaiaExport32 (payload - 4, (int) (out - payload), 1, endian_arch);	/* payload length */
+    return out;
+}
+
+static int
+quantized_blob_class (gaiaGeomCollPtr geom, int n_points, int n_linestrings,
+		      int n_polygons)
+{
+/* determining the geometry class - XY */
+    if (n_points == 0 && n_linestrings == 0 && n_polygons == 0)
+	return GAIA_UNKNOWN;
+    if (geom->DeclaredType == GAIA_GEOMETRYCOLLECTION)
+	return GAIA_GEOMETRYCOLLECTION;
+    if (n_linestrings == 0 && n_polygons == 0)
+      {
+	  if (n_points == 1 && geom->DeclaredType != GAIA_MULTIPOINT)
+	      return GAIA_POINT;
+	  return GAIA_MULTIPOINT;
+      }
+    if (n_points == 0 && n_polygons == 0)
+      {
+	  if (n_linestrings == 1 && geom->DeclaredType != GAIA_MULTILINESTRING)
+	      return GAIA_LINESTRING;
+	  return GAIA_MULTILINESTRING;
+      }
+    if (n_points == 0 && n_linestrings == 0)
+      {
+	  if (n_polygons == 1 && geom->DeclaredType != GAIA_MULTIPOLYGON)
+	      return GAIA_POLYGON;
+	  return GAIA_MULTIPOLYGON;
+      }
+    return GAIA_GEOMETRYCOLLECTION;
+}
+
+static unsigned char *
+quantized_put_point (unsigned char *p, gaiaPointPtr point, int dims,
+		     int endian_arch)
+{
+/* encoding a POINT [plain doubles] */
+    gaiaExport64 (p, point->X, 1, endian_arch);	/* X */
+    gaiaExport64 (p + 8, point->Y, 1, endian_arch);	/* Y */
+    p += 16;
+    if (dims == GAIA_XY_Z || dims == GAIA_XY_Z_M)
+      {
+	  gaiaExport64 (p, point->Z, 1, endian_arch);	/* Z */
+	  p += 8;
+      }
+    if (dims == GAIA_XY_M || dims == GAIA_XY_Z_M)
+      {
+	  gaiaExport64 (p, point->M, 1, endian_arch);	/* M */
+	  p += 8;
+      }
+    return p;
+}
+
+static unsigned char *
+quantized_put_polygon (unsigned char *p, gaiaPolygonPtr polyg,
+		       struct gaia_quantized_seq *seq,
+		       const unsigned char *digits, int endian_arch)
+{
+/* encoding a QUANTIZED Polygon */
+    int ib;
+    gaiaRingPtr rng;
+    gaiaExport32 (p, polyg->NumInteriors + 1, 1, endian_arch);	/* # rings */
+    p += 4;
+    rng = polyg->Exterior;
+    p = quantized_put_seq (p, rng->Coords, rng->Points, seq, digits,
+			   endian_arch);
+    for (ib = 0; ib < polyg->NumInteriors; ib++)
+      {
+	  rng = polyg->Interiors + ib;
+	  p = quantized_put_seq (p, rng->Coords, rng->Points, seq, digits,
+				 endian_arch);
+      }
+    return p;
+}
+
+GAIAGEO_DECLARE void
+gaiaToQuantizedBlobWkb (gaiaGeomCollPtr geom, int xy_digits, int z_digits,
+			int m_digits, int block_size, unsigned char **result,
+			int *size)
+{
+/* 
+/ builds the SpatiaLite BLOB representation for this GEOMETRY 
+/ QUANTIZED compression will be applied to LINESTRINGs and RINGs
+*/
+    int ib;
+    int entities = 0;
+    int n_points = 0;
+    int n_linestrings = 0;
+    int n_polygons = 0;
+    int type;
+    int dims_offset;
+    unsigned long max_size;
+    double coords[4];
+    unsigned char digits[3];
+    unsigned char *ptr;
+    gaiaGeomCollPtr quant;
+    gaiaPointPtr pt;
+    gaiaLinestringPtr ln;
+    gaiaPolygonPtr pg;
+    gaiaRingPtr rng;
+    struct gaia_quantized_seq seq;
+    int endian_arch = gaiaEndianArch ();
+    *size = 0;
+    *result = NULL;
+    if (geom == NULL)
+	return;
+    if (xy_digits < 0 || xy_digits > 15 || z_digits < 0 || z_digits > 15
+	|| m_digits < 0 || m_digits > 15 || block_size < 0)
+	return;
+    digits[0] = (unsigned char) xy_digits;
+    digits[1] = (unsigned char) z_digits;
+    digits[2] = (unsigned char) m_digits;
+    quantized_dims_factors (geom->DimensionModel, digits, &seq);
+    seq.block_size = block_size;
+
+/* snapping a copy of the geometry on the quantization grid */
+    quant = gaiaCloneGeomColl (geom);
+    if (quant == NULL)
+	return;
+    quant->Srid = geom->Srid;
+    quant->DeclaredType = geom->DeclaredType;
+    max_size = 48;
+    pt = quant->FirstPoint;
+    while (pt)
+      {
+	  n_points++;
+	  coords[0] = pt->X;
+	  coords[1] = pt->Y;
+	  if (quant->DimensionModel == GAIA_XY_M)
+	      coords[2] = pt->M;
+	  else
+	    {
+		coords[2] = pt->Z;
+		coords[3] = pt->M;
+	    }
+	  if (!quantized_round_coords (coords, 1, seq.stride, seq.factor))
+	      goto error;
+	  pt->X = coords[0];
+	  pt->Y = coords[1];
+	  if (quant->DimensionModel == GAIA_XY_M)
+	      pt->M = coords[2];
+	  else if (quant->DimensionModel == GAIA_XY_Z)
+	      pt->Z = coords[2];
+	  else if (quant->DimensionModel == GAIA_XY_Z_M)
+	    {
+		pt->Z = coords[2];
+		pt->M = coords[3];
+	    }
+	  max_size += 5 + (sizeof (double) * seq.stride);
+	  pt = pt->Next;
+      }
+    ln = quant->FirstLinestring;
+    while (ln)
+      {
+	  n_linestrings++;
+	  if (!quantized_round_coords
+	      (ln->Coords, ln->Points, seq.stride, seq.factor))
+	      goto error;
+	  max_size +=
+	      5 + quantized_seq_max_size (ln->Points, seq.stride, block_size);
+	  ln = ln->Next;
+      }
+    pg = quant->FirstPolygon;
+    while (pg)
+      {
+	  n_polygons++;
+	  max_size += 9;
+	  rng = pg->Exterior;
+	  if (!quantized_round_coords
+	      (rng->Coords, rng->Points, seq.stride, seq.factor))
+	      goto error;
+	  max_size +=
+	      quantized_seq_max_size (rng->Points, seq.stride, block_size);
+	  for (ib = 0; ib < pg->NumInteriors; ib++)
+	    {
+		rng = pg->Interiors + ib;
+		if (!quantized_round_coords
+		    (rng->Coords, rng->Points, seq.stride, seq.factor))
+		    goto error;
+		max_size +=
+		    quantized_seq_max_size (rng->Points, seq.stride,
+					    block_size);
+	    }
+	  pg = pg->Next;
+      }
+    entities = n_points + n_linestrings + n_polygons;
+    type = quantized_blob_class (quant, n_points, n_linestrings, n_polygons);
+    if (type == GAIA_UNKNOWN || max_size > INT_MAX)
+	goto error;
+    gaiaMbrGeometry (quant);
+    if (quant->DimensionModel == GAIA_XY_Z)
+	dims_offset = 1000;
+    else if (quant->DimensionModel == GAIA_XY_M)
+	dims_offset = 2000;
+    else if (quant->DimensionModel == GAIA_XY_Z_M)
+	dims_offset = 3000;
+    else
+	dims_offset = 0;
+
+/* and finally we build the BLOB */
+    *result = malloc (max_size);
+    ptr = *result;
+    *ptr = GAIA_MARK_START;	/* START signature */
+    *(ptr + 1) = GAIA_LITTLE_ENDIAN;	/* byte ordering */
+    gaiaExport32 (ptr + 2, quant->Srid, 1, endian_arch);	/* the SRID */
+    gaiaExport64 (ptr + 6, quant->MinX, 1, endian_arch);	/* MBR - minimum X */
+    gaiaExport64 (ptr + 14, quant->MinY, 1, endian_arch);	/* MBR - minimum Y */
+    gaiaExport64 (ptr + 22, quant->MaxX, 1, endian_arch);	/* MBR - maximum X */
+    gaiaExport64 (ptr + 30, quant->MaxY, 1, endian_arch);	/* MBR - maximum Y */
+    *(ptr + 38) = GAIA_MARK_MBR;	/* MBR signature */
+    switch (type)
+      {
+      case GAIA_POINT:
+	  gaiaExport32 (ptr + 39, GAIA_POINT + dims_offset, 1, endian_arch);	/* class POINT */
+	  ptr = quantized_put_point (ptr + 43, quant->FirstPoint,
+				     quant->DimensionModel, endian_arch);
+	  break;
+      case GAIA_LINESTRING:
+	  gaiaExport32 (ptr + 39, GAIA_QUANTIZED_LINESTRING + dims_offset, 1, endian_arch);	/* class LINESTRING */
+	  ln = quant->FirstLinestring;
+	  ptr = quantized_put_seq (ptr + 43, ln->Coords, ln->Points, &seq,
+				   digits, endian_arch);
+	  break;
+      case GAIA_POLYGON:
+	  gaiaExport32 (ptr + 39, GAIA_QUANTIZED_POLYGON + dims_offset, 1, endian_arch);	/* class POLYGON */
+	  ptr = quantized_put_polygon (ptr + 43, quant->FirstPolygon, &seq,
+				       digits, endian_arch);
+	  break;
+      default:
+	  /* this one is not a simple geometry; should be a MULTIxxxx or a GEOMETRYCOLLECTION */
+	  gaiaExport32 (ptr + 39, type + dims_offset, 1, endian_arch);	/* class */
+	  gaiaExport32 (ptr + 43, entities, 1, endian_arch);	/* # entities */
+	  ptr += 47;
+	  pt = quant->FirstPoint;
+	  while (pt)
+	    {
+		*ptr = GAIA_MARK_ENTITY;	/* ENTITY signature */
+		gaiaExport32 (ptr + 1, GAIA_POINT + dims_offset, 1, endian_arch);	/* class POINT */
+		ptr = quantized_put_point (ptr + 5, pt, quant->DimensionModel,
+					   endian_arch);
+		pt = pt->Next;
+	    }
+	  ln = quant->FirstLinestring;
+	  while (ln)
+	    {
+		*ptr = GAIA_MARK_ENTITY;	/* ENTITY signature */
+		gaiaExport32 (ptr + 1, GAIA_QUANTIZED_LINESTRING + dims_offset, 1, endian_arch);	/* class LINESTRING */
+		ptr = quantized_put_seq (ptr + 5, ln->Coords, ln->Points, &seq,
+					 digits, endian_arch);
+		ln = ln->Next;
+	    }
+	  pg = quant->FirstPolygon;
+	  while (pg)
+	    {
+		*ptr = GAIA_MARK_ENTITY;	/* ENTITY signature */
+		gaiaExport32 (ptr + 1, GAIA_QUANTIZED_POLYGON + dims_offset, 1, endian_arch);	/* class POLYGON */
+		ptr = quantized_put_polygon (ptr + 5, pg, &seq, digits,
+					     endian_arch);
+		pg = pg->Next;
+	    }
+	  break;
+      };
+    *ptr++ = GAIA_MARK_END;	/* END signature */
+    *size = (int) (ptr - *result);
+    gaiaFreeGeomColl (quant);
+    return;
+
+  error:
+    gaiaFreeGeomColl (quant);
+}
+
 GAIAGEO_DECLARE gaiaGeomCollPtr
 gaiaFromWkb (const unsigned char *blob, unsigned int size)
 {
@@ -48,6 +48,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 
 #if defined(_WIN32) && !defined(__MINGW32__)
 #include "config-msvc.h"
@@ -55,10 +56,21 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include "config.h"
 #endif
 
+#if defined(_WIN32) || defined(WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <spatialite_private.h>
 #include <spatialite/sqlite.h>
 
 #include <spatialite/gaiageo.h>
 
+#ifdef _WIN32
+#define strncasecmp	_strnicmp
+#endif /* not WIN32 */
+
 static void
 gaiaOutClean (char *buffer)
 {
@@ -3892,231 +3904,478 @@ gaiaOutGml (gaiaOutBufferPtr out_buf, int version, int precision,
     gaiaAppendToOutBuffer (out_buf, buf);
 }
 
-GAIAGEO_DECLARE void
-gaiaOutGeoJSON (gaiaOutBufferPtr out_buf, gaiaGeomCollPtr geom, int precision,
-		int options)
+
+static const double gaia_pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+    1e11, 1e12, 1e13, 1e14, 1e15
+};
+
+static int
+gaiaFormatCoord (char *buf, double value, int precision)
 {
 /*
-/ prints the GeoJSON representation of current geometry
-/ *result* returns the encoded GeoJSON or NULL if any error is encountered
+/ formats a coordinate value exactly as "%.*f" followed by gaiaOutClean()
+/ would do, but without requiring any dynamic allocation
+/
+/ the fast path uses plain integer arithmetic; values falling too near
+/ to a rounding tie (or requiring more than 15 significant digits) are
+/ always delegated to sqlite3_snprintf() so to preserve full consistency
+/ with the traditional SQL functions output
 */
-    gaiaPointPtr point;
-    gaiaLinestringPtr line;
-    gaiaPolygonPtr polyg;
-    gaiaRingPtr ring;
+    double abs_val;
+    double int_part;
+    double scaled;
+    double floor_scaled;
+    double diff;
+    sqlite3_uint64 ipart;
+    sqlite3_uint64 fpart;
+    sqlite3_uint64 pw;
+    char digits[32];
+    int nd;
+    int len = 0;
+    int i;
+
+    if (precision < 1 || precision > 15 || value != value)
+	goto slow;
+    abs_val = fabs (value);
+    if (abs_val >= 1e15)
+	goto slow;
+    int_part = floor (abs_val);
+    scaled = (abs_val - int_part) * gaia_pow10[precision];
+    floor_scaled = floor (scaled);
+    diff = scaled - floor_scaled - 0.5;
+    if (fabs (diff) <= (abs_val + 1.0) * gaia_pow10[precision] * 4.5e-16)
+	goto slow;		/* too near to a rounding tie */
+    ipart = (sqlite3_uint64) int_part;
+    nd = 0;
+    while (ipart > 0)
+      {
+	  digits[nd++] = (char) ('0' + (ipart % 10));
+	  ipart /= 10;
+      }
+    if (nd + precision > 15)
+	goto slow;		/* beyond the double precision */
+    ipart = (sqlite3_uint64) int_part;
+    fpart = (sqlite3_uint64) floor_scaled;
+    if (diff > 0.0)
+	fpart++;
+    pw = (sqlite3_uint64) gaia_pow10[precision];
+    if (fpart >= pw)
+      {
+	  /* rounding carry */
+	  fpart -= pw;
+	  ipart++;
+      }
+    if (ipart == 0 && fpart == 0)
+      {
+	  /* avoiding to return embarassing NEGATIVE ZEROes */
+	  buf[0] = '0';
+	  buf[1] = '\0';
+	  return 1;
+      }
+    if (value < 0.0)
+	buf[len++] = '-';
+    nd = 0;
+    if (ipart == 0)
+	digits[nd++] = '0';
+    while (ipart > 0)
+      {
+	  digits[nd++] = (char) ('0' + (ipart % 10));
+	  ipart /= 10;
+      }
+    while (nd > 0)
+	buf[len++] = digits[--nd];
+    if (fpart > 0)
+      {
+	  /* suppressing trailing zeros */
+	  while ((fpart % 10) == 0)
+	    {
+		fpart /= 10;
+		precision--;
+	    }
+	  buf[len++] = '.';
+	  for (i = precision - 1; i >= 0; i--)
+	    {
+		buf[len + i] = (char) ('0' + (fpart % 10));
+		fpart /= 10;
+	    }
+	  len += precision;
+      }
+    buf[len] = '\0';
+    return len;
+
+  slow:
+    sqlite3_snprintf (512, buf, "%.*f", precision, value);
+    gaiaOutClean (buf);
+    return strlen (buf);
+}
+
+static void
+gaiaGeoJsonWriterReset (gaiaGeoJsonWriterPtr writer, int precision,
+			int options, double quantum)
+{
+/* common initialization for any GeoJSON writer */
+    writer->Fd = -1;
+    writer->OutBuf = NULL;
+    writer->Buffer = writer->Block;
+    writer->BufferSize = GAIA_GEOJSON_BLOCK;
+    writer->WriteOffset = 0;
+    writer->TotalBytes = 0;
+    writer->Features = 0;
+    writer->Properties = 0;
+    if (precision > 18)
+	precision = 18;
+    writer->Precision = precision;
+    if (quantum > 0.0)
+	writer->Quantum = quantum;
+    else
+	writer->Quantum = 0.0;
+    writer->Options = options;
+    writer->Error = 0;
+}
+
+GAIAGEO_DECLARE void
+gaiaGeoJsonWriterInitFd (gaiaGeoJsonWriterPtr writer, int fd, int precision,
+			 int options, double quantum)
+{
+/* initializing a GeoJSON writer targeting a file descriptor */
+    gaiaGeoJsonWriterReset (writer, precision, options, quantum);
+    writer->Fd = fd;
+    if (fd < 0)
+	writer->Error = 1;
+}
+
+GAIAGEO_DECLARE void
+gaiaGeoJsonWriterInitBuffer (gaiaGeoJsonWriterPtr writer, char *buffer,
+			     int size, int precision, int options,
+			     double quantum)
+{
+/* initializing a GeoJSON writer targeting a caller supplied buffer */
+    gaiaGeoJsonWriterReset (writer, precision, options, quantum);
+    writer->Buffer = buffer;
+    writer->BufferSize = size;
+    if (buffer == NULL || size < 1)
+      {
+	  writer->BufferSize = 0;
+	  writer->Error = 1;
+      }
+    else
+	*buffer = '\0';
+}
+
+static void
+gaiaGeoJsonWriterInitOutBuffer (gaiaGeoJsonWriterPtr writer,
+				gaiaOutBufferPtr out_buf, int precision,
+				int options)
+{
+/* initializing a GeoJSON writer targeting a dynamically growing buffer */
+    gaiaGeoJsonWriterReset (writer, precision, options, 0.0);
+    writer->OutBuf = out_buf;
+}
+
+static int
+gaiaGeoJsonWriterDrain (gaiaGeoJsonWriterPtr writer)
+{
+/* transferring the staging block to the final destination */
+    int off = 0;
+    if (writer->Error)
+	return 0;
+    if (writer->Buffer != writer->Block)
+      {
+	  /* caller supplied buffer: it cannot be drained at all */
+	  writer->Error = 1;
+	  return 0;
+      }
+    if (writer->OutBuf != NULL)
+      {
+	  writer->Block[writer->WriteOffset] = '\0';
+	  gaiaAppendToOutBuffer (writer->OutBuf, writer->Block);
+	  if (writer->OutBuf->Error)
+	      writer->Error = 1;
+      }
+    else
+      {
+	  while (off < writer->WriteOffset)
+	    {
+		int wr = write (writer->Fd, writer->Block + off,
+				writer->WriteOffset - off);
+		if (wr <= 0)
+		  {
+		      writer->Error = 1;
+		      break;
+		  }
+		off += wr;
+	    }
+      }
+    writer->WriteOffset = 0;
+    return !writer->Error;
+}
+
+static void
+gaiaGeoJsonPut (gaiaGeoJsonWriterPtr writer, const char *text, int len)
+{
+/* appending some text into the writer's composition buffer */
+    int free_size;
+    if (writer->Error)
+	return;
+    while (len > 0)
+      {
+	  /* always reserving a trailing byte for the NULL terminator */
+	  free_size = writer->BufferSize - writer->WriteOffset - 1;
+	  if (free_size >= len)
+	    {
+		memcpy (writer->Buffer + writer->WriteOffset, text, len);
+		writer->WriteOffset += len;
+		writer->TotalBytes += len;
+		return;
+	    }
+	  if (free_size > 0)
+	    {
+		memcpy (writer->Buffer + writer->WriteOffset, text, free_size);
+		writer->WriteOffset += free_size;
+		writer->TotalBytes += free_size;
+		text += free_size;
+		len -= free_size;
+	    }
+	  if (!gaiaGeoJsonWriterDrain (writer))
+	      return;
+      }
+}
+
+#define gaiaGeoJsonPutText(w, t) gaiaGeoJsonPut ((w), (t), strlen (t))
+
+static double
+gaiaGeoJsonQuantize (gaiaGeoJsonWriterPtr writer, double value)
+{
+/* snapping a coordinate value to the quantization grid */
+    if (writer->Quantum > 0.0)
+	return floor ((value / writer->Quantum) + 0.5) * writer->Quantum;
+    return value;
+}
+
+static void
+gaiaGeoJsonPutNumber (gaiaGeoJsonWriterPtr writer, double value)
+{
+/* appending a formatted coordinate value */
+    char buf[512];
+    int len;
+    len =
+	gaiaFormatCoord (buf, gaiaGeoJsonQuantize (writer, value),
+			 writer->Precision);
+    gaiaGeoJsonPut (writer, buf, len);
+}
+
+static void
+gaiaGeoJsonPutVertex (gaiaGeoJsonWriterPtr writer, const char *prefix,
+		      double x, double y, double z, int has_z)
+{
+/* appending a single vertex: [x,y] or [x,y,z] */
+    char buf[1600];
+    int len = strlen (prefix);
+    memcpy (buf, prefix, len);
+    buf[len++] = '[';
+    len +=
+	gaiaFormatCoord (buf + len, gaiaGeoJsonQuantize (writer, x),
+			 writer->Precision);
+    buf[len++] = ',';
+    len +=
+	gaiaFormatCoord (buf + len, gaiaGeoJsonQuantize (writer, y),
+			 writer->Precision);
+    if (has_z)
+      {
+	  buf[len++] = ',';
+	  len +=
+	      gaiaFormatCoord (buf + len, gaiaGeoJsonQuantize (writer, z),
+			       writer->Precision);
+      }
+    buf[len++] = ']';
+    gaiaGeoJsonPut (writer, buf, len);
+}
+
+static void
+gaiaGeoJsonPutCoords (gaiaGeoJsonWriterPtr writer, const char *first_prefix,
+		      int points, double *coords, int dims)
+{
+/* appending a whole Linestring or Ring coordinate array */
     int iv;
-    int ib;
     double x;
     double y;
-    double z;
+    double z = 0.0;
     double m;
-    int has_z;
+    int has_z = 0;
+    if (dims == GAIA_XY_Z || dims == GAIA_XY_Z_M)
+	has_z = 1;
+    for (iv = 0; iv < points; iv++)
+      {
+	  if (dims == GAIA_XY_Z)
+	    {
+		gaiaGetPointXYZ (coords, iv, &x, &y, &z);
+	    }
+	  else if (dims == GAIA_XY_M)
+	    {
+		gaiaGetPointXYM (coords, iv, &x, &y, &m);
+	    }
+	  else if (dims == GAIA_XY_Z_M)
+	    {
+		gaiaGetPointXYZM (coords, iv, &x, &y, &z, &m);
+	    }
+	  else
+	    {
+		gaiaGetPoint (coords, iv, &x, &y);
+	    }
+	  gaiaGeoJsonPutVertex (writer, (iv == 0) ? first_prefix : ",", x, y,
+				z, has_z);
+      }
+}
+
+static void
+gaiaGeoJsonPutPolygon (gaiaGeoJsonWriterPtr writer, gaiaPolygonPtr polyg)
+{
+/* appending all Rings of some Polygon */
+    int ib;
+    gaiaRingPtr ring = polyg->Exterior;
+    gaiaGeoJsonPutCoords (writer, "[", ring->Points, ring->Coords,
+			  ring->DimensionModel);
+    /* closing the Exterior Ring */
+    gaiaGeoJsonPut (writer, "]", 1);
+    for (ib = 0; ib < polyg->NumInteriors; ib++)
+      {
+	  /* interior rings */
+	  ring = polyg->Interiors + ib;
+	  gaiaGeoJsonPutCoords (writer, ",[", ring->Points, ring->Coords,
+				ring->DimensionModel);
+	  /* closing the Interior Ring */
+	  gaiaGeoJsonPut (writer, "]", 1);
+      }
+    /* closing the Polygon */
+    gaiaGeoJsonPut (writer, "]", 1);
+}
+
+GAIAGEO_DECLARE void
+gaiaGeoJsonWriteGeometry (gaiaGeoJsonWriterPtr writer, gaiaGeomCollPtr geom)
+{
+/* streaming the GeoJSON representation of some geometry */
+    gaiaPointPtr point;
+    gaiaLinestringPtr line;
+    gaiaPolygonPtr polyg;
     int is_multi = 0;
     int multi_count = 0;
-    char *bbox;
-    char crs[2048];
-    char *buf;
-    char *buf_x;
-    char *buf_y;
-    char *buf_m;
-    char *buf_z;
-    char endJson[16];
-    if (!geom)
-	return;
-    if (precision > 18)
-	precision = 18;
+    int options = writer->Options;
+    const char *type;
+    const char *coords;
+    const char *endJson;
+    char buf[256];
 
+    if (!geom)
+      {
+	  gaiaGeoJsonPut (writer, "null", 4);
+	  return;
+      }
+    switch (geom->DeclaredType)
+      {
+      case GAIA_POINT:
+	  type = "Point";
+	  coords = ",\"coordinates\":";
+	  endJson = "}";
+	  break;
+      case GAIA_LINESTRING:
+	  type = "LineString";
+	  coords = ",\"coordinates\":[";
+	  endJson = "}";
+	  break;
+      case GAIA_POLYGON:
+	  type = "Polygon";
+	  coords = ",\"coordinates\":[";
+	  endJson = "}";
+	  break;
+      case GAIA_MULTIPOINT:
+	  type = "MultiPoint";
+	  coords = ",\"coordinates\":[";
+	  endJson = "]}";
+	  break;
+      case GAIA_MULTILINESTRING:
+	  type = "MultiLineString";
+	  coords = ",\"coordinates\":[[";
+	  endJson = "]}";
+	  break;
+      case GAIA_MULTIPOLYGON:
+	  type = "MultiPolygon";
+	  coords = ",\"coordinates\":[[";
+	  endJson = "]}";
+	  break;
+      default:
+	  type = "GeometryCollection";
+	  coords = ",\"geometries\":[";
+	  endJson = "]}";
+	  is_multi = 1;
+	  break;
+      };
+    gaiaGeoJsonPutText (writer, "{\"type\":\"");
+    gaiaGeoJsonPutText (writer, type);
+    gaiaGeoJsonPut (writer, "\"", 1);
     if (options != 0)
       {
-	  bbox = NULL;
-	  *crs = '\0';
 	  if (geom->Srid > 0)
 	    {
 		if (options == 2 || options == 3)
 		  {
 		      /* including short CRS */
-		      sprintf (crs,
+		      sprintf (buf,
 			       ",\"crs\":{\"type\":\"name\",\"properties\":{\"name\":\"EPSG:%d\"}}",
 			       geom->Srid);
+		      gaiaGeoJsonPutText (writer, buf);
 		  }
 		if (options == 4 || options == 5)
 		  {
 		      /* including long CRS */
-		      sprintf (crs,
+		      sprintf (buf,
 			       ",\"crs\":{\"type\":\"name\",\"properties\":{\"name\":\"urn:ogc:def:crs:EPSG:%d\"}}",
 			       geom->Srid);
+		      gaiaGeoJsonPutText (writer, buf);
 		  }
 	    }
 	  if (options == 1 || options == 3 || options == 5)
 	    {
 		/* including BBOX */
 		gaiaMbrGeometry (geom);
-		buf_x = sqlite3_mprintf ("%.*f", precision, geom->MinX);
-		gaiaOutClean (buf_x);
-		buf_y = sqlite3_mprintf ("%.*f", precision, geom->MinY);
-		gaiaOutClean (buf_y);
-		buf_z = sqlite3_mprintf ("%.*f", precision, geom->MaxX);
-		gaiaOutClean (buf_z);
-		buf_m = sqlite3_mprintf ("%.*f", precision, geom->MaxY);
-		gaiaOutClean (buf_m);
-		bbox =
-		    sqlite3_mprintf (",\"bbox\":[%s,%s,%s,%s]", buf_x, buf_y,
-				     buf_z, buf_m);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
-		sqlite3_free (buf_z);
-		sqlite3_free (buf_m);
+		gaiaGeoJsonPutText (writer, ",\"bbox\":[");
+		gaiaGeoJsonPutNumber (writer, geom->MinX);
+		gaiaGeoJsonPut (writer, ",", 1);
+		gaiaGeoJsonPutNumber (writer, geom->MinY);
+		gaiaGeoJsonPut (writer, ",", 1);
+		gaiaGeoJsonPutNumber (writer, geom->MaxX);
+		gaiaGeoJsonPut (writer, ",", 1);
+		gaiaGeoJsonPutNumber (writer, geom->MaxY);
+		gaiaGeoJsonPut (writer, "]", 1);
 	    }
-	  switch (geom->DeclaredType)
-	    {
-	    case GAIA_POINT:
-		buf =
-		    sqlite3_mprintf ("{\"type\":\"Point\"%s%s,\"coordinates\":",
-				     crs, bbox);
-		strcpy (endJson, "}");
-		break;
-	    case GAIA_LINESTRING:
-		buf =
-		    sqlite3_mprintf
-		    ("{\"type\":\"LineString\"%s%s,\"coordinates\":[", crs,
-		     bbox);
-		strcpy (endJson, "}");
-		break;
-	    case GAIA_POLYGON:
-		buf =
-		    sqlite3_mprintf
-		    ("{\"type\":\"Polygon\"%s%s,\"coordinates\":[", crs, bbox);
-		strcpy (endJson, "}");
-		break;
-	    case GAIA_MULTIPOINT:
-		buf =
-		    sqlite3_mprintf
-		    ("{\"type\":\"MultiPoint\"%s%s,\"coordinates\":[", crs,
-		     bbox);
-		strcpy (endJson, "]}");
-		break;
-	    case GAIA_MULTILINESTRING:
-		buf =
-		    sqlite3_mprintf
-		    ("{\"type\":\"MultiLineString\"%s%s,\"coordinates\":[[",
-		     crs, bbox);
-		strcpy (endJson, "]}");
-		break;
-	    case GAIA_MULTIPOLYGON:
-		buf =
-		    sqlite3_mprintf
-		    ("{\"type\":\"MultiPolygon\"%s%s,\"coordinates\":[[", crs,
-		     bbox);
-		strcpy (endJson, "]}");
-		break;
-	    default:
-		buf =
-		    sqlite3_mprintf
-		    ("{\"type\":\"GeometryCollection\"%s%s,\"geometries\":[",
-		     crs, bbox);
-		strcpy (endJson, "]}");
-		is_multi = 1;
-		break;
-	    };
-	  if (bbox)
-	      sqlite3_free (bbox);
-      }
-    else
-      {
-	  /* omitting BBOX */
-	  switch (geom->DeclaredType)
-	    {
-	    case GAIA_POINT:
-		buf = sqlite3_mprintf ("{\"type\":\"Point\",\"coordinates\":");
-		strcpy (endJson, "}");
-		break;
-	    case GAIA_LINESTRING:
-		buf =
-		    sqlite3_mprintf
-		    ("{\"type\":\"LineString\",\"coordinates\":[");
-		strcpy (endJson, "}");
-		break;
-	    case GAIA_POLYGON:
-		buf =
-		    sqlite3_mprintf ("{\"type\":\"Polygon\",\"coordinates\":[");
-		strcpy (endJson, "}");
-		break;
-	    case GAIA_MULTIPOINT:
-		buf =
-		    sqlite3_mprintf
-		    ("{\"type\":\"MultiPoint\",\"coordinates\":[");
-		strcpy (endJson, "]}");
-		break;
-	    case GAIA_MULTILINESTRING:
-		buf =
-		    sqlite3_mprintf
-		    ("{\"type\":\"MultiLineString\",\"coordinates\":[[");
-		strcpy (endJson, "]}");
-		break;
-	    case GAIA_MULTIPOLYGON:
-		buf =
-		    sqlite3_mprintf
-		    ("{\"type\":\"MultiPolygon\",\"coordinates\":[[");
-		strcpy (endJson, "]}");
-		break;
-	    default:
-		buf =
-		    sqlite3_mprintf
-		    ("{\"type\":\"GeometryCollection\",\"geometries\":[");
-		strcpy (endJson, "]}");
-		is_multi = 1;
-		break;
-	    };
       }
-    gaiaAppendToOutBuffer (out_buf, buf);
-    sqlite3_free (buf);
+    gaiaGeoJsonPutText (writer, coords);
+
     point = geom->FirstPoint;
     while (point)
       {
 	  /* processing POINT */
+	  const char *prefix = "";
 	  if (is_multi)
 	    {
 		if (multi_count > 0)
-		    buf = ",{\"type\":\"Point\",\"coordinates\":";
+		    gaiaGeoJsonPutText (writer,
+					",{\"type\":\"Point\",\"coordinates\":");
 		else
-		    buf = "{\"type\":\"Point\",\"coordinates\":";
-		gaiaAppendToOutBuffer (out_buf, buf);
+		    gaiaGeoJsonPutText (writer,
+					"{\"type\":\"Point\",\"coordinates\":");
 	    }
 	  else if (point != geom->FirstPoint)
 	    {
 		/* adding a further Point */
-		gaiaAppendToOutBuffer (out_buf, ",");
-	    }
-	  buf_x = sqlite3_mprintf ("%.*f", precision, point->X);
-	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%.*f", precision, point->Y);
-	  gaiaOutClean (buf_y);
-	  has_z = 0;
-	  if (point->DimensionModel == GAIA_XY_Z
-	      || point->DimensionModel == GAIA_XY_Z_M)
-	    {
-		buf_z = sqlite3_mprintf ("%.*f", precision, point->Z);
-		gaiaOutClean (buf_z);
-		has_z = 1;
-	    }
-	  if (has_z)
-	    {
-		buf = sqlite3_mprintf ("[%s,%s,%s]", buf_x, buf_y, buf_z);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
-		sqlite3_free (buf_z);
-	    }
-	  else
-	    {
-		buf = sqlite3_mprintf ("[%s,%s]", buf_x, buf_y);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
+		prefix = ",";
 	    }
-	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
+	  gaiaGeoJsonPutVertex (writer, prefix, point->X, point->Y, point->Z,
+				(point->DimensionModel == GAIA_XY_Z
+				 || point->DimensionModel == GAIA_XY_Z_M));
 	  if (is_multi)
 	    {
-		gaiaAppendToOutBuffer (out_buf, "}");
+		gaiaGeoJsonPut (writer, "}", 1);
 		multi_count++;
 	    }
 	  point = point->Next;
@@ -4128,79 +4387,24 @@ gaiaOutGeoJSON (gaiaOutBufferPtr out_buf, gaiaGeomCollPtr geom, int precision,
 	  if (is_multi)
 	    {
 		if (multi_count > 0)
-		    buf = ",{\"type\":\"LineString\",\"coordinates\":[";
+		    gaiaGeoJsonPutText (writer,
+					",{\"type\":\"LineString\",\"coordinates\":[");
 		else
-		    buf = "{\"type\":\"LineString\",\"coordinates\":[";
-		gaiaAppendToOutBuffer (out_buf, buf);
+		    gaiaGeoJsonPutText (writer,
+					"{\"type\":\"LineString\",\"coordinates\":[");
 	    }
 	  else if (line != geom->FirstLinestring)
 	    {
 		/* opening a further LineString */
-		gaiaAppendToOutBuffer (out_buf, ",[");
+		gaiaGeoJsonPut (writer, ",[", 2);
 	    }
-	  for (iv = 0; iv < line->Points; iv++)
+	  gaiaGeoJsonPutCoords (writer, "", line->Points, line->Coords,
+				line->DimensionModel);
+	  /* closing the LineString */
+	  gaiaGeoJsonPut (writer, "]", 1);
+	  if (is_multi)
 	    {
-		/* exporting vertices */
-		has_z = 0;
-		if (line->DimensionModel == GAIA_XY_Z)
-		  {
-		      has_z = 1;
-		      gaiaGetPointXYZ (line->Coords, iv, &x, &y, &z);
-		  }
-		else if (line->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaGetPointXYM (line->Coords, iv, &x, &y, &m);
-		  }
-		else if (line->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      has_z = 1;
-		      gaiaGetPointXYZM (line->Coords, iv, &x, &y, &z, &m);
-		  }
-		else
-		  {
-		      gaiaGetPoint (line->Coords, iv, &x, &y);
-		  }
-		if (has_z)
-		  {
-		      buf_x = sqlite3_mprintf ("%.*f", precision, x);
-		      gaiaOutClean (buf_x);
-		      buf_y = sqlite3_mprintf ("%.*f", precision, y);
-		      gaiaOutClean (buf_y);
-		      buf_z = sqlite3_mprintf ("%.*f", precision, z);
-		      gaiaOutClean (buf_z);
-		      if (iv == 0)
-			  buf =
-			      sqlite3_mprintf ("[%s,%s,%s]", buf_x, buf_y,
-					       buf_z);
-		      else
-			  buf =
-			      sqlite3_mprintf (",[%s,%s,%s]", buf_x, buf_y,
-					       buf_z);
-		      sqlite3_free (buf_x);
-		      sqlite3_free (buf_y);
-		      sqlite3_free (buf_z);
-		  }
-		else
-		  {
-		      buf_x = sqlite3_mprintf ("%.*f", precision, x);
-		      gaiaOutClean (buf_x);
-		      buf_y = sqlite3_mprintf ("%.*f", precision, y);
-		      gaiaOutClean (buf_y);
-		      if (iv == 0)
-			  buf = sqlite3_mprintf ("[%s,%s]", buf_x, buf_y);
-		      else
-			  buf = sqlite3_mprintf (",[%s,%s]", buf_x, buf_y);
-		      sqlite3_free (buf_x);
-		      sqlite3_free (buf_y);
-		  }
-		gaiaAppendToOutBuffer (out_buf, buf);
-		sqlite3_free (buf);
-	    }
-	  /* closing the LineString */
-	  gaiaAppendToOutBuffer (out_buf, "]");
-	  if (is_multi)
-	    {
-		gaiaAppendToOutBuffer (out_buf, "}");
+		gaiaGeoJsonPut (writer, "}", 1);
 		multi_count++;
 	    }
 	  line = line->Next;
@@ -4212,152 +4416,1088 @@ gaiaOutGeoJSON (gaiaOutBufferPtr out_buf, gaiaGeomCollPtr geom, int precision,
 	  if (is_multi)
 	    {
 		if (multi_count > 0)
-		    buf = ",{\"type\":\"Polygon\",\"coordinates\":[";
+		    gaiaGeoJsonPutText (writer,
+					",{\"type\":\"Polygon\",\"coordinates\":[");
 		else
-		    buf = "{\"type\":\"Polygon\",\"coordinates\":[";
-		gaiaAppendToOutBuffer (out_buf, buf);
+		    gaiaGeoJsonPutText (writer,
+					"{\"type\":\"Polygon\",\"coordinates\":[");
 	    }
 	  else if (polyg != geom->FirstPolygon)
 	    {
 		/* opening a further Polygon */
-		gaiaAppendToOutBuffer (out_buf, ",[");
+		gaiaGeoJsonPut (writer, ",[", 2);
 	    }
-	  ring = polyg->Exterior;
-	  for (iv = 0; iv < ring->Points; iv++)
+	  gaiaGeoJsonPutPolygon (writer, polyg);
+	  if (is_multi)
 	    {
-		/* exporting vertices [Interior Ring] */
-		has_z = 0;
-		if (ring->DimensionModel == GAIA_XY_Z)
-		  {
-		      has_z = 1;
-		      gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
-		  }
-		else if (ring->DimensionModel == GAIA_XY_M)
-		  {
-		      gaiaGetPointXYM (ring->Coords, iv, &x, &y, &m);
-		  }
-		else if (ring->DimensionModel == GAIA_XY_Z_M)
-		  {
-		      has_z = 1;
-		      gaiaGetPointXYZM (ring->Coords, iv, &x, &y, &z, &m);
-		  }
-		else
-		  {
-		      gaiaGetPoint (ring->Coords, iv, &x, &y);
-		  }
-		if (has_z)
-		  {
-		      buf_x = sqlite3_mprintf ("%.*f", precision, x);
-		      gaiaOutClean (buf_x);
-		      buf_y = sqlite3_mprintf ("%.*f", precision, y);
-		      gaiaOutClean (buf_y);
-		      buf_z = sqlite3_mprintf ("%.*f", precision, z);
-		      gaiaOutClean (buf_z);
-		      if (iv == 0)
-			  buf =
-			      sqlite3_mprintf ("[[%s,%s,%s]", buf_x, buf_y,
-					       buf_z);
-		      else
-			  buf =
-			      sqlite3_mprintf (",[%s,%s,%s]", buf_x, buf_y,
-					       buf_z);
-		      sqlite3_free (buf_x);
-		      sqlite3_free (buf_y);
-		      sqlite3_free (buf_z);
-		  }
-		else
+		gaiaGeoJsonPut (writer, "}", 1);
+		multi_count++;
+	    }
+	  polyg = polyg->Next;
+      }
+    gaiaGeoJsonPutText (writer, endJson);
+}
+
+static void
+gaiaGeoJsonPutString (gaiaGeoJsonWriterPtr writer, const char *str)
+{
+/* appending a JSON quoted string, escaping any special character */
+    const unsigned char *p = (const unsigned char *) str;
+    const unsigned char *start = p;
+    char esc[8];
+    gaiaGeoJsonPut (writer, "\"", 1);
+    while (*p != '\0')
+      {
+	  if (*p == '"' || *p == '\\' || *p < 0x20)
+	    {
+		if (p > start)
+		    gaiaGeoJsonPut (writer, (const char *) start, p - start);
+		switch (*p)
 		  {
-		      buf_x = sqlite3_mprintf ("%.*f", precision, x);
-		      gaiaOutClean (buf_x);
-		      buf_y = sqlite3_mprintf ("%.*f", precision, y);
-		      gaiaOutClean (buf_y);
-		      if (iv == 0)
-			  buf = sqlite3_mprintf ("[[%s,%s]", buf_x, buf_y);
-		      else
-			  buf = sqlite3_mprintf (",[%s,%s]", buf_x, buf_y);
-		      sqlite3_free (buf_x);
-		      sqlite3_free (buf_y);
-		  }
-		gaiaAppendToOutBuffer (out_buf, buf);
-		sqlite3_free (buf);
+		  case '"':
+		      gaiaGeoJsonPut (writer, "\\\"", 2);
+		      break;
+		  case '\\':
+		      gaiaGeoJsonPut (writer, "\\\\", 2);
+		      break;
+		  case '\n':
+		      gaiaGeoJsonPut (writer, "\\n", 2);
+		      break;
+		  case '\r':
+		      gaiaGeoJsonPut (writer, "\\r", 2);
+		      break;
+		  case '\t':
+		      gaiaGeoJsonPut (writer, "\\t", 2);
+		      break;
+		  default:
+		      sprintf (esc, "\\u%04x", *p);
+		      gaiaGeoJsonPut (writer, esc, 6);
+		      break;
+		  };
+		start = p + 1;
 	    }
-	  /* closing the Exterior Ring */
-	  gaiaAppendToOutBuffer (out_buf, "]");
-	  for (ib = 0; ib < polyg->NumInteriors; ib++)
+	  p++;
+      }
+    if (p > start)
+	gaiaGeoJsonPut (writer, (const char *) start, p - start);
+    gaiaGeoJsonPut (writer, "\"", 1);
+}
+
+GAIAGEO_DECLARE void
+gaiaGeoJsonWriteRaw (gaiaGeoJsonWriterPtr writer, const char *text, int len)
+{
+/* appending some verbatim text */
+    if (len < 0)
+	len = strlen (text);
+    gaiaGeoJsonPut (writer, text, len);
+}
+
+GAIAGEO_DECLARE void
+gaiaGeoJsonBeginFeatureCollection (gaiaGeoJsonWriterPtr writer)
+{
+/* opening a FeatureCollection */
+    gaiaGeoJsonPutText (writer,
+			"{\"type\":\"FeatureCollection\",\"features\":[");
+    writer->Features = 0;
+}
+
+GAIAGEO_DECLARE void
+gaiaGeoJsonEndFeatureCollection (gaiaGeoJsonWriterPtr writer)
+{
+/* closing a FeatureCollection */
+    gaiaGeoJsonPut (writer, "]}", 2);
+}
+
+GAIAGEO_DECLARE void
+gaiaGeoJsonBeginFeature (gaiaGeoJsonWriterPtr writer, gaiaGeomCollPtr geom)
+{
+/* opening a Feature */
+    if (writer->Features > 0)
+	gaiaGeoJsonPut (writer, ",\n", 2);
+    gaiaGeoJsonPutText (writer, "{\"type\":\"Feature\",\"geometry\":");
+    gaiaGeoJsonWriteGeometry (writer, geom);
+    gaiaGeoJsonPutText (writer, ",\"properties\":{");
+    writer->Properties = 0;
+}
+
+GAIAGEO_DECLARE void
+gaiaGeoJsonEndFeature (gaiaGeoJsonWriterPtr writer)
+{
+/* closing a Feature */
+    gaiaGeoJsonPut (writer, "}}", 2);
+    writer->Features += 1;
+}
+
+static void
+gaiaGeoJsonPutPropertyName (gaiaGeoJsonWriterPtr writer, const char *name)
+{
+/* appending a Property name */
+    if (writer->Properties > 0)
+	gaiaGeoJsonPut (writer, ",", 1);
+    gaiaGeoJsonPutString (writer, name);
+    gaiaGeoJsonPut (writer, ":", 1);
+    writer->Properties += 1;
+}
+
+GAIAGEO_DECLARE void
+gaiaGeoJsonAddIntProperty (gaiaGeoJsonWriterPtr writer, const char *name,
+			   sqlite3_int64 value)
+{
+/* adding an Integer Property */
+    char buf[64];
+    gaiaGeoJsonPutPropertyName (writer, name);
+    sqlite3_snprintf (sizeof (buf), buf, "%lld", value);
+    gaiaGeoJsonPutText (writer, buf);
+}
+
+GAIAGEO_DECLARE void
+gaiaGeoJsonAddDoubleProperty (gaiaGeoJsonWriterPtr writer, const char *name,
+			      double value)
+{
+/* adding a Double Property */
+    char buf[64];
+    gaiaGeoJsonPutPropertyName (writer, name);
+    if (value != value || value > 1.7976931348623157e308
+	|| value < -1.7976931348623157e308)
+      {
+	  /* NaN or Infinite: not supported by JSON */
+	  gaiaGeoJsonPut (writer, "null", 4);
+	  return;
+      }
+    sqlite3_snprintf (sizeof (buf), buf, "%1.15g", value);
+    gaiaGeoJsonPutText (writer, buf);
+}
+
+GAIAGEO_DECLARE void
+gaiaGeoJsonAddTextProperty (gaiaGeoJsonWriterPtr writer, const char *name,
+			    const char *value)
+{
+/* adding a Text Property */
+    gaiaGeoJsonPutPropertyName (writer, name);
+    if (value == NULL)
+	gaiaGeoJsonPut (writer, "null", 4);
+    else
+	gaiaGeoJsonPutString (writer, value);
+}
+
+GAIAGEO_DECLARE void
+gaiaGeoJsonAddNullProperty (gaiaGeoJsonWriterPtr writer, const char *name)
+{
+/* adding a NULL Property */
+    gaiaGeoJsonPutPropertyName (writer, name);
+    gaiaGeoJsonPut (writer, "null", 4);
+}
+
+GAIAGEO_DECLARE int
+gaiaGeoJsonWriterFlush (gaiaGeoJsonWriterPtr writer)
+{
+/* flushing any pending output */
+    if (writer->Error)
+	return 0;
+    if (writer->Buffer != writer->Block)
+      {
+	  /* caller supplied buffer: just NULL-terminating */
+	  writer->Buffer[writer->WriteOffset] = '\0';
+	  return 1;
+      }
+    if (writer->WriteOffset > 0)
+	return gaiaGeoJsonWriterDrain (writer);
+    return 1;
+}
+
+GAIAGEO_DECLARE void
+gaiaOutGeoJSON (gaiaOutBufferPtr out_buf, gaiaGeomCollPtr geom, int precision,
+		int options)
+{
+/*
+/ prints the GeoJSON representation of current geometry
+/ *result* returns the encoded GeoJSON or NULL if any error is encountered
+*/
+    gaiaGeoJsonWriter writer;
+    if (!geom)
+	return;
+    gaiaGeoJsonWriterInitOutBuffer (&writer, out_buf, precision, options);
+    gaiaGeoJsonWriteGeometry (&writer, geom);
+    if (!gaiaGeoJsonWriterFlush (&writer))
+	out_buf->Error = 1;
+}
+
+/*
+/ single-pass parser for WKT, EWKT and GeoJSON geometries
+/
+/ the common cases are decoded straight into the final coordinate 
+/ arrays: vertices are collected into a (mostly stack based) scratch
+/ buffer, and each Linestring/Ring is then allocated just once with 
+/ its exact size
+/
+/ this parser accepts a strict subset of the Flex/Lemon grammars; 
+/ any unsupported or unusual input (including any syntax error) simply
+/ makes it to give up, so that the caller can fall back to the full
+/ Flex/Lemon parser, which remains the reference implementation
+*/
+
+#define GAIA_TXT_WKT		1
+#define GAIA_TXT_EWKT		2
+#define GAIA_TXT_GEOJSON	3
+
+#define GAIA_TXT_SCRATCH	1024
+#define GAIA_TXT_RINGS		32
+
+struct gaia_txt_parser
+{
+/* a struct supporting the single-pass text parser */
+    const char *p;
+    int syntax;
+    int has_m;
+    int dims;
+    int coords;
+    gaiaGeomCollPtr geom;
+    double *scratch;
+    int scratch_size;
+    int scratch_used;
+    int *rings;
+    int rings_size;
+    int rings_count;
+    double static_scratch[GAIA_TXT_SCRATCH];
+    int static_rings[GAIA_TXT_RINGS];
+};
+
+static const double gaia_txt_pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static void
+gaiaTxtParserInit (struct gaia_txt_parser *parser, const unsigned char *text,
+		   int syntax)
+{
+/* initializing the text parser */
+    parser->p = (const char *) text;
+    parser->syntax = syntax;
+    parser->has_m = 0;
+    parser->dims = GAIA_XY;
+    parser->coords = 0;
+    parser->geom = NULL;
+    parser->scratch = parser->static_scratch;
+    parser->scratch_size = GAIA_TXT_SCRATCH;
+    parser->scratch_used = 0;
+    parser->rings = parser->static_rings;
+    parser->rings_size = GAIA_TXT_RINGS;
+    parser->rings_count = 0;
+}
+
+static gaiaGeomCollPtr
+gaiaTxtParserDone (struct gaia_txt_parser *parser, int ok)
+{
+/* cleaning up the text parser and returning the Geometry (if any) */
+    gaiaGeomCollPtr geom = parser->geom;
+    if (parser->scratch != parser->static_scratch)
+	free (parser->scratch);
+    if (parser->rings != parser->static_rings)
+	free (parser->rings);
+    if (!ok || geom == NULL)
+      {
+	  if (geom != NULL)
+	      gaiaFreeGeomColl (geom);
+	  return NULL;
+      }
+    return geom;
+}
+
+static void
+gaiaTxtSkipBlanks (struct gaia_txt_parser *parser)
+{
+/* skipping any whitespace (the same ones accepted by the Flex lexers) */
+    while (*(parser->p) == ' ' || *(parser->p) == '\t'
+	   || *(parser->p) == '\n')
+	parser->p++;
+}
+
+static int
+gaiaTxtExpect (struct gaia_txt_parser *parser, char c)
+{
+/* consuming the expected punctuation char */
+    gaiaTxtSkipBlanks (parser);
+    if (*(parser->p) != c)
+	return 0;
+    parser->p++;
+    return 1;
+}
+
+static int
+gaiaTxtExpectToken (struct gaia_txt_parser *parser, const char *token)
+{
+/* consuming the expected (case sensitive) token */
+    int len = strlen (token);
+    gaiaTxtSkipBlanks (parser);
+    if (strncmp (parser->p, token, len) != 0)
+	return 0;
+    parser->p += len;
+    return 1;
+}
+
+static int
+gaiaTxtParseNumber (struct gaia_txt_parser *parser, double *value)
+{
+/* 
+/ parsing a number: [+-]?[0-9]+(.[0-9]*)? exactly as the Flex lexers do
+/
+/ short mantissas are directly converted (the result is exact, being
+/ a correctly rounded division of two exactly representable values);
+/ any other number is passed to atof() as the lexers did
+*/
+    const char *p = parser->p;
+    const char *start = p;
+    sqlite3_uint64 mantissa = 0;
+    int digits = 0;
+    int decimals = 0;
+    int negative = 0;
+    int d;
+    double val;
+    if (*p == '-')
+      {
+	  negative = 1;
+	  p++;
+      }
+    else if (*p == '+')
+	p++;
+    if (*p < '0' || *p > '9')
+	return 0;
+    while (*p >= '0' && *p <= '9')
+      {
+	  d = *p++ - '0';
+	  if (mantissa == 0 && d == 0)
+	      continue;
+	  if (digits < 19)
+	      mantissa = (mantissa * 10) + d;
+	  digits++;
+      }
+    if (*p == '.')
+      {
+	  p++;
+	  while (*p >= '0' && *p <= '9')
 	    {
-		/* interior rings */
-		ring = polyg->Interiors + ib;
-		for (iv = 0; iv < ring->Points; iv++)
+		d = *p++ - '0';
+		decimals++;
+		if (mantissa == 0 && d == 0)
+		    continue;
+		if (digits < 19)
+		    mantissa = (mantissa * 10) + d;
+		digits++;
+	    }
+      }
+    switch (*p)
+      {
+	  /* a number is always followed by some separator */
+      case ' ':
+      case '\t':
+      case '\n':
+      case ',':
+      case ')':
+      case ']':
+	  break;
+      default:
+	  return 0;
+      };
+    if (digits <= 15 && decimals <= 22)
+      {
+	  val = (double) mantissa;
+	  if (decimals > 0)
+	      val /= gaia_txt_pow10[decimals];
+	  if (negative)
+	      val = -val;
+      }
+    else
+      {
+	  char buf[64];
+	  int len = p - start;
+	  if (len >= (int) sizeof (buf))
+	      return 0;
+	  memcpy (buf, start, len);
+	  buf[len] = '\0';
+	  val = atof (buf);
+      }
+    *value = val;
+    parser->p = p;
+    return 1;
+}
+
+static int
+gaiaTxtSetDims (struct gaia_txt_parser *parser, int count)
+{
+/* setting the dimensions from the first vertex */
+    if (parser->syntax == GAIA_TXT_GEOJSON)
+      {
+	  if (count == 2)
+	      parser->dims = GAIA_XY;
+	  else if (count == 3)
+	      parser->dims = GAIA_XY_Z;
+	  else
+	      return 0;
+      }
+    else if (parser->has_m)
+      {
+	  if (count != 3)
+	      return 0;
+	  parser->dims = GAIA_XY_M;
+      }
+    else
+      {
+	  if (count == 2)
+	      parser->dims = GAIA_XY;
+	  else if (count == 3)
+	      parser->dims = GAIA_XY_Z;
+	  else if (count == 4)
+	      parser->dims = GAIA_XY_Z_M;
+	  else
+	      return 0;
+      }
+    parser->coords = count;
+    return 1;
+}
+
+static int
+gaiaTxtParseVertex (struct gaia_txt_parser *parser)
+{
+/* parsing a single vertex into the scratch buffer */
+    double coords[4];
+    int count = 0;
+    if (parser->syntax == GAIA_TXT_GEOJSON)
+      {
+	  /* [x,y] or [x,y,z] */
+	  if (!gaiaTxtExpect (parser, '['))
+	      return 0;
+	  while (1)
+	    {
+		gaiaTxtSkipBlanks (parser);
+		if (!gaiaTxtParseNumber (parser, coords + count))
+		    return 0;
+		count++;
+		if (gaiaTxtExpect (parser, ']'))
+		    break;
+		if (count == 4 || !gaiaTxtExpect (parser, ','))
+		    return 0;
+	    }
+      }
+    else
+      {
+	  /* blank separated coordinates */
+	  while (count < 4)
+	    {
+		gaiaTxtSkipBlanks (parser);
+		if (!gaiaTxtParseNumber (parser, coords + count))
+		    break;
+		count++;
+	    }
+      }
+    if (parser->coords == 0)
+      {
+	  if (!gaiaTxtSetDims (parser, count))
+	      return 0;
+      }
+    else if (count != parser->coords)
+	return 0;
+    if (parser->scratch_used + count > parser->scratch_size)
+      {
+	  /* doubling the scratch buffer */
+	  double *buf = malloc (sizeof (double) * parser->scratch_size * 2);
+	  if (buf == NULL)
+	      return 0;
+	  memcpy (buf, parser->scratch, sizeof (double) * parser->scratch_used);
+	  if (parser->scratch != parser->static_scratch)
+	      free (parser->scratch);
+	  parser->scratch = buf;
+	  parser->scratch_size *= 2;
+      }
+    memcpy (parser->scratch + parser->scratch_used, coords,
+	    sizeof (double) * count);
+    parser->scratch_used += count;
+    return 1;
+}
+
+static gaiaGeomCollPtr
+gaiaTxtGeometry (struct gaia_txt_parser *parser)
+{
+/* lazily allocating the output Geometry (dimensions are now known) */
+    if (parser->geom == NULL)
+      {
+	  if (parser->dims == GAIA_XY_Z)
+	      parser->geom = gaiaAllocGeomCollXYZ ();
+	  else if (parser->dims == GAIA_XY_M)
+	      parser->geom = gaiaAllocGeomCollXYM ();
+	  else if (parser->dims == GAIA_XY_Z_M)
+	      parser->geom = gaiaAllocGeomCollXYZM ();
+	  else
+	      parser->geom = gaiaAllocGeomColl ();
+      }
+    return parser->geom;
+}
+
+static int
+gaiaTxtFlushPoints (struct gaia_txt_parser *parser)
+{
+/* moving all the scratch vertices into the Geometry as Points */
+    gaiaGeomCollPtr geom = gaiaTxtGeometry (parser);
+    double *v = parser->scratch;
+    double *end = parser->scratch + parser->scratch_used;
+    if (geom == NULL)
+	return 0;
+    for (; v < end; v += parser->coords)
+      {
+	  if (parser->dims == GAIA_XY_Z)
+	      gaiaAddPointToGeomCollXYZ (geom, v[0], v[1], v[2]);
+	  else if (parser->dims == GAIA_XY_M)
+	      gaiaAddPointToGeomCollXYM (geom, v[0], v[1], v[2]);
+	  else if (parser->dims == GAIA_XY_Z_M)
+	      gaiaAddPointToGeomCollXYZM (geom, v[0], v[1], v[2], v[3]);
+	  else
+	      gaiaAddPointToGeomColl (geom, v[0], v[1]);
+      }
+    parser->scratch_used = 0;
+    return 1;
+}
+
+static int
+gaiaTxtFlushLinestring (struct gaia_txt_parser *parser)
+{
+/* moving all the scratch vertices into the Geometry as a Linestring */
+    gaiaLinestringPtr ln;
+    gaiaGeomCollPtr geom = gaiaTxtGeometry (parser);
+    if (geom == NULL)
+	return 0;
+    ln = gaiaAddLinestringToGeomColl (geom,
+				      parser->scratch_used / parser->coords);
+    memcpy (ln->Coords, parser->scratch,
+	    sizeof (double) * parser->scratch_used);
+    parser->scratch_used = 0;
+    return 1;
+}
+
+static int
+gaiaTxtFlushPolygon (struct gaia_txt_parser *parser)
+{
+/* moving all the scratch rings into the Geometry as a Polygon */
+    gaiaPolygonPtr pg;
+    gaiaRingPtr rng;
+    int ib;
+    int len;
+    double *v = parser->scratch;
+    gaiaGeomCollPtr geom = gaiaTxtGeometry (parser);
+    if (geom == NULL)
+	return 0;
+    pg = gaiaAddPolygonToGeomColl (geom, parser->rings[0],
+				   parser->rings_count - 1);
+    len = parser->rings[0] * parser->coords;
+    memcpy (pg->Exterior->Coords, v, sizeof (double) * len);
+    v += len;
+    for (ib = 1; ib < parser->rings_count; ib++)
+      {
+	  rng = gaiaAddInteriorRing (pg, ib - 1, parser->rings[ib]);
+	  len = parser->rings[ib] * parser->coords;
+	  memcpy (rng->Coords, v, sizeof (double) * len);
+	  v += len;
+      }
+    parser->scratch_used = 0;
+    parser->rings_count = 0;
+    return 1;
+}
+
+static int
+gaiaTxtParseCoordList (struct gaia_txt_parser *parser, int min_points)
+{
+/* parsing a bracketed list of vertices; returns the number of points */
+    int count = 0;
+    char open = (parser->syntax == GAIA_TXT_GEOJSON) ? '[' : '(';
+    char close = (parser->syntax == GAIA_TXT_GEOJSON) ? ']' : ')';
+    if (!gaiaTxtExpect (parser, open))
+	return 0;
+    while (1)
+      {
+	  if (!gaiaTxtParseVertex (parser))
+	      return 0;
+	  count++;
+	  if (gaiaTxtExpect (parser, close))
+	      break;
+	  if (!gaiaTxtExpect (parser, ','))
+	      return 0;
+      }
+    if (count < min_points)
+	return 0;
+    return count;
+}
+
+static int
+gaiaTxtParsePoint (struct gaia_txt_parser *parser)
+{
+/* parsing a Point */
+    if (parser->syntax == GAIA_TXT_GEOJSON)
+      {
+	  if (!gaiaTxtParseVertex (parser))
+	      return 0;
+      }
+    else
+      {
+	  if (!gaiaTxtExpect (parser, '('))
+	      return 0;
+	  if (!gaiaTxtParseVertex (parser))
+	      return 0;
+	  if (!gaiaTxtExpect (parser, ')'))
+	      return 0;
+      }
+    return gaiaTxtFlushPoints (parser);
+}
+
+static int
+gaiaTxtParseLinestring (struct gaia_txt_parser *parser)
+{
+/* parsing a Linestring */
+    if (!gaiaTxtParseCoordList (parser, 2))
+	return 0;
+    return gaiaTxtFlushLinestring (parser);
+}
+
+static int
+gaiaTxtParsePolygon (struct gaia_txt_parser *parser)
+{
+/* parsing a Polygon */
+    int points;
+    char open = (parser->syntax == GAIA_TXT_GEOJSON) ? '[' : '(';
+    char close = (parser->syntax == GAIA_TXT_GEOJSON) ? ']' : ')';
+    if (!gaiaTxtExpect (parser, open))
+	return 0;
+    while (1)
+      {
+	  points = gaiaTxtParseCoordList (parser, 4);
+	  if (!points)
+	      return 0;
+	  if (parser->rings_count == parser->rings_size)
+	    {
+		/* doubling the rings array */
+		int *buf = malloc (sizeof (int) * parser->rings_size * 2);
+		if (buf == NULL)
+		    return 0;
+		memcpy (buf, parser->rings, sizeof (int) * parser->rings_count);
+		if (parser->rings != parser->static_rings)
+		    free (parser->rings);
+		parser->rings = buf;
+		parser->rings_size *= 2;
+	    }
+	  parser->rings[parser->rings_count++] = points;
+	  if (gaiaTxtExpect (parser, close))
+	      break;
+	  if (!gaiaTxtExpect (parser, ','))
+	      return 0;
+      }
+    return gaiaTxtFlushPolygon (parser);
+}
+
+static int
+gaiaTxtParseMultiPoint (struct gaia_txt_parser *parser)
+{
+/* parsing a MultiPoint */
+    const char *mark = parser->p;
+    if (parser->syntax != GAIA_TXT_GEOJSON)
+      {
+	  if (!gaiaTxtExpect (parser, '('))
+	      return 0;
+	  gaiaTxtSkipBlanks (parser);
+	  if (*(parser->p) == '(')
+	    {
+		/* MULTIPOINT((x y), (x y) ...) */
+		while (1)
 		  {
-		      /* exporting vertices [Interior Ring] */
-		      has_z = 0;
-		      if (ring->DimensionModel == GAIA_XY_Z)
-			{
-			    has_z = 1;
-			    gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
-			}
-		      else if (ring->DimensionModel == GAIA_XY_M)
-			{
-			    gaiaGetPointXYM (ring->Coords, iv, &x, &y, &m);
-			}
-		      else if (ring->DimensionModel == GAIA_XY_Z_M)
-			{
-			    has_z = 1;
-			    gaiaGetPointXYZM (ring->Coords, iv, &x, &y, &z, &m);
-			}
-		      else
-			{
-			    gaiaGetPoint (ring->Coords, iv, &x, &y);
-			}
-		      if (has_z)
-			{
-			    buf_x = sqlite3_mprintf ("%.*f", precision, x);
-			    gaiaOutClean (buf_x);
-			    buf_y = sqlite3_mprintf ("%.*f", precision, y);
-			    gaiaOutClean (buf_y);
-			    buf_z = sqlite3_mprintf ("%.*f", precision, z);
-			    gaiaOutClean (buf_z);
-			    if (iv == 0)
-				buf =
-				    sqlite3_mprintf (",[[%s,%s,%s]", buf_x,
-						     buf_y, buf_z);
-			    else
-				buf =
-				    sqlite3_mprintf (",[%s,%s,%s]", buf_x,
-						     buf_y, buf_z);
-			    sqlite3_free (buf_x);
-			    sqlite3_free (buf_y);
-			    sqlite3_free (buf_z);
-			}
-		      else
-			{
-			    buf_x = sqlite3_mprintf ("%.*f", precision, x);
-			    gaiaOutClean (buf_x);
-			    buf_y = sqlite3_mprintf ("%.*f", precision, y);
-			    gaiaOutClean (buf_y);
-			    if (iv == 0)
-				buf =
-				    sqlite3_mprintf (",[[%s,%s]", buf_x, buf_y);
-			    else
-				buf =
-				    sqlite3_mprintf (",[%s,%s]", buf_x, buf_y);
-			    sqlite3_free (buf_x);
-			    sqlite3_free (buf_y);
-			}
-		      gaiaAppendToOutBuffer (out_buf, buf);
-		      sqlite3_free (buf);
+		      if (!gaiaTxtExpect (parser, '('))
+			  return 0;
+		      if (!gaiaTxtParseVertex (parser))
+			  return 0;
+		      if (!gaiaTxtExpect (parser, ')'))
+			  return 0;
+		      if (gaiaTxtExpect (parser, ')'))
+			  break;
+		      if (!gaiaTxtExpect (parser, ','))
+			  return 0;
 		  }
-		/* closing the Interior Ring */
-		gaiaAppendToOutBuffer (out_buf, "]");
+		return gaiaTxtFlushPoints (parser);
 	    }
-	  /* closing the Polygon */
-	  gaiaAppendToOutBuffer (out_buf, "]");
-	  if (is_multi)
+	  parser->p = mark;
+      }
+    if (!gaiaTxtParseCoordList (parser, 1))
+	return 0;
+    return gaiaTxtFlushPoints (parser);
+}
+
+static int
+gaiaTxtParseCollectionOf (struct gaia_txt_parser *parser,
+			  int (*parse_item) (struct gaia_txt_parser *))
+{
+/* parsing a bracketed list of Linestrings or Polygons */
+    char open = (parser->syntax == GAIA_TXT_GEOJSON) ? '[' : '(';
+    char close = (parser->syntax == GAIA_TXT_GEOJSON) ? ']' : ')';
+    if (!gaiaTxtExpect (parser, open))
+	return 0;
+    while (1)
+      {
+	  if (!parse_item (parser))
+	      return 0;
+	  if (gaiaTxtExpect (parser, close))
+	      break;
+	  if (!gaiaTxtExpect (parser, ','))
+	      return 0;
+      }
+    return 1;
+}
+
+static int
+gaiaTxtParseBody (struct gaia_txt_parser *parser, int type)
+{
+/* parsing the coordinates of some Geometry class */
+    switch (type)
+      {
+      case GAIA_POINT:
+	  return gaiaTxtParsePoint (parser);
+      case GAIA_LINESTRING:
+	  return gaiaTxtParseLinestring (parser);
+      case GAIA_POLYGON:
+	  return gaiaTxtParsePolygon (parser);
+      case GAIA_MULTIPOINT:
+	  return gaiaTxtParseMultiPoint (parser);
+      case GAIA_MULTILINESTRING:
+	  return gaiaTxtParseCollectionOf (parser, gaiaTxtParseLinestring);
+      case GAIA_MULTIPOLYGON:
+	  return gaiaTxtParseCollectionOf (parser, gaiaTxtParsePolygon);
+      };
+    return 0;
+}
+
+static int
+gaiaTxtDeclaredType (int type, int dims)
+{
+/* Points are the only class declaring their own dimensions */
+    if (type != GAIA_POINT)
+	return type;
+    if (dims == GAIA_XY_Z)
+	return GAIA_POINTZ;
+    if (dims == GAIA_XY_M)
+	return GAIA_POINTM;
+    if (dims == GAIA_XY_Z_M)
+	return GAIA_POINTZM;
+    return GAIA_POINT;
+}
+
+static int
+gaiaTxtParseKeyword (struct gaia_txt_parser *parser, int *type, int *dims,
+		     int *has_m)
+{
+/* parsing a WKT/EWKT class name, including any dimension suffix */
+    static const char *names[] = {
+	"POINT", "LINESTRING", "POLYGON", "MULTIPOINT",
+	"MULTILINESTRING", "MULTIPOLYGON", "GEOMETRYCOLLECTION", NULL
+    };
+    static const int types[] = {
+	GAIA_POINT, GAIA_LINESTRING, GAIA_POLYGON, GAIA_MULTIPOINT,
+	GAIA_MULTILINESTRING, GAIA_MULTIPOLYGON, GAIA_GEOMETRYCOLLECTION
+    };
+    const char *start;
+    const char *suffix = NULL;
+    int len;
+    int suffix_len = 0;
+    int i;
+    gaiaTxtSkipBlanks (parser);
+    start = parser->p;
+    while ((*(parser->p) >= 'A' && *(parser->p) <= 'Z')
+	   || (*(parser->p) >= 'a' && *(parser->p) <= 'z'))
+	parser->p++;
+    len = parser->p - start;
+    for (i = 0; names[i] != NULL; i++)
+      {
+	  int name_len = strlen (names[i]);
+	  if (len >= name_len && strncasecmp (start, names[i], name_len) == 0)
 	    {
-		gaiaAppendToOutBuffer (out_buf, "}");
-		multi_count++;
+		suffix = start + name_len;
+		suffix_len = len - name_len;
+		if (suffix_len > 2)
+		    continue;
+		*type = types[i];
+		break;
 	    }
-	  polyg = polyg->Next;
       }
-    gaiaAppendToOutBuffer (out_buf, endJson);
+    if (names[i] == NULL)
+	return 0;
+    if (parser->syntax == GAIA_TXT_WKT && suffix_len == 0)
+      {
+	  /* the Z/M/ZM suffix could be separated by blanks */
+	  const char *mark = parser->p;
+	  gaiaTxtSkipBlanks (parser);
+	  suffix = parser->p;
+	  while ((*(parser->p) >= 'A' && *(parser->p) <= 'Z')
+		 || (*(parser->p) >= 'a' && *(parser->p) <= 'z'))
+	      parser->p++;
+	  suffix_len = parser->p - suffix;
+	  if (!(suffix_len == 1 && (*suffix == 'Z' || *suffix == 'z'
+				    || *suffix == 'M' || *suffix == 'm'))
+	      && !(suffix_len == 2 && strncasecmp (suffix, "ZM", 2) == 0))
+	    {
+		parser->p = mark;
+		suffix_len = 0;
+	    }
+      }
+    *dims = GAIA_XY;
+    *has_m = 0;
+    if (suffix_len == 0)
+	return 1;
+    if (parser->syntax == GAIA_TXT_EWKT)
+      {
+	  /* EWKT: only an "M" suffix is allowed */
+	  if (suffix_len == 1 && (*suffix == 'M' || *suffix == 'm'))
+	    {
+		*dims = GAIA_XY_M;
+		*has_m = 1;
+		return 1;
+	    }
+	  return 0;
+      }
+    if (suffix_len == 2 && strncasecmp (suffix, "ZM", 2) == 0)
+	*dims = GAIA_XY_Z_M;
+    else if (suffix_len == 1 && (*suffix == 'Z' || *suffix == 'z'))
+	*dims = GAIA_XY_Z;
+    else if (suffix_len == 1 && (*suffix == 'M' || *suffix == 'm'))
+	*dims = GAIA_XY_M;
+    else
+	return 0;
+    return 1;
+}
+
+static int
+gaiaTxtWktCoords (int dims)
+{
+/* number of coordinates per vertex */
+    if (dims == GAIA_XY_Z_M)
+	return 4;
+    if (dims == GAIA_XY_Z || dims == GAIA_XY_M)
+	return 3;
+    return 2;
+}
+
+static int
+gaiaTxtParseWktGeometry (struct gaia_txt_parser *parser, int *type)
+{
+/* parsing a complete WKT/EWKT Geometry */
+    int dims;
+    int has_m;
+    int item_type;
+    int item_dims;
+    int item_has_m;
+    if (!gaiaTxtParseKeyword (parser, type, &dims, &has_m))
+	return 0;
+    parser->has_m = has_m;
+    if (parser->syntax == GAIA_TXT_WKT)
+      {
+	  /* WKT: the dimensions are declared by the keyword */
+	  parser->dims = dims;
+	  parser->coords = gaiaTxtWktCoords (dims);
+      }
+    if (*type != GAIA_GEOMETRYCOLLECTION)
+	return gaiaTxtParseBody (parser, *type);
+
+    /* GeometryCollection: nested collections are left to the full parser */
+    if (!gaiaTxtExpect (parser, '('))
+	return 0;
+    while (1)
+      {
+	  if (!gaiaTxtParseKeyword (parser, &item_type, &item_dims, &item_has_m))
+	      return 0;
+	  if (item_type == GAIA_GEOMETRYCOLLECTION)
+	      return 0;
+	  if (item_dims != dims || item_has_m != has_m)
+	      return 0;
+	  if (!gaiaTxtParseBody (parser, item_type))
+	      return 0;
+	  if (gaiaTxtExpect (parser, ')'))
+	      break;
+	  if (!gaiaTxtExpect (parser, ','))
+	      return 0;
+      }
+    return 1;
+}
+
+SPATIALITE_PRIVATE void *
+gaiaFastParseWkt (const unsigned char *text, int ewkt)
+{
+/* 
+/ single-pass WKT (or EWKT, SRID prefix excluded) parser
+/ returns NULL if the input isn't supported, the caller is then 
+/ expected to fall back to the full Flex/Lemon parser
+*/
+    struct gaia_txt_parser parser;
+    int type;
+    int ok;
+    gaiaTxtParserInit (&parser, text, ewkt ? GAIA_TXT_EWKT : GAIA_TXT_WKT);
+    ok = gaiaTxtParseWktGeometry (&parser, &type);
+    if (ok)
+      {
+	  /* nothing but blanks is expected to follow */
+	  gaiaTxtSkipBlanks (&parser);
+	  if (*(parser.p) != '\0')
+	      ok = 0;
+      }
+    if (ok && parser.geom != NULL)
+	parser.geom->DeclaredType = gaiaTxtDeclaredType (type, parser.dims);
+    return gaiaTxtParserDone (&parser, ok);
+}
+
+static int
+gaiaTxtParseJsonSrid (struct gaia_txt_parser *parser, int *srid)
+{
+/* parsing a GeoJSON CRS object - short or long format */
+    int digits = 0;
+    int value = 0;
+    int negative = 0;
+    if (!gaiaTxtExpect (parser, '{'))
+	return 0;
+    if (!gaiaTxtExpectToken (parser, "\"type\""))
+	return 0;
+    if (!gaiaTxtExpect (parser, ':'))
+	return 0;
+    if (!gaiaTxtExpectToken (parser, "\"name\""))
+	return 0;
+    if (!gaiaTxtExpect (parser, ','))
+	return 0;
+    if (!gaiaTxtExpectToken (parser, "\"properties\""))
+	return 0;
+    if (!gaiaTxtExpect (parser, ':'))
+	return 0;
+    if (!gaiaTxtExpect (parser, '{'))
+	return 0;
+    if (!gaiaTxtExpectToken (parser, "\"name\""))
+	return 0;
+    if (!gaiaTxtExpect (parser, ':'))
+	return 0;
+    if (!gaiaTxtExpectToken (parser, "\"EPSG:")
+	&& !gaiaTxtExpectToken (parser, "\"urn:ogc:def:crs:EPSG:"))
+	return 0;
+    if (*(parser->p) == '-')
+      {
+	  negative = 1;
+	  parser->p++;
+      }
+    while (*(parser->p) >= '0' && *(parser->p) <= '9')
+      {
+	  value = (value * 10) + (*(parser->p) - '0');
+	  parser->p++;
+	  digits++;
+	  if (digits > 9)
+	      return 0;
+      }
+    if (digits == 0 || *(parser->p) != '"')
+	return 0;
+    parser->p++;
+    if (!gaiaTxtExpect (parser, '}'))
+	return 0;
+    if (!gaiaTxtExpect (parser, '}'))
+	return 0;
+    *srid = negative ? -value : value;
+    return 1;
+}
+
+static int
+gaiaTxtParseJsonGeometry (struct gaia_txt_parser *parser, int *type,
+			  int *srid, int *has_crs)
+{
+/* parsing a complete GeoJSON Geometry */
+    static const char *names[] = {
+	"\"Point\"", "\"LineString\"", "\"Polygon\"", "\"MultiPoint\"",
+	"\"MultiLineString\"", "\"MultiPolygon\"", NULL
+    };
+    static const int types[] = {
+	GAIA_POINT, GAIA_LINESTRING, GAIA_POLYGON, GAIA_MULTIPOINT,
+	GAIA_MULTILINESTRING, GAIA_MULTIPOLYGON
+    };
+    int i;
+    double bbox;
+    if (!gaiaTxtExpect (parser, '{'))
+	return 0;
+    if (!gaiaTxtExpectToken (parser, "\"type\""))
+	return 0;
+    if (!gaiaTxtExpect (parser, ':'))
+	return 0;
+    for (i = 0; names[i] != NULL; i++)
+      {
+	  if (gaiaTxtExpectToken (parser, names[i]))
+	      break;
+      }
+    if (names[i] == NULL)
+	return 0;
+    *type = types[i];
+    if (!gaiaTxtExpect (parser, ','))
+	return 0;
+    if (gaiaTxtExpectToken (parser, "\"crs\""))
+      {
+	  if (!gaiaTxtExpect (parser, ':'))
+	      return 0;
+	  if (!gaiaTxtParseJsonSrid (parser, srid))
+	      return 0;
+	  if (!gaiaTxtExpect (parser, ','))
+	      return 0;
+	  *has_crs = 1;
+      }
+    if (gaiaTxtExpectToken (parser, "\"bbox\""))
+      {
+	  /* the BBOX is simply ignored */
+	  if (!gaiaTxtExpect (parser, ':'))
+	      return 0;
+	  if (!gaiaTxtExpect (parser, '['))
+	      return 0;
+	  for (i = 0; i < 4; i++)
+	    {
+		if (i > 0 && !gaiaTxtExpect (parser, ','))
+		    return 0;
+		gaiaTxtSkipBlanks (parser);
+		if (!gaiaTxtParseNumber (parser, &bbox))
+		    return 0;
+	    }
+	  if (!gaiaTxtExpect (parser, ']'))
+	      return 0;
+	  if (!gaiaTxtExpect (parser, ','))
+	      return 0;
+      }
+    if (!gaiaTxtExpectToken (parser, "\"coordinates\""))
+	return 0;
+    if (!gaiaTxtExpect (parser, ':'))
+	return 0;
+    if (!gaiaTxtParseBody (parser, *type))
+	return 0;
+    return gaiaTxtExpect (parser, '}');
+}
+
+SPATIALITE_PRIVATE void *
+gaiaFastParseGeoJSON (const unsigned char *text)
+{
+/* 
+/ single-pass GeoJSON parser
+/ returns NULL if the input isn't supported, the caller is then 
+/ expected to fall back to the full Flex/Lemon parser
+*/
+    struct gaia_txt_parser parser;
+    int type;
+    int srid = 0;
+    int has_crs = 0;
+    int ok;
+    gaiaTxtParserInit (&parser, text, GAIA_TXT_GEOJSON);
+    ok = gaiaTxtParseJsonGeometry (&parser, &type, &srid, &has_crs);
+    if (ok)
+      {
+	  /* nothing but blanks is expected to follow */
+	  gaiaTxtSkipBlanks (&parser);
+	  if (*(parser.p) != '\0')
+	      ok = 0;
+      }
+    if (ok && parser.geom != NULL)
+      {
+	  parser.geom->DeclaredType = gaiaTxtDeclaredType (type, parser.dims);
+	  if (has_crs)
+	      parser.geom->Srid = srid;
+	  else if (type == GAIA_POINT || type == GAIA_LINESTRING)
+	      parser.geom->Srid = -1;
+      }
+    return gaiaTxtParserDone (&parser, ok);
 }
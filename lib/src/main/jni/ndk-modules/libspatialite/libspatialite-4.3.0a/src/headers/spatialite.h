@@ -486,22 +486,28 @@ extern "C"
     SPATIALITE_DECLARE int spatial_ref_sys_init (sqlite3 * sqlite, int verbose);
 
 /**
- Inserts the inlined EPSG dataset into the "spatial_ref_sys" table
+ Inserts the built-in EPSG dataset into the "spatial_ref_sys" table
 
  \param sqlite handle to current DB connection
- \param mode can be one of GAIA_EPSG_ANY, GAIA_EPSG_NONE or GAIA_EPSG_WGS84_ONLY
+ \param mode can be one of GAIA_EPSG_ANY, GAIA_EPSG_NONE, GAIA_EPSG_WGS84_ONLY
+ or GAIA_EPSG_LAZY
  \param verbose if TRUE a short report is shown on stderr
 
  \return 0 on failure, any other value on success
 
  \note this function is internally invoked by the SQL function 
   InitSpatialMetadata(), and is not usually intended for direct use.
+  GAIA_EPSG_LAZY will only insert the "undefined" SRIDs -1 and 0, and
+  will mark the DB as "lazy" by creating the "spatial_ref_sys_lazy" table:
+  on such DBs only, any other EPSG definition will be inserted on demand
+  by AddGeometryColumn() and RecoverGeometryColumn(), and Transform()
+  will fall back to the built-in EPSG dataset.
  */
     SPATIALITE_DECLARE int spatial_ref_sys_init2 (sqlite3 * sqlite, int mode,
 						  int verbose);
 
 /**
- Inserts some inlined EPSG definition into the "spatial_ref_sys" table
+ Inserts some built-in EPSG definition into the "spatial_ref_sys" table
 
  \param sqlite handle to current DB connection
  \param srid the SRID value uniquely identifying the required EPSG definition 
@@ -882,6 +888,8 @@ extern "C"
    - 3 MBR + Short CRS
    - 4 GeoJSON Long CRS (e.g urn:ogc:def:crs:EPSG::4326)
    - 5 MBR + Long CRS
+ \n any row whose value isn't a valid Geometry is exported as \b null
+ (and counted within \b rows).
 
  \return 0 on failure, any other value on success
  */
@@ -890,6 +898,32 @@ extern "C"
 					    int precision, int option,
 					    int *rows);
 
+/**
+ Dumps a full geometry-table into an external GeoJSON FeatureCollection
+
+ \param sqlite handle to current DB connection
+ \param table the name of the table to be exported
+ \param geom_col the name of the geometry column
+ \param outfile_path pathname for the GeoJSON file to be written to
+ \param precision number of decimal digits for coordinates
+ \param option the format to use for output
+ \param quantum quantization step for coordinates (0.0 means none)
+ \param rows on completion will contain the total number of exported rows
+ 
+ \sa dump_geojson_ex
+
+ \note the same option values supported by dump_geojson_ex() are supported.
+ \n any other column will be exported as a Feature Property (BLOB values
+ will be exported as \b null); the output is directly streamed into the
+ file, without building any intermediate text.
+
+ \return 0 on failure, any other value on success
+ */
+    SPATIALITE_DECLARE int dump_geojson2 (sqlite3 * sqlite, char *table,
+					  char *geom_col, char *outfile_path,
+					  int precision, int option,
+					  double quantum, int *rows);
+
 /**
  Updates the LAYER_STATICS metadata table
 
@@ -215,6 +215,24 @@ extern "C"
 /** BLOB-Geometry CLASS: compressed POLYGON ZM */
 #define GAIA_COMPRESSED_POLYGONZM		1003003
 
+/* constants that defines Quantized GEOMETRY CLASSes */
+/** BLOB-Geometry CLASS: quantized LINESTRING */
+#define GAIA_QUANTIZED_LINESTRING		2000002
+/** BLOB-Geometry CLASS: quantized POLYGON */
+#define GAIA_QUANTIZED_POLYGON			2000003
+/** BLOB-Geometry CLASS: quantized LINESTRING Z */
+#define GAIA_QUANTIZED_LINESTRINGZ		2001002
+/** BLOB-Geometry CLASS: quantized POLYGON Z */
+#define GAIA_QUANTIZED_POLYGONZ		2001003
+/** BLOB-Geometry CLASS: quantized LINESTRING M */
+#define GAIA_QUANTIZED_LINESTRINGM		2002002
+/** BLOB-Geometry CLASS: quantized POLYGON M */
+#define GAIA_QUANTIZED_POLYGONM		2002003
+/** BLOB-Geometry CLASS: quantized LINESTRING ZM */
+#define GAIA_QUANTIZED_LINESTRINGZM		2003002
+/** BLOB-Geometry CLASS: quantized POLYGON ZM */
+#define GAIA_QUANTIZED_POLYGONZM		2003003
+
 /* constants that defines GEOS-WKB 3D CLASSes */
 /** GEOS-WKB 3D CLASS: POINT Z */
 #define GAIA_GEOSWKB_POINTZ			-2147483647
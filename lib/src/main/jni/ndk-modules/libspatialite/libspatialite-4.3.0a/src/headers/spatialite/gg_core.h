@@ -1499,6 +1499,18 @@ extern "C"
  */
     GAIAGEO_DECLARE double gaiaMeasureArea (gaiaRingPtr ring);
 
+/**
+ Reports which coordinate kernels are currently active
+
+ \return "sse2", "neon" or "scalar"
+
+ \sa gaiaMeasureLength, gaiaMeasureArea, gaiaMbrLinestring
+
+ \note the kernels are selected once, at first use: setting
+ SPATIALITE_SIMD=scalar in the environment forces the scalar ones.
+ */
+    GAIAGEO_DECLARE const char *gaiaCoordsKernelsName (void);
+
 /**
  Determines the Centroid for a Ring object
 
@@ -1840,6 +1852,149 @@ extern "C"
 						    double rf, int dims,
 						    double *coords, int vert);
 
+/**
+ Calculates the Great Circle Distances between two sets of Points
+
+ \param a first geodesic parameter.
+ \param b second geodesic parameter.
+ \param coords1 XY mem-array (longitude, latitude) of the first set.
+ \param n1 number of Points within the first set.
+ \param coords2 XY mem-array (longitude, latitude) of the second set.
+ \param n2 number of Points within the second set.
+ \param matrix on completion will contain all the calculated distances
+ (row-major order: n1 rows by n2 columns).
+
+ \return 0 on failure: any other value on success.
+
+ \sa gaiaGreatCircleDistance, gaiaGeodesicDistanceMatrix
+
+ \note the returned distances are expressed in Meters.
+ \n \b matrix must point to a caller-allocated array of n1 * n2 doubles.
+ \n the latitude cosine of each Point is resolved just once.
+ */
+    GAIAGEO_DECLARE int gaiaGreatCircleDistanceMatrix (double a, double b,
+						       const double *coords1,
+						       int n1,
+						       const double *coords2,
+						       int n2, double *matrix);
+
+/**
+ Calculates the Geodesic Distances between two sets of Points
+
+ \param a first geodesic parameter.
+ \param b second geodesic parameter.
+ \param rf third geodesic parameter.
+ \param coords1 XY mem-array (longitude, latitude) of the first set.
+ \param n1 number of Points within the first set.
+ \param coords2 XY mem-array (longitude, latitude) of the second set.
+ \param n2 number of Points within the second set.
+ \param matrix on completion will contain all the calculated distances
+ (row-major order: n1 rows by n2 columns).
+
+ \return 0 on failure: any other value on success.
+
+ \sa gaiaGeodesicDistance, gaiaGreatCircleDistanceMatrix
+
+ \note the returned distances are expressed in Meters.
+ \n \b matrix must point to a caller-allocated array of n1 * n2 doubles.
+ \n the reduced latitude of each Point is resolved just once.
+ \n if the Vincenty formula fails to converge for some pair of Points
+ the corresponding distance will be set to -1 and 0 will be returned.
+ */
+    GAIAGEO_DECLARE int gaiaGeodesicDistanceMatrix (double a, double b,
+						    double rf,
+						    const double *coords1,
+						    int n1,
+						    const double *coords2,
+						    int n2, double *matrix);
+
+/**
+ Calculates the Search Window(s) around a Point for a metric distance
+
+ \param a first geodesic parameter.
+ \param b second geodesic parameter.
+ \param lat Latitude of the reference Point.
+ \param lon Longitude of the reference Point.
+ \param radius the search distance (in Meters).
+ \param minx array of two doubles: on completion will contain the
+ min Longitude of each window.
+ \param miny array of two doubles: on completion will contain the
+ min Latitude of each window.
+ \param maxx array of two doubles: on completion will contain the
+ max Longitude of each window.
+ \param maxy array of two doubles: on completion will contain the
+ max Latitude of each window.
+
+ \return the number of windows (1 or 2): 0 on invalid arguments.
+
+ \sa gaiaGeodesicMbrMinDistance, gaiaGeodesicDistWithin
+
+ \note every Point laying within \b radius (ellipsoidal or great circle
+ distance) from the reference Point is guaranteed to fall within the
+ returned windows.
+ \n the longitude extent widens with latitude, a full longitude band is
+ returned when the search area includes a Pole, and two windows are
+ returned when the search area crosses the antimeridian.
+ */
+    GAIAGEO_DECLARE int gaiaGeodesicSearchWindows (double a, double b,
+						   double lat, double lon,
+						   double radius, double *minx,
+						   double *miny, double *maxx,
+						   double *maxy);
+
+/**
+ Calculates a lower bound of the distance between a Point and an MBR
+
+ \param a first geodesic parameter.
+ \param b second geodesic parameter.
+ \param lat Latitude of the reference Point.
+ \param lon Longitude of the reference Point.
+ \param minx min Longitude of the MBR.
+ \param miny min Latitude of the MBR.
+ \param maxx max Longitude of the MBR.
+ \param maxy max Latitude of the MBR.
+
+ \return the lower bound distance (in Meters).
+
+ \sa gaiaGeodesicSearchWindows, gaiaGeodesicDistWithin
+
+ \note the returned value never exceeds the ellipsoidal or great circle
+ distance between the reference Point and any Point within the MBR.
+ */
+    GAIAGEO_DECLARE double gaiaGeodesicMbrMinDistance (double a, double b,
+						       double lat, double lon,
+						       double minx, double miny,
+						       double maxx,
+						       double maxy);
+
+/**
+ Checks if the distance between two Points doesn't exceed some radius
+
+ \param a first geodesic parameter.
+ \param b second geodesic parameter.
+ \param rf third geodesic parameter.
+ \param lat1 Latitude of first Point.
+ \param lon1 Longitude of first Point.
+ \param lat2 Latitude of second Point.
+ \param lon2 Longitude of second Point.
+ \param radius the reference distance (in Meters).
+ \param use_ellipsoid if TRUE the Geodesic distance will be evaluated,
+ otherwise the Great Circle distance.
+
+ \return 1 if the distance is less or equal to \b radius: 0 otherwise.
+
+ \sa gaiaGeodesicDistance, gaiaGreatCircleDistance
+
+ \note the Geodesic distance is bracketed by fast lower/upper bounds,
+ so that the Vincenty formula is only evaluated for Points laying
+ very close to the reference distance.
+ */
+    GAIAGEO_DECLARE int gaiaGeodesicDistWithin (double a, double b, double rf,
+						double lat1, double lon1,
+						double lat2, double lon2,
+						double radius,
+						int use_ellipsoid);
+
 /**
  Convert a Length from a Measure Unit to another
 
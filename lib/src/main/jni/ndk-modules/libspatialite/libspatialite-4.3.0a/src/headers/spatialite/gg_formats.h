@@ -540,6 +540,62 @@ extern "C"
 						  unsigned char **result,
 						  int *size);
 
+/**
+ Creates a Quantized BLOB-Geometry corresponding to a Geometry object
+
+ \param geom pointer to the Geometry object.
+ \param xy_digits number of decimal digits to be preserved for X and Y
+ coordinates (0 to 15).
+ \param z_digits number of decimal digits to be preserved for Z values.
+ \param m_digits number of decimal digits to be preserved for M values.
+ \param block_size if greater than zero, an index of vertex blocks of
+ this size will be stored for each Linestring / Ring, so to allow for
+ partial decoding.
+ \param result on completion will containt a pointer to Quantized BLOB-Geometry:
+ NULL on failure.
+ \param size on completion this variable will contain the BLOB's size (in bytes)
+
+ \sa gaiaFromSpatiaLiteBlobWkb, gaiaToCompressedBlobWkb,
+ gaiaPointNFromQuantizedBlob
+
+ \note this function will round all coordinates to the required number
+ of decimal digits, then storing any Linestring / Ring as zig-zag varint
+ deltas between integer values. Decoding is transparently supported by
+ gaiaFromSpatiaLiteBlobWkb().
+ \n the returned BLOB buffer corresponds to dynamically allocated memory:
+ so you are responsible to free() it [unless SQLite will take care
+ of memory cleanup via buffer binding].
+ */
+    GAIAGEO_DECLARE void gaiaToQuantizedBlobWkb (gaiaGeomCollPtr geom,
+						 int xy_digits, int z_digits,
+						 int m_digits, int block_size,
+						 unsigned char **result,
+						 int *size);
+
+/**
+ Extracts a single vertex from a Quantized BLOB-Geometry
+
+ \param blob pointer to a Quantized BLOB-Geometry of the LINESTRING class
+ \param size the BLOB's size
+ \param vertex relative index of the vertex (0-based); a negative
+ value will select the last vertex.
+
+ \return the pointer to the newly created POINT Geometry object: NULL
+ on failure or if the BLOB-Geometry isn't a Quantized Linestring.
+
+ \sa gaiaToQuantizedBlobWkb
+
+ \note only the block containing the required vertex will be actually
+ decoded.
+ \n you are responsible to destroy (before or after) any allocated Geometry.
+ */
+    GAIAGEO_DECLARE gaiaGeomCollPtr gaiaPointNFromQuantizedBlob (const
+								 unsigned char
+								 *blob,
+								 unsigned int
+								 size,
+								 int vertex);
+
 /**
  Creates a Geometry object from WKB notation
 
@@ -1095,6 +1151,188 @@ extern "C"
     GAIAGEO_DECLARE void gaiaOutGeoJSON (gaiaOutBufferPtr out_buf,
 					 gaiaGeomCollPtr geom, int precision,
 					 int options);
+
+/**
+ Initializes a streaming GeoJSON writer directly targeting a file descriptor
+
+ \param writer pointer to gaiaGeoJsonWriterStruct structure
+ \param fd an open file descriptor
+ \param precision decimal digits to be used for coordinates
+ \param options GeoJSON specific options (same as gaiaOutGeoJSON)
+ \param quantum quantization step for coordinates: 0.0 (or any negative
+ value) means that no quantization will be applied
+
+ \sa gaiaGeoJsonWriterInitBuffer, gaiaGeoJsonWriterFlush, gaiaOutGeoJSON
+
+ \note all the generated text is composed into a fixed-size internal block
+ and will be flushed to the file descriptor each time the block becomes full;
+ no dynamic memory allocation will ever be required.
+ \n you are expected to call gaiaGeoJsonWriterFlush() once finished;
+ closing the file descriptor is a caller's responsibility.
+ */
+    GAIAGEO_DECLARE void gaiaGeoJsonWriterInitFd (gaiaGeoJsonWriterPtr writer,
+						  int fd, int precision,
+						  int options, double quantum);
+
+/**
+ Initializes a streaming GeoJSON writer directly targeting a caller buffer
+
+ \param writer pointer to gaiaGeoJsonWriterStruct structure
+ \param buffer pointer to the caller supplied output buffer
+ \param size the output buffer size (in bytes)
+ \param precision decimal digits to be used for coordinates
+ \param options GeoJSON specific options (same as gaiaOutGeoJSON)
+ \param quantum quantization step for coordinates: 0.0 (or any negative
+ value) means that no quantization will be applied
+
+ \sa gaiaGeoJsonWriterInitFd, gaiaGeoJsonWriterFlush, gaiaOutGeoJSON
+
+ \note the output buffer will never be extended: an overflow will
+ invalidate the writer, and gaiaGeoJsonWriterFlush() will then return 0.
+ \n on success the output will always be NULL-terminated and the
+ \e WriteOffset member will report its length.
+ */
+    GAIAGEO_DECLARE void gaiaGeoJsonWriterInitBuffer (gaiaGeoJsonWriterPtr
+						      writer, char *buffer,
+						      int size, int precision,
+						      int options,
+						      double quantum);
+
+/**
+ Flushes any pending output of a streaming GeoJSON writer
+
+ \param writer pointer to gaiaGeoJsonWriterStruct structure
+
+ \return 0 if any error (I/O error or buffer overflow) was encountered
+ since initialization: any other value on success.
+
+ \sa gaiaGeoJsonWriterInitFd, gaiaGeoJsonWriterInitBuffer
+ */
+    GAIAGEO_DECLARE int gaiaGeoJsonWriterFlush (gaiaGeoJsonWriterPtr writer);
+
+/**
+ Encodes a Geometry object into GeoJSON notation via a streaming writer
+
+ \param writer pointer to gaiaGeoJsonWriterStruct structure
+ \param geom pointer to Geometry object: a NULL Geometry will be
+ encoded as a JSON \b null
+
+ \sa gaiaOutGeoJSON, gaiaGeoJsonBeginFeature
+ */
+    GAIAGEO_DECLARE void gaiaGeoJsonWriteGeometry (gaiaGeoJsonWriterPtr writer,
+						   gaiaGeomCollPtr geom);
+
+/**
+ Appends some verbatim text to a streaming GeoJSON writer
+
+ \param writer pointer to gaiaGeoJsonWriterStruct structure
+ \param text the text to be appended
+ \param len the text length (in bytes): a negative value means that
+ \e text is a NULL-terminated string
+
+ \note this is intended for separators and alike: no JSON escaping
+ will be applied at all.
+ */
+    GAIAGEO_DECLARE void gaiaGeoJsonWriteRaw (gaiaGeoJsonWriterPtr writer,
+					      const char *text, int len);
+
+/**
+ Starts a GeoJSON FeatureCollection
+
+ \param writer pointer to gaiaGeoJsonWriterStruct structure
+
+ \sa gaiaGeoJsonEndFeatureCollection, gaiaGeoJsonBeginFeature
+ */
+    GAIAGEO_DECLARE void
+	gaiaGeoJsonBeginFeatureCollection (gaiaGeoJsonWriterPtr writer);
+
+/**
+ Terminates a GeoJSON FeatureCollection
+
+ \param writer pointer to gaiaGeoJsonWriterStruct structure
+
+ \sa gaiaGeoJsonBeginFeatureCollection
+ */
+    GAIAGEO_DECLARE void
+	gaiaGeoJsonEndFeatureCollection (gaiaGeoJsonWriterPtr writer);
+
+/**
+ Starts a GeoJSON Feature
+
+ \param writer pointer to gaiaGeoJsonWriterStruct structure
+ \param geom pointer to the Feature's Geometry (may be NULL)
+
+ \sa gaiaGeoJsonEndFeature, gaiaGeoJsonAddIntProperty,
+ gaiaGeoJsonAddDoubleProperty, gaiaGeoJsonAddTextProperty,
+ gaiaGeoJsonAddNullProperty
+
+ \note the Feature's Properties are expected to be added immediately
+ after calling this function.
+ */
+    GAIAGEO_DECLARE void gaiaGeoJsonBeginFeature (gaiaGeoJsonWriterPtr writer,
+						  gaiaGeomCollPtr geom);
+
+/**
+ Terminates a GeoJSON Feature
+
+ \param writer pointer to gaiaGeoJsonWriterStruct structure
+
+ \sa gaiaGeoJsonBeginFeature
+ */
+    GAIAGEO_DECLARE void gaiaGeoJsonEndFeature (gaiaGeoJsonWriterPtr writer);
+
+/**
+ Adds an Integer Property to the current GeoJSON Feature
+
+ \param writer pointer to gaiaGeoJsonWriterStruct structure
+ \param name the Property name
+ \param value the Property value
+
+ \sa gaiaGeoJsonBeginFeature
+ */
+    GAIAGEO_DECLARE void gaiaGeoJsonAddIntProperty (gaiaGeoJsonWriterPtr
+						    writer, const char *name,
+						    sqlite3_int64 value);
+
+/**
+ Adds a Double Property to the current GeoJSON Feature
+
+ \param writer pointer to gaiaGeoJsonWriterStruct structure
+ \param name the Property name
+ \param value the Property value
+
+ \sa gaiaGeoJsonBeginFeature
+
+ \note NaN and Infinite values will be encoded as a JSON \b null.
+ */
+    GAIAGEO_DECLARE void gaiaGeoJsonAddDoubleProperty (gaiaGeoJsonWriterPtr
+						       writer,
+						       const char *name,
+						       double value);
+
+/**
+ Adds a Text Property to the current GeoJSON Feature
+
+ \param writer pointer to gaiaGeoJsonWriterStruct structure
+ \param name the Property name
+ \param value the Property value (UTF-8 encoded)
+
+ \sa gaiaGeoJsonBeginFeature
+ */
+    GAIAGEO_DECLARE void gaiaGeoJsonAddTextProperty (gaiaGeoJsonWriterPtr
+						     writer, const char *name,
+						     const char *value);
+
+/**
+ Adds a NULL Property to the current GeoJSON Feature
+
+ \param writer pointer to gaiaGeoJsonWriterStruct structure
+ \param name the Property name
+
+ \sa gaiaGeoJsonBeginFeature
+ */
+    GAIAGEO_DECLARE void gaiaGeoJsonAddNullProperty (gaiaGeoJsonWriterPtr
+						     writer, const char *name);
 /**
  Encodes a Geometry object into SVG notation
 
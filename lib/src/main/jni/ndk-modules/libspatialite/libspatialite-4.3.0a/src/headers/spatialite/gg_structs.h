@@ -476,6 +476,49 @@ extern "C"
  */
     typedef gaiaOutBuffer *gaiaOutBufferPtr;
 
+/** size (in bytes) of the internal staging block of a GeoJSON writer */
+#define GAIA_GEOJSON_BLOCK	16384
+
+/**
+ Container for a streaming GeoJSON writer
+ */
+    typedef struct gaiaGeoJsonWriterStruct
+    {
+/* a struct handling a streaming GeoJSON writer */
+/** output file descriptor (-1 if not writing to a file) */
+	int Fd;
+/** dynamically growing Text buffer (NULL if not used) */
+	gaiaOutBufferPtr OutBuf;
+/** current composition buffer: the caller supplied one or the internal Block */
+	char *Buffer;
+/** current composition buffer size (in bytes) */
+	int BufferSize;
+/** current write offset */
+	int WriteOffset;
+/** total number of bytes written since initialization */
+	sqlite3_int64 TotalBytes;
+/** number of Features written since initialization */
+	int Features;
+/** number of Properties written into the current Feature */
+	int Properties;
+/** decimal digits to be used for coordinates */
+	int Precision;
+/** quantization step for coordinates (0.0 means no quantization) */
+	double Quantum;
+/** BBOX and CRS options: same values supported by gaiaOutGeoJSON */
+	int Options;
+/** validity flag */
+	int Error;
+/** internal staging block */
+	char Block[GAIA_GEOJSON_BLOCK];
+    } gaiaGeoJsonWriter;
+/**
+ Typedef for streaming GeoJSON writer structure
+
+ \sa gaiaGeoJsonWriter
+ */
+    typedef gaiaGeoJsonWriter *gaiaGeoJsonWriterPtr;
+
 #ifndef OMIT_ICONV		/* ICONV enabled: supporting text reader */
 
 /** Virtual Text driver: MAX number of fields */
@@ -83,12 +83,34 @@ extern "C"
 /** spatial_ref_sys_init2: will create the "spatial_ref_sys" table
  but will avoid to insert any row at all */
 #define GAIA_EPSG_NONE -9997
+/** spatial_ref_sys_init2: will create the "spatial_ref_sys" table
+ only inserting the "undefined" SRIDs; any other EPSG definition will
+ be inserted later on demand */
+#define GAIA_EPSG_LAZY -9996
 
 #define SPATIALITE_STATISTICS_GENUINE	1
 #define SPATIALITE_STATISTICS_VIEWS	2
 #define SPATIALITE_STATISTICS_VIRTS	3
 #define SPATIALITE_STATISTICS_LEGACY	4
 
+/* Quantized MBR index: each block covers 64 consecutive ROWIDs */
+#define GAIA_QMBR_BLOCK_BITS	6
+#define GAIA_QMBR_BLOCK_ITEMS	64
+/* Quantized MBR index: each item is MinX, MinY, MaxX, MaxY as little-endian FLOATs */
+#define GAIA_QMBR_ITEM_SIZE	16
+#define GAIA_QMBR_FLOAT_BLOCK	(GAIA_QMBR_BLOCK_ITEMS * GAIA_QMBR_ITEM_SIZE)
+/* Quantized MBR index: INT16 blocks start by the grid (OriginX, OriginY, 
+   CellX, CellY as little-endian DOUBLEs) followed by 16 bit cell numbers */
+#define GAIA_QMBR_GRID_SIZE	32
+#define GAIA_QMBR_INT16_ITEM_SIZE	8
+#define GAIA_QMBR_INT16_BLOCK	(GAIA_QMBR_GRID_SIZE + (GAIA_QMBR_BLOCK_ITEMS * GAIA_QMBR_INT16_ITEM_SIZE))
+/* Quantized MBR index: the last INT16 cell marks an empty item */
+#define GAIA_QMBR_INT16_CELLS	65535
+
+/* Geometry Pyramid: the tolerance grows by this factor at each level */
+#define GAIA_PYRAMID_FACTOR	4.0
+#define GAIA_PYRAMID_MAX_LEVELS	16
+
 #define SPATIALITE_CACHE_MAGIC1	0xf8
 #define SPATIALITE_CACHE_MAGIC2 0x8f
 
@@ -127,6 +149,68 @@ extern "C"
 
 #define MAX_XMLSCHEMA_CACHE	16
 
+    struct splite_proj_cache_item
+    {
+	int srid_from;
+	int srid_to;
+	int gpkg_amphibious;
+	char *proj_from;
+	char *proj_to;
+	void *from_cs;
+	void *to_cs;
+	int from_angle;
+	int to_angle;
+	unsigned int last_used;
+	unsigned int generation;
+	unsigned int serial;
+    };
+
+#define MAX_PROJ_CACHE	8
+
+    struct splite_approx_cache_item
+    {
+	unsigned int pair_serial;
+	double max_error;
+	double minx;
+	double miny;
+	double size;
+	int order;
+	double x0;
+	double y0;
+	double scale;
+	double E[10];
+	double N[10];
+	unsigned int last_used;
+    };
+
+#define MAX_APPROX_CACHE	16
+
+    struct splite_srs_cache_item
+    {
+	int srid;
+	unsigned int loaded;
+	char *proj4text;
+	int ellipsoid_ok;
+	double a;
+	double b;
+	double rf;
+	int geographic_ok;
+	int geographic;
+	int projected_ok;
+	int projected;
+	int flipped_ok;
+	int flipped;
+	char *spheroid;
+	char *prime_meridian;
+	char *projection;
+	char *datum;
+	char *unit;
+	char *axis[4];
+	struct splite_srs_cache_item *next;
+    };
+
+#define SRS_CATALOG_BUCKETS	64
+
     struct splite_internal_cache
     {
 	unsigned char magic1;
@@ -141,6 +225,16 @@ extern "C"
 	struct splite_geos_cache_item cacheItem1;
 	struct splite_geos_cache_item cacheItem2;
 	struct splite_xmlSchema_cache_item xmlSchemaCache[MAX_XMLSCHEMA_CACHE];
+	struct splite_proj_cache_item projCache[MAX_PROJ_CACHE];
+	unsigned int projCacheClock;
+	unsigned int projCacheHits;
+	unsigned int projCacheMisses;
+	struct splite_approx_cache_item approxCache[MAX_APPROX_CACHE];
+	struct splite_srs_cache_item *srsCatalog[SRS_CATALOG_BUCKETS];
+	int srsChanges;
+	int srsDataVersion;
+	int srsSchemaVersion;
+	unsigned int srsGeneration;
 	int pool_index;
 	void (*geos_warning) (const char *fmt, ...);
 	void (*geos_error) (const char *fmt, ...);
@@ -169,6 +263,36 @@ extern "C"
 	struct epsg_defs *next;
     };
 
+    struct epsg_packed_def
+    {
+	/* an EPSG def into the built-in (packed) dataset */
+	int srid;
+	int auth_srid;
+	unsigned int offset;	/* within the unpacked block */
+	unsigned short block;
+	unsigned short null_mask;	/* a bit for each NULL string */
+	signed char is_geographic;
+	signed char flipped_axes;
+	unsigned char wgs84;
+    };
+
+    struct epsg_packed_block
+    {
+	/* a block of EPSG records: stored if packed_len == raw_len */
+	const unsigned char *data;
+	unsigned int packed_len;
+	unsigned int raw_len;
+    };
+
+    struct epsg_packed_dataset
+    {
+	/* the built-in EPSG dataset: defs are sorted by SRID */
+	const struct epsg_packed_def *defs;
+	int count;
+	const struct epsg_packed_block *blocks;
+	int n_blocks;
+    };
+
     struct gaia_control_points
     {
 	/* a struct to implement ATM_ControlPoints - aggregate function */
@@ -251,6 +375,15 @@ extern "C"
 
     SPATIALITE_PRIVATE void free_epsg (struct epsg_defs *first);
 
+    SPATIALITE_PRIVATE const struct epsg_packed_dataset
+	*epsg_packed_dataset (void);
+
+    SPATIALITE_PRIVATE int epsg_materialize_srid (void *p_sqlite, int srid);
+
+    SPATIALITE_PRIVATE int epsg_lazy_mode (void *p_sqlite);
+
+    SPATIALITE_PRIVATE char *epsg_get_proj4text (int srid);
+
     SPATIALITE_PRIVATE int exists_spatial_ref_sys (void *handle);
 
     SPATIALITE_PRIVATE int checkSpatialMetaData (const void *sqlite);
@@ -284,6 +417,55 @@ extern "C"
 						   double factor,
 						   int allow_holes);
 
+    SPATIALITE_PRIVATE void *gaiaFastParseWkt (const unsigned char *text,
+					       int ewkt);
+
+    SPATIALITE_PRIVATE void *gaiaFastParseGeoJSON (const unsigned char
+						   *text);
+
+    SPATIALITE_PRIVATE void gaiaCoordsMbr (const double *coords, int points,
+					   int dimension_model, double *min_x,
+					   double *min_y, double *max_x,
+					   double *max_y);
+
+    SPATIALITE_PRIVATE void gaiaCoordsShift (double *coords, int points,
+					     int dimension_model,
+					     double shift_x, double shift_y);
+
+    SPATIALITE_PRIVATE void gaiaCoordsScale (double *coords, int points,
+					     int dimension_model,
+					     double scale_x, double scale_y);
+
+    SPATIALITE_PRIVATE void gaiaCoordsRotate (double *coords, int points,
+					      int dimension_model,
+					      double cosine, double sine);
+
+    SPATIALITE_PRIVATE void gaiaCoordsAffine2D (double *coords, int points,
+						int dimension_model,
+						const double *matrix);
+
+    SPATIALITE_PRIVATE double gaiaCoordsLength (const double *coords,
+						int points,
+						int dimension_model);
+
+    SPATIALITE_PRIVATE double gaiaCoordsSignedArea (const double *coords,
+						    int points,
+						    int dimension_model);
+
+    SPATIALITE_PRIVATE void gaiaCoordsHaversineRow (const double *point,
+						    const double *set,
+						    int count, double *row);
+
+    SPATIALITE_PRIVATE float gaiaFloatRoundDown (double value);
+
+    SPATIALITE_PRIVATE float gaiaFloatRoundUp (double value);
+
+    SPATIALITE_PRIVATE unsigned int gaiaHilbertKey (double x, double y,
+						    double origin_x,
+						    double origin_y,
+						    double scale_x,
+						    double scale_y);
+
     SPATIALITE_PRIVATE int createAdvancedMetaData (void *sqlite);
 
     SPATIALITE_PRIVATE void updateSpatiaLiteHistory (void *sqlite,
@@ -321,6 +503,86 @@ extern "C"
 
     SPATIALITE_PRIVATE int validateRowid (void *p_sqlite, const char *table);
 
+    SPATIALITE_PRIVATE int setDeferredSpatialIndex (void *p_sqlite,
+						    const char *table,
+						    const char *column,
+						    int mode);
+
+    SPATIALITE_PRIVATE int flushDeferredSpatialIndex (void *p_sqlite,
+						      const char *table,
+						      const char *column);
+
+    SPATIALITE_PRIVATE int initQuantizedMbrBlock (unsigned char *block,
+						  const unsigned char *grid);
+
+    SPATIALITE_PRIVATE void setQuantizedMbr (unsigned char *block,
+					     int block_size, int item,
+					     const unsigned char *blob,
+					     int size);
+
+    SPATIALITE_PRIVATE int getQuantizedMbr (const unsigned char *block,
+					    int block_size, int item,
+					    double *mbr);
+
+    SPATIALITE_PRIVATE int quantizeMbrFrame (const unsigned char *block,
+					     int block_size, double minx,
+					     double miny, double maxx,
+					     double maxy, double *frame);
+
+    SPATIALITE_PRIVATE void dequantizeMbr (const unsigned char *block,
+					   int block_size, const double *mbr,
+					   double *minx, double *miny,
+					   double *maxx, double *maxy);
+
+    SPATIALITE_PRIVATE int createQuantizedMbrIndex (void *p_sqlite,
+						    const char *table,
+						    const char *column,
+						    int bits);
+
+    SPATIALITE_PRIVATE int disableQuantizedMbrIndex (void *p_sqlite,
+						     const char *table,
+						     const char *column);
+
+    SPATIALITE_PRIVATE int reloadSpatialIndex (void *p_sqlite,
+					       const char *table,
+					       const char *column);
+
+    SPATIALITE_PRIVATE int createGeometryPyramid (void *p_sqlite,
+						  const char *table,
+						  const char *column,
+						  double tolerance,
+						  int levels,
+						  int preserve_topology);
+
+    SPATIALITE_PRIVATE int dropGeometryPyramid (void *p_sqlite,
+						const char *table,
+						const char *column);
+
+    SPATIALITE_PRIVATE int discardGeometryPyramid (void *p_sqlite,
+						   const char *table,
+						   const char *column);
+
+    SPATIALITE_PRIVATE char *getGeometryPyramidTable (void *p_sqlite,
+						      const char *table,
+						      const char *column,
+						      double resolution);
+
+    SPATIALITE_PRIVATE int setGeometryQuantization (void *p_sqlite,
+						    const char *table,
+						    const char *column,
+						    int precision,
+						    int block_size);
+
+    SPATIALITE_PRIVATE int getGeometryQuantization (void *p_sqlite,
+						    const char *table,
+						    const char *column,
+						    int *precision,
+						    int *block_size);
+
+    SPATIALITE_PRIVATE int dropGeometryQuantization (void *p_sqlite,
+						     const char *table,
+						     const char *column);
+
     SPATIALITE_PRIVATE int doComputeFieldInfos (void *p_sqlite,
 						const char *table,
 						const char *column,
@@ -337,6 +599,53 @@ extern "C"
 					       double *a, double *b,
 					       double *rf);
 
+    SPATIALITE_PRIVATE void splite_reset_srs_catalog (const void *p_cache);
+
+    SPATIALITE_PRIVATE void splite_check_srs_version (const void *p_cache,
+						      void *p_sqlite,
+						      int full);
+
+    SPATIALITE_PRIVATE void getProjParamsEx_r (const void *p_cache,
+					       void *p_sqlite, int srid,
+					       char **params,
+					       int gpkg_amphibious_mode);
+
+    SPATIALITE_PRIVATE int getEllipsoidParams_r (const void *p_cache,
+						 void *p_sqlite, int srid,
+						 double *a, double *b,
+						 double *rf);
+
+    SPATIALITE_PRIVATE int srid_is_geographic_r (const void *p_cache,
+						 void *p_sqlite, int srid,
+						 int *geographic);
+
+    SPATIALITE_PRIVATE int srid_is_projected_r (const void *p_cache,
+						void *p_sqlite, int srid,
+						int *projected);
+
+    SPATIALITE_PRIVATE int srid_has_flipped_axes_r (const void *p_cache,
+						    void *p_sqlite, int srid,
+						    int *flipped);
+
+    SPATIALITE_PRIVATE char *srid_get_spheroid_r (const void *p_cache,
+						  void *p_sqlite, int srid);
+
+    SPATIALITE_PRIVATE char *srid_get_prime_meridian_r (const void *p_cache,
+							void *p_sqlite, int srid);
+
+    SPATIALITE_PRIVATE char *srid_get_projection_r (const void *p_cache,
+						    void *p_sqlite, int srid);
+
+    SPATIALITE_PRIVATE char *srid_get_datum_r (const void *p_cache,
+					       void *p_sqlite, int srid);
+
+    SPATIALITE_PRIVATE char *srid_get_unit_r (const void *p_cache,
+					      void *p_sqlite, int srid);
+
+    SPATIALITE_PRIVATE char *srid_get_axis_r (const void *p_cache,
+					      void *p_sqlite, int srid,
+					      char axis, char mode);
+
     SPATIALITE_PRIVATE void addVectorLayer (void *list, const char *layer_type,
 					    const char *table_name,
 					    const char *geometry_column,
@@ -638,6 +947,58 @@ extern "C"
 							   splite_geos_cache_item
 							   *p);
 
+    SPATIALITE_PRIVATE void splite_free_proj_cache_item (struct
+							 splite_proj_cache_item
+							 *p);
+
+    SPATIALITE_PRIVATE void splite_reset_proj_cache (const void *p_cache);
+
+    SPATIALITE_PRIVATE struct splite_proj_cache_item
+	*splite_find_proj_cache_item (const void *p_cache, int srid_from,
+				      int srid_to, int gpkg_amphibious);
+
+    SPATIALITE_PRIVATE struct splite_proj_cache_item
+	*splite_store_proj_cache_item (const void *p_cache, int srid_from,
+				       int srid_to, int gpkg_amphibious,
+				       const char *proj_from,
+				       const char *proj_to,
+				       unsigned int generation);
+
+    SPATIALITE_PRIVATE void *splite_transform_proj_cache_item (struct
+							       splite_proj_cache_item
+							       *p,
+							       const void
+							       *org);
+
+    SPATIALITE_PRIVATE struct splite_approx_cache_item
+	*splite_find_approx_cache_item (const void *p_cache,
+					unsigned int pair_serial,
+					double max_error, double minx,
+					double miny, double maxx,
+					double maxy, double cell_minx,
+					double cell_miny, double cell_size);
+
+    SPATIALITE_PRIVATE struct splite_approx_cache_item
+	*splite_store_approx_cache_item (const void *p_cache,
+					 unsigned int pair_serial,
+					 double max_error, double cell_minx,
+					 double cell_miny, double cell_size);
+
+    SPATIALITE_PRIVATE int splite_fit_approx_cache_item (struct
+							 splite_approx_cache_item
+							 *p, int count,
+							 const double *x0,
+							 const double *y0,
+							 const double *x1,
+							 const double *y1,
+							 int order);
+
+    SPATIALITE_PRIVATE void *splite_transform_approx_cache_item (struct
+								 splite_approx_cache_item
+								 *p,
+								 const void
+								 *org);
+
     SPATIALITE_PRIVATE void splite_free_xml_schema_cache_item (struct
 							       splite_xmlSchema_cache_item
 							       *p);
@@ -686,8 +1047,19 @@ extern "C"
 
     SPATIALITE_PRIVATE int gaiaAuxClonerCheckValidTarget (const void *cloner);
 
+    SPATIALITE_PRIVATE int already_existing_table (void *p_sqlite,
+						   const char *table);
+
     SPATIALITE_PRIVATE int gaiaAuxClonerExecute (const void *cloner);
 
+    SPATIALITE_PRIVATE int gaiaAuxClusterGeoTable (const void *sqlite,
+						   const char *table,
+						   const char *geometry,
+						   int renumber,
+						   int *features,
+						   double *gap_before,
+						   double *gap_after);
+
     SPATIALITE_PRIVATE int gaia_matrix_to_arrays (const unsigned char *blob,
 						  int blob_sz, double *E,
 						  double *N, double *Z);
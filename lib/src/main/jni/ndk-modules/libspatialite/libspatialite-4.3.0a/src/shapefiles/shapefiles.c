@@ -6106,6 +6106,7 @@ dump_geojson_ex (sqlite3 * sqlite, char *table, char *geom_col,
 {
 /* dumping a  geometry table as GeoJSON - Brad Hards 2011-11-09 */
 /* sandro furieri 2014-08-30: adding the "int *xrows" argument */
+/* geometries are directly streamed into the output file */
     char *sql;
     char *xgeom_col;
     char *xtable;
@@ -6113,20 +6114,22 @@ dump_geojson_ex (sqlite3 * sqlite, char *table, char *geom_col,
     FILE *out = NULL;
     int ret;
     int rows = 0;
+    int invalid = 0;
+    gaiaGeoJsonWriter writer;
 
     *xrows = -1;
 /* opening/creating the GeoJSON output file */
     out = fopen (outfile_path, "wb");
     if (!out)
 	goto no_file;
+    gaiaGeoJsonWriterInitFd (&writer, fileno (out), precision, option, 0.0);
 
 /* preparing SQL statement */
     xtable = gaiaDoubleQuotedSql (table);
     xgeom_col = gaiaDoubleQuotedSql (geom_col);
     sql =
-	sqlite3_mprintf
-	("SELECT AsGeoJSON(\"%s\", %d, %d) FROM \"%s\" WHERE \"%s\" IS NOT NULL",
-	 xgeom_col, precision, option, xtable, xgeom_col);
+	sqlite3_mprintf ("SELECT \"%s\" FROM \"%s\" WHERE \"%s\" IS NOT NULL",
+			 xgeom_col, xtable, xgeom_col);
     free (xtable);
     free (xgeom_col);
     ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
@@ -6144,8 +6147,28 @@ dump_geojson_ex (sqlite3 * sqlite, char *table, char *geom_col,
 	    }
 	  if (ret == SQLITE_ROW)
 	    {
+		gaiaGeomCollPtr geom = NULL;
+		if (sqlite3_column_type (stmt, 0) == SQLITE_BLOB)
+		  {
+		      const unsigned char *blob = sqlite3_column_blob (stmt, 0);
+		      int size = sqlite3_column_bytes (stmt, 0);
+		      geom = gaiaFromSpatiaLiteBlobWkbEx (blob, size, 0, 1);
+		  }
 		rows++;
-		fprintf (out, "%s\r\n", sqlite3_column_text (stmt, 0));
+		if (geom == NULL)
+		  {
+		      /* not a valid Geometry: exported as null */
+		      invalid++;
+		      gaiaGeoJsonWriteRaw (&writer, "null", 4);
+		  }
+		else
+		  {
+		      gaiaGeoJsonWriteGeometry (&writer, geom);
+		      gaiaFreeGeomColl (geom);
+		  }
+		gaiaGeoJsonWriteRaw (&writer, "\r\n", 2);
+		if (writer.Error)
+		    goto write_error;
 	    }
 	  else
 	    {
@@ -6156,6 +6179,12 @@ dump_geojson_ex (sqlite3 * sqlite, char *table, char *geom_col,
       {
 	  goto empty_result_set;
       }
+    if (!gaiaGeoJsonWriterFlush (&writer))
+	goto write_error;
+    if (invalid > 0)
+	spatialite_e
+	    ("Dump GeoJSON warning: %d rows with an invalid Geometry exported as null\n",
+	     invalid);
 
     sqlite3_finalize (stmt);
     fclose (out);
@@ -6175,6 +6204,20 @@ dump_geojson_ex (sqlite3 * sqlite, char *table, char *geom_col,
     spatialite_e ("Dump GeoJSON error: %s\n", sqlite3_errmsg (sqlite));
     return 0;
 
+  write_error:
+/* an I/O error occurred */
+    if (stmt)
+      {
+	  sqlite3_finalize (stmt);
+      }
+    if (out)
+      {
+	  fclose (out);
+      }
+    spatialite_e ("Dump GeoJSON error: unable to write into '%s'\n",
+		  outfile_path);
+    return 0;
+
   no_file:
 /* Output file could not be created / opened */
     if (stmt)
@@ -6201,3 +6244,145 @@ dump_geojson_ex (sqlite3 * sqlite, char *table, char *geom_col,
     spatialite_e ("The SQL SELECT returned no data to export...\n");
     return 0;
 }
+
+SPATIALITE_DECLARE int
+dump_geojson2 (sqlite3 * sqlite, char *table, char *geom_col,
+	       char *outfile_path, int precision, int option, double quantum,
+	       int *xrows)
+{
+/* dumping a geometry table as a GeoJSON FeatureCollection */
+    char *sql;
+    char *xtable;
+    sqlite3_stmt *stmt = NULL;
+    FILE *out = NULL;
+    int ret;
+    int rows = 0;
+    int geom_idx = -1;
+    int n_cols;
+    int ic;
+    gaiaGeoJsonWriter writer;
+
+    *xrows = -1;
+/* opening/creating the GeoJSON output file */
+    out = fopen (outfile_path, "wb");
+    if (!out)
+	goto no_file;
+    gaiaGeoJsonWriterInitFd (&writer, fileno (out), precision, option,
+			     quantum);
+
+/* preparing SQL statement */
+    xtable = gaiaDoubleQuotedSql (table);
+    sql = sqlite3_mprintf ("SELECT * FROM \"%s\"", xtable);
+    free (xtable);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto sql_error;
+    n_cols = sqlite3_column_count (stmt);
+    for (ic = 0; ic < n_cols; ic++)
+      {
+	  /* identifying the Geometry column */
+	  if (strcasecmp (sqlite3_column_name (stmt, ic), geom_col) == 0)
+	      geom_idx = ic;
+      }
+    if (geom_idx < 0)
+      {
+	  spatialite_e ("Dump GeoJSON error: no such column \"%s\"\n",
+			geom_col);
+	  goto stop;
+      }
+
+    gaiaGeoJsonBeginFeatureCollection (&writer);
+    while (1)
+      {
+	  /* scrolling the result set */
+	  ret = sqlite3_step (stmt);
+	  if (ret == SQLITE_DONE)
+	    {
+		break;		/* end of result set */
+	    }
+	  if (ret == SQLITE_ROW)
+	    {
+		gaiaGeomCollPtr geom = NULL;
+		if (sqlite3_column_type (stmt, geom_idx) == SQLITE_BLOB)
+		  {
+		      const unsigned char *blob =
+			  sqlite3_column_blob (stmt, geom_idx);
+		      int size = sqlite3_column_bytes (stmt, geom_idx);
+		      geom = gaiaFromSpatiaLiteBlobWkbEx (blob, size, 0, 1);
+		  }
+		gaiaGeoJsonBeginFeature (&writer, geom);
+		if (geom != NULL)
+		    gaiaFreeGeomColl (geom);
+		for (ic = 0; ic < n_cols; ic++)
+		  {
+		      /* exporting all other columns as Properties */
+		      const char *name = sqlite3_column_name (stmt, ic);
+		      if (ic == geom_idx)
+			  continue;
+		      switch (sqlite3_column_type (stmt, ic))
+			{
+			case SQLITE_INTEGER:
+			    gaiaGeoJsonAddIntProperty (&writer, name,
+						       sqlite3_column_int64
+						       (stmt, ic));
+			    break;
+			case SQLITE_FLOAT:
+			    gaiaGeoJsonAddDoubleProperty (&writer, name,
+							  sqlite3_column_double
+							  (stmt, ic));
+			    break;
+			case SQLITE_TEXT:
+			    gaiaGeoJsonAddTextProperty (&writer, name,
+							(const char *)
+							sqlite3_column_text
+							(stmt, ic));
+			    break;
+			default:
+			    /* NULL and BLOB values */
+			    gaiaGeoJsonAddNullProperty (&writer, name);
+			    break;
+			};
+		  }
+		gaiaGeoJsonEndFeature (&writer);
+		rows++;
+		if (writer.Error)
+		    goto write_error;
+	    }
+	  else
+	    {
+		goto sql_error;
+	    }
+      }
+    gaiaGeoJsonEndFeatureCollection (&writer);
+    gaiaGeoJsonWriteRaw (&writer, "\n", 1);
+    if (!gaiaGeoJsonWriterFlush (&writer))
+	goto write_error;
+
+    sqlite3_finalize (stmt);
+    fclose (out);
+    *xrows = rows;
+    return 1;
+
+  sql_error:
+/* an SQL error occurred */
+    spatialite_e ("Dump GeoJSON error: %s\n", sqlite3_errmsg (sqlite));
+    goto stop;
+
+  write_error:
+/* an I/O error occurred */
+    spatialite_e ("Dump GeoJSON error: unable to write into '%s'\n",
+		  outfile_path);
+    goto stop;
+
+  no_file:
+/* Output file could not be created / opened */
+    spatialite_e ("ERROR: unable to open '%s' for writing\n", outfile_path);
+
+  stop:
+    if (stmt)
+	sqlite3_finalize (stmt);
+    if (out)
+	fclose (out);
+    return 0;
+}
@@ -61,6 +61,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <spatialite/spatialite.h>
 #include <spatialite/gaiageo.h>
 #include <spatialite/gaiaaux.h>
+#include <spatialite_private.h>
 
 #ifdef _WIN32
 #define strcasecmp	_stricmp
@@ -80,98 +81,66 @@ static struct sqlite3_module my_mbr_module;
 
 memory structs used to store the MBR's cache
 
-the basic idea is to implement a hierarchy in order to avoid
-excessive memory fragmentation and achieve better performance
+the cache is a packed Hilbert R-tree entirely held in memory:
+
+- all cached entities are stored into flat Structure-of-Arrays
+  (ROWIDs and double precision MBRs), sorted by the Hilbert key
+  of their centers, so that spatially close entities are
+  stored next to each other
+- on top of the entities a fully packed tree is built; each node
+  covers MBR_CACHE_FANOUT children, and node MBRs are stored
+  as FLOAT Structure-of-Arrays, rounded outwards
+- a ROWID hash table supports direct access by ROWID
+- incremental updates are supported:
+    - INSERT appends the new entity to an unsorted tail
+    - DELETE simply marks the entity as deleted
+    - UPDATE changes the entity in place, enlarging the nodes
+  and the whole tree is repacked as soon as the tail or the
+  deleted entities grow too much
 
-- the cache is a linked-list of cache page elements
-  - each cache page contains an array of 32 cache blocks
-    - each cache block contains an array of 32 cache cells
-so a single cache page con store up to 1024 cache cells
-
-*/
-
-struct mbr_cache_cell
-{
-/* 
-a  cached entity 
-*/
-
-/* the entity's ROWID */
-    sqlite3_int64 rowid;
-/* the MBR */
-    double minx;
-    double miny;
-    double maxx;
-    double maxy;
-};
-
-struct mbr_cache_block
-{
-/*
-a block of 32 cached entities
 */
 
-/* 
-allocation bitmap: the meaning of each bit is:
-1 - corresponding cache cell is in use
-0 - corresponding cache cell is unused
-*/
-    unsigned int bitmap;
-/* 
-the MBR corresponding to this cache block 
-i.e. the combined MBR for any contained cell
-*/
-    double minx;
-    double miny;
-    double maxx;
-    double maxy;
-/* the cache cells array */
-    struct mbr_cache_cell cells[32];
-};
+#define MBR_CACHE_FANOUT	16
+#define MBR_CACHE_MAX_LEVELS	16
 
-struct mbr_cache_page
+struct mbr_cache_level
 {
-/*
-a page containing 32 cached blocks
-*/
-
-/* 
-allocation bitmap: the meaning of each bit is:
-1 - corresponding cache block is in full
-0 - corresponding cache block is not full
-*/
-    unsigned int bitmap;
-/* 
-the MBR corresponding to this cache page
-i.e. the combined MBR for any contained block
-*/
-    double minx;
-    double miny;
-    double maxx;
-    double maxy;
-/* the cache blocks array */
-    struct mbr_cache_block blocks[32];
-/* the min-max rowid for this page */
-    sqlite3_int64 min_rowid;
-    sqlite3_int64 max_rowid;
-/* pointer to next element into the cached pages linked list */
-    struct mbr_cache_page *next;
+/* a level of packed tree nodes */
+    int count;
+    float *minx;
+    float *miny;
+    float *maxx;
+    float *maxy;
 };
 
 struct mbr_cache
 {
 /*
 the MBR's cache
-implemented as a cache pages linked list
+implemented as a packed Hilbert R-tree
 */
 
-/* pointers used to handle the cache pages linked list */
-    struct mbr_cache_page *first;
-    struct mbr_cache_page *last;
-/*
- pointer used to identify the current cache page when inserting a new cache cell
- */
-    struct mbr_cache_page *current;
+/* number of used and allocated entity slots */
+    int count;
+    int allocated;
+/* the first PACKED slots are covered by the tree; any other is the tail */
+    int packed;
+/* number of slots marked as deleted */
+    int n_deleted;
+/* the entities */
+    sqlite3_int64 *rowid;
+    double *minx;
+    double *miny;
+    double *maxx;
+    double *maxy;
+    unsigned char *deleted;
+/* the tree levels (0 = leaf nodes) */
+    int n_levels;
+    struct mbr_cache_level levels[MBR_CACHE_MAX_LEVELS];
+/* the ROWID hash table: -1 = empty, -2 = removed, else slot index */
+    int *hash;
+    int hash_size;
+    int hash_used;
 };
 
 typedef struct MbrCacheStruct
@@ -185,6 +154,7 @@ typedef struct MbrCacheStruct
     char *table_name;		/* the main table to be cached */
     char *column_name;		/* the column to be cached */
     int error;			/* some previous error disables any operation */
+    int n_cursors;		/* currently open cursors */
 } MbrCache;
 typedef MbrCache *MbrCachePtr;
 
@@ -193,294 +163,705 @@ typedef struct MbrCacheCursortStruct
 /* extends the sqlite3_vtab_cursor struct */
     MbrCachePtr pVtab;		/* Virtual table of this cursor */
     int eof;			/* the EOF marker */
-/* 
-positioning parameters while performing a cache search 
-*/
-    struct mbr_cache_page *current_page;
-    int current_block_index;
-    int current_cell_index;
-    struct mbr_cache_cell *current_cell;
-/* 
+/*
 the strategy to use:
     0 = sequential scan
     1 = find rowid
     2 = spatial search
 */
     int strategy;
-/* the MBR to search for */
-    double minx;
-    double miny;
-    double maxx;
-    double maxy;
-/*
-the MBR search mode:
-    0 = WITHIN
-    1 = CONTAIN
-*/
-    int mbr_mode;
+/* the slots to be returned, and the current position */
+    int *slots;
+    int n_slots;
+    int allocated;
+    int current;
 } MbrCacheCursor;
 typedef MbrCacheCursor *MbrCacheCursorPtr;
 
-static unsigned int
-cache_bitmask (int x)
-{
-/* return the bitmask corresponding to index X */
-    switch (x)
-      {
-      case 0:
-	  return 0x80000000;
-      case 1:
-	  return 0x40000000;
-      case 2:
-	  return 0x20000000;
-      case 3:
-	  return 0x10000000;
-      case 4:
-	  return 0x08000000;
-      case 5:
-	  return 0x04000000;
-      case 6:
-	  return 0x02000000;
-      case 7:
-	  return 0x01000000;
-      case 8:
-	  return 0x00800000;
-      case 9:
-	  return 0x00400000;
-      case 10:
-	  return 0x00200000;
-      case 11:
-	  return 0x00100000;
-      case 12:
-	  return 0x00080000;
-      case 13:
-	  return 0x00040000;
-      case 14:
-	  return 0x00020000;
-      case 15:
-	  return 0x00010000;
-      case 16:
-	  return 0x00008000;
-      case 17:
-	  return 0x00004000;
-      case 18:
-	  return 0x00002000;
-      case 19:
-	  return 0x00001000;
-      case 20:
-	  return 0x00000800;
-      case 21:
-	  return 0x00000400;
-      case 22:
-	  return 0x00000200;
-      case 23:
-	  return 0x00000100;
-      case 24:
-	  return 0x00000080;
-      case 25:
-	  return 0x00000040;
-      case 26:
-	  return 0x00000020;
-      case 27:
-	  return 0x00000010;
-      case 28:
-	  return 0x00000008;
-      case 29:
-	  return 0x00000004;
-      case 30:
-	  return 0x00000002;
-      case 31:
-	  return 0x00000001;
-      };
-    return 0x00000000;
-}
-
 static struct mbr_cache *
 cache_alloc (void)
 {
 /* allocates and initializes an empty cache struct */
     struct mbr_cache *p = malloc (sizeof (struct mbr_cache));
-    p->first = NULL;
-    p->last = NULL;
-    p->current = NULL;
+    if (p == NULL)
+	return NULL;
+    memset (p, 0, sizeof (struct mbr_cache));
     return p;
 }
 
-static struct mbr_cache_page *
-cache_page_alloc (void)
+static void
+cache_free_levels (struct mbr_cache *p)
 {
-/* allocates and initializes a cache page */
+/* memory cleanup; destroying the packed tree */
     int i;
-    struct mbr_cache_block *pb;
-    struct mbr_cache_page *p = malloc (sizeof (struct mbr_cache_page));
-    p->bitmap = 0x00000000;
-    p->next = NULL;
-    p->minx = DBL_MAX;
-    p->miny = DBL_MAX;
-    p->maxx = -DBL_MAX;
-    p->maxy = -DBL_MAX;
-    for (i = 0; i < 32; i++)
-      {
-	  pb = p->blocks + i;
-	  pb->bitmap = 0x00000000;
-	  pb->minx = DBL_MAX;
-	  pb->miny = DBL_MAX;
-	  pb->maxx = -DBL_MAX;
-	  pb->maxy = DBL_MAX;
-      }
-    p->max_rowid = LONG64_MIN;
-    p->min_rowid = LONG64_MAX;
-    return p;
+    for (i = 0; i < p->n_levels; i++)
+	free (p->levels[i].minx);
+    p->n_levels = 0;
 }
 
 static void
 cache_destroy (struct mbr_cache *p)
 {
-/* memory cleanup; destroying a cache and any page into the cache */
-    struct mbr_cache_page *pp;
-    struct mbr_cache_page *ppn;
+/* memory cleanup; destroying a cache */
     if (!p)
 	return;
-    pp = p->first;
-    while (pp)
-      {
-	  ppn = pp->next;
-	  free (pp);
-	  pp = ppn;
-      }
+    cache_free_levels (p);
+    if (p->rowid)
+	free (p->rowid);
+    if (p->minx)
+	free (p->minx);
+    if (p->deleted)
+	free (p->deleted);
+    if (p->hash)
+	free (p->hash);
     free (p);
 }
 
+static sqlite3_int64
+cache_memory_usage (struct mbr_cache *p)
+{
+/* returns the total memory (in bytes) currently used by the cache */
+    int i;
+    sqlite3_int64 bytes = sizeof (struct mbr_cache);
+    if (!p)
+	return 0;
+    bytes +=
+	(sqlite3_int64) (p->allocated) * (sizeof (sqlite3_int64) +
+					  (4 * sizeof (double)) + 1);
+    for (i = 0; i < p->n_levels; i++)
+	bytes += (sqlite3_int64) (p->levels[i].count) * 4 * sizeof (float);
+    bytes += (sqlite3_int64) (p->hash_size) * sizeof (int);
+    return bytes;
+}
+
+static unsigned int
+cache_hash_key (sqlite3_int64 rowid)
+{
+/* hashing a ROWID */
+    sqlite3_uint64 k = (sqlite3_uint64) rowid;
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    return (unsigned int) k;
+}
+
 static int
-cache_get_free_block (struct mbr_cache_page *pp)
+cache_hash_find (struct mbr_cache *p, sqlite3_int64 rowid)
 {
-/* scans a cache page, returning the index of the first available block containing a free cell */
-    int ib;
-    for (ib = 0; ib < 32; ib++)
+/* returns the slot corresponding to some ROWID, or -1 */
+    unsigned int mask;
+    unsigned int i;
+    if (p->hash_size == 0)
+	return -1;
+    mask = p->hash_size - 1;
+    i = cache_hash_key (rowid) & mask;
+    while (p->hash[i] != -1)
       {
-	  if ((pp->bitmap & cache_bitmask (ib)) == 0x00000000)
-	      return ib;
+	  int slot = p->hash[i];
+	  if (slot >= 0 && p->rowid[slot] == rowid)
+	      return slot;
+	  i = (i + 1) & mask;
       }
     return -1;
 }
 
 static void
-cache_fix_page_bitmap (struct mbr_cache_page *pp)
+cache_hash_put (struct mbr_cache *p, sqlite3_int64 rowid, int slot)
 {
-/* updating the cache page bitmap */
-    int ib;
-    for (ib = 0; ib < 32; ib++)
+/* inserting a ROWID into the hash table [there is always room] */
+    unsigned int mask = p->hash_size - 1;
+    unsigned int i = cache_hash_key (rowid) & mask;
+    while (p->hash[i] >= 0)
+	i = (i + 1) & mask;
+    if (p->hash[i] == -1)
+	p->hash_used++;
+    p->hash[i] = slot;
+}
+
+static int
+cache_hash_rebuild (struct mbr_cache *p)
+{
+/* (re)building the hash table so to fit all live entities */
+    int i;
+    int size = 64;
+    int *hash;
+    while (size < (p->count - p->n_deleted) * 2 + 64)
+	size *= 2;
+    hash = malloc (sizeof (int) * size);
+    if (hash == NULL)
+      {
+	  /* the stale hash table cannot be kept */
+	  if (p->hash)
+	      free (p->hash);
+	  p->hash = NULL;
+	  p->hash_size = 0;
+	  p->hash_used = 0;
+	  return 0;
+      }
+    for (i = 0; i < size; i++)
+	hash[i] = -1;
+    if (p->hash)
+	free (p->hash);
+    p->hash = hash;
+    p->hash_size = size;
+    p->hash_used = 0;
+    for (i = 0; i < p->count; i++)
       {
-	  if (pp->blocks[ib].bitmap == 0xffffffff)
+	  if (!p->deleted[i])
+	      cache_hash_put (p, p->rowid[i], i);
+      }
+    return 1;
+}
+
+static void
+cache_hash_remove (struct mbr_cache *p, sqlite3_int64 rowid)
+{
+/* removing a ROWID from the hash table */
+    unsigned int mask;
+    unsigned int i;
+    if (p->hash_size == 0)
+	return;
+    mask = p->hash_size - 1;
+    i = cache_hash_key (rowid) & mask;
+    while (p->hash[i] != -1)
+      {
+	  int slot = p->hash[i];
+	  if (slot >= 0 && p->rowid[slot] == rowid)
 	    {
-		/* all the cells into this block are used; marking the page bitmap */
-		pp->bitmap |= cache_bitmask (ib);
+		p->hash[i] = -2;
+		return;
 	    }
+	  i = (i + 1) & mask;
       }
 }
 
 static int
-cache_get_free_cell (struct mbr_cache_block *pb)
+cache_grow (struct mbr_cache *p, int allocated)
 {
-/* scans a cache block, returning the index of the first free cell */
-    int ic;
-    for (ic = 0; ic < 32; ic++)
+/* reallocating the entity arrays */
+    sqlite3_int64 *rowid;
+    double *coords;
+    unsigned char *deleted;
+    rowid = malloc (sizeof (sqlite3_int64) * allocated);
+    coords = malloc (sizeof (double) * 4 * allocated);
+    deleted = malloc (allocated);
+    if (rowid == NULL || coords == NULL || deleted == NULL)
       {
-	  if ((pb->bitmap & cache_bitmask (ic)) == 0x00000000)
-	      return ic;
+	  if (rowid)
+	      free (rowid);
+	  if (coords)
+	      free (coords);
+	  if (deleted)
+	      free (deleted);
+	  return 0;
       }
-    return -1;
+    if (p->count > 0)
+      {
+	  memcpy (rowid, p->rowid, sizeof (sqlite3_int64) * p->count);
+	  memcpy (coords, p->minx, sizeof (double) * p->count);
+	  memcpy (coords + allocated, p->miny, sizeof (double) * p->count);
+	  memcpy (coords + (2 * allocated), p->maxx,
+		  sizeof (double) * p->count);
+	  memcpy (coords + (3 * allocated), p->maxy,
+		  sizeof (double) * p->count);
+	  memcpy (deleted, p->deleted, p->count);
+      }
+    if (p->rowid)
+	free (p->rowid);
+    if (p->minx)
+	free (p->minx);
+    if (p->deleted)
+	free (p->deleted);
+    p->rowid = rowid;
+    p->minx = coords;
+    p->miny = coords + allocated;
+    p->maxx = coords + (2 * allocated);
+    p->maxy = coords + (3 * allocated);
+    p->deleted = deleted;
+    p->allocated = allocated;
+    return 1;
+}
+
+static int
+cache_insert_cell (struct mbr_cache *p, sqlite3_int64 rowid, double minx,
+		   double miny, double maxx, double maxy)
+{
+/* inserting a new cell [appended to the unsorted tail] */
+    int slot;
+    if (p->count >= p->allocated)
+      {
+	  if (!cache_grow
+	      (p, (p->allocated == 0) ? 1024 : p->allocated * 2))
+	      return 0;
+      }
+    if ((p->hash_used + 1) * 10 >= p->hash_size * 7)
+      {
+	  /* the hash table is becoming too crowded: rebuilding */
+	  if (!cache_hash_rebuild (p))
+	      return 0;
+      }
+    slot = p->count;
+    p->rowid[slot] = rowid;
+    p->minx[slot] = minx;
+    p->miny[slot] = miny;
+    p->maxx[slot] = maxx;
+    p->maxy[slot] = maxy;
+    p->deleted[slot] = 0;
+    p->count += 1;
+    cache_hash_put (p, rowid, slot);
+    return 1;
+}
+
+static int
+cache_delete_cell (struct mbr_cache *p, sqlite3_int64 rowid)
+{
+/* trying to delete a row identified by rowid from the Mbr cache */
+    int slot = cache_hash_find (p, rowid);
+    if (slot < 0)
+	return 0;
+    cache_hash_remove (p, rowid);
+    p->deleted[slot] = 1;
+    p->n_deleted += 1;
+    return 1;
+}
+
+static int
+cache_update_cell (struct mbr_cache *p, sqlite3_int64 rowid, double minx,
+		   double miny, double maxx, double maxy)
+{
+/* trying to update a row identified by rowid from the Mbr cache */
+    int lvl;
+    int node;
+    float fminx;
+    float fminy;
+    float fmaxx;
+    float fmaxy;
+    int slot = cache_hash_find (p, rowid);
+    if (slot < 0)
+	return 0;
+    p->minx[slot] = minx;
+    p->miny[slot] = miny;
+    p->maxx[slot] = maxx;
+    p->maxy[slot] = maxy;
+    if (slot >= p->packed)
+	return 1;
+/* enlarging all the ancestor nodes, so to still cover the entity */
+    fminx = gaiaFloatRoundDown (minx);
+    fminy = gaiaFloatRoundDown (miny);
+    fmaxx = gaiaFloatRoundUp (maxx);
+    fmaxy = gaiaFloatRoundUp (maxy);
+    node = slot / MBR_CACHE_FANOUT;
+    for (lvl = 0; lvl < p->n_levels; lvl++)
+      {
+	  struct mbr_cache_level *level = p->levels + lvl;
+	  if (level->minx[node] > fminx)
+	      level->minx[node] = fminx;
+	  if (level->miny[node] > fminy)
+	      level->miny[node] = fminy;
+	  if (level->maxx[node] < fmaxx)
+	      level->maxx[node] = fmaxx;
+	  if (level->maxy[node] < fmaxy)
+	      level->maxy[node] = fmaxy;
+	  node /= MBR_CACHE_FANOUT;
+      }
+    return 1;
+}
+
+static int
+cache_needs_repack (struct mbr_cache *p)
+{
+/* checks if the packed tree has become too much inefficient */
+    int tail = p->count - p->packed;
+    if (tail > 256 && tail * 8 > p->packed)
+	return 1;
+    if (p->n_deleted > 256 && p->n_deleted * 4 > p->count)
+	return 1;
+    return 0;
+}
+
+struct mbr_cache_sort_item
+{
+/* a struct supporting the Hilbert sort */
+    unsigned int key;
+    int slot;
+};
+
+static int
+cache_cmp_hilbert (const void *p1, const void *p2)
+{
+/* sorting by Hilbert key */
+    const struct mbr_cache_sort_item *i1 =
+	(const struct mbr_cache_sort_item *) p1;
+    const struct mbr_cache_sort_item *i2 =
+	(const struct mbr_cache_sort_item *) p2;
+    if (i1->key < i2->key)
+	return -1;
+    if (i1->key > i2->key)
+	return 1;
+    if (i1->slot < i2->slot)
+	return -1;
+    if (i1->slot > i2->slot)
+	return 1;
+    return 0;
 }
 
-static struct mbr_cache_page *
-cache_get_free_page (struct mbr_cache *p)
+static int
+cache_build_level (struct mbr_cache_level *level, int count)
+{
+/* allocating a tree level */
+    float *buf = malloc (sizeof (float) * 4 * count);
+    if (buf == NULL)
+	return 0;
+    level->count = count;
+    level->minx = buf;
+    level->miny = buf + count;
+    level->maxx = buf + (2 * count);
+    level->maxy = buf + (3 * count);
+    return 1;
+}
+
+static int
+cache_repack (struct mbr_cache *p)
 {
-/* return a pointer to the first cache page containing a free cell */
-    struct mbr_cache_page *pp;
-    if (!(p->first))
+/*
+sorting all live entities by Hilbert key and rebuilding the packed tree
+returns 0 on failure: the cache is left unchanged if sorting fails,
+but becomes unusable if the ROWID hash table cannot be rebuilt
+*/
+    struct mbr_cache_sort_item *items;
+    struct mbr_cache old;
+    double ext_minx = DBL_MAX;
+    double ext_miny = DBL_MAX;
+    double ext_maxx = -DBL_MAX;
+    double ext_maxy = -DBL_MAX;
+    double scale_x;
+    double scale_y;
+    int live = p->count - p->n_deleted;
+    int i;
+    int n;
+    int lvl;
+
+    items = malloc (sizeof (struct mbr_cache_sort_item) * (live + 1));
+    if (items == NULL)
+	return 0;
+    for (i = 0; i < p->count; i++)
+      {
+	  double cx;
+	  double cy;
+	  if (p->deleted[i])
+	      continue;
+	  cx = (p->minx[i] + p->maxx[i]) / 2.0;
+	  cy = (p->miny[i] + p->maxy[i]) / 2.0;
+	  if (cx < ext_minx)
+	      ext_minx = cx;
+	  if (cx > ext_maxx)
+	      ext_maxx = cx;
+	  if (cy < ext_miny)
+	      ext_miny = cy;
+	  if (cy > ext_maxy)
+	      ext_maxy = cy;
+      }
+    scale_x = (ext_maxx > ext_minx) ? 65535.0 / (ext_maxx - ext_minx) : 0.0;
+    scale_y = (ext_maxy > ext_miny) ? 65535.0 / (ext_maxy - ext_miny) : 0.0;
+    n = 0;
+    for (i = 0; i < p->count; i++)
       {
-	  /* the cache is empty; so we surely need to allocate the first page */
-	  pp = cache_page_alloc ();
-	  p->first = pp;
-	  p->last = pp;
-	  p->current = pp;
-	  return pp;
+	  if (p->deleted[i])
+	      continue;
+	  items[n].key =
+	      gaiaHilbertKey ((p->minx[i] + p->maxx[i]) / 2.0,
+			      (p->miny[i] + p->maxy[i]) / 2.0, ext_minx,
+			      ext_miny, scale_x, scale_y);
+	  items[n].slot = i;
+	  n++;
+      }
+    qsort (items, n, sizeof (struct mbr_cache_sort_item), cache_cmp_hilbert);
+
+/* moving the entities into Hilbert order */
+    old = *p;
+    p->rowid = NULL;
+    p->minx = NULL;
+    p->deleted = NULL;
+    p->count = 0;
+    p->allocated = 0;
+    if (!cache_grow (p, (live < 1024) ? 1024 : live + (live / 8)))
+      {
+	  p->rowid = old.rowid;
+	  p->minx = old.minx;
+	  p->deleted = old.deleted;
+	  p->count = old.count;
+	  p->allocated = old.allocated;
+	  free (items);
+	  return 0;
       }
-    if (p->current)
+    for (i = 0; i < n; i++)
       {
-	  /* checking if there is at least a free block into the current page */
-	  if (p->current->bitmap != 0xffffffff)
-	      return p->current;
+	  int slot = items[i].slot;
+	  p->rowid[i] = old.rowid[slot];
+	  p->minx[i] = old.minx[slot];
+	  p->miny[i] = old.miny[slot];
+	  p->maxx[i] = old.maxx[slot];
+	  p->maxy[i] = old.maxy[slot];
+	  p->deleted[i] = 0;
       }
-    pp = p->first;
-    while (pp)
+    free (items);
+    free (old.rowid);
+    free (old.minx);
+    free (old.deleted);
+    p->count = n;
+    p->n_deleted = 0;
+    p->packed = 0;
+    if (!cache_hash_rebuild (p))
+	return 0;
+
+/* building the packed tree bottom-up */
+    cache_free_levels (p);
+    n = p->count;
+    lvl = 0;
+    while (n > 0 && lvl < MBR_CACHE_MAX_LEVELS)
       {
-	  /* scanning the page list in order to discover if there is an existing page not yet completely filled */
-	  if (pp->bitmap != 0xffffffff)
+	  struct mbr_cache_level *level = p->levels + lvl;
+	  int n_nodes = (n + MBR_CACHE_FANOUT - 1) / MBR_CACHE_FANOUT;
+	  int node;
+	  if (!cache_build_level (level, n_nodes))
 	    {
-		p->current = pp;
-		return pp;
+		/* unable to build the tree: everything is a tail */
+		cache_free_levels (p);
+		return 1;
+	    }
+	  p->n_levels = lvl + 1;
+	  for (node = 0; node < n_nodes; node++)
+	    {
+		int base = node * MBR_CACHE_FANOUT;
+		int last = base + MBR_CACHE_FANOUT;
+		float minx = FLT_MAX;
+		float miny = FLT_MAX;
+		float maxx = -FLT_MAX;
+		float maxy = -FLT_MAX;
+		if (last > n)
+		    last = n;
+		for (i = base; i < last; i++)
+		  {
+		      float v;
+		      if (lvl == 0)
+			{
+			    v = gaiaFloatRoundDown (p->minx[i]);
+			    if (v < minx)
+				minx = v;
+			    v = gaiaFloatRoundDown (p->miny[i]);
+			    if (v < miny)
+				miny = v;
+			    v = gaiaFloatRoundUp (p->maxx[i]);
+			    if (v > maxx)
+				maxx = v;
+			    v = gaiaFloatRoundUp (p->maxy[i]);
+			    if (v > maxy)
+				maxy = v;
+			}
+		      else
+			{
+			    struct mbr_cache_level *child = level - 1;
+			    if (child->minx[i] < minx)
+				minx = child->minx[i];
+			    if (child->miny[i] < miny)
+				miny = child->miny[i];
+			    if (child->maxx[i] > maxx)
+				maxx = child->maxx[i];
+			    if (child->maxy[i] > maxy)
+				maxy = child->maxy[i];
+			}
+		  }
+		level->minx[node] = minx;
+		level->miny[node] = miny;
+		level->maxx[node] = maxx;
+		level->maxy[node] = maxy;
 	    }
-	  pp = pp->next;
+	  if (n_nodes <= MBR_CACHE_FANOUT)
+	      break;
+	  n = n_nodes;
+	  lvl++;
       }
-/* we have to allocate a new page */
-    pp = cache_page_alloc ();
-    p->last->next = pp;
-    p->last = pp;
-    p->current = pp;
-    return pp;
+    p->packed = p->count;
+    return 1;
+}
+
+static int
+cache_match (struct mbr_cache *p, int slot, double minx, double miny,
+	     double maxx, double maxy, int mode)
+{
+/* checks if a cached entity satisfies the MBR spatial relation */
+    if (p->deleted[slot])
+	return 0;
+    if (mode == GAIA_FILTER_MBR_INTERSECTS)
+      {
+	  /* MBR INTERSECTS */
+	  if (p->maxx[slot] >= minx && p->minx[slot] <= maxx
+	      && p->maxy[slot] >= miny && p->miny[slot] <= maxy)
+	      return 1;
+      }
+    else if (mode == GAIA_FILTER_MBR_CONTAINS)
+      {
+	  /* MBR CONTAINS */
+	  if (minx >= p->minx[slot] && maxx <= p->maxx[slot]
+	      && miny >= p->miny[slot] && maxy <= p->maxy[slot])
+	      return 1;
+      }
+    else
+      {
+	  /* MBR WITHIN */
+	  if (p->minx[slot] >= minx && p->maxx[slot] <= maxx
+	      && p->miny[slot] >= miny && p->maxy[slot] <= maxy)
+	      return 1;
+      }
+    return 0;
+}
+
+static int
+cache_cursor_add (MbrCacheCursorPtr cursor, int slot)
+{
+/* appending a slot to the cursor's result set */
+    if (cursor->n_slots >= cursor->allocated)
+      {
+	  int allocated = (cursor->allocated == 0) ? 256 : cursor->allocated * 2;
+	  int *slots = realloc (cursor->slots, sizeof (int) * allocated);
+	  if (slots == NULL)
+	      return 0;
+	  cursor->slots = slots;
+	  cursor->allocated = allocated;
+      }
+    cursor->slots[cursor->n_slots] = slot;
+    cursor->n_slots += 1;
+    return 1;
 }
 
 static void
-cache_insert_cell (struct mbr_cache *p, sqlite3_int64 rowid, double minx,
-		   double miny, double maxx, double maxy)
+cache_search (struct mbr_cache *p, MbrCacheCursorPtr cursor, double minx,
+	      double miny, double maxx, double maxy, int mode)
+{
+/* collecting all cached entities satisfying the MBR spatial relation */
+    int stack_level[MBR_CACHE_MAX_LEVELS * MBR_CACHE_FANOUT];
+    int stack_node[MBR_CACHE_MAX_LEVELS * MBR_CACHE_FANOUT];
+    int sp = 0;
+    int i;
+
+    if (p->n_levels > 0)
+      {
+	  /* starting from the root level */
+	  struct mbr_cache_level *top = p->levels + (p->n_levels - 1);
+	  for (i = 0; i < top->count; i++)
+	    {
+		stack_level[sp] = p->n_levels - 1;
+		stack_node[sp] = i;
+		sp++;
+	    }
+      }
+    while (sp > 0)
+      {
+	  int first;
+	  int last;
+	  int lvl;
+	  int node;
+	  struct mbr_cache_level *level;
+	  sp--;
+	  lvl = stack_level[sp];
+	  node = stack_node[sp];
+	  level = p->levels + lvl;
+	  if (level->maxx[node] < minx || level->minx[node] > maxx
+	      || level->maxy[node] < miny || level->miny[node] > maxy)
+	      continue;		/* not intersecting this node */
+	  first = node * MBR_CACHE_FANOUT;
+	  last = first + MBR_CACHE_FANOUT;
+	  if (lvl == 0)
+	    {
+		/* a leaf node: checking the entities */
+		if (last > p->packed)
+		    last = p->packed;
+		for (i = first; i < last; i++)
+		  {
+		      if (cache_match (p, i, minx, miny, maxx, maxy, mode))
+			{
+			    if (!cache_cursor_add (cursor, i))
+				return;
+			}
+		  }
+	    }
+	  else
+	    {
+		/* pushing the children nodes */
+		struct mbr_cache_level *child = level - 1;
+		if (last > child->count)
+		    last = child->count;
+		for (i = last - 1; i >= first; i--)
+		  {
+		      stack_level[sp] = lvl - 1;
+		      stack_node[sp] = i;
+		      sp++;
+		  }
+	    }
+      }
+/* sequentially scanning the unsorted tail */
+    for (i = p->packed; i < p->count; i++)
+      {
+	  if (cache_match (p, i, minx, miny, maxx, maxy, mode))
+	    {
+		if (!cache_cursor_add (cursor, i))
+		    return;
+	    }
+      }
+}
+
+struct mbr_cache_rowid_item
+{
+/* a struct supporting the ROWID sort */
+    sqlite3_int64 rowid;
+    int slot;
+};
+
+static int
+cache_cmp_rowid (const void *p1, const void *p2)
+{
+/* sorting by ROWID */
+    const struct mbr_cache_rowid_item *i1 =
+	(const struct mbr_cache_rowid_item *) p1;
+    const struct mbr_cache_rowid_item *i2 =
+	(const struct mbr_cache_rowid_item *) p2;
+    if (i1->rowid < i2->rowid)
+	return -1;
+    if (i1->rowid > i2->rowid)
+	return 1;
+    return 0;
+}
+
+static int
+cache_sort_by_rowid (struct mbr_cache *p, MbrCacheCursorPtr cursor)
 {
-/* inserting a new cell */
-    struct mbr_cache_page *pp = cache_get_free_page (p);
-    int ib = cache_get_free_block (pp);
-    struct mbr_cache_block *pb = pp->blocks + ib;
-    int ic = cache_get_free_cell (pb);
-    struct mbr_cache_cell *pc = pb->cells + ic;
-    pc->rowid = rowid;
-    pc->minx = minx;
-    pc->miny = miny;
-    pc->maxx = maxx;
-    pc->maxy = maxy;
-/* marking the cache cell as used into the block bitmap */
-    pb->bitmap |= cache_bitmask (ic);
-/* updating the cache block MBR */
-    if (pb->minx > minx)
-	pb->minx = minx;
-    if (pb->maxx < maxx)
-	pb->maxx = maxx;
-    if (pb->miny > miny)
-	pb->miny = miny;
-    if (pb->maxy < maxy)
-	pb->maxy = maxy;
-/* updating the cache page MBR */
-    if (pp->minx > minx)
-	pp->minx = minx;
-    if (pp->maxx < maxx)
-	pp->maxx = maxx;
-    if (pp->miny > miny)
-	pp->miny = miny;
-    if (pp->maxy < maxy)
-	pp->maxy = maxy;
-/* fixing the cache page bitmap */
-    cache_fix_page_bitmap (pp);
-/* updating min-max rowid into the cache page */
-    if (pp->min_rowid > rowid)
-	pp->min_rowid = rowid;
-    if (pp->max_rowid < rowid)
-	pp->max_rowid = rowid;
+/* sorting the cursor slots in ROWID order */
+    struct mbr_cache_rowid_item *items;
+    int i;
+    if (cursor->n_slots < 2)
+	return 1;
+    items = malloc (sizeof (struct mbr_cache_rowid_item) * cursor->n_slots);
+    if (items == NULL)
+	return 0;
+    for (i = 0; i < cursor->n_slots; i++)
+      {
+	  items[i].slot = cursor->slots[i];
+	  items[i].rowid = p->rowid[cursor->slots[i]];
+      }
+    qsort (items, cursor->n_slots, sizeof (struct mbr_cache_rowid_item),
+	   cache_cmp_rowid);
+    for (i = 0; i < cursor->n_slots; i++)
+	cursor->slots[i] = items[i].slot;
+    free (items);
+    return 1;
 }
 
 static struct mbr_cache *
 cache_load (sqlite3 * handle, const char *table, const char *column)
 {
-/* 
+/*
 initial loading the MBR cache
-retrieving any existing entity from the main table 
+retrieving any existing entity from the main table
 */
     sqlite3_stmt *stmt;
     int ret;
@@ -517,6 +898,11 @@ retrieving any existing entity from the main table
 	  return NULL;
       }
     p_cache = cache_alloc ();
+    if (p_cache == NULL)
+      {
+	  sqlite3_finalize (stmt);
+	  return NULL;
+      }
     while (1)
       {
 	  ret = sqlite3_step (stmt);
@@ -533,22 +919,28 @@ retrieving any existing entity from the main table
 		    v1 = 1;
 		if (sqlite3_column_type (stmt, 1) == SQLITE_FLOAT)
 		    v2 = 1;
-		if (sqlite3_column_type (stmt, 1) == SQLITE_FLOAT)
+		if (sqlite3_column_type (stmt, 2) == SQLITE_FLOAT)
 		    v3 = 1;
-		if (sqlite3_column_type (stmt, 1) == SQLITE_FLOAT)
+		if (sqlite3_column_type (stmt, 3) == SQLITE_FLOAT)
 		    v4 = 1;
-		if (sqlite3_column_type (stmt, 1) == SQLITE_FLOAT)
+		if (sqlite3_column_type (stmt, 4) == SQLITE_FLOAT)
 		    v5 = 1;
 		if (v1 && v2 && v3 && v4 && v5)
 		  {
 		      /* ok, this entity is a valid one; inserting them into the MBR's cache */
-		      rowid = sqlite3_column_int (stmt, 0);
+		      rowid = sqlite3_column_int64 (stmt, 0);
 		      minx = sqlite3_column_double (stmt, 1);
 		      miny = sqlite3_column_double (stmt, 2);
 		      maxx = sqlite3_column_double (stmt, 3);
 		      maxy = sqlite3_column_double (stmt, 4);
-		      cache_insert_cell (p_cache, rowid, minx, miny, maxx,
-					 maxy);
+		      if (!cache_insert_cell
+			  (p_cache, rowid, minx, miny, maxx, maxy))
+			{
+			    spatialite_e ("cache error: insufficient memory\n");
+			    sqlite3_finalize (stmt);
+			    cache_destroy (p_cache);
+			    return NULL;
+			}
 		  }
 	    }
 	  else
@@ -563,303 +955,13 @@ retrieving any existing entity from the main table
       }
 /* we have now to finalize the query [memory cleanup] */
     sqlite3_finalize (stmt);
-    return p_cache;
-}
-
-static int
-cache_find_next_cell (struct mbr_cache_page **page, int *i_block, int *i_cell,
-		      struct mbr_cache_cell **cell)
-{
-/* finding next cached cell */
-    struct mbr_cache_page *pp = *page;
-    struct mbr_cache_block *pb;
-    struct mbr_cache_cell *pc;
-    int ib;
-    int ic;
-    int sib = *i_block;
-    int sic = *i_cell;
-    while (pp)
-      {
-	  for (ib = sib; ib < 32; ib++)
-	    {
-		pb = pp->blocks + ib;
-		for (ic = sic; ic < 32; ic++)
-		  {
-		      if ((pb->bitmap & cache_bitmask (ic)) == 0x00000000)
-			  continue;
-		      pc = pb->cells + ic;
-		      if (pc == *cell)
-			{
-			    /* this one is the current cell */
-			    continue;
-			}
-		      /* next cell found */
-		      *page = pp;
-		      *i_block = ib;
-		      *i_cell = ic;
-		      *cell = pc;
-		      return 1;
-		  }
-		sic = 0;
-	    }
-	  sib = 0;
-	  pp = pp->next;
-      }
-    return 0;
-}
-
-static int
-cache_find_next_mbr (struct mbr_cache_page **page, int *i_block, int *i_cell,
-		     struct mbr_cache_cell **cell, double minx, double miny,
-		     double maxx, double maxy, int mode)
-{
-/* finding next cached cell */
-    struct mbr_cache_page *pp = *page;
-    struct mbr_cache_block *pb;
-    struct mbr_cache_cell *pc;
-    int ib;
-    int ic;
-    int sib = *i_block;
-    int sic = *i_cell;
-    int ok_mbr;
-    while (pp)
-      {
-	  ok_mbr = 0;
-	  if (pp->maxx >= minx && pp->minx <= maxx && pp->maxy >= miny
-	      && pp->miny <= maxy)
-	      ok_mbr = 1;
-	  if (ok_mbr)
-	    {
-		for (ib = sib; ib < 32; ib++)
-		  {
-		      pb = pp->blocks + ib;
-		      ok_mbr = 0;
-		      if (pb->maxx >= minx && pb->minx <= maxx
-			  && pb->maxy >= miny && pb->miny <= maxy)
-			  ok_mbr = 1;
-		      if (ok_mbr)
-			{
-			    for (ic = sic; ic < 32; ic++)
-			      {
-				  if ((pb->bitmap & cache_bitmask (ic)) ==
-				      0x00000000)
-				      continue;
-				  pc = pb->cells + ic;
-				  ok_mbr = 0;
-				  if (mode == GAIA_FILTER_MBR_INTERSECTS)
-				    {
-					/* MBR INTERSECTS */
-					if (pc->maxx >= minx && pc->minx <= maxx
-					    && pc->maxy >= miny
-					    && pc->miny <= maxy)
-					    ok_mbr = 1;
-				    }
-				  else if (mode == GAIA_FILTER_MBR_CONTAINS)
-				    {
-					/* MBR CONTAINS */
-					if (minx >= pc->minx && maxx <= pc->maxx
-					    && miny >= pc->miny
-					    && maxy <= pc->maxy)
-					    ok_mbr = 1;
-				    }
-				  else
-				    {
-					/* MBR WITHIN */
-					if (pc->minx >= minx && pc->maxx <= maxx
-					    && pc->miny >= miny
-					    && pc->maxy <= maxy)
-					    ok_mbr = 1;
-				    }
-				  if (ok_mbr)
-				    {
-					if (pc == *cell)
-					  {
-					      /* this one is the current cell */
-					      continue;
-					  }
-					/* next cell found */
-					*page = pp;
-					*i_block = ib;
-					*i_cell = ic;
-					*cell = pc;
-					return 1;
-				    }
-			      }
-			}
-		      sic = 0;
-		  }
-	    }
-	  sib = 0;
-	  pp = pp->next;
-      }
-    return 0;
-}
-
-static struct mbr_cache_cell *
-cache_find_by_rowid (struct mbr_cache_page *pp, sqlite3_int64 rowid)
-{
-/* trying to find a row by rowid from the Mbr cache */
-    struct mbr_cache_block *pb;
-    struct mbr_cache_cell *pc;
-    int ib;
-    int ic;
-    while (pp)
-      {
-	  if (rowid >= pp->min_rowid && rowid <= pp->max_rowid)
-	    {
-		for (ib = 0; ib < 32; ib++)
-		  {
-		      pb = pp->blocks + ib;
-		      for (ic = 0; ic < 32; ic++)
-			{
-			    if ((pb->bitmap & cache_bitmask (ic)) == 0x00000000)
-				continue;
-			    pc = pb->cells + ic;
-			    if (pc->rowid == rowid)
-				return pc;
-			}
-		  }
-	    }
-	  pp = pp->next;
-      }
-    return 0;
-}
-
-static void
-cache_update_page (struct mbr_cache_page *pp, int i_block)
-{
-/* updating the cache block and cache page MBR after a DELETE or UPDATE occurred */
-    struct mbr_cache_block *pb;
-    struct mbr_cache_cell *pc;
-    int ib;
-    int ic;
-/* updating the cache block MBR */
-    pb = pp->blocks + i_block;
-    pb->minx = DBL_MAX;
-    pb->miny = DBL_MAX;
-    pb->maxx = -DBL_MAX;
-    pb->maxy = -DBL_MAX;
-    for (ic = 0; ic < 32; ic++)
-      {
-	  if ((pb->bitmap & cache_bitmask (ic)) == 0x00000000)
-	      continue;
-	  pc = pb->cells + ic;
-	  if (pb->minx > pc->minx)
-	      pb->minx = pc->minx;
-	  if (pb->miny > pc->miny)
-	      pb->miny = pc->miny;
-	  if (pb->maxx < pc->maxx)
-	      pb->maxx = pc->maxx;
-	  if (pb->maxy < pc->maxy)
-	      pb->maxy = pc->maxy;
-      }
-/* updating the cache page MBR */
-    pp->minx = DBL_MAX;
-    pp->miny = DBL_MAX;
-    pp->maxx = -DBL_MAX;
-    pp->maxy = -DBL_MAX;
-    pp->min_rowid = LONG64_MAX;
-    pp->max_rowid = LONG64_MIN;
-    for (ib = 0; ib < 32; ib++)
-      {
-	  pb = pp->blocks + ib;
-	  for (ic = 0; ic < 32; ic++)
-	    {
-		if ((pb->bitmap & cache_bitmask (ic)) == 0x00000000)
-		    continue;
-		pc = pb->cells + ic;
-		if (pp->minx > pc->minx)
-		    pp->minx = pc->minx;
-		if (pp->miny > pc->miny)
-		    pp->miny = pc->miny;
-		if (pp->maxx < pc->maxx)
-		    pp->maxx = pc->maxx;
-		if (pp->maxy < pc->maxy)
-		    pp->maxy = pc->maxy;
-		if (pp->min_rowid > pc->rowid)
-		    pp->min_rowid = pc->rowid;
-		if (pp->max_rowid < pc->rowid)
-		    pp->max_rowid = pc->rowid;
-	    }
-      }
-}
-
-static int
-cache_delete_cell (struct mbr_cache_page *pp, sqlite3_int64 rowid)
-{
-/* trying to delete a row identified by rowid from the Mbr cache */
-    struct mbr_cache_block *pb;
-    struct mbr_cache_cell *pc;
-    int ib;
-    int ic;
-    while (pp)
-      {
-	  if (rowid >= pp->min_rowid && rowid <= pp->max_rowid)
-	    {
-		for (ib = 0; ib < 32; ib++)
-		  {
-		      pb = pp->blocks + ib;
-		      for (ic = 0; ic < 32; ic++)
-			{
-			    if ((pb->bitmap & cache_bitmask (ic)) == 0x00000000)
-				continue;
-			    pc = pb->cells + ic;
-			    if (pc->rowid == rowid)
-			      {
-				  /* marking the cell as free */
-				  pb->bitmap &= ~(cache_bitmask (ic));
-				  /* marking the block as not full */
-				  pp->bitmap &= ~(cache_bitmask (ib));
-				  /* updating the cache block and cache page MBR */
-				  cache_update_page (pp, ib);
-				  return 1;
-			      }
-			}
-		  }
-	    }
-	  pp = pp->next;
-      }
-    return 0;
-}
-
-static int
-cache_update_cell (struct mbr_cache_page *pp, sqlite3_int64 rowid, double minx,
-		   double miny, double maxx, double maxy)
-{
-/* trying to update a row identified by rowid from the Mbr cache */
-    struct mbr_cache_block *pb;
-    struct mbr_cache_cell *pc;
-    int ib;
-    int ic;
-    while (pp)
+/* building the packed tree */
+    if (!cache_repack (p_cache))
       {
-	  if (rowid >= pp->min_rowid && rowid <= pp->max_rowid)
-	    {
-		for (ib = 0; ib < 32; ib++)
-		  {
-		      pb = pp->blocks + ib;
-		      for (ic = 0; ic < 32; ic++)
-			{
-			    if ((pb->bitmap & cache_bitmask (ic)) == 0x00000000)
-				continue;
-			    pc = pb->cells + ic;
-			    if (pc->rowid == rowid)
-			      {
-				  /* updating the cell MBR */
-				  pc->minx = minx;
-				  pc->miny = miny;
-				  pc->maxx = maxx;
-				  pc->maxy = maxy;
-				  /* updating the cache block and cache page MBR */
-				  cache_update_page (pp, ib);
-				  return 1;
-			      }
-			}
-		  }
-	    }
-	  pp = pp->next;
+	  cache_destroy (p_cache);
+	  return NULL;
       }
-    return 0;
+    return p_cache;
 }
 
 static int
@@ -899,6 +1001,8 @@ mbrc_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
     p_vt->table_name = NULL;
     p_vt->column_name = NULL;
     p_vt->cache = NULL;
+    p_vt->error = 0;
+    p_vt->n_cursors = 0;
 /* checking for table_name and geo_column_name */
     if (argc == 5)
       {
@@ -1002,8 +1106,9 @@ mbrc_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
     p_vt->error = 0;
     xname = gaiaDoubleQuotedSql (vtable);
     sql_statement =
-	sqlite3_mprintf ("CREATE TABLE \"%s\" (rowid INTEGER, mbr BLOB)",
-			 xname);
+	sqlite3_mprintf
+	("CREATE TABLE \"%s\" (rowid INTEGER, mbr BLOB, memory_usage INTEGER HIDDEN)",
+	 xname);
     free (xname);
     if (sqlite3_declare_vtab (db, sql_statement) != SQLITE_OK)
       {
@@ -1114,61 +1219,6 @@ mbrc_destroy (sqlite3_vtab * pVTab)
     return mbrc_disconnect (pVTab);
 }
 
-static void
-mbrc_read_row_unfiltered (MbrCacheCursorPtr cursor)
-{
-/* trying to read the next row from the Mbr cache - unfiltered mode */
-    struct mbr_cache_page *page = cursor->current_page;
-    struct mbr_cache_cell *cell = cursor->current_cell;
-    int i_block = cursor->current_block_index;
-    int i_cell = cursor->current_cell_index;
-    if (cache_find_next_cell (&page, &i_block, &i_cell, &cell))
-      {
-	  cursor->current_page = page;
-	  cursor->current_block_index = i_block;
-	  cursor->current_cell_index = i_cell;
-	  cursor->current_cell = cell;
-      }
-    else
-	cursor->eof = 1;
-}
-
-static void
-mbrc_read_row_filtered (MbrCacheCursorPtr cursor)
-{
-/* trying to read the next row from the Mbr cache - spatially filter mode */
-    struct mbr_cache_page *page = cursor->current_page;
-    struct mbr_cache_cell *cell = cursor->current_cell;
-    int i_block = cursor->current_block_index;
-    int i_cell = cursor->current_cell_index;
-    if (cache_find_next_mbr
-	(&page, &i_block, &i_cell, &cell, cursor->minx, cursor->miny,
-	 cursor->maxx, cursor->maxy, cursor->mbr_mode))
-      {
-	  cursor->current_page = page;
-	  cursor->current_block_index = i_block;
-	  cursor->current_cell_index = i_cell;
-	  cursor->current_cell = cell;
-      }
-    else
-	cursor->eof = 1;
-}
-
-static void
-mbrc_read_row_by_rowid (MbrCacheCursorPtr cursor, sqlite3_int64 rowid)
-{
-/* trying to find a row by rowid from the Mbr cache */
-    struct mbr_cache_cell *cell =
-	cache_find_by_rowid (cursor->pVtab->cache->first, rowid);
-    if (cell)
-	cursor->current_cell = cell;
-    else
-      {
-	  cursor->current_cell = NULL;
-	  cursor->eof = 1;
-      }
-}
-
 static int
 mbrc_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
 {
@@ -1179,20 +1229,21 @@ mbrc_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
     if (cursor == NULL)
 	return SQLITE_ERROR;
     cursor->pVtab = p_vt;
+    cursor->strategy = 0;
+    cursor->slots = NULL;
+    cursor->n_slots = 0;
+    cursor->allocated = 0;
+    cursor->current = 0;
+    cursor->eof = 1;
+    p_vt->n_cursors += 1;
     if (p_vt->error)
       {
-	  cursor->eof = 1;
 	  *ppCursor = (sqlite3_vtab_cursor *) cursor;
 	  return SQLITE_OK;
       }
     if (!(p_vt->cache))
 	p_vt->cache =
 	    cache_load (p_vt->db, p_vt->table_name, p_vt->column_name);
-    cursor->current_page = cursor->pVtab->cache->first;
-    cursor->current_block_index = 0;
-    cursor->current_cell_index = 0;
-    cursor->current_cell = NULL;
-    cursor->eof = 0;
     *ppCursor = (sqlite3_vtab_cursor *) cursor;
     return SQLITE_OK;
 }
@@ -1201,6 +1252,10 @@ static int
 mbrc_close (sqlite3_vtab_cursor * pCursor)
 {
 /* closing the cursor */
+    MbrCacheCursorPtr cursor = (MbrCacheCursorPtr) pCursor;
+    cursor->pVtab->n_cursors -= 1;
+    if (cursor->slots)
+	free (cursor->slots);
     sqlite3_free (pCursor);
     return SQLITE_OK;
 }
@@ -1210,34 +1265,52 @@ mbrc_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
 	     int argc, sqlite3_value ** argv)
 {
 /* setting up a cursor filter */
+    int i;
+    struct mbr_cache *cache;
     MbrCacheCursorPtr cursor = (MbrCacheCursorPtr) pCursor;
     if (idxStr || argc)
 	idxStr = idxStr;	/* unused arg warning suppression */
-    if (cursor->pVtab->error)
+    cursor->n_slots = 0;
+    cursor->current = 0;
+    cursor->eof = 1;
+    cursor->strategy = idxNum;
+    cache = cursor->pVtab->cache;
+    if (cursor->pVtab->error || cache == NULL)
+	return SQLITE_OK;
+    if (cursor->pVtab->n_cursors == 1 && cache_needs_repack (cache))
       {
-	  cursor->eof = 1;
-	  return SQLITE_OK;
+	  /* no other cursor depends on the current slots: repacking */
+	  if (!cache_repack (cache))
+	    {
+		cursor->pVtab->error = 1;
+		return SQLITE_NOMEM;
+	    }
       }
-    cursor->current_page = cursor->pVtab->cache->first;
-    cursor->current_block_index = 0;
-    cursor->current_cell_index = 0;
-    cursor->current_cell = NULL;
-    cursor->eof = 0;
-    cursor->strategy = idxNum;
     if (idxNum == 0)
       {
-	  /* unfiltered mode */
-	  mbrc_read_row_unfiltered (cursor);
-	  return SQLITE_OK;
+	  /* unfiltered mode: returning all entities in ROWID order */
+	  for (i = 0; i < cache->count; i++)
+	    {
+		if (cache->deleted[i])
+		    continue;
+		if (!cache_cursor_add (cursor, i))
+		    return SQLITE_NOMEM;
+	    }
+	  if (!cache_sort_by_rowid (cache, cursor))
+	      return SQLITE_NOMEM;
       }
-    if (idxNum == 1)
+    else if (idxNum == 1)
       {
 	  /* filtering by ROWID */
 	  sqlite3_int64 rowid = sqlite3_value_int64 (argv[0]);
-	  mbrc_read_row_by_rowid (cursor, rowid);
-	  return SQLITE_OK;
+	  int slot = cache_hash_find (cache, rowid);
+	  if (slot >= 0)
+	    {
+		if (!cache_cursor_add (cursor, slot))
+		    return SQLITE_NOMEM;
+	    }
       }
-    if (idxNum == 2)
+    else if (idxNum == 2)
       {
 	  /* filtering by MBR spatial relation */
 	  unsigned char *p_blob;
@@ -1248,33 +1321,19 @@ mbrc_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
 	  double maxy;
 	  int mode;
 	  if (sqlite3_value_type (argv[0]) != SQLITE_BLOB)
-	      cursor->eof = 1;
-	  else
-	    {
-		p_blob = (unsigned char *) sqlite3_value_blob (argv[0]);
-		n_bytes = sqlite3_value_bytes (argv[0]);
-		if (gaiaParseFilterMbr
-		    (p_blob, n_bytes, &minx, &miny, &maxx, &maxy, &mode))
-		  {
-		      if (mode == GAIA_FILTER_MBR_WITHIN
-			  || mode == GAIA_FILTER_MBR_CONTAINS
-			  || mode == GAIA_FILTER_MBR_INTERSECTS)
-			{
-			    cursor->minx = minx;
-			    cursor->miny = miny;
-			    cursor->maxx = maxx;
-			    cursor->maxy = maxy;
-			    cursor->mbr_mode = mode;
-			    mbrc_read_row_filtered (cursor);
-			}
-		      else
-			  cursor->eof = 1;
-		  }
-	    }
-	  return SQLITE_OK;
+	      return SQLITE_OK;
+	  p_blob = (unsigned char *) sqlite3_value_blob (argv[0]);
+	  n_bytes = sqlite3_value_bytes (argv[0]);
+	  if (!gaiaParseFilterMbr
+	      (p_blob, n_bytes, &minx, &miny, &maxx, &maxy, &mode))
+	      return SQLITE_OK;
+	  if (mode == GAIA_FILTER_MBR_WITHIN
+	      || mode == GAIA_FILTER_MBR_CONTAINS
+	      || mode == GAIA_FILTER_MBR_INTERSECTS)
+	      cache_search (cache, cursor, minx, miny, maxx, maxy, mode);
       }
-/* illegal query mode */
-    cursor->eof = 1;
+    if (cursor->n_slots > 0)
+	cursor->eof = 0;
     return SQLITE_OK;
 }
 
@@ -1283,17 +1342,24 @@ mbrc_next (sqlite3_vtab_cursor * pCursor)
 {
 /* fetching a next row from cursor */
     MbrCacheCursorPtr cursor = (MbrCacheCursorPtr) pCursor;
-    if (cursor->pVtab->error)
+    struct mbr_cache *cache = cursor->pVtab->cache;
+    if (cursor->pVtab->error || cache == NULL)
       {
 	  cursor->eof = 1;
 	  return SQLITE_OK;
       }
-    if (cursor->strategy == 0)
-	mbrc_read_row_unfiltered (cursor);
-    else if (cursor->strategy == 2)
-	mbrc_read_row_filtered (cursor);
-    else
-	cursor->eof = 1;
+    while (1)
+      {
+	  /* skipping any entity deleted in the meanwhile */
+	  cursor->current += 1;
+	  if (cursor->current >= cursor->n_slots)
+	    {
+		cursor->eof = 1;
+		break;
+	    }
+	  if (!cache->deleted[cursor->slots[cursor->current]])
+	      break;
+      }
     return SQLITE_OK;
 }
 
@@ -1310,34 +1376,43 @@ mbrc_column (sqlite3_vtab_cursor * pCursor, sqlite3_context * pContext,
 	     int column)
 {
 /* fetching value for the Nth column */
+    int slot;
     MbrCacheCursorPtr cursor = (MbrCacheCursorPtr) pCursor;
-    if (!(cursor->current_cell))
-	sqlite3_result_null (pContext);
-    else
+    struct mbr_cache *cache = cursor->pVtab->cache;
+    if (column == 2)
       {
-	  if (column == 0)
-	    {
-		/* the PRIMARY KEY column */
-		sqlite3_result_int64 (pContext, cursor->current_cell->rowid);
-	    }
-	  if (column == 1)
-	    {
-		/* the MBR column */
-		char *envelope = sqlite3_mprintf ("POLYGON(("
-						  "%1.2f %1.2f, %1.2f %1.2f, %1.2f %1.2f, %1.2f %1.2f, %1.2f %1.2f))",
-						  cursor->current_cell->minx,
-						  cursor->current_cell->miny,
-						  cursor->current_cell->maxx,
-						  cursor->current_cell->miny,
-						  cursor->current_cell->maxx,
-						  cursor->current_cell->maxy,
-						  cursor->current_cell->minx,
-						  cursor->current_cell->maxy,
-						  cursor->current_cell->minx,
-						  cursor->current_cell->miny);
-		sqlite3_result_text (pContext, envelope, strlen (envelope),
-				     sqlite3_free);
-	    }
+	  /* the hidden MEMORY_USAGE column */
+	  sqlite3_result_int64 (pContext, cache_memory_usage (cache));
+	  return SQLITE_OK;
+      }
+    if (cursor->eof || cache == NULL)
+      {
+	  sqlite3_result_null (pContext);
+	  return SQLITE_OK;
+      }
+    slot = cursor->slots[cursor->current];
+    if (column == 0)
+      {
+	  /* the PRIMARY KEY column */
+	  sqlite3_result_int64 (pContext, cache->rowid[slot]);
+      }
+    if (column == 1)
+      {
+	  /* the MBR column */
+	  char *envelope = sqlite3_mprintf ("POLYGON(("
+					    "%1.2f %1.2f, %1.2f %1.2f, %1.2f %1.2f, %1.2f %1.2f, %1.2f %1.2f))",
+					    cache->minx[slot],
+					    cache->miny[slot],
+					    cache->maxx[slot],
+					    cache->miny[slot],
+					    cache->maxx[slot],
+					    cache->maxy[slot],
+					    cache->minx[slot],
+					    cache->maxy[slot],
+					    cache->minx[slot],
+					    cache->miny[slot]);
+	  sqlite3_result_text (pContext, envelope, strlen (envelope),
+			       sqlite3_free);
       }
     return SQLITE_OK;
 }
@@ -1347,7 +1422,10 @@ mbrc_rowid (sqlite3_vtab_cursor * pCursor, sqlite_int64 * pRowid)
 {
 /* fetching the ROWID */
     MbrCacheCursorPtr cursor = (MbrCacheCursorPtr) pCursor;
-    *pRowid = cursor->current_cell->rowid;
+    if (cursor->eof || cursor->pVtab->cache == NULL)
+	*pRowid = 0;
+    else
+	*pRowid = cursor->pVtab->cache->rowid[cursor->slots[cursor->current]];
     return SQLITE_OK;
 }
 
@@ -1373,13 +1451,15 @@ mbrc_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
     if (!(p_vtab->cache))
 	p_vtab->cache =
 	    cache_load (p_vtab->db, p_vtab->table_name, p_vtab->column_name);
+    if (!(p_vtab->cache))
+	return SQLITE_NOMEM;
     if (argc == 1)
       {
 	  /* performing a DELETE */
 	  if (sqlite3_value_type (argv[0]) == SQLITE_INTEGER)
 	    {
 		rowid = sqlite3_value_int64 (argv[0]);
-		cache_delete_cell (p_vtab->cache->first, rowid);
+		cache_delete_cell (p_vtab->cache, rowid);
 	    }
 	  else
 	      illegal = 1;
@@ -1389,7 +1469,7 @@ mbrc_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
 	  if (sqlite3_value_type (argv[0]) == SQLITE_NULL)
 	    {
 		/* performing an INSERT */
-		if (argc == 4)
+		if (argc >= 4)
 		  {
 		      if (sqlite3_value_type (argv[2]) == SQLITE_INTEGER
 			  && sqlite3_value_type (argv[3]) == SQLITE_BLOB)
@@ -1404,12 +1484,14 @@ mbrc_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
 			      {
 				  if (mode == GAIA_FILTER_MBR_DECLARE)
 				    {
-					if (!cache_find_by_rowid
-					    (p_vtab->cache->first, rowid))
-					    cache_insert_cell (p_vtab->cache,
-							       rowid, minx,
-							       miny, maxx,
-							       maxy);
+					if (cache_hash_find
+					    (p_vtab->cache, rowid) < 0)
+					  {
+					      if (!cache_insert_cell
+						  (p_vtab->cache, rowid, minx,
+						   miny, maxx, maxy))
+						  return SQLITE_NOMEM;
+					  }
 				    }
 				  else
 				      illegal = 1;
@@ -1426,7 +1508,7 @@ mbrc_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
 	  else
 	    {
 		/* performing an UPDATE */
-		if (argc == 4)
+		if (argc >= 4)
 		  {
 		      if (sqlite3_value_type (argv[0]) == SQLITE_INTEGER
 			  && sqlite3_value_type (argv[3]) == SQLITE_BLOB)
@@ -1440,7 +1522,7 @@ mbrc_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
 				 &mode))
 			      {
 				  if (mode == GAIA_FILTER_MBR_DECLARE)
-				      cache_update_cell (p_vtab->cache->first,
+				      cache_update_cell (p_vtab->cache,
 							 rowid, minx, miny,
 							 maxx, maxy);
 				  else
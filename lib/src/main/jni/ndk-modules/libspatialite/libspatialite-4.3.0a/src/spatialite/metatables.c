@@ -50,6 +50,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <stdio.h>
 #include <string.h>
 #include <float.h>
+#include <math.h>
 
 #if defined(_WIN32) && !defined(__MINGW32__)
 #include "config-msvc.h"
@@ -2830,16 +2831,22 @@ upgradeGeometryTriggers (void *p_sqlite)
     return retcode;
 }
 
-SPATIALITE_PRIVATE void
-updateGeometryTriggers (void *p_sqlite, const char *table, const char *column)
+static int flush_deferred_spatial_index (sqlite3 * sqlite, const char *table,
+					 const char *column);
+
+static int
+update_geometry_triggers (sqlite3 * sqlite, const char *table,
+			  const char *column)
 {
 /* updates triggers for some Spatial Column */
-    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
     int ret;
     int col_index;
     const char *col_dims;
     int index;
     int cached;
+    int deferred;
+    int drop_pending = 0;
+    int ok = 0;
     int dims;
     char *txt_dims = NULL;
     int len;
@@ -2863,7 +2870,7 @@ updateGeometryTriggers (void *p_sqlite, const char *table, const char *column)
       {
 	  spatialite_e
 	      ("updateTableTriggers() error: not existing Table or Column\n");
-	  return;
+	  return 0;
       }
     if (metadata_version == 3)
       {
@@ -2889,7 +2896,9 @@ updateGeometryTriggers (void *p_sqlite, const char *table, const char *column)
       {
 	  spatialite_e ("updateTableTriggers: error %d \"%s\"\n",
 			sqlite3_errcode (sqlite), sqlite3_errmsg (sqlite));
-	  return;
+	  free (p_table);
+	  free (p_column);
+	  return 0;
       }
     sqlite3_reset (stmt);
     sqlite3_clear_bindings (stmt);
@@ -2938,6 +2947,38 @@ updateGeometryTriggers (void *p_sqlite, const char *table, const char *column)
 		if (col_index == 2)
 		    cached = 1;
 
+		deferred = 0;
+		if (metadata_version == 3)
+		  {
+		      /* checking for a deferred R*Tree [pending changes table] */
+		      raw =
+			  sqlite3_mprintf ("idx_%s_%s_deferred", p_table,
+					   p_column);
+		      if (already_existing_table (sqlite, raw))
+			{
+			    if (index)
+			      {
+				  /* applying any pending change, then staying deferred */
+				  if (!flush_deferred_spatial_index
+				      (sqlite, p_table, p_column))
+				    {
+					errMsg =
+					    sqlite3_mprintf
+					    ("SpatialIndex error: unable to flush the deferred changes");
+					sqlite3_free (raw);
+					goto error;
+				    }
+				  deferred = 1;
+			      }
+			    else
+			      {
+				  /* no longer an R*Tree: discarding any pending change */
+				  drop_pending = 1;
+			      }
+			}
+		      sqlite3_free (raw);
+		  }
+
 		/* trying to delete old versions [v2.0, v2.2] triggers[if any] */
 		raw = sqlite3_mprintf ("gti_%s_%s", p_table, p_column);
 		quoted_trigger = gaiaDoubleQuotedSql (raw);
@@ -3344,14 +3385,26 @@ updateGeometryTriggers (void *p_sqlite, const char *table, const char *column)
 			    quoted_rtree = gaiaDoubleQuotedSql (raw);
 			    quoted_table = gaiaDoubleQuotedSql (p_table);
 			    quoted_column = gaiaDoubleQuotedSql (p_column);
-			    sql_statement =
-				sqlite3_mprintf
-				("CREATE TRIGGER \"%s\" AFTER INSERT ON \"%s\"\n"
-				 "FOR EACH ROW BEGIN\n"
-				 "DELETE FROM \"%s\" WHERE pkid=NEW.ROWID;\n"
-				 "SELECT RTreeAlign(%Q, NEW.ROWID, NEW.\"%s\");\nEND",
-				 quoted_trigger, quoted_table, quoted_rtree,
-				 raw, quoted_column);
+			    if (deferred)
+				sql_statement =
+				    sqlite3_mprintf
+				    ("CREATE TRIGGER \"%s\" AFTER INSERT ON \"%s\"\n"
+				     "FOR EACH ROW BEGIN\n"
+				     "INSERT OR REPLACE INTO \"%s_deferred\" (pkid, xmin, xmax, ymin, ymax) "
+				     "VALUES (NEW.ROWID, MbrMinX(NEW.\"%s\"), MbrMaxX(NEW.\"%s\"), "
+				     "MbrMinY(NEW.\"%s\"), MbrMaxY(NEW.\"%s\"));\nEND",
+				     quoted_trigger, quoted_table, quoted_rtree,
+				     quoted_column, quoted_column,
+				     quoted_column, quoted_column);
+			    else
+				sql_statement =
+				    sqlite3_mprintf
+				    ("CREATE TRIGGER \"%s\" AFTER INSERT ON \"%s\"\n"
+				     "FOR EACH ROW BEGIN\n"
+				     "DELETE FROM \"%s\" WHERE pkid=NEW.ROWID;\n"
+				     "SELECT RTreeAlign(%Q, NEW.ROWID, NEW.\"%s\");\nEND",
+				     quoted_trigger, quoted_table,
+				     quoted_rtree, raw, quoted_column);
 			    sqlite3_free (raw);
 			    free (quoted_trigger);
 			    free (quoted_rtree);
@@ -3408,14 +3461,28 @@ updateGeometryTriggers (void *p_sqlite, const char *table, const char *column)
 			    quoted_rtree = gaiaDoubleQuotedSql (raw);
 			    quoted_table = gaiaDoubleQuotedSql (p_table);
 			    quoted_column = gaiaDoubleQuotedSql (p_column);
-			    sql_statement =
-				sqlite3_mprintf
-				("CREATE TRIGGER \"%s\" AFTER UPDATE OF \"%s\" ON \"%s\"\n"
-				 "FOR EACH ROW BEGIN\n"
-				 "DELETE FROM \"%s\" WHERE pkid=NEW.ROWID;\n"
-				 "SELECT RTreeAlign(%Q, NEW.ROWID, NEW.\"%s\");\nEND",
-				 quoted_trigger, quoted_column, quoted_table,
-				 quoted_rtree, raw, quoted_column);
+			    if (deferred)
+				sql_statement =
+				    sqlite3_mprintf
+				    ("CREATE TRIGGER \"%s\" AFTER UPDATE OF \"%s\" ON \"%s\"\n"
+				     "FOR EACH ROW BEGIN\n"
+				     "INSERT OR REPLACE INTO \"%s_deferred\" (pkid, xmin, xmax, ymin, ymax) "
+				     "VALUES (NEW.ROWID, MbrMinX(NEW.\"%s\"), MbrMaxX(NEW.\"%s\"), "
+				     "MbrMinY(NEW.\"%s\"), MbrMaxY(NEW.\"%s\"));\nEND",
+				     quoted_trigger, quoted_column,
+				     quoted_table, quoted_rtree, quoted_column,
+				     quoted_column, quoted_column,
+				     quoted_column);
+			    else
+				sql_statement =
+				    sqlite3_mprintf
+				    ("CREATE TRIGGER \"%s\" AFTER UPDATE OF \"%s\" ON \"%s\"\n"
+				     "FOR EACH ROW BEGIN\n"
+				     "DELETE FROM \"%s\" WHERE pkid=NEW.ROWID;\n"
+				     "SELECT RTreeAlign(%Q, NEW.ROWID, NEW.\"%s\");\nEND",
+				     quoted_trigger, quoted_column,
+				     quoted_table, quoted_rtree, raw,
+				     quoted_column);
 			    sqlite3_free (raw);
 			    free (quoted_trigger);
 			    free (quoted_rtree);
@@ -3473,12 +3540,21 @@ updateGeometryTriggers (void *p_sqlite, const char *table, const char *column)
 			    sqlite3_free (raw);
 			    quoted_table = gaiaDoubleQuotedSql (p_table);
 			    quoted_column = gaiaDoubleQuotedSql (p_column);
-			    sql_statement =
-				sqlite3_mprintf
-				("CREATE TRIGGER \"%s\" AFTER DELETE ON \"%s\"\n"
-				 "FOR EACH ROW BEGIN\n"
-				 "DELETE FROM \"%s\" WHERE pkid=OLD.ROWID;\nEND",
-				 quoted_trigger, quoted_table, quoted_rtree);
+			    if (deferred)
+				sql_statement =
+				    sqlite3_mprintf
+				    ("CREATE TRIGGER \"%s\" AFTER DELETE ON \"%s\"\n"
+				     "FOR EACH ROW BEGIN\n"
+				     "INSERT OR REPLACE INTO \"%s_deferred\" (pkid, xmin, xmax, ymin, ymax) "
+				     "VALUES (OLD.ROWID, NULL, NULL, NULL, NULL);\nEND",
+				     quoted_trigger, quoted_table, quoted_rtree);
+			    else
+				sql_statement =
+				    sqlite3_mprintf
+				    ("CREATE TRIGGER \"%s\" AFTER DELETE ON \"%s\"\n"
+				     "FOR EACH ROW BEGIN\n"
+				     "DELETE FROM \"%s\" WHERE pkid=OLD.ROWID;\nEND",
+				     quoted_trigger, quoted_table, quoted_rtree);
 			    free (quoted_trigger);
 			    free (quoted_rtree);
 			    free (quoted_table);
@@ -3715,10 +3791,31 @@ updateGeometryTriggers (void *p_sqlite, const char *table, const char *column)
 	    }
       }
     ret = sqlite3_finalize (stmt);
+    if (drop_pending)
+      {
+	  /* dropping the pending changes table of a former deferred R*Tree */
+	  raw = sqlite3_mprintf ("idx_%s_%s_deferred", p_table, p_column);
+	  quoted_rtree = gaiaDoubleQuotedSql (raw);
+	  sqlite3_free (raw);
+	  sql_statement = sqlite3_mprintf ("DROP TABLE \"%s\"", quoted_rtree);
+	  free (quoted_rtree);
+	  ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, &errMsg);
+	  sqlite3_free (sql_statement);
+	  if (ret != SQLITE_OK)
+	      goto error;
+      }
 /* now we'll adjust any related SpatialIndex as required */
     curr_idx = first_idx;
     while (curr_idx)
       {
+	  raw = sqlite3_mprintf ("idx_%s_%s", curr_idx->TableName,
+				 curr_idx->ColumnName);
+	  if (curr_idx->ValidRtree && already_existing_table (sqlite, raw))
+	    {
+		/* the R*Tree is already there: only the triggers changed */
+		curr_idx->ValidRtree = 0;
+	    }
+	  sqlite3_free (raw);
 	  if (curr_idx->ValidRtree)
 	    {
 		/* building RTree SpatialIndex */
@@ -3777,6 +3874,7 @@ updateGeometryTriggers (void *p_sqlite, const char *table, const char *column)
 	    }
 	  curr_idx = curr_idx->Next;
       }
+    ok = 1;
     goto index_cleanup;
   error:
     spatialite_e ("updateTableTriggers: \"%s\"\n", errMsg);
@@ -3797,6 +3895,14 @@ updateGeometryTriggers (void *p_sqlite, const char *table, const char *column)
 	free (p_table);
     if (p_column)
 	free (p_column);
+    return ok;
+}
+
+SPATIALITE_PRIVATE void
+updateGeometryTriggers (void *p_sqlite, const char *table, const char *column)
+{
+/* updates triggers for some Spatial Column */
+    update_geometry_triggers ((sqlite3 *) p_sqlite, table, column);
 }
 
 SPATIALITE_PRIVATE void
@@ -3844,6 +3950,429 @@ validateRowid (void *p_sqlite, const char *table)
     return 0;
 }
 
+struct rtree_bulk_cell
+{
+/* a struct wrapping an R*Tree cell to be bulk loaded */
+    sqlite3_int64 id;		/* ROWID (leaves) or child node number */
+    float minx;
+    float maxx;
+    float miny;
+    float maxy;
+};
+
+struct rtree_bulk_loader
+{
+/* a struct supporting an R*Tree bulk load */
+    sqlite3 *sqlite;
+    int node_size;		/* R*Tree node size (bytes) */
+    int max_cells;		/* max number of cells fitting into a node */
+    sqlite3_int64 next_node;	/* next free node number */
+    unsigned char *blob;	/* node buffer */
+    sqlite3_stmt *stmt_root;	/* UPDATE the root node */
+    sqlite3_stmt *stmt_node;	/* INSERT INTO xx_node */
+    sqlite3_stmt *stmt_parent;	/* INSERT INTO xx_parent */
+    sqlite3_stmt *stmt_rowid;	/* INSERT INTO xx_rowid */
+};
+
+static int
+rtree_bulk_cmp_x (const void *p1, const void *p2)
+{
+/* sorting cells by X center */
+    const struct rtree_bulk_cell *c1 = (const struct rtree_bulk_cell *) p1;
+    const struct rtree_bulk_cell *c2 = (const struct rtree_bulk_cell *) p2;
+    double x1 = (double) c1->minx + (double) c1->maxx;
+    double x2 = (double) c2->minx + (double) c2->maxx;
+    if (x1 < x2)
+	return -1;
+    if (x1 > x2)
+	return 1;
+    return 0;
+}
+
+static int
+rtree_bulk_cmp_y (const void *p1, const void *p2)
+{
+/* sorting cells by Y center */
+    const struct rtree_bulk_cell *c1 = (const struct rtree_bulk_cell *) p1;
+    const struct rtree_bulk_cell *c2 = (const struct rtree_bulk_cell *) p2;
+    double y1 = (double) c1->miny + (double) c1->maxy;
+    double y2 = (double) c2->miny + (double) c2->maxy;
+    if (y1 < y2)
+	return -1;
+    if (y1 > y2)
+	return 1;
+    return 0;
+}
+
+static void
+rtree_bulk_export_float (unsigned char *p, float value)
+{
+/* exporting a FLOAT [big endian] */
+    unsigned int v;
+    memcpy (&v, &value, sizeof (float));
+    p[0] = (unsigned char) ((v >> 24) & 0xff);
+    p[1] = (unsigned char) ((v >> 16) & 0xff);
+    p[2] = (unsigned char) ((v >> 8) & 0xff);
+    p[3] = (unsigned char) (v & 0xff);
+}
+
+static void
+rtree_bulk_export_int64 (unsigned char *p, sqlite3_int64 value)
+{
+/* exporting a 64 bit INT [big endian] */
+    int i;
+    sqlite3_uint64 v = (sqlite3_uint64) value;
+    for (i = 7; i >= 0; i--)
+      {
+	  p[i] = (unsigned char) (v & 0xff);
+	  v >>= 8;
+      }
+}
+
+static int
+rtree_bulk_write_node (struct rtree_bulk_loader *loader,
+		       sqlite3_int64 node_no, int depth,
+		       const struct rtree_bulk_cell *cells, int count,
+		       int is_leaf)
+{
+/* writing a packed R*Tree node into the shadow tables */
+    int i;
+    int ret;
+    unsigned char *p;
+    sqlite3_stmt *stmt;
+    memset (loader->blob, 0, loader->node_size);
+    if (node_no == 1)
+      {
+	  /* only the root node stores the tree depth */
+	  loader->blob[0] = (unsigned char) ((depth >> 8) & 0xff);
+	  loader->blob[1] = (unsigned char) (depth & 0xff);
+      }
+    loader->blob[2] = (unsigned char) ((count >> 8) & 0xff);
+    loader->blob[3] = (unsigned char) (count & 0xff);
+    p = loader->blob + 4;
+    for (i = 0; i < count; i++)
+      {
+	  const struct rtree_bulk_cell *cell = cells + i;
+	  rtree_bulk_export_int64 (p, cell->id);
+	  rtree_bulk_export_float (p + 8, cell->minx);
+	  rtree_bulk_export_float (p + 12, cell->maxx);
+	  rtree_bulk_export_float (p + 16, cell->miny);
+	  rtree_bulk_export_float (p + 20, cell->maxy);
+	  p += 24;
+      }
+
+    if (node_no == 1)
+      {
+	  stmt = loader->stmt_root;
+	  sqlite3_reset (stmt);
+	  sqlite3_clear_bindings (stmt);
+	  sqlite3_bind_blob (stmt, 1, loader->blob, loader->node_size,
+			     SQLITE_STATIC);
+      }
+    else
+      {
+	  stmt = loader->stmt_node;
+	  sqlite3_reset (stmt);
+	  sqlite3_clear_bindings (stmt);
+	  sqlite3_bind_int64 (stmt, 1, node_no);
+	  sqlite3_bind_blob (stmt, 2, loader->blob, loader->node_size,
+			     SQLITE_STATIC);
+      }
+    ret = sqlite3_step (stmt);
+    if (ret != SQLITE_DONE && ret != SQLITE_ROW)
+	return 0;
+
+/* registering the children of this node */
+    stmt = is_leaf ? loader->stmt_rowid : loader->stmt_parent;
+    for (i = 0; i < count; i++)
+      {
+	  sqlite3_reset (stmt);
+	  sqlite3_clear_bindings (stmt);
+	  sqlite3_bind_int64 (stmt, 1, cells[i].id);
+	  sqlite3_bind_int64 (stmt, 2, node_no);
+	  ret = sqlite3_step (stmt);
+	  if (ret != SQLITE_DONE && ret != SQLITE_ROW)
+	      return 0;
+      }
+    return 1;
+}
+
+static int
+rtree_bulk_pack_level (struct rtree_bulk_loader *loader,
+		       struct rtree_bulk_cell *cells, int count, int is_leaf,
+		       struct rtree_bulk_cell *parents)
+{
+/*
+/ Sort-Tile-Recursive packing of a whole R*Tree level
+/
+/ the cells are tiled into vertical slices (sorted by X) each one
+/ then sorted by Y and packed into fully filled nodes; one parent
+/ cell (node number and MBR) is returned for each node written
+*/
+    int max = loader->max_cells;
+    int n_nodes = (count + max - 1) / max;
+    int n_slices = (int) ceil (sqrt ((double) n_nodes));
+    int slice_size = n_slices * max;
+    int base;
+    int i;
+    int n_parents = 0;
+
+    qsort (cells, count, sizeof (struct rtree_bulk_cell), rtree_bulk_cmp_x);
+    for (base = 0; base < count; base += slice_size)
+      {
+	  int slice_count = count - base;
+	  if (slice_count > slice_size)
+	      slice_count = slice_size;
+	  qsort (cells + base, slice_count, sizeof (struct rtree_bulk_cell),
+		 rtree_bulk_cmp_y);
+      }
+    for (base = 0; base < count; base += max)
+      {
+	  struct rtree_bulk_cell *parent = parents + n_parents;
+	  int node_count = count - base;
+	  if (node_count > max)
+	      node_count = max;
+	  parent->id = loader->next_node;
+	  loader->next_node += 1;
+	  parent->minx = cells[base].minx;
+	  parent->maxx = cells[base].maxx;
+	  parent->miny = cells[base].miny;
+	  parent->maxy = cells[base].maxy;
+	  for (i = base + 1; i < base + node_count; i++)
+	    {
+		if (cells[i].minx < parent->minx)
+		    parent->minx = cells[i].minx;
+		if (cells[i].maxx > parent->maxx)
+		    parent->maxx = cells[i].maxx;
+		if (cells[i].miny < parent->miny)
+		    parent->miny = cells[i].miny;
+		if (cells[i].maxy > parent->maxy)
+		    parent->maxy = cells[i].maxy;
+	    }
+	  if (!rtree_bulk_write_node
+	      (loader, parent->id, 0, cells + base, node_count, is_leaf))
+	      return -1;
+	  n_parents++;
+      }
+    return n_parents;
+}
+
+static int
+rtree_bulk_prepare (sqlite3 * sqlite, const char *rtree, const char *fmt,
+		    sqlite3_stmt ** stmt)
+{
+/* preparing an SQL statement targeting some R*Tree shadow table */
+    int ret;
+    char *xrtree = gaiaDoubleQuotedSql (rtree);
+    char *sql = sqlite3_mprintf (fmt, xrtree);
+    free (xrtree);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+      {
+	  *stmt = NULL;
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+rtree_bulk_load (sqlite3 * sqlite, const char *rtree, const char *table,
+		 const char *column)
+{
+/*
+/ attempting to bulk load an empty R*Tree
+/
+/ all MBRs are sorted accordingly to the Sort-Tile-Recursive
+/ algorithm and fully packed nodes are directly written into
+/ the xx_node, xx_parent and xx_rowid shadow tables
+/
+/ returns 1 on success; 0 if the caller is expected to fall back
+/ to the ordinary row-by-row INSERT
+*/
+    struct rtree_bulk_loader loader;
+    struct rtree_bulk_cell *cells = NULL;
+    struct rtree_bulk_cell *parents = NULL;
+    int count = 0;
+    int allocated = 0;
+    int depth;
+    int n;
+    int ret;
+    int ok = 0;
+    int savepoint = 0;
+    char *sql;
+    char *xrtree;
+    char *xtable;
+    char *xcolumn;
+    sqlite3_stmt *stmt = NULL;
+
+    memset (&loader, 0, sizeof (struct rtree_bulk_loader));
+    loader.sqlite = sqlite;
+
+/* checking the R*Tree: it must be empty, and the root node size is required */
+    xrtree = gaiaDoubleQuotedSql (rtree);
+    sql = sqlite3_mprintf ("SELECT (SELECT length(data) FROM \"%s_node\" "
+			   "WHERE nodeno = 1), (SELECT Count(*) FROM \"%s_node\"), "
+			   "EXISTS (SELECT 1 FROM \"%s_rowid\")", xrtree,
+			   xrtree, xrtree);
+    free (xrtree);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    ret = sqlite3_step (stmt);
+    if (ret == SQLITE_ROW)
+      {
+	  if (sqlite3_column_type (stmt, 0) == SQLITE_INTEGER
+	      && sqlite3_column_int (stmt, 1) == 1
+	      && sqlite3_column_int (stmt, 2) == 0)
+	      loader.node_size = sqlite3_column_int (stmt, 0);
+      }
+    sqlite3_finalize (stmt);
+    stmt = NULL;
+    loader.max_cells = (loader.node_size - 4) / 24;
+    if (loader.max_cells < 4)
+	return 0;
+
+/* loading all MBRs */
+    xtable = gaiaDoubleQuotedSql (table);
+    xcolumn = gaiaDoubleQuotedSql (column);
+    sql = sqlite3_mprintf ("SELECT ROWID, MbrMinX(\"%s\"), MbrMaxX(\"%s\"), "
+			   "MbrMinY(\"%s\"), MbrMaxY(\"%s\") FROM \"%s\" "
+			   "WHERE MbrMinX(\"%s\") IS NOT NULL", xcolumn,
+			   xcolumn, xcolumn, xcolumn, xtable, xcolumn);
+    free (xtable);
+    free (xcolumn);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    while (1)
+      {
+	  ret = sqlite3_step (stmt);
+	  if (ret == SQLITE_DONE)
+	      break;
+	  if (ret != SQLITE_ROW)
+	      goto stop;
+	  if (count >= allocated)
+	    {
+		struct rtree_bulk_cell *grown;
+		int new_alloc = (allocated == 0) ? 1024 : allocated * 2;
+		if (new_alloc < allocated)
+		    goto stop;
+		grown =
+		    realloc (cells,
+			     sizeof (struct rtree_bulk_cell) * new_alloc);
+		if (grown == NULL)
+		    goto stop;
+		cells = grown;
+		allocated = new_alloc;
+	    }
+	  cells[count].id = sqlite3_column_int64 (stmt, 0);
+	  cells[count].minx =
+	      gaiaFloatRoundDown (sqlite3_column_double (stmt, 1));
+	  cells[count].maxx =
+	      gaiaFloatRoundUp (sqlite3_column_double (stmt, 2));
+	  cells[count].miny =
+	      gaiaFloatRoundDown (sqlite3_column_double (stmt, 3));
+	  cells[count].maxy =
+	      gaiaFloatRoundUp (sqlite3_column_double (stmt, 4));
+	  if (cells[count].minx > cells[count].maxx
+	      || cells[count].miny > cells[count].maxy)
+	      goto stop;	/* the R*Tree module would reject this one */
+	  count++;
+      }
+    sqlite3_finalize (stmt);
+    stmt = NULL;
+    if (count == 0)
+      {
+	  /* nothing to be done: the R*Tree is already empty */
+	  ok = 1;
+	  goto stop;
+      }
+
+/* preparing the shadow tables statements */
+    loader.blob = malloc (loader.node_size);
+    if (loader.blob == NULL)
+	goto stop;
+    if (!rtree_bulk_prepare
+	(sqlite, rtree, "UPDATE \"%s_node\" SET data = ? WHERE nodeno = 1",
+	 &(loader.stmt_root)))
+	goto stop;
+    if (!rtree_bulk_prepare
+	(sqlite, rtree, "INSERT INTO \"%s_node\" (nodeno, data) VALUES (?, ?)",
+	 &(loader.stmt_node)))
+	goto stop;
+    if (!rtree_bulk_prepare
+	(sqlite, rtree,
+	 "INSERT INTO \"%s_parent\" (nodeno, parentnode) VALUES (?, ?)",
+	 &(loader.stmt_parent)))
+	goto stop;
+    if (!rtree_bulk_prepare
+	(sqlite, rtree,
+	 "INSERT INTO \"%s_rowid\" (rowid, nodeno) VALUES (?, ?)",
+	 &(loader.stmt_rowid)))
+	goto stop;
+    parents =
+	malloc (sizeof (struct rtree_bulk_cell) *
+		((count + loader.max_cells - 1) / loader.max_cells));
+    if (parents == NULL)
+	goto stop;
+
+/* packing the R*Tree bottom-up; the root always is node #1 */
+    ret = sqlite3_exec (sqlite, "SAVEPOINT spatialite_rtree_bulk", NULL, NULL,
+			NULL);
+    if (ret != SQLITE_OK)
+	goto stop;
+    savepoint = 1;
+    loader.next_node = 2;
+    depth = 0;
+    while (count > loader.max_cells)
+      {
+	  struct rtree_bulk_cell *swap;
+	  n = rtree_bulk_pack_level (&loader, cells, count,
+				     (depth == 0) ? 1 : 0, parents);
+	  if (n < 0)
+	      goto stop;
+	  swap = cells;
+	  cells = parents;
+	  parents = swap;
+	  count = n;
+	  depth++;
+      }
+    if (!rtree_bulk_write_node
+	(&loader, 1, depth, cells, count, (depth == 0) ? 1 : 0))
+	goto stop;
+    ok = 1;
+
+  stop:
+    if (stmt != NULL)
+	sqlite3_finalize (stmt);
+    if (loader.stmt_root != NULL)
+	sqlite3_finalize (loader.stmt_root);
+    if (loader.stmt_node != NULL)
+	sqlite3_finalize (loader.stmt_node);
+    if (loader.stmt_parent != NULL)
+	sqlite3_finalize (loader.stmt_parent);
+    if (loader.stmt_rowid != NULL)
+	sqlite3_finalize (loader.stmt_rowid);
+    if (savepoint)
+      {
+	  if (!ok)
+	      sqlite3_exec (sqlite, "ROLLBACK TO spatialite_rtree_bulk", NULL,
+			    NULL, NULL);
+	  sqlite3_exec (sqlite, "RELEASE spatialite_rtree_bulk", NULL, NULL,
+			NULL);
+      }
+    if (loader.blob != NULL)
+	free (loader.blob);
+    if (cells != NULL)
+	free (cells);
+    if (parents != NULL)
+	free (parents);
+    return ok;
+}
+
 SPATIALITE_PRIVATE int
 buildSpatialIndexEx (void *p_sqlite, const unsigned char *table,
 		     const char *column)
@@ -3867,6 +4396,12 @@ buildSpatialIndexEx (void *p_sqlite, const unsigned char *table,
       }
 
     raw = sqlite3_mprintf ("idx_%s_%s", table, column);
+    if (rtree_bulk_load (sqlite, raw, (const char *) table, column))
+      {
+	  /* successfully bulk loaded */
+	  sqlite3_free (raw);
+	  return 0;
+      }
     quoted_rtree = gaiaDoubleQuotedSql (raw);
     sqlite3_free (raw);
     quoted_table = gaiaDoubleQuotedSql ((const char *) table);
@@ -3892,6 +4427,1857 @@ buildSpatialIndexEx (void *p_sqlite, const unsigned char *table,
     return 0;
 }
 
+/* deferred R*Tree changes exceeding 1/10 of the indexed entries trigger a full rebuild */
+#define DEFERRED_SPATIAL_INDEX_REBUILD	10
+
+struct rtree_deferred_item
+{
+/* a struct wrapping a pending R*Tree change */
+    sqlite3_int64 pkid;
+    int has_mbr;		/* FALSE for deleted or NULL geometries */
+    double minx;
+    double maxx;
+    double miny;
+    double maxy;
+    unsigned int hilbert;	/* Hilbert key of the MBR center */
+};
+
+static int
+rtree_deferred_cmp (const void *p1, const void *p2)
+{
+/* sorting pending changes by Hilbert key */
+    const struct rtree_deferred_item *i1 =
+	(const struct rtree_deferred_item *) p1;
+    const struct rtree_deferred_item *i2 =
+	(const struct rtree_deferred_item *) p2;
+    if (i1->hilbert < i2->hilbert)
+	return -1;
+    if (i1->hilbert > i2->hilbert)
+	return 1;
+    if (i1->pkid < i2->pkid)
+	return -1;
+    if (i1->pkid > i2->pkid)
+	return 1;
+    return 0;
+}
+
+static int
+rtree_bulk_truncate (sqlite3 * sqlite, const char *rtree)
+{
+/* quickly resetting an R*Tree to its initial empty state */
+    int ret;
+    char *sql;
+    char *xrtree = gaiaDoubleQuotedSql (rtree);
+    sql = sqlite3_mprintf ("DELETE FROM \"%s_node\" WHERE nodeno <> 1; "
+			   "UPDATE \"%s_node\" SET data = zeroblob(length(data)) "
+			   "WHERE nodeno = 1; DELETE FROM \"%s_parent\"; "
+			   "DELETE FROM \"%s_rowid\"", xrtree, xrtree, xrtree,
+			   xrtree);
+    free (xrtree);
+    ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    return 1;
+}
+
+static int
+rtree_deferred_batch (sqlite3 * sqlite, const char *rtree,
+		      const char *pending)
+{
+/* applying all pending changes to the R*Tree as a single sorted batch */
+    struct rtree_deferred_item *items = NULL;
+    int count = 0;
+    int allocated = 0;
+    int i;
+    int ret;
+    int ok = 0;
+    double ext_minx = DBL_MAX;
+    double ext_miny = DBL_MAX;
+    double ext_maxx = -DBL_MAX;
+    double ext_maxy = -DBL_MAX;
+    double scale_x;
+    double scale_y;
+    char *sql;
+    char *xrtree;
+    char *xpending;
+    sqlite3_stmt *stmt = NULL;
+    sqlite3_stmt *stmt_del = NULL;
+    sqlite3_stmt *stmt_ins = NULL;
+
+/* loading the pending changes */
+    xpending = gaiaDoubleQuotedSql (pending);
+    sql = sqlite3_mprintf ("SELECT pkid, xmin, xmax, ymin, ymax FROM \"%s\"",
+			   xpending);
+    free (xpending);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    while (1)
+      {
+	  struct rtree_deferred_item *item;
+	  ret = sqlite3_step (stmt);
+	  if (ret == SQLITE_DONE)
+	      break;
+	  if (ret != SQLITE_ROW)
+	      goto stop;
+	  if (count >= allocated)
+	    {
+		struct rtree_deferred_item *grown;
+		int new_alloc = (allocated == 0) ? 1024 : allocated * 2;
+		if (new_alloc < allocated)
+		    goto stop;
+		grown =
+		    realloc (items,
+			     sizeof (struct rtree_deferred_item) * new_alloc);
+		if (grown == NULL)
+		    goto stop;
+		items = grown;
+		allocated = new_alloc;
+	    }
+	  item = items + count;
+	  item->pkid = sqlite3_column_int64 (stmt, 0);
+	  item->has_mbr = 1;
+	  for (i = 1; i <= 4; i++)
+	    {
+		if (sqlite3_column_type (stmt, i) == SQLITE_NULL)
+		    item->has_mbr = 0;
+	    }
+	  item->minx = sqlite3_column_double (stmt, 1);
+	  item->maxx = sqlite3_column_double (stmt, 2);
+	  item->miny = sqlite3_column_double (stmt, 3);
+	  item->maxy = sqlite3_column_double (stmt, 4);
+	  item->hilbert = 0;
+	  if (item->has_mbr)
+	    {
+		double cx = (item->minx + item->maxx) / 2.0;
+		double cy = (item->miny + item->maxy) / 2.0;
+		if (cx < ext_minx)
+		    ext_minx = cx;
+		if (cx > ext_maxx)
+		    ext_maxx = cx;
+		if (cy < ext_miny)
+		    ext_miny = cy;
+		if (cy > ext_maxy)
+		    ext_maxy = cy;
+	    }
+	  count++;
+      }
+    sqlite3_finalize (stmt);
+    stmt = NULL;
+
+/* sorting by Hilbert key, so to preserve spatial locality on insertion */
+    scale_x = (ext_maxx > ext_minx) ? 65535.0 / (ext_maxx - ext_minx) : 0.0;
+    scale_y = (ext_maxy > ext_miny) ? 65535.0 / (ext_maxy - ext_miny) : 0.0;
+    for (i = 0; i < count; i++)
+      {
+	  struct rtree_deferred_item *item = items + i;
+	  if (item->has_mbr)
+	      item->hilbert =
+		  gaiaHilbertKey ((item->minx + item->maxx) / 2.0,
+				  (item->miny + item->maxy) / 2.0, ext_minx,
+				  ext_miny, scale_x, scale_y);
+      }
+    if (count > 1)
+	qsort (items, count, sizeof (struct rtree_deferred_item),
+	       rtree_deferred_cmp);
+
+/* removing the stale entries, then inserting the current ones */
+    xrtree = gaiaDoubleQuotedSql (rtree);
+    sql = sqlite3_mprintf ("DELETE FROM \"%s\" WHERE pkid = ?", xrtree);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt_del, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+      {
+	  free (xrtree);
+	  goto stop;
+      }
+    sql = sqlite3_mprintf ("INSERT INTO \"%s\" (pkid, xmin, xmax, ymin, ymax) "
+			   "VALUES (?, ?, ?, ?, ?)", xrtree);
+    free (xrtree);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt_ins, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto stop;
+    for (i = 0; i < count; i++)
+      {
+	  sqlite3_reset (stmt_del);
+	  sqlite3_clear_bindings (stmt_del);
+	  sqlite3_bind_int64 (stmt_del, 1, items[i].pkid);
+	  ret = sqlite3_step (stmt_del);
+	  if (ret != SQLITE_DONE && ret != SQLITE_ROW)
+	      goto stop;
+      }
+    for (i = 0; i < count; i++)
+      {
+	  struct rtree_deferred_item *item = items + i;
+	  if (!item->has_mbr)
+	      continue;
+	  sqlite3_reset (stmt_ins);
+	  sqlite3_clear_bindings (stmt_ins);
+	  sqlite3_bind_int64 (stmt_ins, 1, item->pkid);
+	  sqlite3_bind_double (stmt_ins, 2, item->minx);
+	  sqlite3_bind_double (stmt_ins, 3, item->maxx);
+	  sqlite3_bind_double (stmt_ins, 4, item->miny);
+	  sqlite3_bind_double (stmt_ins, 5, item->maxy);
+	  ret = sqlite3_step (stmt_ins);
+	  if (ret != SQLITE_DONE && ret != SQLITE_ROW)
+	      goto stop;
+      }
+    ok = 1;
+
+  stop:
+    if (stmt != NULL)
+	sqlite3_finalize (stmt);
+    if (stmt_del != NULL)
+	sqlite3_finalize (stmt_del);
+    if (stmt_ins != NULL)
+	sqlite3_finalize (stmt_ins);
+    if (items != NULL)
+	free (items);
+    return ok;
+}
+
+static int
+deferred_check_column (sqlite3 * sqlite, const char *table,
+		       const char *column, char **real_table,
+		       char **real_column)
+{
+/* checks if the Geometry Column supports an R*Tree SpatialIndex */
+    int ret;
+    int enabled = 0;
+    char *sql;
+    sqlite3_stmt *stmt;
+    if (checkSpatialMetaData (sqlite) != 3)
+      {
+	  /* only the current metadata style >= v.4.0.0 is supported */
+	  return 0;
+      }
+    sql = sqlite3_mprintf ("SELECT Count(*) FROM geometry_columns "
+			   "WHERE Upper(f_table_name) = Upper(%Q) "
+			   "AND Upper(f_geometry_column) = Upper(%Q) "
+			   "AND spatial_index_enabled = 1", table, column);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    if (sqlite3_step (stmt) == SQLITE_ROW)
+	enabled = sqlite3_column_int (stmt, 0);
+    sqlite3_finalize (stmt);
+    if (enabled != 1)
+	return 0;
+    if (!getRealSQLnames (sqlite, table, column, real_table, real_column))
+	return 0;
+    return 1;
+}
+
+static int
+flush_deferred_spatial_index (sqlite3 * sqlite, const char *table,
+			      const char *column)
+{
+/* applying all pending changes [real table and column names] */
+    int ret;
+    int ok = 0;
+    sqlite3_int64 n_pending = 0;
+    sqlite3_int64 n_indexed = 0;
+    char *sql;
+    char *xname;
+    char *rtree = sqlite3_mprintf ("idx_%s_%s", table, column);
+    char *pending = sqlite3_mprintf ("idx_%s_%s_deferred", table, column);
+    sqlite3_stmt *stmt;
+
+    if (!already_existing_table (sqlite, pending))
+      {
+	  /* nothing to be done */
+	  ok = 1;
+	  goto stop;
+      }
+    if (!already_existing_table (sqlite, rtree))
+      {
+	  /* no R*Tree at all: it will be built from scratch anyway */
+	  xname = gaiaDoubleQuotedSql (pending);
+	  sql = sqlite3_mprintf ("DELETE FROM \"%s\"", xname);
+	  free (xname);
+	  ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+	  sqlite3_free (sql);
+	  if (ret == SQLITE_OK)
+	      ok = 1;
+	  goto stop;
+      }
+
+/* counting both pending changes and indexed entries */
+    xname = gaiaDoubleQuotedSql (pending);
+    sql = sqlite3_mprintf ("SELECT (SELECT Count(*) FROM \"%s\"), ", xname);
+    free (xname);
+    xname = gaiaDoubleQuotedSql (rtree);
+    sql = sqlite3_mprintf ("%z(SELECT Count(*) FROM \"%s_rowid\")", sql,
+			   xname);
+    free (xname);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto stop;
+    if (sqlite3_step (stmt) == SQLITE_ROW)
+      {
+	  n_pending = sqlite3_column_int64 (stmt, 0);
+	  n_indexed = sqlite3_column_int64 (stmt, 1);
+      }
+    sqlite3_finalize (stmt);
+    if (n_pending == 0)
+      {
+	  ok = 1;
+	  goto stop;
+      }
+
+    ret = sqlite3_exec (sqlite, "SAVEPOINT spatialite_rtree_deferred", NULL,
+			NULL, NULL);
+    if (ret != SQLITE_OK)
+	goto stop;
+    if (n_pending * DEFERRED_SPATIAL_INDEX_REBUILD >= n_indexed)
+      {
+	  /* too many changes: rebuilding the whole R*Tree via bulk load */
+	  if (rtree_bulk_truncate (sqlite, rtree))
+	    {
+		if (buildSpatialIndexEx
+		    (sqlite, (const unsigned char *) table, column) == 0)
+		    ok = 1;
+	    }
+      }
+    else
+	ok = rtree_deferred_batch (sqlite, rtree, pending);
+    if (ok)
+      {
+	  xname = gaiaDoubleQuotedSql (pending);
+	  sql = sqlite3_mprintf ("DELETE FROM \"%s\"", xname);
+	  free (xname);
+	  ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+	  sqlite3_free (sql);
+	  if (ret != SQLITE_OK)
+	      ok = 0;
+      }
+    if (!ok)
+	sqlite3_exec (sqlite, "ROLLBACK TO spatialite_rtree_deferred", NULL,
+		      NULL, NULL);
+    sqlite3_exec (sqlite, "RELEASE spatialite_rtree_deferred", NULL, NULL,
+		  NULL);
+
+  stop:
+    sqlite3_free (rtree);
+    sqlite3_free (pending);
+    return ok;
+}
+
+SPATIALITE_PRIVATE int
+flushDeferredSpatialIndex (void *p_sqlite, const char *table,
+			   const char *column)
+{
+/* applying all pending changes to a deferred R*Tree SpatialIndex */
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    char *p_table = NULL;
+    char *p_column = NULL;
+    int ok;
+    if (!deferred_check_column (sqlite, table, column, &p_table, &p_column))
+	return 0;
+    ok = flush_deferred_spatial_index (sqlite, p_table, p_column);
+    free (p_table);
+    free (p_column);
+    return ok;
+}
+
+SPATIALITE_PRIVATE int
+setDeferredSpatialIndex (void *p_sqlite, const char *table,
+			 const char *column, int mode)
+{
+/*
+/ enables (mode = TRUE) or disables (mode = FALSE) the deferred
+/ maintenance of some R*Tree SpatialIndex
+/
+/ while deferred, changes are simply collected into the
+/ idx_<table>_<column>_deferred table, and the R*Tree will be
+/ updated only by flushDeferredSpatialIndex(); disabling
+/ flushes any pending change and restores the ordinary triggers
+/
+/ the pending table itself selects the trigger flavour: see
+/ updateGeometryTriggers(), which also flushes (or discards, once
+/ the R*Tree is gone) any pending change whenever it is invoked
+*/
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    char *p_table = NULL;
+    char *p_column = NULL;
+    char *pending;
+    char *xpending;
+    char *sql;
+    int ret;
+    int ok = 0;
+    if (!deferred_check_column (sqlite, table, column, &p_table, &p_column))
+	return 0;
+    pending = sqlite3_mprintf ("idx_%s_%s_deferred", p_table, p_column);
+    xpending = gaiaDoubleQuotedSql (pending);
+    sqlite3_free (pending);
+
+    ret = sqlite3_exec (sqlite, "SAVEPOINT spatialite_deferred_mode", NULL,
+			NULL, NULL);
+    if (ret != SQLITE_OK)
+	goto stop;
+    if (mode)
+      {
+	  /* creating the pending table and the deferred triggers */
+	  sql = sqlite3_mprintf ("CREATE TABLE IF NOT EXISTS \"%s\" ("
+				 "pkid INTEGER PRIMARY KEY, xmin DOUBLE, xmax DOUBLE, "
+				 "ymin DOUBLE, ymax DOUBLE)", xpending);
+	  ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+	  sqlite3_free (sql);
+	  if (ret == SQLITE_OK)
+	      ok = update_geometry_triggers (sqlite, p_table, p_column);
+      }
+    else
+      {
+	  /* flushing, then restoring the ordinary triggers */
+	  if (flush_deferred_spatial_index (sqlite, p_table, p_column))
+	    {
+		sql = sqlite3_mprintf ("DROP TABLE IF EXISTS \"%s\"",
+				       xpending);
+		ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+		sqlite3_free (sql);
+		if (ret == SQLITE_OK)
+		    ok = update_geometry_triggers (sqlite, p_table,
+						   p_column);
+	    }
+      }
+    if (!ok)
+	sqlite3_exec (sqlite, "ROLLBACK TO spatialite_deferred_mode", NULL,
+		      NULL, NULL);
+    sqlite3_exec (sqlite, "RELEASE spatialite_deferred_mode", NULL, NULL,
+		  NULL);
+
+  stop:
+    free (xpending);
+    free (p_table);
+    free (p_column);
+    return ok;
+}
+
+static int
+qmbr_cell_down (double value, const double *grid, int axis)
+{
+/* INT16 cell number always rounding towards -Infinity [clamped] */
+    double q = floor ((value - grid[axis]) / grid[axis + 2]);
+    if (!(q > 0.0))
+	return 0;
+    if (q > GAIA_QMBR_INT16_CELLS - 1)
+	return GAIA_QMBR_INT16_CELLS - 1;
+    return (int) q;
+}
+
+static int
+qmbr_cell_up (double value, const double *grid, int axis)
+{
+/* INT16 cell number always rounding towards +Infinity [clamped] */
+    double q = ceil ((value - grid[axis]) / grid[axis + 2]);
+    if (q != q || q > GAIA_QMBR_INT16_CELLS - 1)
+	return GAIA_QMBR_INT16_CELLS - 1;
+    if (q < 0.0)
+	return 0;
+    return (int) q;
+}
+
+static void
+qmbr_read_grid (const unsigned char *block, double *grid)
+{
+/* reading OriginX, OriginY, CellX and CellY from an INT16 block */
+    int endian_arch = gaiaEndianArch ();
+    grid[0] = gaiaImport64 (block + 0, 1, endian_arch);
+    grid[1] = gaiaImport64 (block + 8, 1, endian_arch);
+    grid[2] = gaiaImport64 (block + 16, 1, endian_arch);
+    grid[3] = gaiaImport64 (block + 24, 1, endian_arch);
+}
+
+SPATIALITE_PRIVATE int
+initQuantizedMbrBlock (unsigned char *block, const unsigned char *grid)
+{
+/* 
+/ initializing a block of the Quantized MBR index, returning its size:
+/ - GRID = NULL: FLOAT items, empty ones being marked by NaN 
+/   [never matching any filter]
+/ - otherwise INT16 items on the given grid, empty ones being marked 
+/   by GAIA_QMBR_INT16_CELLS
+*/
+    int i;
+    if (grid != NULL)
+      {
+	  memcpy (block, grid, GAIA_QMBR_GRID_SIZE);
+	  memset (block + GAIA_QMBR_GRID_SIZE, 0xff,
+		  GAIA_QMBR_BLOCK_ITEMS * GAIA_QMBR_INT16_ITEM_SIZE);
+	  return GAIA_QMBR_INT16_BLOCK;
+      }
+    for (i = 0; i < GAIA_QMBR_BLOCK_ITEMS * 4; i++)
+      {
+	  unsigned char *p = block + (i * 4);
+	  *(p + 0) = 0x00;
+	  *(p + 1) = 0x00;
+	  *(p + 2) = 0xc0;
+	  *(p + 3) = 0x7f;
+      }
+    return GAIA_QMBR_FLOAT_BLOCK;
+}
+
+SPATIALITE_PRIVATE void
+setQuantizedMbr (unsigned char *block, int block_size, int item,
+		 const unsigned char *blob, int size)
+{
+/* 
+/ storing the MBR of some BLOB-Geometry into the Nth item of a 
+/ block of the Quantized MBR index; the MBR is read from the BLOB header and
+/ then rounded outwards (into four little-endian FLOATs, or into four
+/ INT16 grid cells), so that any filter will always return a superset 
+/ of the exact result
+/ a NULL or invalid Geometry simply clears the corresponding item
+*/
+    double minx;
+    double miny;
+    double maxx;
+    double maxy;
+    double grid[4];
+    int endian_arch = gaiaEndianArch ();
+    int valid = 1;
+    unsigned char *p;
+    if (blob == NULL || !gaiaGetMbrMinX (blob, size, &minx)
+	|| !gaiaGetMbrMinY (blob, size, &miny)
+	|| !gaiaGetMbrMaxX (blob, size, &maxx)
+	|| !gaiaGetMbrMaxY (blob, size, &maxy))
+	valid = 0;
+    if (block_size == GAIA_QMBR_INT16_BLOCK)
+      {
+	  int cells[4];
+	  int i;
+	  p = block + GAIA_QMBR_GRID_SIZE + (item * GAIA_QMBR_INT16_ITEM_SIZE);
+	  if (!valid)
+	    {
+		/* clearing the item */
+		memset (p, 0xff, GAIA_QMBR_INT16_ITEM_SIZE);
+		return;
+	    }
+	  qmbr_read_grid (block, grid);
+	  cells[0] = qmbr_cell_down (minx, grid, 0);
+	  cells[1] = qmbr_cell_down (miny, grid, 1);
+	  cells[2] = qmbr_cell_up (maxx, grid, 0);
+	  cells[3] = qmbr_cell_up (maxy, grid, 1);
+	  for (i = 0; i < 4; i++)
+	    {
+		*(p + (i * 2) + 0) = (unsigned char) (cells[i] & 0xff);
+		*(p + (i * 2) + 1) = (unsigned char) (cells[i] >> 8);
+	    }
+	  return;
+      }
+    p = block + (item * GAIA_QMBR_ITEM_SIZE);
+    if (!valid)
+      {
+	  /* clearing the item */
+	  int i;
+	  for (i = 0; i < 4; i++)
+	    {
+		*(p + (i * 4) + 0) = 0x00;
+		*(p + (i * 4) + 1) = 0x00;
+		*(p + (i * 4) + 2) = 0xc0;
+		*(p + (i * 4) + 3) = 0x7f;
+	    }
+	  return;
+      }
+    gaiaExportF32 (p + 0, gaiaFloatRoundDown (minx), 1, endian_arch);
+    gaiaExportF32 (p + 4, gaiaFloatRoundDown (miny), 1, endian_arch);
+    gaiaExportF32 (p + 8, gaiaFloatRoundUp (maxx), 1, endian_arch);
+    gaiaExportF32 (p + 12, gaiaFloatRoundUp (maxy), 1, endian_arch);
+}
+
+SPATIALITE_PRIVATE int
+getQuantizedMbr (const unsigned char *block, int block_size, int item,
+		 double *mbr)
+{
+/* 
+/ reading the Nth item of a block of the Quantized MBR index as
+/ quantized MinX, MinY, MaxX, MaxY values (FLOATs or grid cells),
+/ to be compared against a search frame quantized by quantizeMbrFrame()
+/ returns 0 if the item is empty
+*/
+    const unsigned char *p;
+    if (block_size == GAIA_QMBR_INT16_BLOCK)
+      {
+	  int i;
+	  p = block + GAIA_QMBR_GRID_SIZE + (item * GAIA_QMBR_INT16_ITEM_SIZE);
+	  for (i = 0; i < 4; i++)
+	      mbr[i] = *(p + (i * 2)) | (*(p + (i * 2) + 1) << 8);
+	  if (mbr[0] == GAIA_QMBR_INT16_CELLS)
+	      return 0;
+	  return 1;
+      }
+    if (block_size == GAIA_QMBR_FLOAT_BLOCK)
+      {
+	  int endian_arch = gaiaEndianArch ();
+	  p = block + (item * GAIA_QMBR_ITEM_SIZE);
+	  mbr[0] = gaiaImportF32 (p + 0, 1, endian_arch);
+	  mbr[1] = gaiaImportF32 (p + 4, 1, endian_arch);
+	  mbr[2] = gaiaImportF32 (p + 8, 1, endian_arch);
+	  mbr[3] = gaiaImportF32 (p + 12, 1, endian_arch);
+	  if (mbr[0] != mbr[0])
+	      return 0;
+	  return 1;
+      }
+    return 0;
+}
+
+SPATIALITE_PRIVATE int
+quantizeMbrFrame (const unsigned char *block, int block_size, double minx,
+		  double miny, double maxx, double maxy, double *frame)
+{
+/* 
+/ quantizing a search frame exactly as the items of the block are:
+/ both roundings are monotonic, so comparing quantized values never 
+/ rejects an item whose exact MBR intersects, is within or contains
+/ the exact search frame [MinX, MinY rounded down, MaxX, MaxY up]
+/ returns 0 if the block is invalid
+*/
+    if (block_size == GAIA_QMBR_INT16_BLOCK)
+      {
+	  double grid[4];
+	  qmbr_read_grid (block, grid);
+	  frame[0] = qmbr_cell_down (minx, grid, 0);
+	  frame[1] = qmbr_cell_down (miny, grid, 1);
+	  frame[2] = qmbr_cell_up (maxx, grid, 0);
+	  frame[3] = qmbr_cell_up (maxy, grid, 1);
+	  return 1;
+      }
+    if (block_size == GAIA_QMBR_FLOAT_BLOCK)
+      {
+	  frame[0] = gaiaFloatRoundDown (minx);
+	  frame[1] = gaiaFloatRoundDown (miny);
+	  frame[2] = gaiaFloatRoundUp (maxx);
+	  frame[3] = gaiaFloatRoundUp (maxy);
+	  return 1;
+      }
+    return 0;
+}
+
+SPATIALITE_PRIVATE void
+dequantizeMbr (const unsigned char *block, int block_size, const double *mbr,
+	       double *minx, double *miny, double *maxx, double *maxy)
+{
+/* 
+/ converting a quantized item back into coordinates, rounding outwards:
+/ the resulting MBR always contains the exact one
+*/
+    if (block_size == GAIA_QMBR_INT16_BLOCK)
+      {
+	  /* one more cell on each side absorbs any floating point error */
+	  double grid[4];
+	  qmbr_read_grid (block, grid);
+	  *minx =
+	      (mbr[0] <= 0.0) ? -DBL_MAX : grid[0] + ((mbr[0] - 1.0) * grid[2]);
+	  *miny =
+	      (mbr[1] <= 0.0) ? -DBL_MAX : grid[1] + ((mbr[1] - 1.0) * grid[3]);
+	  *maxx =
+	      (mbr[2] >=
+	       GAIA_QMBR_INT16_CELLS - 1) ? DBL_MAX : grid[0] +
+	      ((mbr[2] + 1.0) * grid[2]);
+	  *maxy =
+	      (mbr[3] >=
+	       GAIA_QMBR_INT16_CELLS - 1) ? DBL_MAX : grid[1] +
+	      ((mbr[3] + 1.0) * grid[3]);
+	  return;
+      }
+    *minx = mbr[0];
+    *miny = mbr[1];
+    *maxx = mbr[2];
+    *maxy = mbr[3];
+}
+
+static int
+qmbr_check_column (sqlite3 * sqlite, const char *table, const char *column,
+		   char **real_table, char **real_column)
+{
+/* checks if the Geometry Column is registered into the metadata tables */
+    int ret;
+    int count = 0;
+    char *sql;
+    sqlite3_stmt *stmt;
+    sql = sqlite3_mprintf ("SELECT Count(*) FROM geometry_columns "
+			   "WHERE Upper(f_table_name) = Upper(%Q) "
+			   "AND Upper(f_geometry_column) = Upper(%Q)", table,
+			   column);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    if (sqlite3_step (stmt) == SQLITE_ROW)
+	count = sqlite3_column_int (stmt, 0);
+    sqlite3_finalize (stmt);
+    if (count != 1)
+	return 0;
+    if (!getRealSQLnames (sqlite, table, column, real_table, real_column))
+	return 0;
+    return 1;
+}
+
+static int
+qmbr_drop_triggers (sqlite3 * sqlite, const char *table, const char *column)
+{
+/* deleting the Quantized MBR index triggers */
+    int ret;
+    int i;
+    char *raw;
+    char *sql;
+    char *quoted_trigger;
+    const char *prefixes[3] = { "qmi", "qmu", "qmd" };
+    for (i = 0; i < 3; i++)
+      {
+	  raw = sqlite3_mprintf ("%s_%s_%s", prefixes[i], table, column);
+	  quoted_trigger = gaiaDoubleQuotedSql (raw);
+	  sqlite3_free (raw);
+	  sql = sqlite3_mprintf ("DROP TRIGGER IF EXISTS main.\"%s\"",
+				 quoted_trigger);
+	  free (quoted_trigger);
+	  ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+	  sqlite3_free (sql);
+	  if (ret != SQLITE_OK)
+	      return 0;
+      }
+    return 1;
+}
+
+static int
+qmbr_create_triggers (sqlite3 * sqlite, const char *table,
+		      const char *column, const unsigned char *grid)
+{
+/* 
+/ creating the Quantized MBR index triggers:
+/ the block containing the changed ROWID is rewritten by SetQuantizedMbr()
+/ INT16 indices pass the grid as a BLOB literal, so that any new block
+/ will share exactly the same grid
+*/
+    int ret;
+    int i;
+    char *raw;
+    char *sql;
+    char *quoted_trigger;
+    char *quoted_table = gaiaDoubleQuotedSql (table);
+    char *quoted_column = gaiaDoubleQuotedSql (column);
+    char *qmbr = sqlite3_mprintf ("idx_%s_%s_qmbr", table, column);
+    char *quoted_qmbr = gaiaDoubleQuotedSql (qmbr);
+    char grid_arg[(GAIA_QMBR_GRID_SIZE * 2) + 8];
+    const char *prefixes[3] = { "qmi", "qmu", "qmd" };
+    int bits = GAIA_QMBR_BLOCK_BITS;
+    int ok = 0;
+    sqlite3_free (qmbr);
+    *grid_arg = '\0';
+    if (grid != NULL)
+      {
+	  char *p = grid_arg;
+	  strcpy (p, ", X'");
+	  p += 4;
+	  for (i = 0; i < GAIA_QMBR_GRID_SIZE; i++)
+	    {
+		sprintf (p, "%02X", grid[i]);
+		p += 2;
+	    }
+	  strcpy (p, "'");
+      }
+
+    for (i = 0; i < 3; i++)
+      {
+	  raw = sqlite3_mprintf ("%s_%s_%s", prefixes[i], table, column);
+	  quoted_trigger = gaiaDoubleQuotedSql (raw);
+	  sqlite3_free (raw);
+	  if (i == 0)
+	      sql =
+		  sqlite3_mprintf
+		  ("CREATE TRIGGER \"%s\" AFTER INSERT ON \"%s\"\n"
+		   "FOR EACH ROW BEGIN\n"
+		   "INSERT OR REPLACE INTO \"%s\" (block, data) VALUES "
+		   "(NEW.ROWID >> %d, SetQuantizedMbr((SELECT data FROM \"%s\" "
+		   "WHERE block = NEW.ROWID >> %d), NEW.ROWID, NEW.\"%s\"%s));\nEND",
+		   quoted_trigger, quoted_table, quoted_qmbr, bits,
+		   quoted_qmbr, bits, quoted_column, grid_arg);
+	  else if (i == 1)
+	      sql =
+		  sqlite3_mprintf
+		  ("CREATE TRIGGER \"%s\" AFTER UPDATE OF \"%s\" ON \"%s\"\n"
+		   "FOR EACH ROW BEGIN\n"
+		   "UPDATE \"%s\" SET data = SetQuantizedMbr(data, OLD.ROWID, NULL) "
+		   "WHERE block = OLD.ROWID >> %d;\n"
+		   "INSERT OR REPLACE INTO \"%s\" (block, data) VALUES "
+		   "(NEW.ROWID >> %d, SetQuantizedMbr((SELECT data FROM \"%s\" "
+		   "WHERE block = NEW.ROWID >> %d), NEW.ROWID, NEW.\"%s\"%s));\nEND",
+		   quoted_trigger, quoted_column, quoted_table, quoted_qmbr,
+		   bits, quoted_qmbr, bits, quoted_qmbr, bits, quoted_column,
+		   grid_arg);
+	  else
+	      sql =
+		  sqlite3_mprintf
+		  ("CREATE TRIGGER \"%s\" AFTER DELETE ON \"%s\"\n"
+		   "FOR EACH ROW BEGIN\n"
+		   "UPDATE \"%s\" SET data = SetQuantizedMbr(data, OLD.ROWID, NULL) "
+		   "WHERE block = OLD.ROWID >> %d;\nEND", quoted_trigger,
+		   quoted_table, quoted_qmbr, bits);
+	  free (quoted_trigger);
+	  ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+	  sqlite3_free (sql);
+	  if (ret != SQLITE_OK)
+	      goto stop;
+      }
+    ok = 1;
+
+  stop:
+    free (quoted_table);
+    free (quoted_column);
+    free (quoted_qmbr);
+    return ok;
+}
+
+static int
+qmbr_fit_grid (sqlite3 * sqlite, const char *table, const char *column,
+	       unsigned char *grid)
+{
+/* 
+/ fitting an INT16 grid to the current extent of the Geometry Column:
+/ any later MBR falling outside is simply clamped to the border cells,
+/ and thus will be matched by more filters than strictly required
+*/
+    int ret;
+    char *sql;
+    char *xtable;
+    char *xcolumn;
+    sqlite3_stmt *stmt;
+    double minx = 0.0;
+    double miny = 0.0;
+    double cellx = 1.0;
+    double celly = 1.0;
+    int endian_arch = gaiaEndianArch ();
+    xtable = gaiaDoubleQuotedSql (table);
+    xcolumn = gaiaDoubleQuotedSql (column);
+    sql =
+	sqlite3_mprintf
+	("SELECT Min(MbrMinX(\"%s\")), Min(MbrMinY(\"%s\")), "
+	 "Max(MbrMaxX(\"%s\")), Max(MbrMaxY(\"%s\")) FROM \"%s\"", xcolumn,
+	 xcolumn, xcolumn, xcolumn, xtable);
+    free (xtable);
+    free (xcolumn);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    if (sqlite3_step (stmt) == SQLITE_ROW
+	&& sqlite3_column_type (stmt, 0) != SQLITE_NULL)
+      {
+	  minx = sqlite3_column_double (stmt, 0);
+	  miny = sqlite3_column_double (stmt, 1);
+	  cellx =
+	      (sqlite3_column_double (stmt, 2) -
+	       minx) / (GAIA_QMBR_INT16_CELLS - 1);
+	  celly =
+	      (sqlite3_column_double (stmt, 3) -
+	       miny) / (GAIA_QMBR_INT16_CELLS - 1);
+	  if (!(cellx > 0.0))
+	      cellx = 1.0;
+	  if (!(celly > 0.0))
+	      celly = 1.0;
+      }
+    sqlite3_finalize (stmt);
+    gaiaExport64 (grid + 0, minx, 1, endian_arch);
+    gaiaExport64 (grid + 8, miny, 1, endian_arch);
+    gaiaExport64 (grid + 16, cellx, 1, endian_arch);
+    gaiaExport64 (grid + 24, celly, 1, endian_arch);
+    return 1;
+}
+
+static int
+qmbr_get_bits (sqlite3 * sqlite, const char *table, const char *column)
+{
+/* 
+/ checking the quantization of an existing index: the INSERT trigger
+/ of an INT16 index passes its grid as a BLOB literal
+*/
+    int ret;
+    int bits = 32;
+    char *sql;
+    sqlite3_stmt *stmt;
+    sql = sqlite3_mprintf ("SELECT sql FROM sqlite_master WHERE "
+			   "type = 'trigger' AND Upper(name) = Upper('qmi_%q_%q')",
+			   table, column);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return bits;
+    if (sqlite3_step (stmt) == SQLITE_ROW
+	&& sqlite3_column_type (stmt, 0) == SQLITE_TEXT)
+      {
+	  const char *trigger = (const char *) sqlite3_column_text (stmt, 0);
+	  if (strstr (trigger, ", X'") != NULL)
+	      bits = 16;
+      }
+    sqlite3_finalize (stmt);
+    return bits;
+}
+
+static int
+qmbr_populate (sqlite3 * sqlite, const char *table, const char *column,
+	       const unsigned char *grid)
+{
+/* loading the Quantized MBR index from scratch [rowid order] */
+    int ret;
+    int ok = 0;
+    int pending = 0;
+    int block_size = 0;
+    char *sql;
+    char *xtable;
+    char *xcolumn;
+    char *xqmbr;
+    char *qmbr;
+    sqlite3_int64 current = 0;
+    sqlite3_stmt *stmt_in = NULL;
+    sqlite3_stmt *stmt_out = NULL;
+    unsigned char block[GAIA_QMBR_FLOAT_BLOCK];
+
+    xtable = gaiaDoubleQuotedSql (table);
+    xcolumn = gaiaDoubleQuotedSql (column);
+    sql = sqlite3_mprintf ("SELECT ROWID, \"%s\" FROM \"%s\" ORDER BY ROWID",
+			   xcolumn, xtable);
+    free (xtable);
+    free (xcolumn);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt_in, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto stop;
+    qmbr = sqlite3_mprintf ("idx_%s_%s_qmbr", table, column);
+    xqmbr = gaiaDoubleQuotedSql (qmbr);
+    sqlite3_free (qmbr);
+    sql = sqlite3_mprintf ("INSERT INTO \"%s\" (block, data) VALUES (?, ?)",
+			   xqmbr);
+    free (xqmbr);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt_out, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto stop;
+
+    while (1)
+      {
+	  /* scrolling the result set rows */
+	  sqlite3_int64 rowid;
+	  sqlite3_int64 block_id;
+	  ret = sqlite3_step (stmt_in);
+	  if (ret == SQLITE_DONE)
+	      break;		/* end of result set */
+	  if (ret != SQLITE_ROW)
+	      goto stop;
+	  if (sqlite3_column_type (stmt_in, 1) != SQLITE_BLOB)
+	      continue;
+	  rowid = sqlite3_column_int64 (stmt_in, 0);
+	  block_id = rowid >> GAIA_QMBR_BLOCK_BITS;
+	  if (pending && block_id != current)
+	    {
+		/* saving the previous block */
+		sqlite3_reset (stmt_out);
+		sqlite3_clear_bindings (stmt_out);
+		sqlite3_bind_int64 (stmt_out, 1, current);
+		sqlite3_bind_blob (stmt_out, 2, block, block_size,
+				   SQLITE_STATIC);
+		ret = sqlite3_step (stmt_out);
+		if (ret != SQLITE_DONE && ret != SQLITE_ROW)
+		    goto stop;
+		pending = 0;
+	    }
+	  if (!pending)
+	    {
+		block_size = initQuantizedMbrBlock (block, grid);
+		current = block_id;
+		pending = 1;
+	    }
+	  setQuantizedMbr (block, block_size,
+			   (int) (rowid & (GAIA_QMBR_BLOCK_ITEMS - 1)),
+			   sqlite3_column_blob (stmt_in, 1),
+			   sqlite3_column_bytes (stmt_in, 1));
+      }
+    if (pending)
+      {
+	  /* saving the last block */
+	  sqlite3_reset (stmt_out);
+	  sqlite3_clear_bindings (stmt_out);
+	  sqlite3_bind_int64 (stmt_out, 1, current);
+	  sqlite3_bind_blob (stmt_out, 2, block, block_size, SQLITE_STATIC);
+	  ret = sqlite3_step (stmt_out);
+	  if (ret != SQLITE_DONE && ret != SQLITE_ROW)
+	      goto stop;
+      }
+    ok = 1;
+
+  stop:
+    if (stmt_in != NULL)
+	sqlite3_finalize (stmt_in);
+    if (stmt_out != NULL)
+	sqlite3_finalize (stmt_out);
+    return ok;
+}
+
+SPATIALITE_PRIVATE int
+createQuantizedMbrIndex (void *p_sqlite, const char *table,
+			 const char *column, int bits)
+{
+/*
+/ creates (or rebuilds) the Quantized MBR index of some Geometry Column
+/ BITS selects the quantization: 32 (FLOATs) or 16 (INT16 cells of a
+/ grid fitted to the current extent; half the size, but coarser)
+/
+/ the idx_<table>_<column>_qmbr table stores rowid-aligned blocks
+/ of packed MBRs, each block covering GAIA_QMBR_BLOCK_ITEMS
+/ consecutive ROWIDs (block = ROWID >> GAIA_QMBR_BLOCK_BITS); it's 
+/ kept up to date by the qmi_/qmu_/qmd_ triggers and it's automatically
+/ used by VirtualSpatialIndex (and so by VirtualSpatialLayer) when the
+/ Geometry Column has no R*Tree, also evaluating FilterMbrWithin(),
+/ FilterMbrContains() and FilterMbrIntersects() search frames
+/
+/ ROWIDs are expected to be reasonably dense (as the ones assigned
+/ by SQLite on INSERT are): every missing ROWID inside an existing
+/ block still costs an empty item, so a table whose ROWIDs are spread
+/ out by far more than 64 per row wastes most of each block
+*/
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    char *p_table = NULL;
+    char *p_column = NULL;
+    char *qmbr;
+    char *xqmbr;
+    char *sql;
+    int ret;
+    int ok = 0;
+    unsigned char grid[GAIA_QMBR_GRID_SIZE];
+    const unsigned char *p_grid = NULL;
+    if (bits != 16 && bits != 32)
+	return 0;
+    if (!qmbr_check_column (sqlite, table, column, &p_table, &p_column))
+	return 0;
+    qmbr = sqlite3_mprintf ("idx_%s_%s_qmbr", p_table, p_column);
+    xqmbr = gaiaDoubleQuotedSql (qmbr);
+    sqlite3_free (qmbr);
+
+    ret = sqlite3_exec (sqlite, "SAVEPOINT spatialite_qmbr_index", NULL,
+			NULL, NULL);
+    if (ret != SQLITE_OK)
+	goto stop;
+    sql = sqlite3_mprintf ("DROP TABLE IF EXISTS \"%s\"; "
+			   "CREATE TABLE \"%s\" (block INTEGER PRIMARY KEY, "
+			   "data BLOB NOT NULL)", xqmbr, xqmbr);
+    ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+    sqlite3_free (sql);
+    if (ret == SQLITE_OK && bits == 16)
+      {
+	  if (qmbr_fit_grid (sqlite, p_table, p_column, grid))
+	      p_grid = grid;
+	  else
+	      ret = SQLITE_ERROR;
+      }
+    if (ret == SQLITE_OK)
+      {
+	  if (qmbr_populate (sqlite, p_table, p_column, p_grid))
+	    {
+		if (qmbr_drop_triggers (sqlite, p_table, p_column))
+		    ok = qmbr_create_triggers (sqlite, p_table, p_column,
+					       p_grid);
+	    }
+      }
+    if (!ok)
+	sqlite3_exec (sqlite, "ROLLBACK TO spatialite_qmbr_index", NULL,
+		      NULL, NULL);
+    sqlite3_exec (sqlite, "RELEASE spatialite_qmbr_index", NULL, NULL, NULL);
+
+  stop:
+    free (xqmbr);
+    free (p_table);
+    free (p_column);
+    return ok;
+}
+
+SPATIALITE_PRIVATE int
+disableQuantizedMbrIndex (void *p_sqlite, const char *table,
+			  const char *column)
+{
+/* removes the Quantized MBR index of some Geometry Column */
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    char *p_table = NULL;
+    char *p_column = NULL;
+    char *qmbr;
+    char *xqmbr;
+    char *sql;
+    int ret;
+    int ok = 0;
+    if (!qmbr_check_column (sqlite, table, column, &p_table, &p_column))
+	return 0;
+    qmbr = sqlite3_mprintf ("idx_%s_%s_qmbr", p_table, p_column);
+    if (!already_existing_table (sqlite, qmbr))
+      {
+	  sqlite3_free (qmbr);
+	  goto stop;
+      }
+    xqmbr = gaiaDoubleQuotedSql (qmbr);
+    sqlite3_free (qmbr);
+    if (qmbr_drop_triggers (sqlite, p_table, p_column))
+      {
+	  sql = sqlite3_mprintf ("DROP TABLE \"%s\"", xqmbr);
+	  ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+	  sqlite3_free (sql);
+	  if (ret == SQLITE_OK)
+	      ok = 1;
+      }
+    free (xqmbr);
+
+  stop:
+    free (p_table);
+    free (p_column);
+    return ok;
+}
+
+static int
+pyramid_check_result (sqlite3 * sqlite, const char *sql)
+{
+/* executes a single-value SQL query, checking for a result of 1 */
+    int ret;
+    int ok = 0;
+    sqlite3_stmt *stmt;
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    if (sqlite3_step (stmt) == SQLITE_ROW)
+      {
+	  if (sqlite3_column_type (stmt, 0) == SQLITE_INTEGER
+	      && sqlite3_column_int (stmt, 0) == 1)
+	      ok = 1;
+      }
+    sqlite3_finalize (stmt);
+    return ok;
+}
+
+static int
+pyramid_get_levels (sqlite3 * sqlite, const char *table, const char *column,
+		    int *levels, double *tolerance, int *preserve_topology)
+{
+/* retrieving the definition of some Geometry Pyramid [if any] */
+    int ret;
+    char *sql;
+    sqlite3_stmt *stmt;
+    *levels = 0;
+    if (!already_existing_table (sqlite, "geometry_pyramids"))
+	return 1;
+    sql = sqlite3_mprintf ("SELECT level, tolerance, preserve_topology "
+			   "FROM geometry_pyramids "
+			   "WHERE Upper(f_table_name) = Upper(%Q) "
+			   "AND Upper(f_geometry_column) = Upper(%Q) "
+			   "ORDER BY level", table, column);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    while (1)
+      {
+	  /* scrolling the result set rows */
+	  ret = sqlite3_step (stmt);
+	  if (ret == SQLITE_DONE)
+	      break;		/* end of result set */
+	  if (ret != SQLITE_ROW)
+	    {
+		sqlite3_finalize (stmt);
+		return 0;
+	    }
+	  if (sqlite3_column_int (stmt, 0) == 1)
+	    {
+		*tolerance = sqlite3_column_double (stmt, 1);
+		*preserve_topology = sqlite3_column_int (stmt, 2);
+	    }
+	  *levels += 1;
+      }
+    sqlite3_finalize (stmt);
+    return 1;
+}
+
+static int
+pyramid_drop_triggers (sqlite3 * sqlite, const char *table,
+		       const char *column)
+{
+/* deleting the Geometry Pyramid triggers */
+    int ret;
+    int i;
+    char *raw;
+    char *sql;
+    char *quoted_trigger;
+    const char *prefixes[3] = { "pyi", "pyu", "pyd" };
+    for (i = 0; i < 3; i++)
+      {
+	  raw = sqlite3_mprintf ("%s_%s_%s", prefixes[i], table, column);
+	  quoted_trigger = gaiaDoubleQuotedSql (raw);
+	  sqlite3_free (raw);
+	  sql = sqlite3_mprintf ("DROP TRIGGER IF EXISTS main.\"%s\"",
+				 quoted_trigger);
+	  free (quoted_trigger);
+	  ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+	  sqlite3_free (sql);
+	  if (ret != SQLITE_OK)
+	      return 0;
+      }
+    return 1;
+}
+
+static char *
+pyramid_simplify_expr (const char *prefix, const char *column,
+		       double tolerance, int preserve_topology)
+{
+/* 
+/ the SQL expression generalizing the Geometry for some Pyramid level:
+/ features collapsing into an empty Geometry are stored as NULL
+*/
+    char *expr;
+    char *quoted_column = gaiaDoubleQuotedSql (column);
+    expr =
+	sqlite3_mprintf
+	("(SELECT CASE WHEN ST_NPoints(g) > 0 THEN g END FROM "
+	 "(SELECT CastToXY(%s(%s\"%s\", %1.16e)) AS g))",
+	 preserve_topology ? "SimplifyPreserveTopology" : "Simplify", prefix,
+	 quoted_column, tolerance);
+    free (quoted_column);
+    return expr;
+}
+
+static int
+pyramid_create_triggers (sqlite3 * sqlite, const char *table,
+			 const char *column, int levels, double tolerance,
+			 int preserve_topology)
+{
+/* 
+/ creating the Geometry Pyramid triggers:
+/ any change affecting the Geometry is replicated on all levels
+/ [DELETE + INSERT, so to correctly update their own R*Trees]
+*/
+    int ret;
+    int i;
+    int lv;
+    char *raw;
+    char *sql;
+    char *prev;
+    char *expr;
+    char *quoted_trigger;
+    char *quoted_level;
+    char *quoted_table = gaiaDoubleQuotedSql (table);
+    char *quoted_column = gaiaDoubleQuotedSql (column);
+    const char *prefixes[3] = { "pyi", "pyu", "pyd" };
+    int ok = 0;
+    double tol;
+
+    for (i = 0; i < 3; i++)
+      {
+	  raw = sqlite3_mprintf ("%s_%s_%s", prefixes[i], table, column);
+	  quoted_trigger = gaiaDoubleQuotedSql (raw);
+	  sqlite3_free (raw);
+	  if (i == 0)
+	      sql =
+		  sqlite3_mprintf
+		  ("CREATE TRIGGER \"%s\" AFTER INSERT ON \"%s\"\n"
+		   "FOR EACH ROW BEGIN\n", quoted_trigger, quoted_table);
+	  else if (i == 1)
+	      sql =
+		  sqlite3_mprintf
+		  ("CREATE TRIGGER \"%s\" AFTER UPDATE OF \"%s\" ON \"%s\"\n"
+		   "FOR EACH ROW BEGIN\n", quoted_trigger, quoted_column,
+		   quoted_table);
+	  else
+	      sql =
+		  sqlite3_mprintf
+		  ("CREATE TRIGGER \"%s\" AFTER DELETE ON \"%s\"\n"
+		   "FOR EACH ROW BEGIN\n", quoted_trigger, quoted_table);
+	  free (quoted_trigger);
+	  tol = tolerance;
+	  for (lv = 1; lv <= levels; lv++)
+	    {
+		raw = sqlite3_mprintf ("pyr_%s_%s_%d", table, column, lv);
+		quoted_level = gaiaDoubleQuotedSql (raw);
+		sqlite3_free (raw);
+		if (i > 0)
+		  {
+		      prev = sql;
+		      sql =
+			  sqlite3_mprintf
+			  ("%sDELETE FROM \"%s\" WHERE id = OLD.ROWID;\n",
+			   prev, quoted_level);
+		      sqlite3_free (prev);
+		  }
+		if (i < 2)
+		  {
+		      expr =
+			  pyramid_simplify_expr ("NEW.", column, tol,
+						 preserve_topology);
+		      prev = sql;
+		      sql =
+			  sqlite3_mprintf
+			  ("%sINSERT INTO \"%s\" (id, \"%s\") VALUES (NEW.ROWID, %s);\n",
+			   prev, quoted_level, quoted_column, expr);
+		      sqlite3_free (prev);
+		      sqlite3_free (expr);
+		  }
+		free (quoted_level);
+		tol *= GAIA_PYRAMID_FACTOR;
+	    }
+	  prev = sql;
+	  sql = sqlite3_mprintf ("%sEND", prev);
+	  sqlite3_free (prev);
+	  ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+	  sqlite3_free (sql);
+	  if (ret != SQLITE_OK)
+	      goto stop;
+      }
+    ok = 1;
+
+  stop:
+    free (quoted_table);
+    free (quoted_column);
+    return ok;
+}
+
+static int
+pyramid_drop_levels (sqlite3 * sqlite, const char *table, const char *column)
+{
+/* removing all the Pyramid levels of some Geometry Column */
+    int lv;
+    int ret;
+    char *raw;
+    char *xraw;
+    char *sql;
+    char *idx;
+    char *xidx;
+    for (lv = 1; lv <= GAIA_PYRAMID_MAX_LEVELS; lv++)
+      {
+	  raw = sqlite3_mprintf ("pyr_%s_%s_%d", table, column, lv);
+	  if (!already_existing_table (sqlite, raw))
+	    {
+		sqlite3_free (raw);
+		continue;
+	    }
+	  idx = sqlite3_mprintf ("idx_%s_%s", raw, column);
+	  xidx = gaiaDoubleQuotedSql (idx);
+	  sqlite3_free (idx);
+	  xraw = gaiaDoubleQuotedSql (raw);
+	  sql = sqlite3_mprintf ("SELECT DiscardGeometryColumn(%Q, %Q)", raw,
+				 column);
+	  sqlite3_free (raw);
+	  ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+	  sqlite3_free (sql);
+	  if (ret == SQLITE_OK)
+	    {
+		sql = sqlite3_mprintf ("DROP TABLE IF EXISTS \"%s\"; "
+				       "DROP TABLE IF EXISTS \"%s\"", xidx,
+				       xraw);
+		ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+		sqlite3_free (sql);
+	    }
+	  free (xidx);
+	  free (xraw);
+	  if (ret != SQLITE_OK)
+	      return 0;
+      }
+    if (already_existing_table (sqlite, "geometry_pyramids"))
+      {
+	  sql = sqlite3_mprintf ("DELETE FROM geometry_pyramids "
+				 "WHERE Upper(f_table_name) = Upper(%Q) "
+				 "AND Upper(f_geometry_column) = Upper(%Q)",
+				 table, column);
+	  ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+	  sqlite3_free (sql);
+	  if (ret != SQLITE_OK)
+	      return 0;
+      }
+    return 1;
+}
+
+static int
+pyramid_create_level (sqlite3 * sqlite, const char *table,
+		      const char *column, int srid, int level,
+		      double tolerance, int preserve_topology)
+{
+/* creating and populating a single Pyramid level */
+    int ret;
+    char *raw;
+    char *xraw;
+    char *sql;
+    char *expr;
+    char *xtable = gaiaDoubleQuotedSql (table);
+    char *xcolumn = gaiaDoubleQuotedSql (column);
+    int ok = 0;
+
+    raw = sqlite3_mprintf ("pyr_%s_%s_%d", table, column, level);
+    xraw = gaiaDoubleQuotedSql (raw);
+    sql = sqlite3_mprintf ("CREATE TABLE \"%s\" (id INTEGER PRIMARY KEY)",
+			   xraw);
+    ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto stop;
+    sql =
+	sqlite3_mprintf
+	("SELECT AddGeometryColumn(%Q, %Q, %d, 'GEOMETRY', 'XY')", raw,
+	 column, srid);
+    ret = pyramid_check_result (sqlite, sql);
+    sqlite3_free (sql);
+    if (!ret)
+	goto stop;
+    expr = pyramid_simplify_expr ("", column, tolerance, preserve_topology);
+    sql = sqlite3_mprintf ("INSERT INTO \"%s\" (id, \"%s\") "
+			   "SELECT ROWID, %s FROM \"%s\" ORDER BY ROWID", xraw,
+			   xcolumn, expr, xtable);
+    sqlite3_free (expr);
+    ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto stop;
+    sql = sqlite3_mprintf ("SELECT CreateSpatialIndex(%Q, %Q)", raw, column);
+    ret = pyramid_check_result (sqlite, sql);
+    sqlite3_free (sql);
+    if (!ret)
+	goto stop;
+    sql = sqlite3_mprintf ("INSERT INTO geometry_pyramids "
+			   "(f_table_name, f_geometry_column, level, tolerance, "
+			   "preserve_topology) VALUES "
+			   "(Lower(%Q), Lower(%Q), %d, %1.16e, %d)", table,
+			   column, level, tolerance, preserve_topology);
+    ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto stop;
+    ok = 1;
+
+  stop:
+    sqlite3_free (raw);
+    free (xraw);
+    free (xtable);
+    free (xcolumn);
+    return ok;
+}
+
+SPATIALITE_PRIVATE int
+createGeometryPyramid (void *p_sqlite, const char *table, const char *column,
+		       double tolerance, int levels, int preserve_topology)
+{
+/*
+/ creates (or rebuilds) the Geometry Pyramid of some Geometry Column
+/
+/ each level is a pyr_<table>_<column>_<N> table (id = ROWID of the
+/ parent table) holding the generalized Geometries, with its own
+/ R*Tree SpatialIndex; the simplification tolerance of level 1 is
+/ the given one, and it's multiplied by GAIA_PYRAMID_FACTOR at
+/ each further level. all levels are kept up to date by the 
+/ pyi_/pyu_/pyd_ triggers and are registered into geometry_pyramids
+*/
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    char *p_table = NULL;
+    char *p_column = NULL;
+    char *sql;
+    int ret;
+    int lv;
+    int srid = -1;
+    int ok = 0;
+    double tol = tolerance;
+    sqlite3_stmt *stmt;
+    if (levels < 1 || levels > GAIA_PYRAMID_MAX_LEVELS || tolerance <= 0.0)
+	return 0;
+    if (checkSpatialMetaData (sqlite) != 3)
+	return 0;
+    if (!qmbr_check_column (sqlite, table, column, &p_table, &p_column))
+	return 0;
+    sql = sqlite3_mprintf ("SELECT srid FROM geometry_columns "
+			   "WHERE Upper(f_table_name) = Upper(%Q) "
+			   "AND Upper(f_geometry_column) = Upper(%Q)", table,
+			   column);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto stop;
+    if (sqlite3_step (stmt) == SQLITE_ROW)
+	srid = sqlite3_column_int (stmt, 0);
+    sqlite3_finalize (stmt);
+
+    ret = sqlite3_exec (sqlite, "SAVEPOINT spatialite_pyramid", NULL,
+			NULL, NULL);
+    if (ret != SQLITE_OK)
+	goto stop;
+    ret = sqlite3_exec (sqlite, "CREATE TABLE IF NOT EXISTS geometry_pyramids ("
+			"f_table_name TEXT NOT NULL,\n"
+			"f_geometry_column TEXT NOT NULL,\n"
+			"level INTEGER NOT NULL,\n"
+			"tolerance DOUBLE NOT NULL,\n"
+			"preserve_topology INTEGER NOT NULL,\n"
+			"CONSTRAINT pk_geom_pyramids PRIMARY KEY "
+			"(f_table_name, f_geometry_column, level))", NULL,
+			NULL, NULL);
+    if (ret != SQLITE_OK)
+	goto rollback;
+    if (!pyramid_drop_triggers (sqlite, p_table, p_column))
+	goto rollback;
+    if (!pyramid_drop_levels (sqlite, p_table, p_column))
+	goto rollback;
+    for (lv = 1; lv <= levels; lv++)
+      {
+	  if (!pyramid_create_level
+	      (sqlite, p_table, p_column, srid, lv, tol, preserve_topology))
+	      goto rollback;
+	  tol *= GAIA_PYRAMID_FACTOR;
+      }
+    ok = pyramid_create_triggers (sqlite, p_table, p_column, levels,
+				  tolerance, preserve_topology);
+
+  rollback:
+    if (!ok)
+	sqlite3_exec (sqlite, "ROLLBACK TO spatialite_pyramid", NULL,
+		      NULL, NULL);
+    sqlite3_exec (sqlite, "RELEASE spatialite_pyramid", NULL, NULL, NULL);
+
+  stop:
+    free (p_table);
+    free (p_column);
+    return ok;
+}
+
+SPATIALITE_PRIVATE int
+dropGeometryPyramid (void *p_sqlite, const char *table, const char *column)
+{
+/* removes the Geometry Pyramid of some Geometry Column */
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    char *p_table = NULL;
+    char *p_column = NULL;
+    int ret;
+    int levels;
+    int preserve_topology;
+    double tolerance;
+    int ok = 0;
+    if (!qmbr_check_column (sqlite, table, column, &p_table, &p_column))
+	return 0;
+    if (!pyramid_get_levels
+	(sqlite, p_table, p_column, &levels, &tolerance, &preserve_topology))
+	goto stop;
+    if (levels == 0)
+	goto stop;
+    ret = sqlite3_exec (sqlite, "SAVEPOINT spatialite_pyramid", NULL,
+			NULL, NULL);
+    if (ret != SQLITE_OK)
+	goto stop;
+    if (pyramid_drop_triggers (sqlite, p_table, p_column))
+	ok = pyramid_drop_levels (sqlite, p_table, p_column);
+    if (!ok)
+	sqlite3_exec (sqlite, "ROLLBACK TO spatialite_pyramid", NULL,
+		      NULL, NULL);
+    sqlite3_exec (sqlite, "RELEASE spatialite_pyramid", NULL, NULL, NULL);
+
+  stop:
+    free (p_table);
+    free (p_column);
+    return ok;
+}
+
+SPATIALITE_PRIVATE int
+discardGeometryPyramid (void *p_sqlite, const char *table, const char *column)
+{
+/* 
+/ removes the Pyramid levels of some Geometry Column [if any]
+/ the Geometry Column itself (and its triggers) being already discarded
+*/
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    int ret;
+    int levels;
+    int preserve_topology;
+    double tolerance;
+    int ok;
+    if (!pyramid_get_levels
+	(sqlite, table, column, &levels, &tolerance, &preserve_topology))
+	return 0;
+    if (levels == 0)
+	return 1;
+    ret = sqlite3_exec (sqlite, "SAVEPOINT spatialite_pyramid", NULL,
+			NULL, NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    ok = pyramid_drop_levels (sqlite, table, column);
+    if (!ok)
+	sqlite3_exec (sqlite, "ROLLBACK TO spatialite_pyramid", NULL,
+		      NULL, NULL);
+    sqlite3_exec (sqlite, "RELEASE spatialite_pyramid", NULL, NULL, NULL);
+    return ok;
+}
+
+SPATIALITE_PRIVATE char *
+getGeometryPyramidTable (void *p_sqlite, const char *table,
+			 const char *column, double resolution)
+{
+/*
+/ returns the name of the table best fitting the given map resolution
+/ [map units per pixel]: i.e. the coarsest Pyramid level whose tolerance
+/ doesn't exceed the resolution, or the parent table itself when even
+/ the first level is too coarse; NULL if no Pyramid is defined
+/ [the returned string must be freed by sqlite3_free]
+*/
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    char *p_table = NULL;
+    char *p_column = NULL;
+    char *sql;
+    char *name = NULL;
+    int ret;
+    int level = -1;
+    sqlite3_stmt *stmt;
+    if (!already_existing_table (sqlite, "geometry_pyramids"))
+	return NULL;
+    if (!qmbr_check_column (sqlite, table, column, &p_table, &p_column))
+	return NULL;
+    sql = sqlite3_mprintf ("SELECT Max(CASE WHEN tolerance <= %1.16e "
+			   "THEN level ELSE 0 END) FROM geometry_pyramids "
+			   "WHERE Upper(f_table_name) = Upper(%Q) "
+			   "AND Upper(f_geometry_column) = Upper(%Q)",
+			   resolution, table, column);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto stop;
+    if (sqlite3_step (stmt) == SQLITE_ROW)
+      {
+	  if (sqlite3_column_type (stmt, 0) == SQLITE_INTEGER)
+	      level = sqlite3_column_int (stmt, 0);
+      }
+    sqlite3_finalize (stmt);
+    if (level == 0)
+	name = sqlite3_mprintf ("%s", p_table);
+    else if (level > 0)
+	name = sqlite3_mprintf ("pyr_%s_%s_%d", p_table, p_column, level);
+
+  stop:
+    free (p_table);
+    free (p_column);
+    return name;
+}
+
+SPATIALITE_PRIVATE int
+setGeometryQuantization (void *p_sqlite, const char *table,
+			 const char *column, int precision, int block_size)
+{
+/*
+/ registers the precision (number of decimal digits) and the block size
+/ of the quantized BLOBs of some Geometry Column into the 
+/ geometry_columns_quantization table [created if not yet existing]
+*/
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    char *p_table = NULL;
+    char *p_column = NULL;
+    char *sql;
+    int ret;
+    if (precision < 0 || precision > 15 || block_size < 0)
+	return 0;
+    if (checkSpatialMetaData (sqlite) != 3)
+	return 0;
+    if (!qmbr_check_column (sqlite, table, column, &p_table, &p_column))
+	return 0;
+    free (p_table);
+    free (p_column);
+    ret =
+	sqlite3_exec (sqlite,
+		      "CREATE TABLE IF NOT EXISTS geometry_columns_quantization ("
+		      "f_table_name TEXT NOT NULL,\n"
+		      "f_geometry_column TEXT NOT NULL,\n"
+		      "precision INTEGER NOT NULL,\n"
+		      "block_size INTEGER NOT NULL,\n"
+		      "CONSTRAINT pk_geom_quantization PRIMARY KEY "
+		      "(f_table_name, f_geometry_column),\n"
+		      "CONSTRAINT fk_geom_quantization FOREIGN KEY "
+		      "(f_table_name, f_geometry_column) REFERENCES "
+		      "geometry_columns (f_table_name, f_geometry_column) "
+		      "ON DELETE CASCADE,\n"
+		      "CONSTRAINT ck_geom_quantization CHECK "
+		      "(precision BETWEEN 0 AND 15 AND block_size >= 0))",
+		      NULL, NULL, NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    sql = sqlite3_mprintf ("INSERT OR REPLACE INTO "
+			   "geometry_columns_quantization "
+			   "(f_table_name, f_geometry_column, precision, "
+			   "block_size) VALUES (Lower(%Q), Lower(%Q), %d, %d)",
+			   table, column, precision, block_size);
+    ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    return 1;
+}
+
+SPATIALITE_PRIVATE int
+getGeometryQuantization (void *p_sqlite, const char *table,
+			 const char *column, int *precision, int *block_size)
+{
+/* 
+/ retrieving the quantization settings of some Geometry Column
+/ returns 0 if none is registered
+*/
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    char *sql;
+    int ret;
+    int ok = 0;
+    sqlite3_stmt *stmt;
+    if (!already_existing_table (sqlite, "geometry_columns_quantization"))
+	return 0;
+    sql = sqlite3_mprintf ("SELECT precision, block_size "
+			   "FROM geometry_columns_quantization "
+			   "WHERE Upper(f_table_name) = Upper(%Q) "
+			   "AND Upper(f_geometry_column) = Upper(%Q)", table,
+			   column);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    if (sqlite3_step (stmt) == SQLITE_ROW)
+      {
+	  *precision = sqlite3_column_int (stmt, 0);
+	  *block_size = sqlite3_column_int (stmt, 1);
+	  ok = 1;
+      }
+    sqlite3_finalize (stmt);
+    return ok;
+}
+
+SPATIALITE_PRIVATE int
+dropGeometryQuantization (void *p_sqlite, const char *table,
+			  const char *column)
+{
+/* 
+/ removes the quantization settings of some Geometry Column [if any]
+/ the Geometry Column itself could be already discarded
+*/
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    char *sql;
+    int ret;
+    if (!already_existing_table (sqlite, "geometry_columns_quantization"))
+	return 1;
+    sql = sqlite3_mprintf ("DELETE FROM geometry_columns_quantization "
+			   "WHERE Upper(f_table_name) = Upper(%Q) "
+			   "AND Upper(f_geometry_column) = Upper(%Q)", table,
+			   column);
+    ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    return 1;
+}
+
+SPATIALITE_PRIVATE int
+reloadSpatialIndex (void *p_sqlite, const char *table, const char *column)
+{
+/*
+/ rebuilding from scratch all indices keyed by the ROWIDs of some
+/ Geometry Column (R*Tree, MbrCache, Quantized MBR index and
+/ Geometry Pyramid)
+/ after the table ROWIDs have been reassigned
+*/
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    char *p_table = NULL;
+    char *p_column = NULL;
+    char *raw;
+    char *xname;
+    char *xtable;
+    char *xcolumn;
+    char *sql;
+    int ret;
+    int enabled = -1;
+    int ok = 0;
+    int levels;
+    int preserve_topology;
+    double tolerance;
+    sqlite3_stmt *stmt;
+    if (!qmbr_check_column (sqlite, table, column, &p_table, &p_column))
+	return 0;
+    sql = sqlite3_mprintf ("SELECT spatial_index_enabled FROM geometry_columns "
+			   "WHERE Upper(f_table_name) = Upper(%Q) "
+			   "AND Upper(f_geometry_column) = Upper(%Q)", table,
+			   column);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto stop;
+    if (sqlite3_step (stmt) == SQLITE_ROW)
+	enabled = sqlite3_column_int (stmt, 0);
+    sqlite3_finalize (stmt);
+
+    if (enabled == 1)
+      {
+	  /* R*Tree: discarding any pending change, then bulk loading */
+	  raw = sqlite3_mprintf ("idx_%s_%s_deferred", p_table, p_column);
+	  if (already_existing_table (sqlite, raw))
+	    {
+		xname = gaiaDoubleQuotedSql (raw);
+		sql = sqlite3_mprintf ("DELETE FROM \"%s\"", xname);
+		free (xname);
+		ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+		sqlite3_free (sql);
+		if (ret != SQLITE_OK)
+		  {
+		      sqlite3_free (raw);
+		      goto stop;
+		  }
+	    }
+	  sqlite3_free (raw);
+	  raw = sqlite3_mprintf ("idx_%s_%s", p_table, p_column);
+	  ret = rtree_bulk_truncate (sqlite, raw);
+	  sqlite3_free (raw);
+	  if (!ret)
+	      goto stop;
+	  if (buildSpatialIndexEx
+	      (sqlite, (const unsigned char *) p_table, p_column) != 0)
+	      goto stop;
+      }
+    if (enabled == 2)
+      {
+	  /* MbrCache: recreating the Virtual Table discards the cached ROWIDs */
+	  raw = sqlite3_mprintf ("cache_%s_%s", p_table, p_column);
+	  xname = gaiaDoubleQuotedSql (raw);
+	  sqlite3_free (raw);
+	  xtable = gaiaDoubleQuotedSql (p_table);
+	  xcolumn = gaiaDoubleQuotedSql (p_column);
+	  sql = sqlite3_mprintf ("DROP TABLE IF EXISTS \"%s\"; "
+				 "CREATE VIRTUAL TABLE \"%s\" "
+				 "USING MbrCache(\"%s\", \"%s\")", xname, xname,
+				 xtable, xcolumn);
+	  free (xname);
+	  free (xtable);
+	  free (xcolumn);
+	  ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+	  sqlite3_free (sql);
+	  if (ret != SQLITE_OK)
+	      goto stop;
+      }
+    raw = sqlite3_mprintf ("idx_%s_%s_qmbr", p_table, p_column);
+    ret = already_existing_table (sqlite, raw);
+    sqlite3_free (raw);
+    if (ret)
+      {
+	  /* Quantized MBR index [same quantization, grid fitted again] */
+	  if (!createQuantizedMbrIndex
+	      (sqlite, p_table, p_column,
+	       qmbr_get_bits (sqlite, p_table, p_column)))
+	      goto stop;
+      }
+    if (!pyramid_get_levels
+	(sqlite, p_table, p_column, &levels, &tolerance, &preserve_topology))
+	goto stop;
+    if (levels > 0)
+      {
+	  /* Geometry Pyramid */
+	  if (!createGeometryPyramid
+	      (sqlite, p_table, p_column, tolerance, levels,
+	       preserve_topology))
+	      goto stop;
+      }
+    ok = 1;
+
+  stop:
+    free (p_table);
+    free (p_column);
+    return ok;
+}
+
 SPATIALITE_PRIVATE int
 getRealSQLnames (void *p_sqlite, const char *table, const char *column,
 		 char **real_table, char **real_column)
@@ -155,6 +155,21 @@ struct gaia_rtree_mbr
     double maxx;
     double maxy;
 };
+
+struct gaia_rtree_geo_dist
+{
+/* a struct used by R*Tree GeometryCallback functions [geodesic distance] */
+    double lon;
+    double lat;
+    double radius;		/* meters */
+    double a;			/* the ellipsoid of the SRID */
+    double b;
+    int n_windows;		/* two windows when crossing the antimeridian */
+    double minx[2];
+    double miny[2];
+    double maxx[2];
+    double maxy[2];
+};
 #endif /* end RTree geometry callbacks */
 
 struct stddev_str
@@ -994,29 +1009,37 @@ fnct_GeometryConstraints (sqlite3_context * context, int argc,
       }
     switch (geom_type)
       {
-	  /* adjusting COMPRESSED Geometries */
+	  /* adjusting COMPRESSED / QUANTIZED Geometries */
       case GAIA_COMPRESSED_LINESTRING:
+      case GAIA_QUANTIZED_LINESTRING:
 	  geom_normalized_type = GAIA_LINESTRING;
 	  break;
       case GAIA_COMPRESSED_LINESTRINGZ:
+      case GAIA_QUANTIZED_LINESTRINGZ:
 	  geom_normalized_type = GAIA_LINESTRINGZ;
 	  break;
       case GAIA_COMPRESSED_LINESTRINGM:
+      case GAIA_QUANTIZED_LINESTRINGM:
 	  geom_normalized_type = GAIA_LINESTRINGM;
 	  break;
       case GAIA_COMPRESSED_LINESTRINGZM:
+      case GAIA_QUANTIZED_LINESTRINGZM:
 	  geom_normalized_type = GAIA_LINESTRINGZM;
 	  break;
       case GAIA_COMPRESSED_POLYGON:
+      case GAIA_QUANTIZED_POLYGON:
 	  geom_normalized_type = GAIA_POLYGON;
 	  break;
       case GAIA_COMPRESSED_POLYGONZ:
+      case GAIA_QUANTIZED_POLYGONZ:
 	  geom_normalized_type = GAIA_POLYGONZ;
 	  break;
       case GAIA_COMPRESSED_POLYGONM:
+      case GAIA_QUANTIZED_POLYGONM:
 	  geom_normalized_type = GAIA_POLYGONM;
 	  break;
       case GAIA_COMPRESSED_POLYGONZM:
+      case GAIA_QUANTIZED_POLYGONZM:
 	  geom_normalized_type = GAIA_POLYGONZM;
 	  break;
       default:
@@ -1911,6 +1934,7 @@ fnct_InitSpatialMetaData (sqlite3_context * context, int argc,
 / InitSpatialMetaData(integer transaction, text mode)
 /
 / creates the SPATIAL_REF_SYS and GEOMETRY_COLUMNS tables
+/ mode can be 'NONE' (or 'EMPTY'), 'WGS84' (or 'WGS84_ONLY') or 'LAZY'
 / returns 1 on success
 / 0 on failure
 */
@@ -1933,6 +1957,8 @@ fnct_InitSpatialMetaData (sqlite3_context * context, int argc,
 		if (strcasecmp (xmode, "WGS84") == 0
 		    || strcasecmp (xmode, "WGS84_ONLY") == 0)
 		    mode = GAIA_EPSG_WGS84_ONLY;
+		if (strcasecmp (xmode, "LAZY") == 0)
+		    mode = GAIA_EPSG_LAZY;
 	    }
 	  else if (sqlite3_value_type (argv[0]) == SQLITE_INTEGER)
 	      transaction = sqlite3_value_int (argv[0]);
@@ -1968,6 +1994,8 @@ fnct_InitSpatialMetaData (sqlite3_context * context, int argc,
 	  if (strcasecmp (xmode, "WGS84") == 0
 	      || strcasecmp (xmode, "WGS84_ONLY") == 0)
 	      mode = GAIA_EPSG_WGS84_ONLY;
+	  if (strcasecmp (xmode, "LAZY") == 0)
+	      mode = GAIA_EPSG_LAZY;
       }
 
     if (transaction)
@@ -2018,6 +2046,9 @@ fnct_InitSpatialMetaData (sqlite3_context * context, int argc,
 	  if (mode == GAIA_EPSG_NONE)
 	      updateSpatiaLiteHistory (sqlite, "spatial_ref_sys", NULL,
 				       "table successfully created [empty]");
+	  else if (mode == GAIA_EPSG_LAZY)
+	      updateSpatiaLiteHistory (sqlite, "spatial_ref_sys", NULL,
+				       "table successfully created [lazy]");
 	  else
 	      updateSpatiaLiteHistory (sqlite, "spatial_ref_sys", NULL,
 				       "table successfully populated");
@@ -2036,6 +2067,18 @@ fnct_InitSpatialMetaData (sqlite3_context * context, int argc,
     ret = sqlite3_exec (sqlite, sql, NULL, NULL, &errMsg);
     if (ret != SQLITE_OK)
 	goto error;
+/* creating the KNN VIRTUAL TABLE */
+    strcpy (sql, "CREATE VIRTUAL TABLE KNN ");
+    strcat (sql, "USING VirtualKNN()");
+    ret = sqlite3_exec (sqlite, sql, NULL, NULL, &errMsg);
+    if (ret != SQLITE_OK)
+	goto error;
+/* creating the SpatialJoin VIRTUAL TABLE */
+    strcpy (sql, "CREATE VIRTUAL TABLE SpatialJoin ");
+    strcat (sql, "USING VirtualSpatialJoin()");
+    ret = sqlite3_exec (sqlite, sql, NULL, NULL, &errMsg);
+    if (ret != SQLITE_OK)
+	goto error;
 
     if (transaction)
       {
@@ -2282,6 +2325,76 @@ fnct_CloneTable (sqlite3_context * context, int argc, sqlite3_value ** argv)
     return;
 }
 
+static void
+fnct_ClusterGeoTable (sqlite3_context * context, int argc,
+		      sqlite3_value ** argv)
+{
+/* SQL function:
+/ ClusterGeoTable(text table, text geom_column)
+/ ClusterGeoTable(text table, text geom_column, integer renumber)
+/
+/ physically rewriting a whole table in Hilbert order of the
+/ MBR centers, then rebuilding any related Spatial Index
+/ an INTEGER PRIMARY KEY is renumbered only if explicitly allowed
+/ returns 1 on success
+/ 0 on failure (NULL on invalid arguments)
+*/
+    const char *table;
+    const char *column;
+    int renumber = 0;
+    int features;
+    double gap_before;
+    double gap_after;
+    char *msg;
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) == SQLITE_TEXT)
+	table = (const char *) sqlite3_value_text (argv[0]);
+    else
+      {
+	  spatialite_e
+	      ("ClusterGeoTable() error: argument 1 [table_name] is not of the String type\n");
+	  sqlite3_result_null (context);
+	  return;
+      }
+    if (sqlite3_value_type (argv[1]) == SQLITE_TEXT)
+	column = (const char *) sqlite3_value_text (argv[1]);
+    else
+      {
+	  spatialite_e
+	      ("ClusterGeoTable() error: argument 2 [column_name] is not of the String type\n");
+	  sqlite3_result_null (context);
+	  return;
+      }
+    if (argc > 2)
+      {
+	  if (sqlite3_value_type (argv[2]) == SQLITE_INTEGER)
+	      renumber = sqlite3_value_int (argv[2]);
+	  else
+	    {
+		spatialite_e
+		    ("ClusterGeoTable() error: argument 3 [renumber] is not of the Integer type\n");
+		sqlite3_result_null (context);
+		return;
+	    }
+      }
+
+    if (!gaiaAuxClusterGeoTable
+	(sqlite, table, column, renumber, &features, &gap_before, &gap_after))
+      {
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    msg =
+	sqlite3_mprintf
+	("table successfully clustered: %d rows, average ROWID gap between "
+	 "adjacent features %1.2f before and %1.2f after", features,
+	 gap_before, gap_after);
+    updateSpatiaLiteHistory (sqlite, table, column, msg);
+    sqlite3_free (msg);
+    sqlite3_result_int (context, 1);
+}
+
 static void
 fnct_CheckGeoPackageMetaData (sqlite3_context * context, int argc,
 			      sqlite3_value ** argv)
@@ -2537,6 +2650,36 @@ fnct_InsertEpsgSrid (sqlite3_context * context, int argc, sqlite3_value ** argv)
 	sqlite3_result_int (context, 1);
 }
 
+static void
+check_srs_version (sqlite3_context * context, int argc, const void *p_cache)
+{
+/*
+/ checking whether the cached SRS definitions are still valid
+/
+/ the PRAGMAs detecting DDL and changes made by other connections cost
+/ a few microseconds, so they are only read once per statement: SQLite
+/ keeps the auxdata of constant arguments (e.g. some SRID) until the
+/ statement is reset, and discards it after each call otherwise
+/ [functions having no constant argument read them on every call]
+*/
+    int i;
+    int full = 1;
+    if (p_cache == NULL)
+	return;
+    for (i = 0; i < argc; i++)
+      {
+	  if (sqlite3_get_auxdata (context, i) != NULL)
+	      full = 0;
+      }
+    splite_check_srs_version (p_cache, sqlite3_context_db_handle (context),
+			      full);
+    if (full)
+      {
+	  for (i = 0; i < argc; i++)
+	      sqlite3_set_auxdata (context, i, (void *) p_cache, NULL);
+      }
+}
+
 static void
 fnct_SridIsGeographic (sqlite3_context * context, int argc,
 		       sqlite3_value ** argv)
@@ -2551,6 +2694,7 @@ fnct_SridIsGeographic (sqlite3_context * context, int argc,
     int ret;
     int geographic;
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    void *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
     if (sqlite3_value_type (argv[0]) == SQLITE_INTEGER)
 	srid = sqlite3_value_int (argv[0]);
@@ -2559,7 +2703,8 @@ fnct_SridIsGeographic (sqlite3_context * context, int argc,
 	  sqlite3_result_null (context);
 	  return;
       }
-    ret = srid_is_geographic (sqlite, srid, &geographic);
+    check_srs_version (context, argc, cache);
+    ret = srid_is_geographic_r (cache, sqlite, srid, &geographic);
     if (!ret)
 	sqlite3_result_null (context);
     else
@@ -2585,6 +2730,7 @@ fnct_SridIsProjected (sqlite3_context * context, int argc,
     int ret;
     int projected;
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    void *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
     if (sqlite3_value_type (argv[0]) == SQLITE_INTEGER)
 	srid = sqlite3_value_int (argv[0]);
@@ -2593,7 +2739,8 @@ fnct_SridIsProjected (sqlite3_context * context, int argc,
 	  sqlite3_result_null (context);
 	  return;
       }
-    ret = srid_is_projected (sqlite, srid, &projected);
+    check_srs_version (context, argc, cache);
+    ret = srid_is_projected_r (cache, sqlite, srid, &projected);
     if (!ret)
 	sqlite3_result_null (context);
     else
@@ -2619,6 +2766,7 @@ fnct_SridHasFlippedAxes (sqlite3_context * context, int argc,
     int ret;
     int flipped;
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    void *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
     if (sqlite3_value_type (argv[0]) == SQLITE_INTEGER)
 	srid = sqlite3_value_int (argv[0]);
@@ -2627,7 +2775,8 @@ fnct_SridHasFlippedAxes (sqlite3_context * context, int argc,
 	  sqlite3_result_null (context);
 	  return;
       }
-    ret = srid_has_flipped_axes (sqlite, srid, &flipped);
+    check_srs_version (context, argc, cache);
+    ret = srid_has_flipped_axes_r (cache, sqlite, srid, &flipped);
     if (!ret)
 	sqlite3_result_null (context);
     else
@@ -2654,6 +2803,7 @@ fnct_SridGetSpheroid (sqlite3_context * context, int argc,
     int srid;
     char *spheroid = NULL;
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    void *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
     if (sqlite3_value_type (argv[0]) == SQLITE_INTEGER)
 	srid = sqlite3_value_int (argv[0]);
@@ -2662,7 +2812,8 @@ fnct_SridGetSpheroid (sqlite3_context * context, int argc,
 	  sqlite3_result_null (context);
 	  return;
       }
-    spheroid = srid_get_spheroid (sqlite, srid);
+    check_srs_version (context, argc, cache);
+    spheroid = srid_get_spheroid_r (cache, sqlite, srid);
     if (spheroid == NULL)
 	sqlite3_result_null (context);
     else
@@ -2682,6 +2833,7 @@ fnct_SridGetPrimeMeridian (sqlite3_context * context, int argc,
     int srid;
     char *prime_meridian = NULL;
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    void *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
     if (sqlite3_value_type (argv[0]) == SQLITE_INTEGER)
 	srid = sqlite3_value_int (argv[0]);
@@ -2690,7 +2842,8 @@ fnct_SridGetPrimeMeridian (sqlite3_context * context, int argc,
 	  sqlite3_result_null (context);
 	  return;
       }
-    prime_meridian = srid_get_prime_meridian (sqlite, srid);
+    check_srs_version (context, argc, cache);
+    prime_meridian = srid_get_prime_meridian_r (cache, sqlite, srid);
     if (prime_meridian == NULL)
 	sqlite3_result_null (context);
     else
@@ -2711,6 +2864,7 @@ fnct_SridGetProjection (sqlite3_context * context, int argc,
     int srid;
     char *projection = NULL;
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    void *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
     if (sqlite3_value_type (argv[0]) == SQLITE_INTEGER)
 	srid = sqlite3_value_int (argv[0]);
@@ -2719,7 +2873,8 @@ fnct_SridGetProjection (sqlite3_context * context, int argc,
 	  sqlite3_result_null (context);
 	  return;
       }
-    projection = srid_get_projection (sqlite, srid);
+    check_srs_version (context, argc, cache);
+    projection = srid_get_projection_r (cache, sqlite, srid);
     if (projection == NULL)
 	sqlite3_result_null (context);
     else
@@ -2738,6 +2893,7 @@ fnct_SridGetDatum (sqlite3_context * context, int argc, sqlite3_value ** argv)
     int srid;
     char *datum = NULL;
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    void *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
     if (sqlite3_value_type (argv[0]) == SQLITE_INTEGER)
 	srid = sqlite3_value_int (argv[0]);
@@ -2746,7 +2902,8 @@ fnct_SridGetDatum (sqlite3_context * context, int argc, sqlite3_value ** argv)
 	  sqlite3_result_null (context);
 	  return;
       }
-    datum = srid_get_datum (sqlite, srid);
+    check_srs_version (context, argc, cache);
+    datum = srid_get_datum_r (cache, sqlite, srid);
     if (datum == NULL)
 	sqlite3_result_null (context);
     else
@@ -2765,6 +2922,7 @@ fnct_SridGetUnit (sqlite3_context * context, int argc, sqlite3_value ** argv)
     int srid;
     char *unit = NULL;
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    void *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
     if (sqlite3_value_type (argv[0]) == SQLITE_INTEGER)
 	srid = sqlite3_value_int (argv[0]);
@@ -2773,7 +2931,8 @@ fnct_SridGetUnit (sqlite3_context * context, int argc, sqlite3_value ** argv)
 	  sqlite3_result_null (context);
 	  return;
       }
-    unit = srid_get_unit (sqlite, srid);
+    check_srs_version (context, argc, cache);
+    unit = srid_get_unit_r (cache, sqlite, srid);
     if (unit == NULL)
 	sqlite3_result_null (context);
     else
@@ -2788,6 +2947,7 @@ common_srid_axis (sqlite3_context * context, int argc,
     int srid;
     char *result = NULL;
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    void *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
     if (sqlite3_value_type (argv[0]) == SQLITE_INTEGER)
 	srid = sqlite3_value_int (argv[0]);
@@ -2796,7 +2956,8 @@ common_srid_axis (sqlite3_context * context, int argc,
 	  sqlite3_result_null (context);
 	  return;
       }
-    result = srid_get_axis (sqlite, srid, axis, mode);
+    check_srs_version (context, argc, cache);
+    result = srid_get_axis_r (cache, sqlite, srid, axis, mode);
     if (result == NULL)
 	sqlite3_result_null (context);
     else
@@ -3392,6 +3553,9 @@ fnct_AddGeometryColumn (sqlite3_context * context, int argc,
 	  sqlite3_free (p_table);
 	  return;
       }
+/* inserting on demand the EPSG def into a "lazy" spatial_ref_sys */
+    if (srid > 0)
+	epsg_materialize_srid (sqlite, srid);
 /* ok, inserting into geometry_columns [Spatial Metadata] */
     if (metadata_version == 1)
       {
@@ -4226,6 +4390,9 @@ fnct_RecoverGeometryColumn (sqlite3_context * context, int argc,
 	  goto error;
       }
     sqlite3_finalize (stmt);
+/* inserting on demand the EPSG def into a "lazy" spatial_ref_sys */
+    if (srid > 0)
+	epsg_materialize_srid (sqlite, srid);
 
     if (metadata_version == 1)
       {
@@ -4829,6 +4996,66 @@ fnct_DiscardGeometryColumn (sqlite3_context * context, int argc,
     free (quoted);
     ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, &errMsg);
     sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	goto error;
+    raw = sqlite3_mprintf ("qmi_%s_%s", p_table, p_column);
+    quoted = gaiaDoubleQuotedSql (raw);
+    sqlite3_free (raw);
+    sql_statement =
+	sqlite3_mprintf ("DROP TRIGGER IF EXISTS main.\"%s\"", quoted);
+    free (quoted);
+    ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, &errMsg);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	goto error;
+    raw = sqlite3_mprintf ("qmu_%s_%s", p_table, p_column);
+    quoted = gaiaDoubleQuotedSql (raw);
+    sqlite3_free (raw);
+    sql_statement =
+	sqlite3_mprintf ("DROP TRIGGER IF EXISTS main.\"%s\"", quoted);
+    free (quoted);
+    ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, &errMsg);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	goto error;
+    raw = sqlite3_mprintf ("qmd_%s_%s", p_table, p_column);
+    quoted = gaiaDoubleQuotedSql (raw);
+    sqlite3_free (raw);
+    sql_statement =
+	sqlite3_mprintf ("DROP TRIGGER IF EXISTS main.\"%s\"", quoted);
+    free (quoted);
+    ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, &errMsg);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	goto error;
+    raw = sqlite3_mprintf ("pyi_%s_%s", p_table, p_column);
+    quoted = gaiaDoubleQuotedSql (raw);
+    sqlite3_free (raw);
+    sql_statement =
+	sqlite3_mprintf ("DROP TRIGGER IF EXISTS main.\"%s\"", quoted);
+    free (quoted);
+    ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, &errMsg);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	goto error;
+    raw = sqlite3_mprintf ("pyu_%s_%s", p_table, p_column);
+    quoted = gaiaDoubleQuotedSql (raw);
+    sqlite3_free (raw);
+    sql_statement =
+	sqlite3_mprintf ("DROP TRIGGER IF EXISTS main.\"%s\"", quoted);
+    free (quoted);
+    ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, &errMsg);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	goto error;
+    raw = sqlite3_mprintf ("pyd_%s_%s", p_table, p_column);
+    quoted = gaiaDoubleQuotedSql (raw);
+    sqlite3_free (raw);
+    sql_statement =
+	sqlite3_mprintf ("DROP TRIGGER IF EXISTS main.\"%s\"", quoted);
+    free (quoted);
+    ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, &errMsg);
+    sqlite3_free (sql_statement);
     if (ret != SQLITE_OK)
 	goto error;
 
@@ -4875,6 +5102,20 @@ fnct_DiscardGeometryColumn (sqlite3_context * context, int argc,
 	goto error;
     /* end deletion old versions [v2.0, v2.2] triggers[if any] */
 
+/* removing the quantization settings [if any] */
+    if (!dropGeometryQuantization (sqlite, p_table, p_column))
+      {
+	  errMsg = sqlite3_mprintf ("%s", sqlite3_errmsg (sqlite));
+	  goto error;
+      }
+
+/* removing the Geometry Pyramid levels [if any] */
+    if (!discardGeometryPyramid (sqlite, p_table, p_column))
+      {
+	  errMsg = sqlite3_mprintf ("%s", sqlite3_errmsg (sqlite));
+	  goto error;
+      }
+
     sqlite3_result_int (context, 1);
     updateSpatiaLiteHistory (sqlite, p_table,
 			     p_column, "Geometry successfully discarded");
@@ -5922,6 +6163,14 @@ check_spatial_index (sqlite3 * sqlite, const unsigned char *table,
     if (!is_defined)
 	goto err_label;
 
+/* applying any deferred change before comparing */
+    if (checkSpatialMetaData (sqlite) == 3)
+      {
+	  if (!flushDeferredSpatialIndex
+	      (sqlite, (const char *) table, (const char *) geom))
+	      goto err_label;
+      }
+
     xgeom = gaiaDoubleQuotedSql ((char *) geom);
     xtable = gaiaDoubleQuotedSql ((char *) table);
     idx_name = sqlite3_mprintf ("idx_%s_%s", table, geom);
@@ -6300,6 +6549,22 @@ recover_spatial_index (sqlite3 * sqlite, const unsigned char *table,
     sqlite3_free (sql_statement);
     if (ret != SQLITE_OK)
 	goto error;
+/* discarding any deferred change [superseded by the rebuild] */
+    idx_name = sqlite3_mprintf ("idx_%s_%s_deferred", table, geom);
+    if (already_existing_table (sqlite, idx_name))
+      {
+	  xidx_name = gaiaDoubleQuotedSql (idx_name);
+	  sql_statement = sqlite3_mprintf ("DELETE FROM \"%s\"", xidx_name);
+	  free (xidx_name);
+	  ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, &errMsg);
+	  sqlite3_free (sql_statement);
+	  if (ret != SQLITE_OK)
+	    {
+		sqlite3_free (idx_name);
+		goto error;
+	    }
+      }
+    sqlite3_free (idx_name);
 /* populating the R*Tree table from scratch */
     status = buildSpatialIndexEx (sqlite, table, (const char *) geom);
     if (status == 0)
@@ -6878,6 +7143,439 @@ fnct_DisableSpatialIndex (sqlite3_context * context, int argc,
     return;
 }
 
+static void
+fnct_SetDeferredSpatialIndex (sqlite3_context * context, int argc,
+			      sqlite3_value ** argv)
+{
+/* SQL function:
+/ SetDeferredSpatialIndex(table, column, mode )
+/
+/ enables (mode = TRUE) or disables (mode = FALSE) the deferred
+/ maintenance of a SpatialIndex based on Column and Table
+/ returns 1 on success
+/ 0 on failure
+*/
+    const char *table;
+    const char *column;
+    int mode;
+    char sql[1024];
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("SetDeferredSpatialIndex() error: argument 1 [table_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    table = (const char *) sqlite3_value_text (argv[0]);
+    if (sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("SetDeferredSpatialIndex() error: argument 2 [column_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    column = (const char *) sqlite3_value_text (argv[1]);
+    if (sqlite3_value_type (argv[2]) != SQLITE_INTEGER)
+      {
+	  spatialite_e
+	      ("SetDeferredSpatialIndex() error: argument 3 [mode] is not of the Integer type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    mode = sqlite3_value_int (argv[2]);
+
+    if (!setDeferredSpatialIndex (sqlite, table, column, mode))
+      {
+	  spatialite_e
+	      ("SetDeferredSpatialIndex() error: either \"%s\".\"%s\" isn't a Geometry column or no SpatialIndex is defined\n",
+	       table, column);
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    sqlite3_result_int (context, 1);
+    if (mode)
+	strcpy (sql, "SpatialIndex: deferred maintenance enabled");
+    else
+	strcpy (sql, "SpatialIndex: deferred maintenance disabled");
+    updateSpatiaLiteHistory (sqlite, table, column, sql);
+}
+
+static void
+fnct_FlushDeferredSpatialIndex (sqlite3_context * context, int argc,
+				sqlite3_value ** argv)
+{
+/* SQL function:
+/ FlushDeferredSpatialIndex(table, column )
+/
+/ applies to a SpatialIndex based on Column and Table
+/ all changes pending since deferred maintenance was enabled
+/ returns 1 on success
+/ 0 on failure
+*/
+    const char *table;
+    const char *column;
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("FlushDeferredSpatialIndex() error: argument 1 [table_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    table = (const char *) sqlite3_value_text (argv[0]);
+    if (sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("FlushDeferredSpatialIndex() error: argument 2 [column_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    column = (const char *) sqlite3_value_text (argv[1]);
+    sqlite3_result_int (context,
+			flushDeferredSpatialIndex (sqlite, table, column));
+}
+
+static void
+fnct_CreateQuantizedMbrIndex (sqlite3_context * context, int argc,
+			      sqlite3_value ** argv)
+{
+/* SQL function:
+/ CreateQuantizedMbrIndex(table, column )
+/ CreateQuantizedMbrIndex(table, column, bits )
+/
+/ creates (or rebuilds) a Quantized MBR index based on Column and Table
+/ Bits can be 32 (FLOAT MBRs, default) or 16 (INT16 grid cells)
+/ returns 1 on success
+/ 0 on failure
+*/
+    const char *table;
+    const char *column;
+    int bits = 32;
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("CreateQuantizedMbrIndex() error: argument 1 [table_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    table = (const char *) sqlite3_value_text (argv[0]);
+    if (sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("CreateQuantizedMbrIndex() error: argument 2 [column_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    column = (const char *) sqlite3_value_text (argv[1]);
+    if (argc == 3)
+      {
+	  if (sqlite3_value_type (argv[2]) != SQLITE_INTEGER)
+	    {
+		spatialite_e
+		    ("CreateQuantizedMbrIndex() error: argument 3 [bits] is not of the Integer type\n");
+		sqlite3_result_int (context, 0);
+		return;
+	    }
+	  bits = sqlite3_value_int (argv[2]);
+	  if (bits != 16 && bits != 32)
+	    {
+		spatialite_e
+		    ("CreateQuantizedMbrIndex() error: argument 3 [bits] must be 16 or 32\n");
+		sqlite3_result_int (context, 0);
+		return;
+	    }
+      }
+    if (!createQuantizedMbrIndex (sqlite, table, column, bits))
+      {
+	  spatialite_e
+	      ("CreateQuantizedMbrIndex() error: either \"%s\".\"%s\" isn't a Geometry column or the index could not be built\n",
+	       table, column);
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    sqlite3_result_int (context, 1);
+    updateSpatiaLiteHistory (sqlite, table, column,
+			     "Quantized MBR index successfully created");
+}
+
+static void
+fnct_DisableQuantizedMbrIndex (sqlite3_context * context, int argc,
+			       sqlite3_value ** argv)
+{
+/* SQL function:
+/ DisableQuantizedMbrIndex(table, column )
+/
+/ removes the Quantized MBR index based on Column and Table
+/ returns 1 on success
+/ 0 on failure
+*/
+    const char *table;
+    const char *column;
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("DisableQuantizedMbrIndex() error: argument 1 [table_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    table = (const char *) sqlite3_value_text (argv[0]);
+    if (sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("DisableQuantizedMbrIndex() error: argument 2 [column_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    column = (const char *) sqlite3_value_text (argv[1]);
+    if (!disableQuantizedMbrIndex (sqlite, table, column))
+      {
+	  spatialite_e
+	      ("DisableQuantizedMbrIndex() error: either \"%s\".\"%s\" isn't a Geometry column or no Quantized MBR index is defined\n",
+	       table, column);
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    sqlite3_result_int (context, 1);
+    updateSpatiaLiteHistory (sqlite, table, column,
+			     "Quantized MBR index successfully removed");
+}
+
+static void
+fnct_SetQuantizedMbr (sqlite3_context * context, int argc,
+		      sqlite3_value ** argv)
+{
+/* SQL function:
+/ SetQuantizedMbr(block BLOB, rowid INTEGER, geom BLOB)
+/ SetQuantizedMbr(block BLOB, rowid INTEGER, geom BLOB, grid BLOB)
+/
+/ internal helper called by the Quantized MBR index triggers:
+/ returns a copy of the index block (a new empty block if NULL:
+/ FLOAT items, or INT16 items on Grid if specified)
+/ storing the MBR of Geom (or clearing the item if Geom is NULL)
+/ in the item corresponding to ROWID
+/ or NULL if any error is encountered
+*/
+    unsigned char *block;
+    const unsigned char *p_blob = NULL;
+    const unsigned char *grid = NULL;
+    int n_bytes = 0;
+    int size;
+    sqlite3_int64 rowid;
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[1]) != SQLITE_INTEGER)
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    rowid = sqlite3_value_int64 (argv[1]);
+    if (sqlite3_value_type (argv[2]) == SQLITE_BLOB)
+      {
+	  p_blob = sqlite3_value_blob (argv[2]);
+	  n_bytes = sqlite3_value_bytes (argv[2]);
+      }
+    if (argc == 4)
+      {
+	  if (sqlite3_value_type (argv[3]) != SQLITE_BLOB
+	      || sqlite3_value_bytes (argv[3]) != GAIA_QMBR_GRID_SIZE)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+	  grid = sqlite3_value_blob (argv[3]);
+      }
+    block = malloc (GAIA_QMBR_FLOAT_BLOCK);
+    size = 0;
+    if (sqlite3_value_type (argv[0]) == SQLITE_BLOB)
+	size = sqlite3_value_bytes (argv[0]);
+    if (size == GAIA_QMBR_FLOAT_BLOCK || size == GAIA_QMBR_INT16_BLOCK)
+	memcpy (block, sqlite3_value_blob (argv[0]), size);
+    else
+	size = initQuantizedMbrBlock (block, grid);
+    setQuantizedMbr (block, size,
+		     (int) (rowid & (GAIA_QMBR_BLOCK_ITEMS - 1)), p_blob,
+		     n_bytes);
+    sqlite3_result_blob (context, block, size, free);
+}
+
+#ifndef OMIT_GEOS		/* GEOS is supported */
+
+static void
+fnct_CreateGeometryPyramid (sqlite3_context * context, int argc,
+			    sqlite3_value ** argv)
+{
+/* SQL function:
+/ CreateGeometryPyramid(table, column, tolerance, levels )
+/ CreateGeometryPyramid(table, column, tolerance, levels, 
+/                       preserve_topology )
+/
+/ creates (or rebuilds) a Geometry Pyramid based on Column and Table:
+/ the first level is simplified by Tolerance, and each further level
+/ uses a tolerance four times larger
+/ returns 1 on success
+/ 0 on failure
+*/
+    const char *table;
+    const char *column;
+    double tolerance;
+    int levels;
+    int preserve_topology = 0;
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("CreateGeometryPyramid() error: argument 1 [table_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    table = (const char *) sqlite3_value_text (argv[0]);
+    if (sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("CreateGeometryPyramid() error: argument 2 [column_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    column = (const char *) sqlite3_value_text (argv[1]);
+    if (sqlite3_value_type (argv[2]) == SQLITE_FLOAT)
+	tolerance = sqlite3_value_double (argv[2]);
+    else if (sqlite3_value_type (argv[2]) == SQLITE_INTEGER)
+	tolerance = sqlite3_value_int (argv[2]);
+    else
+      {
+	  spatialite_e
+	      ("CreateGeometryPyramid() error: argument 3 [tolerance] is not of the Numeric type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    if (sqlite3_value_type (argv[3]) != SQLITE_INTEGER)
+      {
+	  spatialite_e
+	      ("CreateGeometryPyramid() error: argument 4 [levels] is not of the Integer type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    levels = sqlite3_value_int (argv[3]);
+    if (argc == 5)
+      {
+	  if (sqlite3_value_type (argv[4]) != SQLITE_INTEGER)
+	    {
+		spatialite_e
+		    ("CreateGeometryPyramid() error: argument 5 [preserve_topology] is not of the Integer type\n");
+		sqlite3_result_int (context, 0);
+		return;
+	    }
+	  preserve_topology = sqlite3_value_int (argv[4]) ? 1 : 0;
+      }
+    if (!createGeometryPyramid
+	(sqlite, table, column, tolerance, levels, preserve_topology))
+      {
+	  spatialite_e
+	      ("CreateGeometryPyramid() error: either \"%s\".\"%s\" isn't a Geometry column or the Pyramid could not be built\n",
+	       table, column);
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    sqlite3_result_int (context, 1);
+    updateSpatiaLiteHistory (sqlite, table, column,
+			     "Geometry Pyramid successfully created");
+}
+
+static void
+fnct_DropGeometryPyramid (sqlite3_context * context, int argc,
+			  sqlite3_value ** argv)
+{
+/* SQL function:
+/ DropGeometryPyramid(table, column )
+/
+/ removes the Geometry Pyramid based on Column and Table
+/ returns 1 on success
+/ 0 on failure
+*/
+    const char *table;
+    const char *column;
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("DropGeometryPyramid() error: argument 1 [table_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    table = (const char *) sqlite3_value_text (argv[0]);
+    if (sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("DropGeometryPyramid() error: argument 2 [column_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    column = (const char *) sqlite3_value_text (argv[1]);
+    if (!dropGeometryPyramid (sqlite, table, column))
+      {
+	  spatialite_e
+	      ("DropGeometryPyramid() error: either \"%s\".\"%s\" isn't a Geometry column or no Geometry Pyramid is defined\n",
+	       table, column);
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    sqlite3_result_int (context, 1);
+    updateSpatiaLiteHistory (sqlite, table, column,
+			     "Geometry Pyramid successfully removed");
+}
+
+static void
+fnct_GeometryPyramidTable (sqlite3_context * context, int argc,
+			   sqlite3_value ** argv)
+{
+/* SQL function:
+/ GeometryPyramidTable(table, column, resolution )
+/
+/ returns the name of the table to be queried when rendering Column
+/ at the given map Resolution [map units per pixel]: the coarsest
+/ Pyramid level not exceeding such resolution, or Table itself
+/ NULL on invalid arguments or if no Geometry Pyramid is defined
+*/
+    const char *table;
+    const char *column;
+    double resolution;
+    char *name;
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT
+	|| sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    table = (const char *) sqlite3_value_text (argv[0]);
+    column = (const char *) sqlite3_value_text (argv[1]);
+    if (sqlite3_value_type (argv[2]) == SQLITE_FLOAT)
+	resolution = sqlite3_value_double (argv[2]);
+    else if (sqlite3_value_type (argv[2]) == SQLITE_INTEGER)
+	resolution = sqlite3_value_int (argv[2]);
+    else
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    name = getGeometryPyramidTable (sqlite, table, column, resolution);
+    if (name == NULL)
+	sqlite3_result_null (context);
+    else
+	sqlite3_result_text (context, name, strlen (name), sqlite3_free);
+}
+
+#endif /* end GEOS conditional */
+
 static void
 fnct_RebuildGeometryTriggers (sqlite3_context * context, int argc,
 			      sqlite3_value ** argv)
@@ -7805,8 +8503,9 @@ fnct_AsKml1 (sqlite3_context * context, int argc, sqlite3_value ** argv)
 	  else
 	    {
 		/* attempting to reproject into WGS84 */
-		getProjParams (sqlite, geo->Srid, &proj_from);
-		getProjParams (sqlite, 4326, &proj_to);
+		check_srs_version (context, argc, cache);
+		getProjParamsEx_r (cache, sqlite, geo->Srid, &proj_from, 0);
+		getProjParamsEx_r (cache, sqlite, 4326, &proj_to, 0);
 		if (proj_to == NULL || proj_from == NULL)
 		  {
 		      if (proj_from)
@@ -7986,8 +8685,9 @@ fnct_AsKml3 (sqlite3_context * context, int argc, sqlite3_value ** argv)
 	  else
 	    {
 		/* attempting to reproject into WGS84 */
-		getProjParams (sqlite, geo->Srid, &proj_from);
-		getProjParams (sqlite, 4326, &proj_to);
+		check_srs_version (context, argc, cache);
+		getProjParamsEx_r (cache, sqlite, geo->Srid, &proj_from, 0);
+		getProjParamsEx_r (cache, sqlite, 4326, &proj_to, 0);
 		if (proj_to == NULL || proj_from == NULL)
 		  {
 		      if (proj_from != NULL)
@@ -11139,13 +11839,20 @@ fnct_CompressGeometry (sqlite3_context * context, int argc,
 {
 /* SQL function:
 / CompressGeometry(BLOB encoded geometry)
+/ CompressGeometry(BLOB encoded geometry, int precision)
+/ CompressGeometry(BLOB encoded geometry, int precision, int block_size)
 /
 / returns a COMPRESSED geometry [if a valid Geometry was supplied]
 / or NULL in any other case
+/ when a precision (number of decimal digits) is set a QUANTIZED
+/ geometry will be returned; block_size (default 0 = none) enables
+/ random access to the vertices of Linestrings
 */
     unsigned char *p_blob;
     int n_bytes;
     int len;
+    int precision = -1;
+    int block_size = 0;
     unsigned char *p_result = NULL;
     gaiaGeomCollPtr geo = NULL;
     int gpkg_amphibious = 0;
@@ -11162,6 +11869,34 @@ fnct_CompressGeometry (sqlite3_context * context, int argc,
 	  sqlite3_result_null (context);
 	  return;
       }
+    if (argc >= 2)
+      {
+	  if (sqlite3_value_type (argv[1]) != SQLITE_INTEGER)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+	  precision = sqlite3_value_int (argv[1]);
+	  if (precision < 0 || precision > 15)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+      }
+    if (argc == 3)
+      {
+	  if (sqlite3_value_type (argv[2]) != SQLITE_INTEGER)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+	  block_size = sqlite3_value_int (argv[2]);
+	  if (block_size < 0)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+      }
     p_blob = (unsigned char *) sqlite3_value_blob (argv[0]);
     n_bytes = sqlite3_value_bytes (argv[0]);
     geo =
@@ -11171,8 +11906,180 @@ fnct_CompressGeometry (sqlite3_context * context, int argc,
 	sqlite3_result_null (context);
     else
       {
-	  gaiaToCompressedBlobWkb (geo, &p_result, &len);
-	  sqlite3_result_blob (context, p_result, len, free);
+	  if (precision < 0)
+	      gaiaToCompressedBlobWkb (geo, &p_result, &len);
+	  else
+	      gaiaToQuantizedBlobWkb (geo, precision, precision, precision,
+				      block_size, &p_result, &len);
+	  if (p_result == NULL)
+	      sqlite3_result_null (context);
+	  else
+	      sqlite3_result_blob (context, p_result, len, free);
+      }
+    gaiaFreeGeomColl (geo);
+}
+
+static void
+fnct_SetGeometryQuantization (sqlite3_context * context, int argc,
+			      sqlite3_value ** argv)
+{
+/* SQL function:
+/ SetGeometryQuantization(table, column, precision)
+/ SetGeometryQuantization(table, column, precision, block_size)
+/
+/ registers the precision (number of decimal digits) and block size
+/ to be used by QuantizeGeometry() for Column and Table; a NULL 
+/ precision removes them
+/ returns 1 on success
+/ 0 on failure
+*/
+    const char *table;
+    const char *column;
+    int precision;
+    int block_size = 0;
+    int ret;
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("SetGeometryQuantization() error: argument 1 [table_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    table = (const char *) sqlite3_value_text (argv[0]);
+    if (sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("SetGeometryQuantization() error: argument 2 [column_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    column = (const char *) sqlite3_value_text (argv[1]);
+    if (sqlite3_value_type (argv[2]) == SQLITE_NULL)
+      {
+	  /* removing the quantization settings */
+	  sqlite3_result_int (context,
+			      dropGeometryQuantization (sqlite, table,
+							column));
+	  return;
+      }
+    if (sqlite3_value_type (argv[2]) != SQLITE_INTEGER)
+      {
+	  spatialite_e
+	      ("SetGeometryQuantization() error: argument 3 [precision] is not of the Integer type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    precision = sqlite3_value_int (argv[2]);
+    if (argc == 4)
+      {
+	  if (sqlite3_value_type (argv[3]) != SQLITE_INTEGER)
+	    {
+		spatialite_e
+		    ("SetGeometryQuantization() error: argument 4 [block_size] is not of the Integer type\n");
+		sqlite3_result_int (context, 0);
+		return;
+	    }
+	  block_size = sqlite3_value_int (argv[3]);
+      }
+    ret =
+	setGeometryQuantization (sqlite, table, column, precision,
+				 block_size);
+    if (!ret)
+	spatialite_e
+	    ("SetGeometryQuantization() error: either \"%s\".\"%s\" isn't a Geometry column or precision/block_size are invalid\n",
+	     table, column);
+    sqlite3_result_int (context, ret);
+}
+
+static void
+fnct_GetGeometryQuantization (sqlite3_context * context, int argc,
+			      sqlite3_value ** argv)
+{
+/* SQL function:
+/ GetGeometryQuantization(table, column)
+/
+/ returns the precision registered for Column and Table
+/ or NULL if none is registered
+*/
+    int precision;
+    int block_size;
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT
+	|| sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    if (getGeometryQuantization
+	(sqlite, (const char *) sqlite3_value_text (argv[0]),
+	 (const char *) sqlite3_value_text (argv[1]), &precision,
+	 &block_size))
+	sqlite3_result_int (context, precision);
+    else
+	sqlite3_result_null (context);
+}
+
+static void
+fnct_QuantizeGeometry (sqlite3_context * context, int argc,
+		       sqlite3_value ** argv)
+{
+/* SQL function:
+/ QuantizeGeometry(table, column, BLOB encoded geometry)
+/
+/ returns a QUANTIZED geometry, using the precision and block size
+/ registered for Column and Table by SetGeometryQuantization()
+/ or NULL in any other case
+*/
+    unsigned char *p_blob;
+    int n_bytes;
+    int len;
+    int precision;
+    int block_size;
+    unsigned char *p_result = NULL;
+    gaiaGeomCollPtr geo = NULL;
+    int gpkg_amphibious = 0;
+    int gpkg_mode = 0;
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    struct splite_internal_cache *cache = sqlite3_user_data (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (cache != NULL)
+      {
+	  gpkg_amphibious = cache->gpkg_amphibious_mode;
+	  gpkg_mode = cache->gpkg_mode;
+      }
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT
+	|| sqlite3_value_type (argv[1]) != SQLITE_TEXT
+	|| sqlite3_value_type (argv[2]) != SQLITE_BLOB)
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    if (!getGeometryQuantization
+	(sqlite, (const char *) sqlite3_value_text (argv[0]),
+	 (const char *) sqlite3_value_text (argv[1]), &precision,
+	 &block_size))
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    p_blob = (unsigned char *) sqlite3_value_blob (argv[2]);
+    n_bytes = sqlite3_value_bytes (argv[2]);
+    geo =
+	gaiaFromSpatiaLiteBlobWkbEx (p_blob, n_bytes, gpkg_mode,
+				     gpkg_amphibious);
+    if (!geo)
+	sqlite3_result_null (context);
+    else
+      {
+	  gaiaToQuantizedBlobWkb (geo, precision, precision, precision,
+				  block_size, &p_result, &len);
+	  if (p_result == NULL)
+	      sqlite3_result_null (context);
+	  else
+	      sqlite3_result_blob (context, p_result, len, free);
       }
     gaiaFreeGeomColl (geo);
 }
@@ -12624,18 +13531,22 @@ fnct_GeometryType (sqlite3_context * context, int argc, sqlite3_value ** argv)
 		break;
 	    case GAIA_LINESTRING:
 	    case GAIA_COMPRESSED_LINESTRING:
+	    case GAIA_QUANTIZED_LINESTRING:
 		p_type = "LINESTRING";
 		break;
 	    case GAIA_LINESTRINGZ:
 	    case GAIA_COMPRESSED_LINESTRINGZ:
+	    case GAIA_QUANTIZED_LINESTRINGZ:
 		p_type = "LINESTRING Z";
 		break;
 	    case GAIA_LINESTRINGM:
 	    case GAIA_COMPRESSED_LINESTRINGM:
+	    case GAIA_QUANTIZED_LINESTRINGM:
 		p_type = "LINESTRING M";
 		break;
 	    case GAIA_LINESTRINGZM:
 	    case GAIA_COMPRESSED_LINESTRINGZM:
+	    case GAIA_QUANTIZED_LINESTRINGZM:
 		p_type = "LINESTRING ZM";
 		break;
 	    case GAIA_MULTILINESTRING:
@@ -12652,18 +13563,22 @@ fnct_GeometryType (sqlite3_context * context, int argc, sqlite3_value ** argv)
 		break;
 	    case GAIA_POLYGON:
 	    case GAIA_COMPRESSED_POLYGON:
+	    case GAIA_QUANTIZED_POLYGON:
 		p_type = "POLYGON";
 		break;
 	    case GAIA_POLYGONZ:
 	    case GAIA_COMPRESSED_POLYGONZ:
+	    case GAIA_QUANTIZED_POLYGONZ:
 		p_type = "POLYGON Z";
 		break;
 	    case GAIA_POLYGONM:
 	    case GAIA_COMPRESSED_POLYGONM:
+	    case GAIA_QUANTIZED_POLYGONM:
 		p_type = "POLYGON M";
 		break;
 	    case GAIA_POLYGONZM:
 	    case GAIA_COMPRESSED_POLYGONZM:
+	    case GAIA_QUANTIZED_POLYGONZM:
 		p_type = "POLYGON ZM";
 		break;
 	    case GAIA_MULTIPOLYGON:
@@ -14365,6 +15280,91 @@ fnct_RTreeDistWithin (sqlite3_rtree_geometry * p, int nCoord, double *aCoord,
 	*pRes = 0;
     return SQLITE_OK;
 }
+
+static int
+fnct_RTreeGeoDistWithin (sqlite3_rtree_geometry * p, int nCoord,
+			 double *aCoord, int *pRes)
+{
+/* R*Tree Geometry callback function:
+/ ... MATCH RTreeGeoDistWithin(double lon, double lat, double radius
+/                              [, int srid])
+/
+/ radius is measured in meters on the ellipsoid of SRID (default:
+/ 4326, WGS84); SRID is expected to be the one of the indexed Geometry
+/ and must be a geographic one. the latitude-corrected search window(s)
+/ are evaluated first, then any R*Tree node or entry whose lower bound
+/ distance exceeds radius is discarded as well
+*/
+    struct gaia_rtree_geo_dist *geo;
+    double xmin;
+    double xmax;
+    double ymin;
+    double ymax;
+    double a;
+    double b;
+    double rf;
+    int srid = 4326;
+    int i;
+
+    if (p->pUser == 0)
+      {
+	  /* first call: we must check args and then initialize the struct */
+	  if (nCoord != 4)
+	      return SQLITE_ERROR;
+	  if (p->nParam != 3 && p->nParam != 4)
+	      return SQLITE_ERROR;
+	  if (p->nParam == 4)
+	      srid = (int) p->aParam[3];
+	  if (!getEllipsoidParams (p->pContext, srid, &a, &b, &rf))
+	      return SQLITE_ERROR;	/* not a geographic SRID */
+	  geo = (struct gaia_rtree_geo_dist *) (p->pUser =
+						sqlite3_malloc (sizeof
+								(struct
+								 gaia_rtree_geo_dist)));
+	  if (!geo)
+	      return SQLITE_NOMEM;
+	  p->xDelUser = gaia_mbr_del;
+	  geo->lon = p->aParam[0];
+	  geo->lat = p->aParam[1];
+	  geo->radius = p->aParam[2];
+	  geo->a = a;
+	  geo->b = b;
+	  geo->n_windows =
+	      gaiaGeodesicSearchWindows (geo->a, geo->b, geo->lat, geo->lon,
+					 geo->radius, geo->minx, geo->miny,
+					 geo->maxx, geo->maxy);
+      }
+
+    geo = (struct gaia_rtree_geo_dist *) (p->pUser);
+    xmin = aCoord[0];
+    xmax = aCoord[1];
+    ymin = aCoord[2];
+    ymax = aCoord[3];
+    *pRes = 0;
+/* evaluating Intersects relationship against the search windows */
+    for (i = 0; i < geo->n_windows; i++)
+      {
+	  if (xmin > geo->maxx[i])
+	      continue;
+	  if (xmax < geo->minx[i])
+	      continue;
+	  if (ymin > geo->maxy[i])
+	      continue;
+	  if (ymax < geo->miny[i])
+	      continue;
+	  *pRes = 1;
+	  break;
+      }
+    if (*pRes)
+      {
+	  /* pruning by lower bound distance */
+	  if (gaiaGeodesicMbrMinDistance
+	      (geo->a, geo->b, geo->lat, geo->lon, xmin, ymin, xmax,
+	       ymax) > geo->radius)
+	      *pRes = 0;
+      }
+    return SQLITE_OK;
+}
 #endif /* end RTree geometry callbacks */
 
 static void
@@ -14658,6 +15658,21 @@ point_n (sqlite3_context * context, int argc, sqlite3_value ** argv,
 	vertex = 1;		/* StartPoint() */
     p_blob = (unsigned char *) sqlite3_value_blob (argv[0]);
     n_bytes = sqlite3_value_bytes (argv[0]);
+    if (vertex != 0)
+      {
+	  /* QUANTIZED Linestrings support decoding a single vertex */
+	  result =
+	      gaiaPointNFromQuantizedBlob (p_blob, n_bytes,
+					   (vertex < 0) ? -1 : vertex - 1);
+	  if (result != NULL)
+	    {
+		gaiaToSpatiaLiteBlobWkbEx (result, &p_result, &len,
+					   gpkg_mode);
+		gaiaFreeGeomColl (result);
+		sqlite3_result_blob (context, p_result, len, free);
+		return;
+	    }
+      }
     geo =
 	gaiaFromSpatiaLiteBlobWkbEx (p_blob, n_bytes, gpkg_mode,
 				     gpkg_amphibious);
@@ -18541,6 +19556,138 @@ fnct_LocateBetweenMeasures (sqlite3_context * context, int argc,
 
 #ifndef OMIT_PROJ		/* including PROJ.4 */
 
+static struct splite_proj_cache_item *
+find_proj_pair_cached (struct splite_internal_cache *cache, sqlite3 * sqlite,
+		       int srid_from, int srid_to, int gpkg_amphibious)
+{
+/*
+/ retrieving an initialized PROJ.4 pair from the per-connection cache
+/
+/ a cached SRID pair is trusted as long as the SRS generation hasn't
+/ moved (see check_srs_version); otherwise both definitions are read
+/ again from spatial_ref_sys and the cached pair is discarded if they
+/ changed
+*/
+    char *proj_from = NULL;
+    char *proj_to = NULL;
+    struct splite_proj_cache_item *item =
+	splite_find_proj_cache_item (cache, srid_from, srid_to,
+				     gpkg_amphibious);
+    if (item != NULL && item->generation != cache->srsGeneration)
+      {
+	  /* validating the cached SRID pair */
+	  getProjParamsEx_r (cache, sqlite, srid_from, &proj_from,
+			     gpkg_amphibious);
+	  getProjParamsEx_r (cache, sqlite, srid_to, &proj_to,
+			     gpkg_amphibious);
+	  if (proj_from != NULL && proj_to != NULL
+	      && strcmp (proj_from, item->proj_from) == 0
+	      && strcmp (proj_to, item->proj_to) == 0)
+	      item->generation = cache->srsGeneration;
+	  else
+	      item = NULL;
+      }
+    if (item != NULL)
+	cache->projCacheHits += 1;
+    else
+      {
+	  /* initializing and caching a new SRID pair */
+	  cache->projCacheMisses += 1;
+	  if (proj_from == NULL)
+	      getProjParamsEx_r (cache, sqlite, srid_from, &proj_from,
+				 gpkg_amphibious);
+	  if (proj_to == NULL)
+	      getProjParamsEx_r (cache, sqlite, srid_to, &proj_to,
+				 gpkg_amphibious);
+	  if (proj_from != NULL && proj_to != NULL)
+	      item =
+		  splite_store_proj_cache_item (cache, srid_from, srid_to,
+						gpkg_amphibious, proj_from,
+						proj_to, cache->srsGeneration);
+      }
+    if (proj_from != NULL)
+	free (proj_from);
+    if (proj_to != NULL)
+	free (proj_to);
+    return item;
+}
+
+static gaiaGeomCollPtr
+transform_cached (struct splite_internal_cache *cache, sqlite3 * sqlite,
+		  gaiaGeomCollPtr geo, int srid_from, int srid_to,
+		  int gpkg_amphibious)
+{
+/* reprojecting a Geometry by using the per-connection PROJ.4 cache */
+    struct splite_proj_cache_item *item =
+	find_proj_pair_cached (cache, sqlite, srid_from, srid_to,
+			       gpkg_amphibious);
+    if (item == NULL)
+	return NULL;
+    return splite_transform_proj_cache_item (item, geo);
+}
+
+static void
+fnct_PROJ_GetCacheHits (sqlite3_context * context, int argc,
+			sqlite3_value ** argv)
+{
+/* SQL function:
+/ PROJ_GetCacheHits()
+/
+/ returns the number of Transform() calls served by an already 
+/ initialized PROJ.4 pair since the last PROJ_ResetCache()
+/ or NULL if no connection cache is available
+*/
+    struct splite_internal_cache *cache = sqlite3_user_data (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (cache == NULL)
+	sqlite3_result_null (context);
+    else
+	sqlite3_result_int64 (context, cache->projCacheHits);
+}
+
+static void
+fnct_PROJ_GetCacheMisses (sqlite3_context * context, int argc,
+			  sqlite3_value ** argv)
+{
+/* SQL function:
+/ PROJ_GetCacheMisses()
+/
+/ returns the number of Transform() calls requiring to initialize
+/ a PROJ.4 pair since the last PROJ_ResetCache()
+/ or NULL if no connection cache is available
+*/
+    struct splite_internal_cache *cache = sqlite3_user_data (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (cache == NULL)
+	sqlite3_result_null (context);
+    else
+	sqlite3_result_int64 (context, cache->projCacheMisses);
+}
+
+static void
+fnct_PROJ_ResetCache (sqlite3_context * context, int argc,
+		      sqlite3_value ** argv)
+{
+/* SQL function:
+/ PROJ_ResetCache()
+/
+/ discards all the cached PROJ.4 pairs and SRS definitions, and 
+/ resets the statistics [changes to spatial_ref_sys are detected
+/ anyway, this is only useful to measure the cache from scratch]
+/ returns 1 on success, 0 if no connection cache is available
+*/
+    struct splite_internal_cache *cache = sqlite3_user_data (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (cache == NULL)
+      {
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    splite_reset_proj_cache (cache);
+    splite_reset_srs_catalog (cache);
+    sqlite3_result_int (context, 1);
+}
+
 static void
 fnct_Transform (sqlite3_context * context, int argc, sqlite3_value ** argv)
 {
@@ -18591,8 +19738,19 @@ fnct_Transform (sqlite3_context * context, int argc, sqlite3_value ** argv)
     else
       {
 	  srid_from = geo->Srid;
-	  getProjParamsEx (sqlite, srid_from, &proj_from, gpkg_amphibious);
-	  getProjParamsEx (sqlite, srid_to, &proj_to, gpkg_amphibious);
+	  check_srs_version (context, argc, cache);
+	  if (cache != NULL && cache->PROJ_handle != NULL)
+	    {
+		/* using the PROJ.4 cache */
+		result =
+		    transform_cached (cache, sqlite, geo, srid_from, srid_to,
+				      gpkg_amphibious);
+		goto done;
+	    }
+	  getProjParamsEx_r (cache, sqlite, srid_from, &proj_from,
+			     gpkg_amphibious);
+	  getProjParamsEx_r (cache, sqlite, srid_to, &proj_to,
+			     gpkg_amphibious);
 	  if (proj_to == NULL || proj_from == NULL)
 	    {
 		if (proj_from)
@@ -18609,6 +19767,7 @@ fnct_Transform (sqlite3_context * context, int argc, sqlite3_value ** argv)
 	      result = gaiaTransform (geo, proj_from, proj_to);
 	  free (proj_from);
 	  free (proj_to);
+	done:
 	  if (!result)
 	      sqlite3_result_null (context);
 	  else
@@ -18625,6 +19784,332 @@ fnct_Transform (sqlite3_context * context, int argc, sqlite3_value ** argv)
     gaiaFreeGeomColl (geo);
 }
 
+#ifdef ENABLE_GCP		/* Transform approximations require ControlPoints */
+
+#define APPROX_GRID	8
+
+static struct splite_approx_cache_item *
+fit_approx_tile (struct splite_internal_cache *cache,
+		 struct splite_proj_cache_item *pair, double max_error,
+		 double minx, double miny, double size)
+{
+/*
+/ sampling the exact transform over a tile and fitting the lowest
+/ order Polynomial matching the requested error
+/
+/ the Polynomial is fitted on a regular (APPROX_GRID+1)^2 grid, then
+/ checked against the exact transform on every grid node, on the
+/ center of each grid cell and on the middle of each border edge,
+/ keeping half of the allowed error as a safety margin
+/ this only measures the error observed on such sample points: it
+/ is not a proven bound for the whole tile
+/ returns the cached tile [possibly marked as not approximable]
+/ or NULL if the exact transform fails somewhere on the tile
+*/
+    int i;
+    int j;
+    int iv;
+    int order;
+    int nfit = (APPROX_GRID + 1) * (APPROX_GRID + 1);
+    int ncheck = (APPROX_GRID * APPROX_GRID) + (4 * APPROX_GRID);
+    int count = nfit + ncheck;
+    double step = size / APPROX_GRID;
+    double x;
+    double y;
+    double *x0 = NULL;
+    double *y0;
+    double *x1;
+    double *y1;
+    gaiaGeomCollPtr sample = NULL;
+    gaiaGeomCollPtr exact = NULL;
+    gaiaGeomCollPtr approx;
+    gaiaLinestringPtr line;
+    struct splite_approx_cache_item *item = NULL;
+
+/* preparing the fitting grid first, then the check points */
+    sample = gaiaAllocGeomColl ();
+    line = gaiaAddLinestringToGeomColl (sample, count);
+    iv = 0;
+    for (j = 0; j <= APPROX_GRID; j++)
+      {
+	  for (i = 0; i <= APPROX_GRID; i++)
+	    {
+		gaiaSetPoint (line->Coords, iv, minx + (i * step),
+			      miny + (j * step));
+		iv++;
+	    }
+      }
+    for (j = 0; j < APPROX_GRID; j++)
+      {
+	  for (i = 0; i < APPROX_GRID; i++)
+	    {
+		gaiaSetPoint (line->Coords, iv, minx + ((i + 0.5) * step),
+			      miny + ((j + 0.5) * step));
+		iv++;
+	    }
+      }
+    for (i = 0; i < APPROX_GRID; i++)
+      {
+	  gaiaSetPoint (line->Coords, iv, minx + ((i + 0.5) * step), miny);
+	  iv++;
+	  gaiaSetPoint (line->Coords, iv, minx + ((i + 0.5) * step),
+			miny + size);
+	  iv++;
+	  gaiaSetPoint (line->Coords, iv, minx, miny + ((i + 0.5) * step));
+	  iv++;
+	  gaiaSetPoint (line->Coords, iv, minx + size,
+			miny + ((i + 0.5) * step));
+	  iv++;
+      }
+
+/* sampling the exact transform */
+    exact = splite_transform_proj_cache_item (pair, sample);
+    if (exact == NULL || exact->FirstLinestring == NULL
+	|| exact->FirstLinestring->Points != count)
+	goto stop;
+    x0 = malloc (sizeof (double) * count * 4);
+    if (x0 == NULL)
+	goto stop;
+    y0 = x0 + count;
+    x1 = y0 + count;
+    y1 = x1 + count;
+    for (iv = 0; iv < count; iv++)
+      {
+	  gaiaGetPoint (line->Coords, iv, &x, &y);
+	  x0[iv] = x;
+	  y0[iv] = y;
+	  gaiaGetPoint (exact->FirstLinestring->Coords, iv, &x, &y);
+	  if (x == HUGE_VAL || y == HUGE_VAL || x != x || y != y)
+	      goto stop;
+	  x1[iv] = x;
+	  y1[iv] = y;
+      }
+
+/* fitting the lowest order Polynomial matching the requested error */
+    item =
+	splite_store_approx_cache_item (cache, pair->serial, max_error, minx,
+					miny, size);
+    if (item == NULL)
+	goto stop;
+    for (order = 1; order <= 3; order++)
+      {
+	  double max_dist = 0.0;
+	  if (!splite_fit_approx_cache_item
+	      (item, nfit, x0, y0, x1, y1, order))
+	      continue;
+	  approx = splite_transform_approx_cache_item (item, sample);
+	  if (approx == NULL)
+	      continue;
+	  for (iv = 0; iv < count; iv++)
+	    {
+		/* least squares don't interpolate: the nodes are checked too */
+		double dist;
+		gaiaGetPoint (approx->FirstLinestring->Coords, iv, &x, &y);
+		dist =
+		    sqrt (((x - x1[iv]) * (x - x1[iv])) +
+			  ((y - y1[iv]) * (y - y1[iv])));
+		if (dist > max_dist)
+		    max_dist = dist;
+	    }
+	  gaiaFreeGeomColl (approx);
+	  if (max_dist <= max_error / 2.0)
+	      break;
+      }
+    if (order > 3)
+	item->order = 0;
+
+  stop:
+    if (x0 != NULL)
+	free (x0);
+    if (sample != NULL)
+	gaiaFreeGeomColl (sample);
+    if (exact != NULL)
+	gaiaFreeGeomColl (exact);
+    return item;
+}
+
+static gaiaGeomCollPtr
+transform_approx_cached (struct splite_internal_cache *cache,
+			 sqlite3 * sqlite, gaiaGeomCollPtr geo, int srid_from,
+			 int srid_to, int gpkg_amphibious, double max_error)
+{
+/*
+/ reprojecting a Geometry by using a cached Polynomial approximation
+/ of the PROJ.4 pair over some tile covering the Geometry's BBOX
+/
+/ tiles are power-of-two squares aligned on the source coords, so that
+/ nearby Geometries share the same tile: the largest one (up to 8 
+/ times the BBOX) whose sampled error meets the requested one is 
+/ fitted and cached, falling back to the exact transform when none
+/ of them does
+*/
+    int k;
+    int level;
+    double extent;
+    double size;
+    double cell_minx = 0.0;
+    double cell_miny = 0.0;
+    struct splite_approx_cache_item *approx;
+    struct splite_proj_cache_item *pair =
+	find_proj_pair_cached (cache, sqlite, srid_from, srid_to,
+			       gpkg_amphibious);
+    if (pair == NULL)
+	return NULL;
+
+    gaiaMbrGeometry (geo);
+    extent = geo->MaxX - geo->MinX;
+    if (geo->MaxY - geo->MinY > extent)
+	extent = geo->MaxY - geo->MinY;
+    if (extent > 0.0)
+      {
+	  /* the smallest aligned tile covering the BBOX */
+	  frexp (extent, &level);
+	  size = ldexp (1.0, level);
+	  for (k = 0; k <= 3; k++)
+	    {
+		cell_minx = floor (geo->MinX / size) * size;
+		cell_miny = floor (geo->MinY / size) * size;
+		if (geo->MaxX <= cell_minx + size
+		    && geo->MaxY <= cell_miny + size)
+		    break;
+		size *= 2.0;
+	    }
+	  if (k > 3)
+	    {
+		/*
+		   / the BBOX straddles a boundary shared by tiles of any size
+		   / (e.g. X or Y = 0): no aligned tile could ever cover it
+		 */
+		return splite_transform_proj_cache_item (pair, geo);
+	    }
+      }
+    else
+      {
+	  /* a single Point: only an already fitted tile could be used */
+	  size = -1.0;
+      }
+    approx =
+	splite_find_approx_cache_item (cache, pair->serial, max_error,
+				       geo->MinX, geo->MinY, geo->MaxX,
+				       geo->MaxY, cell_minx, cell_miny, size);
+    if (approx == NULL && size > 0.0)
+      {
+	  for (k = 3; k >= 0; k--)
+	    {
+		double sz = ldexp (size, k);
+		approx =
+		    fit_approx_tile (cache, pair, max_error,
+				     floor (geo->MinX / sz) * sz,
+				     floor (geo->MinY / sz) * sz, sz);
+		if (approx == NULL || approx->order > 0)
+		    break;
+		if (k > 0)
+		  {
+		      /* only the smallest tile is remembered as not approximable */
+		      approx->pair_serial = 0;
+		      approx = NULL;
+		  }
+	    }
+      }
+    if (approx != NULL && approx->order > 0)
+	return splite_transform_approx_cache_item (approx, geo);
+    return splite_transform_proj_cache_item (pair, geo);
+}
+
+#endif /* end Transform approximations */
+
+static void
+fnct_TransformApprox (sqlite3_context * context, int argc,
+		      sqlite3_value ** argv)
+{
+/* SQL function:
+/ TransformApprox(BLOBencoded geometry, srid, max_error)
+/
+/ same as Transform(), but for bulk reprojection of small extents
+/ (e.g. map tiles): the transform is approximated by a Polynomial
+/ fitted over a tile covering the geometry, and cached for the next
+/ geometries falling on the same tile
+/ max_error is measured in the units of the target SRID, and is 
+/ checked against the exact transform on sample points of the tile:
+/ it is the largest observed error, not a guaranteed bound for every
+/ vertex; the exact transform is used whenever it can't be met
+/ returns NULL if any error is encountered
+*/
+    unsigned char *p_blob;
+    int n_bytes;
+    gaiaGeomCollPtr geo = NULL;
+    gaiaGeomCollPtr result;
+    int srid_to;
+    double max_error;
+    int gpkg_amphibious = 0;
+    int gpkg_mode = 0;
+    struct splite_internal_cache *cache = sqlite3_user_data (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_BLOB
+	|| sqlite3_value_type (argv[1]) != SQLITE_INTEGER)
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    if (sqlite3_value_type (argv[2]) == SQLITE_FLOAT)
+	max_error = sqlite3_value_double (argv[2]);
+    else if (sqlite3_value_type (argv[2]) == SQLITE_INTEGER)
+	max_error = sqlite3_value_int (argv[2]);
+    else
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    if (!(max_error > 0.0))
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+#ifdef ENABLE_GCP		/* Transform approximations require ControlPoints */
+    if (cache == NULL || cache->PROJ_handle == NULL)
+#endif
+      {
+	  /* no cache available: always using the exact transform */
+	  fnct_Transform (context, 2, argv);
+	  return;
+      }
+    gpkg_amphibious = cache->gpkg_amphibious_mode;
+    gpkg_mode = cache->gpkg_mode;
+    p_blob = (unsigned char *) sqlite3_value_blob (argv[0]);
+    n_bytes = sqlite3_value_bytes (argv[0]);
+    srid_to = sqlite3_value_int (argv[1]);
+    geo =
+	gaiaFromSpatiaLiteBlobWkbEx (p_blob, n_bytes, gpkg_mode,
+				     gpkg_amphibious);
+    if (!geo)
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+#ifdef ENABLE_GCP
+    check_srs_version (context, argc, cache);
+    result =
+	transform_approx_cached (cache, sqlite3_context_db_handle (context),
+				 geo, geo->Srid, srid_to, gpkg_amphibious,
+				 max_error);
+#else
+    result = NULL;
+#endif
+    if (!result)
+	sqlite3_result_null (context);
+    else
+      {
+	  /* builds the BLOB geometry to be returned */
+	  int len;
+	  unsigned char *p_result = NULL;
+	  result->Srid = srid_to;
+	  gaiaToSpatiaLiteBlobWkbEx (result, &p_result, &len, gpkg_mode);
+	  sqlite3_result_blob (context, p_result, len, free);
+	  gaiaFreeGeomColl (result);
+      }
+    gaiaFreeGeomColl (geo);
+}
+
 #endif /* end including PROJ.4 */
 
 #ifndef OMIT_GEOS		/* including GEOS */
@@ -19159,7 +20644,9 @@ length_common (const void *p_cache, sqlite3_context * context, int argc,
 	  if (use_ellipsoid >= 0)
 	    {
 		/* attempting to identify the corresponding ellipsoid */
-		if (getEllipsoidParams (sqlite, geo->Srid, &a, &b, &rf))
+		check_srs_version (context, argc, cache);
+		if (getEllipsoidParams_r (cache, sqlite, geo->Srid,
+					  &a, &b, &rf))
 		  {
 		      double l;
 		      int ib;
@@ -19414,7 +20901,9 @@ fnct_Area (sqlite3_context * context, int argc, sqlite3_value ** argv)
 	    {
 #ifdef ENABLE_LWGEOM		/* only if LWGEOM is enabled */
 		/* attempting to identify the corresponding ellipsoid */
-		if (getEllipsoidParams (sqlite, geo->Srid, &a, &b, &rf))
+		check_srs_version (context, argc, cache);
+		if (getEllipsoidParams_r (cache, sqlite, geo->Srid,
+					  &a, &b, &rf))
 		    ret = gaiaGeodesicArea (geo, a, b, use_ellipsoid, &area);
 		else
 		    ret = 0;
@@ -20954,7 +22443,9 @@ fnct_Distance (sqlite3_context * context, int argc, sqlite3_value ** argv)
 	  if (use_ellipsoid >= 0)
 	    {
 		/* attempting to identify the corresponding ellipsoid */
-		if (getEllipsoidParams (sqlite, geo1->Srid, &a, &b, &rf))
+		check_srs_version (context, argc, cache);
+		if (getEllipsoidParams_r (cache, sqlite, geo1->Srid,
+					  &a, &b, &rf))
 		  {
 		      gaiaGeomCollPtr shortest;
 		      if (data != NULL)
@@ -21224,24 +22715,10 @@ fnct_PtDistWithin (sqlite3_context * context, int argc, sqlite3_value ** argv)
 		      a = 6378137.0;
 		      rf = 298.257223563;
 		      b = (a * (1.0 - (1.0 / rf)));
-		      if (use_spheroid)
-			{
-			    dist =
-				gaiaGeodesicDistance (a, b, rf, y0, x0, y1, x1);
-			    if (dist <= ref_dist)
-				sqlite3_result_int (context, 1);
-			    else
-				sqlite3_result_int (context, 0);
-			}
-		      else
-			{
-			    dist =
-				gaiaGreatCircleDistance (a, b, y0, x0, y1, x1);
-			    if (dist <= ref_dist)
-				sqlite3_result_int (context, 1);
-			    else
-				sqlite3_result_int (context, 0);
-			}
+		      ret =
+			  gaiaGeodesicDistWithin (a, b, rf, y0, x0, y1, x1,
+						  ref_dist, use_spheroid);
+		      sqlite3_result_int (context, ret);
 		      goto stop;
 		  }
 	    }
@@ -25714,7 +27191,8 @@ fnct_Azimuth (sqlite3_context * context, int argc, sqlite3_value ** argv)
       }
     gaiaFreeGeomColl (geom);
 
-    if (getEllipsoidParams (sqlite, srid, &a, &b, &rf))
+    check_srs_version (context, argc, cache);
+    if (getEllipsoidParams_r (cache, sqlite, srid, &a, &b, &rf))
       {
 	  if (gaiaEllipsoidAzimuth (x1, y1, x2, y2, a, b, &azimuth))
 	      sqlite3_result_double (context, azimuth);
@@ -25816,7 +27294,8 @@ fnct_Project (sqlite3_context * context, int argc, sqlite3_value ** argv)
       }
     srid = geom->Srid;
     gaiaFreeGeomColl (geom);
-    if (!getEllipsoidParams (sqlite, srid, &a, &b, &rf))
+    check_srs_version (context, argc, cache);
+    if (!getEllipsoidParams_r (cache, sqlite, srid, &a, &b, &rf))
       {
 	  sqlite3_result_null (context);
 	  return;
@@ -29936,6 +31415,114 @@ fnct_ExportGeoJSON (sqlite3_context * context, int argc, sqlite3_value ** argv)
 	sqlite3_result_int (context, rows);
 }
 
+static void
+fnct_ExportGeoJSON2 (sqlite3_context * context, int argc, sqlite3_value ** argv)
+{
+/* SQL function:
+/ ExportGeoJSON2(TEXT table, TEXT geom_column, TEXT filename)
+/ ExportGeoJSON2(TEXT table, TEXT geom_column, TEXT filename, 
+/                TEXT format)
+/ ExportGeoJSON2(TEXT table, TEXT geom_column, TEXT filename, 
+/                TEXT format, INT precision)
+/ ExportGeoJSON2(TEXT table, TEXT geom_column, TEXT filename, 
+/                TEXT format, INT precision, DOUBLE quantum)
+/
+/ exports a whole FeatureCollection (including all Properties)
+/ returns:
+/ the number of exported rows
+/ NULL on invalid arguments
+*/
+    int ret;
+    char *table;
+    char *geom_col;
+    char *path;
+    int format = 0;
+    int precision = 8;
+    double quantum = 0.0;
+    char *fmt = NULL;
+    int rows;
+    sqlite3 *db_handle = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT)
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    table = (char *) sqlite3_value_text (argv[0]);
+    if (sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    geom_col = (char *) sqlite3_value_text (argv[1]);
+    if (sqlite3_value_type (argv[2]) != SQLITE_TEXT)
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    path = (char *) sqlite3_value_text (argv[2]);
+    if (argc > 3)
+      {
+	  if (sqlite3_value_type (argv[3]) != SQLITE_TEXT)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+	  else
+	    {
+		fmt = (char *) sqlite3_value_text (argv[3]);
+		if (strcasecmp (fmt, "none") == 0)
+		    format = 0;
+		else if (strcasecmp (fmt, "MBR") == 0)
+		    format = 1;
+		else if (strcasecmp (fmt, "withShortCRS") == 0)
+		    format = 2;
+		else if (strcasecmp (fmt, "MBRwithShortCRS") == 0)
+		    format = 3;
+		else if (strcasecmp (fmt, "withLongCRS") == 0)
+		    format = 4;
+		else if (strcasecmp (fmt, "MBRwithLongCRS") == 0)
+		    format = 5;
+		else
+		  {
+		      sqlite3_result_null (context);
+		      return;
+		  }
+	    }
+      }
+    if (argc > 4)
+      {
+	  if (sqlite3_value_type (argv[4]) != SQLITE_INTEGER)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+	  else
+	      precision = sqlite3_value_int (argv[4]);
+      }
+    if (argc > 5)
+      {
+	  if (sqlite3_value_type (argv[5]) == SQLITE_FLOAT)
+	      quantum = sqlite3_value_double (argv[5]);
+	  else if (sqlite3_value_type (argv[5]) == SQLITE_INTEGER)
+	      quantum = sqlite3_value_int (argv[5]);
+	  else
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+      }
+
+    ret =
+	dump_geojson2 (db_handle, table, geom_col, path, precision, format,
+		       quantum, &rows);
+
+    if (rows < 0 || !ret)
+	sqlite3_result_null (context);
+    else
+	sqlite3_result_int (context, rows);
+}
+
 #ifdef ENABLE_LIBXML2		/* including LIBXML2 */
 static void
 wfs_page_done (int features, void *ptr)
@@ -30141,7 +31728,8 @@ fnct_GeodesicLength (sqlite3_context * context, int argc, sqlite3_value ** argv)
 	sqlite3_result_null (context);
     else
       {
-	  if (getEllipsoidParams (sqlite, geo->Srid, &a, &b, &rf))
+	  check_srs_version (context, argc, cache);
+	  if (getEllipsoidParams_r (cache, sqlite, geo->Srid, &a, &b, &rf))
 	    {
 		line = geo->FirstLinestring;
 		while (line)
@@ -30253,7 +31841,8 @@ fnct_GreatCircleLength (sqlite3_context * context, int argc,
 	sqlite3_result_null (context);
     else
       {
-	  if (getEllipsoidParams (sqlite, geo->Srid, &a, &b, &rf))
+	  check_srs_version (context, argc, cache);
+	  if (getEllipsoidParams_r (cache, sqlite, geo->Srid, &a, &b, &rf))
 	    {
 		line = geo->FirstLinestring;
 		while (line)
@@ -30302,6 +31891,205 @@ fnct_GreatCircleLength (sqlite3_context * context, int argc,
       }
 }
 
+static double *
+distance_matrix_points (gaiaGeomCollPtr geo, int *count)
+{
+/* extracting an XY array from a POINT / MULTIPOINT */
+    int n = 0;
+    double *coords;
+    gaiaPointPtr pt;
+    *count = 0;
+    if (geo->FirstLinestring != NULL || geo->FirstPolygon != NULL)
+	return NULL;
+    pt = geo->FirstPoint;
+    while (pt)
+      {
+	  n++;
+	  pt = pt->Next;
+      }
+    if (n == 0)
+	return NULL;
+    coords = malloc (sizeof (double) * n * 2);
+    if (coords == NULL)
+	return NULL;
+    n = 0;
+    pt = geo->FirstPoint;
+    while (pt)
+      {
+	  coords[n * 2] = pt->X;
+	  coords[(n * 2) + 1] = pt->Y;
+	  n++;
+	  pt = pt->Next;
+      }
+    *count = n;
+    return coords;
+}
+
+static void
+distance_matrix_common (sqlite3_context * context, sqlite3_value ** argv,
+			int geodesic)
+{
+/* common implementation: GeodesicDistanceMatrix / GreatCircleDistanceMatrix */
+    unsigned char *p_blob;
+    int n_bytes;
+    double a;
+    double b;
+    double rf;
+    gaiaGeomCollPtr geo1 = NULL;
+    gaiaGeomCollPtr geo2 = NULL;
+    double *coords1 = NULL;
+    double *coords2 = NULL;
+    double *matrix = NULL;
+    int n1;
+    int n2;
+    int i;
+    int j;
+    int ok;
+    double d;
+    char value[64];
+    gaiaOutBuffer out_buf;
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    int gpkg_amphibious = 0;
+    int gpkg_mode = 0;
+    int decimal_precision = -1;
+    struct splite_internal_cache *cache = sqlite3_user_data (context);
+    if (cache != NULL)
+      {
+	  gpkg_amphibious = cache->gpkg_amphibious_mode;
+	  gpkg_mode = cache->gpkg_mode;
+	  decimal_precision = cache->decimal_precision;
+      }
+    if (decimal_precision < 0)
+	decimal_precision = 3;
+    gaiaOutBufferInitialize (&out_buf);
+    if (sqlite3_value_type (argv[0]) != SQLITE_BLOB
+	|| sqlite3_value_type (argv[1]) != SQLITE_BLOB)
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    p_blob = (unsigned char *) sqlite3_value_blob (argv[0]);
+    n_bytes = sqlite3_value_bytes (argv[0]);
+    geo1 =
+	gaiaFromSpatiaLiteBlobWkbEx (p_blob, n_bytes, gpkg_mode,
+				     gpkg_amphibious);
+    p_blob = (unsigned char *) sqlite3_value_blob (argv[1]);
+    n_bytes = sqlite3_value_bytes (argv[1]);
+    geo2 =
+	gaiaFromSpatiaLiteBlobWkbEx (p_blob, n_bytes, gpkg_mode,
+				     gpkg_amphibious);
+    if (geo1 == NULL || geo2 == NULL)
+	goto null_result;
+    if (geo1->Srid != geo2->Srid)
+	goto null_result;
+    check_srs_version (context, 2, cache);
+    if (!getEllipsoidParams_r (cache, sqlite, geo1->Srid, &a, &b, &rf))
+	goto null_result;
+    coords1 = distance_matrix_points (geo1, &n1);
+    coords2 = distance_matrix_points (geo2, &n2);
+    if (coords1 == NULL || coords2 == NULL)
+	goto null_result;
+    if ((double) n1 * (double) n2 * 2.0 >
+	(double) sqlite3_limit (sqlite, SQLITE_LIMIT_LENGTH, -1)
+	|| (size_t) n1 > ((size_t) - 1) / sizeof (double) / (size_t) n2)
+      {
+	  /*
+	     / too many cells: the JSON text could never fit (each cell
+	     / takes at least 2 bytes), and the matrix size could overflow
+	   */
+	  goto null_result;
+      }
+    matrix = malloc (sizeof (double) * (size_t) n1 * (size_t) n2);
+    if (matrix == NULL)
+	goto null_result;
+    if (geodesic)
+      {
+	  /* a convergence failure is reported cell by cell */
+	  gaiaGeodesicDistanceMatrix (a, b, rf, coords1, n1, coords2, n2,
+				      matrix);
+      }
+    else
+      {
+	  if (!gaiaGreatCircleDistanceMatrix
+	      (a, b, coords1, n1, coords2, n2, matrix))
+	      goto null_result;
+      }
+
+/* formatting the matrix as a JSON array of rows */
+    gaiaAppendToOutBuffer (&out_buf, "[");
+    for (i = 0; i < n1; i++)
+      {
+	  gaiaAppendToOutBuffer (&out_buf, (i == 0) ? "[" : ",[");
+	  for (j = 0; j < n2; j++)
+	    {
+		d = matrix[((size_t) i * n2) + j];
+		if (d < 0.0)
+		    strcpy (value, "null");
+		else
+		    sqlite3_snprintf (sizeof (value), value, "%1.*f",
+				      decimal_precision, d);
+		if (j > 0)
+		    gaiaAppendToOutBuffer (&out_buf, ",");
+		gaiaAppendToOutBuffer (&out_buf, value);
+	    }
+	  gaiaAppendToOutBuffer (&out_buf, "]");
+      }
+    gaiaAppendToOutBuffer (&out_buf, "]");
+    ok = (out_buf.Error || out_buf.Buffer == NULL) ? 0 : 1;
+    if (!ok)
+	goto null_result;
+    sqlite3_result_text (context, out_buf.Buffer, out_buf.WriteOffset, free);
+    out_buf.Buffer = NULL;
+    goto end;
+
+  null_result:
+    sqlite3_result_null (context);
+  end:
+    if (geo1 != NULL)
+	gaiaFreeGeomColl (geo1);
+    if (geo2 != NULL)
+	gaiaFreeGeomColl (geo2);
+    if (coords1 != NULL)
+	free (coords1);
+    if (coords2 != NULL)
+	free (coords2);
+    if (matrix != NULL)
+	free (matrix);
+    gaiaOutBufferReset (&out_buf);
+}
+
+static void
+fnct_GeodesicDistanceMatrix (sqlite3_context * context, int argc,
+			     sqlite3_value ** argv)
+{
+/* SQL function:
+/ GeodesicDistanceMatrix(BLOB encoded POINT/MULTIPOINT geom1,
+/                        BLOB encoded POINT/MULTIPOINT geom2)
+/
+/ returns a JSON array (one row for each Point of geom1, one column
+/ for each Point of geom2) of Geodesic distances expressed in meters
+/ or NULL if any error is encountered
+*/
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    distance_matrix_common (context, argv, 1);
+}
+
+static void
+fnct_GreatCircleDistanceMatrix (sqlite3_context * context, int argc,
+				sqlite3_value ** argv)
+{
+/* SQL function:
+/ GreatCircleDistanceMatrix(BLOB encoded POINT/MULTIPOINT geom1,
+/                           BLOB encoded POINT/MULTIPOINT geom2)
+/
+/ returns a JSON array (one row for each Point of geom1, one column
+/ for each Point of geom2) of Great Circle distances expressed in meters
+/ or NULL if any error is encountered
+*/
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    distance_matrix_common (context, argv, 0);
+}
+
 static void
 convertUnit (sqlite3_context * context, int argc, sqlite3_value ** argv,
 	     int unit_from, int unit_to)
@@ -35715,43 +37503,43 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				fnct_InsertEpsgSrid, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SridIsGeographic", 1,
-				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_SridIsGeographic, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SridIsProjected", 1,
-				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_SridIsProjected, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SridHasFlippedAxes", 1,
-				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_SridHasFlippedAxes, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SridGetSpheroid", 1,
-				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_SridGetSpheroid, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SridGetEllipsoid", 1,
-				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_SridGetSpheroid, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SridGetPrimeMeridian", 1,
-				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_SridGetPrimeMeridian, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SridGetDatum", 1,
-				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_SridGetDatum, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SridGetProjection", 1,
-				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_SridGetProjection, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SridGetUnit", 1,
-				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_SridGetUnit, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SridGetAxis_1_Name", 1,
-				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_SridGetAxis1Name, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SridGetAxis_1_Orientation", 1,
-				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_SridGetAxis1Orientation, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SridGetAxis_2_Name", 1,
-				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_SridGetAxis2Name, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SridGetAxis_2_Orientation", 1,
-				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_SridGetAxis2Orientation, 0, 0, 0);
     sqlite3_create_function_v2 (db, "AddGeometryColumn", 4,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
@@ -35813,6 +37601,41 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
     sqlite3_create_function_v2 (db, "DisableSpatialIndex", 2,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				fnct_DisableSpatialIndex, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "SetDeferredSpatialIndex", 3,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_SetDeferredSpatialIndex, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "FlushDeferredSpatialIndex", 2,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_FlushDeferredSpatialIndex, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "CreateQuantizedMbrIndex", 2,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_CreateQuantizedMbrIndex, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "CreateQuantizedMbrIndex", 3,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_CreateQuantizedMbrIndex, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "DisableQuantizedMbrIndex", 2,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_DisableQuantizedMbrIndex, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "SetQuantizedMbr", 3,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_SetQuantizedMbr, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "SetQuantizedMbr", 4,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_SetQuantizedMbr, 0, 0, 0);
+#ifndef OMIT_GEOS		/* GEOS is supported */
+    sqlite3_create_function_v2 (db, "CreateGeometryPyramid", 4,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_CreateGeometryPyramid, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "CreateGeometryPyramid", 5,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_CreateGeometryPyramid, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "DropGeometryPyramid", 2,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_DropGeometryPyramid, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "GeometryPyramidTable", 3,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_GeometryPyramidTable, 0, 0, 0);
+#endif /* end GEOS conditional */
     sqlite3_create_function_v2 (db, "RebuildGeometryTriggers", 2,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				fnct_RebuildGeometryTriggers, 0, 0, 0);
@@ -35912,6 +37735,12 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
     sqlite3_create_function_v2 (db, "CloneTable", 14,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				fnct_CloneTable, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "ClusterGeoTable", 2,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_ClusterGeoTable, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "ClusterGeoTable", 3,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_ClusterGeoTable, 0, 0, 0);
 
 #ifndef OMIT_PROJ		/* PROJ.4 is strictly required to support KML */
     sqlite3_create_function_v2 (db, "AsKml", 1,
@@ -36351,6 +38180,24 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
     sqlite3_create_function_v2 (db, "CompressGeometry", 1,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_CompressGeometry, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "CompressGeometry", 2,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
+				fnct_CompressGeometry, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "CompressGeometry", 3,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
+				fnct_CompressGeometry, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "SetGeometryQuantization", 3,
+				SQLITE_UTF8, 0,
+				fnct_SetGeometryQuantization, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "SetGeometryQuantization", 4,
+				SQLITE_UTF8, 0,
+				fnct_SetGeometryQuantization, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "GetGeometryQuantization", 2,
+				SQLITE_UTF8, 0,
+				fnct_GetGeometryQuantization, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "QuantizeGeometry", 3,
+				SQLITE_UTF8, cache,
+				fnct_QuantizeGeometry, 0, 0, 0);
     sqlite3_create_function_v2 (db, "UncompressGeometry", 1,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_UncompressGeometry, 0, 0, 0);
@@ -37115,6 +38962,8 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
 				     fnct_RTreeIntersects, 0);
     sqlite3_rtree_geometry_callback (db, "RTreeDistWithin",
 				     fnct_RTreeDistWithin, 0);
+    sqlite3_rtree_geometry_callback (db, "RTreeGeoDistWithin",
+				     fnct_RTreeGeoDistWithin, db);
 #endif /* end RTree geometry callbacks */
 
 /* some BLOB/JPEG/EXIF functions */
@@ -37302,6 +39151,14 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
 	  sqlite3_create_function_v2 (db, "ExportGeoJSON", 5,
 				      SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				      fnct_ExportGeoJSON, 0, 0, 0);
+	  sqlite3_create_function_v2 (db, "ExportGeoJSON2", 3, SQLITE_UTF8,
+				      0, fnct_ExportGeoJSON2, 0, 0, 0);
+	  sqlite3_create_function_v2 (db, "ExportGeoJSON2", 4, SQLITE_UTF8,
+				      0, fnct_ExportGeoJSON2, 0, 0, 0);
+	  sqlite3_create_function_v2 (db, "ExportGeoJSON2", 5, SQLITE_UTF8,
+				      0, fnct_ExportGeoJSON2, 0, 0, 0);
+	  sqlite3_create_function_v2 (db, "ExportGeoJSON2", 6, SQLITE_UTF8,
+				      0, fnct_ExportGeoJSON2, 0, 0, 0);
 
 	  sqlite3_create_function_v2 (db, "eval", 1, SQLITE_UTF8, 0,
 				      fnct_EvalFunc, 0, 0, 0);
@@ -37389,6 +39246,12 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
     sqlite3_create_function_v2 (db, "GeodesicLength", 1,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_GeodesicLength, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "GreatCircleDistanceMatrix", 2,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
+				fnct_GreatCircleDistanceMatrix, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "GeodesicDistanceMatrix", 2,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
+				fnct_GeodesicDistanceMatrix, 0, 0, 0);
 
 /* some Length Unit conversion functions */
     sqlite3_create_function_v2 (db, "CvtToKm", 1,
@@ -37623,6 +39486,16 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
     sqlite3_create_function_v2 (db, "ST_Transform", 2,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_Transform, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "TransformApprox", 3, SQLITE_UTF8, cache,
+				fnct_TransformApprox, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "ST_TransformApprox", 3, SQLITE_UTF8,
+				cache, fnct_TransformApprox, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "PROJ_GetCacheHits", 0, SQLITE_UTF8,
+				cache, fnct_PROJ_GetCacheHits, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "PROJ_GetCacheMisses", 0, SQLITE_UTF8,
+				cache, fnct_PROJ_GetCacheMisses, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "PROJ_ResetCache", 0, SQLITE_UTF8,
+				cache, fnct_PROJ_ResetCache, 0, 0, 0);
 
 #endif /* end including PROJ.4 */
 
@@ -38648,9 +40521,15 @@ init_spatialite_virtualtables (void *p_db, const void *p_cache)
 /* initializing the VirtualBBox  extension */
     virtualbbox_extension_init (db, p_cache);
 /* initializing the VirtualSpatialIndex  extension */
-    virtual_spatialindex_extension_init (db);
+    virtual_spatialindex_extension_init (db, p_cache);
 /* initializing the VirtualElementary  extension */
     virtual_elementary_extension_init (db);
+/* initializing the VirtualKNN  extension */
+    virtual_knn_extension_init (db);
+/* initializing the VirtualSpatialJoin  extension */
+    virtual_spatialjoin_extension_init (db, p_cache);
+/* initializing the VirtualSpatialLayer  extension */
+    virtual_spatiallayer_extension_init (db, p_cache);
 
 #ifdef ENABLE_GEOPACKAGE	/* only if GeoPackage support is enabled */
 /* initializing the VirtualFDO  extension */
@@ -38730,6 +40609,12 @@ spatialite_splash_screen (int verbose)
 		    ("\t- 'VirtualSpatialIndex'\t[R*Tree metahandler]\n");
 		spatialite_i
 		    ("\t- 'VirtualElementary'\t[ElemGeoms metahandler]\n");
+		spatialite_i
+		    ("\t- 'VirtualKNN'\t\t[K-Nearest Neighbours metahandler]\n");
+		spatialite_i
+		    ("\t- 'VirtualSpatialJoin'\t[R*Tree Spatial Join metahandler]\n");
+		spatialite_i
+		    ("\t- 'VirtualSpatialLayer'\t[index-aware Spatial Layer metahandler]\n");
 
 #ifdef ENABLE_LIBXML2		/* VirtualXPath is supported */
 		spatialite_i
@@ -1771,11 +1771,16 @@ getProjParamsFromSpatialReferenceSystemTable (sqlite3 * sqlite, int srid,
 		strcpy (*proj_params, proj4text);
 	    }
       }
+    sqlite3_free_table (results);
+    if (*proj_params == NULL && epsg_lazy_mode (sqlite))
+      {
+	  /* not yet inserted into a "lazy" spatial_ref_sys: built-in EPSG */
+	  *proj_params = epsg_get_proj4text (srid);
+      }
     if (*proj_params == NULL)
       {
 	  spatialite_e ("unknown SRID: %d\n", srid);
       }
-    sqlite3_free_table (results);
 }
 
 static int
@@ -1912,3 +1917,398 @@ getProjParams (void *p_sqlite, int srid, char **proj_params)
 */
     getProjParamsEx (p_sqlite, srid, proj_params, 0);
 }
+
+/*
+/ the per-connection SRS catalogue
+/
+/ SRID-dependent SQL functions are usually called once per row, always
+/ looking up the same few spatial_ref_sys definitions: each property is
+/ memoized the first time it's requested, and the whole catalogue is
+/ flushed as soon as this connection changes anything in the DB
+*/
+
+#define SRS_PROJ4TEXT		0x0001
+#define SRS_ELLIPSOID		0x0002
+#define SRS_GEOGRAPHIC		0x0004
+#define SRS_PROJECTED		0x0008
+#define SRS_FLIPPED		0x0010
+#define SRS_SPHEROID		0x0020
+#define SRS_PRIME_MERIDIAN	0x0040
+#define SRS_PROJECTION		0x0080
+#define SRS_DATUM		0x0100
+#define SRS_UNIT		0x0200
+#define SRS_AXIS		0x0400	/* up to 0x2000: one bit for each Axis */
+
+static void
+free_srs_cache_item (struct splite_srs_cache_item *p)
+{
+/* memory cleanup - destroying an SRS catalogue item */
+    int i;
+    if (p->proj4text != NULL)
+	free (p->proj4text);
+    if (p->spheroid != NULL)
+	free (p->spheroid);
+    if (p->prime_meridian != NULL)
+	free (p->prime_meridian);
+    if (p->projection != NULL)
+	free (p->projection);
+    if (p->datum != NULL)
+	free (p->datum);
+    if (p->unit != NULL)
+	free (p->unit);
+    for (i = 0; i < 4; i++)
+      {
+	  if (p->axis[i] != NULL)
+	      free (p->axis[i]);
+      }
+    free (p);
+}
+
+SPATIALITE_PRIVATE void
+splite_reset_srs_catalog (const void *p_cache)
+{
+/* flushing the SRS catalogue */
+    int i;
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) p_cache;
+    if (cache == NULL)
+	return;
+    for (i = 0; i < SRS_CATALOG_BUCKETS; i++)
+      {
+	  struct splite_srs_cache_item *p = cache->srsCatalog[i];
+	  while (p != NULL)
+	    {
+		struct splite_srs_cache_item *pn = p->next;
+		free_srs_cache_item (p);
+		p = pn;
+	    }
+	  cache->srsCatalog[i] = NULL;
+      }
+}
+
+static int
+srs_pragma_value (sqlite3 * sqlite, const char *sql)
+{
+/* returning the integer value of some PRAGMA, -1 on failure */
+    int ret;
+    int value = -1;
+    sqlite3_stmt *stmt = NULL;
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    if (ret != SQLITE_OK)
+	return -1;
+    ret = sqlite3_step (stmt);
+    if (ret == SQLITE_ROW)
+	value = sqlite3_column_int (stmt, 0);
+    sqlite3_finalize (stmt);
+    return value;
+}
+
+SPATIALITE_PRIVATE void
+splite_check_srs_version (const void *p_cache, void *p_sqlite, int full)
+{
+/*
+/ checking whether spatial_ref_sys could have changed since the cached
+/ SRS definitions were last validated; any move bumps srsGeneration,
+/ so that every cached PROJ.4 pair will be validated again
+/
+/ sqlite3_total_changes() only counts INSERT, UPDATE and DELETE made by
+/ this connection, and is cheap enough to be checked on every call;
+/ when "full" is set PRAGMA schema_version (DDL, e.g. spatial_ref_sys
+/ dropped and recreated) and PRAGMA data_version (commits made by any
+/ other connection) are checked as well
+*/
+    int changes;
+    int moved = 0;
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) p_cache;
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    if (cache == NULL || sqlite == NULL)
+	return;
+    changes = sqlite3_total_changes (sqlite);
+    if (changes != cache->srsChanges)
+      {
+	  cache->srsChanges = changes;
+	  moved = 1;
+      }
+    if (full)
+      {
+	  int data_version = srs_pragma_value (sqlite, "PRAGMA data_version");
+	  int schema_version =
+	      srs_pragma_value (sqlite, "PRAGMA schema_version");
+	  if (data_version != cache->srsDataVersion
+	      || schema_version != cache->srsSchemaVersion)
+	    {
+		cache->srsDataVersion = data_version;
+		cache->srsSchemaVersion = schema_version;
+		moved = 1;
+	    }
+      }
+    if (moved)
+      {
+	  /* the SRS catalogue could be stale as well */
+	  splite_reset_srs_catalog (cache);
+	  cache->srsGeneration += 1;
+      }
+}
+
+static struct splite_srs_cache_item *
+find_srs_cache_item (const void *p_cache, void *p_sqlite, int srid)
+{
+/* 
+/ retrieving (or inserting) an SRID from the SRS catalogue
+/ returns NULL if no connection cache is available
+*/
+    int bucket;
+    struct splite_srs_cache_item *p;
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) p_cache;
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    if (cache == NULL || sqlite == NULL)
+	return NULL;
+    if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
+	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
+	return NULL;
+
+/* flushing the catalogue if this connection has changed anything */
+    splite_check_srs_version (cache, sqlite, 0);
+
+    bucket = (unsigned int) srid % SRS_CATALOG_BUCKETS;
+    p = cache->srsCatalog[bucket];
+    while (p != NULL)
+      {
+	  if (p->srid == srid)
+	      return p;
+	  p = p->next;
+      }
+    p = calloc (1, sizeof (struct splite_srs_cache_item));
+    if (p == NULL)
+	return NULL;
+    p->srid = srid;
+    p->next = cache->srsCatalog[bucket];
+    cache->srsCatalog[bucket] = p;
+    return p;
+}
+
+static char *
+srs_catalog_string (const char *str)
+{
+/* returning a private copy of some memoized string */
+    char *copy;
+    if (str == NULL)
+	return NULL;
+    copy = malloc (strlen (str) + 1);
+    strcpy (copy, str);
+    return copy;
+}
+
+SPATIALITE_PRIVATE void
+getProjParamsEx_r (const void *p_cache, void *p_sqlite, int srid,
+		   char **proj_params, int gpkg_amphibious_mode)
+{
+/* same as getProjParamsEx(), memoized by the SRS catalogue */
+    struct splite_srs_cache_item *p =
+	find_srs_cache_item (p_cache, p_sqlite, srid);
+    if (p == NULL)
+      {
+	  getProjParamsEx (p_sqlite, srid, proj_params, gpkg_amphibious_mode);
+	  return;
+      }
+    if (!(p->loaded & SRS_PROJ4TEXT))
+      {
+	  getProjParamsEx (p_sqlite, srid, &(p->proj4text),
+			   gpkg_amphibious_mode);
+	  p->loaded |= SRS_PROJ4TEXT;
+      }
+    *proj_params = srs_catalog_string (p->proj4text);
+}
+
+SPATIALITE_PRIVATE int
+getEllipsoidParams_r (const void *p_cache, void *p_sqlite, int srid,
+		      double *a, double *b, double *rf)
+{
+/* same as getEllipsoidParams(), memoized by the SRS catalogue */
+    struct splite_srs_cache_item *p =
+	find_srs_cache_item (p_cache, p_sqlite, srid);
+    if (p == NULL)
+	return getEllipsoidParams (p_sqlite, srid, a, b, rf);
+    if (!(p->loaded & SRS_ELLIPSOID))
+      {
+	  p->ellipsoid_ok =
+	      getEllipsoidParams (p_sqlite, srid, &(p->a), &(p->b), &(p->rf));
+	  p->loaded |= SRS_ELLIPSOID;
+      }
+    if (!p->ellipsoid_ok)
+	return 0;
+    *a = p->a;
+    *b = p->b;
+    *rf = p->rf;
+    return 1;
+}
+
+SPATIALITE_PRIVATE int
+srid_is_geographic_r (const void *p_cache, void *p_sqlite, int srid,
+		      int *geographic)
+{
+/* same as srid_is_geographic(), memoized by the SRS catalogue */
+    struct splite_srs_cache_item *p =
+	find_srs_cache_item (p_cache, p_sqlite, srid);
+    if (p == NULL)
+	return srid_is_geographic (p_sqlite, srid, geographic);
+    if (!(p->loaded & SRS_GEOGRAPHIC))
+      {
+	  p->geographic_ok =
+	      srid_is_geographic (p_sqlite, srid, &(p->geographic));
+	  p->loaded |= SRS_GEOGRAPHIC;
+      }
+    if (!p->geographic_ok)
+	return 0;
+    *geographic = p->geographic;
+    return 1;
+}
+
+SPATIALITE_PRIVATE int
+srid_is_projected_r (const void *p_cache, void *p_sqlite, int srid,
+		     int *projected)
+{
+/* same as srid_is_projected(), memoized by the SRS catalogue */
+    struct splite_srs_cache_item *p =
+	find_srs_cache_item (p_cache, p_sqlite, srid);
+    if (p == NULL)
+	return srid_is_projected (p_sqlite, srid, projected);
+    if (!(p->loaded & SRS_PROJECTED))
+      {
+	  p->projected_ok =
+	      srid_is_projected (p_sqlite, srid, &(p->projected));
+	  p->loaded |= SRS_PROJECTED;
+      }
+    if (!p->projected_ok)
+	return 0;
+    *projected = p->projected;
+    return 1;
+}
+
+SPATIALITE_PRIVATE int
+srid_has_flipped_axes_r (const void *p_cache, void *p_sqlite, int srid,
+			 int *flipped)
+{
+/* same as srid_has_flipped_axes(), memoized by the SRS catalogue */
+    struct splite_srs_cache_item *p =
+	find_srs_cache_item (p_cache, p_sqlite, srid);
+    if (p == NULL)
+	return srid_has_flipped_axes (p_sqlite, srid, flipped);
+    if (!(p->loaded & SRS_FLIPPED))
+      {
+	  p->flipped_ok =
+	      srid_has_flipped_axes (p_sqlite, srid, &(p->flipped));
+	  p->loaded |= SRS_FLIPPED;
+      }
+    if (!p->flipped_ok)
+	return 0;
+    *flipped = p->flipped;
+    return 1;
+}
+
+SPATIALITE_PRIVATE char *
+srid_get_spheroid_r (const void *p_cache, void *p_sqlite, int srid)
+{
+/* same as srid_get_spheroid(), memoized by the SRS catalogue */
+    struct splite_srs_cache_item *p =
+	find_srs_cache_item (p_cache, p_sqlite, srid);
+    if (p == NULL)
+	return srid_get_spheroid (p_sqlite, srid);
+    if (!(p->loaded & SRS_SPHEROID))
+      {
+	  p->spheroid = srid_get_spheroid (p_sqlite, srid);
+	  p->loaded |= SRS_SPHEROID;
+      }
+    return srs_catalog_string (p->spheroid);
+}
+
+SPATIALITE_PRIVATE char *
+srid_get_prime_meridian_r (const void *p_cache, void *p_sqlite, int srid)
+{
+/* same as srid_get_prime_meridian(), memoized by the SRS catalogue */
+    struct splite_srs_cache_item *p =
+	find_srs_cache_item (p_cache, p_sqlite, srid);
+    if (p == NULL)
+	return srid_get_prime_meridian (p_sqlite, srid);
+    if (!(p->loaded & SRS_PRIME_MERIDIAN))
+      {
+	  p->prime_meridian = srid_get_prime_meridian (p_sqlite, srid);
+	  p->loaded |= SRS_PRIME_MERIDIAN;
+      }
+    return srs_catalog_string (p->prime_meridian);
+}
+
+SPATIALITE_PRIVATE char *
+srid_get_projection_r (const void *p_cache, void *p_sqlite, int srid)
+{
+/* same as srid_get_projection(), memoized by the SRS catalogue */
+    struct splite_srs_cache_item *p =
+	find_srs_cache_item (p_cache, p_sqlite, srid);
+    if (p == NULL)
+	return srid_get_projection (p_sqlite, srid);
+    if (!(p->loaded & SRS_PROJECTION))
+      {
+	  p->projection = srid_get_projection (p_sqlite, srid);
+	  p->loaded |= SRS_PROJECTION;
+      }
+    return srs_catalog_string (p->projection);
+}
+
+SPATIALITE_PRIVATE char *
+srid_get_datum_r (const void *p_cache, void *p_sqlite, int srid)
+{
+/* same as srid_get_datum(), memoized by the SRS catalogue */
+    struct splite_srs_cache_item *p =
+	find_srs_cache_item (p_cache, p_sqlite, srid);
+    if (p == NULL)
+	return srid_get_datum (p_sqlite, srid);
+    if (!(p->loaded & SRS_DATUM))
+      {
+	  p->datum = srid_get_datum (p_sqlite, srid);
+	  p->loaded |= SRS_DATUM;
+      }
+    return srs_catalog_string (p->datum);
+}
+
+SPATIALITE_PRIVATE char *
+srid_get_unit_r (const void *p_cache, void *p_sqlite, int srid)
+{
+/* same as srid_get_unit(), memoized by the SRS catalogue */
+    struct splite_srs_cache_item *p =
+	find_srs_cache_item (p_cache, p_sqlite, srid);
+    if (p == NULL)
+	return srid_get_unit (p_sqlite, srid);
+    if (!(p->loaded & SRS_UNIT))
+      {
+	  p->unit = srid_get_unit (p_sqlite, srid);
+	  p->loaded |= SRS_UNIT;
+      }
+    return srs_catalog_string (p->unit);
+}
+
+SPATIALITE_PRIVATE char *
+srid_get_axis_r (const void *p_cache, void *p_sqlite, int srid, char axis,
+		 char mode)
+{
+/* same as srid_get_axis(), memoized by the SRS catalogue */
+    int idx;
+    struct splite_srs_cache_item *p;
+    if ((axis == SPLITE_AXIS_1 || axis == SPLITE_AXIS_2)
+	&& (mode == SPLITE_AXIS_NAME || mode == SPLITE_AXIS_ORIENTATION))
+	;
+    else
+	return NULL;
+    idx = ((axis == SPLITE_AXIS_2) ? 2 : 0) +
+	((mode == SPLITE_AXIS_ORIENTATION) ? 1 : 0);
+    p = find_srs_cache_item (p_cache, p_sqlite, srid);
+    if (p == NULL)
+	return srid_get_axis (p_sqlite, srid, axis, mode);
+    if (!(p->loaded & (SRS_AXIS << idx)))
+      {
+	  p->axis[idx] = srid_get_axis (p_sqlite, srid, axis, mode);
+	  p->loaded |= (SRS_AXIS << idx);
+      }
+    return srs_catalog_string (p->axis[idx]);
+}
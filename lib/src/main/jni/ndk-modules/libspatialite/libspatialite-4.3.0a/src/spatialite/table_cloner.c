@@ -46,6 +46,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <float.h>
 
 #if defined(_WIN32) && !defined(__MINGW32__)
 #include "config-msvc.h"
@@ -59,6 +60,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <spatialite.h>
 #include <spatialite_private.h>
 #include <spatialite/gaiaaux.h>
+#include <spatialite/gaiageo.h>
 
 #ifdef _WIN32
 #define strcasecmp	_stricmp
@@ -2060,10 +2062,11 @@ free_cloner (struct aux_cloner *cloner)
     free (cloner);
 }
 
-static int
-already_existing_table (sqlite3 * sqlite, const char *table)
+SPATIALITE_PRIVATE int
+already_existing_table (void *p_sqlite, const char *table)
 {
 /* testing if the target Table is already defined */
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
     char *sql;
     int ret;
     int i;
@@ -2317,3 +2320,564 @@ gaiaAuxClonerExecute (const void *handle)
       }
     return 1;
 }
+
+struct aux_cluster_item
+{
+/* a Feature to be clustered */
+    sqlite3_int64 rowid;
+    int has_mbr;		/* FALSE for NULL or invalid geometries */
+    double x;
+    double y;
+    unsigned int hilbert;	/* Hilbert key of the MBR center */
+};
+
+struct aux_cluster_ref
+{
+/* a Foreign Key referencing the Table to be clustered */
+    char *table;
+    char *column;
+    int cascade;
+    struct aux_cluster_ref *next;
+};
+
+static int
+cluster_cmp (const void *p1, const void *p2)
+{
+/* sorting Features by Hilbert key [NULL geometries last] */
+    const struct aux_cluster_item *i1 = (const struct aux_cluster_item *) p1;
+    const struct aux_cluster_item *i2 = (const struct aux_cluster_item *) p2;
+    if (i1->has_mbr != i2->has_mbr)
+	return i1->has_mbr ? -1 : 1;
+    if (i1->hilbert < i2->hilbert)
+	return -1;
+    if (i1->hilbert > i2->hilbert)
+	return 1;
+    if (i1->rowid < i2->rowid)
+	return -1;
+    if (i1->rowid > i2->rowid)
+	return 1;
+    return 0;
+}
+
+static int
+cluster_cmp_rowid (const void *p1, const void *p2)
+{
+/* sorting ROWIDs */
+    sqlite3_int64 r1 = *((const sqlite3_int64 *) p1);
+    sqlite3_int64 r2 = *((const sqlite3_int64 *) p2);
+    if (r1 < r2)
+	return -1;
+    if (r1 > r2)
+	return 1;
+    return 0;
+}
+
+static void
+cluster_free_refs (struct aux_cluster_ref *ref)
+{
+/* memory cleanup - Foreign Keys referencing the clustered Table */
+    struct aux_cluster_ref *next;
+    while (ref != NULL)
+      {
+	  next = ref->next;
+	  sqlite3_free (ref->table);
+	  sqlite3_free (ref->column);
+	  free (ref);
+	  ref = next;
+      }
+}
+
+static int
+cluster_find_refs (sqlite3 * sqlite, const char *table, const char *pk,
+		   struct aux_cluster_ref **refs)
+{
+/* exploring all Foreign Keys referencing the Table's Primary Key */
+    char *sql;
+    int ret;
+    int i;
+    int j;
+    char **results;
+    int rows;
+    int columns;
+    char **results2;
+    int rows2;
+    int columns2;
+    const char *name;
+    const char *references;
+    const char *to;
+    const char *on_update;
+    char *xname;
+    struct aux_cluster_ref *ref;
+
+    *refs = NULL;
+    ret = sqlite3_get_table (sqlite, "SELECT name FROM main.sqlite_master "
+			     "WHERE type = 'table'", &results, &rows, &columns,
+			     NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    for (i = 1; i <= rows; i++)
+      {
+	  name = results[(i * columns) + 0];
+	  xname = gaiaDoubleQuotedSql (name);
+	  sql = sqlite3_mprintf ("PRAGMA main.foreign_key_list(\"%s\")", xname);
+	  free (xname);
+	  ret =
+	      sqlite3_get_table (sqlite, sql, &results2, &rows2, &columns2,
+				 NULL);
+	  sqlite3_free (sql);
+	  if (ret != SQLITE_OK)
+	    {
+		sqlite3_free_table (results);
+		return 0;
+	    }
+	  for (j = 1; j <= rows2; j++)
+	    {
+		references = results2[(j * columns2) + 2];
+		to = results2[(j * columns2) + 4];
+		on_update = results2[(j * columns2) + 5];
+		if (strcasecmp (references, table) != 0)
+		    continue;
+		if (to != NULL && strcasecmp (to, pk) != 0)
+		    continue;
+		ref = malloc (sizeof (struct aux_cluster_ref));
+		ref->table = sqlite3_mprintf ("%s", name);
+		ref->column =
+		    sqlite3_mprintf ("%s", results2[(j * columns2) + 3]);
+		ref->cascade = (strcasecmp (on_update, "CASCADE") == 0) ? 1 : 0;
+		ref->next = *refs;
+		*refs = ref;
+	    }
+	  sqlite3_free_table (results2);
+      }
+    sqlite3_free_table (results);
+    return 1;
+}
+
+static int
+cluster_foreign_keys_enabled (sqlite3 * sqlite)
+{
+/* testing if Foreign Key constraints are currently enforced */
+    int ret;
+    int enabled = 0;
+    sqlite3_stmt *stmt;
+    const char *sql = "PRAGMA foreign_keys";
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    if (sqlite3_step (stmt) == SQLITE_ROW)
+	enabled = sqlite3_column_int (stmt, 0);
+    sqlite3_finalize (stmt);
+    return enabled;
+}
+
+static struct aux_cluster_item *
+cluster_load_items (sqlite3 * sqlite, const char *table,
+		    const char *geometry, int *count)
+{
+/* loading all Features in ROWID order, then sorting them by Hilbert key */
+    struct aux_cluster_item *items = NULL;
+    struct aux_cluster_item *item;
+    int allocated = 0;
+    int n = 0;
+    int i;
+    int ret;
+    char *sql;
+    char *xtable;
+    char *xcolumn;
+    double minx;
+    double miny;
+    double maxx;
+    double maxy;
+    double ext_minx = DBL_MAX;
+    double ext_miny = DBL_MAX;
+    double ext_maxx = -DBL_MAX;
+    double ext_maxy = -DBL_MAX;
+    double scale_x;
+    double scale_y;
+    sqlite3_stmt *stmt = NULL;
+
+    *count = -1;
+    xtable = gaiaDoubleQuotedSql (table);
+    xcolumn = gaiaDoubleQuotedSql (geometry);
+    sql = sqlite3_mprintf ("SELECT ROWID, \"%s\" FROM main.\"%s\" "
+			   "ORDER BY ROWID", xcolumn, xtable);
+    free (xtable);
+    free (xcolumn);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto error;
+    while (1)
+      {
+	  /* scrolling the result set rows */
+	  const unsigned char *blob;
+	  unsigned int size;
+	  ret = sqlite3_step (stmt);
+	  if (ret == SQLITE_DONE)
+	      break;		/* end of result set */
+	  if (ret != SQLITE_ROW)
+	      goto error;
+	  if (n == allocated)
+	    {
+		struct aux_cluster_item *save = items;
+		allocated = (allocated == 0) ? 1024 : allocated * 2;
+		items = realloc (items,
+				 sizeof (struct aux_cluster_item) * allocated);
+		if (items == NULL)
+		  {
+		      items = save;
+		      goto error;
+		  }
+	    }
+	  item = items + n++;
+	  item->rowid = sqlite3_column_int64 (stmt, 0);
+	  item->has_mbr = 0;
+	  item->hilbert = 0;
+	  if (sqlite3_column_type (stmt, 1) != SQLITE_BLOB)
+	      continue;
+	  blob = sqlite3_column_blob (stmt, 1);
+	  size = sqlite3_column_bytes (stmt, 1);
+	  if (!gaiaGetMbrMinX (blob, size, &minx))
+	      continue;
+	  if (!gaiaGetMbrMinY (blob, size, &miny))
+	      continue;
+	  if (!gaiaGetMbrMaxX (blob, size, &maxx))
+	      continue;
+	  if (!gaiaGetMbrMaxY (blob, size, &maxy))
+	      continue;
+	  item->has_mbr = 1;
+	  item->x = (minx + maxx) / 2.0;
+	  item->y = (miny + maxy) / 2.0;
+	  if (item->x < ext_minx)
+	      ext_minx = item->x;
+	  if (item->x > ext_maxx)
+	      ext_maxx = item->x;
+	  if (item->y < ext_miny)
+	      ext_miny = item->y;
+	  if (item->y > ext_maxy)
+	      ext_maxy = item->y;
+      }
+    sqlite3_finalize (stmt);
+    stmt = NULL;
+
+/* computing the Hilbert keys of all MBR centers */
+    scale_x = (ext_maxx > ext_minx) ? 65535.0 / (ext_maxx - ext_minx) : 0.0;
+    scale_y = (ext_maxy > ext_miny) ? 65535.0 / (ext_maxy - ext_miny) : 0.0;
+    for (i = 0; i < n; i++)
+      {
+	  item = items + i;
+	  if (!(item->has_mbr))
+	      continue;
+	  item->hilbert =
+	      gaiaHilbertKey (item->x, item->y, ext_minx, ext_miny, scale_x,
+			      scale_y);
+      }
+    if (n > 0)
+	qsort (items, n, sizeof (struct aux_cluster_item), cluster_cmp);
+    *count = n;
+    return items;
+
+  error:
+    if (stmt != NULL)
+	sqlite3_finalize (stmt);
+    if (items != NULL)
+	free (items);
+    return NULL;
+}
+
+static double
+cluster_mean_gap (struct aux_cluster_item *items, int count,
+		  sqlite3_int64 * rowids)
+{
+/*
+/ the average ROWID distance between Features that are adjacent along
+/ the Hilbert curve: values close to 1 mean that spatially close
+/ Features are stored in the same or in adjacent pages
+*/
+    int i;
+    int pairs = 0;
+    double sum = 0.0;
+    sqlite3_int64 prev = 0;
+    sqlite3_int64 rowid;
+    for (i = 0; i < count; i++)
+      {
+	  if (!(items[i].has_mbr))
+	      break;
+	  rowid = (rowids == NULL) ? items[i].rowid : rowids[i];
+	  if (i > 0)
+	    {
+		sum += (rowid > prev) ? (double) (rowid - prev)
+		    : (double) (prev - rowid);
+		pairs++;
+	    }
+	  prev = rowid;
+      }
+    if (pairs == 0)
+	return 0.0;
+    return sum / (double) pairs;
+}
+
+static int
+cluster_reassign_rowids (sqlite3 * sqlite, const char *table,
+			 struct aux_cluster_item *items,
+			 sqlite3_int64 * rowids, int count,
+			 struct aux_cluster_ref *refs, int remap_refs)
+{
+/*
+/ reassigning the ROWIDs in Hilbert order
+/
+/ the same set of ROWID values is simply permuted; in order to avoid
+/ any transient collision all rows are first moved below the lowest
+/ ROWID, and then moved back in ascending order, so that SQLite
+/ appends them to the B-Tree and packs its leaf pages
+*/
+    int i;
+    int ret;
+    char *sql;
+    char *xtable;
+    char *xcolumn;
+    sqlite3_int64 base;
+    sqlite3_stmt *stmt = NULL;
+    struct aux_cluster_ref *ref;
+
+    base = rowids[0] - 1 - rowids[count - 1];
+    ret =
+	sqlite3_exec (sqlite,
+		      "CREATE TEMPORARY TABLE spatialite_cluster_map "
+		      "(old_rowid INTEGER PRIMARY KEY, new_rowid INTEGER NOT NULL)",
+		      NULL, NULL, NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    sql = "INSERT INTO temp.spatialite_cluster_map (old_rowid, new_rowid) "
+	"VALUES (?, ?)";
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    if (ret != SQLITE_OK)
+	goto error;
+    for (i = 0; i < count; i++)
+      {
+	  sqlite3_reset (stmt);
+	  sqlite3_clear_bindings (stmt);
+	  sqlite3_bind_int64 (stmt, 1, items[i].rowid);
+	  sqlite3_bind_int64 (stmt, 2, rowids[i]);
+	  ret = sqlite3_step (stmt);
+	  if (ret != SQLITE_DONE && ret != SQLITE_ROW)
+	      goto error;
+      }
+    sqlite3_finalize (stmt);
+    stmt = NULL;
+
+    xtable = gaiaDoubleQuotedSql (table);
+    sql = sqlite3_mprintf ("UPDATE main.\"%s\" SET ROWID = "
+			   "(SELECT new_rowid + %lld FROM temp.spatialite_cluster_map "
+			   "WHERE old_rowid = \"%s\".ROWID); "
+			   "UPDATE main.\"%s\" SET ROWID = ROWID - %lld "
+			   "WHERE ROWID < %lld", xtable, base, xtable, xtable,
+			   base, rowids[0]);
+    free (xtable);
+    ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto error;
+
+    ref = refs;
+    while (ref != NULL && remap_refs)
+      {
+	  /* remapping all referencing Foreign Key values */
+	  if (ref->cascade && cluster_foreign_keys_enabled (sqlite))
+	    {
+		/* already updated by SQLite itself */
+		ref = ref->next;
+		continue;
+	    }
+	  xtable = gaiaDoubleQuotedSql (ref->table);
+	  xcolumn = gaiaDoubleQuotedSql (ref->column);
+	  sql = sqlite3_mprintf ("UPDATE main.\"%s\" SET \"%s\" = "
+				 "(SELECT new_rowid FROM temp.spatialite_cluster_map "
+				 "WHERE old_rowid = \"%s\".\"%s\") "
+				 "WHERE \"%s\" IN (SELECT old_rowid FROM "
+				 "temp.spatialite_cluster_map)", xtable,
+				 xcolumn, xtable, xcolumn, xcolumn);
+	  free (xtable);
+	  free (xcolumn);
+	  ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
+	  sqlite3_free (sql);
+	  if (ret != SQLITE_OK)
+	      goto error;
+	  ref = ref->next;
+      }
+    sqlite3_exec (sqlite, "DROP TABLE temp.spatialite_cluster_map", NULL,
+		  NULL, NULL);
+    return 1;
+
+  error:
+    spatialite_e ("ClusterGeoTable: \"%s\"\n", sqlite3_errmsg (sqlite));
+    if (stmt != NULL)
+	sqlite3_finalize (stmt);
+    sqlite3_exec (sqlite, "DROP TABLE temp.spatialite_cluster_map", NULL,
+		  NULL, NULL);
+    return 0;
+}
+
+SPATIALITE_PRIVATE int
+gaiaAuxClusterGeoTable (const void *handle, const char *table,
+			const char *geometry, int renumber, int *features,
+			double *gap_before, double *gap_after)
+{
+/*
+/ physically rewriting a Table in Hilbert order of the MBR centers
+/ of some Geometry Column, then rebuilding all its Spatial Indices
+/
+/ SQLite stores rows in ROWID order, so this simply means reassigning
+/ the ROWIDs; Primary Key values are never changed unless the Primary
+/ Key is an alias of the ROWID (INTEGER PRIMARY KEY), in which case
+/ an explicit renumber request is required and all Foreign Keys
+/ referencing the Table are consistently remapped
+*/
+    sqlite3 *sqlite = (sqlite3 *) handle;
+    const void *cloner = NULL;
+    struct aux_cloner *info;
+    struct aux_column *column;
+    struct aux_column *geom = NULL;
+    struct aux_column *pk = NULL;
+    struct aux_cluster_item *items = NULL;
+    struct aux_cluster_ref *refs = NULL;
+    sqlite3_int64 *rowids = NULL;
+    int count = 0;
+    int remap_refs = 0;
+    int ret;
+    int i;
+    int ok = 0;
+
+    *features = 0;
+    *gap_before = 0.0;
+    *gap_after = 0.0;
+    if (!already_existing_table (sqlite, table))
+      {
+	  spatialite_e ("ClusterGeoTable: table \"%s\" does not exist\n",
+			table);
+	  return 0;
+      }
+    if (!validateRowid (sqlite, table))
+      {
+	  spatialite_e
+	      ("ClusterGeoTable: a physical column named ROWID shadows the real ROWID\n");
+	  return 0;
+      }
+    cloner = gaiaAuxClonerCreate (sqlite, "main", table, table);
+    if (cloner == NULL)
+	return 0;
+    info = (struct aux_cloner *) cloner;
+    column = info->first_col;
+    while (column != NULL)
+      {
+	  if (column->geometry != NULL
+	      && strcasecmp (column->name, geometry) == 0)
+	      geom = column;
+	  if (column->pk && info->pk_count == 1)
+	      pk = column;
+	  column = column->next;
+      }
+    if (geom == NULL)
+      {
+	  spatialite_e
+	      ("ClusterGeoTable: \"%s\".\"%s\" isn't a registered Geometry column\n",
+	       table, geometry);
+	  goto stop;
+      }
+    if (pk != NULL && strcasecmp (pk->type, "INTEGER") == 0)
+      {
+	  /* the Primary Key is an alias of the ROWID */
+	  if (!renumber)
+	    {
+		spatialite_e
+		    ("ClusterGeoTable: \"%s\".\"%s\" is an INTEGER PRIMARY KEY and can't be preserved\n",
+		     table, pk->name);
+		goto stop;
+	    }
+	  if (!cluster_find_refs (sqlite, table, pk->name, &refs))
+	      goto stop;
+	  remap_refs = 1;
+	  if (cluster_foreign_keys_enabled (sqlite))
+	    {
+		/* SQLite itself would reject or corrupt any non-cascading reference */
+		struct aux_cluster_ref *ref = refs;
+		while (ref != NULL)
+		  {
+		      if (!(ref->cascade))
+			{
+			    spatialite_e
+				("ClusterGeoTable: \"%s\".\"%s\" references \"%s\" "
+				 "without ON UPDATE CASCADE\n", ref->table,
+				 ref->column, table);
+			    goto stop;
+			}
+		      ref = ref->next;
+		  }
+	    }
+      }
+
+    items = cluster_load_items (sqlite, table, geometry, &count);
+    if (items == NULL)
+      {
+	  if (count == 0)
+	    {
+		/* empty table: nothing to be done */
+		ok = 1;
+	    }
+	  goto stop;
+      }
+
+/* the new ROWIDs are just the current ones in ascending order */
+    rowids = malloc (sizeof (sqlite3_int64) * count);
+    if (rowids == NULL)
+	goto stop;
+    for (i = 0; i < count; i++)
+	rowids[i] = items[i].rowid;
+    qsort (rowids, count, sizeof (sqlite3_int64), cluster_cmp_rowid);
+    *features = count;
+    *gap_before = cluster_mean_gap (items, count, NULL);
+    *gap_after = cluster_mean_gap (items, count, rowids);
+
+    ret = sqlite3_exec (sqlite, "SAVEPOINT spatialite_cluster", NULL, NULL,
+			NULL);
+    if (ret != SQLITE_OK)
+	goto stop;
+    if (cluster_reassign_rowids
+	(sqlite, table, items, rowids, count, refs, remap_refs))
+      {
+	  /* all ROWID-keyed indices are now stale */
+	  ok = 1;
+	  column = info->first_col;
+	  while (column != NULL)
+	    {
+		if (column->geometry != NULL)
+		  {
+		      if (!reloadSpatialIndex (sqlite, table, column->name))
+			{
+			    ok = 0;
+			    break;
+			}
+		  }
+		column = column->next;
+	    }
+      }
+    if (!ok)
+	sqlite3_exec (sqlite, "ROLLBACK TO spatialite_cluster", NULL, NULL,
+		      NULL);
+    sqlite3_exec (sqlite, "RELEASE spatialite_cluster", NULL, NULL, NULL);
+
+  stop:
+    if (!ok)
+      {
+	  *features = 0;
+	  *gap_before = 0.0;
+	  *gap_after = 0.0;
+      }
+    gaiaAuxClonerDestroy (cloner);
+    cluster_free_refs (refs);
+    if (items != NULL)
+	free (items);
+    if (rowids != NULL)
+	free (rowids);
+    return ok;
+}
@@ -0,0 +1,1056 @@
+/*
+
+ virtualknn.c -- SQLite3 extension [VIRTUAL TABLE KNN]
+
+ version 4.3, 2015 June 29
+
+ Author: Sandro Furieri a.furieri@lqt.it
+
+ -----------------------------------------------------------------------------
+ 
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+ 
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+ 
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+ 
+Portions created by the Initial Developer are Copyright (C) 2008-2015
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+ 
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "config-msvc.h"
+#else
+#include "config.h"
+#endif
+
+#include <spatialite/sqlite.h>
+
+#include <spatialite/spatialite.h>
+#include <spatialite/gaiaaux.h>
+#include <spatialite/gaiageo.h>
+#include <spatialite.h>
+
+#ifdef _WIN32
+#define strcasecmp	_stricmp
+#endif /* not WIN32 */
+
+#define DEG2RAD	0.0174532925199432958
+#define RAD2DEG	57.2957795130823208768
+
+#define KNN_DEFAULT_ITEMS	3
+#define KNN_MAX_ITEMS		1024
+
+static struct sqlite3_module my_knn_module;
+
+
+/******************************************************************************
+/
+/ VirtualTable structs
+/
+******************************************************************************/
+
+typedef struct VirtualKnnStruct
+{
+/* extends the sqlite3_vtab struct */
+    const sqlite3_module *pModule;	/* ptr to sqlite module: USED INTERNALLY BY SQLITE */
+    int nRef;			/* # references: USED INTERNALLY BY SQLITE */
+    char *zErrMsg;		/* error message: USE INTERNALLY BY SQLITE */
+    sqlite3 *db;		/* the sqlite db holding the virtual table */
+} VirtualKnn;
+typedef VirtualKnn *VirtualKnnPtr;
+
+typedef struct VirtualKnnItemStruct
+{
+/* a Priority Queue item */
+    double dist;		/* distance from the reference Geometry */
+    sqlite3_int64 id;		/* R*Tree node or feature ROWID */
+    int level;			/* node depth; -1 for features */
+    int exact;			/* TRUE if DIST is the exact distance */
+} VirtualKnnItem;
+typedef VirtualKnnItem *VirtualKnnItemPtr;
+
+typedef struct VirtualKnnQueueStruct
+{
+/* a Priority Queue (binary min-heap) */
+    VirtualKnnItemPtr items;
+    int count;
+    int allocated;
+} VirtualKnnQueue;
+typedef VirtualKnnQueue *VirtualKnnQueuePtr;
+
+typedef struct VirtualKnnContextStruct
+{
+/* the KNN search context */
+    sqlite3_stmt *stmt_node;	/* fetches a R*Tree node */
+    sqlite3_stmt *stmt_dist;	/* computes the exact distance */
+    int geographic;		/* TRUE for geodesic distances */
+    double radius;		/* a lower bound of the Earth's radius */
+    double minx;		/* the reference Geometry MBR */
+    double miny;
+    double maxx;
+    double maxy;
+    VirtualKnnQueue queue;
+} VirtualKnnContext;
+typedef VirtualKnnContext *VirtualKnnContextPtr;
+
+typedef struct VirtualKnnCursorStruct
+{
+/* extends the sqlite3_vtab_cursor struct */
+    VirtualKnnPtr pVtab;	/* Virtual table of this cursor */
+    int eof;			/* the EOF marker */
+    char *f_table_name;
+    char *f_geometry_column;
+    unsigned char *ref_geometry;
+    int ref_geometry_sz;
+    int max_items;
+    sqlite3_int64 *fids;
+    double *distances;
+    int count;
+    int current;
+} VirtualKnnCursor;
+typedef VirtualKnnCursor *VirtualKnnCursorPtr;
+
+static int
+vknn_find_geometry (sqlite3 * sqlite, const char *table_name,
+		    const char *geom_column, char **real_table,
+		    char **real_geom, int *srid)
+{
+/* checks if the required Geometry is actually defined and indexed */
+    sqlite3_stmt *stmt;
+    char *sql_statement;
+    int ret;
+    int count = 0;
+    char *rt = NULL;
+    char *rg = NULL;
+
+    if (geom_column == NULL)
+	sql_statement =
+	    sqlite3_mprintf
+	    ("SELECT f_table_name, f_geometry_column, srid FROM geometry_columns "
+	     "WHERE Upper(f_table_name) = Upper(%Q) AND spatial_index_enabled = 1",
+	     table_name);
+    else
+	sql_statement =
+	    sqlite3_mprintf
+	    ("SELECT f_table_name, f_geometry_column, srid FROM geometry_columns "
+	     "WHERE Upper(f_table_name) = Upper(%Q) AND "
+	     "Upper(f_geometry_column) = Upper(%Q) AND spatial_index_enabled = 1",
+	     table_name, geom_column);
+    ret =
+	sqlite3_prepare_v2 (sqlite, sql_statement, strlen (sql_statement),
+			    &stmt, NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	return 0;
+    while (1)
+      {
+	  /* scrolling the result set rows */
+	  ret = sqlite3_step (stmt);
+	  if (ret == SQLITE_DONE)
+	      break;		/* end of result set */
+	  if (ret == SQLITE_ROW)
+	    {
+		const char *v = (const char *) sqlite3_column_text (stmt, 0);
+		int len = sqlite3_column_bytes (stmt, 0);
+		if (rt)
+		    free (rt);
+		rt = malloc (len + 1);
+		strcpy (rt, v);
+		v = (const char *) sqlite3_column_text (stmt, 1);
+		len = sqlite3_column_bytes (stmt, 1);
+		if (rg)
+		    free (rg);
+		rg = malloc (len + 1);
+		strcpy (rg, v);
+		*srid = sqlite3_column_int (stmt, 2);
+		count++;
+	    }
+      }
+    sqlite3_finalize (stmt);
+    if (count != 1)
+      {
+	  if (rt)
+	      free (rt);
+	  if (rg)
+	      free (rg);
+	  return 0;
+      }
+    *real_table = rt;
+    *real_geom = rg;
+    return 1;
+}
+
+static int
+vknn_queue_push (VirtualKnnQueuePtr queue, double dist, sqlite3_int64 id,
+		 int level, int exact)
+{
+/* inserting a new item into the Priority Queue */
+    int i;
+    VirtualKnnItem item;
+    if (queue->count >= queue->allocated)
+      {
+	  int allocated = (queue->allocated == 0) ? 256 : queue->allocated * 2;
+	  VirtualKnnItemPtr items =
+	      realloc (queue->items, sizeof (VirtualKnnItem) * allocated);
+	  if (items == NULL)
+	      return 0;
+	  queue->items = items;
+	  queue->allocated = allocated;
+      }
+    item.dist = dist;
+    item.id = id;
+    item.level = level;
+    item.exact = exact;
+/* sifting up */
+    i = queue->count;
+    queue->count += 1;
+    while (i > 0)
+      {
+	  int parent = (i - 1) / 2;
+	  VirtualKnnItemPtr p = queue->items + parent;
+	  if (p->dist < item.dist
+	      || (p->dist == item.dist && p->exact >= item.exact))
+	      break;
+	  queue->items[i] = *p;
+	  i = parent;
+      }
+    queue->items[i] = item;
+    return 1;
+}
+
+static int
+vknn_queue_pop (VirtualKnnQueuePtr queue, VirtualKnnItemPtr item)
+{
+/* removing the nearest item from the Priority Queue */
+    int i;
+    VirtualKnnItem last;
+    if (queue->count == 0)
+	return 0;
+    *item = queue->items[0];
+    queue->count -= 1;
+    if (queue->count == 0)
+	return 1;
+/* sifting down */
+    last = queue->items[queue->count];
+    i = 0;
+    while (1)
+      {
+	  int child = (2 * i) + 1;
+	  VirtualKnnItemPtr c;
+	  if (child >= queue->count)
+	      break;
+	  if (child + 1 < queue->count)
+	    {
+		VirtualKnnItemPtr c1 = queue->items + child;
+		VirtualKnnItemPtr c2 = queue->items + child + 1;
+		if (c2->dist < c1->dist
+		    || (c2->dist == c1->dist && c2->exact > c1->exact))
+		    child++;
+	    }
+	  c = queue->items + child;
+	  if (last.dist < c->dist
+	      || (last.dist == c->dist && last.exact >= c->exact))
+	      break;
+	  queue->items[i] = *c;
+	  i = child;
+      }
+    queue->items[i] = last;
+    return 1;
+}
+
+static double
+vknn_gap (double min1, double max1, double min2, double max2)
+{
+/* the gap separating two intervals (0 if they overlap) */
+    if (max1 < min2)
+	return min2 - max1;
+    if (max2 < min1)
+	return min1 - max2;
+    return 0.0;
+}
+
+static double
+vknn_mbr_distance (VirtualKnnContextPtr ctx, double minx, double miny,
+		   double maxx, double maxy)
+{
+/*
+computes a lower bound of the distance between the reference Geometry
+and any Geometry contained within the given MBR
+*/
+    double dx = vknn_gap (ctx->minx, ctx->maxx, minx, maxx);
+    double dy = vknn_gap (ctx->miny, ctx->maxy, miny, maxy);
+    if (ctx->geographic)
+      {
+	  /* geodesic metric: spherical lower bound (metres) */
+	  double lat;
+	  double wrap;
+	  double lune;
+	  wrap = vknn_gap (ctx->minx + 360.0, ctx->maxx + 360.0, minx, maxx);
+	  if (wrap < dx)
+	      dx = wrap;
+	  wrap = vknn_gap (ctx->minx - 360.0, ctx->maxx - 360.0, minx, maxx);
+	  if (wrap < dx)
+	      dx = wrap;
+	  if (dx > 90.0)
+	      dx = 90.0;
+	  /* the highest latitude of the reference MBR */
+	  lat = fabs (ctx->miny);
+	  if (fabs (ctx->maxy) > lat)
+	      lat = fabs (ctx->maxy);
+	  if (lat > 90.0)
+	      lat = 90.0;
+	  /* the distance from the meridians bounding the MBR */
+	  lune = asin (cos (lat * DEG2RAD) * sin (dx * DEG2RAD)) * RAD2DEG;
+	  /* the distance from the parallels bounding the MBR */
+	  if (dy > lune)
+	      lune = dy;
+	  return lune * DEG2RAD * ctx->radius;
+      }
+/* planar metric */
+    return sqrt ((dx * dx) + (dy * dy));
+}
+
+static int
+vknn_exact_distance (VirtualKnnContextPtr ctx, sqlite3_int64 rowid,
+		     double *dist)
+{
+/* computes the exact distance between the reference Geometry and a feature */
+    int ret;
+    int ok = 0;
+    sqlite3_reset (ctx->stmt_dist);
+    sqlite3_bind_int64 (ctx->stmt_dist, 2, rowid);
+    ret = sqlite3_step (ctx->stmt_dist);
+    if (ret == SQLITE_ROW
+	&& sqlite3_column_type (ctx->stmt_dist, 0) == SQLITE_FLOAT)
+      {
+	  *dist = sqlite3_column_double (ctx->stmt_dist, 0);
+	  ok = 1;
+      }
+    sqlite3_reset (ctx->stmt_dist);
+    return ok;
+}
+
+static float
+vknn_import_float (const unsigned char *p)
+{
+/* decoding a big-endian R*Tree float */
+    union
+    {
+	float value;
+	unsigned int bits;
+    } cvt;
+    cvt.bits =
+	((unsigned int) p[0] << 24) | ((unsigned int) p[1] << 16) |
+	((unsigned int) p[2] << 8) | (unsigned int) p[3];
+    return cvt.value;
+}
+
+static sqlite3_int64
+vknn_import_int64 (const unsigned char *p)
+{
+/* decoding a big-endian R*Tree 64 bit integer */
+    sqlite3_uint64 value = 0;
+    int i;
+    for (i = 0; i < 8; i++)
+	value = (value << 8) | p[i];
+    return (sqlite3_int64) value;
+}
+
+static int
+vknn_expand_node (VirtualKnnContextPtr ctx, sqlite3_int64 nodeno, int level)
+{
+/*
+/ reading a R*Tree node and inserting all its children into
+/ the Priority Queue
+*/
+    int ret;
+    int ok = 1;
+    sqlite3_reset (ctx->stmt_node);
+    sqlite3_bind_int64 (ctx->stmt_node, 1, nodeno);
+    ret = sqlite3_step (ctx->stmt_node);
+    if (ret == SQLITE_ROW
+	&& sqlite3_column_type (ctx->stmt_node, 0) == SQLITE_BLOB)
+      {
+	  const unsigned char *blob = sqlite3_column_blob (ctx->stmt_node, 0);
+	  int size = sqlite3_column_bytes (ctx->stmt_node, 0);
+	  int n_cells;
+	  int i;
+	  if (size < 4)
+	    {
+		sqlite3_reset (ctx->stmt_node);
+		return 1;
+	    }
+	  if (level < 0)
+	    {
+		/* the root node declares the tree depth */
+		level = (blob[0] << 8) | blob[1];
+	    }
+	  n_cells = (blob[2] << 8) | blob[3];
+	  if (4 + (n_cells * 24) > size)
+	      n_cells = (size - 4) / 24;
+	  for (i = 0; i < n_cells; i++)
+	    {
+		const unsigned char *cell = blob + 4 + (i * 24);
+		sqlite3_int64 id = vknn_import_int64 (cell);
+		double minx = vknn_import_float (cell + 8);
+		double maxx = vknn_import_float (cell + 12);
+		double miny = vknn_import_float (cell + 16);
+		double maxy = vknn_import_float (cell + 20);
+		double dist = vknn_mbr_distance (ctx, minx, miny, maxx, maxy);
+		if (!vknn_queue_push
+		    (&(ctx->queue), dist, id, (level == 0) ? -1 : level - 1,
+		     0))
+		  {
+		      ok = 0;
+		      break;
+		  }
+	    }
+      }
+    sqlite3_reset (ctx->stmt_node);
+    return ok;
+}
+
+static int
+vknn_search (VirtualKnnCursorPtr cursor, VirtualKnnContextPtr ctx)
+{
+/*
+best-first KNN search
+nodes and features are extracted from the Priority Queue in order of
+increasing (lower bound) distance; the exact distance of each feature
+is computed only when it reaches the top of the queue, and the feature
+is then queued again so to be returned in the right order
+*/
+    VirtualKnnItem item;
+    cursor->fids = malloc (sizeof (sqlite3_int64) * cursor->max_items);
+    cursor->distances = malloc (sizeof (double) * cursor->max_items);
+    if (cursor->fids == NULL || cursor->distances == NULL)
+	return 0;
+    if (!vknn_expand_node (ctx, 1, -1))
+	return 0;
+    while (cursor->count < cursor->max_items)
+      {
+	  if (!vknn_queue_pop (&(ctx->queue), &item))
+	      break;
+	  if (item.level >= 0)
+	    {
+		/* expanding an intermediate node */
+		if (!vknn_expand_node (ctx, item.id, item.level))
+		    return 0;
+	    }
+	  else if (item.exact)
+	    {
+		/* the next nearest feature */
+		cursor->fids[cursor->count] = item.id;
+		cursor->distances[cursor->count] = item.dist;
+		cursor->count += 1;
+	    }
+	  else
+	    {
+		/* lazily refining the feature distance */
+		double dist;
+		if (vknn_exact_distance (ctx, item.id, &dist))
+		  {
+		      if (!vknn_queue_push (&(ctx->queue), dist, item.id, -1, 1))
+			  return 0;
+		  }
+	    }
+      }
+    return 1;
+}
+
+static int
+vknn_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
+	     sqlite3_vtab ** ppVTab, char **pzErr)
+{
+/* creates the virtual table for KNN (nearest neighbours) queries */
+    VirtualKnnPtr p_vt;
+    char *buf;
+    char *vtable;
+    char *xname;
+    if (pAux)
+	pAux = pAux;		/* unused arg warning suppression */
+    if (argc == 3)
+      {
+	  vtable = gaiaDequotedSql ((char *) argv[2]);
+      }
+    else
+      {
+	  *pzErr =
+	      sqlite3_mprintf
+	      ("[VirtualKNN module] CREATE VIRTUAL: illegal arg list {void}\n");
+	  return SQLITE_ERROR;
+      }
+    p_vt = (VirtualKnnPtr) sqlite3_malloc (sizeof (VirtualKnn));
+    if (!p_vt)
+	return SQLITE_NOMEM;
+    p_vt->db = db;
+    p_vt->pModule = &my_knn_module;
+    p_vt->nRef = 0;
+    p_vt->zErrMsg = NULL;
+/* preparing the COLUMNs for this VIRTUAL TABLE */
+    xname = gaiaDoubleQuotedSql (vtable);
+    buf = sqlite3_mprintf ("CREATE TABLE \"%s\" (f_table_name TEXT, "
+			   "f_geometry_column TEXT, ref_geometry BLOB, "
+			   "max_items INTEGER, pos INTEGER, fid INTEGER, "
+			   "distance DOUBLE)", xname);
+    free (xname);
+    free (vtable);
+    if (sqlite3_declare_vtab (db, buf) != SQLITE_OK)
+      {
+	  *pzErr =
+	      sqlite3_mprintf
+	      ("[VirtualKNN module] CREATE VIRTUAL: invalid SQL statement \"%s\"",
+	       buf);
+	  sqlite3_free (buf);
+	  sqlite3_free (p_vt);
+	  return SQLITE_ERROR;
+      }
+    sqlite3_free (buf);
+    *ppVTab = (sqlite3_vtab *) p_vt;
+    return SQLITE_OK;
+}
+
+static void
+vknn_reset_cache (VirtualKnnCursorPtr cursor)
+{
+/* cleaning the cursor's cache */
+    if (cursor->f_table_name != NULL)
+	free (cursor->f_table_name);
+    if (cursor->f_geometry_column != NULL)
+	free (cursor->f_geometry_column);
+    if (cursor->ref_geometry != NULL)
+	free (cursor->ref_geometry);
+    if (cursor->fids != NULL)
+	free (cursor->fids);
+    if (cursor->distances != NULL)
+	free (cursor->distances);
+    cursor->f_table_name = NULL;
+    cursor->f_geometry_column = NULL;
+    cursor->ref_geometry = NULL;
+    cursor->ref_geometry_sz = 0;
+    cursor->max_items = KNN_DEFAULT_ITEMS;
+    cursor->fids = NULL;
+    cursor->distances = NULL;
+    cursor->count = 0;
+    cursor->current = 0;
+}
+
+static int
+vknn_connect (sqlite3 * db, void *pAux, int argc, const char *const *argv,
+	      sqlite3_vtab ** ppVTab, char **pzErr)
+{
+/* connects the virtual table - simply aliases vknn_create() */
+    return vknn_create (db, pAux, argc, argv, ppVTab, pzErr);
+}
+
+static int
+vknn_best_index (sqlite3_vtab * pVTab, sqlite3_index_info * pIdxInfo)
+{
+/* best index selection */
+    int i;
+    int errors = 0;
+    int table = 0;
+    int geom = 0;
+    int ref = 0;
+    int max_items = 0;
+    int i_table = -1;
+    int i_geom = -1;
+    int i_ref = -1;
+    int i_max = -1;
+    int arg = 1;
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    for (i = 0; i < pIdxInfo->nConstraint; i++)
+      {
+	  /* verifying the constraints */
+	  struct sqlite3_index_constraint *p = &(pIdxInfo->aConstraint[i]);
+	  if (p->usable)
+	    {
+		if (p->iColumn == 0 && p->op == SQLITE_INDEX_CONSTRAINT_EQ)
+		  {
+		      table++;
+		      i_table = i;
+		  }
+		else if (p->iColumn == 1 && p->op == SQLITE_INDEX_CONSTRAINT_EQ)
+		  {
+		      geom++;
+		      i_geom = i;
+		  }
+		else if (p->iColumn == 2 && p->op == SQLITE_INDEX_CONSTRAINT_EQ)
+		  {
+		      ref++;
+		      i_ref = i;
+		  }
+		else if (p->iColumn == 3 && p->op == SQLITE_INDEX_CONSTRAINT_EQ)
+		  {
+		      max_items++;
+		      i_max = i;
+		  }
+		else
+		    errors++;
+	    }
+      }
+    if (table == 1 && ref == 1 && (geom == 0 || geom == 1)
+	&& (max_items == 0 || max_items == 1) && errors == 0)
+      {
+	  /*
+	     / this one is a valid KNN query
+	     / args: table_name, [geom_column], ref_geometry, [max_items]
+	   */
+	  pIdxInfo->idxNum = 1;
+	  if (geom)
+	      pIdxInfo->idxNum |= 2;
+	  if (max_items)
+	      pIdxInfo->idxNum |= 4;
+	  pIdxInfo->estimatedCost = 1.0;
+	  pIdxInfo->aConstraintUsage[i_table].argvIndex = arg++;
+	  pIdxInfo->aConstraintUsage[i_table].omit = 1;
+	  if (geom)
+	    {
+		pIdxInfo->aConstraintUsage[i_geom].argvIndex = arg++;
+		pIdxInfo->aConstraintUsage[i_geom].omit = 1;
+	    }
+	  pIdxInfo->aConstraintUsage[i_ref].argvIndex = arg++;
+	  pIdxInfo->aConstraintUsage[i_ref].omit = 1;
+	  if (max_items)
+	    {
+		pIdxInfo->aConstraintUsage[i_max].argvIndex = arg++;
+		pIdxInfo->aConstraintUsage[i_max].omit = 1;
+	    }
+      }
+    else
+      {
+	  /* illegal query */
+	  pIdxInfo->idxNum = 0;
+	  pIdxInfo->estimatedCost = 1.0e12;
+      }
+    return SQLITE_OK;
+}
+
+static int
+vknn_disconnect (sqlite3_vtab * pVTab)
+{
+/* disconnects the virtual table */
+    VirtualKnnPtr p_vt = (VirtualKnnPtr) pVTab;
+    sqlite3_free (p_vt);
+    return SQLITE_OK;
+}
+
+static int
+vknn_destroy (sqlite3_vtab * pVTab)
+{
+/* destroys the virtual table - simply aliases vknn_disconnect() */
+    return vknn_disconnect (pVTab);
+}
+
+static int
+vknn_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
+{
+/* opening a new cursor */
+    VirtualKnnCursorPtr cursor =
+	(VirtualKnnCursorPtr) sqlite3_malloc (sizeof (VirtualKnnCursor));
+    if (cursor == NULL)
+	return SQLITE_ERROR;
+    cursor->pVtab = (VirtualKnnPtr) pVTab;
+    cursor->eof = 1;
+    cursor->f_table_name = NULL;
+    cursor->f_geometry_column = NULL;
+    cursor->ref_geometry = NULL;
+    cursor->fids = NULL;
+    cursor->distances = NULL;
+    vknn_reset_cache (cursor);
+    *ppCursor = (sqlite3_vtab_cursor *) cursor;
+    return SQLITE_OK;
+}
+
+static int
+vknn_close (sqlite3_vtab_cursor * pCursor)
+{
+/* closing the cursor */
+    VirtualKnnCursorPtr cursor = (VirtualKnnCursorPtr) pCursor;
+    vknn_reset_cache (cursor);
+    sqlite3_free (pCursor);
+    return SQLITE_OK;
+}
+
+static int
+vknn_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
+	     int argc, sqlite3_value ** argv)
+{
+/* setting up a cursor filter */
+    const char *table_name = NULL;
+    const char *geom_column = NULL;
+    const unsigned char *blob = NULL;
+    int blob_sz = 0;
+    int max_items = KNN_DEFAULT_ITEMS;
+    char *xtable = NULL;
+    char *xgeom = NULL;
+    char *idx_name;
+    char *table_nameQ;
+    char *geo_nameQ;
+    char *sql_statement;
+    int srid;
+    int geographic = 0;
+    int ret;
+    int arg = 0;
+    double a;
+    double b;
+    double rf;
+    gaiaGeomCollPtr ref = NULL;
+    VirtualKnnContext ctx;
+    VirtualKnnCursorPtr cursor = (VirtualKnnCursorPtr) pCursor;
+    VirtualKnnPtr knn = (VirtualKnnPtr) cursor->pVtab;
+    if (idxStr)
+	idxStr = idxStr;	/* unused arg warning suppression */
+    memset (&ctx, 0, sizeof (VirtualKnnContext));
+    vknn_reset_cache (cursor);
+    cursor->eof = 1;
+    if (!(idxNum & 1))
+	return SQLITE_OK;
+
+/* retrieving the Table/Column/RefGeometry/MaxItems params */
+    if (argc < 2)
+	return SQLITE_OK;
+    if (sqlite3_value_type (argv[arg]) == SQLITE_TEXT)
+	table_name = (const char *) sqlite3_value_text (argv[arg]);
+    arg++;
+    if (idxNum & 2)
+      {
+	  if (sqlite3_value_type (argv[arg]) == SQLITE_TEXT)
+	      geom_column = (const char *) sqlite3_value_text (argv[arg]);
+	  else
+	      return SQLITE_OK;	/* invalid args */
+	  arg++;
+      }
+    if (arg >= argc)
+	return SQLITE_OK;
+    if (sqlite3_value_type (argv[arg]) == SQLITE_BLOB)
+      {
+	  blob = sqlite3_value_blob (argv[arg]);
+	  blob_sz = sqlite3_value_bytes (argv[arg]);
+      }
+    arg++;
+    if (idxNum & 4)
+      {
+	  if (arg >= argc)
+	      return SQLITE_OK;
+	  if (sqlite3_value_type (argv[arg]) == SQLITE_INTEGER)
+	      max_items = sqlite3_value_int (argv[arg]);
+	  else
+	      return SQLITE_OK;	/* invalid args */
+	  if (max_items < 1)
+	      return SQLITE_OK;
+	  if (max_items > KNN_MAX_ITEMS)
+	      max_items = KNN_MAX_ITEMS;
+      }
+    if (table_name == NULL || blob == NULL)
+	return SQLITE_OK;	/* invalid args */
+
+/* checking the reference Geometry */
+    ref = gaiaFromSpatiaLiteBlobWkb (blob, blob_sz);
+    if (ref == NULL)
+	return SQLITE_OK;
+    gaiaMbrGeometry (ref);
+    ctx.minx = ref->MinX;
+    ctx.miny = ref->MinY;
+    ctx.maxx = ref->MaxX;
+    ctx.maxy = ref->MaxY;
+
+/* checking if the corresponding Table/Geometry exists */
+    if (!vknn_find_geometry
+	(knn->db, table_name, geom_column, &xtable, &xgeom, &srid))
+	goto stop;
+    if (ref->Srid != srid)
+	goto stop;		/* mismatching SRIDs */
+    if (!srid_is_geographic (knn->db, srid, &geographic))
+	geographic = 0;
+    if (geographic)
+      {
+	  /* geodesic metric; a conservative radius for the lower bounds */
+	  if (!getEllipsoidParams (knn->db, srid, &a, &b, &rf))
+	    {
+		a = 6378137.0;
+		b = 6356752.314245;
+	    }
+	  ctx.geographic = 1;
+	  ctx.radius = (b * b / a) * 0.999;
+      }
+
+/* preparing the R*Tree node query */
+    idx_name = sqlite3_mprintf ("idx_%s_%s_node", xtable, xgeom);
+    table_nameQ = gaiaDoubleQuotedSql (idx_name);
+    sqlite3_free (idx_name);
+    sql_statement =
+	sqlite3_mprintf ("SELECT data FROM \"%s\" WHERE nodeno = ?",
+			 table_nameQ);
+    free (table_nameQ);
+    ret =
+	sqlite3_prepare_v2 (knn->db, sql_statement, strlen (sql_statement),
+			    &(ctx.stmt_node), NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	goto stop;
+
+/* preparing the exact distance query */
+    table_nameQ = gaiaDoubleQuotedSql (xtable);
+    geo_nameQ = gaiaDoubleQuotedSql (xgeom);
+    if (geographic)
+	sql_statement =
+	    sqlite3_mprintf
+	    ("SELECT Distance(\"%s\", ?, 1) FROM \"%s\" WHERE ROWID = ?",
+	     geo_nameQ, table_nameQ);
+    else
+	sql_statement =
+	    sqlite3_mprintf
+	    ("SELECT Distance(\"%s\", ?) FROM \"%s\" WHERE ROWID = ?",
+	     geo_nameQ, table_nameQ);
+    free (geo_nameQ);
+    free (table_nameQ);
+    ret =
+	sqlite3_prepare_v2 (knn->db, sql_statement, strlen (sql_statement),
+			    &(ctx.stmt_dist), NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	goto stop;
+    sqlite3_bind_blob (ctx.stmt_dist, 1, blob, blob_sz, SQLITE_STATIC);
+
+/* caching the reference args */
+    cursor->f_table_name = xtable;
+    xtable = NULL;
+    cursor->f_geometry_column = xgeom;
+    xgeom = NULL;
+    cursor->ref_geometry = malloc (blob_sz);
+    memcpy (cursor->ref_geometry, blob, blob_sz);
+    cursor->ref_geometry_sz = blob_sz;
+    cursor->max_items = max_items;
+
+/* searching the nearest features */
+    if (vknn_search (cursor, &ctx))
+      {
+	  if (cursor->count > 0)
+	      cursor->eof = 0;
+      }
+
+  stop:
+    if (ctx.stmt_node != NULL)
+	sqlite3_finalize (ctx.stmt_node);
+    if (ctx.stmt_dist != NULL)
+	sqlite3_finalize (ctx.stmt_dist);
+    if (ctx.queue.items != NULL)
+	free (ctx.queue.items);
+    if (ref != NULL)
+	gaiaFreeGeomColl (ref);
+    if (xtable)
+	free (xtable);
+    if (xgeom)
+	free (xgeom);
+    if (cursor->eof == 1)
+	vknn_reset_cache (cursor);
+    return SQLITE_OK;
+}
+
+static int
+vknn_next (sqlite3_vtab_cursor * pCursor)
+{
+/* fetching next row from cursor */
+    VirtualKnnCursorPtr cursor = (VirtualKnnCursorPtr) pCursor;
+    cursor->current += 1;
+    if (cursor->current >= cursor->count)
+	cursor->eof = 1;
+    return SQLITE_OK;
+}
+
+static int
+vknn_eof (sqlite3_vtab_cursor * pCursor)
+{
+/* cursor EOF */
+    VirtualKnnCursorPtr cursor = (VirtualKnnCursorPtr) pCursor;
+    return cursor->eof;
+}
+
+static int
+vknn_column (sqlite3_vtab_cursor * pCursor, sqlite3_context * pContext,
+	     int column)
+{
+/* fetching value for the Nth column */
+    VirtualKnnCursorPtr cursor = (VirtualKnnCursorPtr) pCursor;
+    if (cursor->eof)
+      {
+	  sqlite3_result_null (pContext);
+	  return SQLITE_OK;
+      }
+    if (column == 0)
+      {
+	  /* the "f_table_name" column */
+	  sqlite3_result_text (pContext, cursor->f_table_name,
+			       strlen (cursor->f_table_name), SQLITE_STATIC);
+      }
+    if (column == 1)
+      {
+	  /* the "f_geometry_column" column */
+	  sqlite3_result_text (pContext, cursor->f_geometry_column,
+			       strlen (cursor->f_geometry_column),
+			       SQLITE_STATIC);
+      }
+    if (column == 2)
+      {
+	  /* the "ref_geometry" column */
+	  sqlite3_result_blob (pContext, cursor->ref_geometry,
+			       cursor->ref_geometry_sz, SQLITE_STATIC);
+      }
+    if (column == 3)
+      {
+	  /* the "max_items" column */
+	  sqlite3_result_int (pContext, cursor->max_items);
+      }
+    if (column == 4)
+      {
+	  /* the "pos" column */
+	  sqlite3_result_int (pContext, cursor->current + 1);
+      }
+    if (column == 5)
+      {
+	  /* the "fid" column */
+	  sqlite3_result_int64 (pContext, cursor->fids[cursor->current]);
+      }
+    if (column == 6)
+      {
+	  /* the "distance" column */
+	  sqlite3_result_double (pContext,
+				 cursor->distances[cursor->current]);
+      }
+    return SQLITE_OK;
+}
+
+static int
+vknn_rowid (sqlite3_vtab_cursor * pCursor, sqlite_int64 * pRowid)
+{
+/* fetching the ROWID */
+    VirtualKnnCursorPtr cursor = (VirtualKnnCursorPtr) pCursor;
+    *pRowid = cursor->current;
+    return SQLITE_OK;
+}
+
+static int
+vknn_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
+	     sqlite_int64 * pRowid)
+{
+/* generic update [INSERT / UPDATE / DELETE */
+    if (pRowid || argc || argv || pVTab)
+	pRowid = pRowid;	/* unused arg warning suppression */
+/* read only datasource */
+    return SQLITE_READONLY;
+}
+
+static int
+vknn_begin (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vknn_sync (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vknn_commit (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vknn_rollback (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vknn_rename (sqlite3_vtab * pVTab, const char *zNew)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    if (zNew)
+	zNew = zNew;		/* unused arg warning suppression */
+    return SQLITE_ERROR;
+}
+
+static int
+spliteVirtualKnnInit (sqlite3 * db)
+{
+    int rc = SQLITE_OK;
+    my_knn_module.iVersion = 1;
+    my_knn_module.xCreate = &vknn_create;
+    my_knn_module.xConnect = &vknn_connect;
+    my_knn_module.xBestIndex = &vknn_best_index;
+    my_knn_module.xDisconnect = &vknn_disconnect;
+    my_knn_module.xDestroy = &vknn_destroy;
+    my_knn_module.xOpen = &vknn_open;
+    my_knn_module.xClose = &vknn_close;
+    my_knn_module.xFilter = &vknn_filter;
+    my_knn_module.xNext = &vknn_next;
+    my_knn_module.xEof = &vknn_eof;
+    my_knn_module.xColumn = &vknn_column;
+    my_knn_module.xRowid = &vknn_rowid;
+    my_knn_module.xUpdate = &vknn_update;
+    my_knn_module.xBegin = &vknn_begin;
+    my_knn_module.xSync = &vknn_sync;
+    my_knn_module.xCommit = &vknn_commit;
+    my_knn_module.xRollback = &vknn_rollback;
+    my_knn_module.xFindFunction = NULL;
+    my_knn_module.xRename = &vknn_rename;
+    sqlite3_create_module_v2 (db, "VirtualKNN", &my_knn_module, NULL, 0);
+    return rc;
+}
+
+SPATIALITE_PRIVATE int
+virtual_knn_extension_init (void *xdb)
+{
+    sqlite3 *db = (sqlite3 *) xdb;
+    return spliteVirtualKnnInit (db);
+}
@@ -60,6 +60,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <spatialite/spatialite.h>
 #include <spatialite/gaiaaux.h>
 #include <spatialite/gaiageo.h>
+#include <spatialite_private.h>
 
 #ifdef _WIN32
 #define strcasecmp	_stricmp
@@ -82,6 +83,22 @@ typedef struct VirtualSpatialIndexStruct
     int nRef;			/* # references: USED INTERNALLY BY SQLITE */
     char *zErrMsg;		/* error message: USE INTERNALLY BY SQLITE */
     sqlite3 *db;		/* the sqlite db holding the virtual table */
+    const void *p_cache;	/* pointer to the internal cache */
+    char *cache_table;		/* cached lookup: Table arg (may be DB= prefixed) */
+    char *cache_geom;		/* cached lookup: Geometry arg (may be NULL) */
+    char *cache_prefix;		/* cached lookup: DB prefix (may be NULL) */
+    char *cache_sql;		/* cached lookup: resolved R*Tree query */
+    int cache_qmbr;		/* TRUE if resolved to a Quantized MBR index */
+    int cache_srid;		/* cached lookup: the Geometry's SRID */
+    int cache_ellipsoid;	/* TRUE if the SRID is a geographic one */
+    double cache_a;		/* the SRID's ellipsoid (geographic SRIDs only) */
+    double cache_b;
+    int cache_valid;		/* TRUE if the cached lookup is valid */
+    int cache_generation;	/* bumped every time the lookup is resolved */
+    int schema_main;		/* MAIN schema version at lookup time */
+    int schema_prefix;		/* DB prefix schema version at lookup time */
+    sqlite3_stmt *stmt_main;	/* PRAGMA main.schema_version */
+    sqlite3_stmt *stmt_prefix;	/* PRAGMA <prefix>.schema_version */
 } VirtualSpatialIndex;
 typedef VirtualSpatialIndex *VirtualSpatialIndexPtr;
 
@@ -91,7 +108,33 @@ typedef struct VirtualSpatialIndexCursorStruct
     VirtualSpatialIndexPtr pVtab;	/* Virtual table of this cursor */
     int eof;			/* the EOF marker */
     sqlite3_stmt *stmt;
+    int stmt_generation;	/* lookup generation the stmt was prepared for */
     sqlite3_int64 CurrentRowId;
+/* scanning a Quantized MBR index */
+    int qmbr;			/* TRUE if scanning a Quantized MBR index */
+    const unsigned char *qmbr_data;	/* the current block */
+    sqlite3_int64 qmbr_block;	/* the current block ID */
+    int qmbr_item;		/* the current item within the block */
+    int qmbr_size;		/* the current block size [FLOAT or INT16] */
+    int qmbr_mode;		/* the FilterMbr relation to be evaluated */
+    double qmbr_minx;		/* the search frame */
+    double qmbr_miny;
+    double qmbr_maxx;
+    double qmbr_maxy;
+    double qmbr_frame[4];	/* the search frame, quantized as the block */
+/* searching by geodesic distance */
+    int geodesic;		/* TRUE if searching by distance (meters) */
+    double geo_lon;		/* the reference Point */
+    double geo_lat;
+    double geo_radius;		/* the search radius (meters) */
+    double geo_a;		/* the ellipsoid of the indexed Geometry */
+    double geo_b;
+    int geo_windows;		/* two windows when crossing the antimeridian */
+    int geo_current;		/* the current search window */
+    double geo_minx[2];
+    double geo_miny[2];
+    double geo_maxx[2];
+    double geo_maxy[2];
 } VirtualSpatialIndexCursor;
 typedef VirtualSpatialIndexCursor *VirtualSpatialIndexCursorPtr;
 
@@ -439,8 +482,120 @@ vspidx_find_rtree (sqlite3 * sqlite, const char *db_prefix,
     return 1;
 }
 
+static int
+vspidx_find_qmbr (sqlite3 * sqlite, const char *db_prefix,
+		  const char *table_name, const char *geom_column,
+		  char **real_table, char **real_geom)
+{
+/* attempts to find a Geometry Column supporting a Quantized MBR index */
+    sqlite3_stmt *stmt;
+    char *sql_statement;
+    char *quoted_db =
+	gaiaDoubleQuotedSql (db_prefix == NULL ? "main" : db_prefix);
+    int ret;
+    int count = 0;
+    char *rt = NULL;
+    char *rg = NULL;
+
+    sql_statement =
+	sqlite3_mprintf
+	("SELECT f_table_name, f_geometry_column FROM \"%s\".geometry_columns "
+	 "WHERE Upper(f_table_name) = Upper(%Q) AND EXISTS "
+	 "(SELECT name FROM \"%s\".sqlite_master WHERE type = 'table' "
+	 "AND Upper(name) = Upper('idx_' || f_table_name || '_' || "
+	 "f_geometry_column || '_qmbr'))", quoted_db, table_name, quoted_db);
+    if (geom_column != NULL)
+	sql_statement =
+	    sqlite3_mprintf ("%z AND Upper(f_geometry_column) = Upper(%Q)",
+			     sql_statement, geom_column);
+    free (quoted_db);
+    ret =
+	sqlite3_prepare_v2 (sqlite, sql_statement, strlen (sql_statement),
+			    &stmt, NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	return 0;
+    while (1)
+      {
+	  /* scrolling the result set rows */
+	  ret = sqlite3_step (stmt);
+	  if (ret == SQLITE_DONE)
+	      break;		/* end of result set */
+	  if (ret == SQLITE_ROW)
+	    {
+		const char *v = (const char *) sqlite3_column_text (stmt, 0);
+		int len = sqlite3_column_bytes (stmt, 0);
+		if (rt)
+		    free (rt);
+		rt = malloc (len + 1);
+		strcpy (rt, v);
+		v = (const char *) sqlite3_column_text (stmt, 1);
+		len = sqlite3_column_bytes (stmt, 1);
+		if (rg)
+		    free (rg);
+		rg = malloc (len + 1);
+		strcpy (rg, v);
+		count++;
+	    }
+      }
+    sqlite3_finalize (stmt);
+    if (count != 1)
+      {
+	  if (rt)
+	      free (rt);
+	  if (rg)
+	      free (rg);
+	  return 0;
+      }
+    *real_table = rt;
+    *real_geom = rg;
+    return 1;
+}
+
+static int
+vspidx_find_srid (sqlite3 * sqlite, const char *db_prefix,
+		  const char *table_name, const char *geom_column, int *srid)
+{
+/* retrieves the SRID of some Geometry Column */
+    sqlite3_stmt *stmt;
+    char *sql_statement;
+    char *quoted_db =
+	gaiaDoubleQuotedSql (db_prefix == NULL ? "main" : db_prefix);
+    int ret;
+    int count = 0;
+
+    sql_statement =
+	sqlite3_mprintf ("SELECT srid FROM \"%s\".geometry_columns "
+			 "WHERE Upper(f_table_name) = Upper(%Q) "
+			 "AND Upper(f_geometry_column) = Upper(%Q)", quoted_db,
+			 table_name, geom_column);
+    free (quoted_db);
+    ret =
+	sqlite3_prepare_v2 (sqlite, sql_statement, strlen (sql_statement),
+			    &stmt, NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	return 0;
+    while (1)
+      {
+	  /* scrolling the result set rows */
+	  ret = sqlite3_step (stmt);
+	  if (ret == SQLITE_DONE)
+	      break;		/* end of result set */
+	  if (ret == SQLITE_ROW)
+	    {
+		*srid = sqlite3_column_int (stmt, 0);
+		count++;
+	    }
+      }
+    sqlite3_finalize (stmt);
+    if (count != 1)
+	return 0;
+    return 1;
+}
+
 static void
-vspidx_parse_table_name (const char *tn, char **db_prefix, char **table_name)
+vspidx_parse_table_name(const char *tn, char **db_prefix, char **table_name)
 {
 /* attempting to extract an eventual DB prefix */
     int i;
@@ -474,6 +629,448 @@ vspidx_parse_table_name (const char *tn, char **db_prefix, char **table_name)
     strcpy (*table_name, tn);
 }
 
+static void
+vspidx_reset_cache (VirtualSpatialIndexPtr p_vt)
+{
+/* invalidating the cached R*Tree lookup */
+    if (p_vt->cache_table != NULL)
+	free (p_vt->cache_table);
+    if (p_vt->cache_geom != NULL)
+	free (p_vt->cache_geom);
+    if (p_vt->cache_prefix != NULL)
+	free (p_vt->cache_prefix);
+    if (p_vt->cache_sql != NULL)
+	sqlite3_free (p_vt->cache_sql);
+    if (p_vt->stmt_prefix != NULL)
+	sqlite3_finalize (p_vt->stmt_prefix);
+    p_vt->cache_table = NULL;
+    p_vt->cache_geom = NULL;
+    p_vt->cache_prefix = NULL;
+    p_vt->cache_sql = NULL;
+    p_vt->stmt_prefix = NULL;
+    p_vt->cache_qmbr = 0;
+    p_vt->cache_srid = -1;
+    p_vt->cache_ellipsoid = 0;
+    p_vt->cache_valid = 0;
+}
+
+static int
+vspidx_schema_version (sqlite3 * sqlite, const char *db_prefix,
+		       sqlite3_stmt ** stmt)
+{
+/* 
+/ returns the current schema version of MAIN or of some attached DB 
+/ (the PRAGMA statement is prepared only once, then simply reset)
+*/
+    int ret;
+    int version = -1;
+    if (*stmt == NULL)
+      {
+	  char *sql;
+	  char *quoted_db =
+	      gaiaDoubleQuotedSql (db_prefix == NULL ? "main" : db_prefix);
+	  sql = sqlite3_mprintf ("PRAGMA \"%s\".schema_version", quoted_db);
+	  free (quoted_db);
+	  ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), stmt, NULL);
+	  sqlite3_free (sql);
+	  if (ret != SQLITE_OK)
+	    {
+		*stmt = NULL;
+		return -1;
+	    }
+      }
+    ret = sqlite3_step (*stmt);
+    if (ret == SQLITE_ROW)
+	version = sqlite3_column_int (*stmt, 0);
+    sqlite3_reset (*stmt);
+    return version;
+}
+
+static int
+vspidx_resolve (VirtualSpatialIndexPtr p_vt, const char *tn,
+		const char *geom_column)
+{
+/* 
+/ resolves the R*Tree corresponding to Table/Geometry
+/ (or else the Quantized MBR index, if there is no R*Tree)
+/ 
+/ the lookup is cached by the virtual table, and is re-evaluated
+/ only when the Table/Geometry args or the DB schema do change
+*/
+    char *db_prefix = NULL;
+    char *table_name = NULL;
+    char *xtable = NULL;
+    char *xgeom = NULL;
+    char *idx_name;
+    char *idx_nameQ;
+    int exists;
+    int qmbr = 0;
+    int srid;
+    double rf;
+
+    if (p_vt->cache_valid)
+      {
+	  int same = 1;
+	  if (strcasecmp (p_vt->cache_table, tn) != 0)
+	      same = 0;
+	  if (geom_column == NULL && p_vt->cache_geom != NULL)
+	      same = 0;
+	  if (geom_column != NULL && p_vt->cache_geom == NULL)
+	      same = 0;
+	  if (geom_column != NULL && p_vt->cache_geom != NULL)
+	    {
+		if (strcasecmp (p_vt->cache_geom, geom_column) != 0)
+		    same = 0;
+	    }
+	  if (same)
+	    {
+		/* checking for schema changes */
+		if (vspidx_schema_version (p_vt->db, NULL, &(p_vt->stmt_main))
+		    != p_vt->schema_main)
+		    same = 0;
+		else if (p_vt->cache_prefix != NULL)
+		  {
+		      if (vspidx_schema_version
+			  (p_vt->db, p_vt->cache_prefix,
+			   &(p_vt->stmt_prefix)) != p_vt->schema_prefix)
+			  same = 0;
+		  }
+	    }
+	  if (same)
+	      return 1;
+      }
+    vspidx_reset_cache (p_vt);
+
+/* checking if the corresponding R*Tree exists */
+    vspidx_parse_table_name (tn, &db_prefix, &table_name);
+    if (geom_column != NULL)
+	exists =
+	    vspidx_check_rtree (p_vt->db, db_prefix, table_name, geom_column,
+				&xtable, &xgeom);
+    else
+	exists =
+	    vspidx_find_rtree (p_vt->db, db_prefix, table_name, &xtable,
+			       &xgeom);
+    if (!exists)
+      {
+	  /* no R*Tree: checking for a Quantized MBR index */
+	  exists =
+	      vspidx_find_qmbr (p_vt->db, db_prefix, table_name, geom_column,
+				&xtable, &xgeom);
+	  qmbr = exists;
+      }
+    free (table_name);
+    if (!exists)
+      {
+	  if (db_prefix)
+	      free (db_prefix);
+	  return 0;
+      }
+
+    if (qmbr)
+      {
+	  /* building the Quantized MBR index query */
+	  idx_name = sqlite3_mprintf ("idx_%s_%s_qmbr", xtable, xgeom);
+	  idx_nameQ = gaiaDoubleQuotedSql (idx_name);
+	  if (db_prefix == NULL)
+	      p_vt->cache_sql =
+		  sqlite3_mprintf ("SELECT block, data FROM \"%s\"",
+				   idx_nameQ);
+	  else
+	    {
+		char *quoted_db = gaiaDoubleQuotedSql (db_prefix);
+		p_vt->cache_sql =
+		    sqlite3_mprintf ("SELECT block, data FROM \"%s\".\"%s\"",
+				     quoted_db, idx_nameQ);
+		free (quoted_db);
+	    }
+      }
+    else
+      {
+	  /* building the RTree query */
+	  idx_name = sqlite3_mprintf ("idx_%s_%s", xtable, xgeom);
+	  idx_nameQ = gaiaDoubleQuotedSql (idx_name);
+	  if (db_prefix == NULL)
+	    {
+		p_vt->cache_sql =
+		    sqlite3_mprintf ("SELECT pkid, xmin, ymin, xmax, ymax FROM \"%s\" "
+				     "WHERE xmin <= ? AND xmax >= ? AND ymin <= ? AND ymax >= ?",
+				     idx_nameQ);
+	    }
+	  else
+	    {
+		char *quoted_db = gaiaDoubleQuotedSql (db_prefix);
+		p_vt->cache_sql =
+		    sqlite3_mprintf ("SELECT pkid, xmin, ymin, xmax, ymax FROM \"%s\".\"%s\" "
+				     "WHERE xmin <= ? AND xmax >= ? AND ymin <= ? AND ymax >= ?",
+				     quoted_db, idx_nameQ);
+		free (quoted_db);
+	    }
+      }
+    p_vt->cache_qmbr = qmbr;
+    free (idx_nameQ);
+    sqlite3_free (idx_name);
+
+/* resolving the SRID and its ellipsoid (geographic SRIDs only) */
+    if (vspidx_find_srid (p_vt->db, db_prefix, xtable, xgeom, &srid))
+      {
+	  p_vt->cache_srid = srid;
+	  p_vt->cache_ellipsoid =
+	      getEllipsoidParams_r (p_vt->p_cache, p_vt->db, srid,
+				    &(p_vt->cache_a), &(p_vt->cache_b), &rf);
+      }
+    free (xtable);
+    free (xgeom);
+
+/* caching the lookup */
+    p_vt->cache_table = malloc (strlen (tn) + 1);
+    strcpy (p_vt->cache_table, tn);
+    if (geom_column != NULL)
+      {
+	  p_vt->cache_geom = malloc (strlen (geom_column) + 1);
+	  strcpy (p_vt->cache_geom, geom_column);
+      }
+    p_vt->cache_prefix = db_prefix;
+    p_vt->schema_main =
+	vspidx_schema_version (p_vt->db, NULL, &(p_vt->stmt_main));
+    if (db_prefix != NULL)
+	p_vt->schema_prefix =
+	    vspidx_schema_version (p_vt->db, db_prefix, &(p_vt->stmt_prefix));
+    p_vt->cache_generation += 1;
+    p_vt->cache_valid = 1;
+    return 1;
+}
+
+static int
+vspidx_blob_mbr (const unsigned char *blob, int size, double *minx,
+		 double *miny, double *maxx, double *maxy)
+{
+/* 
+/ directly reading the MBR from the BLOB-Geometry header, 
+/ so to avoid fully decoding the search frame
+*/
+    int little_endian;
+    int endian_arch = gaiaEndianArch ();
+    if (size < 45)
+	return 0;		/* cannot be an internal BLOB WKB geometry */
+    if (*(blob + 0) != GAIA_MARK_START)
+	return 0;		/* failed to recognize START signature */
+    if (*(blob + (size - 1)) != GAIA_MARK_END)
+	return 0;		/* failed to recognize END signature */
+    if (*(blob + 38) != GAIA_MARK_MBR)
+	return 0;		/* failed to recognize MBR signature */
+    if (*(blob + 1) == GAIA_LITTLE_ENDIAN)
+	little_endian = 1;
+    else if (*(blob + 1) == GAIA_BIG_ENDIAN)
+	little_endian = 0;
+    else
+	return 0;		/* unknown encoding; neither little-endian nor big-endian */
+    *minx = gaiaImport64 (blob + 6, little_endian, endian_arch);
+    *miny = gaiaImport64 (blob + 14, little_endian, endian_arch);
+    *maxx = gaiaImport64 (blob + 22, little_endian, endian_arch);
+    *maxy = gaiaImport64 (blob + 30, little_endian, endian_arch);
+    return 1;
+}
+
+static int
+vspidx_geo_match (VirtualSpatialIndexCursorPtr cursor, double minx,
+		  double miny, double maxx, double maxy, int window)
+{
+/* 
+/ checks an MBR against the geodesic search windows, then discards
+/ it if its lower bound distance from the reference Point exceeds 
+/ the search radius
+/
+/ when scanning the R*Tree one window at a time, WINDOW must be 
+/ the first one intersecting the MBR, so that no item spanning
+/ both windows will ever be returned twice (-1: any window)
+*/
+    int i;
+    int first = -1;
+    for (i = 0; i < cursor->geo_windows; i++)
+      {
+	  if (minx > cursor->geo_maxx[i] || maxx < cursor->geo_minx[i]
+	      || miny > cursor->geo_maxy[i] || maxy < cursor->geo_miny[i])
+	      continue;
+	  first = i;
+	  break;
+      }
+    if (first < 0)
+	return 0;
+    if (window >= 0 && first != window)
+	return 0;
+    if (gaiaGeodesicMbrMinDistance
+	(cursor->geo_a, cursor->geo_b, cursor->geo_lat, cursor->geo_lon, minx,
+	 miny, maxx, maxy) > cursor->geo_radius)
+	return 0;
+    return 1;
+}
+
+static int
+vspidx_qmbr_match (int mode, const double *mbr, const double *frame)
+{
+/* 
+/ evaluating the FilterMbr relation between a quantized item and the
+/ search frame quantized the same way: never failing for an item 
+/ whose exact MBR does match
+*/
+    switch (mode)
+      {
+      case GAIA_FILTER_MBR_WITHIN:
+	  return (mbr[0] >= frame[0] && mbr[1] >= frame[1]
+		  && mbr[2] <= frame[2] && mbr[3] <= frame[3]);
+      case GAIA_FILTER_MBR_CONTAINS:
+	  return (mbr[0] <= frame[0] && mbr[1] <= frame[1]
+		  && mbr[2] >= frame[2] && mbr[3] >= frame[3]);
+      default:
+	  return (mbr[0] <= frame[2] && mbr[2] >= frame[0]
+		  && mbr[1] <= frame[3] && mbr[3] >= frame[1]);
+      };
+}
+
+static void
+vspidx_qmbr_read_row (VirtualSpatialIndexCursorPtr cursor)
+{
+/* 
+/ scanning the Quantized MBR index blocks so to fetch the next item
+/ matching the search frame: the MBRs are rounded outwards, and
+/ empty items are skipped
+*/
+    int ret;
+    double mbr[4];
+    while (1)
+      {
+	  cursor->qmbr_item += 1;
+	  if (cursor->qmbr_data == NULL
+	      || cursor->qmbr_item >= GAIA_QMBR_BLOCK_ITEMS)
+	    {
+		/* fetching the next block */
+		ret = sqlite3_step (cursor->stmt);
+		if (ret != SQLITE_ROW)
+		  {
+		      cursor->qmbr_data = NULL;
+		      cursor->eof = 1;
+		      return;
+		  }
+		cursor->qmbr_data = NULL;
+		if (sqlite3_column_type (cursor->stmt, 1) != SQLITE_BLOB)
+		    continue;	/* skipping an invalid block */
+		cursor->qmbr_size = sqlite3_column_bytes (cursor->stmt, 1);
+		if (!quantizeMbrFrame
+		    (sqlite3_column_blob (cursor->stmt, 1), cursor->qmbr_size,
+		     cursor->qmbr_minx, cursor->qmbr_miny, cursor->qmbr_maxx,
+		     cursor->qmbr_maxy, cursor->qmbr_frame))
+		    continue;	/* skipping an invalid block */
+		cursor->qmbr_block = sqlite3_column_int64 (cursor->stmt, 0);
+		cursor->qmbr_data = sqlite3_column_blob (cursor->stmt, 1);
+		cursor->qmbr_item = 0;
+	    }
+	  if (!getQuantizedMbr
+	      (cursor->qmbr_data, cursor->qmbr_size, cursor->qmbr_item, mbr))
+	      continue;		/* empty item */
+	  if (cursor->geodesic)
+	    {
+		double minx;
+		double miny;
+		double maxx;
+		double maxy;
+		dequantizeMbr (cursor->qmbr_data, cursor->qmbr_size, mbr,
+			       &minx, &miny, &maxx, &maxy);
+		if (!vspidx_geo_match (cursor, minx, miny, maxx, maxy, -1))
+		    continue;
+		cursor->CurrentRowId =
+		    (cursor->qmbr_block * GAIA_QMBR_BLOCK_ITEMS) +
+		    cursor->qmbr_item;
+		return;
+	    }
+	  if (vspidx_qmbr_match (cursor->qmbr_mode, mbr, cursor->qmbr_frame))
+	    {
+		cursor->CurrentRowId =
+		    (cursor->qmbr_block * GAIA_QMBR_BLOCK_ITEMS) +
+		    cursor->qmbr_item;
+		return;
+	    }
+      }
+}
+
+static void
+vspidx_bind_mbr (sqlite3_stmt * stmt, double g_minx, double g_miny,
+		 double g_maxx, double g_maxy)
+{
+/* binding the R*Tree query params [MBR] */
+    float minx;
+    float miny;
+    float maxx;
+    float maxy;
+    double tic;
+    double tic2;
+/* adjusting the MBR so to compensate for DOUBLE/FLOAT truncations */
+    minx = (float) g_minx;
+    miny = (float) g_miny;
+    maxx = (float) g_maxx;
+    maxy = (float) g_maxy;
+    tic = fabs (g_minx - minx);
+    tic2 = fabs (g_miny - miny);
+    if (tic2 > tic)
+	tic = tic2;
+    tic2 = fabs (g_maxx - maxx);
+    if (tic2 > tic)
+	tic = tic2;
+    tic2 = fabs (g_maxy - maxy);
+    if (tic2 > tic)
+	tic = tic2;
+    tic *= 2.0;
+    sqlite3_bind_double (stmt, 1, g_maxx + tic);
+    sqlite3_bind_double (stmt, 2, g_minx - tic);
+    sqlite3_bind_double (stmt, 3, g_maxy + tic);
+    sqlite3_bind_double (stmt, 4, g_miny - tic);
+}
+
+static void
+vspidx_rtree_read_row (VirtualSpatialIndexCursorPtr cursor)
+{
+/* 
+/ fetching the next R*Tree item; geodesic searches are evaluated
+/ one window at a time, and then pruned by lower bound distance
+*/
+    int ret;
+    int i;
+    while (1)
+      {
+	  ret = sqlite3_step (cursor->stmt);
+	  if (ret != SQLITE_ROW)
+	    {
+		if (cursor->geodesic
+		    && cursor->geo_current + 1 < cursor->geo_windows)
+		  {
+		      /* moving to the next search window */
+		      cursor->geo_current += 1;
+		      i = cursor->geo_current;
+		      sqlite3_reset (cursor->stmt);
+		      vspidx_bind_mbr (cursor->stmt, cursor->geo_minx[i],
+				       cursor->geo_miny[i],
+				       cursor->geo_maxx[i],
+				       cursor->geo_maxy[i]);
+		      continue;
+		  }
+		cursor->eof = 1;
+		return;
+	    }
+	  if (cursor->geodesic)
+	    {
+		if (!vspidx_geo_match
+		    (cursor, sqlite3_column_double (cursor->stmt, 1),
+		     sqlite3_column_double (cursor->stmt, 2),
+		     sqlite3_column_double (cursor->stmt, 3),
+		     sqlite3_column_double (cursor->stmt, 4),
+		     cursor->geo_current))
+		    continue;
+	    }
+	  cursor->CurrentRowId = sqlite3_column_int64 (cursor->stmt, 0);
+	  return;
+      }
+}
+
 static int
 vspidx_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
 	       sqlite3_vtab ** ppVTab, char **pzErr)
@@ -483,8 +1080,6 @@ vspidx_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
     char *buf;
     char *vtable;
     char *xname;
-    if (pAux)
-	pAux = pAux;		/* unused arg warning suppression */
     if (argc == 3)
       {
 	  vtable = gaiaDequotedSql ((char *) argv[2]);
@@ -501,13 +1096,28 @@ vspidx_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
     if (!p_vt)
 	return SQLITE_NOMEM;
     p_vt->db = db;
+    p_vt->p_cache = pAux;
     p_vt->pModule = &my_spidx_module;
     p_vt->nRef = 0;
     p_vt->zErrMsg = NULL;
+    p_vt->cache_table = NULL;
+    p_vt->cache_geom = NULL;
+    p_vt->cache_prefix = NULL;
+    p_vt->cache_sql = NULL;
+    p_vt->cache_qmbr = 0;
+    p_vt->cache_srid = -1;
+    p_vt->cache_ellipsoid = 0;
+    p_vt->cache_valid = 0;
+    p_vt->cache_generation = 0;
+    p_vt->schema_main = -1;
+    p_vt->schema_prefix = -1;
+    p_vt->stmt_main = NULL;
+    p_vt->stmt_prefix = NULL;
 /* preparing the COLUMNs for this VIRTUAL TABLE */
     xname = gaiaDoubleQuotedSql (vtable);
     buf = sqlite3_mprintf ("CREATE TABLE \"%s\" (f_table_name TEXT, "
-			   "f_geometry_column TEXT, search_frame BLOB)", xname);
+			   "f_geometry_column TEXT, search_frame BLOB, "
+			   "search_radius DOUBLE)", xname);
     free (xname);
     free (vtable);
     if (sqlite3_declare_vtab (db, buf) != SQLITE_OK)
@@ -542,6 +1152,8 @@ vspidx_best_index (sqlite3_vtab * pVTab, sqlite3_index_info * pIdxInfo)
     int table = 0;
     int geom = 0;
     int mbr = 0;
+    int radius = 0;
+    int arg;
     if (pVTab)
 	pVTab = pVTab;		/* unused arg warning suppression */
     for (i = 0; i < pIdxInfo->nConstraint; i++)
@@ -556,23 +1168,30 @@ vspidx_best_index (sqlite3_vtab * pVTab, sqlite3_index_info * pIdxInfo)
 		    geom++;
 		else if (p->iColumn == 2 && p->op == SQLITE_INDEX_CONSTRAINT_EQ)
 		    mbr++;
+		else if (p->iColumn == 3 && p->op == SQLITE_INDEX_CONSTRAINT_EQ)
+		    radius++;
 		else
 		    errors++;
 	    }
       }
-    if (table == 1 && (geom == 0 || geom == 1) && mbr == 1 && errors == 0)
+    if (table == 1 && (geom == 0 || geom == 1) && mbr == 1
+	&& (radius == 0 || radius == 1) && errors == 0)
       {
 	  /* this one is a valid SpatialIndex query */
 	  if (geom == 1)
-	      pIdxInfo->idxNum = 1;
+	      pIdxInfo->idxNum = (radius == 1) ? 3 : 1;
 	  else
-	      pIdxInfo->idxNum = 2;
+	      pIdxInfo->idxNum = (radius == 1) ? 4 : 2;
 	  pIdxInfo->estimatedCost = 1.0;
 	  for (i = 0; i < pIdxInfo->nConstraint; i++)
 	    {
 		if (pIdxInfo->aConstraint[i].usable)
 		  {
-		      pIdxInfo->aConstraintUsage[i].argvIndex = i + 1;
+		      /* args are always passed in column order */
+		      arg = pIdxInfo->aConstraint[i].iColumn + 1;
+		      if (geom == 0 && arg > 1)
+			  arg--;
+		      pIdxInfo->aConstraintUsage[i].argvIndex = arg;
 		      pIdxInfo->aConstraintUsage[i].omit = 1;
 		  }
 	    }
@@ -591,6 +1210,9 @@ vspidx_disconnect (sqlite3_vtab * pVTab)
 {
 /* disconnects the virtual table */
     VirtualSpatialIndexPtr p_vt = (VirtualSpatialIndexPtr) pVTab;
+    vspidx_reset_cache (p_vt);
+    if (p_vt->stmt_main != NULL)
+	sqlite3_finalize (p_vt->stmt_main);
     sqlite3_free (p_vt);
     return SQLITE_OK;
 }
@@ -613,6 +1235,14 @@ vspidx_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
 	return SQLITE_ERROR;
     cursor->pVtab = (VirtualSpatialIndexPtr) pVTab;
     cursor->stmt = NULL;
+    cursor->stmt_generation = -1;
+    cursor->qmbr = 0;
+    cursor->qmbr_data = NULL;
+    cursor->qmbr_block = 0;
+    cursor->qmbr_item = 0;
+    cursor->geodesic = 0;
+    cursor->geo_windows = 0;
+    cursor->geo_current = 0;
     cursor->eof = 1;
     *ppCursor = (sqlite3_vtab_cursor *) cursor;
     return SQLITE_OK;
@@ -635,166 +1265,175 @@ vspidx_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
 	       int argc, sqlite3_value ** argv)
 {
 /* setting up a cursor filter */
-    char *db_prefix = NULL;
-    char *table_name = NULL;
-    char *geom_column;
-    char *xtable = NULL;
-    char *xgeom = NULL;
-    char *idx_name;
-    char *idx_nameQ;
-    char *sql_statement;
-    gaiaGeomCollPtr geom = NULL;
-    int ok_table = 0;
-    int ok_geom = 0;
-    const unsigned char *blob;
-    int size;
-    int exists;
+    const char *table_name = NULL;
+    const char *geom_column = NULL;
+    const unsigned char *blob = NULL;
+    int size = 0;
     int ret;
-    sqlite3_stmt *stmt;
-    float minx;
-    float miny;
-    float maxx;
-    float maxy;
-    double tic;
-    double tic2;
+    int geodesic = 0;
+    int mode = GAIA_FILTER_MBR_INTERSECTS;
+    double radius = 0.0;
+    double g_minx;
+    double g_miny;
+    double g_maxx;
+    double g_maxy;
     VirtualSpatialIndexCursorPtr cursor =
 	(VirtualSpatialIndexCursorPtr) pCursor;
     VirtualSpatialIndexPtr spidx = (VirtualSpatialIndexPtr) cursor->pVtab;
     if (idxStr)
 	idxStr = idxStr;	/* unused arg warning suppression */
     cursor->eof = 1;
-    if (idxNum == 1 && argc == 3)
+    if ((idxNum == 1 && argc == 3) || (idxNum == 3 && argc == 4))
       {
 	  /* retrieving the Table/Column/MBR params */
 	  if (sqlite3_value_type (argv[0]) == SQLITE_TEXT)
-	    {
-		char *tn = (char *) sqlite3_value_text (argv[0]);
-		vspidx_parse_table_name (tn, &db_prefix, &table_name);
-		ok_table = 1;
-	    }
+	      table_name = (const char *) sqlite3_value_text (argv[0]);
 	  if (sqlite3_value_type (argv[1]) == SQLITE_TEXT)
-	    {
-		geom_column = (char *) sqlite3_value_text (argv[1]);
-		ok_geom = 1;
-	    }
+	      geom_column = (const char *) sqlite3_value_text (argv[1]);
 	  if (sqlite3_value_type (argv[2]) == SQLITE_BLOB)
 	    {
 		blob = sqlite3_value_blob (argv[2]);
 		size = sqlite3_value_bytes (argv[2]);
-		geom = gaiaFromSpatiaLiteBlobWkb (blob, size);
-	    }
-	  if (ok_table && ok_geom && geom)
-	      ;
-	  else
-	    {
-		/* invalid args */
-		goto stop;
 	    }
+	  if (table_name == NULL || geom_column == NULL || blob == NULL)
+	      return SQLITE_OK;	/* invalid args */
       }
-    if (idxNum == 2 && argc == 2)
+    else if ((idxNum == 2 && argc == 2) || (idxNum == 4 && argc == 3))
       {
 	  /* retrieving the Table/MBR params */
 	  if (sqlite3_value_type (argv[0]) == SQLITE_TEXT)
-	    {
-		char *tn = (char *) sqlite3_value_text (argv[0]);
-		vspidx_parse_table_name (tn, &db_prefix, &table_name);
-		ok_table = 1;
-	    }
+	      table_name = (const char *) sqlite3_value_text (argv[0]);
 	  if (sqlite3_value_type (argv[1]) == SQLITE_BLOB)
 	    {
 		blob = sqlite3_value_blob (argv[1]);
 		size = sqlite3_value_bytes (argv[1]);
-		geom = gaiaFromSpatiaLiteBlobWkb (blob, size);
 	    }
-	  if (ok_table && geom)
-	      ;
+	  if (table_name == NULL || blob == NULL)
+	      return SQLITE_OK;	/* invalid args */
+      }
+    else
+	return SQLITE_OK;
+    if (idxNum == 3 || idxNum == 4)
+      {
+	  /* retrieving the search radius (meters) */
+	  sqlite3_value *value = argv[argc - 1];
+	  if (sqlite3_value_type (value) == SQLITE_INTEGER)
+	      radius = sqlite3_value_int (value);
+	  else if (sqlite3_value_type (value) == SQLITE_FLOAT)
+	      radius = sqlite3_value_double (value);
 	  else
-	    {
-		/* invalid args */
-		goto stop;
-	    }
+	      return SQLITE_OK;	/* invalid args */
+	  if (radius < 0.0)
+	      return SQLITE_OK;	/* invalid args */
+	  geodesic = 1;
       }
 
-/* checking if the corresponding R*Tree exists */
-    if (ok_geom)
-	exists =
-	    vspidx_check_rtree (spidx->db, db_prefix, table_name, geom_column,
-				&xtable, &xgeom);
+/* retrieving the search frame MBR */
+    if (vspidx_blob_mbr (blob, size, &g_minx, &g_miny, &g_maxx, &g_maxy))
+	;
+    else if (gaiaParseFilterMbr
+	     ((unsigned char *) blob, size, &g_minx, &g_miny, &g_maxx, &g_maxy,
+	      &mode))
+      {
+	  /* a FilterMbrWithin/Contains/Intersects() search frame */
+	  if (mode != GAIA_FILTER_MBR_WITHIN
+	      && mode != GAIA_FILTER_MBR_CONTAINS
+	      && mode != GAIA_FILTER_MBR_INTERSECTS)
+	      return SQLITE_OK;	/* invalid args */
+      }
     else
-	exists =
-	    vspidx_find_rtree (spidx->db, db_prefix, table_name, &xtable,
-			       &xgeom);
-    if (!exists)
-	goto stop;
+      {
+	  /* not a plain BLOB-Geometry: fully decoding */
+	  gaiaGeomCollPtr geom = gaiaFromSpatiaLiteBlobWkb (blob, size);
+	  if (geom == NULL)
+	      return SQLITE_OK;	/* invalid args */
+	  gaiaMbrGeometry (geom);
+	  g_minx = geom->MinX;
+	  g_miny = geom->MinY;
+	  g_maxx = geom->MaxX;
+	  g_maxy = geom->MaxY;
+	  gaiaFreeGeomColl (geom);
+      }
 
-/* building the RTree query */
-    idx_name = sqlite3_mprintf ("idx_%s_%s", xtable, xgeom);
-    idx_nameQ = gaiaDoubleQuotedSql (idx_name);
-    if (db_prefix == NULL)
+/* resolving the corresponding R*Tree (cached) */
+    if (!vspidx_resolve (spidx, table_name, geom_column))
+	return SQLITE_OK;
+
+    cursor->geodesic = geodesic;
+    if (geodesic)
       {
-	  sql_statement = sqlite3_mprintf ("SELECT pkid FROM \"%s\" WHERE "
-					   "xmin <= ? AND xmax >= ? AND ymin <= ? AND ymax >= ?",
-					   idx_nameQ);
+	  /* the search frame is expected to be a single lon/lat Point */
+	  if (mode != GAIA_FILTER_MBR_INTERSECTS)
+	      return SQLITE_OK;	/* invalid args */
+	  if (g_minx != g_maxx || g_miny != g_maxy)
+	      return SQLITE_OK;	/* invalid args */
+	  if (!spidx->cache_ellipsoid)
+	      return SQLITE_OK;	/* not a geographic SRID: meters are meaningless */
+	  cursor->geo_a = spidx->cache_a;
+	  cursor->geo_b = spidx->cache_b;
+	  cursor->geo_lon = g_minx;
+	  cursor->geo_lat = g_miny;
+	  cursor->geo_radius = radius;
+	  cursor->geo_current = 0;
+	  cursor->geo_windows =
+	      gaiaGeodesicSearchWindows (cursor->geo_a, cursor->geo_b,
+					 g_miny, g_minx, radius,
+					 cursor->geo_minx, cursor->geo_miny,
+					 cursor->geo_maxx, cursor->geo_maxy);
+	  if (cursor->geo_windows < 1)
+	      return SQLITE_OK;	/* invalid args */
+	  g_minx = cursor->geo_minx[0];
+	  g_miny = cursor->geo_miny[0];
+	  g_maxx = cursor->geo_maxx[0];
+	  g_maxy = cursor->geo_maxy[0];
+      }
+
+    if (cursor->stmt != NULL
+	&& cursor->stmt_generation == spidx->cache_generation)
+      {
+	  /* reusing the already prepared RTree query */
+	  sqlite3_reset (cursor->stmt);
+	  sqlite3_clear_bindings (cursor->stmt);
       }
     else
       {
-	  char *quoted_db = gaiaDoubleQuotedSql (db_prefix);
-	  sql_statement =
-	      sqlite3_mprintf ("SELECT pkid FROM \"%s\".\"%s\" WHERE "
-			       "xmin <= ? AND xmax >= ? AND ymin <= ? AND ymax >= ?",
-			       quoted_db, idx_nameQ);
-	  free (quoted_db);
+	  /* preparing the RTree query */
+	  if (cursor->stmt != NULL)
+	      sqlite3_finalize (cursor->stmt);
+	  cursor->stmt = NULL;
+	  ret =
+	      sqlite3_prepare_v2 (spidx->db, spidx->cache_sql,
+				  strlen (spidx->cache_sql), &(cursor->stmt),
+				  NULL);
+	  if (ret != SQLITE_OK)
+	    {
+		cursor->stmt = NULL;
+		return SQLITE_OK;
+	    }
+	  cursor->stmt_generation = spidx->cache_generation;
       }
-    free (idx_nameQ);
-    sqlite3_free (idx_name);
-    ret =
-	sqlite3_prepare_v2 (spidx->db, sql_statement, strlen (sql_statement),
-			    &stmt, NULL);
-    sqlite3_free (sql_statement);
-    if (ret != SQLITE_OK)
-	goto stop;
-/* binding stmt params [MBR] */
-    gaiaMbrGeometry (geom);
 
-/* adjusting the MBR so to compensate for DOUBLE/FLOAT truncations */
-    minx = (float) (geom->MinX);
-    miny = (float) (geom->MinY);
-    maxx = (float) (geom->MaxX);
-    maxy = (float) (geom->MaxY);
-    tic = fabs (geom->MinX - minx);
-    tic2 = fabs (geom->MinY - miny);
-    if (tic2 > tic)
-	tic = tic2;
-    tic2 = fabs (geom->MaxX - maxx);
-    if (tic2 > tic)
-	tic = tic2;
-    tic2 = fabs (geom->MaxY - maxy);
-    if (tic2 > tic)
-	tic = tic2;
-    tic *= 2.0;
-    sqlite3_bind_double (stmt, 1, geom->MaxX + tic);
-    sqlite3_bind_double (stmt, 2, geom->MinX - tic);
-    sqlite3_bind_double (stmt, 3, geom->MaxY + tic);
-    sqlite3_bind_double (stmt, 4, geom->MinY - tic);
-    cursor->stmt = stmt;
+    if (spidx->cache_qmbr)
+      {
+	  /* scanning the Quantized MBR index */
+	  cursor->qmbr = 1;
+	  cursor->qmbr_data = NULL;
+	  cursor->qmbr_item = 0;
+	  cursor->qmbr_mode = mode;
+	  cursor->qmbr_minx = g_minx;
+	  cursor->qmbr_miny = g_miny;
+	  cursor->qmbr_maxx = g_maxx;
+	  cursor->qmbr_maxy = g_maxy;
+	  cursor->eof = 0;
+	  vspidx_qmbr_read_row (cursor);
+	  return SQLITE_OK;
+      }
+
+    cursor->qmbr = 0;
+    vspidx_bind_mbr (cursor->stmt, g_minx, g_miny, g_maxx, g_maxy);
     cursor->eof = 0;
 /* fetching the first ResultSet's row */
-    ret = sqlite3_step (cursor->stmt);
-    if (ret == SQLITE_ROW)
-	cursor->CurrentRowId = sqlite3_column_int64 (cursor->stmt, 0);
-    else
-	cursor->eof = 1;
-  stop:
-    if (geom)
-	gaiaFreeGeomColl (geom);
-    if (xtable)
-	free (xtable);
-    if (xgeom)
-	free (xgeom);
-    if (db_prefix)
-	free (db_prefix);
-    if (table_name)
-	free (table_name);
+    vspidx_rtree_read_row (cursor);
     return SQLITE_OK;
 }
 
@@ -802,14 +1441,14 @@ static int
 vspidx_next (sqlite3_vtab_cursor * pCursor)
 {
 /* fetching a next row from cursor */
-    int ret;
     VirtualSpatialIndexCursorPtr cursor =
 	(VirtualSpatialIndexCursorPtr) pCursor;
-    ret = sqlite3_step (cursor->stmt);
-    if (ret == SQLITE_ROW)
-	cursor->CurrentRowId = sqlite3_column_int64 (cursor->stmt, 0);
-    else
-	cursor->eof = 1;
+    if (cursor->qmbr)
+      {
+	  vspidx_qmbr_read_row (cursor);
+	  return SQLITE_OK;
+      }
+    vspidx_rtree_read_row (cursor);
     return SQLITE_OK;
 }
 
@@ -906,7 +1545,7 @@ vspidx_rename (sqlite3_vtab * pVTab, const char *zNew)
 }
 
 static int
-spliteVirtualSpatialIndexInit (sqlite3 * db)
+spliteVirtualSpatialIndexInit (sqlite3 * db, void *p_cache)
 {
     int rc = SQLITE_OK;
     my_spidx_module.iVersion = 1;
@@ -929,14 +1568,14 @@ spliteVirtualSpatialIndexInit (sqlite3 * db)
     my_spidx_module.xRollback = &vspidx_rollback;
     my_spidx_module.xFindFunction = NULL;
     my_spidx_module.xRename = &vspidx_rename;
-    sqlite3_create_module_v2 (db, "VirtualSpatialIndex", &my_spidx_module, NULL,
-			      0);
+    sqlite3_create_module_v2 (db, "VirtualSpatialIndex", &my_spidx_module,
+			      p_cache, 0);
     return rc;
 }
 
 SPATIALITE_PRIVATE int
-virtual_spatialindex_extension_init (void *xdb)
+virtual_spatialindex_extension_init (void *xdb, const void *p_cache)
 {
     sqlite3 *db = (sqlite3 *) xdb;
-    return spliteVirtualSpatialIndexInit (db);
+    return spliteVirtualSpatialIndexInit (db, (void *) p_cache);
 }
@@ -0,0 +1,1253 @@
+/*
+
+ virtualspatialjoin.c -- SQLite3 extension [VIRTUAL TABLE SpatialJoin]
+
+ version 4.3, 2015 June 29
+
+ Author: Sandro Furieri a.furieri@lqt.it
+
+ -----------------------------------------------------------------------------
+ 
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+ 
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+ 
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+ 
+Portions created by the Initial Developer are Copyright (C) 2008-2015
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+ 
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "config-msvc.h"
+#else
+#include "config.h"
+#endif
+
+#include <spatialite/sqlite.h>
+
+#include <spatialite/spatialite.h>
+#include <spatialite/gaiaaux.h>
+#include <spatialite/gaiageo.h>
+
+#ifdef _WIN32
+#define strcasecmp	_stricmp
+#endif /* not WIN32 */
+
+#define SJOIN_MBR		0
+#define SJOIN_INTERSECTS	1
+#define SJOIN_CONTAINS		2
+#define SJOIN_WITHIN		3
+#define SJOIN_TOUCHES		4
+#define SJOIN_OVERLAPS		5
+#define SJOIN_CROSSES		6
+#define SJOIN_COVERS		7
+#define SJOIN_COVEREDBY		8
+#define SJOIN_EQUALS		9
+
+#define SJOIN_NODE_CACHE	128
+/* SQLite never stores more than 51 cells into a R*Tree node */
+#define SJOIN_MAX_CELLS		64
+
+static struct sqlite3_module my_sjoin_module;
+
+
+/******************************************************************************
+/
+/ VirtualTable structs
+/
+******************************************************************************/
+
+typedef struct VirtualSpatialJoinStruct
+{
+/* extends the sqlite3_vtab struct */
+    const sqlite3_module *pModule;	/* ptr to sqlite module: USED INTERNALLY BY SQLITE */
+    int nRef;			/* # references: USED INTERNALLY BY SQLITE */
+    char *zErrMsg;		/* error message: USE INTERNALLY BY SQLITE */
+    sqlite3 *db;		/* the sqlite db holding the virtual table */
+    const void *p_cache;	/* pointer to the internal cache */
+} VirtualSpatialJoin;
+typedef VirtualSpatialJoin *VirtualSpatialJoinPtr;
+
+typedef struct VirtualSpatialJoinCellStruct
+{
+/* a R*Tree cell */
+    sqlite3_int64 id;
+    double minx;
+    double miny;
+    double maxx;
+    double maxy;
+} VirtualSpatialJoinCell;
+typedef VirtualSpatialJoinCell *VirtualSpatialJoinCellPtr;
+
+typedef struct VirtualSpatialJoinNodeStruct
+{
+/* a decoded R*Tree node */
+    sqlite3_int64 nodeno;
+    int n_cells;
+    VirtualSpatialJoinCellPtr cells;
+} VirtualSpatialJoinNode;
+typedef VirtualSpatialJoinNode *VirtualSpatialJoinNodePtr;
+
+typedef struct VirtualSpatialJoinTreeStruct
+{
+/* a R*Tree being traversed */
+    char *table;		/* the indexed table */
+    char *geometry;		/* the indexed geometry column */
+    int depth;			/* the R*Tree depth */
+    sqlite3_stmt *stmt_node;	/* fetches a R*Tree node */
+    sqlite3_stmt *stmt_geom;	/* fetches a Geometry by ROWID */
+    VirtualSpatialJoinNode cache[SJOIN_NODE_CACHE];	/* decoded nodes */
+/* the currently decoded Geometry */
+    sqlite3_int64 geom_rowid;
+    gaiaGeomCollPtr geom;
+    unsigned char *blob;
+    int blob_sz;
+} VirtualSpatialJoinTree;
+typedef VirtualSpatialJoinTree *VirtualSpatialJoinTreePtr;
+
+typedef struct VirtualSpatialJoinTaskStruct
+{
+/* a pair of R*Tree nodes still to be joined */
+    sqlite3_int64 left_node;
+    int left_level;
+    sqlite3_int64 right_node;
+    int right_level;
+    double minx;		/* the search space restriction */
+    double miny;
+    double maxx;
+    double maxy;
+} VirtualSpatialJoinTask;
+typedef VirtualSpatialJoinTask *VirtualSpatialJoinTaskPtr;
+
+typedef struct VirtualSpatialJoinCursorStruct
+{
+/* extends the sqlite3_vtab_cursor struct */
+    VirtualSpatialJoinPtr pVtab;	/* Virtual table of this cursor */
+    int eof;			/* the EOF marker */
+    int predicate;		/* the spatial predicate to be evaluated */
+    char *predicate_name;
+    VirtualSpatialJoinTree left;
+    VirtualSpatialJoinTree right;
+/* the stack of node pairs still to be joined */
+    VirtualSpatialJoinTaskPtr tasks;
+    int n_tasks;
+    int tasks_allocated;
+/* the candidate pairs produced by the last joined leaves */
+    sqlite3_int64 *candidates;
+    int n_candidates;
+    int candidates_allocated;
+    int next_candidate;
+/* the current row */
+    sqlite3_int64 current_row;
+    sqlite3_int64 left_rowid;
+    sqlite3_int64 right_rowid;
+} VirtualSpatialJoinCursor;
+typedef VirtualSpatialJoinCursor *VirtualSpatialJoinCursorPtr;
+
+static int
+vsjoin_parse_predicate (const char *name)
+{
+/* identifying the spatial predicate */
+    if (strcasecmp (name, "mbr") == 0
+	|| strcasecmp (name, "MbrIntersects") == 0)
+	return SJOIN_MBR;
+#ifndef OMIT_GEOS		/* GEOS is supported */
+    if (strcasecmp (name, "intersects") == 0)
+	return SJOIN_INTERSECTS;
+    if (strcasecmp (name, "contains") == 0)
+	return SJOIN_CONTAINS;
+    if (strcasecmp (name, "within") == 0)
+	return SJOIN_WITHIN;
+    if (strcasecmp (name, "touches") == 0)
+	return SJOIN_TOUCHES;
+    if (strcasecmp (name, "overlaps") == 0)
+	return SJOIN_OVERLAPS;
+    if (strcasecmp (name, "crosses") == 0)
+	return SJOIN_CROSSES;
+    if (strcasecmp (name, "covers") == 0)
+	return SJOIN_COVERS;
+    if (strcasecmp (name, "coveredby") == 0)
+	return SJOIN_COVEREDBY;
+    if (strcasecmp (name, "equals") == 0)
+	return SJOIN_EQUALS;
+#endif /* end GEOS conditional */
+    return -1;
+}
+
+static int
+vsjoin_find_geometry (sqlite3 * sqlite, const char *table_name,
+		      const char *geom_column, char **real_table,
+		      char **real_geom)
+{
+/* checks if the required Geometry is actually defined and indexed */
+    sqlite3_stmt *stmt;
+    char *sql_statement;
+    int ret;
+    int count = 0;
+    char *rt = NULL;
+    char *rg = NULL;
+
+    if (geom_column == NULL)
+	sql_statement =
+	    sqlite3_mprintf
+	    ("SELECT f_table_name, f_geometry_column FROM geometry_columns "
+	     "WHERE Upper(f_table_name) = Upper(%Q) AND spatial_index_enabled = 1",
+	     table_name);
+    else
+	sql_statement =
+	    sqlite3_mprintf
+	    ("SELECT f_table_name, f_geometry_column FROM geometry_columns "
+	     "WHERE Upper(f_table_name) = Upper(%Q) AND "
+	     "Upper(f_geometry_column) = Upper(%Q) AND spatial_index_enabled = 1",
+	     table_name, geom_column);
+    ret =
+	sqlite3_prepare_v2 (sqlite, sql_statement, strlen (sql_statement),
+			    &stmt, NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	return 0;
+    while (1)
+      {
+	  /* scrolling the result set rows */
+	  ret = sqlite3_step (stmt);
+	  if (ret == SQLITE_DONE)
+	      break;		/* end of result set */
+	  if (ret == SQLITE_ROW)
+	    {
+		const char *v = (const char *) sqlite3_column_text (stmt, 0);
+		int len = sqlite3_column_bytes (stmt, 0);
+		if (rt)
+		    free (rt);
+		rt = malloc (len + 1);
+		strcpy (rt, v);
+		v = (const char *) sqlite3_column_text (stmt, 1);
+		len = sqlite3_column_bytes (stmt, 1);
+		if (rg)
+		    free (rg);
+		rg = malloc (len + 1);
+		strcpy (rg, v);
+		count++;
+	    }
+      }
+    sqlite3_finalize (stmt);
+    if (count != 1)
+      {
+	  if (rt)
+	      free (rt);
+	  if (rg)
+	      free (rg);
+	  return 0;
+      }
+    *real_table = rt;
+    *real_geom = rg;
+    return 1;
+}
+
+static void
+vsjoin_tree_init (VirtualSpatialJoinTreePtr tree)
+{
+/* initializing an empty R*Tree struct */
+    int i;
+    tree->table = NULL;
+    tree->geometry = NULL;
+    tree->depth = 0;
+    tree->stmt_node = NULL;
+    tree->stmt_geom = NULL;
+    for (i = 0; i < SJOIN_NODE_CACHE; i++)
+      {
+	  tree->cache[i].nodeno = -1;
+	  tree->cache[i].n_cells = 0;
+	  tree->cache[i].cells = NULL;
+      }
+    tree->geom_rowid = -1;
+    tree->geom = NULL;
+    tree->blob = NULL;
+    tree->blob_sz = 0;
+}
+
+static void
+vsjoin_tree_reset (VirtualSpatialJoinTreePtr tree)
+{
+/* memory cleanup - resetting a R*Tree struct */
+    int i;
+    if (tree->table != NULL)
+	free (tree->table);
+    if (tree->geometry != NULL)
+	free (tree->geometry);
+    if (tree->stmt_node != NULL)
+	sqlite3_finalize (tree->stmt_node);
+    if (tree->stmt_geom != NULL)
+	sqlite3_finalize (tree->stmt_geom);
+    for (i = 0; i < SJOIN_NODE_CACHE; i++)
+      {
+	  if (tree->cache[i].cells != NULL)
+	      free (tree->cache[i].cells);
+      }
+    if (tree->geom != NULL)
+	gaiaFreeGeomColl (tree->geom);
+    if (tree->blob != NULL)
+	free (tree->blob);
+    vsjoin_tree_init (tree);
+}
+
+static int
+vsjoin_tree_prepare (sqlite3 * sqlite, VirtualSpatialJoinTreePtr tree)
+{
+/* preparing the SQL statements for some R*Tree */
+    char *idx_name;
+    char *xname;
+    char *xgeom;
+    char *sql_statement;
+    int ret;
+    const unsigned char *blob;
+
+    idx_name = sqlite3_mprintf ("idx_%s_%s_node", tree->table, tree->geometry);
+    xname = gaiaDoubleQuotedSql (idx_name);
+    sqlite3_free (idx_name);
+    sql_statement =
+	sqlite3_mprintf ("SELECT data FROM \"%s\" WHERE nodeno = ?", xname);
+    free (xname);
+    ret =
+	sqlite3_prepare_v2 (sqlite, sql_statement, strlen (sql_statement),
+			    &(tree->stmt_node), NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	return 0;
+    xname = gaiaDoubleQuotedSql (tree->table);
+    xgeom = gaiaDoubleQuotedSql (tree->geometry);
+    sql_statement =
+	sqlite3_mprintf ("SELECT \"%s\" FROM \"%s\" WHERE ROWID = ?", xgeom,
+			 xname);
+    free (xname);
+    free (xgeom);
+    ret =
+	sqlite3_prepare_v2 (sqlite, sql_statement, strlen (sql_statement),
+			    &(tree->stmt_geom), NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	return 0;
+/* retrieving the R*Tree depth from the root node */
+    sqlite3_bind_int64 (tree->stmt_node, 1, 1);
+    ret = sqlite3_step (tree->stmt_node);
+    if (ret != SQLITE_ROW
+	|| sqlite3_column_type (tree->stmt_node, 0) != SQLITE_BLOB
+	|| sqlite3_column_bytes (tree->stmt_node, 0) < 4)
+      {
+	  sqlite3_reset (tree->stmt_node);
+	  return 0;
+      }
+    blob = sqlite3_column_blob (tree->stmt_node, 0);
+    tree->depth = (blob[0] << 8) | blob[1];
+    sqlite3_reset (tree->stmt_node);
+    return 1;
+}
+
+static float
+vsjoin_import_float (const unsigned char *p)
+{
+/* decoding a big-endian R*Tree float */
+    union
+    {
+	float value;
+	unsigned int bits;
+    } cvt;
+    cvt.bits =
+	((unsigned int) p[0] << 24) | ((unsigned int) p[1] << 16) |
+	((unsigned int) p[2] << 8) | (unsigned int) p[3];
+    return cvt.value;
+}
+
+static sqlite3_int64
+vsjoin_import_int64 (const unsigned char *p)
+{
+/* decoding a big-endian R*Tree 64 bit integer */
+    sqlite3_uint64 value = 0;
+    int i;
+    for (i = 0; i < 8; i++)
+	value = (value << 8) | p[i];
+    return (sqlite3_int64) value;
+}
+
+static VirtualSpatialJoinNodePtr
+vsjoin_get_node (VirtualSpatialJoinTreePtr tree, sqlite3_int64 nodeno)
+{
+/* returns a decoded R*Tree node (direct-mapped cache) */
+    int ret;
+    int i;
+    int n_cells;
+    int size;
+    const unsigned char *blob;
+    VirtualSpatialJoinNodePtr node =
+	tree->cache + (nodeno % SJOIN_NODE_CACHE);
+    if (node->nodeno == nodeno)
+	return node;
+    sqlite3_reset (tree->stmt_node);
+    sqlite3_bind_int64 (tree->stmt_node, 1, nodeno);
+    ret = sqlite3_step (tree->stmt_node);
+    if (ret != SQLITE_ROW
+	|| sqlite3_column_type (tree->stmt_node, 0) != SQLITE_BLOB)
+      {
+	  sqlite3_reset (tree->stmt_node);
+	  return NULL;
+      }
+    blob = sqlite3_column_blob (tree->stmt_node, 0);
+    size = sqlite3_column_bytes (tree->stmt_node, 0);
+    n_cells = (size < 4) ? 0 : ((blob[2] << 8) | blob[3]);
+    if (4 + (n_cells * 24) > size)
+	n_cells = (size < 4) ? 0 : (size - 4) / 24;
+    if (node->cells == NULL)
+	node->cells =
+	    malloc (sizeof (VirtualSpatialJoinCell) * SJOIN_MAX_CELLS);
+    if (node->cells == NULL || n_cells > SJOIN_MAX_CELLS)
+      {
+	  sqlite3_reset (tree->stmt_node);
+	  return NULL;
+      }
+    for (i = 0; i < n_cells; i++)
+      {
+	  const unsigned char *cell = blob + 4 + (i * 24);
+	  VirtualSpatialJoinCellPtr p = node->cells + i;
+	  p->id = vsjoin_import_int64 (cell);
+	  p->minx = vsjoin_import_float (cell + 8);
+	  p->maxx = vsjoin_import_float (cell + 12);
+	  p->miny = vsjoin_import_float (cell + 16);
+	  p->maxy = vsjoin_import_float (cell + 20);
+      }
+    sqlite3_reset (tree->stmt_node);
+    node->nodeno = nodeno;
+    node->n_cells = n_cells;
+    return node;
+}
+
+static int
+vsjoin_push_task (VirtualSpatialJoinCursorPtr cursor,
+		  sqlite3_int64 left_node, int left_level,
+		  sqlite3_int64 right_node, int right_level, double minx,
+		  double miny, double maxx, double maxy)
+{
+/* pushing a pair of nodes into the stack */
+    VirtualSpatialJoinTaskPtr task;
+    if (cursor->n_tasks >= cursor->tasks_allocated)
+      {
+	  int allocated =
+	      (cursor->tasks_allocated ==
+	       0) ? 256 : cursor->tasks_allocated * 2;
+	  VirtualSpatialJoinTaskPtr tasks = realloc (cursor->tasks,
+						     sizeof
+						     (VirtualSpatialJoinTask)
+						     * allocated);
+	  if (tasks == NULL)
+	      return 0;
+	  cursor->tasks = tasks;
+	  cursor->tasks_allocated = allocated;
+      }
+    task = cursor->tasks + cursor->n_tasks;
+    task->left_node = left_node;
+    task->left_level = left_level;
+    task->right_node = right_node;
+    task->right_level = right_level;
+    task->minx = minx;
+    task->miny = miny;
+    task->maxx = maxx;
+    task->maxy = maxy;
+    cursor->n_tasks += 1;
+    return 1;
+}
+
+static int
+vsjoin_push_candidate (VirtualSpatialJoinCursorPtr cursor,
+		       sqlite3_int64 left_rowid, sqlite3_int64 right_rowid)
+{
+/* appending a candidate pair */
+    if (cursor->n_candidates >= cursor->candidates_allocated)
+      {
+	  int allocated =
+	      (cursor->candidates_allocated ==
+	       0) ? 1024 : cursor->candidates_allocated * 2;
+	  sqlite3_int64 *candidates = realloc (cursor->candidates,
+					       sizeof (sqlite3_int64) * 2 *
+					       allocated);
+	  if (candidates == NULL)
+	      return 0;
+	  cursor->candidates = candidates;
+	  cursor->candidates_allocated = allocated;
+      }
+    cursor->candidates[cursor->n_candidates * 2] = left_rowid;
+    cursor->candidates[(cursor->n_candidates * 2) + 1] = right_rowid;
+    cursor->n_candidates += 1;
+    return 1;
+}
+
+static int
+vsjoin_cell_overlaps (VirtualSpatialJoinCellPtr cell, double minx,
+		      double miny, double maxx, double maxy)
+{
+/* checks if a cell intersects the search space restriction */
+    if (cell->maxx < minx || cell->minx > maxx || cell->maxy < miny
+	|| cell->miny > maxy)
+	return 0;
+    return 1;
+}
+
+static int
+vsjoin_process_task (VirtualSpatialJoinCursorPtr cursor,
+		     VirtualSpatialJoinTaskPtr task)
+{
+/*
+/ synchronized traversal: joining a pair of R*Tree nodes
+/ only cells intersecting the MBR shared by both parents are considered
+*/
+    int i;
+    int j;
+    int n_left = 0;
+    int n_right = 0;
+    VirtualSpatialJoinCellPtr a;
+    VirtualSpatialJoinCellPtr b;
+    VirtualSpatialJoinNodePtr left_node;
+    VirtualSpatialJoinNodePtr right_node;
+    VirtualSpatialJoinCell left_cells[SJOIN_MAX_CELLS];
+    VirtualSpatialJoinCell right_cells[SJOIN_MAX_CELLS];
+
+/* copying the node cells, because the node cache could be reused */
+    left_node = vsjoin_get_node (&(cursor->left), task->left_node);
+    if (left_node == NULL)
+	return 1;
+    for (i = 0; i < left_node->n_cells; i++)
+      {
+	  if (vsjoin_cell_overlaps
+	      (left_node->cells + i, task->minx, task->miny, task->maxx,
+	       task->maxy))
+	      left_cells[n_left++] = left_node->cells[i];
+      }
+    right_node = vsjoin_get_node (&(cursor->right), task->right_node);
+    if (right_node == NULL)
+	return 1;
+    for (i = 0; i < right_node->n_cells; i++)
+      {
+	  if (vsjoin_cell_overlaps
+	      (right_node->cells + i, task->minx, task->miny, task->maxx,
+	       task->maxy))
+	      right_cells[n_right++] = right_node->cells[i];
+      }
+    if (n_left == 0 || n_right == 0)
+	return 1;
+
+    if (task->left_level > task->right_level)
+      {
+	  /* descending the left R*Tree only */
+	  for (i = n_left - 1; i >= 0; i--)
+	    {
+		a = left_cells + i;
+		if (!vsjoin_push_task
+		    (cursor, a->id, task->left_level - 1, task->right_node,
+		     task->right_level,
+		     (a->minx > task->minx) ? a->minx : task->minx,
+		     (a->miny > task->miny) ? a->miny : task->miny,
+		     (a->maxx < task->maxx) ? a->maxx : task->maxx,
+		     (a->maxy < task->maxy) ? a->maxy : task->maxy))
+		    return 0;
+	    }
+	  return 1;
+      }
+    if (task->right_level > task->left_level)
+      {
+	  /* descending the right R*Tree only */
+	  for (j = n_right - 1; j >= 0; j--)
+	    {
+		b = right_cells + j;
+		if (!vsjoin_push_task
+		    (cursor, task->left_node, task->left_level, b->id,
+		     task->right_level - 1,
+		     (b->minx > task->minx) ? b->minx : task->minx,
+		     (b->miny > task->miny) ? b->miny : task->miny,
+		     (b->maxx < task->maxx) ? b->maxx : task->maxx,
+		     (b->maxy < task->maxy) ? b->maxy : task->maxy))
+		    return 0;
+	    }
+	  return 1;
+      }
+
+/* both nodes are at the same level: matching all intersecting pairs */
+    if (task->left_level == 0)
+      {
+	  /* both are leaves: emitting the candidate pairs grouped by left feature */
+	  for (i = 0; i < n_left; i++)
+	    {
+		a = left_cells + i;
+		for (j = 0; j < n_right; j++)
+		  {
+		      b = right_cells + j;
+		      if (a->maxx < b->minx || a->minx > b->maxx
+			  || a->maxy < b->miny || a->miny > b->maxy)
+			  continue;
+		      if (!vsjoin_push_candidate (cursor, a->id, b->id))
+			  return 0;
+		  }
+	    }
+	  return 1;
+      }
+    for (i = n_left - 1; i >= 0; i--)
+      {
+	  a = left_cells + i;
+	  for (j = n_right - 1; j >= 0; j--)
+	    {
+		b = right_cells + j;
+		if (a->maxx < b->minx || a->minx > b->maxx
+		    || a->maxy < b->miny || a->miny > b->maxy)
+		    continue;
+		if (!vsjoin_push_task
+		    (cursor, a->id, task->left_level - 1, b->id,
+		     task->right_level - 1,
+		     (a->minx > b->minx) ? a->minx : b->minx,
+		     (a->miny > b->miny) ? a->miny : b->miny,
+		     (a->maxx < b->maxx) ? a->maxx : b->maxx,
+		     (a->maxy < b->maxy) ? a->maxy : b->maxy))
+		    return 0;
+	    }
+      }
+    return 1;
+}
+
+static int
+vsjoin_load_geometry (VirtualSpatialJoinTreePtr tree, sqlite3_int64 rowid)
+{
+/* fetching and decoding a Geometry (the last one is cached) */
+    int ret;
+    int ok = 0;
+    if (tree->geom_rowid == rowid)
+	return (tree->geom != NULL);
+    if (tree->geom != NULL)
+	gaiaFreeGeomColl (tree->geom);
+    if (tree->blob != NULL)
+	free (tree->blob);
+    tree->geom = NULL;
+    tree->blob = NULL;
+    tree->blob_sz = 0;
+    tree->geom_rowid = rowid;
+    sqlite3_reset (tree->stmt_geom);
+    sqlite3_bind_int64 (tree->stmt_geom, 1, rowid);
+    ret = sqlite3_step (tree->stmt_geom);
+    if (ret == SQLITE_ROW
+	&& sqlite3_column_type (tree->stmt_geom, 0) == SQLITE_BLOB)
+      {
+	  const unsigned char *blob = sqlite3_column_blob (tree->stmt_geom, 0);
+	  int size = sqlite3_column_bytes (tree->stmt_geom, 0);
+	  tree->geom = gaiaFromSpatiaLiteBlobWkb (blob, size);
+	  if (tree->geom != NULL)
+	    {
+		tree->blob = malloc (size);
+		memcpy (tree->blob, blob, size);
+		tree->blob_sz = size;
+		ok = 1;
+	    }
+      }
+    sqlite3_reset (tree->stmt_geom);
+    return ok;
+}
+
+#ifndef OMIT_GEOS		/* GEOS is supported */
+static int
+vsjoin_evaluate (VirtualSpatialJoinCursorPtr cursor)
+{
+/* evaluating the exact spatial predicate on the current pair */
+    const void *cache = cursor->pVtab->p_cache;
+    gaiaGeomCollPtr g1 = cursor->left.geom;
+    unsigned char *b1 = cursor->left.blob;
+    int s1 = cursor->left.blob_sz;
+    gaiaGeomCollPtr g2 = cursor->right.geom;
+    unsigned char *b2 = cursor->right.blob;
+    int s2 = cursor->right.blob_sz;
+    switch (cursor->predicate)
+      {
+      case SJOIN_INTERSECTS:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedIntersects (cache, g1, b1, s1, g2, b2,
+						     s2);
+	  return gaiaGeomCollIntersects (g1, g2);
+      case SJOIN_CONTAINS:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedContains (cache, g1, b1, s1, g2, b2,
+						   s2);
+	  return gaiaGeomCollContains (g1, g2);
+      case SJOIN_WITHIN:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedWithin (cache, g1, b1, s1, g2, b2, s2);
+	  return gaiaGeomCollWithin (g1, g2);
+      case SJOIN_TOUCHES:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedTouches (cache, g1, b1, s1, g2, b2,
+						  s2);
+	  return gaiaGeomCollTouches (g1, g2);
+      case SJOIN_OVERLAPS:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedOverlaps (cache, g1, b1, s1, g2, b2,
+						   s2);
+	  return gaiaGeomCollOverlaps (g1, g2);
+      case SJOIN_CROSSES:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedCrosses (cache, g1, b1, s1, g2, b2,
+						  s2);
+	  return gaiaGeomCollCrosses (g1, g2);
+      case SJOIN_COVERS:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedCovers (cache, g1, b1, s1, g2, b2, s2);
+	  return gaiaGeomCollCovers (g1, g2);
+      case SJOIN_COVEREDBY:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedCoveredBy (cache, g1, b1, s1, g2, b2,
+						    s2);
+	  return gaiaGeomCollCoveredBy (g1, g2);
+      case SJOIN_EQUALS:
+	  if (cache != NULL)
+	      return gaiaGeomCollEquals_r (cache, g1, g2);
+	  return gaiaGeomCollEquals (g1, g2);
+      };
+    return 0;
+}
+#endif /* end GEOS conditional */
+
+static int
+vsjoin_accept (VirtualSpatialJoinCursorPtr cursor, sqlite3_int64 left_rowid,
+	       sqlite3_int64 right_rowid)
+{
+/* checks if a candidate pair satisfies the spatial predicate */
+    gaiaGeomCollPtr g1;
+    gaiaGeomCollPtr g2;
+    if (!vsjoin_load_geometry (&(cursor->left), left_rowid))
+	return 0;
+    if (!vsjoin_load_geometry (&(cursor->right), right_rowid))
+	return 0;
+/* the R*Tree MBRs are approximated: checking the exact MBRs */
+    g1 = cursor->left.geom;
+    g2 = cursor->right.geom;
+    if (g1->MaxX < g2->MinX || g1->MinX > g2->MaxX || g1->MaxY < g2->MinY
+	|| g1->MinY > g2->MaxY)
+	return 0;
+    if (cursor->predicate == SJOIN_MBR)
+	return 1;
+#ifndef OMIT_GEOS		/* GEOS is supported */
+    return vsjoin_evaluate (cursor) > 0;
+#else
+    return 0;
+#endif /* end GEOS conditional */
+}
+
+static void
+vsjoin_read_row (VirtualSpatialJoinCursorPtr cursor)
+{
+/* fetching the next pair satisfying the spatial predicate */
+    while (1)
+      {
+	  if (cursor->next_candidate < cursor->n_candidates)
+	    {
+		/* checking the next candidate pair */
+		sqlite3_int64 left_rowid =
+		    cursor->candidates[cursor->next_candidate * 2];
+		sqlite3_int64 right_rowid =
+		    cursor->candidates[(cursor->next_candidate * 2) + 1];
+		cursor->next_candidate += 1;
+		if (vsjoin_accept (cursor, left_rowid, right_rowid))
+		  {
+		      cursor->left_rowid = left_rowid;
+		      cursor->right_rowid = right_rowid;
+		      cursor->current_row += 1;
+		      return;
+		  }
+		continue;
+	    }
+	  cursor->n_candidates = 0;
+	  cursor->next_candidate = 0;
+	  if (cursor->n_tasks == 0)
+	    {
+		/* the synchronized traversal is completed */
+		cursor->eof = 1;
+		return;
+	    }
+	  else
+	    {
+		/* joining the next pair of nodes */
+		VirtualSpatialJoinTask task;
+		cursor->n_tasks -= 1;
+		task = cursor->tasks[cursor->n_tasks];
+		if (!vsjoin_process_task (cursor, &task))
+		  {
+		      /* insufficient memory */
+		      cursor->eof = 1;
+		      return;
+		  }
+	    }
+      }
+}
+
+static void
+vsjoin_reset_cache (VirtualSpatialJoinCursorPtr cursor)
+{
+/* cleaning the cursor's cache */
+    vsjoin_tree_reset (&(cursor->left));
+    vsjoin_tree_reset (&(cursor->right));
+    if (cursor->predicate_name != NULL)
+	free (cursor->predicate_name);
+    if (cursor->tasks != NULL)
+	free (cursor->tasks);
+    if (cursor->candidates != NULL)
+	free (cursor->candidates);
+    cursor->predicate = SJOIN_MBR;
+    cursor->predicate_name = NULL;
+    cursor->tasks = NULL;
+    cursor->n_tasks = 0;
+    cursor->tasks_allocated = 0;
+    cursor->candidates = NULL;
+    cursor->n_candidates = 0;
+    cursor->candidates_allocated = 0;
+    cursor->next_candidate = 0;
+    cursor->current_row = 0;
+    cursor->left_rowid = 0;
+    cursor->right_rowid = 0;
+}
+
+static int
+vsjoin_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
+	       sqlite3_vtab ** ppVTab, char **pzErr)
+{
+/* creates the virtual table for Spatial Join */
+    VirtualSpatialJoinPtr p_vt;
+    char *buf;
+    char *vtable;
+    char *xname;
+    if (argc == 3)
+      {
+	  vtable = gaiaDequotedSql ((char *) argv[2]);
+      }
+    else
+      {
+	  *pzErr =
+	      sqlite3_mprintf
+	      ("[VirtualSpatialJoin module] CREATE VIRTUAL: illegal arg list {void}\n");
+	  return SQLITE_ERROR;
+      }
+    p_vt =
+	(VirtualSpatialJoinPtr) sqlite3_malloc (sizeof (VirtualSpatialJoin));
+    if (!p_vt)
+	return SQLITE_NOMEM;
+    p_vt->db = db;
+    p_vt->p_cache = pAux;
+    p_vt->pModule = &my_sjoin_module;
+    p_vt->nRef = 0;
+    p_vt->zErrMsg = NULL;
+/* preparing the COLUMNs for this VIRTUAL TABLE */
+    xname = gaiaDoubleQuotedSql (vtable);
+    buf = sqlite3_mprintf ("CREATE TABLE \"%s\" (left_table TEXT, "
+			   "left_geometry TEXT, right_table TEXT, "
+			   "right_geometry TEXT, predicate TEXT, "
+			   "left_rowid INTEGER, right_rowid INTEGER)", xname);
+    free (xname);
+    free (vtable);
+    if (sqlite3_declare_vtab (db, buf) != SQLITE_OK)
+      {
+	  *pzErr =
+	      sqlite3_mprintf
+	      ("[VirtualSpatialJoin module] CREATE VIRTUAL: invalid SQL statement \"%s\"",
+	       buf);
+	  sqlite3_free (buf);
+	  sqlite3_free (p_vt);
+	  return SQLITE_ERROR;
+      }
+    sqlite3_free (buf);
+    *ppVTab = (sqlite3_vtab *) p_vt;
+    return SQLITE_OK;
+}
+
+static int
+vsjoin_connect (sqlite3 * db, void *pAux, int argc, const char *const *argv,
+		sqlite3_vtab ** ppVTab, char **pzErr)
+{
+/* connects the virtual table - simply aliases vsjoin_create() */
+    return vsjoin_create (db, pAux, argc, argv, ppVTab, pzErr);
+}
+
+static int
+vsjoin_best_index (sqlite3_vtab * pVTab, sqlite3_index_info * pIdxInfo)
+{
+/* best index selection */
+    int i;
+    int col;
+    int errors = 0;
+    int arg = 1;
+    int found[5];
+    int index[5];
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    for (col = 0; col < 5; col++)
+	found[col] = 0;
+    for (i = 0; i < pIdxInfo->nConstraint; i++)
+      {
+	  /* verifying the constraints */
+	  struct sqlite3_index_constraint *p = &(pIdxInfo->aConstraint[i]);
+	  if (!(p->usable))
+	      continue;
+	  if (p->iColumn >= 5)
+	    {
+		/* left_rowid / right_rowid: left to SQLite */
+		continue;
+	    }
+	  if (p->iColumn >= 0 && p->op == SQLITE_INDEX_CONSTRAINT_EQ)
+	    {
+		found[p->iColumn] += 1;
+		index[p->iColumn] = i;
+	    }
+	  else
+	      errors++;
+      }
+    for (col = 0; col < 5; col++)
+      {
+	  if (found[col] > 1)
+	      errors++;
+      }
+    if (found[0] == 1 && found[2] == 1 && errors == 0)
+      {
+	  /*
+	     / this one is a valid SpatialJoin query
+	     / args: left_table, [left_geometry], right_table,
+	     /       [right_geometry], [predicate]
+	   */
+	  pIdxInfo->idxNum = 0;
+	  for (col = 0; col < 5; col++)
+	    {
+		if (found[col])
+		  {
+		      pIdxInfo->idxNum |= (1 << col);
+		      pIdxInfo->aConstraintUsage[index[col]].argvIndex = arg++;
+		      pIdxInfo->aConstraintUsage[index[col]].omit = 1;
+		  }
+	    }
+	  pIdxInfo->estimatedCost = 1.0;
+      }
+    else
+      {
+	  /* illegal query */
+	  pIdxInfo->idxNum = 0;
+	  pIdxInfo->estimatedCost = 1.0e12;
+      }
+    return SQLITE_OK;
+}
+
+static int
+vsjoin_disconnect (sqlite3_vtab * pVTab)
+{
+/* disconnects the virtual table */
+    VirtualSpatialJoinPtr p_vt = (VirtualSpatialJoinPtr) pVTab;
+    sqlite3_free (p_vt);
+    return SQLITE_OK;
+}
+
+static int
+vsjoin_destroy (sqlite3_vtab * pVTab)
+{
+/* destroys the virtual table - simply aliases vsjoin_disconnect() */
+    return vsjoin_disconnect (pVTab);
+}
+
+static int
+vsjoin_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
+{
+/* opening a new cursor */
+    VirtualSpatialJoinCursorPtr cursor =
+	(VirtualSpatialJoinCursorPtr)
+	sqlite3_malloc (sizeof (VirtualSpatialJoinCursor));
+    if (cursor == NULL)
+	return SQLITE_ERROR;
+    cursor->pVtab = (VirtualSpatialJoinPtr) pVTab;
+    cursor->eof = 1;
+    vsjoin_tree_init (&(cursor->left));
+    vsjoin_tree_init (&(cursor->right));
+    cursor->predicate_name = NULL;
+    cursor->tasks = NULL;
+    cursor->candidates = NULL;
+    vsjoin_reset_cache (cursor);
+    *ppCursor = (sqlite3_vtab_cursor *) cursor;
+    return SQLITE_OK;
+}
+
+static int
+vsjoin_close (sqlite3_vtab_cursor * pCursor)
+{
+/* closing the cursor */
+    VirtualSpatialJoinCursorPtr cursor = (VirtualSpatialJoinCursorPtr) pCursor;
+    vsjoin_reset_cache (cursor);
+    sqlite3_free (pCursor);
+    return SQLITE_OK;
+}
+
+static int
+vsjoin_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
+	       int argc, sqlite3_value ** argv)
+{
+/* setting up a cursor filter */
+    const char *args[5];
+    const char *predicate_name = "intersects";
+    int col;
+    int arg = 0;
+    VirtualSpatialJoinCursorPtr cursor = (VirtualSpatialJoinCursorPtr) pCursor;
+    VirtualSpatialJoinPtr sjoin = (VirtualSpatialJoinPtr) cursor->pVtab;
+    if (idxStr)
+	idxStr = idxStr;	/* unused arg warning suppression */
+    vsjoin_reset_cache (cursor);
+    cursor->eof = 1;
+    if (!(idxNum & 1) || !(idxNum & 4))
+	return SQLITE_OK;
+
+/* retrieving the LeftTable/LeftGeometry/RightTable/RightGeometry/Predicate params */
+    for (col = 0; col < 5; col++)
+      {
+	  args[col] = NULL;
+	  if (!(idxNum & (1 << col)))
+	      continue;
+	  if (arg >= argc)
+	      return SQLITE_OK;
+	  if (sqlite3_value_type (argv[arg]) != SQLITE_TEXT)
+	      return SQLITE_OK;	/* invalid args */
+	  args[col] = (const char *) sqlite3_value_text (argv[arg]);
+	  arg++;
+      }
+    if (args[4] != NULL)
+	predicate_name = args[4];
+    cursor->predicate = vsjoin_parse_predicate (predicate_name);
+    if (cursor->predicate < 0)
+	return SQLITE_OK;	/* unsupported predicate */
+    cursor->predicate_name = malloc (strlen (predicate_name) + 1);
+    strcpy (cursor->predicate_name, predicate_name);
+
+/* checking if the corresponding Tables/Geometries exist */
+    if (!vsjoin_find_geometry
+	(sjoin->db, args[0], args[1], &(cursor->left.table),
+	 &(cursor->left.geometry)))
+	goto stop;
+    if (!vsjoin_find_geometry
+	(sjoin->db, args[2], args[3], &(cursor->right.table),
+	 &(cursor->right.geometry)))
+	goto stop;
+    if (!vsjoin_tree_prepare (sjoin->db, &(cursor->left)))
+	goto stop;
+    if (!vsjoin_tree_prepare (sjoin->db, &(cursor->right)))
+	goto stop;
+
+/* starting the synchronized traversal from both root nodes */
+    if (!vsjoin_push_task
+	(cursor, 1, cursor->left.depth, 1, cursor->right.depth, -DBL_MAX,
+	 -DBL_MAX, DBL_MAX, DBL_MAX))
+	goto stop;
+    cursor->eof = 0;
+    vsjoin_read_row (cursor);
+    return SQLITE_OK;
+
+  stop:
+    vsjoin_reset_cache (cursor);
+    cursor->eof = 1;
+    return SQLITE_OK;
+}
+
+static int
+vsjoin_next (sqlite3_vtab_cursor * pCursor)
+{
+/* fetching next row from cursor */
+    VirtualSpatialJoinCursorPtr cursor = (VirtualSpatialJoinCursorPtr) pCursor;
+    if (!(cursor->eof))
+	vsjoin_read_row (cursor);
+    return SQLITE_OK;
+}
+
+static int
+vsjoin_eof (sqlite3_vtab_cursor * pCursor)
+{
+/* cursor EOF */
+    VirtualSpatialJoinCursorPtr cursor = (VirtualSpatialJoinCursorPtr) pCursor;
+    return cursor->eof;
+}
+
+static int
+vsjoin_column (sqlite3_vtab_cursor * pCursor, sqlite3_context * pContext,
+	       int column)
+{
+/* fetching value for the Nth column */
+    VirtualSpatialJoinCursorPtr cursor = (VirtualSpatialJoinCursorPtr) pCursor;
+    if (cursor->eof)
+      {
+	  sqlite3_result_null (pContext);
+	  return SQLITE_OK;
+      }
+    if (column == 0)
+      {
+	  /* the "left_table" column */
+	  sqlite3_result_text (pContext, cursor->left.table,
+			       strlen (cursor->left.table), SQLITE_STATIC);
+      }
+    if (column == 1)
+      {
+	  /* the "left_geometry" column */
+	  sqlite3_result_text (pContext, cursor->left.geometry,
+			       strlen (cursor->left.geometry), SQLITE_STATIC);
+      }
+    if (column == 2)
+      {
+	  /* the "right_table" column */
+	  sqlite3_result_text (pContext, cursor->right.table,
+			       strlen (cursor->right.table), SQLITE_STATIC);
+      }
+    if (column == 3)
+      {
+	  /* the "right_geometry" column */
+	  sqlite3_result_text (pContext, cursor->right.geometry,
+			       strlen (cursor->right.geometry), SQLITE_STATIC);
+      }
+    if (column == 4)
+      {
+	  /* the "predicate" column */
+	  sqlite3_result_text (pContext, cursor->predicate_name,
+			       strlen (cursor->predicate_name), SQLITE_STATIC);
+      }
+    if (column == 5)
+      {
+	  /* the "left_rowid" column */
+	  sqlite3_result_int64 (pContext, cursor->left_rowid);
+      }
+    if (column == 6)
+      {
+	  /* the "right_rowid" column */
+	  sqlite3_result_int64 (pContext, cursor->right_rowid);
+      }
+    return SQLITE_OK;
+}
+
+static int
+vsjoin_rowid (sqlite3_vtab_cursor * pCursor, sqlite_int64 * pRowid)
+{
+/* fetching the ROWID */
+    VirtualSpatialJoinCursorPtr cursor = (VirtualSpatialJoinCursorPtr) pCursor;
+    *pRowid = cursor->current_row;
+    return SQLITE_OK;
+}
+
+static int
+vsjoin_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
+	       sqlite_int64 * pRowid)
+{
+/* generic update [INSERT / UPDATE / DELETE */
+    if (pRowid || argc || argv || pVTab)
+	pRowid = pRowid;	/* unused arg warning suppression */
+/* read only datasource */
+    return SQLITE_READONLY;
+}
+
+static int
+vsjoin_begin (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vsjoin_sync (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vsjoin_commit (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vsjoin_rollback (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vsjoin_rename (sqlite3_vtab * pVTab, const char *zNew)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    if (zNew)
+	zNew = zNew;		/* unused arg warning suppression */
+    return SQLITE_ERROR;
+}
+
+static int
+spliteVirtualSpatialJoinInit (sqlite3 * db, void *p_cache)
+{
+    int rc = SQLITE_OK;
+    my_sjoin_module.iVersion = 1;
+    my_sjoin_module.xCreate = &vsjoin_create;
+    my_sjoin_module.xConnect = &vsjoin_connect;
+    my_sjoin_module.xBestIndex = &vsjoin_best_index;
+    my_sjoin_module.xDisconnect = &vsjoin_disconnect;
+    my_sjoin_module.xDestroy = &vsjoin_destroy;
+    my_sjoin_module.xOpen = &vsjoin_open;
+    my_sjoin_module.xClose = &vsjoin_close;
+    my_sjoin_module.xFilter = &vsjoin_filter;
+    my_sjoin_module.xNext = &vsjoin_next;
+    my_sjoin_module.xEof = &vsjoin_eof;
+    my_sjoin_module.xColumn = &vsjoin_column;
+    my_sjoin_module.xRowid = &vsjoin_rowid;
+    my_sjoin_module.xUpdate = &vsjoin_update;
+    my_sjoin_module.xBegin = &vsjoin_begin;
+    my_sjoin_module.xSync = &vsjoin_sync;
+    my_sjoin_module.xCommit = &vsjoin_commit;
+    my_sjoin_module.xRollback = &vsjoin_rollback;
+    my_sjoin_module.xFindFunction = NULL;
+    my_sjoin_module.xRename = &vsjoin_rename;
+    sqlite3_create_module_v2 (db, "VirtualSpatialJoin", &my_sjoin_module,
+			      p_cache, 0);
+    return rc;
+}
+
+SPATIALITE_PRIVATE int
+virtual_spatialjoin_extension_init (void *xdb, const void *p_cache)
+{
+    sqlite3 *db = (sqlite3 *) xdb;
+    return spliteVirtualSpatialJoinInit (db, (void *) p_cache);
+}
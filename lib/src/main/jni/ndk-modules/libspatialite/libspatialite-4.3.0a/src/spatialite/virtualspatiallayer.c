@@ -0,0 +1,925 @@
+/*
+
+ virtualspatiallayer.c -- SQLite3 extension [VIRTUAL TABLE SpatialLayer]
+
+ version 4.3, 2015 June 29
+
+ Author: Sandro Furieri a.furieri@lqt.it
+
+ -----------------------------------------------------------------------------
+ 
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+ 
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+ 
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+ 
+Portions created by the Initial Developer are Copyright (C) 2008-2015
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+ 
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "config-msvc.h"
+#else
+#include "config.h"
+#endif
+
+#include <spatialite/sqlite.h>
+
+#include <spatialite/spatialite.h>
+#include <spatialite/gaiaaux.h>
+#include <spatialite/gaiageo.h>
+#include <spatialite_private.h>
+
+#ifdef _WIN32
+#define strcasecmp	_stricmp
+#define strncasecmp	_strnicmp
+#endif /* not WIN32 */
+
+#define SLAYER_MBR_INTERSECTS	0
+#define SLAYER_MBR_WITHIN	1
+#define SLAYER_MBR_CONTAINS	2
+#define SLAYER_INTERSECTS	3
+#define SLAYER_CONTAINS		4
+#define SLAYER_WITHIN		5
+#define SLAYER_TOUCHES		6
+#define SLAYER_OVERLAPS		7
+#define SLAYER_CROSSES		8
+#define SLAYER_COVERS		9
+#define SLAYER_COVEREDBY	10
+#define SLAYER_EQUALS		11
+#define SLAYER_PREDICATES	12
+
+/*
+/ VirtualSpatialLayer exposes a read-only view of a Geometry table:
+/
+/   CREATE VIRTUAL TABLE v USING VirtualSpatialLayer(table [, geometry])
+/
+/ the SpatialIndex (R*Tree or quantized MBR index) is only used by the
+/ MATCH operator, which selects all rows whose MBR intersects the given
+/ frame:
+/
+/   SELECT * FROM v WHERE geom MATCH BuildMbr(...)
+/
+/ the overloaded spatial predicates (ST_Intersects(geom, ...) and alike)
+/ are evaluated on every row (taking advantage of prepared GEOS geometries
+/ whenever possible), so an exact query should combine both of them:
+/
+/   WHERE geom MATCH frame AND ST_Intersects(geom, frame)
+/
+/ the overloaded predicates return exactly the same values as the
+/ standard SQL functions (NULL or -1 on invalid arguments)
+/
+/ KNOWN LIMITATION: SQLite only passes function constraints to
+/ xBestIndex since 3.25 (SQLITE_INDEX_CONSTRAINT_FUNCTION), and the
+/ bundled SQLite is 3.15.1: until it gets upgraded, a plain WHERE
+/ ST_Intersects(geom, frame) can't be answered via the SpatialIndex
+/ and the explicit MATCH is still required
+*/
+
+static struct sqlite3_module my_slayer_module;
+
+
+/******************************************************************************
+/
+/ VirtualTable structs
+/
+******************************************************************************/
+
+struct VirtualSpatialLayerStruct;
+
+typedef struct VirtualSpatialLayerPredicateStruct
+{
+/* the context of an overloaded spatial predicate */
+    int predicate;
+    struct VirtualSpatialLayerStruct *vtab;
+} VirtualSpatialLayerPredicate;
+typedef VirtualSpatialLayerPredicate *VirtualSpatialLayerPredicatePtr;
+
+typedef struct VirtualSpatialLayerStruct
+{
+/* extends the sqlite3_vtab struct */
+    const sqlite3_module *pModule;	/* ptr to sqlite module: USED INTERNALLY BY SQLITE */
+    int nRef;			/* # references: USED INTERNALLY BY SQLITE */
+    char *zErrMsg;		/* error message: USE INTERNALLY BY SQLITE */
+    sqlite3 *db;		/* the sqlite db holding the virtual table */
+    const void *p_cache;	/* pointer to the internal cache */
+    char *table;		/* the wrapped table */
+    char *geometry;		/* the Geometry column */
+    int geom_column;		/* the Geometry column index */
+    int n_columns;		/* the wrapped table columns */
+    char **columns;
+    VirtualSpatialLayerPredicate predicates[SLAYER_PREDICATES];
+} VirtualSpatialLayer;
+typedef VirtualSpatialLayer *VirtualSpatialLayerPtr;
+
+typedef struct VirtualSpatialLayerCursorStruct
+{
+/* extends the sqlite3_vtab_cursor struct */
+    VirtualSpatialLayerPtr pVtab;	/* Virtual table of this cursor */
+    sqlite3_stmt *stmt;		/* the wrapped table query */
+    int eof;			/* the EOF marker */
+} VirtualSpatialLayerCursor;
+typedef VirtualSpatialLayerCursor *VirtualSpatialLayerCursorPtr;
+
+static int
+vspl_parse_function (int nArg, const char *name)
+{
+/* identifying an SQL function supported by the SpatialIndex */
+    if (nArg != 2)
+	return -1;
+    if (strncasecmp (name, "ST_", 3) == 0)
+	name += 3;
+    if (strcasecmp (name, "match") == 0
+	|| strcasecmp (name, "MbrIntersects") == 0)
+	return SLAYER_MBR_INTERSECTS;
+    if (strcasecmp (name, "MbrWithin") == 0)
+	return SLAYER_MBR_WITHIN;
+    if (strcasecmp (name, "MbrContains") == 0)
+	return SLAYER_MBR_CONTAINS;
+#ifndef OMIT_GEOS		/* GEOS is supported */
+    if (strcasecmp (name, "Intersects") == 0)
+	return SLAYER_INTERSECTS;
+    if (strcasecmp (name, "Contains") == 0)
+	return SLAYER_CONTAINS;
+    if (strcasecmp (name, "Within") == 0)
+	return SLAYER_WITHIN;
+    if (strcasecmp (name, "Touches") == 0)
+	return SLAYER_TOUCHES;
+    if (strcasecmp (name, "Overlaps") == 0)
+	return SLAYER_OVERLAPS;
+    if (strcasecmp (name, "Crosses") == 0)
+	return SLAYER_CROSSES;
+    if (strcasecmp (name, "Covers") == 0)
+	return SLAYER_COVERS;
+    if (strcasecmp (name, "CoveredBy") == 0)
+	return SLAYER_COVEREDBY;
+    if (strcasecmp (name, "Equals") == 0)
+	return SLAYER_EQUALS;
+#endif /* end GEOS conditional */
+    return -1;
+}
+
+static int
+vspl_evaluate (const void *cache, int predicate, gaiaGeomCollPtr g1,
+	       unsigned char *b1, int s1, gaiaGeomCollPtr g2,
+	       unsigned char *b2, int s2)
+{
+/* evaluating a spatial predicate */
+    switch (predicate)
+      {
+      case SLAYER_MBR_INTERSECTS:
+	  return 1;
+      case SLAYER_MBR_WITHIN:
+	  return gaiaMbrsWithin (g1, g2);
+      case SLAYER_MBR_CONTAINS:
+	  return gaiaMbrsContains (g1, g2);
+#ifndef OMIT_GEOS		/* GEOS is supported */
+      case SLAYER_INTERSECTS:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedIntersects (cache, g1, b1, s1, g2, b2,
+						     s2);
+	  return gaiaGeomCollIntersects (g1, g2);
+      case SLAYER_CONTAINS:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedContains (cache, g1, b1, s1, g2, b2,
+						   s2);
+	  return gaiaGeomCollContains (g1, g2);
+      case SLAYER_WITHIN:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedWithin (cache, g1, b1, s1, g2, b2, s2);
+	  return gaiaGeomCollWithin (g1, g2);
+      case SLAYER_TOUCHES:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedTouches (cache, g1, b1, s1, g2, b2,
+						  s2);
+	  return gaiaGeomCollTouches (g1, g2);
+      case SLAYER_OVERLAPS:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedOverlaps (cache, g1, b1, s1, g2, b2,
+						   s2);
+	  return gaiaGeomCollOverlaps (g1, g2);
+      case SLAYER_CROSSES:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedCrosses (cache, g1, b1, s1, g2, b2,
+						  s2);
+	  return gaiaGeomCollCrosses (g1, g2);
+      case SLAYER_COVERS:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedCovers (cache, g1, b1, s1, g2, b2, s2);
+	  return gaiaGeomCollCovers (g1, g2);
+      case SLAYER_COVEREDBY:
+	  if (cache != NULL)
+	      return gaiaGeomCollPreparedCoveredBy (cache, g1, b1, s1, g2, b2,
+						    s2);
+	  return gaiaGeomCollCoveredBy (g1, g2);
+      case SLAYER_EQUALS:
+	  if (cache != NULL)
+	      return gaiaGeomCollEquals_r (cache, g1, g2);
+	  return gaiaGeomCollEquals (g1, g2);
+#endif /* end GEOS conditional */
+      };
+    return 0;
+}
+
+static void
+vspl_predicate (sqlite3_context * context, int argc, sqlite3_value ** argv)
+{
+/*
+/ the spatial predicate overloaded on behalf of a Geometry column
+/ of the Virtual Table
+/
+/ returns exactly the same values as the standard SQL function:
+/ any NULL or invalid Geometry yields NULL for the Mbr* predicates
+/ and -1 for the GEOS based ones
+*/
+    VirtualSpatialLayerPredicatePtr pred =
+	(VirtualSpatialLayerPredicatePtr) sqlite3_user_data (context);
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) (pred->vtab->p_cache);
+    int gpkg_mode = 0;
+    int gpkg_amphibious = 0;
+    unsigned char *b1;
+    unsigned char *b2;
+    int s1;
+    int s2;
+    gaiaGeomCollPtr g1 = NULL;
+    gaiaGeomCollPtr g2 = NULL;
+    int ret = -1;
+    if (cache != NULL)
+      {
+	  gpkg_mode = cache->gpkg_mode;
+	  gpkg_amphibious = cache->gpkg_amphibious_mode;
+      }
+    if (argc != 2 || sqlite3_value_type (argv[0]) != SQLITE_BLOB
+	|| sqlite3_value_type (argv[1]) != SQLITE_BLOB)
+	goto stop;
+    b1 = (unsigned char *) sqlite3_value_blob (argv[0]);
+    s1 = sqlite3_value_bytes (argv[0]);
+    b2 = (unsigned char *) sqlite3_value_blob (argv[1]);
+    s2 = sqlite3_value_bytes (argv[1]);
+    g1 = gaiaFromSpatiaLiteBlobWkbEx (b1, s1, gpkg_mode, gpkg_amphibious);
+    g2 = gaiaFromSpatiaLiteBlobWkbEx (b2, s2, gpkg_mode, gpkg_amphibious);
+    if (g1 == NULL || g2 == NULL)
+	goto stop;
+    if (g1->MaxX < g2->MinX || g1->MinX > g2->MaxX || g1->MaxY < g2->MinY
+	|| g1->MinY > g2->MaxY)
+	ret = 0;		/* disjoint MBRs */
+    else
+	ret =
+	    vspl_evaluate (pred->vtab->p_cache, pred->predicate, g1, b1, s1,
+			   g2, b2, s2);
+  stop:
+    if (g1 != NULL)
+	gaiaFreeGeomColl (g1);
+    if (g2 != NULL)
+	gaiaFreeGeomColl (g2);
+    if (ret < 0 && pred->predicate <= SLAYER_MBR_CONTAINS)
+	sqlite3_result_null (context);
+    else
+	sqlite3_result_int (context, ret);
+}
+
+static int
+vspl_find_geometry (sqlite3 * sqlite, const char *table_name,
+		    const char *geom_column, char **real_table,
+		    char **real_geom)
+{
+/* checks if the required Geometry is actually defined */
+    sqlite3_stmt *stmt;
+    char *sql_statement;
+    int ret;
+    int count = 0;
+    char *rt = NULL;
+    char *rg = NULL;
+
+    if (geom_column == NULL)
+	sql_statement =
+	    sqlite3_mprintf
+	    ("SELECT f_table_name, f_geometry_column FROM geometry_columns "
+	     "WHERE Upper(f_table_name) = Upper(%Q)", table_name);
+    else
+	sql_statement =
+	    sqlite3_mprintf
+	    ("SELECT f_table_name, f_geometry_column FROM geometry_columns "
+	     "WHERE Upper(f_table_name) = Upper(%Q) AND "
+	     "Upper(f_geometry_column) = Upper(%Q)", table_name, geom_column);
+    ret =
+	sqlite3_prepare_v2 (sqlite, sql_statement, strlen (sql_statement),
+			    &stmt, NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	return 0;
+    while (1)
+      {
+	  /* scrolling the result set rows */
+	  ret = sqlite3_step (stmt);
+	  if (ret == SQLITE_DONE)
+	      break;		/* end of result set */
+	  if (ret == SQLITE_ROW)
+	    {
+		const char *v = (const char *) sqlite3_column_text (stmt, 0);
+		int len = sqlite3_column_bytes (stmt, 0);
+		if (rt)
+		    free (rt);
+		rt = malloc (len + 1);
+		strcpy (rt, v);
+		v = (const char *) sqlite3_column_text (stmt, 1);
+		len = sqlite3_column_bytes (stmt, 1);
+		if (rg)
+		    free (rg);
+		rg = malloc (len + 1);
+		strcpy (rg, v);
+		count++;
+	    }
+      }
+    sqlite3_finalize (stmt);
+    if (count != 1)
+      {
+	  if (rt)
+	      free (rt);
+	  if (rg)
+	      free (rg);
+	  return 0;
+      }
+    *real_table = rt;
+    *real_geom = rg;
+    return 1;
+}
+
+static int
+vspl_is_indexed (VirtualSpatialLayerPtr p_vt)
+{
+/* checks if the SpatialIndex supports the Geometry column */
+    sqlite3_stmt *stmt;
+    char *sql_statement;
+    int ret;
+    int count = 0;
+    sql_statement =
+	sqlite3_mprintf ("SELECT "
+			 "(SELECT Count(*) FROM sqlite_master WHERE type = 'table' "
+			 "AND Upper(name) = 'SPATIALINDEX'), "
+			 "(SELECT Count(*) FROM geometry_columns "
+			 "WHERE Upper(f_table_name) = Upper(%Q) AND "
+			 "Upper(f_geometry_column) = Upper(%Q) AND "
+			 "spatial_index_enabled = 1) + "
+			 "(SELECT Count(*) FROM sqlite_master WHERE type = 'table' "
+			 "AND Upper(name) = Upper('idx_' || %Q || '_' || %Q || '_qmbr'))",
+			 p_vt->table, p_vt->geometry, p_vt->table,
+			 p_vt->geometry);
+    ret =
+	sqlite3_prepare_v2 (p_vt->db, sql_statement, strlen (sql_statement),
+			    &stmt, NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	return 0;
+    if (sqlite3_step (stmt) == SQLITE_ROW)
+      {
+	  if (sqlite3_column_int (stmt, 0) > 0
+	      && sqlite3_column_int (stmt, 1) > 0)
+	      count = 1;
+      }
+    sqlite3_finalize (stmt);
+    return count;
+}
+
+static void
+vspl_free_columns (VirtualSpatialLayerPtr p_vt)
+{
+/* memory cleanup - column names */
+    int i;
+    if (p_vt->columns == NULL)
+	return;
+    for (i = 0; i < p_vt->n_columns; i++)
+	sqlite3_free (p_vt->columns[i]);
+    free (p_vt->columns);
+    p_vt->columns = NULL;
+    p_vt->n_columns = 0;
+}
+
+static int
+vspl_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
+	     sqlite3_vtab ** ppVTab, char **pzErr)
+{
+/* creates the virtual table wrapping some Geometry table */
+    VirtualSpatialLayerPtr p_vt;
+    char *buf;
+    char *prev;
+    char *vtable = NULL;
+    char *table = NULL;
+    char *geom = NULL;
+    char *xname;
+    char *xtype;
+    char **results;
+    int rows;
+    int columns;
+    int ret;
+    int i;
+    if (argc == 4 || argc == 5)
+      {
+	  vtable = gaiaDequotedSql ((char *) argv[2]);
+	  table = gaiaDequotedSql ((char *) argv[3]);
+	  if (argc == 5)
+	      geom = gaiaDequotedSql ((char *) argv[4]);
+      }
+    else
+      {
+	  *pzErr =
+	      sqlite3_mprintf
+	      ("[VirtualSpatialLayer module] CREATE VIRTUAL: illegal arg list {table_name [, geometry_column]}\n");
+	  return SQLITE_ERROR;
+      }
+    p_vt =
+	(VirtualSpatialLayerPtr) sqlite3_malloc (sizeof (VirtualSpatialLayer));
+    if (!p_vt)
+	return SQLITE_NOMEM;
+    p_vt->db = db;
+    p_vt->p_cache = pAux;
+    p_vt->pModule = &my_slayer_module;
+    p_vt->nRef = 0;
+    p_vt->zErrMsg = NULL;
+    p_vt->table = NULL;
+    p_vt->geometry = NULL;
+    p_vt->geom_column = -1;
+    p_vt->n_columns = 0;
+    p_vt->columns = NULL;
+    for (i = 0; i < SLAYER_PREDICATES; i++)
+      {
+	  p_vt->predicates[i].predicate = i;
+	  p_vt->predicates[i].vtab = p_vt;
+      }
+    if (!vspl_find_geometry (db, table, geom, &(p_vt->table), &(p_vt->geometry)))
+      {
+	  *pzErr =
+	      sqlite3_mprintf
+	      ("[VirtualSpatialLayer module] CREATE VIRTUAL: \"%s\" isn't a (unique) Geometry table\n",
+	       table);
+	  goto error;
+      }
+
+/* retrieving the wrapped table columns */
+    xname = gaiaDoubleQuotedSql (p_vt->table);
+    buf = sqlite3_mprintf ("PRAGMA main.table_info(\"%s\")", xname);
+    free (xname);
+    ret = sqlite3_get_table (db, buf, &results, &rows, &columns, NULL);
+    sqlite3_free (buf);
+    if (ret != SQLITE_OK || rows < 1)
+      {
+	  if (ret == SQLITE_OK)
+	      sqlite3_free_table (results);
+	  *pzErr =
+	      sqlite3_mprintf
+	      ("[VirtualSpatialLayer module] CREATE VIRTUAL: unable to read the \"%s\" columns\n",
+	       p_vt->table);
+	  goto error;
+      }
+    p_vt->columns = malloc (sizeof (char *) * rows);
+    p_vt->n_columns = rows;
+    xname = gaiaDoubleQuotedSql (vtable);
+    buf = sqlite3_mprintf ("CREATE TABLE \"%s\" (", xname);
+    free (xname);
+    for (i = 1; i <= rows; i++)
+      {
+	  const char *name = results[(i * columns) + 1];
+	  const char *type = results[(i * columns) + 2];
+	  p_vt->columns[i - 1] = sqlite3_mprintf ("%s", name);
+	  if (strcasecmp (name, p_vt->geometry) == 0)
+	      p_vt->geom_column = i - 1;
+	  xname = gaiaDoubleQuotedSql (name);
+	  xtype = gaiaDoubleQuotedSql (type);
+	  prev = buf;
+	  if (i == 1)
+	      buf = sqlite3_mprintf ("%s\"%s\" %s", prev, xname, xtype);
+	  else
+	      buf = sqlite3_mprintf ("%s, \"%s\" %s", prev, xname, xtype);
+	  sqlite3_free (prev);
+	  free (xname);
+	  free (xtype);
+      }
+    sqlite3_free_table (results);
+    prev = buf;
+    buf = sqlite3_mprintf ("%s)", prev);
+    sqlite3_free (prev);
+
+/* preparing the COLUMNs for this VIRTUAL TABLE */
+    if (sqlite3_declare_vtab (db, buf) != SQLITE_OK)
+      {
+	  *pzErr =
+	      sqlite3_mprintf
+	      ("[VirtualSpatialLayer module] CREATE VIRTUAL: invalid SQL statement \"%s\"",
+	       buf);
+	  sqlite3_free (buf);
+	  goto error;
+      }
+    sqlite3_free (buf);
+    free (vtable);
+    free (table);
+    if (geom != NULL)
+	free (geom);
+    *ppVTab = (sqlite3_vtab *) p_vt;
+    return SQLITE_OK;
+
+  error:
+    free (vtable);
+    free (table);
+    if (geom != NULL)
+	free (geom);
+    vspl_free_columns (p_vt);
+    if (p_vt->table != NULL)
+	free (p_vt->table);
+    if (p_vt->geometry != NULL)
+	free (p_vt->geometry);
+    sqlite3_free (p_vt);
+    return SQLITE_ERROR;
+}
+
+static int
+vspl_connect (sqlite3 * db, void *pAux, int argc, const char *const *argv,
+	      sqlite3_vtab ** ppVTab, char **pzErr)
+{
+/* connects the virtual table - simply aliases vspl_create() */
+    return vspl_create (db, pAux, argc, argv, ppVTab, pzErr);
+}
+
+static int
+vspl_best_index (sqlite3_vtab * pVTab, sqlite3_index_info * pIdxInfo)
+{
+/*
+/ best index selection
+/
+/ idxNum = 0: full table scan
+/ idxNum = 1: SpatialIndex filter (geom MATCH <frame>)
+/ idxNum = 2: ROWID lookup
+*/
+    int i;
+    int spatial = -1;
+    int rowid = -1;
+    VirtualSpatialLayerPtr p_vt = (VirtualSpatialLayerPtr) pVTab;
+    for (i = 0; i < pIdxInfo->nConstraint; i++)
+      {
+	  /* verifying the constraints */
+	  struct sqlite3_index_constraint *p = &(pIdxInfo->aConstraint[i]);
+	  if (!(p->usable))
+	      continue;
+	  if (p->iColumn < 0 && p->op == SQLITE_INDEX_CONSTRAINT_EQ)
+	      rowid = i;
+	  if (p->iColumn != p_vt->geom_column || spatial >= 0)
+	      continue;
+	  if (p->op == SQLITE_INDEX_CONSTRAINT_MATCH)
+	      spatial = i;
+      }
+    if (rowid >= 0)
+      {
+	  /* ROWID lookup */
+	  pIdxInfo->idxNum = 2;
+	  pIdxInfo->aConstraintUsage[rowid].argvIndex = 1;
+	  pIdxInfo->aConstraintUsage[rowid].omit = 1;
+	  pIdxInfo->estimatedCost = 1.0;
+      }
+    else if (spatial >= 0)
+      {
+	  /* SpatialIndex filter: MATCH is a plain MBR filter */
+	  pIdxInfo->idxNum = 1;
+	  pIdxInfo->aConstraintUsage[spatial].argvIndex = 1;
+	  pIdxInfo->aConstraintUsage[spatial].omit = 1;
+	  pIdxInfo->estimatedCost = 1000.0;
+      }
+    else
+      {
+	  /* full table scan */
+	  pIdxInfo->idxNum = 0;
+	  pIdxInfo->estimatedCost = 1000000.0;
+      }
+    return SQLITE_OK;
+}
+
+static int
+vspl_disconnect (sqlite3_vtab * pVTab)
+{
+/* disconnects the virtual table */
+    VirtualSpatialLayerPtr p_vt = (VirtualSpatialLayerPtr) pVTab;
+    vspl_free_columns (p_vt);
+    if (p_vt->table != NULL)
+	free (p_vt->table);
+    if (p_vt->geometry != NULL)
+	free (p_vt->geometry);
+    sqlite3_free (p_vt);
+    return SQLITE_OK;
+}
+
+static int
+vspl_destroy (sqlite3_vtab * pVTab)
+{
+/* destroys the virtual table - simply aliases vspl_disconnect() */
+    return vspl_disconnect (pVTab);
+}
+
+static int
+vspl_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
+{
+/* opening a new cursor */
+    VirtualSpatialLayerCursorPtr cursor =
+	(VirtualSpatialLayerCursorPtr)
+	sqlite3_malloc (sizeof (VirtualSpatialLayerCursor));
+    if (cursor == NULL)
+	return SQLITE_ERROR;
+    cursor->pVtab = (VirtualSpatialLayerPtr) pVTab;
+    cursor->stmt = NULL;
+    cursor->eof = 1;
+    *ppCursor = (sqlite3_vtab_cursor *) cursor;
+    return SQLITE_OK;
+}
+
+static int
+vspl_close (sqlite3_vtab_cursor * pCursor)
+{
+/* closing the cursor */
+    VirtualSpatialLayerCursorPtr cursor =
+	(VirtualSpatialLayerCursorPtr) pCursor;
+    if (cursor->stmt != NULL)
+	sqlite3_finalize (cursor->stmt);
+    sqlite3_free (pCursor);
+    return SQLITE_OK;
+}
+
+static void
+vspl_read_row (VirtualSpatialLayerCursorPtr cursor)
+{
+/* fetching the next row from the wrapped table */
+    int ret = sqlite3_step (cursor->stmt);
+    if (ret == SQLITE_ROW)
+	cursor->eof = 0;
+    else
+	cursor->eof = 1;
+}
+
+static int
+vspl_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
+	     int argc, sqlite3_value ** argv)
+{
+/* setting up a cursor filter */
+    int i;
+    int ret;
+    char *sql;
+    char *prev;
+    char *xname;
+    char *xgeom;
+    VirtualSpatialLayerCursorPtr cursor =
+	(VirtualSpatialLayerCursorPtr) pCursor;
+    VirtualSpatialLayerPtr p_vt = cursor->pVtab;
+    if (idxStr)
+	idxStr = idxStr;	/* unused arg warning suppression */
+    if (cursor->stmt != NULL)
+	sqlite3_finalize (cursor->stmt);
+    cursor->stmt = NULL;
+    cursor->eof = 1;
+    if (idxNum != 0 && argc != 1)
+	return SQLITE_OK;
+    if (idxNum == 1 && sqlite3_value_type (argv[0]) != SQLITE_BLOB)
+	return SQLITE_OK;	/* not a Geometry: empty result */
+
+/* composing the SELECT statement */
+    sql = sqlite3_mprintf ("SELECT ROWID");
+    for (i = 0; i < p_vt->n_columns; i++)
+      {
+	  xname = gaiaDoubleQuotedSql (p_vt->columns[i]);
+	  prev = sql;
+	  sql = sqlite3_mprintf ("%s, \"%s\"", prev, xname);
+	  sqlite3_free (prev);
+	  free (xname);
+      }
+    xname = gaiaDoubleQuotedSql (p_vt->table);
+    prev = sql;
+    sql = sqlite3_mprintf ("%s FROM main.\"%s\"", prev, xname);
+    sqlite3_free (prev);
+    free (xname);
+    if (idxNum == 1)
+      {
+	  prev = sql;
+	  if (vspl_is_indexed (p_vt))
+	      sql = sqlite3_mprintf ("%s WHERE ROWID IN (SELECT ROWID FROM "
+				     "main.SpatialIndex WHERE f_table_name = %Q "
+				     "AND f_geometry_column = %Q AND search_frame = ?)",
+				     prev, p_vt->table, p_vt->geometry);
+	  else
+	    {
+		/* no SpatialIndex: falling back to a full table scan */
+		xgeom = gaiaDoubleQuotedSql (p_vt->geometry);
+		sql = sqlite3_mprintf ("%s WHERE MbrIntersects(\"%s\", ?) = 1",
+				       prev, xgeom);
+		free (xgeom);
+	    }
+	  sqlite3_free (prev);
+      }
+    if (idxNum == 2)
+      {
+	  prev = sql;
+	  sql = sqlite3_mprintf ("%s WHERE ROWID = ?", prev);
+	  sqlite3_free (prev);
+      }
+    ret =
+	sqlite3_prepare_v2 (p_vt->db, sql, strlen (sql), &(cursor->stmt),
+			    NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+      {
+	  cursor->stmt = NULL;
+	  return ret;
+      }
+    if (idxNum != 0)
+	sqlite3_bind_value (cursor->stmt, 1, argv[0]);
+    vspl_read_row (cursor);
+    return SQLITE_OK;
+}
+
+static int
+vspl_next (sqlite3_vtab_cursor * pCursor)
+{
+/* fetching next row from cursor */
+    VirtualSpatialLayerCursorPtr cursor =
+	(VirtualSpatialLayerCursorPtr) pCursor;
+    if (!(cursor->eof))
+	vspl_read_row (cursor);
+    return SQLITE_OK;
+}
+
+static int
+vspl_eof (sqlite3_vtab_cursor * pCursor)
+{
+/* cursor EOF */
+    VirtualSpatialLayerCursorPtr cursor =
+	(VirtualSpatialLayerCursorPtr) pCursor;
+    return cursor->eof;
+}
+
+static int
+vspl_column (sqlite3_vtab_cursor * pCursor, sqlite3_context * pContext,
+	     int column)
+{
+/* fetching value for the Nth column */
+    VirtualSpatialLayerCursorPtr cursor =
+	(VirtualSpatialLayerCursorPtr) pCursor;
+    if (cursor->eof || column < 0 || column >= cursor->pVtab->n_columns)
+      {
+	  sqlite3_result_null (pContext);
+	  return SQLITE_OK;
+      }
+    sqlite3_result_value (pContext,
+			  sqlite3_column_value (cursor->stmt, column + 1));
+    return SQLITE_OK;
+}
+
+static int
+vspl_rowid (sqlite3_vtab_cursor * pCursor, sqlite_int64 * pRowid)
+{
+/* fetching the ROWID */
+    VirtualSpatialLayerCursorPtr cursor =
+	(VirtualSpatialLayerCursorPtr) pCursor;
+    if (cursor->eof)
+	*pRowid = 0;
+    else
+	*pRowid = sqlite3_column_int64 (cursor->stmt, 0);
+    return SQLITE_OK;
+}
+
+static int
+vspl_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
+	     sqlite_int64 * pRowid)
+{
+/* generic update [INSERT / UPDATE / DELETE */
+    if (pRowid || argc || argv || pVTab)
+	pRowid = pRowid;	/* unused arg warning suppression */
+/* read only datasource */
+    return SQLITE_READONLY;
+}
+
+static int
+vspl_begin (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vspl_sync (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vspl_commit (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vspl_rollback (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vspl_find_function (sqlite3_vtab * pVTab, int nArg, const char *zName,
+		    void (**pxFunc) (sqlite3_context *, int,
+				     sqlite3_value **), void **ppArg)
+{
+/*
+/ overloading the spatial predicates whose first argument is a column
+/ of the Virtual Table: they are evaluated row by row, because only
+/ MATCH reaches vspl_best_index() as an indexable constraint
+*/
+    VirtualSpatialLayerPtr p_vt = (VirtualSpatialLayerPtr) pVTab;
+    int predicate = vspl_parse_function (nArg, zName);
+    if (predicate < 0)
+	return 0;
+    *pxFunc = vspl_predicate;
+    *ppArg = &(p_vt->predicates[predicate]);
+    return 1;
+}
+
+static int
+vspl_rename (sqlite3_vtab * pVTab, const char *zNew)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    if (zNew)
+	zNew = zNew;		/* unused arg warning suppression */
+    return SQLITE_ERROR;
+}
+
+static int
+spliteVirtualSpatialLayerInit (sqlite3 * db, void *p_cache)
+{
+    int rc = SQLITE_OK;
+    my_slayer_module.iVersion = 1;
+    my_slayer_module.xCreate = &vspl_create;
+    my_slayer_module.xConnect = &vspl_connect;
+    my_slayer_module.xBestIndex = &vspl_best_index;
+    my_slayer_module.xDisconnect = &vspl_disconnect;
+    my_slayer_module.xDestroy = &vspl_destroy;
+    my_slayer_module.xOpen = &vspl_open;
+    my_slayer_module.xClose = &vspl_close;
+    my_slayer_module.xFilter = &vspl_filter;
+    my_slayer_module.xNext = &vspl_next;
+    my_slayer_module.xEof = &vspl_eof;
+    my_slayer_module.xColumn = &vspl_column;
+    my_slayer_module.xRowid = &vspl_rowid;
+    my_slayer_module.xUpdate = &vspl_update;
+    my_slayer_module.xBegin = &vspl_begin;
+    my_slayer_module.xSync = &vspl_sync;
+    my_slayer_module.xCommit = &vspl_commit;
+    my_slayer_module.xRollback = &vspl_rollback;
+    my_slayer_module.xFindFunction = &vspl_find_function;
+    my_slayer_module.xRename = &vspl_rename;
+    sqlite3_create_module_v2 (db, "VirtualSpatialLayer", &my_slayer_module,
+			      p_cache, 0);
+    return rc;
+}
+
+SPATIALITE_PRIVATE int
+virtual_spatiallayer_extension_init (void *xdb, const void *p_cache)
+{
+    sqlite3 *db = (sqlite3 *) xdb;
+    return spliteVirtualSpatialLayerInit (db, (void *) p_cache);
+}
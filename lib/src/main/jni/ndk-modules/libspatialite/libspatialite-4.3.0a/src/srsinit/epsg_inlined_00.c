@@ -1,3895 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_00 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 2000, "epsg", 2000,
-        "Anguilla 1957 / British West Indies Grid", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Anguilla_1957", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-62 +k=0.9995000000000001 +x");
-    add_proj4text (p, 1,
-        "_0=400000 +y_0=0 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Anguilla 1957 / British West Indies Grid\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Anguilla 1957\",DATUM[\"Anguilla_1957\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7012\"]],AUTHORITY[\"EPSG\",\"6600\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4600\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-62],PARAMETER[\"scale_factor\",0.9995],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_easting\",400000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"2000\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2001, "epsg", 2001,
-        "Antigua 1943 / British West Indies Grid", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Antigua_1943", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-62 +k=0.9995000000000001 +x");
-    add_proj4text (p, 1,
-        "_0=400000 +y_0=0 +ellps=clrk80 +towgs84=-255,-15,71,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Antigua 1943 / British West Indies Grid\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"Antigua 1943\",DATUM[\"Antigua_1943\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7012\"]],TOWGS84[-255,-15,71,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6601\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4601\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"central_meridian\",-62],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.9995],PARAMETER[\"false_easting\",400000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 13,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"2001\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2002, "epsg", 2002,
-        "Dominica 1945 / British West Indies Grid", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Dominica_1945", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-62 +k=0.9995000000000001 +x");
-    add_proj4text (p, 1,
-        "_0=400000 +y_0=0 +ellps=clrk80 +towgs84=725,685,536,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Dominica 1945 / British West Indies Grid\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Dominica 1945\",DATUM[\"Dominica_1945\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7012\"]],TOWGS84[725,685,536,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6602\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4602\"]],PROJECTIO");
-    add_srs_wkt (p, 8,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 9,
-        "n\",0],PARAMETER[\"central_meridian\",-62],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "cale_factor\",0.9995],PARAMETER[\"false_easting\",400000");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 13,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"2002\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2003, "epsg", 2003,
-        "Grenada 1953 / British West Indies Grid", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Grenada_1953", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-62 +k=0.9995000000000001 +x");
-    add_proj4text (p, 1,
-        "_0=400000 +y_0=0 +ellps=clrk80 +towgs84=72,213.7,93,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Grenada 1953 / British West Indies Grid\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"Grenada 1953\",DATUM[\"Grenada_1953\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7012\"]],TOWGS84[72,213.7,93,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6603\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4603\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"central_meridian\",-62],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.9995],PARAMETER[\"false_easting\",400000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 13,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"2003\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2004, "epsg", 2004,
-        "Montserrat 1958 / British West Indies Grid", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Montserrat_1958", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-62 +k=0.9995000000000001 +x");
-    add_proj4text (p, 1,
-        "_0=400000 +y_0=0 +ellps=clrk80 +towgs84=174,359,365,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Montserrat 1958 / British West Indies Grid\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"Montserrat 1958\",DATUM[\"Montserrat_1958\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7012\"]],TOWGS84[174,359,365,0,0,0,0],AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"6604\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 6,
-        "UTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AX");
-    add_srs_wkt (p, 7,
-        "IS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4604\"]],PRO");
-    add_srs_wkt (p, 8,
-        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 9,
-        "_origin\",0],PARAMETER[\"central_meridian\",-62],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"scale_factor\",0.9995],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "400000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2004\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2005, "epsg", 2005,
-        "St. Kitts 1955 / British West Indies Grid", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "St_Kitts_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-62 +k=0.9995000000000001 +x");
-    add_proj4text (p, 1,
-        "_0=400000 +y_0=0 +ellps=clrk80 +towgs84=9,183,236,0,0,0,");
-    add_proj4text (p, 2,
-        "0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"St. Kitts 1955 / British West Indies Grid\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"St. Kitts 1955\",DATUM[\"St_Kitts_1955\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7012\"]],TOWGS84[9,183,236,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6605\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4605\"]],PROJECTIO");
-    add_srs_wkt (p, 8,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 9,
-        "n\",0],PARAMETER[\"central_meridian\",-62],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "cale_factor\",0.9995],PARAMETER[\"false_easting\",400000");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 13,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"2005\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2006, "epsg", 2006,
-        "St. Lucia 1955 / British West Indies Grid", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "St_Lucia_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-62 +k=0.9995000000000001 +x");
-    add_proj4text (p, 1,
-        "_0=400000 +y_0=0 +ellps=clrk80 +towgs84=-149,128,296,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"St. Lucia 1955 / British West Indies Grid\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"St. Lucia 1955\",DATUM[\"St_Lucia_1955\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7012\"]],TOWGS84[-149,128,296,0,0,0,0],AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"6606\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[");
-    add_srs_wkt (p, 7,
-        "\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4606\"]],PROJEC");
-    add_srs_wkt (p, 8,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 9,
-        "igin\",0],PARAMETER[\"central_meridian\",-62],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"scale_factor\",0.9995],PARAMETER[\"false_easting\",400");
-    add_srs_wkt (p, 11,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2006\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2007, "epsg", 2007,
-        "St. Vincent 45 / British West Indies Grid", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "St_Vincent_1945", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-62 +k=0.9995000000000001 +x");
-    add_proj4text (p, 1,
-        "_0=400000 +y_0=0 +ellps=clrk80 +towgs84=195.671,332.517,");
-    add_proj4text (p, 2,
-        "274.607,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"St. Vincent 45 / British West Indies Grid\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"St. Vincent 1945\",DATUM[\"St_Vincent_1945\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7012\"]],TOWGS84[195.671,332.517,274.607,0,0,");
-    add_srs_wkt (p, 4,
-        "0,0],AUTHORITY[\"EPSG\",\"6607\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 5,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 6,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 7,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4607\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 10,
-        "62],PARAMETER[\"scale_factor\",0.9995],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",400000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 14,
-        "007\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2008, "epsg", 2008,
-        "NAD27(CGQ77) / SCoPQ zone 2 (deprecated)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_CGQ77", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-55.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(CGQ77) / SCoPQ zone 2 (deprecated)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD27(CGQ77)\",DATUM[\"North_American_Datum_1927_CG");
-    add_srs_wkt (p, 2,
-        "Q77\",SPHEROID[\"Clarke 1866\",6378206.4,294.97869821389");
-    add_srs_wkt (p, 3,
-        "82,AUTHORITY[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"66");
-    add_srs_wkt (p, 4,
-        "09\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4609\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",-55.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",0.9999],PARAMETER[\"false_easting\",304800],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"2008\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2009, "epsg", 2009,
-        "NAD27(CGQ77) / SCoPQ zone 3", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_CGQ77", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-58.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(CGQ77) / SCoPQ zone 3\",GEOGCS[\"NAD27(CG");
-    add_srs_wkt (p, 1,
-        "Q77)\",DATUM[\"North_American_Datum_1927_CGQ77\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6609\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4609\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",-58.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"2009\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2010, "epsg", 2010,
-        "NAD27(CGQ77) / SCoPQ zone 4", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_CGQ77", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-61.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(CGQ77) / SCoPQ zone 4\",GEOGCS[\"NAD27(CG");
-    add_srs_wkt (p, 1,
-        "Q77)\",DATUM[\"North_American_Datum_1927_CGQ77\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6609\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4609\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",-61.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"2010\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2011, "epsg", 2011,
-        "NAD27(CGQ77) / SCoPQ zone 5", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_CGQ77", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-64.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(CGQ77) / SCoPQ zone 5\",GEOGCS[\"NAD27(CG");
-    add_srs_wkt (p, 1,
-        "Q77)\",DATUM[\"North_American_Datum_1927_CGQ77\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6609\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4609\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",-64.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"2011\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2012, "epsg", 2012,
-        "NAD27(CGQ77) / SCoPQ zone 6", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_CGQ77", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-67.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(CGQ77) / SCoPQ zone 6\",GEOGCS[\"NAD27(CG");
-    add_srs_wkt (p, 1,
-        "Q77)\",DATUM[\"North_American_Datum_1927_CGQ77\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6609\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4609\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",-67.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"2012\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2013, "epsg", 2013,
-        "NAD27(CGQ77) / SCoPQ zone 7", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_CGQ77", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-70.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(CGQ77) / SCoPQ zone 7\",GEOGCS[\"NAD27(CG");
-    add_srs_wkt (p, 1,
-        "Q77)\",DATUM[\"North_American_Datum_1927_CGQ77\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6609\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4609\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",-70.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"2013\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2014, "epsg", 2014,
-        "NAD27(CGQ77) / SCoPQ zone 8", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_CGQ77", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-73.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(CGQ77) / SCoPQ zone 8\",GEOGCS[\"NAD27(CG");
-    add_srs_wkt (p, 1,
-        "Q77)\",DATUM[\"North_American_Datum_1927_CGQ77\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6609\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4609\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",-73.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"2014\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2015, "epsg", 2015,
-        "NAD27(CGQ77) / SCoPQ zone 9", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_CGQ77", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-76.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(CGQ77) / SCoPQ zone 9\",GEOGCS[\"NAD27(CG");
-    add_srs_wkt (p, 1,
-        "Q77)\",DATUM[\"North_American_Datum_1927_CGQ77\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6609\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4609\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",-76.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"2015\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2016, "epsg", 2016,
-        "NAD27(CGQ77) / SCoPQ zone 10", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_CGQ77", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-79.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(CGQ77) / SCoPQ zone 10\",GEOGCS[\"NAD27(C");
-    add_srs_wkt (p, 1,
-        "GQ77)\",DATUM[\"North_American_Datum_1927_CGQ77\",SPHERO");
-    add_srs_wkt (p, 2,
-        "ID[\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6609\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 7,
-        "RITY[\"EPSG\",\"4609\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 8,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 9,
-        "tral_meridian\",-79.5],PARAMETER[\"scale_factor\",0.9999");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_easting\",304800],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"2016\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2017, "epsg", 2017,
-        "NAD27(76) / MTM zone 8", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_1976", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-73.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(76) / MTM zone 8\",GEOGCS[\"NAD27(76)\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"North_American_Datum_1927_1976\",SPHEROID[\"Clark");
-    add_srs_wkt (p, 2,
-        "e 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7008\"]],AUTHORITY[\"EPSG\",\"6608\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 6,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"4608\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-73.5],PARAMETER[\"scale_factor\",0.9999],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_easting\",304800],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2017\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2018, "epsg", 2018,
-        "NAD27(76) / MTM zone 9", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_1976", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-76.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(76) / MTM zone 9\",GEOGCS[\"NAD27(76)\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"North_American_Datum_1927_1976\",SPHEROID[\"Clark");
-    add_srs_wkt (p, 2,
-        "e 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7008\"]],AUTHORITY[\"EPSG\",\"6608\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 6,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"4608\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-76.5],PARAMETER[\"scale_factor\",0.9999],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_easting\",304800],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2018\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2019, "epsg", 2019,
-        "NAD27(76) / MTM zone 10", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_1976", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-79.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(76) / MTM zone 10\",GEOGCS[\"NAD27(76)\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1927_1976\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 2,
-        "ke 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6608\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4608\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 9,
-        "dian\",-79.5],PARAMETER[\"scale_factor\",0.9999],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",304800],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2019\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2020, "epsg", 2020,
-        "NAD27(76) / MTM zone 11", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_1976", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-82.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(76) / MTM zone 11\",GEOGCS[\"NAD27(76)\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1927_1976\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 2,
-        "ke 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6608\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4608\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 9,
-        "dian\",-82.5],PARAMETER[\"scale_factor\",0.9999],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",304800],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"2020\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2021, "epsg", 2021,
-        "NAD27(76) / MTM zone 12", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_1976", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-81 +k=0.9999 +x_0=304800 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(76) / MTM zone 12\",GEOGCS[\"NAD27(76)\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1927_1976\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 2,
-        "ke 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6608\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4608\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 9,
-        "dian\",-81],PARAMETER[\"scale_factor\",0.9999],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",304800],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"2021\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2022, "epsg", 2022,
-        "NAD27(76) / MTM zone 13", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_1976", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-84 +k=0.9999 +x_0=304800 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(76) / MTM zone 13\",GEOGCS[\"NAD27(76)\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1927_1976\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 2,
-        "ke 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6608\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4608\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 9,
-        "dian\",-84],PARAMETER[\"scale_factor\",0.9999],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",304800],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"2022\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2023, "epsg", 2023,
-        "NAD27(76) / MTM zone 14", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_1976", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-87 +k=0.9999 +x_0=304800 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(76) / MTM zone 14\",GEOGCS[\"NAD27(76)\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1927_1976\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 2,
-        "ke 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6608\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4608\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 9,
-        "dian\",-87],PARAMETER[\"scale_factor\",0.9999],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",304800],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"2023\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2024, "epsg", 2024,
-        "NAD27(76) / MTM zone 15", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_1976", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-90 +k=0.9999 +x_0=304800 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(76) / MTM zone 15\",GEOGCS[\"NAD27(76)\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1927_1976\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 2,
-        "ke 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6608\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4608\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 9,
-        "dian\",-90],PARAMETER[\"scale_factor\",0.9999],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",304800],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"2024\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2025, "epsg", 2025,
-        "NAD27(76) / MTM zone 16", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_1976", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-93 +k=0.9999 +x_0=304800 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(76) / MTM zone 16\",GEOGCS[\"NAD27(76)\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1927_1976\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 2,
-        "ke 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6608\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4608\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 9,
-        "dian\",-93],PARAMETER[\"scale_factor\",0.9999],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",304800],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"2025\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2026, "epsg", 2026,
-        "NAD27(76) / MTM zone 17", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_1976", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-96 +k=0.9999 +x_0=304800 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(76) / MTM zone 17\",GEOGCS[\"NAD27(76)\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1927_1976\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 2,
-        "ke 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6608\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4608\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 9,
-        "dian\",-96],PARAMETER[\"scale_factor\",0.9999],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",304800],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"2026\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2027, "epsg", 2027,
-        "NAD27(76) / UTM zone 15N", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_1976", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=15 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(76) / UTM zone 15N\",GEOGCS[\"NAD27(76)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1927_1976\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6608\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4608\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 9,
-        "dian\",-93],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"2027\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2028, "epsg", 2028,
-        "NAD27(76) / UTM zone 16N", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_1976", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=16 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(76) / UTM zone 16N\",GEOGCS[\"NAD27(76)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1927_1976\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6608\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4608\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 9,
-        "dian\",-87],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"2028\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2029, "epsg", 2029,
-        "NAD27(76) / UTM zone 17N", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_1976", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(76) / UTM zone 17N\",GEOGCS[\"NAD27(76)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1927_1976\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6608\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4608\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 9,
-        "dian\",-81],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"2029\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2030, "epsg", 2030,
-        "NAD27(76) / UTM zone 18N", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_1976", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(76) / UTM zone 18N\",GEOGCS[\"NAD27(76)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1927_1976\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6608\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4608\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 9,
-        "dian\",-75],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"2030\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2031, "epsg", 2031,
-        "NAD27(CGQ77) / UTM zone 17N", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_CGQ77", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(CGQ77) / UTM zone 17N\",GEOGCS[\"NAD27(CG");
-    add_srs_wkt (p, 1,
-        "Q77)\",DATUM[\"North_American_Datum_1927_CGQ77\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6609\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4609\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",-81],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"2031\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2032, "epsg", 2032,
-        "NAD27(CGQ77) / UTM zone 18N", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_CGQ77", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(CGQ77) / UTM zone 18N\",GEOGCS[\"NAD27(CG");
-    add_srs_wkt (p, 1,
-        "Q77)\",DATUM[\"North_American_Datum_1927_CGQ77\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6609\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4609\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",-75],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"2032\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2033, "epsg", 2033,
-        "NAD27(CGQ77) / UTM zone 19N", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_CGQ77", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(CGQ77) / UTM zone 19N\",GEOGCS[\"NAD27(CG");
-    add_srs_wkt (p, 1,
-        "Q77)\",DATUM[\"North_American_Datum_1927_CGQ77\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6609\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4609\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",-69],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"2033\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2034, "epsg", 2034,
-        "NAD27(CGQ77) / UTM zone 20N", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_CGQ77", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(CGQ77) / UTM zone 20N\",GEOGCS[\"NAD27(CG");
-    add_srs_wkt (p, 1,
-        "Q77)\",DATUM[\"North_American_Datum_1927_CGQ77\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6609\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4609\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",-63],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"2034\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2035, "epsg", 2035,
-        "NAD27(CGQ77) / UTM zone 21N", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927_CGQ77", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27(CGQ77) / UTM zone 21N\",GEOGCS[\"NAD27(CG");
-    add_srs_wkt (p, 1,
-        "Q77)\",DATUM[\"North_American_Datum_1927_CGQ77\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6609\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4609\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",-57],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"2035\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2036, "epsg", 2036,
-        "NAD83(CSRS98) / New Brunswick Stereo (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Oblique_Stereographic", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=46.5 +lon_0=-66.5 +k=0.999912 +x_0=2");
-    add_proj4text (p, 1,
-        "500000 +y_0=7500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS98) / New Brunswick Stereo (deprecate");
-    add_srs_wkt (p, 1,
-        "d)\",GEOGCS[\"NAD83(CSRS98)\",DATUM[\"NAD83_Canadian_Spa");
-    add_srs_wkt (p, 2,
-        "tial_Reference_System\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 3,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,");
-    add_srs_wkt (p, 4,
-        "0,0,0,0],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 5,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 6,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9108\"]],AXIS[\"Lati");
-    add_srs_wkt (p, 7,
-        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 8,
-        ",\"4140\"]],PROJECTION[\"Oblique_Stereographic\"],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"latitude_of_origin\",46.5],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 10,
-        "idian\",-66.5],PARAMETER[\"scale_factor\",0.999912],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",2500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",7500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "1\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AU");
-    add_srs_wkt (p, 14,
-        "THORITY[\"EPSG\",\"2036\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2037, "epsg", 2037,
-        "NAD83(CSRS98) / UTM zone 19N (deprecated)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS98) / UTM zone 19N (deprecated)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(CSRS98)\",DATUM[\"NAD83_Canadian_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9108\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4140");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-69]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2037");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2038, "epsg", 2038,
-        "NAD83(CSRS98) / UTM zone 20N (deprecated)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS98) / UTM zone 20N (deprecated)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(CSRS98)\",DATUM[\"NAD83_Canadian_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9108\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4140");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-63]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2038");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2039, "epsg", 2039,
-        "Israel / Israeli TM Grid", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Israel", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31.73439361111111 +lon_0=35.204516944");
-    add_proj4text (p, 1,
-        "44445 +k=1.0000067 +x_0=219529.584 +y_0=626907.39 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +towgs84=-48,55,52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Israel / Israeli TM Grid\",GEOGCS[\"Israel\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Israel\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 2,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[-48,55,52,0,0,0");
-    add_srs_wkt (p, 3,
-        ",0],AUTHORITY[\"EPSG\",\"6141\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 5,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41");
-    add_srs_wkt (p, 7,
-        "41\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 8,
-        "atitude_of_origin\",31.73439361111111],PARAMETER[\"centr");
-    add_srs_wkt (p, 9,
-        "al_meridian\",35.20451694444445],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1.0000067],PARAMETER[\"false_easting\",219529.584],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",626907.39],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2039\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2040, "epsg", 2040,
-        "Locodjo 1965 / UTM zone 30N", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Locodjo_1965", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=30 +ellps=clrk80 +towgs84=-125,53,467,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Locodjo 1965 / UTM zone 30N\",GEOGCS[\"Locodjo ");
-    add_srs_wkt (p, 1,
-        "1965\",DATUM[\"Locodjo_1965\",SPHEROID[\"Clarke 1880 (RG");
-    add_srs_wkt (p, 2,
-        "S)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[-125,53,467,0,0,0,0],AUTHORITY[\"EPSG\",\"6142\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4142\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",-3],PARAMETER[\"scale_factor\",0.");
-    add_srs_wkt (p, 10,
-        "9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"2040\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2041, "epsg", 2041,
-        "Abidjan 1987 / UTM zone 30N", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Abidjan_1987", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=30 +ellps=clrk80 +towgs84=-124.76,53,466");
-    add_proj4text (p, 1,
-        ".79,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Abidjan 1987 / UTM zone 30N\",GEOGCS[\"Abidjan ");
-    add_srs_wkt (p, 1,
-        "1987\",DATUM[\"Abidjan_1987\",SPHEROID[\"Clarke 1880 (RG");
-    add_srs_wkt (p, 2,
-        "S)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[-124.76,53,466.79,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "143\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4143\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 8,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",-3],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 10,
-        "\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"2041\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2042, "epsg", 2042,
-        "Locodjo 1965 / UTM zone 29N", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Locodjo_1965", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +ellps=clrk80 +towgs84=-125,53,467,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Locodjo 1965 / UTM zone 29N\",GEOGCS[\"Locodjo ");
-    add_srs_wkt (p, 1,
-        "1965\",DATUM[\"Locodjo_1965\",SPHEROID[\"Clarke 1880 (RG");
-    add_srs_wkt (p, 2,
-        "S)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[-125,53,467,0,0,0,0],AUTHORITY[\"EPSG\",\"6142\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4142\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",-9],PARAMETER[\"scale_factor\",0.");
-    add_srs_wkt (p, 10,
-        "9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"2042\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2043, "epsg", 2043,
-        "Abidjan 1987 / UTM zone 29N", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Abidjan_1987", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +ellps=clrk80 +towgs84=-124.76,53,466");
-    add_proj4text (p, 1,
-        ".79,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Abidjan 1987 / UTM zone 29N\",GEOGCS[\"Abidjan ");
-    add_srs_wkt (p, 1,
-        "1987\",DATUM[\"Abidjan_1987\",SPHEROID[\"Clarke 1880 (RG");
-    add_srs_wkt (p, 2,
-        "S)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[-124.76,53,466.79,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "143\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4143\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 8,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",-9],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 10,
-        "\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"2043\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2044, "epsg", 2044,
-        "Hanoi 1972 / Gauss-Kruger zone 18", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Hanoi_1972", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=18500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=-17.51,-108.32,-62.39,0,0,0,0 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hanoi 1972 / Gauss-Kruger zone 18\",GEOGCS[\"Ha");
-    add_srs_wkt (p, 1,
-        "noi 1972\",DATUM[\"Hanoi_1972\",SPHEROID[\"Krassowsky 19");
-    add_srs_wkt (p, 2,
-        "40\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[-17.51,-108.32,-62.39,0,0,0,0],AUTHORITY[\"EPSG\",\"614");
-    add_srs_wkt (p, 4,
-        "7\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4147\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",105],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 10,
-        "\",1],PARAMETER[\"false_easting\",18500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"2044\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2045, "epsg", 2045,
-        "Hanoi 1972 / Gauss-Kruger zone 19", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Hanoi_1972", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=19500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=-17.51,-108.32,-62.39,0,0,0,0 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hanoi 1972 / Gauss-Kruger zone 19\",GEOGCS[\"Ha");
-    add_srs_wkt (p, 1,
-        "noi 1972\",DATUM[\"Hanoi_1972\",SPHEROID[\"Krassowsky 19");
-    add_srs_wkt (p, 2,
-        "40\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[-17.51,-108.32,-62.39,0,0,0,0],AUTHORITY[\"EPSG\",\"614");
-    add_srs_wkt (p, 4,
-        "7\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4147\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",111],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 10,
-        "\",1],PARAMETER[\"false_easting\",19500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"2045\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2046, "epsg", 2046,
-        "Hartebeesthoek94 / Lo15", 0, 0,
-        "WGS 84", "Greenwich",
-        "Hartebeesthoek94", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hartebeesthoek94 / Lo15\",GEOGCS[\"Hartebeestho");
-    add_srs_wkt (p, 1,
-        "ek94\",DATUM[\"Hartebeesthoek94\",SPHEROID[\"WGS 84\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4148\"]],PROJECTION[\"Transverse_Mercator_So");
-    add_srs_wkt (p, 8,
-        "uth_Orientated\"],PARAMETER[\"latitude_of_origin\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",15],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",0],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Y\",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"2046\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2047, "epsg", 2047,
-        "Hartebeesthoek94 / Lo17", 0, 0,
-        "WGS 84", "Greenwich",
-        "Hartebeesthoek94", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=17 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hartebeesthoek94 / Lo17\",GEOGCS[\"Hartebeestho");
-    add_srs_wkt (p, 1,
-        "ek94\",DATUM[\"Hartebeesthoek94\",SPHEROID[\"WGS 84\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4148\"]],PROJECTION[\"Transverse_Mercator_So");
-    add_srs_wkt (p, 8,
-        "uth_Orientated\"],PARAMETER[\"latitude_of_origin\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",17],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",0],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Y\",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"2047\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2048, "epsg", 2048,
-        "Hartebeesthoek94 / Lo19", 0, 0,
-        "WGS 84", "Greenwich",
-        "Hartebeesthoek94", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=19 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hartebeesthoek94 / Lo19\",GEOGCS[\"Hartebeestho");
-    add_srs_wkt (p, 1,
-        "ek94\",DATUM[\"Hartebeesthoek94\",SPHEROID[\"WGS 84\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4148\"]],PROJECTION[\"Transverse_Mercator_So");
-    add_srs_wkt (p, 8,
-        "uth_Orientated\"],PARAMETER[\"latitude_of_origin\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",19],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",0],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Y\",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"2048\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2049, "epsg", 2049,
-        "Hartebeesthoek94 / Lo21", 0, 0,
-        "WGS 84", "Greenwich",
-        "Hartebeesthoek94", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hartebeesthoek94 / Lo21\",GEOGCS[\"Hartebeestho");
-    add_srs_wkt (p, 1,
-        "ek94\",DATUM[\"Hartebeesthoek94\",SPHEROID[\"WGS 84\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4148\"]],PROJECTION[\"Transverse_Mercator_So");
-    add_srs_wkt (p, 8,
-        "uth_Orientated\"],PARAMETER[\"latitude_of_origin\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",21],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",0],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Y\",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"2049\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2050, "epsg", 2050,
-        "Hartebeesthoek94 / Lo23", 0, 0,
-        "WGS 84", "Greenwich",
-        "Hartebeesthoek94", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=23 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hartebeesthoek94 / Lo23\",GEOGCS[\"Hartebeestho");
-    add_srs_wkt (p, 1,
-        "ek94\",DATUM[\"Hartebeesthoek94\",SPHEROID[\"WGS 84\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4148\"]],PROJECTION[\"Transverse_Mercator_So");
-    add_srs_wkt (p, 8,
-        "uth_Orientated\"],PARAMETER[\"latitude_of_origin\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",23],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",0],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Y\",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"2050\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2051, "epsg", 2051,
-        "Hartebeesthoek94 / Lo25", 0, 0,
-        "WGS 84", "Greenwich",
-        "Hartebeesthoek94", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=25 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hartebeesthoek94 / Lo25\",GEOGCS[\"Hartebeestho");
-    add_srs_wkt (p, 1,
-        "ek94\",DATUM[\"Hartebeesthoek94\",SPHEROID[\"WGS 84\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4148\"]],PROJECTION[\"Transverse_Mercator_So");
-    add_srs_wkt (p, 8,
-        "uth_Orientated\"],PARAMETER[\"latitude_of_origin\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",25],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",0],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Y\",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"2051\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2052, "epsg", 2052,
-        "Hartebeesthoek94 / Lo27", 0, 0,
-        "WGS 84", "Greenwich",
-        "Hartebeesthoek94", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hartebeesthoek94 / Lo27\",GEOGCS[\"Hartebeestho");
-    add_srs_wkt (p, 1,
-        "ek94\",DATUM[\"Hartebeesthoek94\",SPHEROID[\"WGS 84\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4148\"]],PROJECTION[\"Transverse_Mercator_So");
-    add_srs_wkt (p, 8,
-        "uth_Orientated\"],PARAMETER[\"latitude_of_origin\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",27],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",0],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Y\",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"2052\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2053, "epsg", 2053,
-        "Hartebeesthoek94 / Lo29", 0, 0,
-        "WGS 84", "Greenwich",
-        "Hartebeesthoek94", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=29 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hartebeesthoek94 / Lo29\",GEOGCS[\"Hartebeestho");
-    add_srs_wkt (p, 1,
-        "ek94\",DATUM[\"Hartebeesthoek94\",SPHEROID[\"WGS 84\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4148\"]],PROJECTION[\"Transverse_Mercator_So");
-    add_srs_wkt (p, 8,
-        "uth_Orientated\"],PARAMETER[\"latitude_of_origin\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",29],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",0],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Y\",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"2053\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2054, "epsg", 2054,
-        "Hartebeesthoek94 / Lo31", 0, 0,
-        "WGS 84", "Greenwich",
-        "Hartebeesthoek94", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=31 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hartebeesthoek94 / Lo31\",GEOGCS[\"Hartebeestho");
-    add_srs_wkt (p, 1,
-        "ek94\",DATUM[\"Hartebeesthoek94\",SPHEROID[\"WGS 84\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4148\"]],PROJECTION[\"Transverse_Mercator_So");
-    add_srs_wkt (p, 8,
-        "uth_Orientated\"],PARAMETER[\"latitude_of_origin\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",31],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",0],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Y\",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"2054\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2055, "epsg", 2055,
-        "Hartebeesthoek94 / Lo33", 0, 0,
-        "WGS 84", "Greenwich",
-        "Hartebeesthoek94", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hartebeesthoek94 / Lo33\",GEOGCS[\"Hartebeestho");
-    add_srs_wkt (p, 1,
-        "ek94\",DATUM[\"Hartebeesthoek94\",SPHEROID[\"WGS 84\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4148\"]],PROJECTION[\"Transverse_Mercator_So");
-    add_srs_wkt (p, 8,
-        "uth_Orientated\"],PARAMETER[\"latitude_of_origin\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",33],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",0],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Y\",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"2055\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2056, "epsg", 2056,
-        "CH1903+ / LV95", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "CH1903+", "Hotine_Oblique_Mercator_Azimuth_Center", "metre",
-        "Y", "East", "X", "North");
-    add_proj4text (p, 0,
-        "+proj=somerc +lat_0=46.95240555555556 +lon_0=7.439583333");
-    add_proj4text (p, 1,
-        "333333 +k_0=1 +x_0=2600000 +y_0=1200000 +ellps=bessel +t");
-    add_proj4text (p, 2,
-        "owgs84=674.374,15.056,405.346,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CH1903+ / LV95\",GEOGCS[\"CH1903+\",DATUM[\"CH1");
-    add_srs_wkt (p, 1,
-        "903+\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[674.374,15.056,405");
-    add_srs_wkt (p, 3,
-        ".346,0,0,0,0],AUTHORITY[\"EPSG\",\"6150\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4150\"]],PROJECTION[\"Hotine_Oblique_Mercator_Az");
-    add_srs_wkt (p, 8,
-        "imuth_Center\"],PARAMETER[\"latitude_of_center\",46.9524");
-    add_srs_wkt (p, 9,
-        "0555555556],PARAMETER[\"longitude_of_center\",7.43958333");
-    add_srs_wkt (p, 10,
-        "3333333],PARAMETER[\"azimuth\",90],PARAMETER[\"rectified");
-    add_srs_wkt (p, 11,
-        "_grid_angle\",90],PARAMETER[\"scale_factor\",1],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"false_easting\",2600000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",1200000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"Y\",EAST],AXIS[\"X\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 15,
-        "2056\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2057, "epsg", 2057,
-        "Rassadiran / Nakhl e Taqi", 0, 0,
-        "International 1924", "Greenwich",
-        "Rassadiran", "Hotine_Oblique_Mercator_Azimuth_Center", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=27.51882880555555 +lonc=52.6035391666");
-    add_proj4text (p, 1,
-        "6667 +alpha=0.5716611944444444 +k=0.999895934 +x_0=65837");
-    add_proj4text (p, 2,
-        "7.437 +y_0=3044969.194 +gamma=0.5716611944444444 +ellps=");
-    add_proj4text (p, 3,
-        "intl +towgs84=-133.63,-157.5,-158.62,0,0,0,0 +units=m +n");
-    add_proj4text (p, 4,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Rassadiran / Nakhl e Taqi\",GEOGCS[\"Rassadiran");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Rassadiran\",SPHEROID[\"International 1924\",");
-    add_srs_wkt (p, 2,
-        "6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-133.6");
-    add_srs_wkt (p, 3,
-        "3,-157.5,-158.62,0,0,0,0],AUTHORITY[\"EPSG\",\"6153\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4153\"]],PROJECTION[\"Hotine_Obliqu");
-    add_srs_wkt (p, 8,
-        "e_Mercator_Azimuth_Center\"],PARAMETER[\"latitude_of_cen");
-    add_srs_wkt (p, 9,
-        "ter\",27.51882880555555],PARAMETER[\"longitude_of_center");
-    add_srs_wkt (p, 10,
-        "\",52.60353916666667],PARAMETER[\"azimuth\",0.5716611944");
-    add_srs_wkt (p, 11,
-        "444444],PARAMETER[\"rectified_grid_angle\",0.57166119444");
-    add_srs_wkt (p, 12,
-        "44444],PARAMETER[\"scale_factor\",0.999895934],PARAMETER");
-    add_srs_wkt (p, 13,
-        "[\"false_easting\",658377.437],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 14,
-        "g\",3044969.194],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 15,
-        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 16,
-        "AUTHORITY[\"EPSG\",\"2057\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2058, "epsg", 2058,
-        "ED50(ED77) / UTM zone 38N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950_1977", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +ellps=intl +towgs84=-117,-132,-164,0");
-    add_proj4text (p, 1,
-        ",0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50(ED77) / UTM zone 38N\",GEOGCS[\"ED50(ED77)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"European_Datum_1950_1977\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "TOWGS84[-117,-132,-164,0,0,0,0],AUTHORITY[\"EPSG\",\"615");
-    add_srs_wkt (p, 4,
-        "4\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4154\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",45],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"2058\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2059, "epsg", 2059,
-        "ED50(ED77) / UTM zone 39N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950_1977", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=39 +ellps=intl +towgs84=-117,-132,-164,0");
-    add_proj4text (p, 1,
-        ",0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50(ED77) / UTM zone 39N\",GEOGCS[\"ED50(ED77)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"European_Datum_1950_1977\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "TOWGS84[-117,-132,-164,0,0,0,0],AUTHORITY[\"EPSG\",\"615");
-    add_srs_wkt (p, 4,
-        "4\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4154\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",51],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"2059\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2060, "epsg", 2060,
-        "ED50(ED77) / UTM zone 40N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950_1977", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=40 +ellps=intl +towgs84=-117,-132,-164,0");
-    add_proj4text (p, 1,
-        ",0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50(ED77) / UTM zone 40N\",GEOGCS[\"ED50(ED77)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"European_Datum_1950_1977\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "TOWGS84[-117,-132,-164,0,0,0,0],AUTHORITY[\"EPSG\",\"615");
-    add_srs_wkt (p, 4,
-        "4\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4154\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",57],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"2060\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2061, "epsg", 2061,
-        "ED50(ED77) / UTM zone 41N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950_1977", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=41 +ellps=intl +towgs84=-117,-132,-164,0");
-    add_proj4text (p, 1,
-        ",0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50(ED77) / UTM zone 41N\",GEOGCS[\"ED50(ED77)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"European_Datum_1950_1977\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "TOWGS84[-117,-132,-164,0,0,0,0],AUTHORITY[\"EPSG\",\"615");
-    add_srs_wkt (p, 4,
-        "4\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4154\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",63],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"2061\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2062, "epsg", 2062,
-        "Madrid 1870 (Madrid) / Spain", 0, 0,
-        "Struve 1860", "Madrid",
-        "Madrid_1870_Madrid", "Lambert_Conformal_Conic_1SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40 +lat_0=40 +lon_0=0 +k_0=0.9988085293");
-    add_proj4text (p, 1,
-        " +x_0=600000 +y_0=600000 +a=6378298.3 +b=6356657.1426695");
-    add_proj4text (p, 2,
-        "62 +pm=madrid +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Madrid 1870 (Madrid) / Spain\",GEOGCS[\"Madrid ");
-    add_srs_wkt (p, 1,
-        "1870 (Madrid)\",DATUM[\"Madrid_1870_Madrid\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Struve 1860\",6378298.3,294.73,AUTHORITY[\"EPSG\",\"7028");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6903\"]],PRIMEM[\"Madrid\",-3.");
-    add_srs_wkt (p, 4,
-        "687938888888889,AUTHORITY[\"EPSG\",\"8905\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4903\"]],PROJECTION[\"Lambert_Conformal_Co");
-    add_srs_wkt (p, 8,
-        "nic_1SP\"],PARAMETER[\"latitude_of_origin\",40],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",0],PARAMETER[\"scale_factor\",0.9");
-    add_srs_wkt (p, 10,
-        "988085293],PARAMETER[\"false_easting\",600000],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_northing\",600000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"2062\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2063, "epsg", 2063,
-        "Dabola 1981 / UTM zone 28N (deprecated)", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Conakry_1905", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +a=6378249.2 +b=6356515 +towgs84=-23,");
-    add_proj4text (p, 1,
-        "259,-9,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Dabola 1981 / UTM zone 28N (deprecated)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"Conakry 1905\",DATUM[\"Conakry_1905\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1880 (IGN)\",6378249.2,293.4660212936269,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7011\"]],TOWGS84[-23,259,-9,0,0,0,0],AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"6315\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[");
-    add_srs_wkt (p, 7,
-        "\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4315\"]],PROJEC");
-    add_srs_wkt (p, 8,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 9,
-        "igin\",0],PARAMETER[\"central_meridian\",-15],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"scale_factor\",0.9996],PARAMETER[\"false_easting\",500");
-    add_srs_wkt (p, 11,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2063\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2064, "epsg", 2064,
-        "Dabola 1981 / UTM zone 29N (deprecated)", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Conakry_1905", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +a=6378249.2 +b=6356515 +towgs84=-23,");
-    add_proj4text (p, 1,
-        "259,-9,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Dabola 1981 / UTM zone 29N (deprecated)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"Conakry 1905\",DATUM[\"Conakry_1905\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1880 (IGN)\",6378249.2,293.4660212936269,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7011\"]],TOWGS84[-23,259,-9,0,0,0,0],AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"6315\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[");
-    add_srs_wkt (p, 7,
-        "\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4315\"]],PROJEC");
-    add_srs_wkt (p, 8,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 9,
-        "igin\",0],PARAMETER[\"central_meridian\",-9],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 11,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2064\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2065, "epsg", 2065,
-        "S-JTSK (Ferro) / Krovak", 0, 0,
-        "Bessel 1841", "Ferro",
-        "System_Jednotne_Trigonometricke_Site_Katastralni_Ferro", "Krovak", "metre",
-        "X", "South", "Y", "West");
-    add_proj4text (p, 0,
-        "+proj=krovak +lat_0=49.5 +lon_0=42.5 +alpha=30.288139722");
-    add_proj4text (p, 1,
-        "22222 +k=0.9999 +x_0=0 +y_0=0 +ellps=bessel +towgs84=589");
-    add_proj4text (p, 2,
-        ",76,480,0,0,0,0 +pm=ferro +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"S-JTSK (Ferro) / Krovak\",GEOGCS[\"S-JTSK (Ferr");
-    add_srs_wkt (p, 1,
-        "o)\",DATUM[\"System_Jednotne_Trigonometricke_Site_Katast");
-    add_srs_wkt (p, 2,
-        "ralni_Ferro\",SPHEROID[\"Bessel 1841\",6377397.155,299.1");
-    add_srs_wkt (p, 3,
-        "528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[589,76,480,");
-    add_srs_wkt (p, 4,
-        "0,0,0,0],AUTHORITY[\"EPSG\",\"6818\"]],PRIMEM[\"Ferro\",");
-    add_srs_wkt (p, 5,
-        "-17.66666666666667,AUTHORITY[\"EPSG\",\"8909\"]],UNIT[\"");
-    add_srs_wkt (p, 6,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 8,
-        "ORITY[\"EPSG\",\"4818\"]],PROJECTION[\"Krovak\"],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"latitude_of_center\",49.5],PARAMETER[\"longitude_of");
-    add_srs_wkt (p, 10,
-        "_center\",42.5],PARAMETER[\"azimuth\",30.28813972222222]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"pseudo_standard_parallel_1\",78.5],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",0");
-    add_srs_wkt (p, 13,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"X\",SOUTH],AXIS[\"Y\",WE");
-    add_srs_wkt (p, 15,
-        "ST],AUTHORITY[\"EPSG\",\"2065\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2066, "epsg", 2066,
-        "Mount Dillon / Tobago Grid", 0, 0,
-        "Clarke 1858", "Greenwich",
-        "Mount_Dillon", "Cassini_Soldner", "Clarke's link",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=11.25217861111111 +lon_0=-60.686008888");
-    add_proj4text (p, 1,
-        "88889 +x_0=37718.66159325 +y_0=36209.91512952 +a=6378293");
-    add_proj4text (p, 2,
-        ".645208759 +b=6356617.987679838 +to_meter=0.201166195164");
-    add_proj4text (p, 3,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mount Dillon / Tobago Grid\",GEOGCS[\"Mount Dil");
-    add_srs_wkt (p, 1,
-        "lon\",DATUM[\"Mount_Dillon\",SPHEROID[\"Clarke 1858\",63");
-    add_srs_wkt (p, 2,
-        "78293.645208759,294.2606763692606,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "007\"]],AUTHORITY[\"EPSG\",\"6157\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 6,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4157\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",11.25217861111111],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",-60.68600888888889],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",187500],PARAMETER[\"false_northing\",180000],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"Clarke's link\",0.201166195164,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "039\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"2066\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2067, "epsg", 2067,
-        "Naparima 1955 / UTM zone 20N", 0, 0,
-        "International 1924", "Greenwich",
-        "Naparima_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=intl +towgs84=-0.465,372.095,1");
-    add_proj4text (p, 1,
-        "71.736,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Naparima 1955 / UTM zone 20N\",GEOGCS[\"Naparim");
-    add_srs_wkt (p, 1,
-        "a 1955\",DATUM[\"Naparima_1955\",SPHEROID[\"Internationa");
-    add_srs_wkt (p, 2,
-        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS");
-    add_srs_wkt (p, 3,
-        "84[-0.465,372.095,171.736,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6158\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4158\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",-63],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 10,
-        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2067\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2068, "epsg", 2068,
-        "ELD79 / Libya zone 5", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Libyan_Datum_1979", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=0.9999 +x_0=200000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-115.8543,-99.0583,-152.4616,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ELD79 / Libya zone 5\",GEOGCS[\"ELD79\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Libyan_Datum_1979\",SPHEROID[\"International 19");
-    add_srs_wkt (p, 2,
-        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-");
-    add_srs_wkt (p, 3,
-        "115.8543,-99.0583,-152.4616,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6159\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4159\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"central_meridian\",9],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 10,
-        "tor\",0.9999],PARAMETER[\"false_easting\",200000],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTH");
-    add_srs_wkt (p, 13,
-        "ORITY[\"EPSG\",\"2068\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2069, "epsg", 2069,
-        "ELD79 / Libya zone 6", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Libyan_Datum_1979", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=11 +k=0.9999 +x_0=200000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=intl +towgs84=-115.8543,-99.0583,-152.4616,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ELD79 / Libya zone 6\",GEOGCS[\"ELD79\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Libyan_Datum_1979\",SPHEROID[\"International 19");
-    add_srs_wkt (p, 2,
-        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-");
-    add_srs_wkt (p, 3,
-        "115.8543,-99.0583,-152.4616,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6159\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4159\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"central_meridian\",11],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.9999],PARAMETER[\"false_easting\",200000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"2069\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2070, "epsg", 2070,
-        "ELD79 / Libya zone 7", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Libyan_Datum_1979", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13 +k=0.9999 +x_0=200000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=intl +towgs84=-115.8543,-99.0583,-152.4616,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ELD79 / Libya zone 7\",GEOGCS[\"ELD79\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Libyan_Datum_1979\",SPHEROID[\"International 19");
-    add_srs_wkt (p, 2,
-        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-");
-    add_srs_wkt (p, 3,
-        "115.8543,-99.0583,-152.4616,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6159\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4159\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"central_meridian\",13],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.9999],PARAMETER[\"false_easting\",200000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"2070\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2071, "epsg", 2071,
-        "ELD79 / Libya zone 8", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Libyan_Datum_1979", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9999 +x_0=200000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=intl +towgs84=-115.8543,-99.0583,-152.4616,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ELD79 / Libya zone 8\",GEOGCS[\"ELD79\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Libyan_Datum_1979\",SPHEROID[\"International 19");
-    add_srs_wkt (p, 2,
-        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-");
-    add_srs_wkt (p, 3,
-        "115.8543,-99.0583,-152.4616,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6159\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4159\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"central_meridian\",15],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.9999],PARAMETER[\"false_easting\",200000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"2071\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2072, "epsg", 2072,
-        "ELD79 / Libya zone 9", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Libyan_Datum_1979", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=17 +k=0.9999 +x_0=200000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=intl +towgs84=-115.8543,-99.0583,-152.4616,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ELD79 / Libya zone 9\",GEOGCS[\"ELD79\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Libyan_Datum_1979\",SPHEROID[\"International 19");
-    add_srs_wkt (p, 2,
-        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-");
-    add_srs_wkt (p, 3,
-        "115.8543,-99.0583,-152.4616,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6159\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4159\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"central_meridian\",17],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.9999],PARAMETER[\"false_easting\",200000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"2072\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2073, "epsg", 2073,
-        "ELD79 / Libya zone 10", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Libyan_Datum_1979", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=19 +k=0.9999 +x_0=200000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=intl +towgs84=-115.8543,-99.0583,-152.4616,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ELD79 / Libya zone 10\",GEOGCS[\"ELD79\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Libyan_Datum_1979\",SPHEROID[\"International ");
-    add_srs_wkt (p, 2,
-        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[-115.8543,-99.0583,-152.4616,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6159\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4159\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",19],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 10,
-        "actor\",0.9999],PARAMETER[\"false_easting\",200000],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"2073\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2074, "epsg", 2074,
-        "ELD79 / Libya zone 11", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Libyan_Datum_1979", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=0.9999 +x_0=200000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=intl +towgs84=-115.8543,-99.0583,-152.4616,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ELD79 / Libya zone 11\",GEOGCS[\"ELD79\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Libyan_Datum_1979\",SPHEROID[\"International ");
-    add_srs_wkt (p, 2,
-        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[-115.8543,-99.0583,-152.4616,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6159\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4159\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",21],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 10,
-        "actor\",0.9999],PARAMETER[\"false_easting\",200000],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"2074\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2075, "epsg", 2075,
-        "ELD79 / Libya zone 12", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Libyan_Datum_1979", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=23 +k=0.9999 +x_0=200000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=intl +towgs84=-115.8543,-99.0583,-152.4616,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ELD79 / Libya zone 12\",GEOGCS[\"ELD79\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Libyan_Datum_1979\",SPHEROID[\"International ");
-    add_srs_wkt (p, 2,
-        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[-115.8543,-99.0583,-152.4616,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6159\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4159\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",23],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 10,
-        "actor\",0.9999],PARAMETER[\"false_easting\",200000],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"2075\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2076, "epsg", 2076,
-        "ELD79 / Libya zone 13", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Libyan_Datum_1979", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=25 +k=0.9999 +x_0=200000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=intl +towgs84=-115.8543,-99.0583,-152.4616,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ELD79 / Libya zone 13\",GEOGCS[\"ELD79\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Libyan_Datum_1979\",SPHEROID[\"International ");
-    add_srs_wkt (p, 2,
-        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[-115.8543,-99.0583,-152.4616,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6159\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4159\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",25],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 10,
-        "actor\",0.9999],PARAMETER[\"false_easting\",200000],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"2076\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2077, "epsg", 2077,
-        "ELD79 / UTM zone 32N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Libyan_Datum_1979", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +ellps=intl +towgs84=-115.8543,-99.05");
-    add_proj4text (p, 1,
-        "83,-152.4616,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ELD79 / UTM zone 32N\",GEOGCS[\"ELD79\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Libyan_Datum_1979\",SPHEROID[\"International 19");
-    add_srs_wkt (p, 2,
-        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-");
-    add_srs_wkt (p, 3,
-        "115.8543,-99.0583,-152.4616,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6159\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4159\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"central_meridian\",9],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 10,
-        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2077\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2078, "epsg", 2078,
-        "ELD79 / UTM zone 33N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Libyan_Datum_1979", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +ellps=intl +towgs84=-115.8543,-99.05");
-    add_proj4text (p, 1,
-        "83,-152.4616,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ELD79 / UTM zone 33N\",GEOGCS[\"ELD79\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Libyan_Datum_1979\",SPHEROID[\"International 19");
-    add_srs_wkt (p, 2,
-        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-");
-    add_srs_wkt (p, 3,
-        "115.8543,-99.0583,-152.4616,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6159\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4159\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"central_meridian\",15],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2078\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2079, "epsg", 2079,
-        "ELD79 / UTM zone 34N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Libyan_Datum_1979", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=34 +ellps=intl +towgs84=-115.8543,-99.05");
-    add_proj4text (p, 1,
-        "83,-152.4616,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ELD79 / UTM zone 34N\",GEOGCS[\"ELD79\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Libyan_Datum_1979\",SPHEROID[\"International 19");
-    add_srs_wkt (p, 2,
-        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-");
-    add_srs_wkt (p, 3,
-        "115.8543,-99.0583,-152.4616,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6159\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4159\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"central_meridian\",21],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2079\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2080, "epsg", 2080,
-        "ELD79 / UTM zone 35N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Libyan_Datum_1979", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=35 +ellps=intl +towgs84=-115.8543,-99.05");
-    add_proj4text (p, 1,
-        "83,-152.4616,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ELD79 / UTM zone 35N\",GEOGCS[\"ELD79\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Libyan_Datum_1979\",SPHEROID[\"International 19");
-    add_srs_wkt (p, 2,
-        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-");
-    add_srs_wkt (p, 3,
-        "115.8543,-99.0583,-152.4616,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6159\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4159\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"central_meridian\",27],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2080\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2081, "epsg", 2081,
-        "Chos Malal 1914 / Argentina 2", 0, 1,
-        "International 1924", "Greenwich",
-        "Chos_Malal_1914", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Chos Malal 1914 / Argentina 2\",GEOGCS[\"Chos M");
-    add_srs_wkt (p, 1,
-        "alal 1914\",DATUM[\"Chos_Malal_1914\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6160\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 6,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4160\"");
-    add_srs_wkt (p, 7,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",-90],PARAMETER[\"central_meridian\",-69]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 10,
-        "\",2500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2081\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2082, "epsg", 2082,
-        "Pampa del Castillo / Argentina 2", 0, 1,
-        "International 1924", "Greenwich",
-        "Pampa_del_Castillo", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=27.5,14,186.4,0,0,0,0 +units=m +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pampa del Castillo / Argentina 2\",GEOGCS[\"Pam");
-    add_srs_wkt (p, 1,
-        "pa del Castillo\",DATUM[\"Pampa_del_Castillo\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7022\"]],TOWGS84[27.5,14,186.4,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6161\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4161\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 9,
-        "-90],PARAMETER[\"central_meridian\",-69],PARAMETER[\"sca");
-    add_srs_wkt (p, 10,
-        "le_factor\",1],PARAMETER[\"false_easting\",2500000],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"2082\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2083, "epsg", 2083,
-        "Hito XVIII 1963 / Argentina 2", 0, 1,
-        "International 1924", "Greenwich",
-        "Hito_XVIII_1963", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=16,196,93,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hito XVIII 1963 / Argentina 2\",GEOGCS[\"Hito X");
-    add_srs_wkt (p, 1,
-        "VIII 1963\",DATUM[\"Hito_XVIII_1963\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "TOWGS84[16,196,93,0,0,0,0],AUTHORITY[\"EPSG\",\"6254\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"4254\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 8,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",-90],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"central_meridian\",-69],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 10,
-        "1],PARAMETER[\"false_easting\",2500000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "01\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 13,
-        "SG\",\"2083\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2084, "epsg", 2084,
-        "Hito XVIII 1963 / UTM zone 19S", 0, 0,
-        "International 1924", "Greenwich",
-        "Hito_XVIII_1963", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +south +ellps=intl +towgs84=16,196,93");
-    add_proj4text (p, 1,
-        ",0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hito XVIII 1963 / UTM zone 19S\",GEOGCS[\"Hito ");
-    add_srs_wkt (p, 1,
-        "XVIII 1963\",DATUM[\"Hito_XVIII_1963\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 2,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[16,196,93,0,0,0,0],AUTHORITY[\"EPSG\",\"6254\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4254\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",-69],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 10,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2084\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2085, "epsg", 2085,
-        "NAD27 / Cuba Norte (deprecated)", 0, 1,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Lambert_Conformal_Conic_1SP", "metre",
-        "Y", "North", "X", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=22.35 +lat_0=22.35 +lon_0=-81 +k_0=0.99");
-    add_proj4text (p, 1,
-        "993602 +x_0=500000 +y_0=280296.016 +datum=NAD27 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Cuba Norte (deprecated)\",GEOGCS[\"NAD2");
-    add_srs_wkt (p, 1,
-        "7\",DATUM[\"North_American_Datum_1927\",SPHEROID[\"Clark");
-    add_srs_wkt (p, 2,
-        "e 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 6,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"4267\"]],PROJECTION[\"Lambert_Conformal_Conic_1SP\"");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"latitude_of_origin\",22.35],PARAMETER[\"ce");
-    add_srs_wkt (p, 9,
-        "ntral_meridian\",-81],PARAMETER[\"scale_factor\",0.99993");
-    add_srs_wkt (p, 10,
-        "602],PARAMETER[\"false_easting\",500000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",280296.016],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Y\",NORTH],AXIS[\"X\",EAST],AUTH");
-    add_srs_wkt (p, 13,
-        "ORITY[\"EPSG\",\"2085\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2086, "epsg", 2086,
-        "NAD27 / Cuba Sur (deprecated)", 0, 1,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Lambert_Conformal_Conic_1SP", "metre",
-        "Y", "North", "X", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=20.71666666666667 +lat_0=20.71666666666");
-    add_proj4text (p, 1,
-        "667 +lon_0=-76.83333333333333 +k_0=0.99994848 +x_0=50000");
-    add_proj4text (p, 2,
-        "0 +y_0=229126.939 +datum=NAD27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Cuba Sur (deprecated)\",GEOGCS[\"NAD27\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1927\",SPHEROID[\"Clarke 1");
-    add_srs_wkt (p, 2,
-        "866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 6,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4267\"]],PROJECTION[\"Lambert_Conformal_Conic_1SP\"],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"latitude_of_origin\",20.71666666666667],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",-76.83333333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"scale_factor\",0.99994848],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",229126.939],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Y\",NORTH");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"X\",EAST],AUTHORITY[\"EPSG\",\"2086\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2087, "epsg", 2087,
-        "ELD79 / TM 12 NE", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Libyan_Datum_1979", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=0.9996 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=intl +towgs84=-115.8543,-99.0583,-152.4616,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ELD79 / TM 12 NE\",GEOGCS[\"ELD79\",DATUM[\"Eur");
-    add_srs_wkt (p, 1,
-        "opean_Libyan_Datum_1979\",SPHEROID[\"International 1924\"");
-    add_srs_wkt (p, 2,
-        ",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-115.");
-    add_srs_wkt (p, 3,
-        "8543,-99.0583,-152.4616,0,0,0,0],AUTHORITY[\"EPSG\",\"61");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4159\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",12],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"2087\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2088, "epsg", 2088,
-        "Carthage / TM 11 NE", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Carthage", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=11 +k=0.9996 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +a=6378249.2 +b=6356515 +towgs84=-263,6,431,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Carthage / TM 11 NE\",GEOGCS[\"Carthage\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Carthage\",SPHEROID[\"Clarke 1880 (IGN)\",6378249.2,2");
-    add_srs_wkt (p, 2,
-        "93.4660212936269,AUTHORITY[\"EPSG\",\"7011\"]],TOWGS84[-");
-    add_srs_wkt (p, 3,
-        "263,6,431,0,0,0,0],AUTHORITY[\"EPSG\",\"6223\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4223\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 9,
-        "l_meridian\",11],PARAMETER[\"scale_factor\",0.9996],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 11,
-        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"2088\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2089, "epsg", 2089,
-        "Yemen NGN96 / UTM zone 38N", 0, 0,
-        "WGS 84", "Greenwich",
-        "Yemen_National_Geodetic_Network_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Yemen NGN96 / UTM zone 38N\",GEOGCS[\"Yemen NGN");
-    add_srs_wkt (p, 1,
-        "96\",DATUM[\"Yemen_National_Geodetic_Network_1996\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7030\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6163\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4163\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",45],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",0.9996],PARAMETER[\"false_easting\",500000],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2089\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2090, "epsg", 2090,
-        "Yemen NGN96 / UTM zone 39N", 0, 0,
-        "WGS 84", "Greenwich",
-        "Yemen_National_Geodetic_Network_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=39 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Yemen NGN96 / UTM zone 39N\",GEOGCS[\"Yemen NGN");
-    add_srs_wkt (p, 1,
-        "96\",DATUM[\"Yemen_National_Geodetic_Network_1996\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7030\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6163\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4163\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",51],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",0.9996],PARAMETER[\"false_easting\",500000],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2090\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2091, "epsg", 2091,
-        "South Yemen / Gauss Kruger zone 8 (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "South_Yemen", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=8500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=-76,-138,67,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"South Yemen / Gauss Kruger zone 8 (deprecated)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"South Yemen\",DATUM[\"South_Yemen\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[-76,-138,67,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6164\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4164\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",45],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",8500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"2091\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2092, "epsg", 2092,
-        "South Yemen / Gauss Kruger zone 9 (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "South_Yemen", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=51 +k=1 +x_0=9500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=-76,-138,67,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"South Yemen / Gauss Kruger zone 9 (deprecated)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"South Yemen\",DATUM[\"South_Yemen\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[-76,-138,67,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6164\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4164\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",51],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",9500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"2092\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2093, "epsg", 2093,
-        "Hanoi 1972 / GK 106 NE", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Hanoi_1972", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=106 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=-17.51,-108.32,-62.39,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hanoi 1972 / GK 106 NE\",GEOGCS[\"Hanoi 1972\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Hanoi_1972\",SPHEROID[\"Krassowsky 1940\",637824");
-    add_srs_wkt (p, 2,
-        "5,298.3,AUTHORITY[\"EPSG\",\"7024\"]],TOWGS84[-17.51,-10");
-    add_srs_wkt (p, 3,
-        "8.32,-62.39,0,0,0,0],AUTHORITY[\"EPSG\",\"6147\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 7,
-        "RITY[\"EPSG\",\"4147\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 8,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 9,
-        "tral_meridian\",106],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 11,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"20");
-    add_srs_wkt (p, 13,
-        "93\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2094, "epsg", 2094,
-        "WGS 72BE / TM 106 NE", 0, 0,
-        "WGS 72", "Greenwich",
-        "WGS_1972_Transit_Broadcast_Ephemeris", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=106 +k=0.9996 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=WGS72 +towgs84=0,0,1.9,0,0,0.814,-0.38 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 72BE / TM 106 NE\",GEOGCS[\"WGS 72BE\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"WGS_1972_Transit_Broadcast_Ephemeris\",SPHEROID[\"WG");
-    add_srs_wkt (p, 2,
-        "S 72\",6378135,298.26,AUTHORITY[\"EPSG\",\"7043\"]],TOWG");
-    add_srs_wkt (p, 3,
-        "S84[0,0,1.9,0,0,0.814,-0.38],AUTHORITY[\"EPSG\",\"6324\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4324\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"central_meridian\",106],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 10,
-        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"2094\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2095, "epsg", 2095,
-        "Bissau / UTM zone 28N", 0, 0,
-        "International 1924", "Greenwich",
-        "Bissau", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=intl +towgs84=-173,253,27,0,0,");
-    add_proj4text (p, 1,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bissau / UTM zone 28N\",GEOGCS[\"Bissau\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Bissau\",SPHEROID[\"International 1924\",6378388,297,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-173,253,27,0,0,0,");
-    add_srs_wkt (p, 3,
-        "0],AUTHORITY[\"EPSG\",\"6165\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41");
-    add_srs_wkt (p, 7,
-        "65\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 8,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",-1");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"209");
-    add_srs_wkt (p, 13,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2096, "epsg", 2096,
-        "Korean 1985 / East Belt", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Korean_Datum_1985", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=129 +k=1 +x_0=200000 +y_0=5");
-    add_proj4text (p, 1,
-        "00000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korean 1985 / East Belt\",GEOGCS[\"Korean 1985\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Korean_Datum_1985\",SPHEROID[\"Bessel 1841\",63");
-    add_srs_wkt (p, 2,
-        "77397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6162\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4162\"]],");
-    add_srs_wkt (p, 7,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",38],PARAMETER[\"central_meridian\",129],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",2");
-    add_srs_wkt (p, 10,
-        "00000],PARAMETER[\"false_northing\",500000],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2096\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2097, "epsg", 2097,
-        "Korean 1985 / Central Belt", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Korean_Datum_1985", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=127 +k=1 +x_0=200000 +y_0=5");
-    add_proj4text (p, 1,
-        "00000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korean 1985 / Central Belt\",GEOGCS[\"Korean 19");
-    add_srs_wkt (p, 1,
-        "85\",DATUM[\"Korean_Datum_1985\",SPHEROID[\"Bessel 1841\"");
-    add_srs_wkt (p, 2,
-        ",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6162\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 6,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4162\"");
-    add_srs_wkt (p, 7,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",38],PARAMETER[\"central_meridian\",127],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",200000],PARAMETER[\"false_northing\",500000],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2097\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2098, "epsg", 2098,
-        "Korean 1985 / West Belt", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Korean_Datum_1985", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=125 +k=1 +x_0=200000 +y_0=5");
-    add_proj4text (p, 1,
-        "00000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korean 1985 / West Belt\",GEOGCS[\"Korean 1985\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Korean_Datum_1985\",SPHEROID[\"Bessel 1841\",63");
-    add_srs_wkt (p, 2,
-        "77397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6162\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4162\"]],");
-    add_srs_wkt (p, 7,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",38],PARAMETER[\"central_meridian\",125],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",2");
-    add_srs_wkt (p, 10,
-        "00000],PARAMETER[\"false_northing\",500000],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2098\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2099, "epsg", 2099,
-        "Qatar 1948 / Qatar Grid", 0, 0,
-        "Helmert 1906", "Greenwich",
-        "Qatar_1948", "Cassini_Soldner", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=25.38236111111111 +lon_0=50.7613888888");
-    add_proj4text (p, 1,
-        "8889 +x_0=100000 +y_0=100000 +ellps=helmert +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Qatar 1948 / Qatar Grid\",GEOGCS[\"Qatar 1948\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Qatar_1948\",SPHEROID[\"Helmert 1906\",6378200,");
-    add_srs_wkt (p, 2,
-        "298.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6286\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 6,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4286\"]],PROJECTION[\"Cass");
-    add_srs_wkt (p, 7,
-        "ini_Soldner\"],PARAMETER[\"latitude_of_origin\",25.38236");
-    add_srs_wkt (p, 8,
-        "111111111],PARAMETER[\"central_meridian\",50.76138888888");
-    add_srs_wkt (p, 9,
-        "889],PARAMETER[\"false_easting\",100000],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_northing\",100000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 12,
-        "TH],AUTHORITY[\"EPSG\",\"2099\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2100, "epsg", 2100,
-        "GGRS87 / Greek Grid", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Greek_Geodetic_Reference_System_1987", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9996 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=GRS80 +towgs84=-199.87,74.79,246.62,0,0,0,0 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GGRS87 / Greek Grid\",GEOGCS[\"GGRS87\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Greek_Geodetic_Reference_System_1987\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[-199.87,74.79,246.62,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6121\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4121\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",24],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 10,
-        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2100\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
@@ -1,4233 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_02 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 2209, "epsg", 2209,
-        "ED50 / 3-degree Gauss-Kruger zone 12", 0, 1,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=12500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / 3-degree Gauss-Kruger zone 12\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "ED50\",DATUM[\"European_Datum_1950\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[-87,-98,-121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"central_meridian\",36],PARAMETER[\"scale_factor\",1");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_easting\",12500000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "01\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 13,
-        "SG\",\"2209\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2210, "epsg", 2210,
-        "ED50 / 3-degree Gauss-Kruger zone 13", 0, 1,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=13500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / 3-degree Gauss-Kruger zone 13\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "ED50\",DATUM[\"European_Datum_1950\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[-87,-98,-121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"central_meridian\",39],PARAMETER[\"scale_factor\",1");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_easting\",13500000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "01\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 13,
-        "SG\",\"2210\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2211, "epsg", 2211,
-        "ED50 / 3-degree Gauss-Kruger zone 14", 0, 1,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=14500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / 3-degree Gauss-Kruger zone 14\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "ED50\",DATUM[\"European_Datum_1950\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[-87,-98,-121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"central_meridian\",42],PARAMETER[\"scale_factor\",1");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_easting\",14500000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "01\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 13,
-        "SG\",\"2211\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2212, "epsg", 2212,
-        "ED50 / 3-degree Gauss-Kruger zone 15", 0, 1,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=15500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / 3-degree Gauss-Kruger zone 15\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "ED50\",DATUM[\"European_Datum_1950\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[-87,-98,-121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"central_meridian\",45],PARAMETER[\"scale_factor\",1");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_easting\",15500000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "01\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 13,
-        "SG\",\"2212\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2213, "epsg", 2213,
-        "ETRS89 / TM 30 NE", 0, 0,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=0.9996 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / TM 30 NE\",GEOGCS[\"ETRS89\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Terrestrial_Reference_System_1989\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6258\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"central_meridian\",30],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 10,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"2213\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2214, "epsg", 2214,
-        "Douala 1948 / AOF west (deprecated)", 0, 0,
-        "International 1924", "Greenwich",
-        "Douala_1948", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=10.5 +k=0.999 +x_0=1000000 +");
-    add_proj4text (p, 1,
-        "y_0=1000000 +ellps=intl +towgs84=-206.1,-174.7,-87.7,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Douala 1948 / AOF west (deprecated)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Douala 1948\",DATUM[\"Douala_1948\",SPHEROID[\"Internati");
-    add_srs_wkt (p, 2,
-        "onal 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TO");
-    add_srs_wkt (p, 3,
-        "WGS84[-206.1,-174.7,-87.7,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6192\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4192\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",10.5],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.999],PARAMETER[\"false_easting\",1000000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 13,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2214\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2215, "epsg", 2215,
-        "Manoca 1962 / UTM zone 32N", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Manoca_1962", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +a=6378249.2 +b=6356515 +towgs84=-70.");
-    add_proj4text (p, 1,
-        "9,-151.8,-41.4,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Manoca 1962 / UTM zone 32N\",GEOGCS[\"Manoca 19");
-    add_srs_wkt (p, 1,
-        "62\",DATUM[\"Manoca_1962\",SPHEROID[\"Clarke 1880 (IGN)\"");
-    add_srs_wkt (p, 2,
-        ",6378249.2,293.4660212936269,AUTHORITY[\"EPSG\",\"7011\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[-70.9,-151.8,-41.4,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6193\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4193\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",9],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2215\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2216, "epsg", 2216,
-        "Qornoq 1927 / UTM zone 22N", 0, 0,
-        "International 1924", "Greenwich",
-        "Qornoq_1927", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +ellps=intl +towgs84=164,138,-189,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Qornoq 1927 / UTM zone 22N\",GEOGCS[\"Qornoq 19");
-    add_srs_wkt (p, 1,
-        "27\",DATUM[\"Qornoq_1927\",SPHEROID[\"International 1924");
-    add_srs_wkt (p, 2,
-        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[164");
-    add_srs_wkt (p, 3,
-        ",138,-189,0,0,0,0],AUTHORITY[\"EPSG\",\"6194\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4194\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 9,
-        "l_meridian\",-51],PARAMETER[\"scale_factor\",0.9996],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_easting\",500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"2216\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2217, "epsg", 2217,
-        "Qornoq 1927 / UTM zone 23N", 0, 0,
-        "International 1924", "Greenwich",
-        "Qornoq_1927", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=23 +ellps=intl +towgs84=164,138,-189,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Qornoq 1927 / UTM zone 23N\",GEOGCS[\"Qornoq 19");
-    add_srs_wkt (p, 1,
-        "27\",DATUM[\"Qornoq_1927\",SPHEROID[\"International 1924");
-    add_srs_wkt (p, 2,
-        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[164");
-    add_srs_wkt (p, 3,
-        ",138,-189,0,0,0,0],AUTHORITY[\"EPSG\",\"6194\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4194\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 9,
-        "l_meridian\",-45],PARAMETER[\"scale_factor\",0.9996],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_easting\",500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"2217\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2219, "epsg", 2219,
-        "ATS77 / UTM zone 19N", 0, 0,
-        "Average Terrestrial System 1977", "Greenwich",
-        "Average_Terrestrial_System_1977", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +a=6378135 +b=6356750.304921594 +unit");
-    add_proj4text (p, 1,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ATS77 / UTM zone 19N\",GEOGCS[\"ATS77\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Average_Terrestrial_System_1977\",SPHEROID[\"Average Ter");
-    add_srs_wkt (p, 2,
-        "restrial System 1977\",6378135,298.257,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7041\"]],AUTHORITY[\"EPSG\",\"6122\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4122\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 9,
-        "dian\",-69],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"2219\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2220, "epsg", 2220,
-        "ATS77 / UTM zone 20N", 0, 0,
-        "Average Terrestrial System 1977", "Greenwich",
-        "Average_Terrestrial_System_1977", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +a=6378135 +b=6356750.304921594 +unit");
-    add_proj4text (p, 1,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ATS77 / UTM zone 20N\",GEOGCS[\"ATS77\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Average_Terrestrial_System_1977\",SPHEROID[\"Average Ter");
-    add_srs_wkt (p, 2,
-        "restrial System 1977\",6378135,298.257,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7041\"]],AUTHORITY[\"EPSG\",\"6122\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4122\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 9,
-        "dian\",-63],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"2220\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2222, "epsg", 2222,
-        "NAD83 / Arizona East (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-110.1666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Arizona East (ft)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWG");
-    add_srs_wkt (p, 3,
-        "S84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"latitude_of_origin\",31],PARAMETER[\"centr");
-    add_srs_wkt (p, 9,
-        "al_meridian\",-110.1666666666667],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",0.9999],PARAMETER[\"false_easting\",700000],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9002\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"2222\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2223, "epsg", 2223,
-        "NAD83 / Arizona Central (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-111.9166666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Arizona Central (ft)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",31],PARAMETER[\"c");
-    add_srs_wkt (p, 9,
-        "entral_meridian\",-111.9166666666667],PARAMETER[\"scale_");
-    add_srs_wkt (p, 10,
-        "factor\",0.9999],PARAMETER[\"false_easting\",700000],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"9002\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"2223\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2224, "epsg", 2224,
-        "NAD83 / Arizona West (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-113.75 +k=0.999933333 +x_0");
-    add_proj4text (p, 1,
-        "=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Arizona West (ft)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWG");
-    add_srs_wkt (p, 3,
-        "S84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"latitude_of_origin\",31],PARAMETER[\"centr");
-    add_srs_wkt (p, 9,
-        "al_meridian\",-113.75],PARAMETER[\"scale_factor\",0.9999");
-    add_srs_wkt (p, 10,
-        "33333],PARAMETER[\"false_easting\",700000],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9002\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"2224\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2225, "epsg", 2225,
-        "NAD83 / California zone 1 (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.66666666666666 +lat_2=40 +lat_0=39.3");
-    add_proj4text (p, 1,
-        "3333333333334 +lon_0=-122 +x_0=2000000.0001016 +y_0=5000");
-    add_proj4text (p, 2,
-        "00.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / California zone 1 (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",41.6");
-    add_srs_wkt (p, 9,
-        "6666666666666],PARAMETER[\"standard_parallel_2\",40],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"latitude_of_origin\",39.33333333333334],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"central_meridian\",-122],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 12,
-        ",6561666.667],PARAMETER[\"false_northing\",1640416.667],");
-    add_srs_wkt (p, 13,
-        "UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"E");
-    add_srs_wkt (p, 14,
-        "PSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTH");
-    add_srs_wkt (p, 15,
-        "ORITY[\"EPSG\",\"2225\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2226, "epsg", 2226,
-        "NAD83 / California zone 2 (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.83333333333334 +lat_2=38.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=37.66666666666666 +lon_0=-122 +x_0=2000000.00");
-    add_proj4text (p, 2,
-        "01016 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0,0,0");
-    add_proj4text (p, 3,
-        ",0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / California zone 2 (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",39.8");
-    add_srs_wkt (p, 9,
-        "3333333333334],PARAMETER[\"standard_parallel_2\",38.3333");
-    add_srs_wkt (p, 10,
-        "3333333334],PARAMETER[\"latitude_of_origin\",37.66666666");
-    add_srs_wkt (p, 11,
-        "666666],PARAMETER[\"central_meridian\",-122],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_easting\",6561666.667],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",1640416.667],UNIT[\"US survey foot\",0.3048006096012192");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y");
-    add_srs_wkt (p, 15,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2226\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2227, "epsg", 2227,
-        "NAD83 / California zone 3 (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.5 +lon_0=-120.5 +x_0=2000000.0001016 +y_0=");
-    add_proj4text (p, 2,
-        "500000.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 3,
-        "nits=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / California zone 3 (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",38.4");
-    add_srs_wkt (p, 9,
-        "3333333333333],PARAMETER[\"standard_parallel_2\",37.0666");
-    add_srs_wkt (p, 10,
-        "6666666667],PARAMETER[\"latitude_of_origin\",36.5],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"central_meridian\",-120.5],PARAMETER[\"false_east");
-    add_srs_wkt (p, 12,
-        "ing\",6561666.667],PARAMETER[\"false_northing\",1640416.");
-    add_srs_wkt (p, 13,
-        "667],UNIT[\"US survey foot\",0.3048006096012192,AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH]");
-    add_srs_wkt (p, 15,
-        ",AUTHORITY[\"EPSG\",\"2227\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2228, "epsg", 2228,
-        "NAD83 / California zone 4 (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.25 +lat_2=36 +lat_0=35.3333333333333");
-    add_proj4text (p, 1,
-        "4 +lon_0=-119 +x_0=2000000.0001016 +y_0=500000.000101600");
-    add_proj4text (p, 2,
-        "1 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / California zone 4 (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",37.2");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"standard_parallel_2\",36],PARAMETER[\"lat");
-    add_srs_wkt (p, 10,
-        "itude_of_origin\",35.33333333333334],PARAMETER[\"central");
-    add_srs_wkt (p, 11,
-        "_meridian\",-119],PARAMETER[\"false_easting\",6561666.66");
-    add_srs_wkt (p, 12,
-        "7],PARAMETER[\"false_northing\",1640416.667],UNIT[\"US s");
-    add_srs_wkt (p, 13,
-        "urvey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 14,
-        "3\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"2228\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2229, "epsg", 2229,
-        "NAD83 / California zone 5 (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.46666666666667 +lat_2=34.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.5 +lon_0=-118 +x_0=2000000.0001016 +y_0=50");
-    add_proj4text (p, 2,
-        "0000.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 3,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / California zone 5 (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",35.4");
-    add_srs_wkt (p, 9,
-        "6666666666667],PARAMETER[\"standard_parallel_2\",34.0333");
-    add_srs_wkt (p, 10,
-        "3333333333],PARAMETER[\"latitude_of_origin\",33.5],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"central_meridian\",-118],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 12,
-        "g\",6561666.667],PARAMETER[\"false_northing\",1640416.66");
-    add_srs_wkt (p, 13,
-        "7],UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY[");
-    add_srs_wkt (p, 14,
-        "\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],A");
-    add_srs_wkt (p, 15,
-        "UTHORITY[\"EPSG\",\"2229\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2230, "epsg", 2230,
-        "NAD83 / California zone 6 (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.88333333333333 +lat_2=32.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=32.16666666666666 +lon_0=-116.25 +x_0=2000000");
-    add_proj4text (p, 2,
-        ".0001016 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / California zone 6 (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",33.8");
-    add_srs_wkt (p, 9,
-        "8333333333333],PARAMETER[\"standard_parallel_2\",32.7833");
-    add_srs_wkt (p, 10,
-        "3333333333],PARAMETER[\"latitude_of_origin\",32.16666666");
-    add_srs_wkt (p, 11,
-        "666666],PARAMETER[\"central_meridian\",-116.25],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"false_easting\",6561666.667],PARAMETER[\"false_north");
-    add_srs_wkt (p, 13,
-        "ing\",1640416.667],UNIT[\"US survey foot\",0.30480060960");
-    add_srs_wkt (p, 14,
-        "12192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXI");
-    add_srs_wkt (p, 15,
-        "S[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2230\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2231, "epsg", 2231,
-        "NAD83 / Colorado North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.78333333333333 +lat_2=39.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=39.33333333333334 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Colorado North (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",40.78333");
-    add_srs_wkt (p, 9,
-        "333333333],PARAMETER[\"standard_parallel_2\",39.71666666");
-    add_srs_wkt (p, 10,
-        "666667],PARAMETER[\"latitude_of_origin\",39.333333333333");
-    add_srs_wkt (p, 11,
-        "34],PARAMETER[\"central_meridian\",-105.5],PARAMETER[\"f");
-    add_srs_wkt (p, 12,
-        "alse_easting\",3000000],PARAMETER[\"false_northing\",100");
-    add_srs_wkt (p, 13,
-        "0000],UNIT[\"US survey foot\",0.3048006096012192,AUTHORI");
-    add_srs_wkt (p, 14,
-        "TY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH");
-    add_srs_wkt (p, 15,
-        "],AUTHORITY[\"EPSG\",\"2231\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2232, "epsg", 2232,
-        "NAD83 / Colorado Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.75 +lat_2=38.45 +lat_0=37.8333333333");
-    add_proj4text (p, 1,
-        "3334 +lon_0=-105.5 +x_0=914401.8288036576 +y_0=304800.60");
-    add_proj4text (p, 2,
-        "96012192 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Colorado Central (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confor");
-    add_srs_wkt (p, 8,
-        "mal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",39.75");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_2\",38.45],PARAMETER[\"l");
-    add_srs_wkt (p, 10,
-        "atitude_of_origin\",37.83333333333334],PARAMETER[\"centr");
-    add_srs_wkt (p, 11,
-        "al_meridian\",-105.5],PARAMETER[\"false_easting\",300000");
-    add_srs_wkt (p, 12,
-        "0],PARAMETER[\"false_northing\",1000000],UNIT[\"US surve");
-    add_srs_wkt (p, 13,
-        "y foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]");
-    add_srs_wkt (p, 14,
-        "],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 15,
-        "\"2232\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2233, "epsg", 2233,
-        "NAD83 / Colorado South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.23333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.66666666666666 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Colorado South (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",38.43333");
-    add_srs_wkt (p, 9,
-        "333333333],PARAMETER[\"standard_parallel_2\",37.23333333");
-    add_srs_wkt (p, 10,
-        "333333],PARAMETER[\"latitude_of_origin\",36.666666666666");
-    add_srs_wkt (p, 11,
-        "66],PARAMETER[\"central_meridian\",-105.5],PARAMETER[\"f");
-    add_srs_wkt (p, 12,
-        "alse_easting\",3000000],PARAMETER[\"false_northing\",100");
-    add_srs_wkt (p, 13,
-        "0000],UNIT[\"US survey foot\",0.3048006096012192,AUTHORI");
-    add_srs_wkt (p, 14,
-        "TY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH");
-    add_srs_wkt (p, 15,
-        "],AUTHORITY[\"EPSG\",\"2233\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2234, "epsg", 2234,
-        "NAD83 / Connecticut (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.86666666666667 +lat_2=41.2 +lat_0=40");
-    add_proj4text (p, 1,
-        ".83333333333334 +lon_0=-72.75 +x_0=304800.6096012192 +y_");
-    add_proj4text (p, 2,
-        "0=152400.3048006096 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 3,
-        "+units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Connecticut (ftUS)\",GEOGCS[\"NAD83\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 8,
-        "onic_2SP\"],PARAMETER[\"standard_parallel_1\",41.8666666");
-    add_srs_wkt (p, 9,
-        "6666667],PARAMETER[\"standard_parallel_2\",41.2],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"latitude_of_origin\",40.83333333333334],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "central_meridian\",-72.75],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 12,
-        "000000],PARAMETER[\"false_northing\",500000],UNIT[\"US s");
-    add_srs_wkt (p, 13,
-        "urvey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 14,
-        "3\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"2234\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2235, "epsg", 2235,
-        "NAD83 / Delaware (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=-75.41666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "995 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Delaware (ftUS)\",GEOGCS[\"NAD83\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",38],PARAMETER[\"centra");
-    add_srs_wkt (p, 9,
-        "l_meridian\",-75.41666666666667],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",0.999995],PARAMETER[\"false_easting\",656166.667],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0.");
-    add_srs_wkt (p, 12,
-        "3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2235\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2236, "epsg", 2236,
-        "NAD83 / Florida East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-81 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Florida East (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",24.33333333333333],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"central_meridian\",-81],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.999941177],PARAMETER[\"false_easting\",656166.6");
-    add_srs_wkt (p, 11,
-        "67],PARAMETER[\"false_northing\",0],UNIT[\"US survey foo");
-    add_srs_wkt (p, 12,
-        "t\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"223");
-    add_srs_wkt (p, 14,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2237, "epsg", 2237,
-        "NAD83 / Florida West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-82 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Florida West (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",24.33333333333333],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"central_meridian\",-82],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.999941177],PARAMETER[\"false_easting\",656166.6");
-    add_srs_wkt (p, 11,
-        "67],PARAMETER[\"false_northing\",0],UNIT[\"US survey foo");
-    add_srs_wkt (p, 12,
-        "t\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"223");
-    add_srs_wkt (p, 14,
-        "7\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2238, "epsg", 2238,
-        "NAD83 / Florida North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.75 +lat_2=29.58333333333333 +lat_0=2");
-    add_proj4text (p, 1,
-        "9 +lon_0=-84.5 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Florida North (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",30.75],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_2\",29.58333333333333],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"latitude_of_origin\",29],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 11,
-        "idian\",-84.5],PARAMETER[\"false_easting\",1968500],PARA");
-    add_srs_wkt (p, 12,
-        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30");
-    add_srs_wkt (p, 13,
-        "48006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 14,
-        "EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2238\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2239, "epsg", 2239,
-        "NAD83 / Georgia East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-82.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs84=0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Georgia East (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",30],PARAMETER[\"cen");
-    add_srs_wkt (p, 9,
-        "tral_meridian\",-82.16666666666667],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.9999],PARAMETER[\"false_easting\",656166.667],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0");
-    add_srs_wkt (p, 12,
-        ".3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X");
-    add_srs_wkt (p, 13,
-        "\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2239\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2240, "epsg", 2240,
-        "NAD83 / Georgia West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-84.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84=0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Georgia West (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",30],PARAMETER[\"cen");
-    add_srs_wkt (p, 9,
-        "tral_meridian\",-84.16666666666667],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.9999],PARAMETER[\"false_easting\",2296583.333],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",");
-    add_srs_wkt (p, 12,
-        "0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2240\"]");
-    add_srs_wkt (p, 14,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2241, "epsg", 2241,
-        "NAD83 / Idaho East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-112.1666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.9999473679999999 +x_0=200000.0001016002 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Idaho East (ftUS)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWG");
-    add_srs_wkt (p, 3,
-        "S84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"latitude_of_origin\",41.66666666666666],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",-112.1666666666667],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"scale_factor\",0.999947368],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 11,
-        "ng\",656166.667],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"2241\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2242, "epsg", 2242,
-        "NAD83 / Idaho Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-114 +k=0.99");
-    add_proj4text (p, 1,
-        "99473679999999 +x_0=500000.0001016001 +y_0=0 +ellps=GRS8");
-    add_proj4text (p, 2,
-        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Idaho Central (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",41.66666666666666");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-114],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.999947368],PARAMETER[\"false_easting\",16404");
-    add_srs_wkt (p, 11,
-        "16.667],PARAMETER[\"false_northing\",0],UNIT[\"US survey");
-    add_srs_wkt (p, 12,
-        " foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2242\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2243, "epsg", 2243,
-        "NAD83 / Idaho West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-115.75 +k=0");
-    add_proj4text (p, 1,
-        ".999933333 +x_0=800000.0001016001 +y_0=0 +ellps=GRS80 +t");
-    add_proj4text (p, 2,
-        "owgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Idaho West (ftUS)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWG");
-    add_srs_wkt (p, 3,
-        "S84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"latitude_of_origin\",41.66666666666666],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",-115.75],PARAMETER[\"scale_");
-    add_srs_wkt (p, 10,
-        "factor\",0.999933333],PARAMETER[\"false_easting\",262466");
-    add_srs_wkt (p, 11,
-        "6.667],PARAMETER[\"false_northing\",0],UNIT[\"US survey ");
-    add_srs_wkt (p, 12,
-        "foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2243\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2244, "epsg", 2244,
-        "NAD83 / Indiana East (ftUS) (deprecated)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=99999.99989839978 +y_0=249364.9987299975 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Indiana East (ftUS) (deprecated)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 8,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"central_meridian\",-85.66666666666667],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"scale_factor\",0.999966667],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",328083.333],PARAMETER[\"false_northing\",818125],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTH");
-    add_srs_wkt (p, 14,
-        "ORITY[\"EPSG\",\"2244\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2245, "epsg", 2245,
-        "NAD83 / Indiana West (ftUS) (deprecated)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=900000 +y_0=249364.9987299975 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Indiana West (ftUS) (deprecated)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 8,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"central_meridian\",-87.08333333333333],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"scale_factor\",0.999966667],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",2952750],PARAMETER[\"false_northing\",818125],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 14,
-        "TY[\"EPSG\",\"2245\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2246, "epsg", 2246,
-        "NAD83 / Kentucky North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000.0001016001 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no");
-    add_proj4text (p, 3,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Kentucky North (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",37.96666");
-    add_srs_wkt (p, 9,
-        "666666667],PARAMETER[\"standard_parallel_2\",38.96666666");
-    add_srs_wkt (p, 10,
-        "666667],PARAMETER[\"latitude_of_origin\",37.5],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"central_meridian\",-84.25],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 12,
-        ",1640416.667],PARAMETER[\"false_northing\",0],UNIT[\"US ");
-    add_srs_wkt (p, 13,
-        "survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 14,
-        "03\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EP");
-    add_srs_wkt (p, 15,
-        "SG\",\"2246\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2247, "epsg", 2247,
-        "NAD83 / Kentucky South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001016001 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Kentucky South (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",37.93333");
-    add_srs_wkt (p, 9,
-        "333333333],PARAMETER[\"standard_parallel_2\",36.73333333");
-    add_srs_wkt (p, 10,
-        "333333],PARAMETER[\"latitude_of_origin\",36.333333333333");
-    add_srs_wkt (p, 11,
-        "34],PARAMETER[\"central_meridian\",-85.75],PARAMETER[\"f");
-    add_srs_wkt (p, 12,
-        "alse_easting\",1640416.667],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",1640416.667],UNIT[\"US survey foot\",0.3048006096012192");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y");
-    add_srs_wkt (p, 15,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2247\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2248, "epsg", 2248,
-        "NAD83 / Maryland (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666");
-    add_proj4text (p, 1,
-        "666 +lon_0=-77 +x_0=399999.9998983998 +y_0=0 +ellps=GRS8");
-    add_proj4text (p, 2,
-        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Maryland (ftUS)\",GEOGCS[\"NAD83\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 8,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",39.45],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_2\",38.3],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 10,
-        "f_origin\",37.66666666666666],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 11,
-        "an\",-77],PARAMETER[\"false_easting\",1312333.333],PARAM");
-    add_srs_wkt (p, 12,
-        "ETER[\"false_northing\",0],UNIT[\"US survey foot\",0.304");
-    add_srs_wkt (p, 13,
-        "8006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",E");
-    add_srs_wkt (p, 14,
-        "AST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2248\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2249, "epsg", 2249,
-        "NAD83 / Massachusetts Mainland (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000.0001016002 +y_0=7");
-    add_proj4text (p, 2,
-        "50000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Massachusetts Mainland (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",4");
-    add_srs_wkt (p, 9,
-        "2.68333333333333],PARAMETER[\"standard_parallel_2\",41.7");
-    add_srs_wkt (p, 10,
-        "1666666666667],PARAMETER[\"latitude_of_origin\",41],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"central_meridian\",-71.5],PARAMETER[\"false_east");
-    add_srs_wkt (p, 12,
-        "ing\",656166.667],PARAMETER[\"false_northing\",2460625],");
-    add_srs_wkt (p, 13,
-        "UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"E");
-    add_srs_wkt (p, 14,
-        "PSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTH");
-    add_srs_wkt (p, 15,
-        "ORITY[\"EPSG\",\"2249\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2250, "epsg", 2250,
-        "NAD83 / Massachusetts Island (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000.0001016001 +y_0=0");
-    add_proj4text (p, 2,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de");
-    add_proj4text (p, 3,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Massachusetts Island (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",4");
-    add_srs_wkt (p, 9,
-        "1.48333333333333],PARAMETER[\"standard_parallel_2\",41.2");
-    add_srs_wkt (p, 10,
-        "8333333333333],PARAMETER[\"latitude_of_origin\",41],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"central_meridian\",-70.5],PARAMETER[\"false_east");
-    add_srs_wkt (p, 12,
-        "ing\",1640416.667],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 13,
-        "\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 15,
-        "[\"EPSG\",\"2250\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2251, "epsg", 2251,
-        "NAD83 / Michigan North (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=7999999.999");
-    add_proj4text (p, 2,
-        "968001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Michigan North (ft)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 8,
-        "onic_2SP\"],PARAMETER[\"standard_parallel_1\",47.0833333");
-    add_srs_wkt (p, 9,
-        "3333334],PARAMETER[\"standard_parallel_2\",45.4833333333");
-    add_srs_wkt (p, 10,
-        "3333],PARAMETER[\"latitude_of_origin\",44.78333333333333");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"central_meridian\",-87],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "easting\",26246719.16],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 13,
-        "NIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2251\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2252, "epsg", 2252,
-        "NAD83 / Michigan Central (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43");
-    add_proj4text (p, 1,
-        ".31666666666667 +lon_0=-84.36666666666666 +x_0=5999999.9");
-    add_proj4text (p, 2,
-        "99976001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 3,
-        "ts=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Michigan Central (ft)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",45.7],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_2\",44.18333333333333],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"latitude_of_origin\",43.31666666666667],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"central_meridian\",-84.36666666666666],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_easting\",19685039.37],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 13,
-        "0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AX");
-    add_srs_wkt (p, 14,
-        "IS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"22");
-    add_srs_wkt (p, 15,
-        "52\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2253, "epsg", 2253,
-        "NAD83 / Michigan South (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41");
-    add_proj4text (p, 1,
-        ".5 +lon_0=-84.36666666666666 +x_0=3999999.999984 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Michigan South (ft)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 8,
-        "onic_2SP\"],PARAMETER[\"standard_parallel_1\",43.6666666");
-    add_srs_wkt (p, 9,
-        "6666666],PARAMETER[\"standard_parallel_2\",42.1],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"latitude_of_origin\",41.5],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 11,
-        "dian\",-84.36666666666666],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 12,
-        "3123359.58],PARAMETER[\"false_northing\",0],UNIT[\"foot\"");
-    add_srs_wkt (p, 13,
-        ",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X\",EAST],A");
-    add_srs_wkt (p, 14,
-        "XIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2253\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2254, "epsg", 2254,
-        "NAD83 / Mississippi East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Mississippi East (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mer");
-    add_srs_wkt (p, 8,
-        "cator\"],PARAMETER[\"latitude_of_origin\",29.5],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",-88.83333333333333],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "cale_factor\",0.99995],PARAMETER[\"false_easting\",98425");
-    add_srs_wkt (p, 11,
-        "0.0000000002],PARAMETER[\"false_northing\",0],UNIT[\"US ");
-    add_srs_wkt (p, 12,
-        "survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 13,
-        "03\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EP");
-    add_srs_wkt (p, 14,
-        "SG\",\"2254\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2255, "epsg", 2255,
-        "NAD83 / Mississippi West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Mississippi West (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mer");
-    add_srs_wkt (p, 8,
-        "cator\"],PARAMETER[\"latitude_of_origin\",29.5],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",-90.33333333333333],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "cale_factor\",0.99995],PARAMETER[\"false_easting\",22965");
-    add_srs_wkt (p, 11,
-        "83.333],PARAMETER[\"false_northing\",0],UNIT[\"US survey");
-    add_srs_wkt (p, 12,
-        " foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2255\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2256, "epsg", 2256,
-        "NAD83 / Montana (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5");
-    add_proj4text (p, 1,
-        " +x_0=599999.9999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Montana (ft)\",GEOGCS[\"NAD83\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2S");
-    add_srs_wkt (p, 8,
-        "P\"],PARAMETER[\"standard_parallel_1\",49],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "tandard_parallel_2\",45],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",44.25],PARAMETER[\"central_meridian\",-109.5],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",1968503.937],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"2256\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2257, "epsg", 2257,
-        "NAD83 / New Mexico East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New Mexico East (ftUS)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 8,
-        "tor\"],PARAMETER[\"latitude_of_origin\",31],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "central_meridian\",-104.3333333333333],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.999909091],PARAMETER[\"false_easting\",54133");
-    add_srs_wkt (p, 11,
-        "7.5],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo");
-    add_srs_wkt (p, 12,
-        "ot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"22");
-    add_srs_wkt (p, 14,
-        "57\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2258, "epsg", 2258,
-        "NAD83 / New Mexico Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000");
-    add_proj4text (p, 1,
-        "00.0001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New Mexico Central (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",31],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"central_meridian\",-106.25],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",0.9999],PARAMETER[\"false_easting\",1640416.667],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_northing\",0],UNIT[\"US survey foot\",0.3048");
-    add_srs_wkt (p, 12,
-        "006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2258\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2259, "epsg", 2259,
-        "NAD83 / New Mexico West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "916667 +x_0=830000.0001016001 +y_0=0 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New Mexico West (ftUS)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 8,
-        "tor\"],PARAMETER[\"latitude_of_origin\",31],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "central_meridian\",-107.8333333333333],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.999916667],PARAMETER[\"false_easting\",27230");
-    add_srs_wkt (p, 11,
-        "91.667],PARAMETER[\"false_northing\",0],UNIT[\"US survey");
-    add_srs_wkt (p, 12,
-        " foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2259\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2260, "epsg", 2260,
-        "NAD83 / New York East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New York East (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",38.83333333333334");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-74.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",492125],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0");
-    add_srs_wkt (p, 12,
-        ".3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X");
-    add_srs_wkt (p, 13,
-        "\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2260\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2261, "epsg", 2261,
-        "NAD83 / New York Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=249999.9998983998 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New York Central (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mer");
-    add_srs_wkt (p, 8,
-        "cator\"],PARAMETER[\"latitude_of_origin\",40],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"central_meridian\",-76.58333333333333],PARAMETER[\"sca");
-    add_srs_wkt (p, 10,
-        "le_factor\",0.9999375],PARAMETER[\"false_easting\",82020");
-    add_srs_wkt (p, 11,
-        "8.3330000002],PARAMETER[\"false_northing\",0],UNIT[\"US ");
-    add_srs_wkt (p, 12,
-        "survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 13,
-        "03\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EP");
-    add_srs_wkt (p, 14,
-        "SG\",\"2261\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2262, "epsg", 2262,
-        "NAD83 / New York West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=350000.0001016001 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New York West (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",40],PARAMETER[\"c");
-    add_srs_wkt (p, 9,
-        "entral_meridian\",-78.58333333333333],PARAMETER[\"scale_");
-    add_srs_wkt (p, 10,
-        "factor\",0.9999375],PARAMETER[\"false_easting\",1148291.");
-    add_srs_wkt (p, 11,
-        "667],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo");
-    add_srs_wkt (p, 12,
-        "ot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"22");
-    add_srs_wkt (p, 14,
-        "62\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2263, "epsg", 2263,
-        "NAD83 / New York Long Island (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000.0000");
-    add_proj4text (p, 2,
-        "000001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New York Long Island (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",4");
-    add_srs_wkt (p, 9,
-        "1.03333333333333],PARAMETER[\"standard_parallel_2\",40.6");
-    add_srs_wkt (p, 10,
-        "6666666666666],PARAMETER[\"latitude_of_origin\",40.16666");
-    add_srs_wkt (p, 11,
-        "666666666],PARAMETER[\"central_meridian\",-74],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_easting\",984250.0000000002],PARAMETER[\"false_");
-    add_srs_wkt (p, 13,
-        "northing\",0],UNIT[\"US survey foot\",0.3048006096012192");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y");
-    add_srs_wkt (p, 15,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2263\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2264, "epsg", 2264,
-        "NAD83 / North Carolina (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.2192024384 +y_0=");
-    add_proj4text (p, 2,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / North Carolina (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",36.16666");
-    add_srs_wkt (p, 9,
-        "666666666],PARAMETER[\"standard_parallel_2\",34.33333333");
-    add_srs_wkt (p, 10,
-        "333334],PARAMETER[\"latitude_of_origin\",33.75],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"central_meridian\",-79],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 12,
-        "2000000],PARAMETER[\"false_northing\",0],UNIT[\"US surve");
-    add_srs_wkt (p, 13,
-        "y foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]");
-    add_srs_wkt (p, 14,
-        "],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 15,
-        "\"2264\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2265, "epsg", 2265,
-        "NAD83 / North Dakota North (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=47 +lon_0=-100.5 +x_0=599999.9999976 +y_0=0 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / North Dakota North (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confor");
-    add_srs_wkt (p, 8,
-        "mal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",48.73");
-    add_srs_wkt (p, 9,
-        "333333333333],PARAMETER[\"standard_parallel_2\",47.43333");
-    add_srs_wkt (p, 10,
-        "333333333],PARAMETER[\"latitude_of_origin\",47],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"central_meridian\",-100.5],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 12,
-        "\",1968503.937],PARAMETER[\"false_northing\",0],UNIT[\"f");
-    add_srs_wkt (p, 13,
-        "oot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 14,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2265\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2266, "epsg", 2266,
-        "NAD83 / North Dakota South (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=599999.9");
-    add_proj4text (p, 2,
-        "999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / North Dakota South (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confor");
-    add_srs_wkt (p, 8,
-        "mal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",47.48");
-    add_srs_wkt (p, 9,
-        "333333333333],PARAMETER[\"standard_parallel_2\",46.18333");
-    add_srs_wkt (p, 10,
-        "333333333],PARAMETER[\"latitude_of_origin\",45.666666666");
-    add_srs_wkt (p, 11,
-        "66666],PARAMETER[\"central_meridian\",-100.5],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_easting\",1968503.937],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 13,
-        "g\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]");
-    add_srs_wkt (p, 14,
-        "],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 15,
-        "\"2266\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2267, "epsg", 2267,
-        "NAD83 / Oklahoma North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Oklahoma North (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",36.76666");
-    add_srs_wkt (p, 9,
-        "666666667],PARAMETER[\"standard_parallel_2\",35.56666666");
-    add_srs_wkt (p, 10,
-        "666667],PARAMETER[\"latitude_of_origin\",35],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "central_meridian\",-98],PARAMETER[\"false_easting\",1968");
-    add_srs_wkt (p, 12,
-        "500],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo");
-    add_srs_wkt (p, 13,
-        "ot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AX");
-    add_srs_wkt (p, 14,
-        "IS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"22");
-    add_srs_wkt (p, 15,
-        "67\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2268, "epsg", 2268,
-        "NAD83 / Oklahoma South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Oklahoma South (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",35.23333");
-    add_srs_wkt (p, 9,
-        "333333333],PARAMETER[\"standard_parallel_2\",33.93333333");
-    add_srs_wkt (p, 10,
-        "333333],PARAMETER[\"latitude_of_origin\",33.333333333333");
-    add_srs_wkt (p, 11,
-        "34],PARAMETER[\"central_meridian\",-98],PARAMETER[\"fals");
-    add_srs_wkt (p, 12,
-        "e_easting\",1968500],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 13,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 15,
-        "TY[\"EPSG\",\"2268\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2269, "epsg", 2269,
-        "NAD83 / Oregon North (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=2500000.0001424 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Oregon North (ft)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWG");
-    add_srs_wkt (p, 3,
-        "S84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Co");
-    add_srs_wkt (p, 8,
-        "nic_2SP\"],PARAMETER[\"standard_parallel_1\",46],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_2\",44.33333333333334],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"latitude_of_origin\",43.66666666666666],PARAMETER[\"ce");
-    add_srs_wkt (p, 11,
-        "ntral_meridian\",-120.5],PARAMETER[\"false_easting\",820");
-    add_srs_wkt (p, 12,
-        "2099.738],PARAMETER[\"false_northing\",0],UNIT[\"foot\",");
-    add_srs_wkt (p, 13,
-        "0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X\",EAST],AX");
-    add_srs_wkt (p, 14,
-        "IS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2269\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2270, "epsg", 2270,
-        "NAD83 / Oregon South (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=1500000.0001464 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Oregon South (ft)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWG");
-    add_srs_wkt (p, 3,
-        "S84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Co");
-    add_srs_wkt (p, 8,
-        "nic_2SP\"],PARAMETER[\"standard_parallel_1\",44],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_2\",42.33333333333334],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"latitude_of_origin\",41.66666666666666],PARAMETER[\"ce");
-    add_srs_wkt (p, 11,
-        "ntral_meridian\",-120.5],PARAMETER[\"false_easting\",492");
-    add_srs_wkt (p, 12,
-        "1259.843],PARAMETER[\"false_northing\",0],UNIT[\"foot\",");
-    add_srs_wkt (p, 13,
-        "0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X\",EAST],AX");
-    add_srs_wkt (p, 14,
-        "IS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2270\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2271, "epsg", 2271,
-        "NAD83 / Pennsylvania North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4");
-    add_proj4text (p, 1,
-        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Pennsylvania North (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",41.9");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"standard_parallel_2\",40.88333333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"latitude_of_origin\",40.16666666666666],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"central_meridian\",-77.75],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 12,
-        "ting\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"U");
-    add_srs_wkt (p, 13,
-        "S survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 15,
-        "EPSG\",\"2271\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2272, "epsg", 2272,
-        "NAD83 / Pennsylvania South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Pennsylvania South (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",40.9");
-    add_srs_wkt (p, 9,
-        "6666666666667],PARAMETER[\"standard_parallel_2\",39.9333");
-    add_srs_wkt (p, 10,
-        "3333333333],PARAMETER[\"latitude_of_origin\",39.33333333");
-    add_srs_wkt (p, 11,
-        "333334],PARAMETER[\"central_meridian\",-77.75],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_easting\",1968500],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",0],UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],");
-    add_srs_wkt (p, 15,
-        "AUTHORITY[\"EPSG\",\"2272\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2273, "epsg", 2273,
-        "NAD83 / South Carolina (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31");
-    add_proj4text (p, 1,
-        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / South Carolina (ft)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 8,
-        "onic_2SP\"],PARAMETER[\"standard_parallel_1\",34.8333333");
-    add_srs_wkt (p, 9,
-        "3333334],PARAMETER[\"standard_parallel_2\",32.5],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"latitude_of_origin\",31.83333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "central_meridian\",-81],PARAMETER[\"false_easting\",2000");
-    add_srs_wkt (p, 12,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.304");
-    add_srs_wkt (p, 13,
-        "8,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X\",EAST],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Y\",NORTH],AUTHORITY[\"EPSG\",\"2273\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2274, "epsg", 2274,
-        "NAD83 / Tennessee (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3");
-    add_proj4text (p, 1,
-        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Tennessee (ftUS)\",GEOGCS[\"NAD83\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 2,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS");
-    add_srs_wkt (p, 3,
-        "84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 8,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",36.4166666666");
-    add_srs_wkt (p, 9,
-        "6666],PARAMETER[\"standard_parallel_2\",35.25],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"latitude_of_origin\",34.33333333333334],PARAMETER[\"c");
-    add_srs_wkt (p, 11,
-        "entral_meridian\",-86],PARAMETER[\"false_easting\",19685");
-    add_srs_wkt (p, 12,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"US survey foo");
-    add_srs_wkt (p, 13,
-        "t\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"227");
-    add_srs_wkt (p, 15,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2275, "epsg", 2275,
-        "NAD83 / Texas North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3");
-    add_proj4text (p, 1,
-        "4 +lon_0=-101.5 +x_0=200000.0001016002 +y_0=999999.99989");
-    add_proj4text (p, 2,
-        "83998 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Texas North (ftUS)\",GEOGCS[\"NAD83\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 8,
-        "onic_2SP\"],PARAMETER[\"standard_parallel_1\",36.1833333");
-    add_srs_wkt (p, 9,
-        "3333333],PARAMETER[\"standard_parallel_2\",34.65],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"latitude_of_origin\",34],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 11,
-        "ian\",-101.5],PARAMETER[\"false_easting\",656166.667],PA");
-    add_srs_wkt (p, 12,
-        "RAMETER[\"false_northing\",3280833.333],UNIT[\"US survey");
-    add_srs_wkt (p, 13,
-        " foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 15,
-        "2275\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2276, "epsg", 2276,
-        "NAD83 / Texas North Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=2000000.0001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 3,
-        "units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Texas North Central (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 8,
-        "formal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",33");
-    add_srs_wkt (p, 9,
-        ".96666666666667],PARAMETER[\"standard_parallel_2\",32.13");
-    add_srs_wkt (p, 10,
-        "333333333333],PARAMETER[\"latitude_of_origin\",31.666666");
-    add_srs_wkt (p, 11,
-        "66666667],PARAMETER[\"central_meridian\",-98.5],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"false_easting\",1968500],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",6561666.667],UNIT[\"US survey foot\",0.3048006096012192");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y");
-    add_srs_wkt (p, 15,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2276\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2277, "epsg", 2277,
-        "NAD83 / Texas Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +");
-    add_proj4text (p, 2,
-        "x_0=699999.9998983998 +y_0=3000000 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 3,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Texas Central (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",31.88333");
-    add_srs_wkt (p, 9,
-        "333333333],PARAMETER[\"standard_parallel_2\",30.11666666");
-    add_srs_wkt (p, 10,
-        "666667],PARAMETER[\"latitude_of_origin\",29.666666666666");
-    add_srs_wkt (p, 11,
-        "67],PARAMETER[\"central_meridian\",-100.3333333333333],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_easting\",2296583.333],PARAMETER[\"fals");
-    add_srs_wkt (p, 13,
-        "e_northing\",9842500.000000002],UNIT[\"US survey foot\",");
-    add_srs_wkt (p, 14,
-        "0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"");
-    add_srs_wkt (p, 15,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2277\"]");
-    add_srs_wkt (p, 16,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2278, "epsg", 2278,
-        "NAD83 / Texas South Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=3999999.9998984 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un");
-    add_proj4text (p, 3,
-        "its=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Texas South Central (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 8,
-        "formal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",30");
-    add_srs_wkt (p, 9,
-        ".28333333333333],PARAMETER[\"standard_parallel_2\",28.38");
-    add_srs_wkt (p, 10,
-        "333333333333],PARAMETER[\"latitude_of_origin\",27.833333");
-    add_srs_wkt (p, 11,
-        "33333333],PARAMETER[\"central_meridian\",-99],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_easting\",1968500],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 13,
-        "13123333.333],UNIT[\"US survey foot\",0.3048006096012192");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y");
-    add_srs_wkt (p, 15,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2278\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2279, "epsg", 2279,
-        "NAD83 / Texas South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000.00");
-    add_proj4text (p, 2,
-        "00000001 +y_0=5000000.0001016 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Texas South (ftUS)\",GEOGCS[\"NAD83\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 8,
-        "onic_2SP\"],PARAMETER[\"standard_parallel_1\",27.8333333");
-    add_srs_wkt (p, 9,
-        "3333333],PARAMETER[\"standard_parallel_2\",26.1666666666");
-    add_srs_wkt (p, 10,
-        "6667],PARAMETER[\"latitude_of_origin\",25.66666666666667");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"central_meridian\",-98.5],PARAMETER[\"fals");
-    add_srs_wkt (p, 12,
-        "e_easting\",984250.0000000002],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 13,
-        "g\",16404166.667],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 14,
-        "2192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS");
-    add_srs_wkt (p, 15,
-        "[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2279\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2280, "epsg", 2280,
-        "NAD83 / Utah North (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001504 +y_0=999999.9999960001 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Utah North (ft)\",GEOGCS[\"NAD83\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 8,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",41.7833333333");
-    add_srs_wkt (p, 9,
-        "3333],PARAMETER[\"standard_parallel_2\",40.7166666666666");
-    add_srs_wkt (p, 10,
-        "7],PARAMETER[\"latitude_of_origin\",40.33333333333334],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"central_meridian\",-111.5],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "easting\",1640419.948],PARAMETER[\"false_northing\",3280");
-    add_srs_wkt (p, 13,
-        "839.895],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"");
-    add_srs_wkt (p, 14,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 15,
-        ",\"2280\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2281, "epsg", 2281,
-        "NAD83 / Utah Central (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000.0001504 +y_0=");
-    add_proj4text (p, 2,
-        "1999999.999992 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 3,
-        "s=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Utah Central (ft)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWG");
-    add_srs_wkt (p, 3,
-        "S84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Co");
-    add_srs_wkt (p, 8,
-        "nic_2SP\"],PARAMETER[\"standard_parallel_1\",40.65],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_2\",39.01666666666667],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"latitude_of_origin\",38.33333333333334],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "central_meridian\",-111.5],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 12,
-        "640419.948],PARAMETER[\"false_northing\",6561679.79],UNI");
-    add_srs_wkt (p, 13,
-        "T[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X");
-    add_srs_wkt (p, 14,
-        "\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2281\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2282, "epsg", 2282,
-        "NAD83 / Utah South (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000.0001504 +y_0=");
-    add_proj4text (p, 2,
-        "2999999.999988 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 3,
-        "s=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Utah South (ft)\",GEOGCS[\"NAD83\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 8,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",38.35],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_2\",37.21666666666667],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"latitude_of_origin\",36.66666666666666],PARAMETER[\"c");
-    add_srs_wkt (p, 11,
-        "entral_meridian\",-111.5],PARAMETER[\"false_easting\",16");
-    add_srs_wkt (p, 12,
-        "40419.948],PARAMETER[\"false_northing\",9842519.685],UNI");
-    add_srs_wkt (p, 13,
-        "T[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X");
-    add_srs_wkt (p, 14,
-        "\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2282\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2283, "epsg", 2283,
-        "NAD83 / Virginia North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-78.5 +x_0=3500000.0001016 +y_0=2");
-    add_proj4text (p, 2,
-        "000000.0001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 3,
-        "s=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Virginia North (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",39.2],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_2\",38.03333333333333],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"latitude_of_origin\",37.66666666666666],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"central_meridian\",-78.5],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 12,
-        ",11482916.667],PARAMETER[\"false_northing\",6561666.667]");
-    add_srs_wkt (p, 13,
-        ",UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 15,
-        "HORITY[\"EPSG\",\"2283\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2284, "epsg", 2284,
-        "NAD83 / Virginia South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000.0");
-    add_proj4text (p, 2,
-        "001016 +y_0=999999.9998983998 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Virginia South (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",37.96666");
-    add_srs_wkt (p, 9,
-        "666666667],PARAMETER[\"standard_parallel_2\",36.76666666");
-    add_srs_wkt (p, 10,
-        "666667],PARAMETER[\"latitude_of_origin\",36.333333333333");
-    add_srs_wkt (p, 11,
-        "34],PARAMETER[\"central_meridian\",-78.5],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_easting\",11482916.667],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",3280833.333],UNIT[\"US survey foot\",0.3048006096012192");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y");
-    add_srs_wkt (p, 15,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2284\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2285, "epsg", 2285,
-        "NAD83 / Washington North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47");
-    add_proj4text (p, 1,
-        " +lon_0=-120.8333333333333 +x_0=500000.0001016001 +y_0=0");
-    add_proj4text (p, 2,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de");
-    add_proj4text (p, 3,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Washington North (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confor");
-    add_srs_wkt (p, 8,
-        "mal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",48.73");
-    add_srs_wkt (p, 9,
-        "333333333333],PARAMETER[\"standard_parallel_2\",47.5],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"latitude_of_origin\",47],PARAMETER[\"central_m");
-    add_srs_wkt (p, 11,
-        "eridian\",-120.8333333333333],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 12,
-        ",1640416.667],PARAMETER[\"false_northing\",0],UNIT[\"US ");
-    add_srs_wkt (p, 13,
-        "survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 14,
-        "03\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EP");
-    add_srs_wkt (p, 15,
-        "SG\",\"2285\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2286, "epsg", 2286,
-        "NAD83 / Washington South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un");
-    add_proj4text (p, 3,
-        "its=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Washington South (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confor");
-    add_srs_wkt (p, 8,
-        "mal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",47.33");
-    add_srs_wkt (p, 9,
-        "333333333334],PARAMETER[\"standard_parallel_2\",45.83333");
-    add_srs_wkt (p, 10,
-        "333333334],PARAMETER[\"latitude_of_origin\",45.333333333");
-    add_srs_wkt (p, 11,
-        "33334],PARAMETER[\"central_meridian\",-120.5],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_easting\",1640416.667],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 13,
-        "g\",0],UNIT[\"US survey foot\",0.3048006096012192,AUTHOR");
-    add_srs_wkt (p, 14,
-        "ITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORT");
-    add_srs_wkt (p, 15,
-        "H],AUTHORITY[\"EPSG\",\"2286\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2287, "epsg", 2287,
-        "NAD83 / Wisconsin North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Wisconsin North (ftUS)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 8,
-        "l_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",46.7666");
-    add_srs_wkt (p, 9,
-        "6666666667],PARAMETER[\"standard_parallel_2\",45.5666666");
-    add_srs_wkt (p, 10,
-        "6666667],PARAMETER[\"latitude_of_origin\",45.16666666666");
-    add_srs_wkt (p, 11,
-        "666],PARAMETER[\"central_meridian\",-90],PARAMETER[\"fal");
-    add_srs_wkt (p, 12,
-        "se_easting\",1968500],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 13,
-        "IT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHOR");
-    add_srs_wkt (p, 15,
-        "ITY[\"EPSG\",\"2287\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2288, "epsg", 2288,
-        "NAD83 / Wisconsin Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333");
-    add_proj4text (p, 1,
-        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Wisconsin Central (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",45.5");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_2\",44.25],PARAMETER[\"l");
-    add_srs_wkt (p, 10,
-        "atitude_of_origin\",43.83333333333334],PARAMETER[\"centr");
-    add_srs_wkt (p, 11,
-        "al_meridian\",-90],PARAMETER[\"false_easting\",1968500],");
-    add_srs_wkt (p, 12,
-        "PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",");
-    add_srs_wkt (p, 13,
-        "0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2288\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2289, "epsg", 2289,
-        "NAD83 / Wisconsin South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Wisconsin South (ftUS)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 8,
-        "l_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",44.0666");
-    add_srs_wkt (p, 9,
-        "6666666667],PARAMETER[\"standard_parallel_2\",42.7333333");
-    add_srs_wkt (p, 10,
-        "3333333],PARAMETER[\"latitude_of_origin\",42],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"central_meridian\",-90],PARAMETER[\"false_easting\",19");
-    add_srs_wkt (p, 12,
-        "68500],PARAMETER[\"false_northing\",0],UNIT[\"US survey ");
-    add_srs_wkt (p, 13,
-        "foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 15,
-        "2289\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2290, "epsg", 2290,
-        "ATS77 / Prince Edward Isl. Stereographic (ATS77)", 0, 0,
-        "Average Terrestrial System 1977", "Greenwich",
-        "Average_Terrestrial_System_1977", "Oblique_Stereographic", "metre",
-        "E(X)", "East", "N(Y)", "North");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=47.25 +lon_0=-63 +k=0.999912 +x_0=70");
-    add_proj4text (p, 1,
-        "0000 +y_0=400000 +a=6378135 +b=6356750.304921594 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ATS77 / Prince Edward Isl. Stereographic (ATS77");
-    add_srs_wkt (p, 1,
-        ")\",GEOGCS[\"ATS77\",DATUM[\"Average_Terrestrial_System_");
-    add_srs_wkt (p, 2,
-        "1977\",SPHEROID[\"Average Terrestrial System 1977\",6378");
-    add_srs_wkt (p, 3,
-        "135,298.257,AUTHORITY[\"EPSG\",\"7041\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"6122\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4122\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Oblique_Stereographic\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 9,
-        "n\",47.25],PARAMETER[\"central_meridian\",-63],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"scale_factor\",0.999912],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "700000],PARAMETER[\"false_northing\",400000],UNIT[\"metr");
-    add_srs_wkt (p, 12,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E(X)\",EAST],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"N(Y)\",NORTH],AUTHORITY[\"EPSG\",\"2290\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2291, "epsg", 2291,
-        "NAD83(CSRS98) / Prince Edward Isl. Stereographic (NAD83) (deprecated)", 0, 0,
-        "Average Terrestrial System 1977", "Greenwich",
-        "Average_Terrestrial_System_1977", "Oblique_Stereographic", "metre",
-        "E(X)", "East", "N(Y)", "North");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=47.25 +lon_0=-63 +k=0.999912 +x_0=40");
-    add_proj4text (p, 1,
-        "0000 +y_0=800000 +a=6378135 +b=6356750.304921594 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS98) / Prince Edward Isl. Stereographi");
-    add_srs_wkt (p, 1,
-        "c (NAD83) (deprecated)\",GEOGCS[\"ATS77\",DATUM[\"Averag");
-    add_srs_wkt (p, 2,
-        "e_Terrestrial_System_1977\",SPHEROID[\"Average Terrestri");
-    add_srs_wkt (p, 3,
-        "al System 1977\",6378135,298.257,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 4,
-        "41\"]],AUTHORITY[\"EPSG\",\"6122\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4122\"]],PROJECTION[\"Oblique_Stereographic\"],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"latitude_of_origin\",47.25],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 10,
-        "ian\",-63],PARAMETER[\"scale_factor\",0.999912],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_easting\",400000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",800000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"E(X)\",EAST],AXIS[\"N(Y)\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"2291\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2292, "epsg", 2292,
-        "NAD83(CSRS98) / Prince Edward Isl. Stereographic (NAD83) (deprecated)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Oblique_Stereographic", "metre",
-        "E(X)", "East", "N(Y)", "North");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=47.25 +lon_0=-63 +k=0.999912 +x_0=40");
-    add_proj4text (p, 1,
-        "0000 +y_0=800000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS98) / Prince Edward Isl. Stereographi");
-    add_srs_wkt (p, 1,
-        "c (NAD83) (deprecated)\",GEOGCS[\"NAD83(CSRS98)\",DATUM[");
-    add_srs_wkt (p, 2,
-        "\"NAD83_Canadian_Spatial_Reference_System\",SPHEROID[\"G");
-    add_srs_wkt (p, 3,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 4,
-        "9\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6140\"");
-    add_srs_wkt (p, 5,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 6,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "9108\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 8,
-        "T],AUTHORITY[\"EPSG\",\"4140\"]],PROJECTION[\"Oblique_St");
-    add_srs_wkt (p, 9,
-        "ereographic\"],PARAMETER[\"latitude_of_origin\",47.25],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"central_meridian\",-63],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 11,
-        "tor\",0.999912],PARAMETER[\"false_easting\",400000],PARA");
-    add_srs_wkt (p, 12,
-        "METER[\"false_northing\",800000],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"E(X)\",EAST],AXIS[\"N(Y)\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2292\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2294, "epsg", 2294,
-        "ATS77 / MTM Nova Scotia zone 4", 0, 0,
-        "Average Terrestrial System 1977", "Greenwich",
-        "Average_Terrestrial_System_1977", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-61.5 +k=0.9999 +x_0=4500000");
-    add_proj4text (p, 1,
-        " +y_0=0 +a=6378135 +b=6356750.304921594 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ATS77 / MTM Nova Scotia zone 4\",GEOGCS[\"ATS77");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Average_Terrestrial_System_1977\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Average Terrestrial System 1977\",6378135,298.257,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7041\"]],AUTHORITY[\"EPSG\",\"6122\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"4122\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 8,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 9,
-        "entral_meridian\",-61.5],PARAMETER[\"scale_factor\",0.99");
-    add_srs_wkt (p, 10,
-        "99],PARAMETER[\"false_easting\",4500000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"2294\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2295, "epsg", 2295,
-        "ATS77 / MTM Nova Scotia zone 5", 0, 0,
-        "Average Terrestrial System 1977", "Greenwich",
-        "Average_Terrestrial_System_1977", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-64.5 +k=0.9999 +x_0=5500000");
-    add_proj4text (p, 1,
-        " +y_0=0 +a=6378135 +b=6356750.304921594 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ATS77 / MTM Nova Scotia zone 5\",GEOGCS[\"ATS77");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Average_Terrestrial_System_1977\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Average Terrestrial System 1977\",6378135,298.257,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7041\"]],AUTHORITY[\"EPSG\",\"6122\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"4122\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 8,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 9,
-        "entral_meridian\",-64.5],PARAMETER[\"scale_factor\",0.99");
-    add_srs_wkt (p, 10,
-        "99],PARAMETER[\"false_easting\",5500000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"2295\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2308, "epsg", 2308,
-        "Batavia / TM 109 SE", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Batavia", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=109 +k=0.9996 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=10000000 +ellps=bessel +towgs84=-377,681,-50,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Batavia / TM 109 SE\",GEOGCS[\"Batavia\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"Batavia\",SPHEROID[\"Bessel 1841\",6377397.155,299.152");
-    add_srs_wkt (p, 2,
-        "8128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[-377,681,-50,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0],AUTHORITY[\"EPSG\",\"6211\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati");
-    add_srs_wkt (p, 6,
-        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4211\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",109],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 11,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"2308\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2309, "epsg", 2309,
-        "WGS 84 / TM 116 SE", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=116 +k=0.9996 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=10000000 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / TM 116 SE\",GEOGCS[\"WGS 84\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"central_meridian\",116],PARAMETER[\"scale_factor\",0.");
-    add_srs_wkt (p, 9,
-        "9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2309\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2310, "epsg", 2310,
-        "WGS 84 / TM 132 SE", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=132 +k=0.9996 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=10000000 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / TM 132 SE\",GEOGCS[\"WGS 84\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"central_meridian\",132],PARAMETER[\"scale_factor\",0.");
-    add_srs_wkt (p, 9,
-        "9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2310\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2311, "epsg", 2311,
-        "WGS 84 / TM 6 NE", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=6 +k=0.9996 +x_0=500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / TM 6 NE\",GEOGCS[\"WGS 84\",DATUM[\"WG");
-    add_srs_wkt (p, 1,
-        "S_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHO");
-    add_srs_wkt (p, 2,
-        "RITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"]],P");
-    add_srs_wkt (p, 3,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 4,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 5,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 6,
-        "UTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Transverse_Mer");
-    add_srs_wkt (p, 7,
-        "cator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",6],PARAMETER[\"scale_factor\",0.9996]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2311\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2312, "epsg", 2312,
-        "Garoua / UTM zone 33N", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Garoua", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Garoua / UTM zone 33N\",GEOGCS[\"Garoua\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Garoua\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,2");
-    add_srs_wkt (p, 2,
-        "93.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"6197\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 4,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 6,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4197\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"central_meridian\",15],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2312\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2313, "epsg", 2313,
-        "Kousseri / UTM zone 33N", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Kousseri", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Kousseri / UTM zone 33N\",GEOGCS[\"Kousseri\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Kousseri\",SPHEROID[\"Clarke 1880 (RGS)\",6378249");
-    add_srs_wkt (p, 2,
-        ".145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6198\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4198\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",0],PARAMETER[\"central_meridian\",15],PARAMETER[\"sc");
-    add_srs_wkt (p, 9,
-        "ale_factor\",0.9996],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 11,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 12,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2313\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2314, "epsg", 2314,
-        "Trinidad 1903 / Trinidad Grid (ftCla)", 0, 0,
-        "Clarke 1858", "Greenwich",
-        "Trinidad_1903", "Cassini_Soldner", "Clarke's foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=10.44166666666667 +lon_0=-61.333333333");
-    add_proj4text (p, 1,
-        "33334 +x_0=86501.46392052001 +y_0=65379.0134283 +a=63782");
-    add_proj4text (p, 2,
-        "93.645208759 +b=6356617.987679838 +towgs84=-61.702,284.4");
-    add_proj4text (p, 3,
-        "88,472.052,0,0,0,0 +to_meter=0.3047972654 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Trinidad 1903 / Trinidad Grid (ftCla)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Trinidad 1903\",DATUM[\"Trinidad_1903\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1858\",6378293.645208759,294.2606763692606,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7007\"]],TOWGS84[-61.702,284.488,472.052,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0],AUTHORITY[\"EPSG\",\"6302\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4302\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",10.44166666666667],PARAMETER[\"central");
-    add_srs_wkt (p, 10,
-        "_meridian\",-61.33333333333334],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",283800],PARAMETER[\"false_northing\",214500],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "Clarke's foot\",0.3047972654,AUTHORITY[\"EPSG\",\"9005\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"2314\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2315, "epsg", 2315,
-        "Campo Inchauspe / UTM zone 19S", 0, 0,
-        "International 1924", "Greenwich",
-        "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +south +ellps=intl +towgs84=-148,136,");
-    add_proj4text (p, 1,
-        "90,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / UTM zone 19S\",GEOGCS[\"Campo");
-    add_srs_wkt (p, 1,
-        " Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 2,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[-148,136,90,0,0,0,0],AUTHORITY[\"EPSG\",\"6221\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4221\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"central_meridian\",-69],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 10,
-        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2315\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2316, "epsg", 2316,
-        "Campo Inchauspe / UTM zone 20S", 0, 0,
-        "International 1924", "Greenwich",
-        "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +south +ellps=intl +towgs84=-148,136,");
-    add_proj4text (p, 1,
-        "90,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / UTM zone 20S\",GEOGCS[\"Campo");
-    add_srs_wkt (p, 1,
-        " Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 2,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[-148,136,90,0,0,0,0],AUTHORITY[\"EPSG\",\"6221\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4221\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"central_meridian\",-63],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 10,
-        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2316\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2317, "epsg", 2317,
-        "PSAD56 / ICN Regional", 0, 0,
-        "International 1924", "Greenwich",
-        "Provisional_South_American_Datum_1956", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=9 +lat_2=3 +lat_0=6 +lon_0=-66 +x_0=100");
-    add_proj4text (p, 1,
-        "0000 +y_0=1000000 +ellps=intl +towgs84=-288,175,-376,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"PSAD56 / ICN Regional\",GEOGCS[\"PSAD56\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Provisional_South_American_Datum_1956\",SPHEROID[\"In");
-    add_srs_wkt (p, 2,
-        "ternational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022");
-    add_srs_wkt (p, 3,
-        "\"]],TOWGS84[-288,175,-376,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6248\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4248\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 8,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",9],PARAMETER[\"standard_parallel_2\",3],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "latitude_of_origin\",6],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 11,
-        "66],PARAMETER[\"false_easting\",1000000],PARAMETER[\"fal");
-    add_srs_wkt (p, 12,
-        "se_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 14,
-        "TY[\"EPSG\",\"2317\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2318, "epsg", 2318,
-        "Ain el Abd / Aramco Lambert", 0, 0,
-        "International 1924", "Greenwich",
-        "Ain_el_Abd_1970", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=17 +lat_2=33 +lat_0=25.08951 +lon_0=48 ");
-    add_proj4text (p, 1,
-        "+x_0=0 +y_0=0 +ellps=intl +towgs84=-143,-236,7,0,0,0,0 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Ain el Abd / Aramco Lambert\",GEOGCS[\"Ain el A");
-    add_srs_wkt (p, 1,
-        "bd\",DATUM[\"Ain_el_Abd_1970\",SPHEROID[\"International ");
-    add_srs_wkt (p, 2,
-        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[-143,-236,7,0,0,0,0],AUTHORITY[\"EPSG\",\"6204\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4204\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",17],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_2\",33],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 10,
-        "f_origin\",25.08951],PARAMETER[\"central_meridian\",48],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 14,
-        "\"EPSG\",\"2318\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2319, "epsg", 2319,
-        "ED50 / TM27", 0, 1,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM27\",GEOGCS[\"ED50\",DATUM[\"European_");
-    add_srs_wkt (p, 1,
-        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-121,0,0,");
-    add_srs_wkt (p, 3,
-        "0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",2");
-    add_srs_wkt (p, 9,
-        "7],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2319\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2320, "epsg", 2320,
-        "ED50 / TM30", 0, 1,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM30\",GEOGCS[\"ED50\",DATUM[\"European_");
-    add_srs_wkt (p, 1,
-        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-121,0,0,");
-    add_srs_wkt (p, 3,
-        "0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",3");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2320\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2321, "epsg", 2321,
-        "ED50 / TM33", 0, 1,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM33\",GEOGCS[\"ED50\",DATUM[\"European_");
-    add_srs_wkt (p, 1,
-        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-121,0,0,");
-    add_srs_wkt (p, 3,
-        "0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",3");
-    add_srs_wkt (p, 9,
-        "3],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2321\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2322, "epsg", 2322,
-        "ED50 / TM36", 0, 1,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM36\",GEOGCS[\"ED50\",DATUM[\"European_");
-    add_srs_wkt (p, 1,
-        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-121,0,0,");
-    add_srs_wkt (p, 3,
-        "0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",3");
-    add_srs_wkt (p, 9,
-        "6],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2322\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2323, "epsg", 2323,
-        "ED50 / TM39", 0, 1,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM39\",GEOGCS[\"ED50\",DATUM[\"European_");
-    add_srs_wkt (p, 1,
-        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-121,0,0,");
-    add_srs_wkt (p, 3,
-        "0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",3");
-    add_srs_wkt (p, 9,
-        "9],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2323\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2324, "epsg", 2324,
-        "ED50 / TM42", 0, 1,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM42\",GEOGCS[\"ED50\",DATUM[\"European_");
-    add_srs_wkt (p, 1,
-        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-121,0,0,");
-    add_srs_wkt (p, 3,
-        "0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",4");
-    add_srs_wkt (p, 9,
-        "2],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2324\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
@@ -1,4001 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_05 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 2527, "epsg", 2527,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 11", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=11500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 11\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",33],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "11500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2527\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2528, "epsg", 2528,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 12", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=12500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 12\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",36],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "12500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2528\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2529, "epsg", 2529,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 13", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=13500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 13\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",39],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "13500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2529\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2530, "epsg", 2530,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 14", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=14500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 14\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",42],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "14500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2530\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2531, "epsg", 2531,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 15", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=15500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 15\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",45],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "15500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2531\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2532, "epsg", 2532,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 16", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=48 +k=1 +x_0=16500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 16\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",48],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "16500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2532\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2533, "epsg", 2533,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 17", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=51 +k=1 +x_0=17500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 17\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",51],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "17500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2533\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2534, "epsg", 2534,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 18", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=54 +k=1 +x_0=18500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 18\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",54],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "18500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2534\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2535, "epsg", 2535,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 19", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=57 +k=1 +x_0=19500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 19\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",57],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "19500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2535\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2536, "epsg", 2536,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 20", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=60 +k=1 +x_0=20500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 20\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",60],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "20500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2536\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2537, "epsg", 2537,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 21", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=63 +k=1 +x_0=21500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 21\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",63],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "21500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2537\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2538, "epsg", 2538,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 22", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=66 +k=1 +x_0=22500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 22\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",66],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "22500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2538\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2539, "epsg", 2539,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 23", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=69 +k=1 +x_0=23500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 23\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",69],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "23500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2539\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2540, "epsg", 2540,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 24", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=72 +k=1 +x_0=24500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 24\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",72],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "24500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2540\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2541, "epsg", 2541,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 25", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=25500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 25\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",75],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "25500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2541\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2542, "epsg", 2542,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 26", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=26500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 26\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",78],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "26500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2542\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2543, "epsg", 2543,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 27", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=27500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 27\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",81],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "27500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2543\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2544, "epsg", 2544,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 28", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=28500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 28\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",84],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "28500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2544\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2545, "epsg", 2545,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 29", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=29500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 29\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",87],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "29500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2545\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2546, "epsg", 2546,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 30", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=30500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 30\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",90],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "30500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2546\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2547, "epsg", 2547,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 31", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=31500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 31\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",93],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "31500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2547\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2548, "epsg", 2548,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 32", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=32500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 32\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",96],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "32500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2548\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2549, "epsg", 2549,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 33", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=33500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 33\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",99],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "33500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2549\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2550, "epsg", 2550,
-        "Samboja / UTM zone 50S (deprecated)", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Samboja", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=50 +south +ellps=bessel +towgs84=-404.78");
-    add_proj4text (p, 1,
-        ",685.68,45.47,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Samboja / UTM zone 50S (deprecated)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Samboja\",DATUM[\"Samboja\",SPHEROID[\"Bessel 1841\",637");
-    add_srs_wkt (p, 2,
-        "7397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS");
-    add_srs_wkt (p, 3,
-        "84[-404.78,685.68,45.47,0,0,0,0],AUTHORITY[\"EPSG\",\"61");
-    add_srs_wkt (p, 4,
-        "25\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9108\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4125\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",117],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 10,
-        "\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 13,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"2550\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2551, "epsg", 2551,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 34", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=34500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 34\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",102],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",34500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2551\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2552, "epsg", 2552,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 35", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=35500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 35\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",105],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",35500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2552\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2553, "epsg", 2553,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 36", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=36500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 36\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",108],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",36500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2553\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2554, "epsg", 2554,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 37", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=37500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 37\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",111],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",37500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2554\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2555, "epsg", 2555,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 38", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=38500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 38\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",114],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",38500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2555\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2556, "epsg", 2556,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 39", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=39500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 39\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",117],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",39500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2556\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2557, "epsg", 2557,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 40", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=40500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 40\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",120],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",40500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2557\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2558, "epsg", 2558,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 41", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=41500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 41\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",123],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",41500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2558\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2559, "epsg", 2559,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 42", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=42500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 42\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",126],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",42500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2559\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2560, "epsg", 2560,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 43", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=43500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 43\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",129],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",43500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2560\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2561, "epsg", 2561,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 44", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=44500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 44\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",132],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",44500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2561\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2562, "epsg", 2562,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 45", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=45500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 45\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",135],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",45500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2562\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2563, "epsg", 2563,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 46", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=138 +k=1 +x_0=46500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 46\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",138],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",46500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2563\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2564, "epsg", 2564,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 47", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=141 +k=1 +x_0=47500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 47\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",141],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",47500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2564\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2565, "epsg", 2565,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 48", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=144 +k=1 +x_0=48500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 48\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",144],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",48500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2565\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2566, "epsg", 2566,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 49", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=147 +k=1 +x_0=49500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 49\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",147],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",49500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2566\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2567, "epsg", 2567,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 50", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=150 +k=1 +x_0=50500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 50\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",150],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",50500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2567\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2568, "epsg", 2568,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 51", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=153 +k=1 +x_0=51500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 51\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",153],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",51500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2568\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2569, "epsg", 2569,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 52", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=156 +k=1 +x_0=52500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 52\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",156],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",52500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2569\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2570, "epsg", 2570,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 53", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=159 +k=1 +x_0=53500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 53\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",159],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",53500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2570\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2571, "epsg", 2571,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 54", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=162 +k=1 +x_0=54500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 54\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",162],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",54500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2571\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2572, "epsg", 2572,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 55", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=165 +k=1 +x_0=55500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 55\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",165],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",55500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2572\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2573, "epsg", 2573,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 56", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=168 +k=1 +x_0=56500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 56\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",168],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",56500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2573\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2574, "epsg", 2574,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 57", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=171 +k=1 +x_0=57500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 57\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",171],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",57500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2574\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2575, "epsg", 2575,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 58", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=174 +k=1 +x_0=58500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 58\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",174],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",58500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2575\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2576, "epsg", 2576,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 59", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=177 +k=1 +x_0=59500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 59\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",177],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",59500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2576\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2577, "epsg", 2577,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 60 (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=180 +k=1 +x_0=60000000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 60 (d");
-    add_srs_wkt (p, 1,
-        "eprecated)\",GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_194");
-    add_srs_wkt (p, 2,
-        "2\",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,");
-    add_srs_wkt (p, 4,
-        "0.82,-0.12],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 5,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 6,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 8,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 10,
-        "dian\",180],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",60000000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2577\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2578, "epsg", 2578,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 61", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-177 +k=1 +x_0=61500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82");
-    add_proj4text (p, 2,
-        ",-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 61\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-177],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",61500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2578\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2579, "epsg", 2579,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 62", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-174 +k=1 +x_0=62500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82");
-    add_proj4text (p, 2,
-        ",-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 62\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-174],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",62500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2579\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2580, "epsg", 2580,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 63", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-171 +k=1 +x_0=63500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82");
-    add_proj4text (p, 2,
-        ",-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 63\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-171],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",63500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2580\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2581, "epsg", 2581,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger zone 64", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-168 +k=1 +x_0=64500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82");
-    add_proj4text (p, 2,
-        ",-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 64\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-168],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",64500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2581\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2582, "epsg", 2582,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 21E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 21E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",21],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2582\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2583, "epsg", 2583,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 24E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 24E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",24],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2583\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2584, "epsg", 2584,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 27E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 27E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",27],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2584\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2585, "epsg", 2585,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 30E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 30E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",30],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2585\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2586, "epsg", 2586,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 33E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 33E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",33],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2586\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2587, "epsg", 2587,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 36E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 36E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",36],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2587\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2588, "epsg", 2588,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 39E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 39E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",39],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2588\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2589, "epsg", 2589,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 42E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 42E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",42],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2589\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2590, "epsg", 2590,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 45E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 45E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",45],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2590\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2591, "epsg", 2591,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 48E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=48 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 48E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",48],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2591\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2592, "epsg", 2592,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 51E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=51 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 51E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",51],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2592\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2593, "epsg", 2593,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 54E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=54 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 54E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",54],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2593\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2594, "epsg", 2594,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 57E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=57 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 57E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",57],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2594\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2595, "epsg", 2595,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 60E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=60 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 60E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",60],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2595\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2596, "epsg", 2596,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 63E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=63 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 63E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",63],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2596\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2597, "epsg", 2597,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 66E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=66 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 66E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",66],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2597\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2598, "epsg", 2598,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 69E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=69 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 69E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",69],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2598\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2599, "epsg", 2599,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 72E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=72 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 72E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",72],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2599\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2600, "epsg", 2600,
-        "Lietuvos Koordinoei Sistema 1994 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Lithuania_1994_ETRS89", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9998 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Lietuvos Koordinoei Sistema 1994 (deprecated)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"LKS94\",DATUM[\"Lithuania_1994_ETRS89\",SPHERO");
-    add_srs_wkt (p, 2,
-        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6126\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4669\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",24],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",0.9998],PARAMETER[\"false_easting\",500000],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"2600\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2601, "epsg", 2601,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 75E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 75E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",75],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2601\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2602, "epsg", 2602,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 78E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 78E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",78],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2602\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2603, "epsg", 2603,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 81E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 81E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",81],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2603\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2604, "epsg", 2604,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 84E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 84E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",84],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2604\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2605, "epsg", 2605,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 87E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 87E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",87],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2605\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2606, "epsg", 2606,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 90E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 90E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",90],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2606\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2607, "epsg", 2607,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 93E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 93E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",93],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2607\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2608, "epsg", 2608,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 96E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 96E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",96],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2608\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2609, "epsg", 2609,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 99E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 99E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",99],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2609\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2610, "epsg", 2610,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 102E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 102E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",102],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2610\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2611, "epsg", 2611,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 105E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 105E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",105],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2611\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2612, "epsg", 2612,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 108E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 108E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",108],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2612\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2613, "epsg", 2613,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 111E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 111E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",111],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2613\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2614, "epsg", 2614,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 114E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 114E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",114],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2614\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2615, "epsg", 2615,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 117E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 117E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",117],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2615\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2616, "epsg", 2616,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 120E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 120E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",120],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2616\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2617, "epsg", 2617,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 123E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 123E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",123],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2617\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2618, "epsg", 2618,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 126E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 126E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",126],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2618\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2619, "epsg", 2619,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 129E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 129E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",129],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2619\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2620, "epsg", 2620,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 132E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 132E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",132],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2620\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2621, "epsg", 2621,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 135E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 135E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",135],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2621\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2622, "epsg", 2622,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 138E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=138 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 138E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",138],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2622\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2623, "epsg", 2623,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 141E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=141 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 141E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",141],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2623\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2624, "epsg", 2624,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 144E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=144 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 144E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",144],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2624\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2625, "epsg", 2625,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 147E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=147 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 147E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",147],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2625\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2626, "epsg", 2626,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 150E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=150 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 150E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",150],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2626\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2627, "epsg", 2627,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 153E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=153 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 153E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",153],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2627\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
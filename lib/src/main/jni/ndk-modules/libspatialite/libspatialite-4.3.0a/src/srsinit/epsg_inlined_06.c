@@ -1,4003 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_06 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 2628, "epsg", 2628,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 156E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=156 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 156E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",156],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2628\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2629, "epsg", 2629,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 159E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=159 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 159E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",159],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2629\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2630, "epsg", 2630,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 162E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=162 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 162E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",162],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2630\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2631, "epsg", 2631,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 165E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=165 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 165E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",165],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2631\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2632, "epsg", 2632,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 168E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=168 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 168E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",168],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2632\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2633, "epsg", 2633,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 171E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=171 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 171E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",171],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2633\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2634, "epsg", 2634,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 174E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=174 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 174E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",174],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2634\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2635, "epsg", 2635,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 177E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=177 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 177E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",177],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2635\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2636, "epsg", 2636,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 180E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=180 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 180E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",180],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2636\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2637, "epsg", 2637,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 177W", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-177 +k=1 +x_0=500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 177W\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-177],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2637\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2638, "epsg", 2638,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 174W", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-174 +k=1 +x_0=500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 174W\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-174],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2638\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2639, "epsg", 2639,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 171W", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-171 +k=1 +x_0=500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 171W\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-171],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2639\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2640, "epsg", 2640,
-        "Pulkovo 1942 / 3-degree Gauss-Kruger CM 168W", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-168 +k=1 +x_0=500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 168W\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[23.92,-141.27,-80.9,0,0.35,0.82,-0.12],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4284\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-168],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2640\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2641, "epsg", 2641,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 7", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=7500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 7\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",21],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",7500");
-    add_srs_wkt (p, 11,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2641\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2642, "epsg", 2642,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 8", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=8500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 8\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",24],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",8500");
-    add_srs_wkt (p, 11,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2642\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2643, "epsg", 2643,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 9", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=9500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 9\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",27],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",9500");
-    add_srs_wkt (p, 11,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"2643\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2644, "epsg", 2644,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 10", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=10500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 10\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",30],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",10");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2644\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2645, "epsg", 2645,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 11", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=11500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 11\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",33],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",11");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2645\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2646, "epsg", 2646,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 12", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=12500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 12\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",36],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",12");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2646\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2647, "epsg", 2647,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 13", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=13500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 13\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",39],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",13");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2647\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2648, "epsg", 2648,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 14", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=14500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 14\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",42],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",14");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2648\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2649, "epsg", 2649,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 15", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=15500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 15\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",45],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2649\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2650, "epsg", 2650,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 16", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=48 +k=1 +x_0=16500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 16\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",48],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",16");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2650\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2651, "epsg", 2651,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 17", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=51 +k=1 +x_0=17500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 17\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",51],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",17");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2651\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2652, "epsg", 2652,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 18", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=54 +k=1 +x_0=18500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 18\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",54],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",18");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2652\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2653, "epsg", 2653,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 19", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=57 +k=1 +x_0=19500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 19\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",57],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",19");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2653\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2654, "epsg", 2654,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 20", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=60 +k=1 +x_0=20500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 20\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",60],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",20");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2654\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2655, "epsg", 2655,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 21", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=63 +k=1 +x_0=21500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 21\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",63],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",21");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2655\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2656, "epsg", 2656,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 22", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=66 +k=1 +x_0=22500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 22\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",66],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",22");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2656\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2657, "epsg", 2657,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 23", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=69 +k=1 +x_0=23500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 23\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",69],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",23");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2657\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2658, "epsg", 2658,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 24", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=72 +k=1 +x_0=24500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 24\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",72],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",24");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2658\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2659, "epsg", 2659,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 25", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=25500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 25\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",75],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",25");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2659\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2660, "epsg", 2660,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 26", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=26500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 26\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",78],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",26");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2660\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2661, "epsg", 2661,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 27", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=27500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 27\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",81],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",27");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2661\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2662, "epsg", 2662,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 28", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=28500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 28\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",84],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",28");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2662\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2663, "epsg", 2663,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 29", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=29500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 29\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",87],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",29");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2663\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2664, "epsg", 2664,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 30", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=30500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 30\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",90],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",30");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2664\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2665, "epsg", 2665,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 31", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=31500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 31\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",93],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",31");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2665\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2666, "epsg", 2666,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 32", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=32500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 32\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",96],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",32");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2666\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2667, "epsg", 2667,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 33", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=33500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 33\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",99],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",33");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2667\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2668, "epsg", 2668,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 34", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=34500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 34\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",102],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",3");
-    add_srs_wkt (p, 11,
-        "4500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2668\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2669, "epsg", 2669,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 35", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=35500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 35\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",105],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",3");
-    add_srs_wkt (p, 11,
-        "5500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2669\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2670, "epsg", 2670,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 36", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=36500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 36\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",108],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",3");
-    add_srs_wkt (p, 11,
-        "6500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2670\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2671, "epsg", 2671,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 37", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=37500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 37\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",111],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",3");
-    add_srs_wkt (p, 11,
-        "7500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2671\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2672, "epsg", 2672,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 38", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=38500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 38\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",114],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",3");
-    add_srs_wkt (p, 11,
-        "8500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2672\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2673, "epsg", 2673,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 39", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=39500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 39\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",117],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",3");
-    add_srs_wkt (p, 11,
-        "9500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2673\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2674, "epsg", 2674,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 40", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=40500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 40\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",120],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",4");
-    add_srs_wkt (p, 11,
-        "0500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2674\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2675, "epsg", 2675,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 41", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=41500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 41\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",123],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",4");
-    add_srs_wkt (p, 11,
-        "1500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2675\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2676, "epsg", 2676,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 42", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=42500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 42\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",126],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",4");
-    add_srs_wkt (p, 11,
-        "2500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2676\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2677, "epsg", 2677,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 43", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=43500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 43\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",129],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",4");
-    add_srs_wkt (p, 11,
-        "3500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2677\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2678, "epsg", 2678,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 44", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=44500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 44\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",132],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",4");
-    add_srs_wkt (p, 11,
-        "4500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2678\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2679, "epsg", 2679,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 45", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=45500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 45\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",135],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",4");
-    add_srs_wkt (p, 11,
-        "5500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2679\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2680, "epsg", 2680,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 46", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=138 +k=1 +x_0=46500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 46\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",138],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",4");
-    add_srs_wkt (p, 11,
-        "6500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2680\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2681, "epsg", 2681,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 47", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=141 +k=1 +x_0=47500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 47\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",141],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",4");
-    add_srs_wkt (p, 11,
-        "7500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2681\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2682, "epsg", 2682,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 48", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=144 +k=1 +x_0=48500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 48\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",144],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",4");
-    add_srs_wkt (p, 11,
-        "8500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2682\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2683, "epsg", 2683,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 49", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=147 +k=1 +x_0=49500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 49\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",147],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",4");
-    add_srs_wkt (p, 11,
-        "9500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2683\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2684, "epsg", 2684,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 50", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=150 +k=1 +x_0=50500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 50\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",150],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "0500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2684\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2685, "epsg", 2685,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 51", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=153 +k=1 +x_0=51500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 51\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",153],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "1500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2685\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2686, "epsg", 2686,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 52", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=156 +k=1 +x_0=52500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 52\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",156],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "2500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2686\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2687, "epsg", 2687,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 53", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=159 +k=1 +x_0=53500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 53\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",159],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "3500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2687\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2688, "epsg", 2688,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 54", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=162 +k=1 +x_0=54500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 54\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",162],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "4500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2688\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2689, "epsg", 2689,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 55", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=165 +k=1 +x_0=55500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 55\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",165],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "5500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2689\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2690, "epsg", 2690,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 56", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=168 +k=1 +x_0=56500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 56\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",168],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "6500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2690\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2691, "epsg", 2691,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 57", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=171 +k=1 +x_0=57500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 57\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",171],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "7500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2691\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2692, "epsg", 2692,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 58", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=174 +k=1 +x_0=58500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 58\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",174],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "8500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2692\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2693, "epsg", 2693,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 59", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=177 +k=1 +x_0=59500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 59\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",177],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "9500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2693\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2694, "epsg", 2694,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 60 (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=180 +k=1 +x_0=60000000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 60 (d");
-    add_srs_wkt (p, 1,
-        "eprecated)\",GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_199");
-    add_srs_wkt (p, 2,
-        "5\",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.");
-    add_srs_wkt (p, 4,
-        "13,-0.22],AUTHORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwi");
-    add_srs_wkt (p, 5,
-        "ch\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0");
-    add_srs_wkt (p, 6,
-        "174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lat");
-    add_srs_wkt (p, 7,
-        "itude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 8,
-        "\",\"4200\"]],PROJECTION[\"Transverse_Mercator\"],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"latitude_of_origin\",0],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 10,
-        "an\",180],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",60000000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2694\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2695, "epsg", 2695,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 61", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-177 +k=1 +x_0=61500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-");
-    add_proj4text (p, 2,
-        "0.22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 61\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-177],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "61500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2695\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2696, "epsg", 2696,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 62", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-174 +k=1 +x_0=62500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-");
-    add_proj4text (p, 2,
-        "0.22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 62\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-174],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "62500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2696\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2697, "epsg", 2697,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 63", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-171 +k=1 +x_0=63500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-");
-    add_proj4text (p, 2,
-        "0.22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 63\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-171],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "63500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2697\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2698, "epsg", 2698,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger zone 64", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-168 +k=1 +x_0=64500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-");
-    add_proj4text (p, 2,
-        "0.22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 64\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-168],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "64500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"2698\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2699, "epsg", 2699,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 21E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 21E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",21],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2699\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2700, "epsg", 2700,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 24E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 24E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",24],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2700\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2701, "epsg", 2701,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 27E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 27E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",27],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2701\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2702, "epsg", 2702,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 30E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 30E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",30],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2702\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2703, "epsg", 2703,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 33E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 33E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",33],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2703\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2704, "epsg", 2704,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 36E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 36E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",36],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2704\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2705, "epsg", 2705,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 39E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 39E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",39],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2705\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2706, "epsg", 2706,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 42E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 42E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",42],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2706\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2707, "epsg", 2707,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 45E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 45E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",45],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2707\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2708, "epsg", 2708,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 48E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=48 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 48E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",48],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2708\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2709, "epsg", 2709,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 51E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=51 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 51E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",51],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2709\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2710, "epsg", 2710,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 54E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=54 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 54E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",54],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2710\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2711, "epsg", 2711,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 57E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=57 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 57E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",57],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2711\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2712, "epsg", 2712,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 60E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=60 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 60E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",60],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2712\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2713, "epsg", 2713,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 63E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=63 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 63E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",63],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2713\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2714, "epsg", 2714,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 66E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=66 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 66E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",66],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2714\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2715, "epsg", 2715,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 69E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=69 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 69E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",69],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2715\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2716, "epsg", 2716,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 72E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=72 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 72E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",72],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2716\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2717, "epsg", 2717,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 75E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 75E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",75],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2717\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2718, "epsg", 2718,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 78E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 78E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",78],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2718\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2719, "epsg", 2719,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 81E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 81E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",81],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2719\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2720, "epsg", 2720,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 84E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 84E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",84],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2720\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2721, "epsg", 2721,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 87E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 87E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",87],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2721\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2722, "epsg", 2722,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 90E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 90E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",90],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2722\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2723, "epsg", 2723,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 93E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 93E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",93],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2723\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2724, "epsg", 2724,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 96E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 96E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",96],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2724\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2725, "epsg", 2725,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 99E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 99E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",99],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"2725\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2726, "epsg", 2726,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 102E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 102E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",102],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2726\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2727, "epsg", 2727,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 105E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 105E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",105],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2727\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2728, "epsg", 2728,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 108E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 108E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",108],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2728\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
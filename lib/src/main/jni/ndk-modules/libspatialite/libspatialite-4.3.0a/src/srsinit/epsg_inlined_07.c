@@ -1,4145 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_07 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 2729, "epsg", 2729,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 111E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 111E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",111],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2729\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2730, "epsg", 2730,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 114E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 114E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",114],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2730\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2731, "epsg", 2731,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 117E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 117E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",117],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2731\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2732, "epsg", 2732,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 120E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 120E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",120],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2732\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2733, "epsg", 2733,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 123E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 123E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",123],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2733\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2734, "epsg", 2734,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 126E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 126E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",126],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2734\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2735, "epsg", 2735,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 129E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 129E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",129],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2735\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2736, "epsg", 2736,
-        "Tete / UTM zone 36S", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "Tete", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=36 +south +ellps=clrk66 +towgs84=-73.472");
-    add_proj4text (p, 1,
-        ",-51.66,-112.482,0.953,4.6,-2.368,0.586 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tete / UTM zone 36S\",GEOGCS[\"Tete\",DATUM[\"T");
-    add_srs_wkt (p, 1,
-        "ete\",SPHEROID[\"Clarke 1866\",6378206.4,294.97869821389");
-    add_srs_wkt (p, 2,
-        "82,AUTHORITY[\"EPSG\",\"7008\"]],TOWGS84[-73.472,-51.66,");
-    add_srs_wkt (p, 3,
-        "-112.482,0.953,4.6,-2.368,0.586],AUTHORITY[\"EPSG\",\"61");
-    add_srs_wkt (p, 4,
-        "27\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4127\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",33],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2736\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2737, "epsg", 2737,
-        "Tete / UTM zone 37S", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "Tete", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=37 +south +ellps=clrk66 +towgs84=-73.472");
-    add_proj4text (p, 1,
-        ",-51.66,-112.482,0.953,4.6,-2.368,0.586 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tete / UTM zone 37S\",GEOGCS[\"Tete\",DATUM[\"T");
-    add_srs_wkt (p, 1,
-        "ete\",SPHEROID[\"Clarke 1866\",6378206.4,294.97869821389");
-    add_srs_wkt (p, 2,
-        "82,AUTHORITY[\"EPSG\",\"7008\"]],TOWGS84[-73.472,-51.66,");
-    add_srs_wkt (p, 3,
-        "-112.482,0.953,4.6,-2.368,0.586],AUTHORITY[\"EPSG\",\"61");
-    add_srs_wkt (p, 4,
-        "27\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4127\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",39],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2737\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2738, "epsg", 2738,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 132E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 132E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",132],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2738\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2739, "epsg", 2739,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 135E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 135E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",135],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2739\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2740, "epsg", 2740,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 138E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=138 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 138E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",138],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2740\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2741, "epsg", 2741,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 141E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=141 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 141E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",141],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2741\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2742, "epsg", 2742,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 144E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=144 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 144E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",144],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2742\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2743, "epsg", 2743,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 147E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=147 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 147E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",147],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2743\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2744, "epsg", 2744,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 150E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=150 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 150E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",150],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2744\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2745, "epsg", 2745,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 153E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=153 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 153E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",153],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2745\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2746, "epsg", 2746,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 156E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=156 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 156E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",156],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2746\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2747, "epsg", 2747,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 159E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=159 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 159E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",159],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2747\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2748, "epsg", 2748,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 162E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=162 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 162E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",162],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2748\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2749, "epsg", 2749,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 165E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=165 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 165E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",165],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2749\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2750, "epsg", 2750,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 168E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=168 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 168E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",168],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2750\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2751, "epsg", 2751,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 171E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=171 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 171E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",171],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2751\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2752, "epsg", 2752,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 174E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=174 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 174E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",174],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2752\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2753, "epsg", 2753,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 177E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=177 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 177E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",177],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2753\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2754, "epsg", 2754,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 180E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=180 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 180E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",180],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"2754\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2755, "epsg", 2755,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 177W", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-177 +k=1 +x_0=500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 177W\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-177],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2755\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2756, "epsg", 2756,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 174W", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-174 +k=1 +x_0=500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 174W\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-174],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2756\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2757, "epsg", 2757,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 171W", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-171 +k=1 +x_0=500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 171W\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-171],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2757\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2758, "epsg", 2758,
-        "Pulkovo 1995 / 3-degree Gauss-Kruger CM 168W", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-168 +k=1 +x_0=500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.");
-    add_proj4text (p, 2,
-        "22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 168W\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[24.47,-130.89,-81.56,0,0,0.13,-0.22],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4200\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-168],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",EAST],AUTHORITY[\"EPSG\",\"2758\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2759, "epsg", 2759,
-        "NAD83(HARN) / Alabama East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30.5 +lon_0=-85.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9996 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Alabama East\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 9,
-        "0.5],PARAMETER[\"central_meridian\",-85.83333333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",0.99996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",200000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2759\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2760, "epsg", 2760,
-        "NAD83(HARN) / Alabama West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-87.5 +k=0.999933333 +x_0=6");
-    add_proj4text (p, 1,
-        "00000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Alabama West\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"central_meridian\",-87.5],PARAMETER[\"sca");
-    add_srs_wkt (p, 10,
-        "le_factor\",0.999933333],PARAMETER[\"false_easting\",600");
-    add_srs_wkt (p, 11,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"2760\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2761, "epsg", 2761,
-        "NAD83(HARN) / Arizona East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-110.1666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Arizona East\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 9,
-        "1],PARAMETER[\"central_meridian\",-110.1666666666667],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 11,
-        "ng\",213360],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 12,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2761\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2762, "epsg", 2762,
-        "NAD83(HARN) / Arizona Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-111.9166666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Arizona Central\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 9,
-        ",31],PARAMETER[\"central_meridian\",-111.9166666666667],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",213360],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 12,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2762\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2763, "epsg", 2763,
-        "NAD83(HARN) / Arizona West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-113.75 +k=0.999933333 +x_0");
-    add_proj4text (p, 1,
-        "=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Arizona West\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 9,
-        "1],PARAMETER[\"central_meridian\",-113.75],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "cale_factor\",0.999933333],PARAMETER[\"false_easting\",2");
-    add_srs_wkt (p, 11,
-        "13360],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2763\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2764, "epsg", 2764,
-        "NAD83(HARN) / Arkansas North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.23333333333333 +lat_2=34.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=34.33333333333334 +lon_0=-92 +x_0=400000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Arkansas North\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",36.23333333333333],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",34.93333333333333],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 11,
-        ",34.33333333333334],PARAMETER[\"central_meridian\",-92],");
-    add_srs_wkt (p, 12,
-        "PARAMETER[\"false_easting\",400000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 13,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 14,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 15,
-        ",\"2764\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2765, "epsg", 2765,
-        "NAD83(HARN) / Arkansas South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.76666666666667 +lat_2=33.3 +lat_0=32");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-92 +x_0=400000 +y_0=400000 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Arkansas South\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",34.76666666666667],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",33.3],PARAMETER[\"latitude_of_origin\",32.66666666");
-    add_srs_wkt (p, 11,
-        "666666],PARAMETER[\"central_meridian\",-92],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_easting\",400000],PARAMETER[\"false_northing\",400");
-    add_srs_wkt (p, 13,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 14,
-        "[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2765");
-    add_srs_wkt (p, 15,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2766, "epsg", 2766,
-        "NAD83(HARN) / California zone 1", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.66666666666666 +lat_2=40 +lat_0=39.3");
-    add_proj4text (p, 1,
-        "3333333333334 +lon_0=-122 +x_0=2000000 +y_0=500000 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / California zone 1\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",41.66666666666666],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",40],PARAMETER[\"latitude_of_origin\",39.33333333");
-    add_srs_wkt (p, 11,
-        "333334],PARAMETER[\"central_meridian\",-122],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_easting\",2000000],PARAMETER[\"false_northing\",50");
-    add_srs_wkt (p, 13,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"276");
-    add_srs_wkt (p, 15,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2767, "epsg", 2767,
-        "NAD83(HARN) / California zone 2", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.83333333333334 +lat_2=38.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=37.66666666666666 +lon_0=-122 +x_0=2000000 +y");
-    add_proj4text (p, 2,
-        "_0=500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / California zone 2\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",39.83333333333334],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",38.33333333333334],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 11,
-        "n\",37.66666666666666],PARAMETER[\"central_meridian\",-1");
-    add_srs_wkt (p, 12,
-        "22],PARAMETER[\"false_easting\",2000000],PARAMETER[\"fal");
-    add_srs_wkt (p, 13,
-        "se_northing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 15,
-        "[\"EPSG\",\"2767\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2768, "epsg", 2768,
-        "NAD83(HARN) / California zone 3", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.5 +lon_0=-120.5 +x_0=2000000 +y_0=500000 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / California zone 3\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",38.43333333333333],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",37.06666666666667],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 11,
-        "n\",36.5],PARAMETER[\"central_meridian\",-120.5],PARAMET");
-    add_srs_wkt (p, 12,
-        "ER[\"false_easting\",2000000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 13,
-        "\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 14,
-        "],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 15,
-        "\"2768\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2769, "epsg", 2769,
-        "NAD83(HARN) / California zone 4", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.25 +lat_2=36 +lat_0=35.3333333333333");
-    add_proj4text (p, 1,
-        "4 +lon_0=-119 +x_0=2000000 +y_0=500000 +ellps=GRS80 +tow");
-    add_proj4text (p, 2,
-        "gs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / California zone 4\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",37.25],PARAMETER[\"standard_parallel_2\",36],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"latitude_of_origin\",35.33333333333334],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"central_meridian\",-119],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 12,
-        "ng\",2000000],PARAMETER[\"false_northing\",500000],UNIT[");
-    add_srs_wkt (p, 13,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAS");
-    add_srs_wkt (p, 14,
-        "T],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2769\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2770, "epsg", 2770,
-        "NAD83(HARN) / California zone 5", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.46666666666667 +lat_2=34.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.5 +lon_0=-118 +x_0=2000000 +y_0=500000 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / California zone 5\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",35.46666666666667],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",34.03333333333333],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 11,
-        "n\",33.5],PARAMETER[\"central_meridian\",-118],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_easting\",2000000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 15,
-        "2770\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2771, "epsg", 2771,
-        "NAD83(HARN) / California zone 6", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.88333333333333 +lat_2=32.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=32.16666666666666 +lon_0=-116.25 +x_0=2000000");
-    add_proj4text (p, 2,
-        " +y_0=500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 3,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / California zone 6\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",33.88333333333333],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",32.78333333333333],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 11,
-        "n\",32.16666666666666],PARAMETER[\"central_meridian\",-1");
-    add_srs_wkt (p, 12,
-        "16.25],PARAMETER[\"false_easting\",2000000],PARAMETER[\"");
-    add_srs_wkt (p, 13,
-        "false_northing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 14,
-        "SG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHO");
-    add_srs_wkt (p, 15,
-        "RITY[\"EPSG\",\"2771\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2772, "epsg", 2772,
-        "NAD83(HARN) / Colorado North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.78333333333333 +lat_2=39.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=39.33333333333334 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "289 +y_0=304800.6096 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 3,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Colorado North\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",40.78333333333333],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",39.71666666666667],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 11,
-        ",39.33333333333334],PARAMETER[\"central_meridian\",-105.");
-    add_srs_wkt (p, 12,
-        "5],PARAMETER[\"false_easting\",914401.8289],PARAMETER[\"");
-    add_srs_wkt (p, 13,
-        "false_northing\",304800.6096],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],");
-    add_srs_wkt (p, 15,
-        "AUTHORITY[\"EPSG\",\"2772\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2773, "epsg", 2773,
-        "NAD83(HARN) / Colorado Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.75 +lat_2=38.45 +lat_0=37.8333333333");
-    add_proj4text (p, 1,
-        "3334 +lon_0=-105.5 +x_0=914401.8289 +y_0=304800.6096 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Colorado Central\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",39.75],PARAMETER[\"standard_parallel_2\",38.4");
-    add_srs_wkt (p, 10,
-        "5],PARAMETER[\"latitude_of_origin\",37.83333333333334],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"central_meridian\",-105.5],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "easting\",914401.8289],PARAMETER[\"false_northing\",3048");
-    add_srs_wkt (p, 13,
-        "00.6096],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 15,
-        "2773\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2774, "epsg", 2774,
-        "NAD83(HARN) / Colorado South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.23333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.66666666666666 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "289 +y_0=304800.6096 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 3,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Colorado South\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",38.43333333333333],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",37.23333333333333],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 11,
-        ",36.66666666666666],PARAMETER[\"central_meridian\",-105.");
-    add_srs_wkt (p, 12,
-        "5],PARAMETER[\"false_easting\",914401.8289],PARAMETER[\"");
-    add_srs_wkt (p, 13,
-        "false_northing\",304800.6096],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],");
-    add_srs_wkt (p, 15,
-        "AUTHORITY[\"EPSG\",\"2774\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2775, "epsg", 2775,
-        "NAD83(HARN) / Connecticut", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.86666666666667 +lat_2=41.2 +lat_0=40");
-    add_proj4text (p, 1,
-        ".83333333333334 +lon_0=-72.75 +x_0=304800.6096 +y_0=1524");
-    add_proj4text (p, 2,
-        "00.3048 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 3,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Connecticut\",GEOGCS[\"NAD83(HARN");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 8,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 9,
-        "el_1\",41.86666666666667],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",41.2],PARAMETER[\"latitude_of_origin\",40.8333333333");
-    add_srs_wkt (p, 11,
-        "3334],PARAMETER[\"central_meridian\",-72.75],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_easting\",304800.6096],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",152400.3048],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 14,
-        "\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 15,
-        "\",\"2775\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2776, "epsg", 2776,
-        "NAD83(HARN) / Delaware", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=-75.41666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "995 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Delaware\",GEOGCS[\"NAD83(HARN)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 8,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",38],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",-75.41666666666667],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"scale_factor\",0.999995],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",200000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Y\",NORTH],AUTHORITY[\"EPSG\",\"2776\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2777, "epsg", 2777,
-        "NAD83(HARN) / Florida East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-81 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Florida East\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",2");
-    add_srs_wkt (p, 9,
-        "4.33333333333333],PARAMETER[\"central_meridian\",-81],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",0.999941177],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",200000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2777\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2778, "epsg", 2778,
-        "NAD83(HARN) / Florida West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-82 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Florida West\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",2");
-    add_srs_wkt (p, 9,
-        "4.33333333333333],PARAMETER[\"central_meridian\",-82],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",0.999941177],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",200000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2778\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2779, "epsg", 2779,
-        "NAD83(HARN) / Florida North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.75 +lat_2=29.58333333333333 +lat_0=2");
-    add_proj4text (p, 1,
-        "9 +lon_0=-84.5 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Florida North\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 8,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 9,
-        "lel_1\",30.75],PARAMETER[\"standard_parallel_2\",29.5833");
-    add_srs_wkt (p, 10,
-        "3333333333],PARAMETER[\"latitude_of_origin\",29],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"central_meridian\",-84.5],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 12,
-        "\",600000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 13,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Y\",NORTH],AUTHORITY[\"EPSG\",\"2779\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2780, "epsg", 2780,
-        "NAD83(HARN) / Georgia East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-82.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Georgia East\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"central_meridian\",-82.16666666666667],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 11,
-        "ng\",200000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 12,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2780\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2781, "epsg", 2781,
-        "NAD83(HARN) / Georgia West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-84.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=700000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Georgia West\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"central_meridian\",-84.16666666666667],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 11,
-        "ng\",700000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 12,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2781\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2782, "epsg", 2782,
-        "NAD83(HARN) / Hawaii zone 1", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=18.83333333333333 +lon_0=-155.5 +k=0.");
-    add_proj4text (p, 1,
-        "999966667 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0");
-    add_proj4text (p, 2,
-        ",0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Hawaii zone 1\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",1");
-    add_srs_wkt (p, 9,
-        "8.83333333333333],PARAMETER[\"central_meridian\",-155.5]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.999966667],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2782\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2783, "epsg", 2783,
-        "NAD83(HARN) / Hawaii zone 2", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=20.33333333333333 +lon_0=-156.6666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999966667 +x_0=500000 +y_0=0 +ellps=GRS80 +t");
-    add_proj4text (p, 2,
-        "owgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Hawaii zone 2\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",2");
-    add_srs_wkt (p, 9,
-        "0.33333333333333],PARAMETER[\"central_meridian\",-156.66");
-    add_srs_wkt (p, 10,
-        "66666666667],PARAMETER[\"scale_factor\",0.999966667],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_easting\",500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2783\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2784, "epsg", 2784,
-        "NAD83(HARN) / Hawaii zone 3", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.16666666666667 +lon_0=-158 +k=0.99");
-    add_proj4text (p, 1,
-        "999 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Hawaii zone 3\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",2");
-    add_srs_wkt (p, 9,
-        "1.16666666666667],PARAMETER[\"central_meridian\",-158],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",0.99999],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 12,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2784\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2785, "epsg", 2785,
-        "NAD83(HARN) / Hawaii zone 4", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.83333333333333 +lon_0=-159.5 +k=0.");
-    add_proj4text (p, 1,
-        "99999 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Hawaii zone 4\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",2");
-    add_srs_wkt (p, 9,
-        "1.83333333333333],PARAMETER[\"central_meridian\",-159.5]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.99999],PARAMETER[\"false_e");
-    add_srs_wkt (p, 11,
-        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2785\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2786, "epsg", 2786,
-        "NAD83(HARN) / Hawaii zone 5", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.66666666666667 +lon_0=-160.1666666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0");
-    add_proj4text (p, 2,
-        ",0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Hawaii zone 5\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",2");
-    add_srs_wkt (p, 9,
-        "1.66666666666667],PARAMETER[\"central_meridian\",-160.16");
-    add_srs_wkt (p, 10,
-        "66666666667],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2786\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2787, "epsg", 2787,
-        "NAD83(HARN) / Idaho East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-112.1666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.9999473679999999 +x_0=200000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Idaho East\",GEOGCS[\"NAD83(HARN)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.6");
-    add_srs_wkt (p, 9,
-        "6666666666666],PARAMETER[\"central_meridian\",-112.16666");
-    add_srs_wkt (p, 10,
-        "66666667],PARAMETER[\"scale_factor\",0.999947368],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",200000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"278");
-    add_srs_wkt (p, 14,
-        "7\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2788, "epsg", 2788,
-        "NAD83(HARN) / Idaho Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-114 +k=0.99");
-    add_proj4text (p, 1,
-        "99473679999999 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Idaho Central\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",4");
-    add_srs_wkt (p, 9,
-        "1.66666666666666],PARAMETER[\"central_meridian\",-114],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",0.999947368],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",500000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAS");
-    add_srs_wkt (p, 13,
-        "T],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2788\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2789, "epsg", 2789,
-        "NAD83(HARN) / Idaho West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-115.75 +k=0");
-    add_proj4text (p, 1,
-        ".999933333 +x_0=800000 +y_0=0 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Idaho West\",GEOGCS[\"NAD83(HARN)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.6");
-    add_srs_wkt (p, 9,
-        "6666666666666],PARAMETER[\"central_meridian\",-115.75],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",0.999933333],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",800000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAS");
-    add_srs_wkt (p, 13,
-        "T],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2789\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2790, "epsg", 2790,
-        "NAD83(HARN) / Illinois East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-88.33333333");
-    add_proj4text (p, 1,
-        "333333 +k=0.9999749999999999 +x_0=300000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Illinois East\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 9,
-        "6.66666666666666],PARAMETER[\"central_meridian\",-88.333");
-    add_srs_wkt (p, 10,
-        "33333333333],PARAMETER[\"scale_factor\",0.999975],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",300000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"279");
-    add_srs_wkt (p, 14,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2791, "epsg", 2791,
-        "NAD83(HARN) / Illinois West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-90.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999941177 +x_0=700000 +y_0=0 +ellps=GRS80 +t");
-    add_proj4text (p, 2,
-        "owgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Illinois West\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 9,
-        "6.66666666666666],PARAMETER[\"central_meridian\",-90.166");
-    add_srs_wkt (p, 10,
-        "66666666667],PARAMETER[\"scale_factor\",0.999941177],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_easting\",700000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2791\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2792, "epsg", 2792,
-        "NAD83(HARN) / Indiana East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=100000 +y_0=250000 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 2,
-        ",0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Indiana East\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 9,
-        "7.5],PARAMETER[\"central_meridian\",-85.66666666666667],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",0.999966667],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",100000],PARAMETER[\"false_northing\",250000]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X");
-    add_srs_wkt (p, 13,
-        "\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2792\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2793, "epsg", 2793,
-        "NAD83(HARN) / Indiana West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=900000 +y_0=250000 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 2,
-        ",0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Indiana West\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 9,
-        "7.5],PARAMETER[\"central_meridian\",-87.08333333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",0.999966667],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",900000],PARAMETER[\"false_northing\",250000]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X");
-    add_srs_wkt (p, 13,
-        "\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2793\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2794, "epsg", 2794,
-        "NAD83(HARN) / Iowa North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=1000000 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Iowa North\",GEOGCS[\"NAD83(HARN)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 8,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",43.26666666666667],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",42.06666666666667],PARAMETER[\"latitude_of_origin\",41.");
-    add_srs_wkt (p, 11,
-        "5],PARAMETER[\"central_meridian\",-93.5],PARAMETER[\"fal");
-    add_srs_wkt (p, 12,
-        "se_easting\",1500000],PARAMETER[\"false_northing\",10000");
-    add_srs_wkt (p, 13,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 14,
-        "\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2794\"");
-    add_srs_wkt (p, 15,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2795, "epsg", 2795,
-        "NAD83(HARN) / Iowa South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Iowa South\",GEOGCS[\"NAD83(HARN)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 8,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",41.78333333333333],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",40.61666666666667],PARAMETER[\"latitude_of_origin\",40]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"central_meridian\",-93.5],PARAMETER[\"false");
-    add_srs_wkt (p, 12,
-        "_easting\",500000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 13,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAS");
-    add_srs_wkt (p, 14,
-        "T],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2795\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2796, "epsg", 2796,
-        "NAD83(HARN) / Kansas North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=400000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Kansas North\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 8,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 9,
-        "lel_1\",39.78333333333333],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 10,
-        "_2\",38.71666666666667],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 11,
-        ",38.33333333333334],PARAMETER[\"central_meridian\",-98],");
-    add_srs_wkt (p, 12,
-        "PARAMETER[\"false_easting\",400000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 13,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 14,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 15,
-        ",\"2796\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2797, "epsg", 2797,
-        "NAD83(HARN) / Kansas South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=400000 +y");
-    add_proj4text (p, 2,
-        "_0=400000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Kansas South\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 8,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 9,
-        "lel_1\",38.56666666666667],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 10,
-        "_2\",37.26666666666667],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 11,
-        ",36.66666666666666],PARAMETER[\"central_meridian\",-98.5");
-    add_srs_wkt (p, 12,
-        "],PARAMETER[\"false_easting\",400000],PARAMETER[\"false_");
-    add_srs_wkt (p, 13,
-        "northing\",400000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 15,
-        "EPSG\",\"2797\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2798, "epsg", 2798,
-        "NAD83(HARN) / Kentucky North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000 +y_0=0 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Kentucky North\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",37.96666666666667],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",38.96666666666667],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 11,
-        ",37.5],PARAMETER[\"central_meridian\",-84.25],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 13,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2798\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2799, "epsg", 2799,
-        "NAD83(HARN) / Kentucky South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000 +");
-    add_proj4text (p, 2,
-        "y_0=500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 3,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Kentucky South\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",37.93333333333333],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",36.73333333333333],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 11,
-        ",36.33333333333334],PARAMETER[\"central_meridian\",-85.7");
-    add_srs_wkt (p, 12,
-        "5],PARAMETER[\"false_easting\",500000],PARAMETER[\"false");
-    add_srs_wkt (p, 13,
-        "_northing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 14,
-        "\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 15,
-        "\"EPSG\",\"2799\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2800, "epsg", 2800,
-        "NAD83(HARN) / Louisiana North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=1000000 +y_0=0 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Louisiana North\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",32.66666666666666],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",31.16666666666667],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 11,
-        "n\",30.5],PARAMETER[\"central_meridian\",-92.5],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"false_easting\",1000000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 14,
-        "\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2800\"");
-    add_srs_wkt (p, 15,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2801, "epsg", 2801,
-        "NAD83(HARN) / Louisiana South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91");
-    add_proj4text (p, 1,
-        ".33333333333333 +x_0=1000000 +y_0=0 +ellps=GRS80 +towgs8");
-    add_proj4text (p, 2,
-        "4=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Louisiana South\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",30.7],PARAMETER[\"standard_parallel_2\",29.3]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"latitude_of_origin\",28.5],PARAMETER[\"cent");
-    add_srs_wkt (p, 11,
-        "ral_meridian\",-91.33333333333333],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 12,
-        "ting\",1000000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 13,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2801\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2802, "epsg", 2802,
-        "NAD83(HARN) / Maine East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.66666666666666 +lon_0=-68.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Maine East\",GEOGCS[\"NAD83(HARN)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",43.6");
-    add_srs_wkt (p, 9,
-        "6666666666666],PARAMETER[\"central_meridian\",-68.5],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",300000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 12,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2802\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2803, "epsg", 2803,
-        "NAD83(HARN) / Maine West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999966667 +x_0=900000 +y_0=0 +ellps=GRS80 +t");
-    add_proj4text (p, 2,
-        "owgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Maine West\",GEOGCS[\"NAD83(HARN)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",42.8");
-    add_srs_wkt (p, 9,
-        "3333333333334],PARAMETER[\"central_meridian\",-70.166666");
-    add_srs_wkt (p, 10,
-        "66666667],PARAMETER[\"scale_factor\",0.999966667],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",900000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"280");
-    add_srs_wkt (p, 14,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2804, "epsg", 2804,
-        "NAD83(HARN) / Maryland", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666");
-    add_proj4text (p, 1,
-        "666 +lon_0=-77 +x_0=400000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Maryland\",GEOGCS[\"NAD83(HARN)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 8,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1");
-    add_srs_wkt (p, 9,
-        "\",39.45],PARAMETER[\"standard_parallel_2\",38.3],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"latitude_of_origin\",37.66666666666666],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"central_meridian\",-77],PARAMETER[\"false_easting\",40");
-    add_srs_wkt (p, 12,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2804\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2805, "epsg", 2805,
-        "NAD83(HARN) / Massachusetts Mainland", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000 +y_0=750000 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Massachusetts Mainland\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 7,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJE");
-    add_srs_wkt (p, 8,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"stand");
-    add_srs_wkt (p, 9,
-        "ard_parallel_1\",42.68333333333333],PARAMETER[\"standard");
-    add_srs_wkt (p, 10,
-        "_parallel_2\",41.71666666666667],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 11,
-        "_origin\",41],PARAMETER[\"central_meridian\",-71.5],PARA");
-    add_srs_wkt (p, 12,
-        "METER[\"false_easting\",200000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 13,
-        "ng\",750000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 14,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 15,
-        ",\"2805\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2806, "epsg", 2806,
-        "NAD83(HARN) / Massachusetts Island", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Massachusetts Island\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[");
-    add_srs_wkt (p, 7,
-        "\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJEC");
-    add_srs_wkt (p, 8,
-        "TION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standa");
-    add_srs_wkt (p, 9,
-        "rd_parallel_1\",41.48333333333333],PARAMETER[\"standard_");
-    add_srs_wkt (p, 10,
-        "parallel_2\",41.28333333333333],PARAMETER[\"latitude_of_");
-    add_srs_wkt (p, 11,
-        "origin\",41],PARAMETER[\"central_meridian\",-70.5],PARAM");
-    add_srs_wkt (p, 12,
-        "ETER[\"false_easting\",500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 13,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 14,
-        "IS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"28");
-    add_srs_wkt (p, 15,
-        "06\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2807, "epsg", 2807,
-        "NAD83(HARN) / Michigan North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=8000000 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 3,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Michigan North\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",47.08333333333334],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",45.48333333333333],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 11,
-        ",44.78333333333333],PARAMETER[\"central_meridian\",-87],");
-    add_srs_wkt (p, 12,
-        "PARAMETER[\"false_easting\",8000000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 13,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 14,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 15,
-        ",\"2807\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2808, "epsg", 2808,
-        "NAD83(HARN) / Michigan Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43");
-    add_proj4text (p, 1,
-        ".31666666666667 +lon_0=-84.36666666666666 +x_0=6000000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Michigan Central\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",45.7],PARAMETER[\"standard_parallel_2\",44.18");
-    add_srs_wkt (p, 10,
-        "333333333333],PARAMETER[\"latitude_of_origin\",43.316666");
-    add_srs_wkt (p, 11,
-        "66666667],PARAMETER[\"central_meridian\",-84.36666666666");
-    add_srs_wkt (p, 12,
-        "666],PARAMETER[\"false_easting\",6000000],PARAMETER[\"fa");
-    add_srs_wkt (p, 13,
-        "lse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 15,
-        "EPSG\",\"2808\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2809, "epsg", 2809,
-        "NAD83(HARN) / Michigan South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41");
-    add_proj4text (p, 1,
-        ".5 +lon_0=-84.36666666666666 +x_0=4000000 +y_0=0 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Michigan South\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",43.66666666666666],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",42.1],PARAMETER[\"latitude_of_origin\",41.5],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"central_meridian\",-84.36666666666666],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_easting\",4000000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 13,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2809\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2810, "epsg", 2810,
-        "NAD83(HARN) / Minnesota North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.63333333333333 +lat_2=47.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=46.5 +lon_0=-93.09999999999999 +x_0=800000 +y");
-    add_proj4text (p, 2,
-        "_0=100000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Minnesota North\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",48.63333333333333],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",47.03333333333333],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 11,
-        "n\",46.5],PARAMETER[\"central_meridian\",-93.1],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"false_easting\",800000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",100000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 15,
-        "2810\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2811, "epsg", 2811,
-        "NAD83(HARN) / Minnesota Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.05 +lat_2=45.61666666666667 +lat_0=4");
-    add_proj4text (p, 1,
-        "5 +lon_0=-94.25 +x_0=800000 +y_0=100000 +ellps=GRS80 +to");
-    add_proj4text (p, 2,
-        "wgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Minnesota Central\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",47.05],PARAMETER[\"standard_parallel_2\",45.6");
-    add_srs_wkt (p, 10,
-        "1666666666667],PARAMETER[\"latitude_of_origin\",45],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"central_meridian\",-94.25],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 12,
-        "ting\",800000],PARAMETER[\"false_northing\",100000],UNIT");
-    add_srs_wkt (p, 13,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 14,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2811\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2812, "epsg", 2812,
-        "NAD83(HARN) / Minnesota South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.21666666666667 +lat_2=43.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=43 +lon_0=-94 +x_0=800000 +y_0=100000 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Minnesota South\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",45.21666666666667],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",43.78333333333333],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 11,
-        "n\",43],PARAMETER[\"central_meridian\",-94],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_easting\",800000],PARAMETER[\"false_northing\",100");
-    add_srs_wkt (p, 13,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 14,
-        "[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2812");
-    add_srs_wkt (p, 15,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2813, "epsg", 2813,
-        "NAD83(HARN) / Mississippi East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Mississippi East\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 9,
-        ",29.5],PARAMETER[\"central_meridian\",-88.83333333333333");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",300000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2813\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2814, "epsg", 2814,
-        "NAD83(HARN) / Mississippi West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=700000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Mississippi West\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 9,
-        ",29.5],PARAMETER[\"central_meridian\",-90.33333333333333");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",700000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2814\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2815, "epsg", 2815,
-        "NAD83(HARN) / Missouri East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=35.83333333333334 +lon_0=-90.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99933333 +x_0=250000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Missouri East\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 9,
-        "5.83333333333334],PARAMETER[\"central_meridian\",-90.5],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",0.999933333],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",250000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2815\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2816, "epsg", 2816,
-        "NAD83(HARN) / Missouri Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=35.83333333333334 +lon_0=-92.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99933333 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Missouri Central\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 9,
-        ",35.83333333333334],PARAMETER[\"central_meridian\",-92.5");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"scale_factor\",0.999933333],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2816\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2817, "epsg", 2817,
-        "NAD83(HARN) / Missouri West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.16666666666666 +lon_0=-94.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99941177 +x_0=850000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Missouri West\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 9,
-        "6.16666666666666],PARAMETER[\"central_meridian\",-94.5],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",0.999941177],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",850000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2817\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2818, "epsg", 2818,
-        "NAD83(HARN) / Montana", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5");
-    add_proj4text (p, 1,
-        " +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Montana\",GEOGCS[\"NAD83(HARN)\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"615");
-    add_srs_wkt (p, 4,
-        "2\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 8,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",49],PARAMETER[\"standard_parallel_2\",45],PARAMETER[\"l");
-    add_srs_wkt (p, 10,
-        "atitude_of_origin\",44.25],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 11,
-        ",-109.5],PARAMETER[\"false_easting\",600000],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 14,
-        "\"EPSG\",\"2818\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2819, "epsg", 2819,
-        "NAD83(HARN) / Nebraska", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=40 +lat_0=39.83333333333334 +");
-    add_proj4text (p, 1,
-        "lon_0=-100 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Nebraska\",GEOGCS[\"NAD83(HARN)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 8,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1");
-    add_srs_wkt (p, 9,
-        "\",43],PARAMETER[\"standard_parallel_2\",40],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "latitude_of_origin\",39.83333333333334],PARAMETER[\"cent");
-    add_srs_wkt (p, 11,
-        "ral_meridian\",-100],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 12,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORT");
-    add_srs_wkt (p, 14,
-        "H],AUTHORITY[\"EPSG\",\"2819\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2820, "epsg", 2820,
-        "NAD83(HARN) / Nevada East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=200000 +y_0=8000000 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Nevada East\",GEOGCS[\"NAD83(HARN");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",34");
-    add_srs_wkt (p, 9,
-        ".75],PARAMETER[\"central_meridian\",-115.5833333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",200000],PARAMETER[\"false_northing\",8000000],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2820\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2821, "epsg", 2821,
-        "NAD83(HARN) / Nevada Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=500000 +y_0=6000000 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Nevada Central\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 9,
-        "34.75],PARAMETER[\"central_meridian\",-116.6666666666667");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e");
-    add_srs_wkt (p, 11,
-        "asting\",500000],PARAMETER[\"false_northing\",6000000],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2821\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2822, "epsg", 2822,
-        "NAD83(HARN) / Nevada West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=800000 +y_0=4000000 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Nevada West\",GEOGCS[\"NAD83(HARN");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",34");
-    add_srs_wkt (p, 9,
-        ".75],PARAMETER[\"central_meridian\",-118.5833333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",800000],PARAMETER[\"false_northing\",4000000],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2822\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2823, "epsg", 2823,
-        "NAD83(HARN) / New Hampshire", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New Hampshire\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",4");
-    add_srs_wkt (p, 9,
-        "2.5],PARAMETER[\"central_meridian\",-71.66666666666667],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",0.999966667],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",300000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2823\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2824, "epsg", 2824,
-        "NAD83(HARN) / New Jersey", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New Jersey\",GEOGCS[\"NAD83(HARN)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",38.8");
-    add_srs_wkt (p, 9,
-        "3333333333334],PARAMETER[\"central_meridian\",-74.5],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",150000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 12,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2824\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2825, "epsg", 2825,
-        "NAD83(HARN) / New Mexico East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New Mexico East\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 9,
-        ",31],PARAMETER[\"central_meridian\",-104.3333333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",0.999909091],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",165000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2825\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2826, "epsg", 2826,
-        "NAD83(HARN) / New Mexico Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000");
-    add_proj4text (p, 1,
-        "00 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New Mexico Central\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",31],PARAMETER[\"central_meridian\",-106.25],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2826\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2827, "epsg", 2827,
-        "NAD83(HARN) / New Mexico West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "916667 +x_0=830000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New Mexico West\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 9,
-        ",31],PARAMETER[\"central_meridian\",-107.8333333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",0.999916667],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",830000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2827\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2828, "epsg", 2828,
-        "NAD83(HARN) / New York East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New York East\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 9,
-        "8.83333333333334],PARAMETER[\"central_meridian\",-74.5],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",150000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 12,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2828\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2829, "epsg", 2829,
-        "NAD83(HARN) / New York Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=250000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New York Central\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 9,
-        ",40],PARAMETER[\"central_meridian\",-76.58333333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",250000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2829\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
@@ -1,3895 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_09 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 2931, "epsg", 2931,
-        "Beduaram / TM 13 NE", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Beduaram", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13 +k=0.9996 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +a=6378249.2 +b=6356515 +towgs84=-106,-87,188,0,0,0,");
-    add_proj4text (p, 2,
-        "0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beduaram / TM 13 NE\",GEOGCS[\"Beduaram\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Beduaram\",SPHEROID[\"Clarke 1880 (IGN)\",6378249.2,2");
-    add_srs_wkt (p, 2,
-        "93.4660212936269,AUTHORITY[\"EPSG\",\"7011\"]],TOWGS84[-");
-    add_srs_wkt (p, 3,
-        "106,-87,188,0,0,0,0],AUTHORITY[\"EPSG\",\"6213\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 7,
-        "RITY[\"EPSG\",\"4213\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 8,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 9,
-        "tral_meridian\",13],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"2931\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2932, "epsg", 2932,
-        "QND95 / Qatar National Grid", 0, 0,
-        "International 1924", "Greenwich",
-        "Qatar_National_Datum_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.45 +lon_0=51.21666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "9999 +x_0=200000 +y_0=300000 +ellps=intl +towgs84=-119.4");
-    add_proj4text (p, 2,
-        "248,-303.65872,-11.00061,1.164298,0.174458,1.096259,3.65");
-    add_proj4text (p, 3,
-        "7065 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"QND95 / Qatar National Grid\",GEOGCS[\"QND95\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Qatar_National_Datum_1995\",SPHEROID[\"Internati");
-    add_srs_wkt (p, 2,
-        "onal 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TO");
-    add_srs_wkt (p, 3,
-        "WGS84[-119.4248,-303.65872,-11.00061,1.164298,0.174458,1");
-    add_srs_wkt (p, 4,
-        ".096259,3.657065],AUTHORITY[\"EPSG\",\"6614\"]],PRIMEM[\"");
-    add_srs_wkt (p, 5,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 6,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 7,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 8,
-        "[\"EPSG\",\"4614\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"latitude_of_origin\",24.45],PARAMETER[\"cen");
-    add_srs_wkt (p, 10,
-        "tral_meridian\",51.21666666666667],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 11,
-        "tor\",0.99999],PARAMETER[\"false_easting\",200000],PARAM");
-    add_srs_wkt (p, 12,
-        "ETER[\"false_northing\",300000],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor");
-    add_srs_wkt (p, 14,
-        "thing\",NORTH],AUTHORITY[\"EPSG\",\"2932\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2933, "epsg", 2933,
-        "Segara / UTM zone 50S", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Gunung_Segara", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=50 +south +ellps=bessel +towgs84=-403,68");
-    add_proj4text (p, 1,
-        "4,41,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Segara / UTM zone 50S\",GEOGCS[\"Segara\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Gunung_Segara\",SPHEROID[\"Bessel 1841\",6377397.155,");
-    add_srs_wkt (p, 2,
-        "299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[-403,6");
-    add_srs_wkt (p, 3,
-        "84,41,0,0,0,0],AUTHORITY[\"EPSG\",\"6613\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4613\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",117],PARAMETER[\"scale_factor\",0.9996],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_easting\",500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"2933\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2934, "epsg", 2934,
-        "Segara (Jakarta) / NEIEZ (deprecated)", 0, 0,
-        "Bessel 1841", "Jakarta",
-        "Gunung_Segara_Jakarta", "Mercator_1SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=110 +k=0.997 +x_0=3900000 +y_0=900000 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=-403,684,41,0,0,0,0 +pm=jakarta +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Segara (Jakarta) / NEIEZ (deprecated)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Segara (Jakarta)\",DATUM[\"Gunung_Segara_Jakarta\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7004\"]],TOWGS84[-403,684,41,0,0,0,0],AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"6820\"]],PRIMEM[\"Jakarta\",106.8077194444");
-    add_srs_wkt (p, 5,
-        "444,AUTHORITY[\"EPSG\",\"8908\"]],UNIT[\"degree\",0.0174");
-    add_srs_wkt (p, 6,
-        "532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitu");
-    add_srs_wkt (p, 7,
-        "de\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 8,
-        "\"4820\"]],PROJECTION[\"Mercator_1SP\"],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",110],PARAMETER[\"scale_factor\",0.997],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_easting\",3900000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",900000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "01\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EP");
-    add_srs_wkt (p, 13,
-        "SG\",\"2934\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2935, "epsg", 2935,
-        "Pulkovo 1942 / CS63 zone A1", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1166666666666667 +lon_0=41.53333333");
-    add_proj4text (p, 1,
-        "333333 +k=1 +x_0=1300000 +y_0=0 +ellps=krass +towgs84=23");
-    add_proj4text (p, 2,
-        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone A1\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],TOWGS84[2");
-    add_srs_wkt (p, 3,
-        "3.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        ".1166666666666667],PARAMETER[\"central_meridian\",41.533");
-    add_srs_wkt (p, 10,
-        "33333333333],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",1300000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2935\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2936, "epsg", 2936,
-        "Pulkovo 1942 / CS63 zone A2", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1166666666666667 +lon_0=44.53333333");
-    add_proj4text (p, 1,
-        "333333 +k=1 +x_0=2300000 +y_0=0 +ellps=krass +towgs84=23");
-    add_proj4text (p, 2,
-        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone A2\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],TOWGS84[2");
-    add_srs_wkt (p, 3,
-        "3.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        ".1166666666666667],PARAMETER[\"central_meridian\",44.533");
-    add_srs_wkt (p, 10,
-        "33333333333],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",2300000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2936\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2937, "epsg", 2937,
-        "Pulkovo 1942 / CS63 zone A3", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1166666666666667 +lon_0=47.53333333");
-    add_proj4text (p, 1,
-        "333333 +k=1 +x_0=3300000 +y_0=0 +ellps=krass +towgs84=23");
-    add_proj4text (p, 2,
-        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone A3\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],TOWGS84[2");
-    add_srs_wkt (p, 3,
-        "3.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        ".1166666666666667],PARAMETER[\"central_meridian\",47.533");
-    add_srs_wkt (p, 10,
-        "33333333333],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",3300000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2937\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2938, "epsg", 2938,
-        "Pulkovo 1942 / CS63 zone A4", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1166666666666667 +lon_0=50.53333333");
-    add_proj4text (p, 1,
-        "333333 +k=1 +x_0=4300000 +y_0=0 +ellps=krass +towgs84=23");
-    add_proj4text (p, 2,
-        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone A4\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],TOWGS84[2");
-    add_srs_wkt (p, 3,
-        "3.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        ".1166666666666667],PARAMETER[\"central_meridian\",50.533");
-    add_srs_wkt (p, 10,
-        "33333333333],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",4300000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2938\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2939, "epsg", 2939,
-        "Pulkovo 1942 / CS63 zone K2", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1333333333333333 +lon_0=50.76666666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=2300000 +y_0=0 +ellps=krass +towgs84=23");
-    add_proj4text (p, 2,
-        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone K2\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],TOWGS84[2");
-    add_srs_wkt (p, 3,
-        "3.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        ".1333333333333333],PARAMETER[\"central_meridian\",50.766");
-    add_srs_wkt (p, 10,
-        "66666666667],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",2300000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2939\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2940, "epsg", 2940,
-        "Pulkovo 1942 / CS63 zone K3", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1333333333333333 +lon_0=53.76666666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=3300000 +y_0=0 +ellps=krass +towgs84=23");
-    add_proj4text (p, 2,
-        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone K3\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],TOWGS84[2");
-    add_srs_wkt (p, 3,
-        "3.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        ".1333333333333333],PARAMETER[\"central_meridian\",53.766");
-    add_srs_wkt (p, 10,
-        "66666666667],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",3300000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2940\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2941, "epsg", 2941,
-        "Pulkovo 1942 / CS63 zone K4", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1333333333333333 +lon_0=56.76666666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=4300000 +y_0=0 +ellps=krass +towgs84=23");
-    add_proj4text (p, 2,
-        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone K4\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],TOWGS84[2");
-    add_srs_wkt (p, 3,
-        "3.92,-141.27,-80.9,0,0.35,0.82,-0.12],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4284\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        ".1333333333333333],PARAMETER[\"central_meridian\",56.766");
-    add_srs_wkt (p, 10,
-        "66666666667],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",4300000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"2941\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2942, "epsg", 2942,
-        "Porto Santo / UTM zone 28N", 0, 0,
-        "International 1924", "Greenwich",
-        "Porto_Santo_1936", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=intl +towgs84=-499,-249,314,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Porto Santo / UTM zone 28N\",GEOGCS[\"Porto San");
-    add_srs_wkt (p, 1,
-        "to\",DATUM[\"Porto_Santo_1936\",SPHEROID[\"International");
-    add_srs_wkt (p, 2,
-        " 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[-499,-249,314,0,0,0,0],AUTHORITY[\"EPSG\",\"6615\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"4615\"]],PROJECTION[\"Transverse_Mer");
-    add_srs_wkt (p, 8,
-        "cator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "central_meridian\",-15],PARAMETER[\"scale_factor\",0.999");
-    add_srs_wkt (p, 10,
-        "6],PARAMETER[\"false_easting\",500000],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 13,
-        "THORITY[\"EPSG\",\"2942\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2943, "epsg", 2943,
-        "Selvagem Grande / UTM zone 28N", 0, 0,
-        "International 1924", "Greenwich",
-        "Selvagem_Grande", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=intl +towgs84=-289,-124,60,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Selvagem Grande / UTM zone 28N\",GEOGCS[\"Selva");
-    add_srs_wkt (p, 1,
-        "gem Grande\",DATUM[\"Selvagem_Grande\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 2,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[-289,-124,60,0,0,0,0],AUTHORITY[\"EPSG\",\"6616");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"4616\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 8,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"central_meridian\",-15],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"2943\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2944, "epsg", 2944,
-        "NAD83(CSRS) / SCoPQ zone 2 (deprecated)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-55.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / SCoPQ zone 2 (deprecated)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-55.5],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",304800],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 12,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2944\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2945, "epsg", 2945,
-        "NAD83(CSRS) / MTM zone 3", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "E(X)", "East", "N(Y)", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-58.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 3\",GEOGCS[\"NAD83(CSRS)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-58.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",304800],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"E(X)\",EAST],AXIS[\"N(Y)\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"2945\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2946, "epsg", 2946,
-        "NAD83(CSRS) / MTM zone 4", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "E(X)", "East", "N(Y)", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-61.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 4\",GEOGCS[\"NAD83(CSRS)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-61.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",304800],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"E(X)\",EAST],AXIS[\"N(Y)\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"2946\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2947, "epsg", 2947,
-        "NAD83(CSRS) / MTM zone 5", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "E(X)", "East", "N(Y)", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-64.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 5\",GEOGCS[\"NAD83(CSRS)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-64.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",304800],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"E(X)\",EAST],AXIS[\"N(Y)\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"2947\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2948, "epsg", 2948,
-        "NAD83(CSRS) / MTM zone 6", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "E(X)", "East", "N(Y)", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-67.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 6\",GEOGCS[\"NAD83(CSRS)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-67.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",304800],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"E(X)\",EAST],AXIS[\"N(Y)\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"2948\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2949, "epsg", 2949,
-        "NAD83(CSRS) / MTM zone 7", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "E(X)", "East", "N(Y)", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-70.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 7\",GEOGCS[\"NAD83(CSRS)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-70.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",304800],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"E(X)\",EAST],AXIS[\"N(Y)\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"2949\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2950, "epsg", 2950,
-        "NAD83(CSRS) / MTM zone 8", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "E(X)", "East", "N(Y)", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-73.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 8\",GEOGCS[\"NAD83(CSRS)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-73.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",304800],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"E(X)\",EAST],AXIS[\"N(Y)\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"2950\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2951, "epsg", 2951,
-        "NAD83(CSRS) / MTM zone 9", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "E(X)", "East", "N(Y)", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-76.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 9\",GEOGCS[\"NAD83(CSRS)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-76.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",304800],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"E(X)\",EAST],AXIS[\"N(Y)\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"2951\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2952, "epsg", 2952,
-        "NAD83(CSRS) / MTM zone 10", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "E(X)", "East", "N(Y)", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-79.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 10\",GEOGCS[\"NAD83(CSRS");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-79.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",304800],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"E(X)\",EAST],AXIS[\"N(Y)\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"2952\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2953, "epsg", 2953,
-        "NAD83(CSRS) / New Brunswick Stereographic", 0, 1,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Oblique_Stereographic", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=46.5 +lon_0=-66.5 +k=0.999912 +x_0=2");
-    add_proj4text (p, 1,
-        "500000 +y_0=7500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / New Brunswick Stereographic\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Oblique_Stereographic\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",46.5],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 10,
-        "66.5],PARAMETER[\"scale_factor\",0.999912],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",2500000],PARAMETER[\"false_northing\",750");
-    add_srs_wkt (p, 12,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"2953\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2954, "epsg", 2954,
-        "NAD83(CSRS) / Prince Edward Isl. Stereographic (NAD83)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Oblique_Stereographic", "metre",
-        "E(X)", "East", "N(Y)", "North");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=47.25 +lon_0=-63 +k=0.999912 +x_0=40");
-    add_proj4text (p, 1,
-        "0000 +y_0=800000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Prince Edward Isl. Stereographic ");
-    add_srs_wkt (p, 1,
-        "(NAD83)\",GEOGCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_");
-    add_srs_wkt (p, 2,
-        "Spatial_Reference_System\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 3,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0");
-    add_srs_wkt (p, 4,
-        ",0,0,0,0,0],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 5,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 6,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 8,
-        "SG\",\"4617\"]],PROJECTION[\"Oblique_Stereographic\"],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"latitude_of_origin\",47.25],PARAMETER[\"centra");
-    add_srs_wkt (p, 10,
-        "l_meridian\",-63],PARAMETER[\"scale_factor\",0.999912],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",400000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",800000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 13,
-        "01\"]],AXIS[\"E(X)\",EAST],AXIS[\"N(Y)\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"2954\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2955, "epsg", 2955,
-        "NAD83(CSRS) / UTM zone 11N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=11 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 11N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"central_meridian\",-117],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 13,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2955\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2956, "epsg", 2956,
-        "NAD83(CSRS) / UTM zone 12N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=12 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 12N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"central_meridian\",-111],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 13,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2956\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2957, "epsg", 2957,
-        "NAD83(CSRS) / UTM zone 13N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=13 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 13N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"central_meridian\",-105],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 13,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2957\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2958, "epsg", 2958,
-        "NAD83(CSRS) / UTM zone 17N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 17N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"central_meridian\",-81],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 13,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"2958\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2959, "epsg", 2959,
-        "NAD83(CSRS) / UTM zone 18N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 18N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"central_meridian\",-75],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 13,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"2959\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2960, "epsg", 2960,
-        "NAD83(CSRS) / UTM zone 19N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 19N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"central_meridian\",-69],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 13,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"2960\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2961, "epsg", 2961,
-        "NAD83(CSRS) / UTM zone 20N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 20N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"central_meridian\",-63],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 13,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"2961\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2962, "epsg", 2962,
-        "NAD83(CSRS) / UTM zone 21N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 21N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"central_meridian\",-57],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 13,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"2962\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2964, "epsg", 2964,
-        "NAD27 / Alaska Albers", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Albers_Conic_Equal_Area", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=55 +lat_2=65 +lat_0=50 +lon_0=-154 +x_0");
-    add_proj4text (p, 1,
-        "=0 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Alaska Albers\",GEOGCS[\"NAD27\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",6");
-    add_srs_wkt (p, 2,
-        "378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 6,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4267");
-    add_srs_wkt (p, 7,
-        "\"]],PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "standard_parallel_1\",55],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 9,
-        "2\",65],PARAMETER[\"latitude_of_center\",50],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "longitude_of_center\",-154],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot");
-    add_srs_wkt (p, 12,
-        "\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2964");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2965, "epsg", 2965,
-        "NAD83 / Indiana East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=99999.99989839978 +y_0=249999.9998983998 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Indiana East (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",37.5],PARAMETER[\"c");
-    add_srs_wkt (p, 9,
-        "entral_meridian\",-85.66666666666667],PARAMETER[\"scale_");
-    add_srs_wkt (p, 10,
-        "factor\",0.999966667],PARAMETER[\"false_easting\",328083");
-    add_srs_wkt (p, 11,
-        ".333],PARAMETER[\"false_northing\",820208.3330000002],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHOR");
-    add_srs_wkt (p, 14,
-        "ITY[\"EPSG\",\"2965\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2966, "epsg", 2966,
-        "NAD83 / Indiana West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=900000 +y_0=249999.9998983998 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Indiana West (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",37.5],PARAMETER[\"c");
-    add_srs_wkt (p, 9,
-        "entral_meridian\",-87.08333333333333],PARAMETER[\"scale_");
-    add_srs_wkt (p, 10,
-        "factor\",0.999966667],PARAMETER[\"false_easting\",295275");
-    add_srs_wkt (p, 11,
-        "0],PARAMETER[\"false_northing\",820208.3330000002],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"2966\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2967, "epsg", 2967,
-        "NAD83(HARN) / Indiana East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=99999.99989839978 +y_0=249999.9998983998 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Indiana East (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",37.5],PARAMETER[\"central_meridian\",-85.6666666666");
-    add_srs_wkt (p, 10,
-        "6667],PARAMETER[\"scale_factor\",0.999966667],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",328083.333],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",820208.3330000002],UNIT[\"US survey foot\",0.30480060");
-    add_srs_wkt (p, 13,
-        "96012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2967\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2968, "epsg", 2968,
-        "NAD83(HARN) / Indiana West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=900000 +y_0=249999.9998983998 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Indiana West (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",37.5],PARAMETER[\"central_meridian\",-87.0833333333");
-    add_srs_wkt (p, 10,
-        "3333],PARAMETER[\"scale_factor\",0.999966667],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",2952750],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 12,
-        "820208.3330000002],UNIT[\"US survey foot\",0.30480060960");
-    add_srs_wkt (p, 13,
-        "12192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2968\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2969, "epsg", 2969,
-        "Fort Marigot / UTM zone 20N", 0, 0,
-        "International 1924", "Greenwich",
-        "Fort_Marigot", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=intl +towgs84=137,248,-430,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Fort Marigot / UTM zone 20N\",GEOGCS[\"Fort Mar");
-    add_srs_wkt (p, 1,
-        "igot\",DATUM[\"Fort_Marigot\",SPHEROID[\"International 1");
-    add_srs_wkt (p, 2,
-        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "137,248,-430,0,0,0,0],AUTHORITY[\"EPSG\",\"6621\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4621\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 9,
-        "ntral_meridian\",-63],PARAMETER[\"scale_factor\",0.9996]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"2969\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2970, "epsg", 2970,
-        "Guadeloupe 1948 / UTM zone 20N", 0, 0,
-        "International 1924", "Greenwich",
-        "Guadeloupe_1948", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=intl +towgs84=-467,-16,-300,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Guadeloupe 1948 / UTM zone 20N\",GEOGCS[\"Guade");
-    add_srs_wkt (p, 1,
-        "loupe 1948\",DATUM[\"Guadeloupe_1948\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 2,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[-467,-16,-300,0,0,0,0],AUTHORITY[\"EPSG\",\"662");
-    add_srs_wkt (p, 4,
-        "2\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4622\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",-63],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 10,
-        "\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"2970\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2971, "epsg", 2971,
-        "CSG67 / UTM zone 22N", 0, 0,
-        "International 1924", "Greenwich",
-        "Centre_Spatial_Guyanais_1967", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +ellps=intl +towgs84=-186,230,110,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CSG67 / UTM zone 22N\",GEOGCS[\"CSG67\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Centre_Spatial_Guyanais_1967\",SPHEROID[\"International ");
-    add_srs_wkt (p, 2,
-        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[-186,230,110,0,0,0,0],AUTHORITY[\"EPSG\",\"6623\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4623\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 9,
-        "ntral_meridian\",-51],PARAMETER[\"scale_factor\",0.9996]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"2971\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2972, "epsg", 2972,
-        "RGFG95 / UTM zone 22N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Reseau_Geodesique_Francais_Guyane_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGFG95 / UTM zone 22N\",GEOGCS[\"RGFG95\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Reseau_Geodesique_Francais_Guyane_1995\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6624\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4624\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"central_meridian\",-51],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 10,
-        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"2972\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2973, "epsg", 2973,
-        "Martinique 1938 / UTM zone 20N", 0, 0,
-        "International 1924", "Greenwich",
-        "Martinique_1938", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=intl +towgs84=186,482,151,0,0,");
-    add_proj4text (p, 1,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Martinique 1938 / UTM zone 20N\",GEOGCS[\"Marti");
-    add_srs_wkt (p, 1,
-        "nique 1938\",DATUM[\"Martinique_1938\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 2,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[186,482,151,0,0,0,0],AUTHORITY[\"EPSG\",\"6625\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4625\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"central_meridian\",-63],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 10,
-        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"2973\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2975, "epsg", 2975,
-        "RGR92 / UTM zone 40S", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Reseau_Geodesique_de_la_Reunion_1992", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=40 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGR92 / UTM zone 40S\",GEOGCS[\"RGR92\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Reseau_Geodesique_de_la_Reunion_1992\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6627\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"4627\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 8,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 9,
-        "entral_meridian\",57],PARAMETER[\"scale_factor\",0.9996]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"2975\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2976, "epsg", 2976,
-        "Tahiti 52 / UTM zone 6S", 0, 0,
-        "International 1924", "Greenwich",
-        "Tahiti_52", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=6 +south +ellps=intl +towgs84=162,117,15");
-    add_proj4text (p, 1,
-        "4,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tahiti 52 / UTM zone 6S\",GEOGCS[\"Tahiti 52\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Tahiti_52\",SPHEROID[\"International 1924\",6378");
-    add_srs_wkt (p, 2,
-        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[162,117,15");
-    add_srs_wkt (p, 3,
-        "4,0,0,0,0],AUTHORITY[\"EPSG\",\"6628\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 6,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"4628\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-147],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"2976\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2977, "epsg", 2977,
-        "Tahaa 54 / UTM zone 5S", 0, 0,
-        "International 1924", "Greenwich",
-        "Tahaa_54", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=5 +south +ellps=intl +towgs84=72.438,345");
-    add_proj4text (p, 1,
-        ".918,79.486,1.6045,0.8823,0.5565,1.3746 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tahaa 54 / UTM zone 5S\",GEOGCS[\"Tahaa 54\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Tahaa_54\",SPHEROID[\"International 1924\",6378388");
-    add_srs_wkt (p, 2,
-        ",297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[72.438,345.91");
-    add_srs_wkt (p, 3,
-        "8,79.486,1.6045,0.8823,0.5565,1.3746],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6629\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4629\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-153],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2977\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2978, "epsg", 2978,
-        "IGN72 Nuku Hiva / UTM zone 7S", 0, 0,
-        "International 1924", "Greenwich",
-        "IGN72_Nuku_Hiva", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=7 +south +ellps=intl +towgs84=84,274,65,");
-    add_proj4text (p, 1,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN72 Nuku Hiva / UTM zone 7S\",GEOGCS[\"IGN72 ");
-    add_srs_wkt (p, 1,
-        "Nuku Hiva\",DATUM[\"IGN72_Nuku_Hiva\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "TOWGS84[84,274,65,0,0,0,0],AUTHORITY[\"EPSG\",\"6630\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"4630\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 8,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"central_meridian\",-141],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 10,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2978\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2979, "epsg", 2979,
-        "K0 1949 / UTM zone 42S (deprecated)", 0, 0,
-        "International 1924", "Greenwich",
-        "K0_1949", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=42 +south +ellps=intl +towgs84=145,-187,");
-    add_proj4text (p, 1,
-        "103,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"K0 1949 / UTM zone 42S (deprecated)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "K0 1949\",DATUM[\"K0_1949\",SPHEROID[\"International 192");
-    add_srs_wkt (p, 2,
-        "4\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[14");
-    add_srs_wkt (p, 3,
-        "5,-187,103,0,0,0,0],AUTHORITY[\"EPSG\",\"6631\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4631\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",69],PARAMETER[\"scale_factor\",0.9996],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 11,
-        "hing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"2979\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2980, "epsg", 2980,
-        "Combani 1950 / UTM zone 38S", 0, 0,
-        "International 1924", "Greenwich",
-        "Combani_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +south +ellps=intl +towgs84=-382,-59,");
-    add_proj4text (p, 1,
-        "-262,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Combani 1950 / UTM zone 38S\",GEOGCS[\"Combani ");
-    add_srs_wkt (p, 1,
-        "1950\",DATUM[\"Combani_1950\",SPHEROID[\"International 1");
-    add_srs_wkt (p, 2,
-        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "-382,-59,-262,0,0,0,0],AUTHORITY[\"EPSG\",\"6632\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4632\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 9,
-        "ntral_meridian\",45],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 11,
-        "rthing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"2980\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2981, "epsg", 2981,
-        "IGN56 Lifou / UTM zone 58S", 0, 0,
-        "International 1924", "Greenwich",
-        "IGN56_Lifou", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=335.47,22");
-    add_proj4text (p, 1,
-        "2.58,-230.94,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN56 Lifou / UTM zone 58S\",GEOGCS[\"IGN56 Lif");
-    add_srs_wkt (p, 1,
-        "ou\",DATUM[\"IGN56_Lifou\",SPHEROID[\"International 1924");
-    add_srs_wkt (p, 2,
-        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[335");
-    add_srs_wkt (p, 3,
-        ".47,222.58,-230.94,0,0,0,0],AUTHORITY[\"EPSG\",\"6633\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4633\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",165],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 10,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2981\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2982, "epsg", 2982,
-        "IGN72 Grand Terre / UTM zone 58S (deprecated)", 0, 0,
-        "International 1924", "Greenwich",
-        "IGN72_Grande_Terre", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-13,-348,");
-    add_proj4text (p, 1,
-        "292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN72 Grand Terre / UTM zone 58S (deprecated)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"IGN72 Grand Terre\",DATUM[\"IGN72_Grande_Terre");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"International 1924\",6378388,297,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7022\"]],TOWGS84[-13,-348,292,0,0,0,0],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6634\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9108\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4634\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",165],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",10000000],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2982");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2983, "epsg", 2983,
-        "ST87 Ouvea / UTM zone 58S (deprecated)", 0, 0,
-        "International 1924", "Greenwich",
-        "ST87_Ouvea", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-122.383,");
-    add_proj4text (p, 1,
-        "-188.696,103.344,3.5107,-4.9668,-5.7047,4.4798 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ST87 Ouvea / UTM zone 58S (deprecated)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"ST87 Ouvea\",DATUM[\"ST87_Ouvea\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[-122.383,-188.696,103.344,3.5107,-4.9668,-5.7047,");
-    add_srs_wkt (p, 4,
-        "4.4798],AUTHORITY[\"EPSG\",\"6635\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 5,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 6,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 7,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 8,
-        ",\"4635\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 10,
-        "\",165],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 12,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"2983\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2984, "epsg", 2984,
-        "RGNC 1991 / Lambert New Caledonia (deprecated)", 0, 0,
-        "International 1924", "Greenwich",
-        "Reseau_Geodesique_Nouvelle_Caledonie_1991", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-20.66666666666667 +lat_2=-22.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-21.5 +lon_0=166 +x_0=400000 +y_0=300000 +e");
-    add_proj4text (p, 2,
-        "llps=intl +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGNC 1991 / Lambert New Caledonia (deprecated)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"RGNC 1991\",DATUM[\"Reseau_Geodesique_Nouvelle");
-    add_srs_wkt (p, 2,
-        "_Caledonie_1991\",SPHEROID[\"International 1924\",637838");
-    add_srs_wkt (p, 3,
-        "8,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[0,0,0,0,0,0,");
-    add_srs_wkt (p, 4,
-        "0],AUTHORITY[\"EPSG\",\"6645\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 6,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 8,
-        "45\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",-20.66666666666667],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",-22.33333333333333],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"latitude_of_origin\",-21.5],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 12,
-        "ian\",166],PARAMETER[\"false_easting\",400000],PARAMETER");
-    add_srs_wkt (p, 13,
-        "[\"false_northing\",300000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 15,
-        "HORITY[\"EPSG\",\"2984\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2987, "epsg", 2987,
-        "Saint Pierre et Miquelon 1950 / UTM zone 21N", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "Saint_Pierre_et_Miquelon_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=clrk66 +towgs84=30,430,368,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Saint Pierre et Miquelon 1950 / UTM zone 21N\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Saint Pierre et Miquelon 1950\",DATUM[\"Saint_P");
-    add_srs_wkt (p, 2,
-        "ierre_et_Miquelon_1950\",SPHEROID[\"Clarke 1866\",637820");
-    add_srs_wkt (p, 3,
-        "6.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]],TOWG");
-    add_srs_wkt (p, 4,
-        "S84[30,430,368,0,0,0,0],AUTHORITY[\"EPSG\",\"6638\"]],PR");
-    add_srs_wkt (p, 5,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 6,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 7,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 8,
-        "HORITY[\"EPSG\",\"4638\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 9,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 10,
-        "entral_meridian\",-57],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 13,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 14,
-        "HORITY[\"EPSG\",\"2987\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2988, "epsg", 2988,
-        "MOP78 / UTM zone 1S", 0, 0,
-        "International 1924", "Greenwich",
-        "MOP78", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=1 +south +ellps=intl +towgs84=253,-132,-");
-    add_proj4text (p, 1,
-        "127,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MOP78 / UTM zone 1S\",GEOGCS[\"MOP78\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "MOP78\",SPHEROID[\"International 1924\",6378388,297,AUTH");
-    add_srs_wkt (p, 2,
-        "ORITY[\"EPSG\",\"7022\"]],TOWGS84[253,-132,-127,0,0,0,0]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6639\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 6,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4639");
-    add_srs_wkt (p, 7,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-177");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",500000],PARAMETER[\"false_northing\",10000000],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 12,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"2988\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2989, "epsg", 2989,
-        "RRAF 1991 / UTM zone 20N (deprecated)", 0, 0,
-        "WGS 84", "Greenwich",
-        "Reseau_de_Reference_des_Antilles_Francaises_1991", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RRAF 1991 / UTM zone 20N (deprecated)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"RRAF 1991\",DATUM[\"Reseau_de_Reference_des_Antilles_F");
-    add_srs_wkt (p, 2,
-        "rancaises_1991\",SPHEROID[\"WGS 84\",6378137,298.2572235");
-    add_srs_wkt (p, 3,
-        "63,AUTHORITY[\"EPSG\",\"7030\"]],TOWGS84[0,0,0,0,0,0,0],");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"6640\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 6,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 7,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4640\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-63],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 12,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2989\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2990, "epsg", 2990,
-        "Reunion 1947 / TM Reunion (deprecated)", 0, 0,
-        "International 1924", "Greenwich",
-        "Reunion_1947", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-21.11666666666667 +lon_0=55.53333333");
-    add_proj4text (p, 1,
-        "333333 +k=1 +x_0=50000 +y_0=160000 +ellps=intl +towgs84=");
-    add_proj4text (p, 2,
-        "94,-948,-1262,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Reunion 1947 / TM Reunion (deprecated)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Reunion 1947\",DATUM[\"Reunion_1947\",SPHEROID[\"Inte");
-    add_srs_wkt (p, 2,
-        "rnational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[94,-948,-1262,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "626\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4626\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 8,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",-21.11");
-    add_srs_wkt (p, 9,
-        "666666666667],PARAMETER[\"central_meridian\",55.53333333");
-    add_srs_wkt (p, 10,
-        "333333],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",50000],PARAMETER[\"false_northing\",160000],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2990\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2991, "epsg", 2991,
-        "NAD83 / Oregon LCC (m)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Oregon LCC (m)\",GEOGCS[\"NAD83\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637");
-    add_srs_wkt (p, 2,
-        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic");
-    add_srs_wkt (p, 8,
-        "_2SP\"],PARAMETER[\"standard_parallel_1\",43],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",45.5],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 10,
-        "igin\",41.75],PARAMETER[\"central_meridian\",-120.5],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_easting\",400000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2991\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2992, "epsg", 2992,
-        "NAD83 / Oregon GIC Lambert (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=399999.9999984 +y_0=0 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Oregon GIC Lambert (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confor");
-    add_srs_wkt (p, 8,
-        "mal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",43],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_2\",45.5],PARAMETER[\"latit");
-    add_srs_wkt (p, 10,
-        "ude_of_origin\",41.75],PARAMETER[\"central_meridian\",-1");
-    add_srs_wkt (p, 11,
-        "20.5],PARAMETER[\"false_easting\",1312335.958],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"9002\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 14,
-        "HORITY[\"EPSG\",\"2992\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2993, "epsg", 2993,
-        "NAD83(HARN) / Oregon LCC (m)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Oregon LCC (m)\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",43],PARAMETER[\"standard_parallel_2\",45.5],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"latitude_of_origin\",41.75],PARAMETER[\"central");
-    add_srs_wkt (p, 11,
-        "_meridian\",-120.5],PARAMETER[\"false_easting\",400000],");
-    add_srs_wkt (p, 12,
-        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH");
-    add_srs_wkt (p, 14,
-        "],AUTHORITY[\"EPSG\",\"2993\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2994, "epsg", 2994,
-        "NAD83(HARN) / Oregon GIC Lambert (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=399999.9999984 +y_0=0 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Oregon GIC Lambert (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne");
-    add_srs_wkt (p, 2,
-        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 6,
-        "UTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AX");
-    add_srs_wkt (p, 7,
-        "IS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PRO");
-    add_srs_wkt (p, 8,
-        "JECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"sta");
-    add_srs_wkt (p, 9,
-        "ndard_parallel_1\",43],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",45.5],PARAMETER[\"latitude_of_origin\",41.75],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"central_meridian\",-120.5],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 12,
-        ",1312335.958],PARAMETER[\"false_northing\",0],UNIT[\"foo");
-    add_srs_wkt (p, 13,
-        "t\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X\",EAST");
-    add_srs_wkt (p, 14,
-        "],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2994\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2995, "epsg", 2995,
-        "IGN53 Mare / UTM zone 58S", 0, 0,
-        "International 1924", "Greenwich",
-        "IGN53_Mare", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=287.58,17");
-    add_proj4text (p, 1,
-        "7.78,-135.41,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN53 Mare / UTM zone 58S\",GEOGCS[\"IGN53 Mare");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"IGN53_Mare\",SPHEROID[\"International 1924\",");
-    add_srs_wkt (p, 2,
-        "6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[287.58");
-    add_srs_wkt (p, 3,
-        ",177.78,-135.41,0,0,0,0],AUTHORITY[\"EPSG\",\"6641\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"4641\"]],PROJECTION[\"Transverse_Mer");
-    add_srs_wkt (p, 8,
-        "cator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "central_meridian\",165],PARAMETER[\"scale_factor\",0.999");
-    add_srs_wkt (p, 10,
-        "6],PARAMETER[\"false_easting\",500000],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"2995\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2996, "epsg", 2996,
-        "ST84 Ile des Pins / UTM zone 58S", 0, 0,
-        "International 1924", "Greenwich",
-        "ST84_Ile_des_Pins", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-13,-348,");
-    add_proj4text (p, 1,
-        "292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ST84 Ile des Pins / UTM zone 58S\",GEOGCS[\"ST8");
-    add_srs_wkt (p, 1,
-        "4 Ile des Pins\",DATUM[\"ST84_Ile_des_Pins\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "22\"]],TOWGS84[-13,-348,292,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6642\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4642\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"central_meridian\",165],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 10,
-        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",10000000],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2996\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2997, "epsg", 2997,
-        "ST71 Belep / UTM zone 58S", 0, 0,
-        "International 1924", "Greenwich",
-        "ST71_Belep", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-480.26,-");
-    add_proj4text (p, 1,
-        "438.32,-643.429,16.3119,20.1721,-4.0349,-111.7002 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ST71 Belep / UTM zone 58S\",GEOGCS[\"ST71 Belep");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"ST71_Belep\",SPHEROID[\"International 1924\",");
-    add_srs_wkt (p, 2,
-        "6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-480.2");
-    add_srs_wkt (p, 3,
-        "6,-438.32,-643.429,16.3119,20.1721,-4.0349,-111.7002],AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"6643\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 5,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 6,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORT");
-    add_srs_wkt (p, 7,
-        "H],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4643\"]");
-    add_srs_wkt (p, 8,
-        "],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 9,
-        "de_of_origin\",0],PARAMETER[\"central_meridian\",165],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 11,
-        "ng\",500000],PARAMETER[\"false_northing\",10000000],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 13,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2997\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2998, "epsg", 2998,
-        "NEA74 Noumea / UTM zone 58S", 0, 0,
-        "International 1924", "Greenwich",
-        "NEA74_Noumea", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-10.18,-3");
-    add_proj4text (p, 1,
-        "50.43,291.37,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NEA74 Noumea / UTM zone 58S\",GEOGCS[\"NEA74 No");
-    add_srs_wkt (p, 1,
-        "umea\",DATUM[\"NEA74_Noumea\",SPHEROID[\"International 1");
-    add_srs_wkt (p, 2,
-        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "-10.18,-350.43,291.37,0,0,0,0],AUTHORITY[\"EPSG\",\"6644");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"4644\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 8,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"central_meridian\",165],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2998\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2999, "epsg", 2999,
-        "Grand Comoros / UTM zone 38S", 0, 0,
-        "International 1924", "Greenwich",
-        "Grand_Comoros", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +south +ellps=intl +towgs84=-963,510,");
-    add_proj4text (p, 1,
-        "-359,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Grand Comoros / UTM zone 38S\",GEOGCS[\"Grand C");
-    add_srs_wkt (p, 1,
-        "omoros\",DATUM[\"Grand_Comoros\",SPHEROID[\"Internationa");
-    add_srs_wkt (p, 2,
-        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS");
-    add_srs_wkt (p, 3,
-        "84[-963,510,-359,0,0,0,0],AUTHORITY[\"EPSG\",\"6646\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4646\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"central_meridian\",45],PARAMETER[\"scale_factor\",0.99");
-    add_srs_wkt (p, 10,
-        "96],PARAMETER[\"false_easting\",500000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"2999\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3000, "epsg", 3000,
-        "Segara / NEIEZ", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Gunung_Segara", "Mercator_1SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=110 +k=0.997 +x_0=3900000 +y_0=900000 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=-403,684,41,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Segara / NEIEZ\",GEOGCS[\"Segara\",DATUM[\"Gunu");
-    add_srs_wkt (p, 1,
-        "ng_Segara\",SPHEROID[\"Bessel 1841\",6377397.155,299.152");
-    add_srs_wkt (p, 2,
-        "8128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[-403,684,41,0");
-    add_srs_wkt (p, 3,
-        ",0,0,0],AUTHORITY[\"EPSG\",\"6613\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 6,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4613\"]],PROJECTION[\"Mercator_1SP\"],PARAMETER[\"cen");
-    add_srs_wkt (p, 8,
-        "tral_meridian\",110],PARAMETER[\"scale_factor\",0.997],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",3900000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",900000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 11,
-        "001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"3000\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3001, "epsg", 3001,
-        "Batavia / NEIEZ", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Batavia", "Mercator_1SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=110 +k=0.997 +x_0=3900000 +y_0=900000 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=-377,681,-50,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Batavia / NEIEZ\",GEOGCS[\"Batavia\",DATUM[\"Ba");
-    add_srs_wkt (p, 1,
-        "tavia\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[-377,681,-50,0,0,");
-    add_srs_wkt (p, 3,
-        "0,0],AUTHORITY[\"EPSG\",\"6211\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4211\"]],PROJECTION[\"Mercator_1SP\"],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",110],PARAMETER[\"scale_factor\",0.997],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",3900000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",900000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"3001\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3002, "epsg", 3002,
-        "Makassar / NEIEZ", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Makassar", "Mercator_1SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=110 +k=0.997 +x_0=3900000 +y_0=900000 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=-587.8,519.75,145.76,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Makassar / NEIEZ\",GEOGCS[\"Makassar\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Makassar\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528");
-    add_srs_wkt (p, 2,
-        "128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[-587.8,519.75,");
-    add_srs_wkt (p, 3,
-        "145.76,0,0,0,0],AUTHORITY[\"EPSG\",\"6257\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"4257\"]],PROJECTION[\"Mercator_1SP\"],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",110],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 9,
-        "0.997],PARAMETER[\"false_easting\",3900000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",900000],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3002\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3003, "epsg", 3003,
-        "Monte Mario / Italy zone 1", 0, 0,
-        "International 1924", "Greenwich",
-        "Monte_Mario", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=0.9996 +x_0=1500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=intl +towgs84=-104.1,-49.1,-9.9,0.971,-2.917,");
-    add_proj4text (p, 2,
-        "0.714,-11.68 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Monte Mario / Italy zone 1\",GEOGCS[\"Monte Mar");
-    add_srs_wkt (p, 1,
-        "io\",DATUM[\"Monte_Mario\",SPHEROID[\"International 1924");
-    add_srs_wkt (p, 2,
-        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-10");
-    add_srs_wkt (p, 3,
-        "4.1,-49.1,-9.9,0.971,-2.917,0.714,-11.68],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"6265\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4265\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 9,
-        ",0],PARAMETER[\"central_meridian\",9],PARAMETER[\"scale_");
-    add_srs_wkt (p, 10,
-        "factor\",0.9996],PARAMETER[\"false_easting\",1500000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"3003\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3004, "epsg", 3004,
-        "Monte Mario / Italy zone 2", 0, 0,
-        "International 1924", "Greenwich",
-        "Monte_Mario", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9996 +x_0=2520000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=intl +towgs84=-104.1,-49.1,-9.9,0.971,-2.917");
-    add_proj4text (p, 2,
-        ",0.714,-11.68 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Monte Mario / Italy zone 2\",GEOGCS[\"Monte Mar");
-    add_srs_wkt (p, 1,
-        "io\",DATUM[\"Monte_Mario\",SPHEROID[\"International 1924");
-    add_srs_wkt (p, 2,
-        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-10");
-    add_srs_wkt (p, 3,
-        "4.1,-49.1,-9.9,0.971,-2.917,0.714,-11.68],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"6265\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4265\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 9,
-        ",0],PARAMETER[\"central_meridian\",15],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",2520000],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"3004\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3005, "epsg", 3005,
-        "NAD83 / BC Albers", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=50 +lat_2=58.5 +lat_0=45 +lon_0=-126 +x");
-    add_proj4text (p, 1,
-        "_0=1000000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BC Albers\",GEOGCS[\"NAD83\",DATUM[\"No");
-    add_srs_wkt (p, 1,
-        "rth_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378137,");
-    add_srs_wkt (p, 2,
-        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 6,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"4269\"]],PROJECTION[\"Albers_Conic_Equal_Area\"],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"standard_parallel_1\",50],PARAMETER[\"standar");
-    add_srs_wkt (p, 9,
-        "d_parallel_2\",58.5],PARAMETER[\"latitude_of_center\",45");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"longitude_of_center\",-126],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",1000000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3005\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3006, "epsg", 3006,
-        "SWEREF99 TM", 0, 1,
-        "GRS 1980", "Greenwich",
-        "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 TM\",GEOGCS[\"SWEREF99\",DATUM[\"SWERE");
-    add_srs_wkt (p, 1,
-        "F99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4619\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",0],PARAMETER[\"central_meridian\",15],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"scale_factor\",0.9996],PARAMETER[\"false_easting\",500");
-    add_srs_wkt (p, 10,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3006\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3007, "epsg", 3007,
-        "SWEREF99 12 00", 0, 1,
-        "GRS 1980", "Greenwich",
-        "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=1 +x_0=150000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 12 00\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4619\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",0],PARAMETER[\"central_meridian\",12],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",15000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 11,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3007\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3008, "epsg", 3008,
-        "SWEREF99 13 30", 0, 1,
-        "GRS 1980", "Greenwich",
-        "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13.5 +k=1 +x_0=150000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 13 30\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4619\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",0],PARAMETER[\"central_meridian\",13.5],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",150");
-    add_srs_wkt (p, 10,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3008\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3009, "epsg", 3009,
-        "SWEREF99 15 00", 0, 1,
-        "GRS 1980", "Greenwich",
-        "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=150000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 15 00\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4619\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",0],PARAMETER[\"central_meridian\",15],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",15000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 11,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3009\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3010, "epsg", 3010,
-        "SWEREF99 16 30", 0, 1,
-        "GRS 1980", "Greenwich",
-        "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=16.5 +k=1 +x_0=150000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 16 30\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4619\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",0],PARAMETER[\"central_meridian\",16.5],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",150");
-    add_srs_wkt (p, 10,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3010\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3011, "epsg", 3011,
-        "SWEREF99 18 00", 0, 1,
-        "GRS 1980", "Greenwich",
-        "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=150000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 18 00\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4619\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",0],PARAMETER[\"central_meridian\",18],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",15000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 11,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3011\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3012, "epsg", 3012,
-        "SWEREF99 14 15", 0, 1,
-        "GRS 1980", "Greenwich",
-        "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=14.25 +k=1 +x_0=150000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 14 15\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4619\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",0],PARAMETER[\"central_meridian\",14.25],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3012\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3013, "epsg", 3013,
-        "SWEREF99 15 45", 0, 1,
-        "GRS 1980", "Greenwich",
-        "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15.75 +k=1 +x_0=150000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 15 45\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4619\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",0],PARAMETER[\"central_meridian\",15.75],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3013\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3014, "epsg", 3014,
-        "SWEREF99 17 15", 0, 1,
-        "GRS 1980", "Greenwich",
-        "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=17.25 +k=1 +x_0=150000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 17 15\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4619\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",0],PARAMETER[\"central_meridian\",17.25],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3014\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3015, "epsg", 3015,
-        "SWEREF99 18 45", 0, 1,
-        "GRS 1980", "Greenwich",
-        "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18.75 +k=1 +x_0=150000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 18 45\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4619\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",0],PARAMETER[\"central_meridian\",18.75],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3015\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3016, "epsg", 3016,
-        "SWEREF99 20 15", 0, 1,
-        "GRS 1980", "Greenwich",
-        "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=20.25 +k=1 +x_0=150000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 20 15\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4619\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",0],PARAMETER[\"central_meridian\",20.25],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3016\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3017, "epsg", 3017,
-        "SWEREF99 21 45", 0, 1,
-        "GRS 1980", "Greenwich",
-        "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21.75 +k=1 +x_0=150000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 21 45\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4619\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",0],PARAMETER[\"central_meridian\",21.75],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3017\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3018, "epsg", 3018,
-        "SWEREF99 23 15", 0, 1,
-        "GRS 1980", "Greenwich",
-        "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=23.25 +k=1 +x_0=150000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 23 15\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4619\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",0],PARAMETER[\"central_meridian\",23.25],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3018\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3019, "epsg", 3019,
-        "RT90 7.5 gon V", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Rikets_koordinatsystem_1990", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=11.30827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-");
-    add_proj4text (p, 2,
-        "0.855,2.141,-7.023,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT90 7.5 gon V\",GEOGCS[\"RT90\",DATUM[\"Rikets");
-    add_srs_wkt (p, 1,
-        "_koordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397");
-    add_srs_wkt (p, 2,
-        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[4");
-    add_srs_wkt (p, 3,
-        "14.1,41.3,603.1,-0.855,2.141,-7.023,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4124\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",11.30827777777778],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"3019\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3020, "epsg", 3020,
-        "RT90 5 gon V", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Rikets_koordinatsystem_1990", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13.55827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-");
-    add_proj4text (p, 2,
-        "0.855,2.141,-7.023,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT90 5 gon V\",GEOGCS[\"RT90\",DATUM[\"Rikets_k");
-    add_srs_wkt (p, 1,
-        "oordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397.1");
-    add_srs_wkt (p, 2,
-        "55,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[414");
-    add_srs_wkt (p, 3,
-        ".1,41.3,603.1,-0.855,2.141,-7.023,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4124\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"central_meridian\",13.55827777777778],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",150");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"3020\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3021, "epsg", 3021,
-        "RT90 2.5 gon V", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Rikets_koordinatsystem_1990", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15.80827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-");
-    add_proj4text (p, 2,
-        "0.855,2.141,-7.023,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT90 2.5 gon V\",GEOGCS[\"RT90\",DATUM[\"Rikets");
-    add_srs_wkt (p, 1,
-        "_koordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397");
-    add_srs_wkt (p, 2,
-        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[4");
-    add_srs_wkt (p, 3,
-        "14.1,41.3,603.1,-0.855,2.141,-7.023,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4124\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",15.80827777777778],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"3021\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3022, "epsg", 3022,
-        "RT90 0 gon", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Rikets_koordinatsystem_1990", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18.05827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-");
-    add_proj4text (p, 2,
-        "0.855,2.141,-7.023,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT90 0 gon\",GEOGCS[\"RT90\",DATUM[\"Rikets_koo");
-    add_srs_wkt (p, 1,
-        "rdinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397.155");
-    add_srs_wkt (p, 2,
-        ",299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[414.1");
-    add_srs_wkt (p, 3,
-        ",41.3,603.1,-0.855,2.141,-7.023,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4124\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",18.05827777777778],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",15000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"3022\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3023, "epsg", 3023,
-        "RT90 2.5 gon O", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Rikets_koordinatsystem_1990", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=20.30827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-");
-    add_proj4text (p, 2,
-        "0.855,2.141,-7.023,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT90 2.5 gon O\",GEOGCS[\"RT90\",DATUM[\"Rikets");
-    add_srs_wkt (p, 1,
-        "_koordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397");
-    add_srs_wkt (p, 2,
-        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[4");
-    add_srs_wkt (p, 3,
-        "14.1,41.3,603.1,-0.855,2.141,-7.023,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4124\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",20.30827777777778],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"3023\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3024, "epsg", 3024,
-        "RT90 5 gon O", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Rikets_koordinatsystem_1990", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=22.55827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-");
-    add_proj4text (p, 2,
-        "0.855,2.141,-7.023,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT90 5 gon O\",GEOGCS[\"RT90\",DATUM[\"Rikets_k");
-    add_srs_wkt (p, 1,
-        "oordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397.1");
-    add_srs_wkt (p, 2,
-        "55,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[414");
-    add_srs_wkt (p, 3,
-        ".1,41.3,603.1,-0.855,2.141,-7.023,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4124\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"central_meridian\",22.55827777777778],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",150");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AUTHORITY[\"EPSG\",\"3024\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3025, "epsg", 3025,
-        "RT38 7.5 gon V", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Stockholm_1938", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=11.30827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT38 7.5 gon V\",GEOGCS[\"RT38\",DATUM[\"Stockh");
-    add_srs_wkt (p, 1,
-        "olm_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528");
-    add_srs_wkt (p, 2,
-        "128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "308\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 6,
-        ",EAST],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",11.30827777777778],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",1500000");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AUTHORITY[\"EPSG\",\"3025\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3026, "epsg", 3026,
-        "RT38 5 gon V", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Stockholm_1938", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13.55827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT38 5 gon V\",GEOGCS[\"RT38\",DATUM[\"Stockhol");
-    add_srs_wkt (p, 1,
-        "m_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.152812");
-    add_srs_wkt (p, 2,
-        "8,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"630");
-    add_srs_wkt (p, 3,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",13.55827777777778],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"scale_factor\",1],PARAMETER[\"false_easting\",1500000]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 11,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AUTHORITY[\"EPSG\",\"3026\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3027, "epsg", 3027,
-        "RT38 2.5 gon V", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Stockholm_1938", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15.80827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT38 2.5 gon V\",GEOGCS[\"RT38\",DATUM[\"Stockh");
-    add_srs_wkt (p, 1,
-        "olm_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528");
-    add_srs_wkt (p, 2,
-        "128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "308\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 6,
-        ",EAST],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",15.80827777777778],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",1500000");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AUTHORITY[\"EPSG\",\"3027\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3028, "epsg", 3028,
-        "RT38 0 gon", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Stockholm_1938", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18.05827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT38 0 gon\",GEOGCS[\"RT38\",DATUM[\"Stockholm_");
-    add_srs_wkt (p, 1,
-        "1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6308\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 6,
-        "T],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",18.05827777777778],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",1],PARAMETER[\"false_easting\",1500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"3028\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3029, "epsg", 3029,
-        "RT38 2.5 gon O", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Stockholm_1938", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=20.30827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT38 2.5 gon O\",GEOGCS[\"RT38\",DATUM[\"Stockh");
-    add_srs_wkt (p, 1,
-        "olm_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528");
-    add_srs_wkt (p, 2,
-        "128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "308\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 6,
-        ",EAST],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",20.30827777777778],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",1500000");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AUTHORITY[\"EPSG\",\"3029\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3030, "epsg", 3030,
-        "RT38 5 gon O", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Stockholm_1938", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=22.55827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT38 5 gon O\",GEOGCS[\"RT38\",DATUM[\"Stockhol");
-    add_srs_wkt (p, 1,
-        "m_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.152812");
-    add_srs_wkt (p, 2,
-        "8,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"630");
-    add_srs_wkt (p, 3,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",22.55827777777778],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"scale_factor\",1],PARAMETER[\"false_easting\",1500000]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 11,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AUTHORITY[\"EPSG\",\"3030\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3031, "epsg", 3031,
-        "WGS 84 / Antarctic Polar Stereographic", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-71 +lon_0=0 +k=1 +x_0=0 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Antarctic Polar Stereographic\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",63781");
-    add_srs_wkt (p, 2,
-        "37,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4326\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Polar_Stereographic\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",-71],PARAMETER[\"central_meridian\",0],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3031\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3032, "epsg", 3032,
-        "WGS 84 / Australian Antarctic Polar Stereographic", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-71 +lon_0=70 +k=1 +x_0=6");
-    add_proj4text (p, 1,
-        "000000 +y_0=6000000 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Australian Antarctic Polar Stereograph");
-    add_srs_wkt (p, 1,
-        "ic\",GEOGCS[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS");
-    add_srs_wkt (p, 2,
-        " 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 6,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"432");
-    add_srs_wkt (p, 7,
-        "6\"]],PROJECTION[\"Polar_Stereographic\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",-71],PARAMETER[\"central_meridian\",7");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",6000000],PARAMETER[\"false_northing\",6000000],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 12,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "3032\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3033, "epsg", 3033,
-        "WGS 84 / Australian Antarctic Lambert", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.5 +lat_2=-74.5 +lat_0=-50 +lon_0=70");
-    add_proj4text (p, 1,
-        " +x_0=6000000 +y_0=6000000 +datum=WGS84 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Australian Antarctic Lambert\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[");
-    add_srs_wkt (p, 6,
-        "\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4326\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standa");
-    add_srs_wkt (p, 8,
-        "rd_parallel_1\",-68.5],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 9,
-        ",-74.5],PARAMETER[\"latitude_of_origin\",-50],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"central_meridian\",70],PARAMETER[\"false_easting\",600");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",6000000],UNIT[\"metre");
-    add_srs_wkt (p, 12,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3033\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3034, "epsg", 3034,
-        "ETRS89 / LCC Europe", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35 +lat_2=65 +lat_0=52 +lon_0=10 +x_0=4");
-    add_proj4text (p, 1,
-        "000000 +y_0=2800000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / LCC Europe\",GEOGCS[\"ETRS89\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Terrestrial_Reference_System_1989\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6258\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",3");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"standard_parallel_2\",65],PARAMETER[\"lat");
-    add_srs_wkt (p, 10,
-        "itude_of_origin\",52],PARAMETER[\"central_meridian\",10]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_easting\",4000000],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "northing\",2800000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 14,
-        "T],AUTHORITY[\"EPSG\",\"3034\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3035, "epsg", 3035,
-        "ETRS89 / LAEA Europe", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Lambert_Azimuthal_Equal_Area", "metre",
-        "Y", "North", "X", "East");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=52 +lon_0=10 +x_0=4321000 +y_0=3210000");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / LAEA Europe\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 8,
-        "_Azimuthal_Equal_Area\"],PARAMETER[\"latitude_of_center\"");
-    add_srs_wkt (p, 9,
-        ",52],PARAMETER[\"longitude_of_center\",10],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",4321000],PARAMETER[\"false_northing\",321");
-    add_srs_wkt (p, 11,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Y\",NORTH],AXIS[\"X\",EAST],AUTHORITY[\"EPSG\",\"303");
-    add_srs_wkt (p, 13,
-        "5\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
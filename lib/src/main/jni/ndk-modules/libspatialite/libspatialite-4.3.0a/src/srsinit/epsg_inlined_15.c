@@ -1,4325 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_15 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 3548, "epsg", 3548,
-        "NAD83(NSRS2007) / Kentucky South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000 +");
-    add_proj4text (p, 2,
-        "y_0=500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 3,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Kentucky South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",37.93333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",36.73333333333333],PARAMETER[\"lat");
-    add_srs_wkt (p, 11,
-        "itude_of_origin\",36.33333333333334],PARAMETER[\"central");
-    add_srs_wkt (p, 12,
-        "_meridian\",-85.75],PARAMETER[\"false_easting\",500000],");
-    add_srs_wkt (p, 13,
-        "PARAMETER[\"false_northing\",500000],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 14,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",");
-    add_srs_wkt (p, 15,
-        "NORTH],AUTHORITY[\"EPSG\",\"3548\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3549, "epsg", 3549,
-        "NAD83(NSRS2007) / Kentucky South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001016001 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Kentucky South (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",37.93333333333333],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",36.73333333333333],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"latitude_of_origin\",36.33333333333334],PARAMETER[\"c");
-    add_srs_wkt (p, 12,
-        "entral_meridian\",-85.75],PARAMETER[\"false_easting\",16");
-    add_srs_wkt (p, 13,
-        "40416.667],PARAMETER[\"false_northing\",1640416.667],UNI");
-    add_srs_wkt (p, 14,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 15,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 16,
-        "TY[\"EPSG\",\"3549\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3550, "epsg", 3550,
-        "NAD83(NSRS2007) / Louisiana North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=1000000 +y_0=0 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Louisiana North\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 6,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 7,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",32.66666666666666],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",31.16666666666667],PARAMETER[\"lat");
-    add_srs_wkt (p, 11,
-        "itude_of_origin\",30.5],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 12,
-        "92.5],PARAMETER[\"false_easting\",1000000],PARAMETER[\"f");
-    add_srs_wkt (p, 13,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 15,
-        "EPSG\",\"3550\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3551, "epsg", 3551,
-        "NAD83(NSRS2007) / Louisiana North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=999999.9999898402 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Louisiana North (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,");
-    add_srs_wkt (p, 4,
-        "0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",32.66666666666666],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",31.16666666666667],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"latitude_of_origin\",30.5],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 12,
-        "an\",-92.5],PARAMETER[\"false_easting\",3280833.33330000");
-    add_srs_wkt (p, 13,
-        "1],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot");
-    add_srs_wkt (p, 14,
-        "\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS");
-    add_srs_wkt (p, 15,
-        "[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3551");
-    add_srs_wkt (p, 16,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3552, "epsg", 3552,
-        "NAD83(NSRS2007) / Louisiana South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91");
-    add_proj4text (p, 1,
-        ".33333333333333 +x_0=1000000 +y_0=0 +ellps=GRS80 +towgs8");
-    add_proj4text (p, 2,
-        "4=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Louisiana South\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 6,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 7,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",30.7],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 10,
-        "llel_2\",29.3],PARAMETER[\"latitude_of_origin\",28.5],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"central_meridian\",-91.33333333333333],PARAMET");
-    add_srs_wkt (p, 12,
-        "ER[\"false_easting\",1000000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 13,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"355");
-    add_srs_wkt (p, 15,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3553, "epsg", 3553,
-        "NAD83(NSRS2007) / Louisiana South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91");
-    add_proj4text (p, 1,
-        ".33333333333333 +x_0=999999.9999898402 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Louisiana South (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,");
-    add_srs_wkt (p, 4,
-        "0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",30.7],PARAMETER[\"standar");
-    add_srs_wkt (p, 10,
-        "d_parallel_2\",29.3],PARAMETER[\"latitude_of_origin\",28");
-    add_srs_wkt (p, 11,
-        ".5],PARAMETER[\"central_meridian\",-91.33333333333333],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_easting\",3280833.333300001],PARAMETER[");
-    add_srs_wkt (p, 13,
-        "\"false_northing\",0],UNIT[\"US survey foot\",0.30480060");
-    add_srs_wkt (p, 14,
-        "96012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],");
-    add_srs_wkt (p, 15,
-        "AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3553\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3554, "epsg", 3554,
-        "NAD83(NSRS2007) / Maine CS2000 Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.5 +lon_0=-69.125 +k=0.99998 +x_0=5");
-    add_proj4text (p, 1,
-        "00000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Maine CS2000 Central\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,");
-    add_srs_wkt (p, 4,
-        "0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 5,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 6,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 7,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "latitude_of_origin\",43.5],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 10,
-        ",-69.125],PARAMETER[\"scale_factor\",0.99998],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 12,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3554\"]");
-    add_srs_wkt (p, 14,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3555, "epsg", 3555,
-        "NAD83(NSRS2007) / Maine CS2000 East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.83333333333334 +lon_0=-67.875 +k=0");
-    add_proj4text (p, 1,
-        ".99998 +x_0=700000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Maine CS2000 East\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 8,
-        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 9,
-        "titude_of_origin\",43.83333333333334],PARAMETER[\"centra");
-    add_srs_wkt (p, 10,
-        "l_meridian\",-67.875],PARAMETER[\"scale_factor\",0.99998");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",700000],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 13,
-        "\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"3555\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3556, "epsg", 3556,
-        "NAD83(NSRS2007) / Maine CS2000 West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.375 +k=0");
-    add_proj4text (p, 1,
-        ".99998 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Maine CS2000 West\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 8,
-        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 9,
-        "titude_of_origin\",42.83333333333334],PARAMETER[\"centra");
-    add_srs_wkt (p, 10,
-        "l_meridian\",-70.375],PARAMETER[\"scale_factor\",0.99998");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",300000],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 13,
-        "\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"3556\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3557, "epsg", 3557,
-        "NAD83(NSRS2007) / Maine East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.66666666666666 +lon_0=-68.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Maine East\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",43.66666666666666],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 10,
-        "ian\",-68.5],PARAMETER[\"scale_factor\",0.9999],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_easting\",300000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3557\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3558, "epsg", 3558,
-        "NAD83(NSRS2007) / Maine West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999966667 +x_0=900000 +y_0=0 +ellps=GRS80 +t");
-    add_proj4text (p, 2,
-        "owgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Maine West\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",42.83333333333334],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 10,
-        "ian\",-70.16666666666667],PARAMETER[\"scale_factor\",0.9");
-    add_srs_wkt (p, 11,
-        "99966667],PARAMETER[\"false_easting\",900000],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"3558\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3559, "epsg", 3559,
-        "NAD83(NSRS2007) / Maryland", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666");
-    add_proj4text (p, 1,
-        "666 +lon_0=-77 +x_0=400000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Maryland\",GEOGCS[\"NAD83(NSR");
-    add_srs_wkt (p, 1,
-        "S2007)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 6,
-        "UTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AX");
-    add_srs_wkt (p, 7,
-        "IS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]],PRO");
-    add_srs_wkt (p, 8,
-        "JECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"sta");
-    add_srs_wkt (p, 9,
-        "ndard_parallel_1\",39.45],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",38.3],PARAMETER[\"latitude_of_origin\",37.6666666666");
-    add_srs_wkt (p, 11,
-        "6666],PARAMETER[\"central_meridian\",-77],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_easting\",400000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 13,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 14,
-        "EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3559\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3560, "epsg", 3560,
-        "NAD83 / Utah North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "0001016 +y_0=999999.9999898402 +ellps=GRS80 +towgs84=0,0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Utah North (ftUS)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWG");
-    add_srs_wkt (p, 3,
-        "S84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Co");
-    add_srs_wkt (p, 8,
-        "nic_2SP\"],PARAMETER[\"standard_parallel_1\",41.78333333");
-    add_srs_wkt (p, 9,
-        "333333],PARAMETER[\"standard_parallel_2\",40.71666666666");
-    add_srs_wkt (p, 10,
-        "667],PARAMETER[\"latitude_of_origin\",40.33333333333334]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"central_meridian\",-111.5],PARAMETER[\"fals");
-    add_srs_wkt (p, 12,
-        "e_easting\",1640416.6667],PARAMETER[\"false_northing\",3");
-    add_srs_wkt (p, 13,
-        "280833.333300001],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 14,
-        "2192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS");
-    add_srs_wkt (p, 15,
-        "[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3560\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3561, "epsg", 3561,
-        "Old Hawaiian / Hawaii zone 1", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "Old_Hawaiian", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=18.83333333333333 +lon_0=-155.5 +k=0.");
-    add_proj4text (p, 1,
-        "999966667 +x_0=152400.3048006096 +y_0=0 +ellps=clrk66 +t");
-    add_proj4text (p, 2,
-        "owgs84=61,-285,-181,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Old Hawaiian / Hawaii zone 1\",GEOGCS[\"Old Haw");
-    add_srs_wkt (p, 1,
-        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[61,-285,-181,0,0,0,0],AUTHORITY[\"EPSG\",\"613");
-    add_srs_wkt (p, 4,
-        "5\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4135\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",18.8333");
-    add_srs_wkt (p, 9,
-        "3333333333],PARAMETER[\"central_meridian\",-155.5],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"scale_factor\",0.999966667],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"US");
-    add_srs_wkt (p, 12,
-        " survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 13,
-        "003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 14,
-        "PSG\",\"3561\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3562, "epsg", 3562,
-        "Old Hawaiian / Hawaii zone 2", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "Old_Hawaiian", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=20.33333333333333 +lon_0=-156.6666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999966667 +x_0=152400.3048006096 +y_0=0 +ell");
-    add_proj4text (p, 2,
-        "ps=clrk66 +towgs84=61,-285,-181,0,0,0,0 +units=us-ft +no");
-    add_proj4text (p, 3,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Old Hawaiian / Hawaii zone 2\",GEOGCS[\"Old Haw");
-    add_srs_wkt (p, 1,
-        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[61,-285,-181,0,0,0,0],AUTHORITY[\"EPSG\",\"613");
-    add_srs_wkt (p, 4,
-        "5\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4135\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",20.3333");
-    add_srs_wkt (p, 9,
-        "3333333333],PARAMETER[\"central_meridian\",-156.66666666");
-    add_srs_wkt (p, 10,
-        "66667],PARAMETER[\"scale_factor\",0.999966667],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 12,
-        "0],UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],A");
-    add_srs_wkt (p, 14,
-        "UTHORITY[\"EPSG\",\"3562\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3563, "epsg", 3563,
-        "Old Hawaiian / Hawaii zone 3", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "Old_Hawaiian", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.16666666666667 +lon_0=-158 +k=0.99");
-    add_proj4text (p, 1,
-        "999 +x_0=152400.3048006096 +y_0=0 +ellps=clrk66 +towgs84");
-    add_proj4text (p, 2,
-        "=61,-285,-181,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Old Hawaiian / Hawaii zone 3\",GEOGCS[\"Old Haw");
-    add_srs_wkt (p, 1,
-        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[61,-285,-181,0,0,0,0],AUTHORITY[\"EPSG\",\"613");
-    add_srs_wkt (p, 4,
-        "5\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4135\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",21.1666");
-    add_srs_wkt (p, 9,
-        "6666666667],PARAMETER[\"central_meridian\",-158],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"scale_factor\",0.99999],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"US surve");
-    add_srs_wkt (p, 12,
-        "y foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 14,
-        "\"3563\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3564, "epsg", 3564,
-        "Old Hawaiian / Hawaii zone 4", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "Old_Hawaiian", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.83333333333333 +lon_0=-159.5 +k=0.");
-    add_proj4text (p, 1,
-        "99999 +x_0=152400.3048006096 +y_0=0 +ellps=clrk66 +towgs");
-    add_proj4text (p, 2,
-        "84=61,-285,-181,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Old Hawaiian / Hawaii zone 4\",GEOGCS[\"Old Haw");
-    add_srs_wkt (p, 1,
-        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[61,-285,-181,0,0,0,0],AUTHORITY[\"EPSG\",\"613");
-    add_srs_wkt (p, 4,
-        "5\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4135\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",21.8333");
-    add_srs_wkt (p, 9,
-        "3333333333],PARAMETER[\"central_meridian\",-159.5],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"scale_factor\",0.99999],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 11,
-        "\",500000],PARAMETER[\"false_northing\",0],UNIT[\"US sur");
-    add_srs_wkt (p, 12,
-        "vey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3564\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3565, "epsg", 3565,
-        "Old Hawaiian / Hawaii zone 5", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "Old_Hawaiian", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.66666666666667 +lon_0=-160.1666666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=152400.3048006096 +y_0=0 +ellps=clrk66 ");
-    add_proj4text (p, 2,
-        "+towgs84=61,-285,-181,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Old Hawaiian / Hawaii zone 5\",GEOGCS[\"Old Haw");
-    add_srs_wkt (p, 1,
-        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[61,-285,-181,0,0,0,0],AUTHORITY[\"EPSG\",\"613");
-    add_srs_wkt (p, 4,
-        "5\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4135\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",21.6666");
-    add_srs_wkt (p, 9,
-        "6666666667],PARAMETER[\"central_meridian\",-160.16666666");
-    add_srs_wkt (p, 10,
-        "66667],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e");
-    add_srs_wkt (p, 11,
-        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"3565\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3566, "epsg", 3566,
-        "NAD83 / Utah Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000.00001016 +y_0");
-    add_proj4text (p, 2,
-        "=2000000.00001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 3,
-        "nits=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Utah Central (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 8,
-        "onic_2SP\"],PARAMETER[\"standard_parallel_1\",40.65],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_2\",39.01666666666667],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"latitude_of_origin\",38.33333333333334],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"central_meridian\",-111.5],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 12,
-        ",1640416.6667],PARAMETER[\"false_northing\",6561666.6667");
-    add_srs_wkt (p, 13,
-        "00001],UNIT[\"US survey foot\",0.3048006096012192,AUTHOR");
-    add_srs_wkt (p, 14,
-        "ITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORT");
-    add_srs_wkt (p, 15,
-        "H],AUTHORITY[\"EPSG\",\"3566\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3567, "epsg", 3567,
-        "NAD83 / Utah South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000.00001016 +y_0");
-    add_proj4text (p, 2,
-        "=3000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Utah South (ftUS)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWG");
-    add_srs_wkt (p, 3,
-        "S84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Co");
-    add_srs_wkt (p, 8,
-        "nic_2SP\"],PARAMETER[\"standard_parallel_1\",38.35],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_2\",37.21666666666667],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"latitude_of_origin\",36.66666666666666],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "central_meridian\",-111.5],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 12,
-        "640416.6667],PARAMETER[\"false_northing\",9842500.000000");
-    add_srs_wkt (p, 13,
-        "002],UNIT[\"US survey foot\",0.3048006096012192,AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH]");
-    add_srs_wkt (p, 15,
-        ",AUTHORITY[\"EPSG\",\"3567\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3568, "epsg", 3568,
-        "NAD83(HARN) / Utah North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "0001016 +y_0=999999.9999898402 +ellps=GRS80 +towgs84=0,0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Utah North (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",41.78333333333333],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",40.71666666666667],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 11,
-        "n\",40.33333333333334],PARAMETER[\"central_meridian\",-1");
-    add_srs_wkt (p, 12,
-        "11.5],PARAMETER[\"false_easting\",1640416.6667],PARAMETE");
-    add_srs_wkt (p, 13,
-        "R[\"false_northing\",3280833.333300001],UNIT[\"US survey");
-    add_srs_wkt (p, 14,
-        " foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]]");
-    add_srs_wkt (p, 15,
-        ",AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 16,
-        "3568\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3569, "epsg", 3569,
-        "NAD83(HARN) / Utah Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000.00001016 +y_0");
-    add_proj4text (p, 2,
-        "=2000000.00001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 3,
-        "nits=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Utah Central (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard");
-    add_srs_wkt (p, 9,
-        "_parallel_1\",40.65],PARAMETER[\"standard_parallel_2\",3");
-    add_srs_wkt (p, 10,
-        "9.01666666666667],PARAMETER[\"latitude_of_origin\",38.33");
-    add_srs_wkt (p, 11,
-        "333333333334],PARAMETER[\"central_meridian\",-111.5],PAR");
-    add_srs_wkt (p, 12,
-        "AMETER[\"false_easting\",1640416.6667],PARAMETER[\"false");
-    add_srs_wkt (p, 13,
-        "_northing\",6561666.666700001],UNIT[\"US survey foot\",0");
-    add_srs_wkt (p, 14,
-        ".3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X");
-    add_srs_wkt (p, 15,
-        "\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3569\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3570, "epsg", 3570,
-        "NAD83(HARN) / Utah South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000.00001016 +y_0");
-    add_proj4text (p, 2,
-        "=3000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Utah South (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",38.35],PARAMETER[\"standard_parallel_2\",37.2");
-    add_srs_wkt (p, 10,
-        "1666666666667],PARAMETER[\"latitude_of_origin\",36.66666");
-    add_srs_wkt (p, 11,
-        "666666666],PARAMETER[\"central_meridian\",-111.5],PARAME");
-    add_srs_wkt (p, 12,
-        "TER[\"false_easting\",1640416.6667],PARAMETER[\"false_no");
-    add_srs_wkt (p, 13,
-        "rthing\",9842500.000000002],UNIT[\"US survey foot\",0.30");
-    add_srs_wkt (p, 14,
-        "48006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 15,
-        "EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3570\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3571, "epsg", 3571,
-        "WGS 84 / North Pole LAEA Bering Sea", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=90 +lon_0=180 +x_0=0 +y_0=0 +datum=WGS");
-    add_proj4text (p, 1,
-        "84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / North Pole LAEA Bering Sea\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,");
-    add_srs_wkt (p, 2,
-        "298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 8,
-        "e_of_center\",90],PARAMETER[\"longitude_of_center\",180]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",0],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 11,
-        "XIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "571\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3572, "epsg", 3572,
-        "WGS 84 / North Pole LAEA Alaska", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=90 +lon_0=-150 +x_0=0 +y_0=0 +datum=WG");
-    add_proj4text (p, 1,
-        "S84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / North Pole LAEA Alaska\",GEOGCS[\"WGS ");
-    add_srs_wkt (p, 1,
-        "84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.");
-    add_srs_wkt (p, 2,
-        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 6,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"latitude_of_");
-    add_srs_wkt (p, 8,
-        "center\",90],PARAMETER[\"longitude_of_center\",-150],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3572\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3573, "epsg", 3573,
-        "WGS 84 / North Pole LAEA Canada", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=90 +lon_0=-100 +x_0=0 +y_0=0 +datum=WG");
-    add_proj4text (p, 1,
-        "S84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / North Pole LAEA Canada\",GEOGCS[\"WGS ");
-    add_srs_wkt (p, 1,
-        "84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.");
-    add_srs_wkt (p, 2,
-        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 6,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"latitude_of_");
-    add_srs_wkt (p, 8,
-        "center\",90],PARAMETER[\"longitude_of_center\",-100],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3573\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3574, "epsg", 3574,
-        "WGS 84 / North Pole LAEA Atlantic", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=90 +lon_0=-40 +x_0=0 +y_0=0 +datum=WGS");
-    add_proj4text (p, 1,
-        "84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / North Pole LAEA Atlantic\",GEOGCS[\"WG");
-    add_srs_wkt (p, 1,
-        "S 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,29");
-    add_srs_wkt (p, 2,
-        "8.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 6,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_center\",90],PARAMETER[\"longitude_of_center\",-40],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3574\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3575, "epsg", 3575,
-        "WGS 84 / North Pole LAEA Europe", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=90 +lon_0=10 +x_0=0 +y_0=0 +datum=WGS8");
-    add_proj4text (p, 1,
-        "4 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / North Pole LAEA Europe\",GEOGCS[\"WGS ");
-    add_srs_wkt (p, 1,
-        "84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.");
-    add_srs_wkt (p, 2,
-        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 6,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"latitude_of_");
-    add_srs_wkt (p, 8,
-        "center\",90],PARAMETER[\"longitude_of_center\",10],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_easting\",0],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3575\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3576, "epsg", 3576,
-        "WGS 84 / North Pole LAEA Russia", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=90 +lon_0=90 +x_0=0 +y_0=0 +datum=WGS8");
-    add_proj4text (p, 1,
-        "4 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / North Pole LAEA Russia\",GEOGCS[\"WGS ");
-    add_srs_wkt (p, 1,
-        "84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.");
-    add_srs_wkt (p, 2,
-        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 6,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"latitude_of_");
-    add_srs_wkt (p, 8,
-        "center\",90],PARAMETER[\"longitude_of_center\",90],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_easting\",0],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3576\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3577, "epsg", 3577,
-        "GDA94 / Australian Albers", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Geocentric_Datum_of_Australia_1994", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=-18 +lat_2=-36 +lat_0=0 +lon_0=132 +x_0");
-    add_proj4text (p, 1,
-        "=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDA94 / Australian Albers\",GEOGCS[\"GDA94\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Geocentric_Datum_of_Australia_1994\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6283\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4283\"]],PROJECTION[\"Albers_Coni");
-    add_srs_wkt (p, 8,
-        "c_Equal_Area\"],PARAMETER[\"standard_parallel_1\",-18],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_2\",-36],PARAMETER[\"latitu");
-    add_srs_wkt (p, 10,
-        "de_of_center\",0],PARAMETER[\"longitude_of_center\",132]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_easting\",0],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"3577\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3578, "epsg", 3578,
-        "NAD83 / Yukon Albers", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=61.66666666666666 +lat_2=68 +lat_0=59 +");
-    add_proj4text (p, 1,
-        "lon_0=-132.5 +x_0=500000 +y_0=500000 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Yukon Albers\",GEOGCS[\"NAD83\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4269\"]],PROJECTION[\"Albers_Conic_Equal_Area\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"standard_parallel_1\",61.66666666666666],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_2\",68],PARAMETER[\"latitude");
-    add_srs_wkt (p, 10,
-        "_of_center\",59],PARAMETER[\"longitude_of_center\",-132.");
-    add_srs_wkt (p, 11,
-        "5],PARAMETER[\"false_easting\",500000],PARAMETER[\"false");
-    add_srs_wkt (p, 12,
-        "_northing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 14,
-        "H],AUTHORITY[\"EPSG\",\"3578\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3579, "epsg", 3579,
-        "NAD83(CSRS) / Yukon Albers", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=61.66666666666666 +lat_2=68 +lat_0=59 +");
-    add_proj4text (p, 1,
-        "lon_0=-132.5 +x_0=500000 +y_0=500000 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Yukon Albers\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 7,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"");
-    add_srs_wkt (p, 8,
-        "Albers_Conic_Equal_Area\"],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",61.66666666666666],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",68],PARAMETER[\"latitude_of_center\",59],PARAMETER[\"lo");
-    add_srs_wkt (p, 11,
-        "ngitude_of_center\",-132.5],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 12,
-        "500000],PARAMETER[\"false_northing\",500000],UNIT[\"metr");
-    add_srs_wkt (p, 13,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 14,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3579\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3580, "epsg", 3580,
-        "NAD83 / NWT Lambert", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=62 +lat_2=70 +lat_0=0 +lon_0=-112 +x_0=");
-    add_proj4text (p, 1,
-        "0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / NWT Lambert\",GEOGCS[\"NAD83\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2S");
-    add_srs_wkt (p, 8,
-        "P\"],PARAMETER[\"standard_parallel_1\",62],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "tandard_parallel_2\",70],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",0],PARAMETER[\"central_meridian\",-112],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3580");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3581, "epsg", 3581,
-        "NAD83(CSRS) / NWT Lambert", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=62 +lat_2=70 +lat_0=0 +lon_0=-112 +x_0=");
-    add_proj4text (p, 1,
-        "0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / NWT Lambert\",GEOGCS[\"NAD83(CSRS");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 8,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 9,
-        "lel_1\",62],PARAMETER[\"standard_parallel_2\",70],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"latitude_of_origin\",0],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 11,
-        "an\",-112],PARAMETER[\"false_easting\",0],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"3581\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3582, "epsg", 3582,
-        "NAD83(NSRS2007) / Maryland (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666");
-    add_proj4text (p, 1,
-        "666 +lon_0=-77 +x_0=399999.9998983998 +y_0=0 +ellps=GRS8");
-    add_proj4text (p, 2,
-        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Maryland (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 6,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 7,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",39.45],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 10,
-        "allel_2\",38.3],PARAMETER[\"latitude_of_origin\",37.6666");
-    add_srs_wkt (p, 11,
-        "6666666666],PARAMETER[\"central_meridian\",-77],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"false_easting\",1312333.333],PARAMETER[\"false_north");
-    add_srs_wkt (p, 13,
-        "ing\",0],UNIT[\"US survey foot\",0.3048006096012192,AUTH");
-    add_srs_wkt (p, 14,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 15,
-        "RTH],AUTHORITY[\"EPSG\",\"3582\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3583, "epsg", 3583,
-        "NAD83(NSRS2007) / Massachusetts Island", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Massachusetts Island\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,");
-    add_srs_wkt (p, 4,
-        "0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 5,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 6,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 7,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",41.48333333333333],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",41.28333333333333],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"latitude_of_origin\",41],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 12,
-        "\",-70.5],PARAMETER[\"false_easting\",500000],PARAMETER[");
-    add_srs_wkt (p, 13,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 15,
-        "[\"EPSG\",\"3583\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3584, "epsg", 3584,
-        "NAD83(NSRS2007) / Massachusetts Island (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000.0001016001 +y_0=0");
-    add_proj4text (p, 2,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de");
-    add_proj4text (p, 3,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Massachusetts Island (ftUS)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spati");
-    add_srs_wkt (p, 2,
-        "al_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 3,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0");
-    add_srs_wkt (p, 4,
-        ",0,0,0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 5,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 6,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 8,
-        "SG\",\"4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP");
-    add_srs_wkt (p, 9,
-        "\"],PARAMETER[\"standard_parallel_1\",41.48333333333333]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",41.28333333333333],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"latitude_of_origin\",41],PARAMETER[\"central_m");
-    add_srs_wkt (p, 12,
-        "eridian\",-70.5],PARAMETER[\"false_easting\",1640416.667");
-    add_srs_wkt (p, 13,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\"");
-    add_srs_wkt (p, 14,
-        ",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"");
-    add_srs_wkt (p, 15,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3584\"]");
-    add_srs_wkt (p, 16,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3585, "epsg", 3585,
-        "NAD83(NSRS2007) / Massachusetts Mainland", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000 +y_0=750000 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Massachusetts Mainland\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,");
-    add_srs_wkt (p, 4,
-        "0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",42.68333333333333],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",41.71666666666667],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"latitude_of_origin\",41],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 12,
-        "\",-71.5],PARAMETER[\"false_easting\",200000],PARAMETER[");
-    add_srs_wkt (p, 13,
-        "\"false_northing\",750000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 15,
-        "HORITY[\"EPSG\",\"3585\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3586, "epsg", 3586,
-        "NAD83(NSRS2007) / Massachusetts Mainland (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000.0001016002 +y_0=7");
-    add_proj4text (p, 2,
-        "50000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Massachusetts Mainland (ftUS)");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spa");
-    add_srs_wkt (p, 2,
-        "tial_Reference_System_2007\",SPHEROID[\"GRS 1980\",63781");
-    add_srs_wkt (p, 3,
-        "37,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0");
-    add_srs_wkt (p, 4,
-        ",0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 5,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 6,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 8,
-        "PSG\",\"4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2S");
-    add_srs_wkt (p, 9,
-        "P\"],PARAMETER[\"standard_parallel_1\",42.68333333333333");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"standard_parallel_2\",41.71666666666667],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"latitude_of_origin\",41],PARAMETER[\"central_");
-    add_srs_wkt (p, 12,
-        "meridian\",-71.5],PARAMETER[\"false_easting\",656166.667");
-    add_srs_wkt (p, 13,
-        "],PARAMETER[\"false_northing\",2460625],UNIT[\"US survey");
-    add_srs_wkt (p, 14,
-        " foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]]");
-    add_srs_wkt (p, 15,
-        ",AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 16,
-        "3586\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3587, "epsg", 3587,
-        "NAD83(NSRS2007) / Michigan Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43");
-    add_proj4text (p, 1,
-        ".31666666666667 +lon_0=-84.36666666666666 +x_0=6000000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Michigan Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",45.7],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 10,
-        "rallel_2\",44.18333333333333],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 11,
-        "igin\",43.31666666666667],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 12,
-        ",-84.36666666666666],PARAMETER[\"false_easting\",6000000");
-    add_srs_wkt (p, 13,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NOR");
-    add_srs_wkt (p, 15,
-        "TH],AUTHORITY[\"EPSG\",\"3587\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3588, "epsg", 3588,
-        "NAD83(NSRS2007) / Michigan Central (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43");
-    add_proj4text (p, 1,
-        ".31666666666667 +lon_0=-84.36666666666666 +x_0=5999999.9");
-    add_proj4text (p, 2,
-        "99976001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 3,
-        "ts=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Michigan Central (ft)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",45.7],PARAMETER[\"standar");
-    add_srs_wkt (p, 10,
-        "d_parallel_2\",44.18333333333333],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 11,
-        "f_origin\",43.31666666666667],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 12,
-        "an\",-84.36666666666666],PARAMETER[\"false_easting\",196");
-    add_srs_wkt (p, 13,
-        "85039.37],PARAMETER[\"false_northing\",0],UNIT[\"foot\",");
-    add_srs_wkt (p, 14,
-        "0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X\",EAST],AX");
-    add_srs_wkt (p, 15,
-        "IS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3588\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3589, "epsg", 3589,
-        "NAD83(NSRS2007) / Michigan North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=8000000 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 3,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Michigan North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",47.08333333333334],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",45.48333333333333],PARAMETER[\"lat");
-    add_srs_wkt (p, 11,
-        "itude_of_origin\",44.78333333333333],PARAMETER[\"central");
-    add_srs_wkt (p, 12,
-        "_meridian\",-87],PARAMETER[\"false_easting\",8000000],PA");
-    add_srs_wkt (p, 13,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],");
-    add_srs_wkt (p, 15,
-        "AUTHORITY[\"EPSG\",\"3589\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3590, "epsg", 3590,
-        "NAD83(NSRS2007) / Michigan North (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=7999999.999");
-    add_proj4text (p, 2,
-        "968001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Michigan North (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 6,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"47");
-    add_srs_wkt (p, 8,
-        "59\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",47.08333333333334],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",45.48333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "latitude_of_origin\",44.78333333333333],PARAMETER[\"cent");
-    add_srs_wkt (p, 12,
-        "ral_meridian\",-87],PARAMETER[\"false_easting\",26246719");
-    add_srs_wkt (p, 13,
-        ".16],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.304");
-    add_srs_wkt (p, 14,
-        "8,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X\",EAST],AXIS[\"");
-    add_srs_wkt (p, 15,
-        "Y\",NORTH],AUTHORITY[\"EPSG\",\"3590\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3591, "epsg", 3591,
-        "NAD83(NSRS2007) / Michigan Oblique Mercator", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Hotine_Oblique_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=45.30916666666666 +lonc=-86 +alpha=33");
-    add_proj4text (p, 1,
-        "7.25556 +k=0.9996 +x_0=2546731.496 +y_0=-4354009.816 +no");
-    add_proj4text (p, 2,
-        "_uoff +gamma=337.25556 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 3,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Michigan Oblique Mercator\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial");
-    add_srs_wkt (p, 2,
-        "_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,2");
-    add_srs_wkt (p, 3,
-        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwi");
-    add_srs_wkt (p, 5,
-        "ch\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0");
-    add_srs_wkt (p, 6,
-        "174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lat");
-    add_srs_wkt (p, 7,
-        "itude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 8,
-        "\",\"4759\"]],PROJECTION[\"Hotine_Oblique_Mercator\"],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"latitude_of_center\",45.30916666666666],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"longitude_of_center\",-86],PARAMETER[\"azimuth\",3");
-    add_srs_wkt (p, 11,
-        "37.25556],PARAMETER[\"rectified_grid_angle\",337.25556],");
-    add_srs_wkt (p, 12,
-        "PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 13,
-        "ting\",2546731.496],PARAMETER[\"false_northing\",-435400");
-    add_srs_wkt (p, 14,
-        "9.816],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 15,
-        "IS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"35");
-    add_srs_wkt (p, 16,
-        "91\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3592, "epsg", 3592,
-        "NAD83(NSRS2007) / Michigan South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41");
-    add_proj4text (p, 1,
-        ".5 +lon_0=-84.36666666666666 +x_0=4000000 +y_0=0 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Michigan South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",43.66666666666666],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",42.1],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 11,
-        "in\",41.5],PARAMETER[\"central_meridian\",-84.3666666666");
-    add_srs_wkt (p, 12,
-        "6666],PARAMETER[\"false_easting\",4000000],PARAMETER[\"f");
-    add_srs_wkt (p, 13,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 15,
-        "EPSG\",\"3592\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3593, "epsg", 3593,
-        "NAD83(NSRS2007) / Michigan South (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41");
-    add_proj4text (p, 1,
-        ".5 +lon_0=-84.36666666666666 +x_0=3999999.999984 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Michigan South (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 6,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"47");
-    add_srs_wkt (p, 8,
-        "59\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",43.66666666666666],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",42.1],PARAMETER[\"latitude_of_");
-    add_srs_wkt (p, 11,
-        "origin\",41.5],PARAMETER[\"central_meridian\",-84.366666");
-    add_srs_wkt (p, 12,
-        "66666666],PARAMETER[\"false_easting\",13123359.58],PARAM");
-    add_srs_wkt (p, 13,
-        "ETER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"9002\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH]");
-    add_srs_wkt (p, 15,
-        ",AUTHORITY[\"EPSG\",\"3593\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3594, "epsg", 3594,
-        "NAD83(NSRS2007) / Minnesota Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.05 +lat_2=45.61666666666667 +lat_0=4");
-    add_proj4text (p, 1,
-        "5 +lon_0=-94.25 +x_0=800000 +y_0=100000 +ellps=GRS80 +to");
-    add_proj4text (p, 2,
-        "wgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Minnesota Central\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 8,
-        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_1\",47.05],PARAMETER[\"standard_");
-    add_srs_wkt (p, 10,
-        "parallel_2\",45.61666666666667],PARAMETER[\"latitude_of_");
-    add_srs_wkt (p, 11,
-        "origin\",45],PARAMETER[\"central_meridian\",-94.25],PARA");
-    add_srs_wkt (p, 12,
-        "METER[\"false_easting\",800000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 13,
-        "ng\",100000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 14,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 15,
-        ",\"3594\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3595, "epsg", 3595,
-        "NAD83(NSRS2007) / Minnesota North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.63333333333333 +lat_2=47.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=46.5 +lon_0=-93.09999999999999 +x_0=800000 +y");
-    add_proj4text (p, 2,
-        "_0=100000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Minnesota North\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 6,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 7,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",48.63333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",47.03333333333333],PARAMETER[\"lat");
-    add_srs_wkt (p, 11,
-        "itude_of_origin\",46.5],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 12,
-        "93.1],PARAMETER[\"false_easting\",800000],PARAMETER[\"fa");
-    add_srs_wkt (p, 13,
-        "lse_northing\",100000],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 15,
-        "TY[\"EPSG\",\"3595\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3596, "epsg", 3596,
-        "NAD83(NSRS2007) / Minnesota South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.21666666666667 +lat_2=43.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=43 +lon_0=-94 +x_0=800000 +y_0=100000 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Minnesota South\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 6,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 7,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",45.21666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",43.78333333333333],PARAMETER[\"lat");
-    add_srs_wkt (p, 11,
-        "itude_of_origin\",43],PARAMETER[\"central_meridian\",-94");
-    add_srs_wkt (p, 12,
-        "],PARAMETER[\"false_easting\",800000],PARAMETER[\"false_");
-    add_srs_wkt (p, 13,
-        "northing\",100000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 15,
-        "EPSG\",\"3596\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3597, "epsg", 3597,
-        "NAD83(NSRS2007) / Mississippi East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Mississippi East\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",29.5],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 10,
-        "88.83333333333333],PARAMETER[\"scale_factor\",0.99995],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",300000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 14,
-        "\"3597\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3598, "epsg", 3598,
-        "NAD83(NSRS2007) / Mississippi East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Mississippi East (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 5,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 6,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 7,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 8,
-        ",\"4759\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"latitude_of_origin\",29.5],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 10,
-        "ian\",-88.83333333333333],PARAMETER[\"scale_factor\",0.9");
-    add_srs_wkt (p, 11,
-        "9995],PARAMETER[\"false_easting\",984250.0000000002],PAR");
-    add_srs_wkt (p, 12,
-        "AMETER[\"false_northing\",0],UNIT[\"US survey foot\",0.3");
-    add_srs_wkt (p, 13,
-        "048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3598\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3599, "epsg", 3599,
-        "NAD83(NSRS2007) / Mississippi West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=700000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Mississippi West\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",29.5],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 10,
-        "90.33333333333333],PARAMETER[\"scale_factor\",0.99995],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",700000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 14,
-        "\"3599\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3600, "epsg", 3600,
-        "NAD83(NSRS2007) / Mississippi West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Mississippi West (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 5,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 6,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 7,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 8,
-        ",\"4759\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"latitude_of_origin\",29.5],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 10,
-        "ian\",-90.33333333333333],PARAMETER[\"scale_factor\",0.9");
-    add_srs_wkt (p, 11,
-        "9995],PARAMETER[\"false_easting\",2296583.333],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_northing\",0],UNIT[\"US survey foot\",0.3048006");
-    add_srs_wkt (p, 13,
-        "096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3600\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3601, "epsg", 3601,
-        "NAD83(NSRS2007) / Missouri Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=35.83333333333334 +lon_0=-92.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99933333 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Missouri Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",35.83333333333334],PARAMETER[\"central");
-    add_srs_wkt (p, 10,
-        "_meridian\",-92.5],PARAMETER[\"scale_factor\",0.99993333");
-    add_srs_wkt (p, 11,
-        "3],PARAMETER[\"false_easting\",500000],PARAMETER[\"false");
-    add_srs_wkt (p, 12,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "1\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"3601\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3602, "epsg", 3602,
-        "NAD83(NSRS2007) / Missouri East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=35.83333333333334 +lon_0=-90.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99933333 +x_0=250000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Missouri East\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 5,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 6,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORT");
-    add_srs_wkt (p, 7,
-        "H],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]");
-    add_srs_wkt (p, 8,
-        "],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 9,
-        "de_of_origin\",35.83333333333334],PARAMETER[\"central_me");
-    add_srs_wkt (p, 10,
-        "ridian\",-90.5],PARAMETER[\"scale_factor\",0.999933333],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",250000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 12,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3602\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3603, "epsg", 3603,
-        "NAD83(NSRS2007) / Missouri West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.16666666666666 +lon_0=-94.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99941177 +x_0=850000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Missouri West\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 5,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 6,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORT");
-    add_srs_wkt (p, 7,
-        "H],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]");
-    add_srs_wkt (p, 8,
-        "],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 9,
-        "de_of_origin\",36.16666666666666],PARAMETER[\"central_me");
-    add_srs_wkt (p, 10,
-        "ridian\",-94.5],PARAMETER[\"scale_factor\",0.999941177],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",850000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 12,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3603\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3604, "epsg", 3604,
-        "NAD83(NSRS2007) / Montana", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5");
-    add_proj4text (p, 1,
-        " +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Montana\",GEOGCS[\"NAD83(NSRS");
-    add_srs_wkt (p, 1,
-        "2007)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 7,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 8,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"stand");
-    add_srs_wkt (p, 9,
-        "ard_parallel_1\",49],PARAMETER[\"standard_parallel_2\",4");
-    add_srs_wkt (p, 10,
-        "5],PARAMETER[\"latitude_of_origin\",44.25],PARAMETER[\"c");
-    add_srs_wkt (p, 11,
-        "entral_meridian\",-109.5],PARAMETER[\"false_easting\",60");
-    add_srs_wkt (p, 12,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3604\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3605, "epsg", 3605,
-        "NAD83(NSRS2007) / Montana (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5");
-    add_proj4text (p, 1,
-        " +x_0=599999.9999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Montana (ft)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",49],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",45],PARAMETER[\"latitude_of_origin\",44.25],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"central_meridian\",-109.5],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 12,
-        "\",1968503.937],PARAMETER[\"false_northing\",0],UNIT[\"f");
-    add_srs_wkt (p, 13,
-        "oot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 14,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3605\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3606, "epsg", 3606,
-        "NAD83(NSRS2007) / Nebraska", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=40 +lat_0=39.83333333333334 +");
-    add_proj4text (p, 1,
-        "lon_0=-100 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Nebraska\",GEOGCS[\"NAD83(NSR");
-    add_srs_wkt (p, 1,
-        "S2007)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 6,
-        "UTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AX");
-    add_srs_wkt (p, 7,
-        "IS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]],PRO");
-    add_srs_wkt (p, 8,
-        "JECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"sta");
-    add_srs_wkt (p, 9,
-        "ndard_parallel_1\",43],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",40],PARAMETER[\"latitude_of_origin\",39.83333333333334]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"central_meridian\",-100],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 13,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3606\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3607, "epsg", 3607,
-        "NAD83(NSRS2007) / Nevada Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=500000 +y_0=6000000 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Nevada Central\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",34.75],PARAMETER[\"central_meridian\",-1");
-    add_srs_wkt (p, 10,
-        "16.6666666666667],PARAMETER[\"scale_factor\",0.9999],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_easting\",500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",6000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "1\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"3607\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3608, "epsg", 3608,
-        "NAD83(NSRS2007) / Nevada Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=500000.00001016 +y_0=6000000 +ellps=GRS80 +tow");
-    add_proj4text (p, 2,
-        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Nevada Central (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "latitude_of_origin\",34.75],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 10,
-        "\",-116.6666666666667],PARAMETER[\"scale_factor\",0.9999");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",1640416.6667],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_northing\",19685000],UNIT[\"US survey foot\",0.304");
-    add_srs_wkt (p, 13,
-        "8006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",E");
-    add_srs_wkt (p, 14,
-        "AST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3608\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3609, "epsg", 3609,
-        "NAD83(NSRS2007) / Nevada East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=200000 +y_0=8000000 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Nevada East\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 6,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]],");
-    add_srs_wkt (p, 8,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 9,
-        "_of_origin\",34.75],PARAMETER[\"central_meridian\",-115.");
-    add_srs_wkt (p, 10,
-        "5833333333333],PARAMETER[\"scale_factor\",0.9999],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",200000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",8000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3609\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3610, "epsg", 3610,
-        "NAD83(NSRS2007) / Nevada East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=200000.00001016 +y_0=8000000.000010163 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Nevada East (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 8,
-        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 9,
-        "titude_of_origin\",34.75],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 10,
-        ",-115.5833333333333],PARAMETER[\"scale_factor\",0.9999],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",656166.6667],PARAMETER[\"fal");
-    add_srs_wkt (p, 12,
-        "se_northing\",26246666.66670001],UNIT[\"US survey foot\"");
-    add_srs_wkt (p, 13,
-        ",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3610\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3611, "epsg", 3611,
-        "NAD83(NSRS2007) / Nevada West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=800000 +y_0=4000000 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Nevada West\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 6,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]],");
-    add_srs_wkt (p, 8,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 9,
-        "_of_origin\",34.75],PARAMETER[\"central_meridian\",-118.");
-    add_srs_wkt (p, 10,
-        "5833333333333],PARAMETER[\"scale_factor\",0.9999],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",800000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",4000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3611\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3612, "epsg", 3612,
-        "NAD83(NSRS2007) / Nevada West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=800000.0000101599 +y_0=3999999.99998984 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Nevada West (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 8,
-        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 9,
-        "titude_of_origin\",34.75],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 10,
-        ",-118.5833333333333],PARAMETER[\"scale_factor\",0.9999],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",2624666.6667],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_northing\",13123333.3333],UNIT[\"US survey foot\",0.");
-    add_srs_wkt (p, 13,
-        "3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3612\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3613, "epsg", 3613,
-        "NAD83(NSRS2007) / New Hampshire", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Hampshire\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 5,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 6,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORT");
-    add_srs_wkt (p, 7,
-        "H],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]");
-    add_srs_wkt (p, 8,
-        "],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 9,
-        "de_of_origin\",42.5],PARAMETER[\"central_meridian\",-71.");
-    add_srs_wkt (p, 10,
-        "66666666666667],PARAMETER[\"scale_factor\",0.999966667],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",300000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 12,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3613\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3614, "epsg", 3614,
-        "NAD83(NSRS2007) / New Hampshire (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +tow");
-    add_proj4text (p, 2,
-        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Hampshire (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,");
-    add_srs_wkt (p, 4,
-        "0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 5,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 6,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 7,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "latitude_of_origin\",42.5],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 10,
-        ",-71.66666666666667],PARAMETER[\"scale_factor\",0.999966");
-    add_srs_wkt (p, 11,
-        "667],PARAMETER[\"false_easting\",984250.0000000002],PARA");
-    add_srs_wkt (p, 12,
-        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30");
-    add_srs_wkt (p, 13,
-        "48006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 14,
-        "EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3614\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3615, "epsg", 3615,
-        "NAD83(NSRS2007) / New Jersey", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Jersey\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",38.83333333333334],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 10,
-        "ian\",-74.5],PARAMETER[\"scale_factor\",0.9999],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_easting\",150000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3615\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3616, "epsg", 3616,
-        "NAD83(NSRS2007) / New Jersey (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Jersey (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 8,
-        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 9,
-        "titude_of_origin\",38.83333333333334],PARAMETER[\"centra");
-    add_srs_wkt (p, 10,
-        "l_meridian\",-74.5],PARAMETER[\"scale_factor\",0.9999],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",492125],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",0],UNIT[\"US survey foot\",0.3048006096012192,AU");
-    add_srs_wkt (p, 13,
-        "THORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",");
-    add_srs_wkt (p, 14,
-        "NORTH],AUTHORITY[\"EPSG\",\"3616\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3617, "epsg", 3617,
-        "NAD83(NSRS2007) / New Mexico Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000");
-    add_proj4text (p, 1,
-        "00 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Mexico Central\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 8,
-        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 9,
-        "titude_of_origin\",31],PARAMETER[\"central_meridian\",-1");
-    add_srs_wkt (p, 10,
-        "06.25],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3617\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3618, "epsg", 3618,
-        "NAD83(NSRS2007) / New Mexico Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000");
-    add_proj4text (p, 1,
-        "00.0001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Mexico Central (ftUS)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial");
-    add_srs_wkt (p, 2,
-        "_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,2");
-    add_srs_wkt (p, 3,
-        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwi");
-    add_srs_wkt (p, 5,
-        "ch\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0");
-    add_srs_wkt (p, 6,
-        "174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lat");
-    add_srs_wkt (p, 7,
-        "itude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 8,
-        "\",\"4759\"]],PROJECTION[\"Transverse_Mercator\"],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"latitude_of_origin\",31],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 10,
-        "ian\",-106.25],PARAMETER[\"scale_factor\",0.9999],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",1640416.667],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",0],UNIT[\"US survey foot\",0.3048006096012192,AU");
-    add_srs_wkt (p, 13,
-        "THORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",");
-    add_srs_wkt (p, 14,
-        "NORTH],AUTHORITY[\"EPSG\",\"3618\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3619, "epsg", 3619,
-        "NAD83(NSRS2007) / New Mexico East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Mexico East\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 6,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 7,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",31],PARAMETER[\"central_meridian\",-104.");
-    add_srs_wkt (p, 10,
-        "3333333333333],PARAMETER[\"scale_factor\",0.999909091],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",165000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 14,
-        "\"3619\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3620, "epsg", 3620,
-        "NAD83(NSRS2007) / New Mexico East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Mexico East (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,");
-    add_srs_wkt (p, 4,
-        "0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "latitude_of_origin\",31],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 10,
-        "-104.3333333333333],PARAMETER[\"scale_factor\",0.9999090");
-    add_srs_wkt (p, 11,
-        "91],PARAMETER[\"false_easting\",541337.5],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 13,
-        "2192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS");
-    add_srs_wkt (p, 14,
-        "[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3620\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3621, "epsg", 3621,
-        "NAD83(NSRS2007) / New Mexico West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "916667 +x_0=830000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Mexico West\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 6,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 7,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",31],PARAMETER[\"central_meridian\",-107.");
-    add_srs_wkt (p, 10,
-        "8333333333333],PARAMETER[\"scale_factor\",0.999916667],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",830000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 14,
-        "\"3621\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3622, "epsg", 3622,
-        "NAD83(NSRS2007) / New Mexico West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "916667 +x_0=830000.0001016001 +y_0=0 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Mexico West (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,");
-    add_srs_wkt (p, 4,
-        "0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "latitude_of_origin\",31],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 10,
-        "-107.8333333333333],PARAMETER[\"scale_factor\",0.9999166");
-    add_srs_wkt (p, 11,
-        "67],PARAMETER[\"false_easting\",2723091.667],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 13,
-        "012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AX");
-    add_srs_wkt (p, 14,
-        "IS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3622\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3623, "epsg", 3623,
-        "NAD83(NSRS2007) / New York Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=250000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",40],PARAMETER[\"central_meridian\",-76");
-    add_srs_wkt (p, 10,
-        ".58333333333333],PARAMETER[\"scale_factor\",0.9999375],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",250000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 14,
-        "\"3623\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3624, "epsg", 3624,
-        "NAD83(NSRS2007) / New York Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=249999.9998983998 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York Central (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 5,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 6,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 7,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 8,
-        ",\"4759\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"latitude_of_origin\",40],PARAMETER[\"central_meridia");
-    add_srs_wkt (p, 10,
-        "n\",-76.58333333333333],PARAMETER[\"scale_factor\",0.999");
-    add_srs_wkt (p, 11,
-        "9375],PARAMETER[\"false_easting\",820208.3330000002],PAR");
-    add_srs_wkt (p, 12,
-        "AMETER[\"false_northing\",0],UNIT[\"US survey foot\",0.3");
-    add_srs_wkt (p, 13,
-        "048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3624\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3625, "epsg", 3625,
-        "NAD83(NSRS2007) / New York East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York East\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 5,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 6,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORT");
-    add_srs_wkt (p, 7,
-        "H],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]");
-    add_srs_wkt (p, 8,
-        "],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 9,
-        "de_of_origin\",38.83333333333334],PARAMETER[\"central_me");
-    add_srs_wkt (p, 10,
-        "ridian\",-74.5],PARAMETER[\"scale_factor\",0.9999],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_easting\",150000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"36");
-    add_srs_wkt (p, 14,
-        "25\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3626, "epsg", 3626,
-        "NAD83(NSRS2007) / New York East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York East (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,");
-    add_srs_wkt (p, 4,
-        "0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 5,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 6,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 7,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "latitude_of_origin\",38.83333333333334],PARAMETER[\"cent");
-    add_srs_wkt (p, 10,
-        "ral_meridian\",-74.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_easting\",492125],PARAMETER[\"false_n");
-    add_srs_wkt (p, 12,
-        "orthing\",0],UNIT[\"US survey foot\",0.3048006096012192,");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3626\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3627, "epsg", 3627,
-        "NAD83(NSRS2007) / New York Long Island", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York Long Island\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,");
-    add_srs_wkt (p, 4,
-        "0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 5,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 6,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 7,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",41.03333333333333],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",40.66666666666666],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"latitude_of_origin\",40.16666666666666],PARAMETER[\"c");
-    add_srs_wkt (p, 12,
-        "entral_meridian\",-74],PARAMETER[\"false_easting\",30000");
-    add_srs_wkt (p, 13,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 14,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 15,
-        "RTH],AUTHORITY[\"EPSG\",\"3627\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3628, "epsg", 3628,
-        "NAD83(NSRS2007) / New York Long Island (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000.0000");
-    add_proj4text (p, 2,
-        "000001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York Long Island (ftUS)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spati");
-    add_srs_wkt (p, 2,
-        "al_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 3,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0");
-    add_srs_wkt (p, 4,
-        ",0,0,0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 5,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 6,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 8,
-        "SG\",\"4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP");
-    add_srs_wkt (p, 9,
-        "\"],PARAMETER[\"standard_parallel_1\",41.03333333333333]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",40.66666666666666],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"latitude_of_origin\",40.16666666666666],PARAME");
-    add_srs_wkt (p, 12,
-        "TER[\"central_meridian\",-74],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 13,
-        ",984250.0000000002],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 14,
-        "[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 15,
-        ",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 16,
-        "[\"EPSG\",\"3628\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3629, "epsg", 3629,
-        "NAD83(NSRS2007) / New York West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=350000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York West\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 5,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 6,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORT");
-    add_srs_wkt (p, 7,
-        "H],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]");
-    add_srs_wkt (p, 8,
-        "],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 9,
-        "de_of_origin\",40],PARAMETER[\"central_meridian\",-78.58");
-    add_srs_wkt (p, 10,
-        "333333333333],PARAMETER[\"scale_factor\",0.9999375],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",350000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 14,
-        "629\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3630, "epsg", 3630,
-        "NAD83(NSRS2007) / New York West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=350000.0001016001 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York West (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,");
-    add_srs_wkt (p, 4,
-        "0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 5,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 6,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 7,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "latitude_of_origin\",40],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 10,
-        "-78.58333333333333],PARAMETER[\"scale_factor\",0.9999375");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",1148291.667],PARAMETER[\"f");
-    add_srs_wkt (p, 12,
-        "alse_northing\",0],UNIT[\"US survey foot\",0.30480060960");
-    add_srs_wkt (p, 13,
-        "12192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3630\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3631, "epsg", 3631,
-        "NAD83(NSRS2007) / North Carolina", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.22 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / North Carolina\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",36.16666666666666],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",34.33333333333334],PARAMETER[\"lat");
-    add_srs_wkt (p, 11,
-        "itude_of_origin\",33.75],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 12,
-        "-79],PARAMETER[\"false_easting\",609601.22],PARAMETER[\"");
-    add_srs_wkt (p, 13,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 14,
-        "\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 15,
-        "\"EPSG\",\"3631\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3632, "epsg", 3632,
-        "NAD83(NSRS2007) / North Carolina (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.2192024384 +y_0=");
-    add_proj4text (p, 2,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / North Carolina (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",36.16666666666666],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",34.33333333333334],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"latitude_of_origin\",33.75],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 12,
-        "ian\",-79],PARAMETER[\"false_easting\",2000000],PARAMETE");
-    add_srs_wkt (p, 13,
-        "R[\"false_northing\",0],UNIT[\"US survey foot\",0.304800");
-    add_srs_wkt (p, 14,
-        "6096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST");
-    add_srs_wkt (p, 15,
-        "],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3632\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3633, "epsg", 3633,
-        "NAD83(NSRS2007) / North Dakota North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=47 +lon_0=-100.5 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / North Dakota North\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 8,
-        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_1\",48.73333333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",47.43333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "latitude_of_origin\",47],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 12,
-        "-100.5],PARAMETER[\"false_easting\",600000],PARAMETER[\"");
-    add_srs_wkt (p, 13,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 14,
-        "\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 15,
-        "\"EPSG\",\"3633\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3634, "epsg", 3634,
-        "NAD83(NSRS2007) / North Dakota North (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=47 +lon_0=-100.5 +x_0=599999.9999976 +y_0=0 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / North Dakota North (ft)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 5,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 6,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 7,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 8,
-        ",\"4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",48.73333333333333],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"standard_parallel_2\",47.43333333333333],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"latitude_of_origin\",47],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 12,
-        "ian\",-100.5],PARAMETER[\"false_easting\",1968503.937],P");
-    add_srs_wkt (p, 13,
-        "ARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTH");
-    add_srs_wkt (p, 14,
-        "ORITY[\"EPSG\",\"9002\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 15,
-        "RTH],AUTHORITY[\"EPSG\",\"3634\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3635, "epsg", 3635,
-        "NAD83(NSRS2007) / North Dakota South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / North Dakota South\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 8,
-        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_1\",47.48333333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",46.18333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "latitude_of_origin\",45.66666666666666],PARAMETER[\"cent");
-    add_srs_wkt (p, 12,
-        "ral_meridian\",-100.5],PARAMETER[\"false_easting\",60000");
-    add_srs_wkt (p, 13,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 14,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 15,
-        "RTH],AUTHORITY[\"EPSG\",\"3635\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3636, "epsg", 3636,
-        "NAD83(NSRS2007) / North Dakota South (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=599999.9");
-    add_proj4text (p, 2,
-        "999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / North Dakota South (ft)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 5,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 6,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 7,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 8,
-        ",\"4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",47.48333333333333],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"standard_parallel_2\",46.18333333333333],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"latitude_of_origin\",45.66666666666666],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"central_meridian\",-100.5],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 13,
-        ",1968503.937],PARAMETER[\"false_northing\",0],UNIT[\"foo");
-    add_srs_wkt (p, 14,
-        "t\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X\",EAST");
-    add_srs_wkt (p, 15,
-        "],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3636\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3637, "epsg", 3637,
-        "NAD83(NSRS2007) / Ohio North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Ohio North\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "tandard_parallel_1\",41.7],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 10,
-        "_2\",40.43333333333333],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 11,
-        ",39.66666666666666],PARAMETER[\"central_meridian\",-82.5");
-    add_srs_wkt (p, 12,
-        "],PARAMETER[\"false_easting\",600000],PARAMETER[\"false_");
-    add_srs_wkt (p, 13,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 14,
-        "\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 15,
-        "\",\"3637\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3638, "epsg", 3638,
-        "NAD83(NSRS2007) / Ohio South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Ohio South\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "tandard_parallel_1\",40.03333333333333],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",38.73333333333333],PARAMETER[\"latitud");
-    add_srs_wkt (p, 11,
-        "e_of_origin\",38],PARAMETER[\"central_meridian\",-82.5],");
-    add_srs_wkt (p, 12,
-        "PARAMETER[\"false_easting\",600000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 13,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 14,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 15,
-        ",\"3638\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3639, "epsg", 3639,
-        "NAD83(NSRS2007) / Oklahoma North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oklahoma North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",36.76666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",35.56666666666667],PARAMETER[\"lat");
-    add_srs_wkt (p, 11,
-        "itude_of_origin\",35],PARAMETER[\"central_meridian\",-98");
-    add_srs_wkt (p, 12,
-        "],PARAMETER[\"false_easting\",600000],PARAMETER[\"false_");
-    add_srs_wkt (p, 13,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 14,
-        "\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 15,
-        "\",\"3639\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3640, "epsg", 3640,
-        "NAD83(NSRS2007) / Oklahoma North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oklahoma North (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",36.76666666666667],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",35.56666666666667],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"latitude_of_origin\",35],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 12,
-        "\",-98],PARAMETER[\"false_easting\",1968500],PARAMETER[\"");
-    add_srs_wkt (p, 13,
-        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 14,
-        "012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AX");
-    add_srs_wkt (p, 15,
-        "IS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3640\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3641, "epsg", 3641,
-        "NAD83(NSRS2007) / Oklahoma South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oklahoma South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",35.23333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",33.93333333333333],PARAMETER[\"lat");
-    add_srs_wkt (p, 11,
-        "itude_of_origin\",33.33333333333334],PARAMETER[\"central");
-    add_srs_wkt (p, 12,
-        "_meridian\",-98],PARAMETER[\"false_easting\",600000],PAR");
-    add_srs_wkt (p, 13,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 14,
-        "\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],A");
-    add_srs_wkt (p, 15,
-        "UTHORITY[\"EPSG\",\"3641\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3642, "epsg", 3642,
-        "NAD83(NSRS2007) / Oklahoma South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oklahoma South (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",35.23333333333333],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",33.93333333333333],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"latitude_of_origin\",33.33333333333334],PARAMETER[\"c");
-    add_srs_wkt (p, 12,
-        "entral_meridian\",-98],PARAMETER[\"false_easting\",19685");
-    add_srs_wkt (p, 13,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"US survey foo");
-    add_srs_wkt (p, 14,
-        "t\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXI");
-    add_srs_wkt (p, 15,
-        "S[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"364");
-    add_srs_wkt (p, 16,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3643, "epsg", 3643,
-        "NAD83(NSRS2007) / Oregon LCC (m)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oregon LCC (m)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 6,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 7,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",43],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 10,
-        "el_2\",45.5],PARAMETER[\"latitude_of_origin\",41.75],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"central_meridian\",-120.5],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 12,
-        "sting\",400000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 13,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3643\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3644, "epsg", 3644,
-        "NAD83(NSRS2007) / Oregon GIC Lambert (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=399999.9999984 +y_0=0 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oregon GIC Lambert (ft)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 5,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 6,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 7,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 8,
-        ",\"4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",43],PARAMETER[\"standa");
-    add_srs_wkt (p, 10,
-        "rd_parallel_2\",45.5],PARAMETER[\"latitude_of_origin\",4");
-    add_srs_wkt (p, 11,
-        "1.75],PARAMETER[\"central_meridian\",-120.5],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_easting\",1312335.958],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],A");
-    add_srs_wkt (p, 14,
-        "XIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 15,
-        "644\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3645, "epsg", 3645,
-        "NAD83(NSRS2007) / Oregon North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=2500000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oregon North\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",46],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",44.33333333333334],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 11,
-        "43.66666666666666],PARAMETER[\"central_meridian\",-120.5");
-    add_srs_wkt (p, 12,
-        "],PARAMETER[\"false_easting\",2500000],PARAMETER[\"false");
-    add_srs_wkt (p, 13,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 14,
-        "1\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"3645\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3646, "epsg", 3646,
-        "NAD83(NSRS2007) / Oregon North (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=2500000.0001424 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oregon North (ft)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 8,
-        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_1\",46],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 10,
-        "allel_2\",44.33333333333334],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 11,
-        "gin\",43.66666666666666],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 12,
-        "-120.5],PARAMETER[\"false_easting\",8202099.738],PARAMET");
-    add_srs_wkt (p, 13,
-        "ER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[");
-    add_srs_wkt (p, 14,
-        "\"EPSG\",\"9002\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],A");
-    add_srs_wkt (p, 15,
-        "UTHORITY[\"EPSG\",\"3646\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3647, "epsg", 3647,
-        "NAD83(NSRS2007) / Oregon South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=1500000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oregon South\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",44],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",42.33333333333334],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 11,
-        "41.66666666666666],PARAMETER[\"central_meridian\",-120.5");
-    add_srs_wkt (p, 12,
-        "],PARAMETER[\"false_easting\",1500000],PARAMETER[\"false");
-    add_srs_wkt (p, 13,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 14,
-        "1\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"3647\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3648, "epsg", 3648,
-        "NAD83(NSRS2007) / Oregon South (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=1500000.0001464 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oregon South (ft)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 8,
-        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_1\",44],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 10,
-        "allel_2\",42.33333333333334],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 11,
-        "gin\",41.66666666666666],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 12,
-        "-120.5],PARAMETER[\"false_easting\",4921259.843],PARAMET");
-    add_srs_wkt (p, 13,
-        "ER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[");
-    add_srs_wkt (p, 14,
-        "\"EPSG\",\"9002\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],A");
-    add_srs_wkt (p, 15,
-        "UTHORITY[\"EPSG\",\"3648\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
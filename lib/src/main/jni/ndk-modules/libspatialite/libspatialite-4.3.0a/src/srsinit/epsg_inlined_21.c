@@ -1,3627 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_21 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 4309, "epsg", 4309,
-        "Yacare", 1, 1,
-        "International 1924", "Greenwich",
-        "Yacare", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-155,171,37,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Yacare\",DATUM[\"Yacare\",SPHEROID[\"Internatio");
-    add_srs_wkt (p, 1,
-        "nal 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOW");
-    add_srs_wkt (p, 2,
-        "GS84[-155,171,37,0,0,0,0],AUTHORITY[\"EPSG\",\"6309\"]],");
-    add_srs_wkt (p, 3,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 4,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 5,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"4309\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4310, "epsg", 4310,
-        "Yoff", 1, 1,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Yoff", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378249.2 +b=6356515 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Yoff\",DATUM[\"Yoff\",SPHEROID[\"Clarke 1880 (I");
-    add_srs_wkt (p, 1,
-        "GN)\",6378249.2,293.4660212936269,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 2,
-        "011\"]],AUTHORITY[\"EPSG\",\"6310\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 3,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 4,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 5,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4310\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4311, "epsg", 4311,
-        "Zanderij", 1, 1,
-        "International 1924", "Greenwich",
-        "Zanderij", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-265,120,-358,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Zanderij\",DATUM[\"Zanderij\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 1,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 2,
-        ",TOWGS84[-265,120,-358,0,0,0,0],AUTHORITY[\"EPSG\",\"631");
-    add_srs_wkt (p, 3,
-        "1\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"4311\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4312, "epsg", 4312,
-        "MGI", 1, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=577.326,90.129,463.");
-    add_proj4text (p, 1,
-        "919,5.137,1.474,5.297,2.4232 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"MGI\",DATUM[\"Militar_Geographische_Institute\"");
-    add_srs_wkt (p, 1,
-        ",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7004\"]],TOWGS84[577.326,90.129,463.919,5");
-    add_srs_wkt (p, 3,
-        ".137,1.474,5.297,2.4232],AUTHORITY[\"EPSG\",\"6312\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"4312\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4313, "epsg", 4313,
-        "Belge 1972", 1, 1,
-        "International 1924", "Greenwich",
-        "Reseau_National_Belge_1972", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-106.8686,52.2978,-10");
-    add_proj4text (p, 1,
-        "3.7239,0.3366,-0.457,1.8422,-1.2747 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Belge 1972\",DATUM[\"Reseau_National_Belge_1972");
-    add_srs_wkt (p, 1,
-        "\",SPHEROID[\"International 1924\",6378388,297,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7022\"]],TOWGS84[-106.8686,52.2978,-103.7239");
-    add_srs_wkt (p, 3,
-        ",0.3366,-0.457,1.8422,-1.2747],AUTHORITY[\"EPSG\",\"6313");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"4313\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4314, "epsg", 4314,
-        "DHDN", 1, 1,
-        "Bessel 1841", "Greenwich",
-        "Deutsches_Hauptdreiecksnetz", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=598.1,73.7,418.2,0.");
-    add_proj4text (p, 1,
-        "202,0.045,-2.455,6.7 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"DHDN\",DATUM[\"Deutsches_Hauptdreiecksnetz\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7004\"]],TOWGS84[598.1,73.7,418.2,0.202,0.04");
-    add_srs_wkt (p, 3,
-        "5,-2.455,6.7],AUTHORITY[\"EPSG\",\"6314\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4314\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4315, "epsg", 4315,
-        "Conakry 1905", 1, 1,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Conakry_1905", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378249.2 +b=6356515 +towgs84=-23,259,-");
-    add_proj4text (p, 1,
-        "9,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Conakry 1905\",DATUM[\"Conakry_1905\",SPHEROID[");
-    add_srs_wkt (p, 1,
-        "\"Clarke 1880 (IGN)\",6378249.2,293.4660212936269,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7011\"]],TOWGS84[-23,259,-9,0,0,0,0],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6315\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4315\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4316, "epsg", 4316,
-        "Dealul Piscului 1930", 1, 1,
-        "International 1924", "Greenwich",
-        "Dealul_Piscului_1930", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=103.25,-100.4,-307.19");
-    add_proj4text (p, 1,
-        ",0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Dealul Piscului 1930\",DATUM[\"Dealul_Piscului_");
-    add_srs_wkt (p, 1,
-        "1930\",SPHEROID[\"International 1924\",6378388,297,AUTHO");
-    add_srs_wkt (p, 2,
-        "RITY[\"EPSG\",\"7022\"]],TOWGS84[103.25,-100.4,-307.19,0");
-    add_srs_wkt (p, 3,
-        ",0,0,0],AUTHORITY[\"EPSG\",\"6316\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 6,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4316\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4317, "epsg", 4317,
-        "Dealul Piscului 1970", 1, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Dealul_Piscului_1970", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=krass +towgs84=28,-121,-77,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Dealul Piscului 1970\",DATUM[\"Dealul_Piscului_");
-    add_srs_wkt (p, 1,
-        "1970\",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7024\"]],TOWGS84[28,-121,-77,0,0,0,0],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6317\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4317\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4318, "epsg", 4318,
-        "NGN", 1, 1,
-        "WGS 84", "Greenwich",
-        "National_Geodetic_Network", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=-3.2,-5.7,2.8,0,0,0,");
-    add_proj4text (p, 1,
-        "0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NGN\",DATUM[\"National_Geodetic_Network\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 2,
-        "\"7030\"]],TOWGS84[-3.2,-5.7,2.8,0,0,0,0],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"6318\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 6,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4318\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4319, "epsg", 4319,
-        "KUDAMS", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Kuwait_Utility", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=-20.8,11.3,2.4,0,0,0");
-    add_proj4text (p, 1,
-        ",0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"KUDAMS\",DATUM[\"Kuwait_Utility\",SPHEROID[\"GR");
-    add_srs_wkt (p, 1,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 2,
-        "\"]],TOWGS84[-20.8,11.3,2.4,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"6319\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 4,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 6,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4319\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4322, "epsg", 4322,
-        "WGS 72", 1, 1,
-        "WGS 72", "Greenwich",
-        "WGS_1972", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS72 +towgs84=0,0,4.5,0,0,0.554,0.");
-    add_proj4text (p, 1,
-        "2263 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"WGS 72\",DATUM[\"WGS_1972\",SPHEROID[\"WGS 72\"");
-    add_srs_wkt (p, 1,
-        ",6378135,298.26,AUTHORITY[\"EPSG\",\"7043\"]],TOWGS84[0,");
-    add_srs_wkt (p, 2,
-        "0,4.5,0,0,0.554,0.2263],AUTHORITY[\"EPSG\",\"6322\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 4,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 5,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4322\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4324, "epsg", 4324,
-        "WGS 72BE", 1, 1,
-        "WGS 72", "Greenwich",
-        "WGS_1972_Transit_Broadcast_Ephemeris", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS72 +towgs84=0,0,1.9,0,0,0.814,-0");
-    add_proj4text (p, 1,
-        ".38 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"WGS 72BE\",DATUM[\"WGS_1972_Transit_Broadcast_E");
-    add_srs_wkt (p, 1,
-        "phemeris\",SPHEROID[\"WGS 72\",6378135,298.26,AUTHORITY[");
-    add_srs_wkt (p, 2,
-        "\"EPSG\",\"7043\"]],TOWGS84[0,0,1.9,0,0,0.814,-0.38],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6324\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4324\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4399, "epsg", 4399,
-        "NAD27 / BLM 59N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=171 +k=0.9996 +x_0=500000.00");
-    add_proj4text (p, 1,
-        "1016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 59N (ftUS)\",GEOGCS[\"NAD27\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 6,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 7,
-        "7\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",171");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",1640416.67],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"4399\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4400, "epsg", 4400,
-        "NAD27 / BLM 60N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=177 +k=0.9996 +x_0=500000.00");
-    add_proj4text (p, 1,
-        "1016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 60N (ftUS)\",GEOGCS[\"NAD27\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 6,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 7,
-        "7\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",177");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",1640416.67],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"4400\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4401, "epsg", 4401,
-        "NAD27 / BLM 1N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-177 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 1N (ftUS)\",GEOGCS[\"NAD27\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",6");
-    add_srs_wkt (p, 2,
-        "378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 6,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4267");
-    add_srs_wkt (p, 7,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-177");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",1640416.67],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"4401\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4402, "epsg", 4402,
-        "NAD27 / BLM 2N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-171 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 2N (ftUS)\",GEOGCS[\"NAD27\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",6");
-    add_srs_wkt (p, 2,
-        "378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 6,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4267");
-    add_srs_wkt (p, 7,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-171");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",1640416.67],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"4402\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4403, "epsg", 4403,
-        "NAD27 / BLM 3N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-165 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 3N (ftUS)\",GEOGCS[\"NAD27\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",6");
-    add_srs_wkt (p, 2,
-        "378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 6,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4267");
-    add_srs_wkt (p, 7,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-165");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",1640416.67],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"4403\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4404, "epsg", 4404,
-        "NAD27 / BLM 4N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-159 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 4N (ftUS)\",GEOGCS[\"NAD27\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",6");
-    add_srs_wkt (p, 2,
-        "378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 6,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4267");
-    add_srs_wkt (p, 7,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-159");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",1640416.67],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"4404\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4405, "epsg", 4405,
-        "NAD27 / BLM 5N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-153 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 5N (ftUS)\",GEOGCS[\"NAD27\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",6");
-    add_srs_wkt (p, 2,
-        "378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 6,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4267");
-    add_srs_wkt (p, 7,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-153");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",1640416.67],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"4405\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4406, "epsg", 4406,
-        "NAD27 / BLM 6N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-147 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 6N (ftUS)\",GEOGCS[\"NAD27\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",6");
-    add_srs_wkt (p, 2,
-        "378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 6,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4267");
-    add_srs_wkt (p, 7,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-147");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",1640416.67],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"4406\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4407, "epsg", 4407,
-        "NAD27 / BLM 7N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-141 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 7N (ftUS)\",GEOGCS[\"NAD27\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",6");
-    add_srs_wkt (p, 2,
-        "378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 6,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4267");
-    add_srs_wkt (p, 7,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-141");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",1640416.67],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"4407\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4408, "epsg", 4408,
-        "NAD27 / BLM 8N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-135 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 8N (ftUS)\",GEOGCS[\"NAD27\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",6");
-    add_srs_wkt (p, 2,
-        "378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 6,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4267");
-    add_srs_wkt (p, 7,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-135");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",1640416.67],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"4408\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4409, "epsg", 4409,
-        "NAD27 / BLM 9N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-129 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 9N (ftUS)\",GEOGCS[\"NAD27\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",6");
-    add_srs_wkt (p, 2,
-        "378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 6,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4267");
-    add_srs_wkt (p, 7,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-129");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",1640416.67],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"4409\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4410, "epsg", 4410,
-        "NAD27 / BLM 10N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-123 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 10N (ftUS)\",GEOGCS[\"NAD27\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 6,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 7,
-        "7\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",-12");
-    add_srs_wkt (p, 9,
-        "3],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",1640416.67],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"4410\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4411, "epsg", 4411,
-        "NAD27 / BLM 11N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-117 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 11N (ftUS)\",GEOGCS[\"NAD27\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 6,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 7,
-        "7\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",-11");
-    add_srs_wkt (p, 9,
-        "7],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",1640416.67],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"4411\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4412, "epsg", 4412,
-        "NAD27 / BLM 12N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-111 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 12N (ftUS)\",GEOGCS[\"NAD27\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 6,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 7,
-        "7\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",-11");
-    add_srs_wkt (p, 9,
-        "1],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",1640416.67],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"4412\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4413, "epsg", 4413,
-        "NAD27 / BLM 13N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-105 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 13N (ftUS)\",GEOGCS[\"NAD27\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 6,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 7,
-        "7\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",-10");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",1640416.67],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"4413\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4414, "epsg", 4414,
-        "NAD83(HARN) / Guam Map Grid", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=13.5 +lon_0=144.75 +k=1 +x_0=100000 +");
-    add_proj4text (p, 1,
-        "y_0=200000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Guam Map Grid\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",1");
-    add_srs_wkt (p, 9,
-        "3.5],PARAMETER[\"central_meridian\",144.75],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",200000],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 13,
-        "RTH],AUTHORITY[\"EPSG\",\"4414\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4415, "epsg", 4415,
-        "Katanga 1955 / Katanga Lambert", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "Katanga_1955", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-6.5 +lat_2=-11.5 +lat_0=-9 +lon_0=26 +");
-    add_proj4text (p, 1,
-        "x_0=500000 +y_0=500000 +ellps=clrk66 +towgs84=-103.746,-");
-    add_proj4text (p, 2,
-        "9.614,-255.95,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Katanga 1955 / Katanga Lambert\",GEOGCS[\"Katan");
-    add_srs_wkt (p, 1,
-        "ga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\"Clarke 1866\"");
-    add_srs_wkt (p, 2,
-        ",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[-103.746,-9.614,-255.95,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6695\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4695\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard");
-    add_srs_wkt (p, 9,
-        "_parallel_1\",-6.5],PARAMETER[\"standard_parallel_2\",-1");
-    add_srs_wkt (p, 10,
-        "1.5],PARAMETER[\"latitude_of_origin\",-9],PARAMETER[\"ce");
-    add_srs_wkt (p, 11,
-        "ntral_meridian\",26],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 12,
-        ",PARAMETER[\"false_northing\",500000],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"4415\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4417, "epsg", 4417,
-        "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 7", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942_83", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=7500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=26,-121,-78,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 7");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],TOWGS84[26,-121,-78,0,0,0,0],AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"6178\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 7,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4178\"]],PROJE");
-    add_srs_wkt (p, 8,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 9,
-        "rigin\",0],PARAMETER[\"central_meridian\",21],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"scale_factor\",1],PARAMETER[\"false_easting\",7500000]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAS");
-    add_srs_wkt (p, 13,
-        "T],AUTHORITY[\"EPSG\",\"4417\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4418, "epsg", 4418,
-        "NAD27 / BLM 18N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-75 +k=0.9996 +x_0=500000.00");
-    add_proj4text (p, 1,
-        "1016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 18N (ftUS)\",GEOGCS[\"NAD27\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 6,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 7,
-        "7\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",-75");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",1640416.67],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"4418\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4419, "epsg", 4419,
-        "NAD27 / BLM 19N (ftUS)", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-69 +k=0.9996 +x_0=500000.00");
-    add_proj4text (p, 1,
-        "1016002 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / BLM 19N (ftUS)\",GEOGCS[\"NAD27\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 6,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 7,
-        "7\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",-69");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",1640416.67],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"4419\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4420, "epsg", 4420,
-        "NAD83 / BLM 60N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=177 +k=0.9996 +x_0=500000.00");
-    add_proj4text (p, 1,
-        "1016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 60N (ftUS)\",GEOGCS[\"NAD83\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637");
-    add_srs_wkt (p, 2,
-        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",177],PARAMETER[\"scale_factor\",0.9996],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",1640416.67],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",0],UNIT[\"US survey foot\",0.3048006096012192,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"4420\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4421, "epsg", 4421,
-        "NAD83 / BLM 1N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-177 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 1N (ftUS)\",GEOGCS[\"NAD83\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-177],PARAMETER[\"scale_factor\",0.9996],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",1640416.67],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"US survey foot\",0.3048006096012192,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 13,
-        "RTH],AUTHORITY[\"EPSG\",\"4421\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4422, "epsg", 4422,
-        "NAD83 / BLM 2N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-171 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 2N (ftUS)\",GEOGCS[\"NAD83\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-171],PARAMETER[\"scale_factor\",0.9996],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",1640416.67],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"US survey foot\",0.3048006096012192,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 13,
-        "RTH],AUTHORITY[\"EPSG\",\"4422\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4423, "epsg", 4423,
-        "NAD83 / BLM 3N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-165 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 3N (ftUS)\",GEOGCS[\"NAD83\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-165],PARAMETER[\"scale_factor\",0.9996],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",1640416.67],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"US survey foot\",0.3048006096012192,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 13,
-        "RTH],AUTHORITY[\"EPSG\",\"4423\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4424, "epsg", 4424,
-        "NAD83 / BLM 4N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-159 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 4N (ftUS)\",GEOGCS[\"NAD83\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-159],PARAMETER[\"scale_factor\",0.9996],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",1640416.67],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"US survey foot\",0.3048006096012192,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 13,
-        "RTH],AUTHORITY[\"EPSG\",\"4424\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4425, "epsg", 4425,
-        "NAD83 / BLM 5N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-153 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 5N (ftUS)\",GEOGCS[\"NAD83\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-153],PARAMETER[\"scale_factor\",0.9996],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",1640416.67],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"US survey foot\",0.3048006096012192,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 13,
-        "RTH],AUTHORITY[\"EPSG\",\"4425\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4426, "epsg", 4426,
-        "NAD83 / BLM 6N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-147 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 6N (ftUS)\",GEOGCS[\"NAD83\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-147],PARAMETER[\"scale_factor\",0.9996],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",1640416.67],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"US survey foot\",0.3048006096012192,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 13,
-        "RTH],AUTHORITY[\"EPSG\",\"4426\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4427, "epsg", 4427,
-        "NAD83 / BLM 7N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-141 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 7N (ftUS)\",GEOGCS[\"NAD83\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-141],PARAMETER[\"scale_factor\",0.9996],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",1640416.67],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"US survey foot\",0.3048006096012192,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 13,
-        "RTH],AUTHORITY[\"EPSG\",\"4427\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4428, "epsg", 4428,
-        "NAD83 / BLM 8N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-135 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 8N (ftUS)\",GEOGCS[\"NAD83\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-135],PARAMETER[\"scale_factor\",0.9996],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",1640416.67],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"US survey foot\",0.3048006096012192,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 13,
-        "RTH],AUTHORITY[\"EPSG\",\"4428\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4429, "epsg", 4429,
-        "NAD83 / BLM 9N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-129 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 9N (ftUS)\",GEOGCS[\"NAD83\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-129],PARAMETER[\"scale_factor\",0.9996],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",1640416.67],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"US survey foot\",0.3048006096012192,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 13,
-        "RTH],AUTHORITY[\"EPSG\",\"4429\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4430, "epsg", 4430,
-        "NAD83 / BLM 10N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-123 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 10N (ftUS)\",GEOGCS[\"NAD83\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637");
-    add_srs_wkt (p, 2,
-        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",-123],PARAMETER[\"scale_factor\",0.9996],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_easting\",1640416.67],PARAMETER[\"false_no");
-    add_srs_wkt (p, 11,
-        "rthing\",0],UNIT[\"US survey foot\",0.3048006096012192,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"4430\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4431, "epsg", 4431,
-        "NAD83 / BLM 11N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-117 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 11N (ftUS)\",GEOGCS[\"NAD83\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637");
-    add_srs_wkt (p, 2,
-        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",-117],PARAMETER[\"scale_factor\",0.9996],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_easting\",1640416.67],PARAMETER[\"false_no");
-    add_srs_wkt (p, 11,
-        "rthing\",0],UNIT[\"US survey foot\",0.3048006096012192,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"4431\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4432, "epsg", 4432,
-        "NAD83 / BLM 12N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-111 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 12N (ftUS)\",GEOGCS[\"NAD83\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637");
-    add_srs_wkt (p, 2,
-        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",-111],PARAMETER[\"scale_factor\",0.9996],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_easting\",1640416.67],PARAMETER[\"false_no");
-    add_srs_wkt (p, 11,
-        "rthing\",0],UNIT[\"US survey foot\",0.3048006096012192,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"4432\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4433, "epsg", 4433,
-        "NAD83 / BLM 13N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-105 +k=0.9996 +x_0=500000.0");
-    add_proj4text (p, 1,
-        "01016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 13N (ftUS)\",GEOGCS[\"NAD83\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637");
-    add_srs_wkt (p, 2,
-        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",-105],PARAMETER[\"scale_factor\",0.9996],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_easting\",1640416.67],PARAMETER[\"false_no");
-    add_srs_wkt (p, 11,
-        "rthing\",0],UNIT[\"US survey foot\",0.3048006096012192,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"4433\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4434, "epsg", 4434,
-        "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 8", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Pulkovo_1942_83", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=8500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=26,-121,-78,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 8");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],TOWGS84[26,-121,-78,0,0,0,0],AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"6178\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 7,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4178\"]],PROJE");
-    add_srs_wkt (p, 8,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 9,
-        "rigin\",0],PARAMETER[\"central_meridian\",24],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"scale_factor\",1],PARAMETER[\"false_easting\",8500000]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAS");
-    add_srs_wkt (p, 13,
-        "T],AUTHORITY[\"EPSG\",\"4434\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4437, "epsg", 4437,
-        "NAD83(NSRS2007) / Puerto Rico and Virgin Is.", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=18.43333333333333 +lat_2=18.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=17.83333333333333 +lon_0=-66.43333333333334 +");
-    add_proj4text (p, 2,
-        "x_0=200000 +y_0=200000 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 3,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Puerto Rico and Virgin Is.\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatia");
-    add_srs_wkt (p, 2,
-        "l_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,");
-    add_srs_wkt (p, 3,
-        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,");
-    add_srs_wkt (p, 4,
-        "0,0,0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 5,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 6,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 7,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 8,
-        "G\",\"4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",18.43333333333333],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"standard_parallel_2\",18.03333333333333],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"latitude_of_origin\",17.83333333333333],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"central_meridian\",-66.43333333333334],PARAMETER[\"f");
-    add_srs_wkt (p, 13,
-        "alse_easting\",200000],PARAMETER[\"false_northing\",2000");
-    add_srs_wkt (p, 14,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 15,
-        "\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"4437\"");
-    add_srs_wkt (p, 16,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4438, "epsg", 4438,
-        "NAD83 / BLM 18N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-75 +k=0.9996 +x_0=500000.00");
-    add_proj4text (p, 1,
-        "1016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 18N (ftUS)\",GEOGCS[\"NAD83\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637");
-    add_srs_wkt (p, 2,
-        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",-75],PARAMETER[\"scale_factor\",0.9996],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",1640416.67],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",0],UNIT[\"US survey foot\",0.3048006096012192,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"4438\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4439, "epsg", 4439,
-        "NAD83 / BLM 19N (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-69 +k=0.9996 +x_0=500000.00");
-    add_proj4text (p, 1,
-        "1016002 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BLM 19N (ftUS)\",GEOGCS[\"NAD83\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637");
-    add_srs_wkt (p, 2,
-        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",-69],PARAMETER[\"scale_factor\",0.9996],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",1640416.67],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",0],UNIT[\"US survey foot\",0.3048006096012192,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"4439\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4455, "epsg", 4455,
-        "NAD27 / Pennsylvania South", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=609601.2");
-    add_proj4text (p, 2,
-        "192024384 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Pennsylvania South\",GEOGCS[\"NAD27\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"North_American_Datum_1927\",SPHEROID[\"Clarke 186");
-    add_srs_wkt (p, 2,
-        "6\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"700");
-    add_srs_wkt (p, 3,
-        "8\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 6,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4267\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"standard_parallel_1\",40.96666666666667],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_2\",39.93333333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"latitude_of_origin\",39.33333333333334],PARAMETER[\"c");
-    add_srs_wkt (p, 11,
-        "entral_meridian\",-77.75],PARAMETER[\"false_easting\",20");
-    add_srs_wkt (p, 12,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"US survey ");
-    add_srs_wkt (p, 13,
-        "foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 15,
-        "4455\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4456, "epsg", 4456,
-        "NAD27 / New York Long Island", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=40.5 +lon_0=-74 +x_0=609601.2192024384 +y_0=3");
-    add_proj4text (p, 2,
-        "0480.06096012192 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / New York Long Island\",GEOGCS[\"NAD27\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1927\",SPHEROID[\"Clarke 1");
-    add_srs_wkt (p, 2,
-        "866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 6,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4267\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"standard_parallel_1\",41.03333333333333],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_2\",40.66666666666666],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"latitude_of_origin\",40.5],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 11,
-        "idian\",-74],PARAMETER[\"false_easting\",2000000],PARAME");
-    add_srs_wkt (p, 12,
-        "TER[\"false_northing\",100000],UNIT[\"US survey foot\",0");
-    add_srs_wkt (p, 13,
-        ".3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X");
-    add_srs_wkt (p, 14,
-        "\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"4456\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4457, "epsg", 4457,
-        "NAD83 / South Dakota North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no");
-    add_proj4text (p, 3,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / South Dakota North (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4269\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",45.6");
-    add_srs_wkt (p, 9,
-        "8333333333333],PARAMETER[\"standard_parallel_2\",44.4166");
-    add_srs_wkt (p, 10,
-        "6666666666],PARAMETER[\"latitude_of_origin\",43.83333333");
-    add_srs_wkt (p, 11,
-        "333334],PARAMETER[\"central_meridian\",-100],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_easting\",1968500],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 13,
-        ",UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 15,
-        "HORITY[\"EPSG\",\"4457\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4462, "epsg", 4462,
-        "WGS 84 / Australian Centre for Remote Sensing Lambert", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-18 +lat_2=-36 +lat_0=-27 +lon_0=132 +x");
-    add_proj4text (p, 1,
-        "_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Australian Centre for Remote Sensing L");
-    add_srs_wkt (p, 1,
-        "ambert\",GEOGCS[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4326\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"standard_parallel_1\",-18],PARAMETER[\"standard");
-    add_srs_wkt (p, 9,
-        "_parallel_2\",-36],PARAMETER[\"latitude_of_origin\",-27]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"central_meridian\",132],PARAMETER[\"false_e");
-    add_srs_wkt (p, 11,
-        "asting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 12,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"4462\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4463, "epsg", 4463,
-        "RGSPM06", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Reseau_Geodesique_de_Saint_Pierre_et_Miquelon_2006", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"RGSPM06\",DATUM[\"Reseau_Geodesique_de_Saint_Pi");
-    add_srs_wkt (p, 1,
-        "erre_et_Miquelon_2006\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 2,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0],AUTHORITY[\"EPSG\",\"1038\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati");
-    add_srs_wkt (p, 6,
-        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4463\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4467, "epsg", 4467,
-        "RGSPM06 / UTM zone 21N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Reseau_Geodesique_de_Saint_Pierre_et_Miquelon_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGSPM06 / UTM zone 21N\",GEOGCS[\"RGSPM06\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Reseau_Geodesique_de_Saint_Pierre_et_Miquelon_2006\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"1038\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4463\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 9,
-        ",0],PARAMETER[\"central_meridian\",-57],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 13,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"4467\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4470, "epsg", 4470,
-        "RGM04", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Reseau_Geodesique_de_Mayotte_2004", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"RGM04\",DATUM[\"Reseau_Geodesique_de_Mayotte_20");
-    add_srs_wkt (p, 1,
-        "04\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 2,
-        "TY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"1036\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[");
-    add_srs_wkt (p, 6,
-        "\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4470\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4471, "epsg", 4471,
-        "RGM04 / UTM zone 38S", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Reseau_Geodesique_de_Mayotte_2004", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGM04 / UTM zone 38S\",GEOGCS[\"RGM04\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Reseau_Geodesique_de_Mayotte_2004\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1036\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4470\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",45],PARAMETER[\"scale_factor\",0.9996],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 11,
-        "hing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"4471\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4474, "epsg", 4474,
-        "Cadastre 1997 / UTM zone 38S (deprecated)", 0, 0,
-        "International 1924", "Greenwich",
-        "Combani_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +south +ellps=intl +towgs84=-382,-59,");
-    add_proj4text (p, 1,
-        "-262,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cadastre 1997 / UTM zone 38S (deprecated)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Combani 1950\",DATUM[\"Combani_1950\",SPHEROID[\"I");
-    add_srs_wkt (p, 2,
-        "nternational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "2\"]],TOWGS84[-382,-59,-262,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6632\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4632\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"central_meridian\",45],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 13,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"4474\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4475, "epsg", 4475,
-        "Cadastre 1997", 1, 1,
-        "International 1924", "Greenwich",
-        "Cadastre_1997", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-381.788,-57.501,-256");
-    add_proj4text (p, 1,
-        ".673,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Cadastre 1997\",DATUM[\"Cadastre_1997\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 2,
-        "\"7022\"]],TOWGS84[-381.788,-57.501,-256.673,0,0,0,0],AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"1037\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 5,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORT");
-    add_srs_wkt (p, 6,
-        "H],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4475\"]");
-    add_srs_wkt (p, 7,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 4483, "epsg", 4483,
-        "Mexico ITRF92", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Mexico_ITRF92", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Mexico ITRF92\",DATUM[\"Mexico_ITRF92\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 2,
-        "\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 3,
-        "042\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 6,
-        ",EAST],AUTHORITY[\"EPSG\",\"4483\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4484, "epsg", 4484,
-        "Mexico ITRF92 / UTM zone 11N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Mexico_ITRF92", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=11 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mexico ITRF92 / UTM zone 11N\",GEOGCS[\"Mexico ");
-    add_srs_wkt (p, 1,
-        "ITRF92\",DATUM[\"Mexico_ITRF92\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 2,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS");
-    add_srs_wkt (p, 3,
-        "84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1042\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4483\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",-117],PARAMETER[\"scale_factor\",0.9996],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_easting\",500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"4484\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4485, "epsg", 4485,
-        "Mexico ITRF92 / UTM zone 12N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Mexico_ITRF92", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=12 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mexico ITRF92 / UTM zone 12N\",GEOGCS[\"Mexico ");
-    add_srs_wkt (p, 1,
-        "ITRF92\",DATUM[\"Mexico_ITRF92\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 2,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS");
-    add_srs_wkt (p, 3,
-        "84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1042\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4483\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",-111],PARAMETER[\"scale_factor\",0.9996],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_easting\",500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"4485\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4486, "epsg", 4486,
-        "Mexico ITRF92 / UTM zone 13N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Mexico_ITRF92", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=13 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mexico ITRF92 / UTM zone 13N\",GEOGCS[\"Mexico ");
-    add_srs_wkt (p, 1,
-        "ITRF92\",DATUM[\"Mexico_ITRF92\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 2,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS");
-    add_srs_wkt (p, 3,
-        "84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1042\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4483\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",-105],PARAMETER[\"scale_factor\",0.9996],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_easting\",500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"4486\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4487, "epsg", 4487,
-        "Mexico ITRF92 / UTM zone 14N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Mexico_ITRF92", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=14 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mexico ITRF92 / UTM zone 14N\",GEOGCS[\"Mexico ");
-    add_srs_wkt (p, 1,
-        "ITRF92\",DATUM[\"Mexico_ITRF92\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 2,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS");
-    add_srs_wkt (p, 3,
-        "84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1042\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4483\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",-99],PARAMETER[\"scale_factor\",0.9996],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 11,
-        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"4487\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4488, "epsg", 4488,
-        "Mexico ITRF92 / UTM zone 15N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Mexico_ITRF92", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=15 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mexico ITRF92 / UTM zone 15N\",GEOGCS[\"Mexico ");
-    add_srs_wkt (p, 1,
-        "ITRF92\",DATUM[\"Mexico_ITRF92\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 2,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS");
-    add_srs_wkt (p, 3,
-        "84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1042\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4483\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",-93],PARAMETER[\"scale_factor\",0.9996],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 11,
-        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"4488\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4489, "epsg", 4489,
-        "Mexico ITRF92 / UTM zone 16N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Mexico_ITRF92", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=16 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mexico ITRF92 / UTM zone 16N\",GEOGCS[\"Mexico ");
-    add_srs_wkt (p, 1,
-        "ITRF92\",DATUM[\"Mexico_ITRF92\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 2,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS");
-    add_srs_wkt (p, 3,
-        "84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1042\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4483\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",-87],PARAMETER[\"scale_factor\",0.9996],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 11,
-        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"4489\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4490, "epsg", 4490,
-        "China Geodetic Coordinate System 2000", 1, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"China Geodetic Coordinate System 2000\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "China_2000\",SPHEROID[\"CGCS2000\",6378137,298.257222101");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 6,
-        "AST],AUTHORITY[\"EPSG\",\"4490\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4491, "epsg", 4491,
-        "CGCS2000 / Gauss-Kruger zone 13", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=13500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger zone 13\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",75],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",13500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4491\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4492, "epsg", 4492,
-        "CGCS2000 / Gauss-Kruger zone 14", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=14500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger zone 14\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",81],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",14500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4492\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4493, "epsg", 4493,
-        "CGCS2000 / Gauss-Kruger zone 15", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=15500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger zone 15\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",87],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",15500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4493\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4494, "epsg", 4494,
-        "CGCS2000 / Gauss-Kruger zone 16", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=16500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger zone 16\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",93],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",16500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4494\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4495, "epsg", 4495,
-        "CGCS2000 / Gauss-Kruger zone 17", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=17500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger zone 17\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",99],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",17500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4495\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4496, "epsg", 4496,
-        "CGCS2000 / Gauss-Kruger zone 18", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=18500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger zone 18\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",105],PARAMETER[\"scale_factor\",1],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",18500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4496\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4497, "epsg", 4497,
-        "CGCS2000 / Gauss-Kruger zone 19", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=19500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger zone 19\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",111],PARAMETER[\"scale_factor\",1],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",19500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4497\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4498, "epsg", 4498,
-        "CGCS2000 / Gauss-Kruger zone 20", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=20500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger zone 20\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",117],PARAMETER[\"scale_factor\",1],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",20500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4498\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4499, "epsg", 4499,
-        "CGCS2000 / Gauss-Kruger zone 21", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=21500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger zone 21\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",123],PARAMETER[\"scale_factor\",1],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",21500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4499\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4500, "epsg", 4500,
-        "CGCS2000 / Gauss-Kruger zone 22", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=22500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger zone 22\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",129],PARAMETER[\"scale_factor\",1],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",22500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4500\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4501, "epsg", 4501,
-        "CGCS2000 / Gauss-Kruger zone 23", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=23500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger zone 23\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",135],PARAMETER[\"scale_factor\",1],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",23500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4501\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4502, "epsg", 4502,
-        "CGCS2000 / Gauss-Kruger CM 75E", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger CM 75E\",GEOGCS[\"China");
-    add_srs_wkt (p, 1,
-        " Geodetic Coordinate System 2000\",DATUM[\"China_2000\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",75],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4502\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 4503, "epsg", 4503,
-        "CGCS2000 / Gauss-Kruger CM 81E", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger CM 81E\",GEOGCS[\"China");
-    add_srs_wkt (p, 1,
-        " Geodetic Coordinate System 2000\",DATUM[\"China_2000\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",81],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4503\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 4504, "epsg", 4504,
-        "CGCS2000 / Gauss-Kruger CM 87E", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger CM 87E\",GEOGCS[\"China");
-    add_srs_wkt (p, 1,
-        " Geodetic Coordinate System 2000\",DATUM[\"China_2000\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",87],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4504\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 4505, "epsg", 4505,
-        "CGCS2000 / Gauss-Kruger CM 93E", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger CM 93E\",GEOGCS[\"China");
-    add_srs_wkt (p, 1,
-        " Geodetic Coordinate System 2000\",DATUM[\"China_2000\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",93],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4505\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 4506, "epsg", 4506,
-        "CGCS2000 / Gauss-Kruger CM 99E", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger CM 99E\",GEOGCS[\"China");
-    add_srs_wkt (p, 1,
-        " Geodetic Coordinate System 2000\",DATUM[\"China_2000\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",99],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4506\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 4507, "epsg", 4507,
-        "CGCS2000 / Gauss-Kruger CM 105E", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger CM 105E\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",105],PARAMETER[\"scale_factor\",1],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4507\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 4508, "epsg", 4508,
-        "CGCS2000 / Gauss-Kruger CM 111E", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger CM 111E\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",111],PARAMETER[\"scale_factor\",1],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4508\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 4509, "epsg", 4509,
-        "CGCS2000 / Gauss-Kruger CM 117E", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger CM 117E\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",117],PARAMETER[\"scale_factor\",1],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4509\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 4510, "epsg", 4510,
-        "CGCS2000 / Gauss-Kruger CM 123E", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger CM 123E\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",123],PARAMETER[\"scale_factor\",1],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4510\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 4511, "epsg", 4511,
-        "CGCS2000 / Gauss-Kruger CM 129E", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger CM 129E\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",129],PARAMETER[\"scale_factor\",1],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4511\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 4512, "epsg", 4512,
-        "CGCS2000 / Gauss-Kruger CM 135E", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / Gauss-Kruger CM 135E\",GEOGCS[\"Chin");
-    add_srs_wkt (p, 1,
-        "a Geodetic Coordinate System 2000\",DATUM[\"China_2000\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"CGCS2000\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",135],PARAMETER[\"scale_factor\",1],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4512\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 4513, "epsg", 4513,
-        "CGCS2000 / 3-degree Gauss-Kruger zone 25", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=25500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / 3-degree Gauss-Kruger zone 25\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"China Geodetic Coordinate System 2000\",DATUM[\"Chi");
-    add_srs_wkt (p, 2,
-        "na_2000\",SPHEROID[\"CGCS2000\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",75],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",25500000],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "1\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"4513\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4514, "epsg", 4514,
-        "CGCS2000 / 3-degree Gauss-Kruger zone 26", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=26500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / 3-degree Gauss-Kruger zone 26\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"China Geodetic Coordinate System 2000\",DATUM[\"Chi");
-    add_srs_wkt (p, 2,
-        "na_2000\",SPHEROID[\"CGCS2000\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",78],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",26500000],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "1\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"4514\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4515, "epsg", 4515,
-        "CGCS2000 / 3-degree Gauss-Kruger zone 27", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=27500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / 3-degree Gauss-Kruger zone 27\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"China Geodetic Coordinate System 2000\",DATUM[\"Chi");
-    add_srs_wkt (p, 2,
-        "na_2000\",SPHEROID[\"CGCS2000\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",81],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",27500000],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "1\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"4515\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4516, "epsg", 4516,
-        "CGCS2000 / 3-degree Gauss-Kruger zone 28", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=28500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / 3-degree Gauss-Kruger zone 28\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"China Geodetic Coordinate System 2000\",DATUM[\"Chi");
-    add_srs_wkt (p, 2,
-        "na_2000\",SPHEROID[\"CGCS2000\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",84],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",28500000],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "1\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"4516\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4517, "epsg", 4517,
-        "CGCS2000 / 3-degree Gauss-Kruger zone 29", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=29500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / 3-degree Gauss-Kruger zone 29\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"China Geodetic Coordinate System 2000\",DATUM[\"Chi");
-    add_srs_wkt (p, 2,
-        "na_2000\",SPHEROID[\"CGCS2000\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",87],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",29500000],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "1\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"4517\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4518, "epsg", 4518,
-        "CGCS2000 / 3-degree Gauss-Kruger zone 30", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=30500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / 3-degree Gauss-Kruger zone 30\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"China Geodetic Coordinate System 2000\",DATUM[\"Chi");
-    add_srs_wkt (p, 2,
-        "na_2000\",SPHEROID[\"CGCS2000\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",90],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",30500000],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "1\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"4518\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4519, "epsg", 4519,
-        "CGCS2000 / 3-degree Gauss-Kruger zone 31", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=31500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / 3-degree Gauss-Kruger zone 31\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"China Geodetic Coordinate System 2000\",DATUM[\"Chi");
-    add_srs_wkt (p, 2,
-        "na_2000\",SPHEROID[\"CGCS2000\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",93],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",31500000],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "1\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"4519\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4520, "epsg", 4520,
-        "CGCS2000 / 3-degree Gauss-Kruger zone 32", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=32500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / 3-degree Gauss-Kruger zone 32\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"China Geodetic Coordinate System 2000\",DATUM[\"Chi");
-    add_srs_wkt (p, 2,
-        "na_2000\",SPHEROID[\"CGCS2000\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",96],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",32500000],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "1\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"4520\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4521, "epsg", 4521,
-        "CGCS2000 / 3-degree Gauss-Kruger zone 33", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=33500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / 3-degree Gauss-Kruger zone 33\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"China Geodetic Coordinate System 2000\",DATUM[\"Chi");
-    add_srs_wkt (p, 2,
-        "na_2000\",SPHEROID[\"CGCS2000\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",99],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",33500000],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "1\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"4521\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4522, "epsg", 4522,
-        "CGCS2000 / 3-degree Gauss-Kruger zone 34", 0, 1,
-        "CGCS2000", "Greenwich",
-        "China_2000", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=34500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGCS2000 / 3-degree Gauss-Kruger zone 34\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"China Geodetic Coordinate System 2000\",DATUM[\"Chi");
-    add_srs_wkt (p, 2,
-        "na_2000\",SPHEROID[\"CGCS2000\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"1024\"]],AUTHORITY[\"EPSG\",\"1043\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4490\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"central_meridian\",102],PARAMETER[\"scale_factor\",1");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_easting\",34500000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "01\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 13,
-        "SG\",\"4522\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
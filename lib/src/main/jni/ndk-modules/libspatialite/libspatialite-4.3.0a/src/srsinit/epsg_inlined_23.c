@@ -1,2503 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_23 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 4644, "epsg", 4644,
-        "NEA74 Noumea", 1, 1,
-        "International 1924", "Greenwich",
-        "NEA74_Noumea", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-10.18,-350.43,291.37");
-    add_proj4text (p, 1,
-        ",0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NEA74 Noumea\",DATUM[\"NEA74_Noumea\",SPHEROID[");
-    add_srs_wkt (p, 1,
-        "\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 2,
-        "7022\"]],TOWGS84[-10.18,-350.43,291.37,0,0,0,0],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6644\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4644\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4645, "epsg", 4645,
-        "RGNC 1991", 1, 1,
-        "International 1924", "Greenwich",
-        "Reseau_Geodesique_Nouvelle_Caledonie_1991", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=0,0,0,0,0,0,0 +no_def");
-    add_proj4text (p, 1,
-        "s");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"RGNC 1991\",DATUM[\"Reseau_Geodesique_Nouvelle_");
-    add_srs_wkt (p, 1,
-        "Caledonie_1991\",SPHEROID[\"International 1924\",6378388");
-    add_srs_wkt (p, 2,
-        ",297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[0,0,0,0,0,0,0");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6645\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 6,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"464");
-    add_srs_wkt (p, 7,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4646, "epsg", 4646,
-        "Grand Comoros", 1, 1,
-        "International 1924", "Greenwich",
-        "Grand_Comoros", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-963,510,-359,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Grand Comoros\",DATUM[\"Grand_Comoros\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 2,
-        "\"7022\"]],TOWGS84[-963,510,-359,0,0,0,0],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"6646\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 6,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4646\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4647, "epsg", 4647,
-        "ETRS89 / UTM zone 32N (zE-N)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=0.9996 +x_0=32500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / UTM zone 32N (zE-N)\",GEOGCS[\"ETRS89\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",9],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",32500000],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 13,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"4647\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4652, "epsg", 4652,
-        "New Beijing / 3-degree Gauss-Kruger zone 25", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=25500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 25\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",7");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",25500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 11,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4652\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4653, "epsg", 4653,
-        "New Beijing / 3-degree Gauss-Kruger zone 26", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=26500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 26\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",7");
-    add_srs_wkt (p, 9,
-        "8],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",26500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 11,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4653\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4654, "epsg", 4654,
-        "New Beijing / 3-degree Gauss-Kruger zone 27", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=27500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 27\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",8");
-    add_srs_wkt (p, 9,
-        "1],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",27500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 11,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4654\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4655, "epsg", 4655,
-        "New Beijing / 3-degree Gauss-Kruger zone 28", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=28500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 28\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",8");
-    add_srs_wkt (p, 9,
-        "4],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",28500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 11,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4655\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4656, "epsg", 4656,
-        "New Beijing / 3-degree Gauss-Kruger zone 29", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=29500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 29\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",8");
-    add_srs_wkt (p, 9,
-        "7],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",29500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 11,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4656\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4657, "epsg", 4657,
-        "Reykjavik 1900", 1, 1,
-        "Danish 1876", "Greenwich",
-        "Reykjavik_1900", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377019.27 +b=6355762.5391 +towgs84=-28");
-    add_proj4text (p, 1,
-        ",199,5,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Reykjavik 1900\",DATUM[\"Reykjavik_1900\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"Danish 1876\",6377019.27,300,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 2,
-        "7051\"]],TOWGS84[-28,199,5,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6657\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 6,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4657\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4658, "epsg", 4658,
-        "Hjorsey 1955", 1, 1,
-        "International 1924", "Greenwich",
-        "Hjorsey_1955", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-73,46,-86,0,0,0,0 +n");
-    add_proj4text (p, 1,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Hjorsey 1955\",DATUM[\"Hjorsey_1955\",SPHEROID[");
-    add_srs_wkt (p, 1,
-        "\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 2,
-        "7022\"]],TOWGS84[-73,46,-86,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"6658\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 4,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 6,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4658\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4659, "epsg", 4659,
-        "ISN93", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Islands_Net_1993", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ISN93\",DATUM[\"Islands_Net_1993\",SPHEROID[\"G");
-    add_srs_wkt (p, 1,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 2,
-        "9\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6659\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 6,
-        "T],AUTHORITY[\"EPSG\",\"4659\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4660, "epsg", 4660,
-        "Helle 1954", 1, 1,
-        "International 1924", "Greenwich",
-        "Helle_1954", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=982.6087,552.753,-540");
-    add_proj4text (p, 1,
-        ".873,6.68162662527694,-31.6114924086422,-19.848161004816");
-    add_proj4text (p, 2,
-        "8,16.805 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Helle 1954\",DATUM[\"Helle_1954\",SPHEROID[\"In");
-    add_srs_wkt (p, 1,
-        "ternational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022");
-    add_srs_wkt (p, 2,
-        "\"]],TOWGS84[982.6087,552.753,-540.873,6.68162662527694,");
-    add_srs_wkt (p, 3,
-        "-31.6114924086422,-19.8481610048168,16.805],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6660\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4660\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4661, "epsg", 4661,
-        "LKS92", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Latvia_1992", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"LKS92\",DATUM[\"Latvia_1992\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 1,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 2,
-        ",TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6661\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 4,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 5,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4661\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4662, "epsg", 4662,
-        "IGN72 Grande Terre", 1, 1,
-        "International 1924", "Greenwich",
-        "IGN72_Grande_Terre", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-11.64,-348.6,291.98,");
-    add_proj4text (p, 1,
-        "0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IGN72 Grande Terre\",DATUM[\"IGN72_Grande_Terre");
-    add_srs_wkt (p, 1,
-        "\",SPHEROID[\"International 1924\",6378388,297,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7022\"]],TOWGS84[-11.64,-348.6,291.98,0,0,0,");
-    add_srs_wkt (p, 3,
-        "0],AUTHORITY[\"EPSG\",\"6634\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 7,
-        "62\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4663, "epsg", 4663,
-        "Porto Santo 1995", 1, 1,
-        "International 1924", "Greenwich",
-        "Porto_Santo_1995", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-502.862,-247.438,312");
-    add_proj4text (p, 1,
-        ".724,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Porto Santo 1995\",DATUM[\"Porto_Santo_1995\",S");
-    add_srs_wkt (p, 1,
-        "PHEROID[\"International 1924\",6378388,297,AUTHORITY[\"E");
-    add_srs_wkt (p, 2,
-        "PSG\",\"7022\"]],TOWGS84[-502.862,-247.438,312.724,0,0,0");
-    add_srs_wkt (p, 3,
-        ",0],AUTHORITY[\"EPSG\",\"6663\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 5,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 7,
-        "63\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4664, "epsg", 4664,
-        "Azores Oriental 1995", 1, 1,
-        "International 1924", "Greenwich",
-        "Azores_Oriental_Islands_1995", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-204.619,140.176,55.2");
-    add_proj4text (p, 1,
-        "26,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Azores Oriental 1995\",DATUM[\"Azores_Oriental_");
-    add_srs_wkt (p, 1,
-        "Islands_1995\",SPHEROID[\"International 1924\",6378388,2");
-    add_srs_wkt (p, 2,
-        "97,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-204.619,140.17");
-    add_srs_wkt (p, 3,
-        "6,55.226,0,0,0,0],AUTHORITY[\"EPSG\",\"6664\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4664\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4665, "epsg", 4665,
-        "Azores Central 1995", 1, 1,
-        "International 1924", "Greenwich",
-        "Azores_Central_Islands_1995", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-106.226,166.366,-37.");
-    add_proj4text (p, 1,
-        "893,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Azores Central 1995\",DATUM[\"Azores_Central_Is");
-    add_srs_wkt (p, 1,
-        "lands_1995\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-106.226,166.366,");
-    add_srs_wkt (p, 3,
-        "-37.893,0,0,0,0],AUTHORITY[\"EPSG\",\"6665\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4665\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4666, "epsg", 4666,
-        "Lisbon 1890", 1, 1,
-        "Bessel 1841", "Greenwich",
-        "Lisbon_1890", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=508.088,-191.042,56");
-    add_proj4text (p, 1,
-        "5.223,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Lisbon 1890\",DATUM[\"Lisbon_1890\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 2,
-        ",\"7004\"]],TOWGS84[508.088,-191.042,565.223,0,0,0,0],AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"6666\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 5,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORT");
-    add_srs_wkt (p, 6,
-        "H],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4666\"]");
-    add_srs_wkt (p, 7,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 4667, "epsg", 4667,
-        "IKBD-92", 1, 1,
-        "WGS 84", "Greenwich",
-        "Iraq_Kuwait_Boundary_Datum_1992", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IKBD-92\",DATUM[\"Iraq_Kuwait_Boundary_Datum_19");
-    add_srs_wkt (p, 1,
-        "92\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7030\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6667\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4667\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4668, "epsg", 4668,
-        "ED79", 1, 1,
-        "International 1924", "Greenwich",
-        "European_Datum_1979", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-86,-98,-119,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ED79\",DATUM[\"European_Datum_1979\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 2,
-        "22\"]],TOWGS84[-86,-98,-119,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"6668\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 4,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 6,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4668\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4669, "epsg", 4669,
-        "LKS94", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Lithuania_1994_ETRS89", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"LKS94\",DATUM[\"Lithuania_1994_ETRS89\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 2,
-        "\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "126\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 6,
-        ",EAST],AUTHORITY[\"EPSG\",\"4669\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4670, "epsg", 4670,
-        "IGM95", 1, 1,
-        "WGS 84", "Greenwich",
-        "Istituto_Geografico_Militaire_1995", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IGM95\",DATUM[\"Istituto_Geografico_Militaire_1");
-    add_srs_wkt (p, 1,
-        "995\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHORIT");
-    add_srs_wkt (p, 2,
-        "Y[\"EPSG\",\"7030\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6670\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4670\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4671, "epsg", 4671,
-        "Voirol 1879", 1, 1,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Voirol_1879", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378249.2 +b=6356515 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Voirol 1879\",DATUM[\"Voirol_1879\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "Clarke 1880 (IGN)\",6378249.2,293.4660212936269,AUTHORIT");
-    add_srs_wkt (p, 2,
-        "Y[\"EPSG\",\"7011\"]],AUTHORITY[\"EPSG\",\"6671\"]],PRIM");
-    add_srs_wkt (p, 3,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 4,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 5,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4671\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4672, "epsg", 4672,
-        "Chatham Islands 1971", 1, 1,
-        "International 1924", "Greenwich",
-        "Chatham_Islands_Datum_1971", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=175,-38,113,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Chatham Islands 1971\",DATUM[\"Chatham_Islands_");
-    add_srs_wkt (p, 1,
-        "Datum_1971\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[175,-38,113,0,0,0");
-    add_srs_wkt (p, 3,
-        ",0],AUTHORITY[\"EPSG\",\"6672\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 5,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 7,
-        "72\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4673, "epsg", 4673,
-        "Chatham Islands 1979", 1, 1,
-        "International 1924", "Greenwich",
-        "Chatham_Islands_Datum_1979", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=174.05,-25.49,112.57,");
-    add_proj4text (p, 1,
-        "0,0,0.554,0.2263 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Chatham Islands 1979\",DATUM[\"Chatham_Islands_");
-    add_srs_wkt (p, 1,
-        "Datum_1979\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[174.05,-25.49,112");
-    add_srs_wkt (p, 3,
-        ".57,0,0,0.554,0.2263],AUTHORITY[\"EPSG\",\"6673\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4673\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4674, "epsg", 4674,
-        "SIRGAS 2000", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"SIRGAS 2000\",DATUM[\"Sistema_de_Referencia_Geo");
-    add_srs_wkt (p, 1,
-        "centrico_para_las_AmericaS_2000\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWG");
-    add_srs_wkt (p, 3,
-        "S84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4674\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4675, "epsg", 4675,
-        "Guam 1963", 1, 1,
-        "Clarke 1866", "Greenwich",
-        "Guam_1963", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +towgs84=-100,-248,259,0,0,0");
-    add_proj4text (p, 1,
-        ",0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Guam 1963\",DATUM[\"Guam_1963\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 1,
-        "ke 1866\",6378206.4,294.9786982138982,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 2,
-        ",\"7008\"]],TOWGS84[-100,-248,259,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6675\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4675\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4676, "epsg", 4676,
-        "Vientiane 1982", 1, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Vientiane_1982", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=krass +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Vientiane 1982\",DATUM[\"Vientiane_1982\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 2,
-        ",\"7024\"]],AUTHORITY[\"EPSG\",\"6676\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 3,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 4,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 5,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4676\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4677, "epsg", 4677,
-        "Lao 1993", 1, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Lao_1993", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=krass +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Lao 1993\",DATUM[\"Lao_1993\",SPHEROID[\"Krasso");
-    add_srs_wkt (p, 1,
-        "wsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"6677\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 4,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 5,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4677\"");
-    add_srs_wkt (p, 6,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4678, "epsg", 4678,
-        "Lao 1997", 1, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Lao_National_Datum_1997", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=krass +towgs84=44.585,-131.212,-39.");
-    add_proj4text (p, 1,
-        "544,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Lao 1997\",DATUM[\"Lao_National_Datum_1997\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7024\"]],TOWGS84[44.585,-131.212,-39.544,0,0,0,0],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6678\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 6,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4678\"");
-    add_srs_wkt (p, 7,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4679, "epsg", 4679,
-        "Jouik 1961", 1, 1,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Jouik_1961", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +towgs84=-80.01,253.26,291.1");
-    add_proj4text (p, 1,
-        "9,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Jouik 1961\",DATUM[\"Jouik_1961\",SPHEROID[\"Cl");
-    add_srs_wkt (p, 1,
-        "arke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 2,
-        ",\"7012\"]],TOWGS84[-80.01,253.26,291.19,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6679\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4679\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4680, "epsg", 4680,
-        "Nouakchott 1965", 1, 1,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Nouakchott_1965", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +towgs84=124.5,-63.5,-281,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Nouakchott 1965\",DATUM[\"Nouakchott_1965\",SPH");
-    add_srs_wkt (p, 1,
-        "EROID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORIT");
-    add_srs_wkt (p, 2,
-        "Y[\"EPSG\",\"7012\"]],TOWGS84[124.5,-63.5,-281,0,0,0,0],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6680\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 6,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4680\"");
-    add_srs_wkt (p, 7,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4681, "epsg", 4681,
-        "Mauritania 1999", 1, 1,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Mauritania_1999", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Mauritania 1999\",DATUM[\"Mauritania_1999\",SPH");
-    add_srs_wkt (p, 1,
-        "EROID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORIT");
-    add_srs_wkt (p, 2,
-        "Y[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6681\"]],PRIM");
-    add_srs_wkt (p, 3,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 4,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 5,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4681\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4682, "epsg", 4682,
-        "Gulshan 303", 1, 1,
-        "Everest 1830 (1937 Adjustment)", "Greenwich",
-        "Gulshan_303", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377276.345 +b=6356075.413140239 +towgs");
-    add_proj4text (p, 1,
-        "84=283.7,735.9,261.1,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Gulshan 303\",DATUM[\"Gulshan_303\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "Everest 1830 (1937 Adjustment)\",6377276.345,300.8017,AU");
-    add_srs_wkt (p, 2,
-        "THORITY[\"EPSG\",\"7015\"]],TOWGS84[283.7,735.9,261.1,0,");
-    add_srs_wkt (p, 3,
-        "0,0,0],AUTHORITY[\"EPSG\",\"6682\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 6,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4682\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4683, "epsg", 4683,
-        "PRS92", 1, 1,
-        "Clarke 1866", "Greenwich",
-        "Philippine_Reference_System_1992", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +towgs84=-127.62,-67.24,-47.");
-    add_proj4text (p, 1,
-        "04,-3.068,4.903,1.578,-1.06 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"PRS92\",DATUM[\"Philippine_Reference_System_199");
-    add_srs_wkt (p, 1,
-        "2\",SPHEROID[\"Clarke 1866\",6378206.4,294.9786982138982");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7008\"]],TOWGS84[-127.62,-67.24,-4");
-    add_srs_wkt (p, 3,
-        "7.04,-3.068,4.903,1.578,-1.06],AUTHORITY[\"EPSG\",\"6683");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"4683\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4684, "epsg", 4684,
-        "Gan 1970", 1, 1,
-        "International 1924", "Greenwich",
-        "Gan_1970", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-133,-321,50,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Gan 1970\",DATUM[\"Gan_1970\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 1,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 2,
-        ",TOWGS84[-133,-321,50,0,0,0,0],AUTHORITY[\"EPSG\",\"6684");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 6,
-        "AST],AUTHORITY[\"EPSG\",\"4684\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4685, "epsg", 4685,
-        "Gandajika", 1, 1,
-        "International 1924", "Greenwich",
-        "Gandajika", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Gandajika\",DATUM[\"Gandajika\",SPHEROID[\"Inte");
-    add_srs_wkt (p, 1,
-        "rnational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"");
-    add_srs_wkt (p, 2,
-        "]],AUTHORITY[\"EPSG\",\"6685\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 4,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 5,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 6,
-        "85\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4686, "epsg", 4686,
-        "MAGNA-SIRGAS", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Marco_Geocentrico_Nacional_de_Referencia", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"MAGNA-SIRGAS\",DATUM[\"Marco_Geocentrico_Nacion");
-    add_srs_wkt (p, 1,
-        "al_de_Referencia\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 2,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0");
-    add_srs_wkt (p, 3,
-        ",0],AUTHORITY[\"EPSG\",\"6686\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 5,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 7,
-        "86\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4687, "epsg", 4687,
-        "RGPF", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Reseau_Geodesique_de_la_Polynesie_Francaise", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0.072,-0.507,-0.245,");
-    add_proj4text (p, 1,
-        "-0.0183,0.0003,-0.007,-0.0093 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"RGPF\",DATUM[\"Reseau_Geodesique_de_la_Polynesi");
-    add_srs_wkt (p, 1,
-        "e_Francaise\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 2,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0.072,-0.507,-0.");
-    add_srs_wkt (p, 3,
-        "245,-0.0183,0.0003,-0.007,-0.0093],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6687\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4687\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4688, "epsg", 4688,
-        "Fatu Iva 72", 1, 1,
-        "International 1924", "Greenwich",
-        "Fatu_Iva_72", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=347.103,1078.125,2623");
-    add_proj4text (p, 1,
-        ".922,-33.8875,70.6773,-9.3943,186.074 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Fatu Iva 72\",DATUM[\"Fatu_Iva_72\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 2,
-        "22\"]],TOWGS84[347.103,1078.125,2623.922,-33.8875,70.677");
-    add_srs_wkt (p, 3,
-        "3,-9.3943,186.074],AUTHORITY[\"EPSG\",\"6688\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4688\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4689, "epsg", 4689,
-        "IGN63 Hiva Oa", 1, 1,
-        "International 1924", "Greenwich",
-        "IGN63_Hiva_Oa", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=410.721,55.049,80.746");
-    add_proj4text (p, 1,
-        ",2.5779,2.3514,0.6664,17.3311 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IGN63 Hiva Oa\",DATUM[\"IGN63_Hiva_Oa\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 2,
-        "\"7022\"]],TOWGS84[410.721,55.049,80.746,2.5779,2.3514,0");
-    add_srs_wkt (p, 3,
-        ".6664,17.3311],AUTHORITY[\"EPSG\",\"6689\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4689\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4690, "epsg", 4690,
-        "Tahiti 79", 1, 1,
-        "International 1924", "Greenwich",
-        "Tahiti_79", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=221.525,152.948,176.7");
-    add_proj4text (p, 1,
-        "68,-2.3847,-1.3896,-0.877,11.4741 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Tahiti 79\",DATUM[\"Tahiti_79\",SPHEROID[\"Inte");
-    add_srs_wkt (p, 1,
-        "rnational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"");
-    add_srs_wkt (p, 2,
-        "]],TOWGS84[221.525,152.948,176.768,-2.3847,-1.3896,-0.87");
-    add_srs_wkt (p, 3,
-        "7,11.4741],AUTHORITY[\"EPSG\",\"6690\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 6,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"4690\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4691, "epsg", 4691,
-        "Moorea 87", 1, 1,
-        "International 1924", "Greenwich",
-        "Moorea_87", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=215.525,149.593,176.2");
-    add_proj4text (p, 1,
-        "29,-3.2624,-1.692,-1.1571,10.4773 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Moorea 87\",DATUM[\"Moorea_87\",SPHEROID[\"Inte");
-    add_srs_wkt (p, 1,
-        "rnational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"");
-    add_srs_wkt (p, 2,
-        "]],TOWGS84[215.525,149.593,176.229,-3.2624,-1.692,-1.157");
-    add_srs_wkt (p, 3,
-        "1,10.4773],AUTHORITY[\"EPSG\",\"6691\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 6,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"4691\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4692, "epsg", 4692,
-        "Maupiti 83", 1, 1,
-        "International 1924", "Greenwich",
-        "Maupiti_83", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=217.037,86.959,23.956");
-    add_proj4text (p, 1,
-        ",0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Maupiti 83\",DATUM[\"Maupiti_83\",SPHEROID[\"In");
-    add_srs_wkt (p, 1,
-        "ternational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022");
-    add_srs_wkt (p, 2,
-        "\"]],TOWGS84[217.037,86.959,23.956,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6692\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4692\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4693, "epsg", 4693,
-        "Nakhl-e Ghanem", 1, 1,
-        "WGS 84", "Greenwich",
-        "Nakhl_e_Ghanem", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,-0.15,0.68,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Nakhl-e Ghanem\",DATUM[\"Nakhl_e_Ghanem\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 2,
-        "\"7030\"]],TOWGS84[0,-0.15,0.68,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6693\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 6,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4693\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4694, "epsg", 4694,
-        "POSGAR 94", 1, 1,
-        "WGS 84", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1994", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"POSGAR 94\",DATUM[\"Posiciones_Geodesicas_Argen");
-    add_srs_wkt (p, 1,
-        "tinas_1994\",SPHEROID[\"WGS 84\",6378137,298.257223563,A");
-    add_srs_wkt (p, 2,
-        "UTHORITY[\"EPSG\",\"7030\"]],TOWGS84[0,0,0,0,0,0,0],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4694\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4695, "epsg", 4695,
-        "Katanga 1955", 1, 1,
-        "Clarke 1866", "Greenwich",
-        "Katanga_1955", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +towgs84=-103.746,-9.614,-25");
-    add_proj4text (p, 1,
-        "5.95,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Katanga 1955\",DATUM[\"Katanga_1955\",SPHEROID[");
-    add_srs_wkt (p, 1,
-        "\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7008\"]],TOWGS84[-103.746,-9.614,-255.95,0,0,0,");
-    add_srs_wkt (p, 3,
-        "0],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 7,
-        "95\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4696, "epsg", 4696,
-        "Kasai 1953", 1, 1,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Kasai_1953", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Kasai 1953\",DATUM[\"Kasai_1953\",SPHEROID[\"Cl");
-    add_srs_wkt (p, 1,
-        "arke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 2,
-        ",\"7012\"]],AUTHORITY[\"EPSG\",\"6696\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 3,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 4,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 5,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4696\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4697, "epsg", 4697,
-        "IGC 1962 6th Parallel South", 1, 1,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "IGC_1962_Arc_of_the_6th_Parallel_South", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IGC 1962 6th Parallel South\",DATUM[\"IGC_1962_");
-    add_srs_wkt (p, 1,
-        "Arc_of_the_6th_Parallel_South\",SPHEROID[\"Clarke 1880 (");
-    add_srs_wkt (p, 2,
-        "RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6697\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 6,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4697");
-    add_srs_wkt (p, 7,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4698, "epsg", 4698,
-        "IGN 1962 Kerguelen", 1, 1,
-        "International 1924", "Greenwich",
-        "IGN_1962_Kerguelen", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=145,-187,103,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IGN 1962 Kerguelen\",DATUM[\"IGN_1962_Kerguelen");
-    add_srs_wkt (p, 1,
-        "\",SPHEROID[\"International 1924\",6378388,297,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7022\"]],TOWGS84[145,-187,103,0,0,0,0],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6698\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4698\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4699, "epsg", 4699,
-        "Le Pouce 1934", 1, 1,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Le_Pouce_1934", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +towgs84=-770.1,158.4,-498.2");
-    add_proj4text (p, 1,
-        ",0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Le Pouce 1934\",DATUM[\"Le_Pouce_1934\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7012\"]],TOWGS84[-770.1,158.4,-498.2,0,0,0,0],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6699\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 6,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4699\"");
-    add_srs_wkt (p, 7,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4700, "epsg", 4700,
-        "IGN Astro 1960", 1, 1,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "IGN_Astro_1960", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IGN Astro 1960\",DATUM[\"IGN_Astro_1960\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[");
-    add_srs_wkt (p, 2,
-        "\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6700\"]],PRIMEM");
-    add_srs_wkt (p, 3,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 4,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 5,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4700\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4701, "epsg", 4701,
-        "IGCB 1955", 1, 1,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Institut_Geographique_du_Congo_Belge_1955", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +towgs84=-79.9,-158,-168.9,0");
-    add_proj4text (p, 1,
-        ",0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IGCB 1955\",DATUM[\"Institut_Geographique_du_Co");
-    add_srs_wkt (p, 1,
-        "ngo_Belge_1955\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.");
-    add_srs_wkt (p, 2,
-        "145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],TOWGS84[-79.9,");
-    add_srs_wkt (p, 3,
-        "-158,-168.9,0,0,0,0],AUTHORITY[\"EPSG\",\"6701\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 7,
-        "RITY[\"EPSG\",\"4701\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4702, "epsg", 4702,
-        "Mauritania 1999", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Mauritania_1999", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Mauritania 1999\",DATUM[\"Mauritania_1999\",SPH");
-    add_srs_wkt (p, 1,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6702\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 6,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4702\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4703, "epsg", 4703,
-        "Mhast 1951", 1, 1,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Missao_Hidrografico_Angola_y_Sao_Tome_1951", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Mhast 1951\",DATUM[\"Missao_Hidrografico_Angola");
-    add_srs_wkt (p, 1,
-        "_y_Sao_Tome_1951\",SPHEROID[\"Clarke 1880 (RGS)\",637824");
-    add_srs_wkt (p, 2,
-        "9.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6703\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4703\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4704, "epsg", 4704,
-        "Mhast (onshore)", 1, 1,
-        "International 1924", "Greenwich",
-        "Mhast_onshore", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Mhast (onshore)\",DATUM[\"Mhast_onshore\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 2,
-        ",\"7022\"]],AUTHORITY[\"EPSG\",\"6704\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 3,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 4,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 5,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4704\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4705, "epsg", 4705,
-        "Mhast (offshore)", 1, 1,
-        "International 1924", "Greenwich",
-        "Mhast_offshore", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Mhast (offshore)\",DATUM[\"Mhast_offshore\",SPH");
-    add_srs_wkt (p, 1,
-        "EROID[\"International 1924\",6378388,297,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7022\"]],AUTHORITY[\"EPSG\",\"6705\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 3,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 4,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 5,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"4705\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4706, "epsg", 4706,
-        "Egypt Gulf of Suez S-650 TL", 1, 1,
-        "Helmert 1906", "Greenwich",
-        "Egypt_Gulf_of_Suez_S_650_TL", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=helmert +towgs84=-146.21,112.63,4.0");
-    add_proj4text (p, 1,
-        "5,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Egypt Gulf of Suez S-650 TL\",DATUM[\"Egypt_Gul");
-    add_srs_wkt (p, 1,
-        "f_of_Suez_S_650_TL\",SPHEROID[\"Helmert 1906\",6378200,2");
-    add_srs_wkt (p, 2,
-        "98.3,AUTHORITY[\"EPSG\",\"7020\"]],TOWGS84[-146.21,112.6");
-    add_srs_wkt (p, 3,
-        "3,4.05,0,0,0,0],AUTHORITY[\"EPSG\",\"6706\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"4706\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4707, "epsg", 4707,
-        "Tern Island 1961", 1, 1,
-        "International 1924", "Greenwich",
-        "Tern_Island_1961", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=114,-116,-333,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Tern Island 1961\",DATUM[\"Tern_Island_1961\",S");
-    add_srs_wkt (p, 1,
-        "PHEROID[\"International 1924\",6378388,297,AUTHORITY[\"E");
-    add_srs_wkt (p, 2,
-        "PSG\",\"7022\"]],TOWGS84[114,-116,-333,0,0,0,0],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6707\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4707\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4708, "epsg", 4708,
-        "Cocos Islands 1965", 1, 1,
-        "Australian National Spheroid", "Greenwich",
-        "Cocos_Islands_1965", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=aust_SA +towgs84=-491,-22,435,0,0,0");
-    add_proj4text (p, 1,
-        ",0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Cocos Islands 1965\",DATUM[\"Cocos_Islands_1965");
-    add_srs_wkt (p, 1,
-        "\",SPHEROID[\"Australian National Spheroid\",6378160,298");
-    add_srs_wkt (p, 2,
-        ".25,AUTHORITY[\"EPSG\",\"7003\"]],TOWGS84[-491,-22,435,0");
-    add_srs_wkt (p, 3,
-        ",0,0,0],AUTHORITY[\"EPSG\",\"6708\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 6,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4708\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4709, "epsg", 4709,
-        "Iwo Jima 1945", 1, 1,
-        "International 1924", "Greenwich",
-        "Iwo_Jima_1945", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=145,75,-272,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Iwo Jima 1945\",DATUM[\"Iwo_Jima_1945\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 2,
-        "\"7022\"]],TOWGS84[145,75,-272,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6709\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 6,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4709\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4710, "epsg", 4710,
-        "St. Helena 1971", 1, 1,
-        "International 1924", "Greenwich",
-        "St_Helena_1971", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-320,550,-494,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"St. Helena 1971\",DATUM[\"St_Helena_1971\",SPHE");
-    add_srs_wkt (p, 1,
-        "ROID[\"International 1924\",6378388,297,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 2,
-        "\",\"7022\"]],TOWGS84[-320,550,-494,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6710\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4710\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4711, "epsg", 4711,
-        "Marcus Island 1952", 1, 1,
-        "International 1924", "Greenwich",
-        "Marcus_Island_1952", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=124,-234,-25,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Marcus Island 1952\",DATUM[\"Marcus_Island_1952");
-    add_srs_wkt (p, 1,
-        "\",SPHEROID[\"International 1924\",6378388,297,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7022\"]],TOWGS84[124,-234,-25,0,0,0,0],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6711\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4711\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4712, "epsg", 4712,
-        "Ascension Island 1958", 1, 1,
-        "International 1924", "Greenwich",
-        "Ascension_Island_1958", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-205,107,53,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Ascension Island 1958\",DATUM[\"Ascension_Islan");
-    add_srs_wkt (p, 1,
-        "d_1958\",SPHEROID[\"International 1924\",6378388,297,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7022\"]],TOWGS84[-205,107,53,0,0,0,0],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6712\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 6,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4712\"");
-    add_srs_wkt (p, 7,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4713, "epsg", 4713,
-        "Ayabelle Lighthouse", 1, 1,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Ayabelle_Lighthouse", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +towgs84=-79,-129,145,0,0,0,");
-    add_proj4text (p, 1,
-        "0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Ayabelle Lighthouse\",DATUM[\"Ayabelle_Lighthou");
-    add_srs_wkt (p, 1,
-        "se\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.465,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7012\"]],TOWGS84[-79,-129,145,0,0,0");
-    add_srs_wkt (p, 3,
-        ",0],AUTHORITY[\"EPSG\",\"6713\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 5,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"47");
-    add_srs_wkt (p, 7,
-        "13\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4714, "epsg", 4714,
-        "Bellevue", 1, 1,
-        "International 1924", "Greenwich",
-        "Bellevue", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-127,-769,472,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Bellevue\",DATUM[\"Bellevue\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 1,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 2,
-        ",TOWGS84[-127,-769,472,0,0,0,0],AUTHORITY[\"EPSG\",\"671");
-    add_srs_wkt (p, 3,
-        "4\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"4714\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4715, "epsg", 4715,
-        "Camp Area Astro", 1, 1,
-        "International 1924", "Greenwich",
-        "Camp_Area_Astro", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-104,-129,239,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Camp Area Astro\",DATUM[\"Camp_Area_Astro\",SPH");
-    add_srs_wkt (p, 1,
-        "EROID[\"International 1924\",6378388,297,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7022\"]],TOWGS84[-104,-129,239,0,0,0,0],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6715\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[");
-    add_srs_wkt (p, 6,
-        "\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4715\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4716, "epsg", 4716,
-        "Phoenix Islands 1966", 1, 1,
-        "International 1924", "Greenwich",
-        "Phoenix_Islands_1966", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=298,-304,-375,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Phoenix Islands 1966\",DATUM[\"Phoenix_Islands_");
-    add_srs_wkt (p, 1,
-        "1966\",SPHEROID[\"International 1924\",6378388,297,AUTHO");
-    add_srs_wkt (p, 2,
-        "RITY[\"EPSG\",\"7022\"]],TOWGS84[298,-304,-375,0,0,0,0],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6716\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 6,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4716\"");
-    add_srs_wkt (p, 7,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4717, "epsg", 4717,
-        "Cape Canaveral", 1, 1,
-        "Clarke 1866", "Greenwich",
-        "Cape_Canaveral", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +towgs84=-2,151,181,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Cape Canaveral\",DATUM[\"Cape_Canaveral\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"Clarke 1866\",6378206.4,294.9786982138982,AUTHORIT");
-    add_srs_wkt (p, 2,
-        "Y[\"EPSG\",\"7008\"]],TOWGS84[-2,151,181,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6717\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4717\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4718, "epsg", 4718,
-        "Solomon 1968", 1, 1,
-        "International 1924", "Greenwich",
-        "Solomon_1968", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=230,-199,-752,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Solomon 1968\",DATUM[\"Solomon_1968\",SPHEROID[");
-    add_srs_wkt (p, 1,
-        "\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 2,
-        "7022\"]],TOWGS84[230,-199,-752,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6718\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 6,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4718\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4719, "epsg", 4719,
-        "Easter Island 1967", 1, 1,
-        "International 1924", "Greenwich",
-        "Easter_Island_1967", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=211,147,111,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Easter Island 1967\",DATUM[\"Easter_Island_1967");
-    add_srs_wkt (p, 1,
-        "\",SPHEROID[\"International 1924\",6378388,297,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7022\"]],TOWGS84[211,147,111,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6719\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4719\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4720, "epsg", 4720,
-        "Fiji 1986", 1, 1,
-        "WGS 72", "Greenwich",
-        "Fiji_Geodetic_Datum_1986", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS72 +towgs84=0,0,4.5,0,0,0.554,0.");
-    add_proj4text (p, 1,
-        "2263 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Fiji 1986\",DATUM[\"Fiji_Geodetic_Datum_1986\",");
-    add_srs_wkt (p, 1,
-        "SPHEROID[\"WGS 72\",6378135,298.26,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 2,
-        "7043\"]],TOWGS84[0,0,4.5,0,0,0.554,0.2263],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6720\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4720\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4721, "epsg", 4721,
-        "Fiji 1956", 1, 1,
-        "International 1924", "Greenwich",
-        "Fiji_1956", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=265.025,384.929,-194.");
-    add_proj4text (p, 1,
-        "046,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Fiji 1956\",DATUM[\"Fiji_1956\",SPHEROID[\"Inte");
-    add_srs_wkt (p, 1,
-        "rnational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"");
-    add_srs_wkt (p, 2,
-        "]],TOWGS84[265.025,384.929,-194.046,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6721\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4721\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4722, "epsg", 4722,
-        "South Georgia 1968", 1, 1,
-        "International 1924", "Greenwich",
-        "South_Georgia_1968", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-794,119,-298,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"South Georgia 1968\",DATUM[\"South_Georgia_1968");
-    add_srs_wkt (p, 1,
-        "\",SPHEROID[\"International 1924\",6378388,297,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7022\"]],TOWGS84[-794,119,-298,0,0,0,0],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6722\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4722\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4723, "epsg", 4723,
-        "GCGD59", 1, 1,
-        "Clarke 1866", "Greenwich",
-        "Grand_Cayman_Geodetic_Datum_1959", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +towgs84=-179.483,-69.379,-2");
-    add_proj4text (p, 1,
-        "7.584,-7.862,8.163,6.042,-13.925 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"GCGD59\",DATUM[\"Grand_Cayman_Geodetic_Datum_19");
-    add_srs_wkt (p, 1,
-        "59\",SPHEROID[\"Clarke 1866\",6378206.4,294.978698213898");
-    add_srs_wkt (p, 2,
-        "2,AUTHORITY[\"EPSG\",\"7008\"]],TOWGS84[-179.483,-69.379");
-    add_srs_wkt (p, 3,
-        ",-27.584,-7.862,8.163,6.042,-13.925],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6723\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4723\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4724, "epsg", 4724,
-        "Diego Garcia 1969", 1, 1,
-        "International 1924", "Greenwich",
-        "Diego_Garcia_1969", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=208,-435,-229,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Diego Garcia 1969\",DATUM[\"Diego_Garcia_1969\"");
-    add_srs_wkt (p, 1,
-        ",SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7022\"]],TOWGS84[208,-435,-229,0,0,0,0],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6724\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AX");
-    add_srs_wkt (p, 6,
-        "IS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4724\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4725, "epsg", 4725,
-        "Johnston Island 1961", 1, 1,
-        "International 1924", "Greenwich",
-        "Johnston_Island_1961", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=189,-79,-202,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Johnston Island 1961\",DATUM[\"Johnston_Island_");
-    add_srs_wkt (p, 1,
-        "1961\",SPHEROID[\"International 1924\",6378388,297,AUTHO");
-    add_srs_wkt (p, 2,
-        "RITY[\"EPSG\",\"7022\"]],TOWGS84[189,-79,-202,0,0,0,0],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6725\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 6,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4725\"");
-    add_srs_wkt (p, 7,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4726, "epsg", 4726,
-        "SIGD61", 1, 1,
-        "Clarke 1866", "Greenwich",
-        "Sister_Islands_Geodetic_Datum_1961", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +towgs84=8.853,-52.644,180.3");
-    add_proj4text (p, 1,
-        "04,-0.393,-2.323,2.96,-24.081 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"SIGD61\",DATUM[\"Sister_Islands_Geodetic_Datum_");
-    add_srs_wkt (p, 1,
-        "1961\",SPHEROID[\"Clarke 1866\",6378206.4,294.9786982138");
-    add_srs_wkt (p, 2,
-        "982,AUTHORITY[\"EPSG\",\"7008\"]],TOWGS84[8.853,-52.644,");
-    add_srs_wkt (p, 3,
-        "180.304,-0.393,-2.323,2.96,-24.081],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6726\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4726\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4727, "epsg", 4727,
-        "Midway 1961", 1, 1,
-        "International 1924", "Greenwich",
-        "Midway_1961", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=403,-81,277,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Midway 1961\",DATUM[\"Midway_1961\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 2,
-        "22\"]],TOWGS84[403,-81,277,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6727\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 6,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4727\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4728, "epsg", 4728,
-        "Pico de las Nieves 1984", 1, 1,
-        "International 1924", "Greenwich",
-        "Pico_de_las_Nieves_1984", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-307,-92,127,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Pico de las Nieves 1984\",DATUM[\"Pico_de_las_N");
-    add_srs_wkt (p, 1,
-        "ieves_1984\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-307,-92,127,0,0,");
-    add_srs_wkt (p, 3,
-        "0,0],AUTHORITY[\"EPSG\",\"6728\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4728\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4729, "epsg", 4729,
-        "Pitcairn 1967", 1, 1,
-        "International 1924", "Greenwich",
-        "Pitcairn_1967", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=185,165,42,0,0,0,0 +n");
-    add_proj4text (p, 1,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Pitcairn 1967\",DATUM[\"Pitcairn_1967\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 2,
-        "\"7022\"]],TOWGS84[185,165,42,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6729\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 6,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4729\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4730, "epsg", 4730,
-        "Santo 1965", 1, 1,
-        "International 1924", "Greenwich",
-        "Santo_1965", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=170,42,84,0,0,0,0 +no");
-    add_proj4text (p, 1,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Santo 1965\",DATUM[\"Santo_1965\",SPHEROID[\"In");
-    add_srs_wkt (p, 1,
-        "ternational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022");
-    add_srs_wkt (p, 2,
-        "\"]],TOWGS84[170,42,84,0,0,0,0],AUTHORITY[\"EPSG\",\"673");
-    add_srs_wkt (p, 3,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"4730\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4731, "epsg", 4731,
-        "Viti Levu 1916", 1, 1,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Viti_Levu_1916", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +towgs84=51,391,-36,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Viti Levu 1916\",DATUM[\"Viti_Levu_1916\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[");
-    add_srs_wkt (p, 2,
-        "\"EPSG\",\"7012\"]],TOWGS84[51,391,-36,0,0,0,0],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6731\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4731\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4732, "epsg", 4732,
-        "Marshall Islands 1960", 1, 1,
-        "Hough 1960", "Greenwich",
-        "Marshall_Islands_1960", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378270 +b=6356794.343434343 +towgs84=1");
-    add_proj4text (p, 1,
-        "02,52,-38,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Marshall Islands 1960\",DATUM[\"Marshall_Island");
-    add_srs_wkt (p, 1,
-        "s_1960\",SPHEROID[\"Hough 1960\",6378270,297,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7053\"]],TOWGS84[102,52,-38,0,0,0,0],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6732\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[");
-    add_srs_wkt (p, 6,
-        "\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4732\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4733, "epsg", 4733,
-        "Wake Island 1952", 1, 1,
-        "International 1924", "Greenwich",
-        "Wake_Island_1952", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=276,-57,149,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Wake Island 1952\",DATUM[\"Wake_Island_1952\",S");
-    add_srs_wkt (p, 1,
-        "PHEROID[\"International 1924\",6378388,297,AUTHORITY[\"E");
-    add_srs_wkt (p, 2,
-        "PSG\",\"7022\"]],TOWGS84[276,-57,149,0,0,0,0],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6733\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[");
-    add_srs_wkt (p, 6,
-        "\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4733\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4734, "epsg", 4734,
-        "Tristan 1968", 1, 1,
-        "International 1924", "Greenwich",
-        "Tristan_1968", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-632,438,-609,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Tristan 1968\",DATUM[\"Tristan_1968\",SPHEROID[");
-    add_srs_wkt (p, 1,
-        "\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 2,
-        "7022\"]],TOWGS84[-632,438,-609,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6734\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 6,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4734\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4735, "epsg", 4735,
-        "Kusaie 1951", 1, 1,
-        "International 1924", "Greenwich",
-        "Kusaie_1951", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=647,1777,-1124,0,0,0,");
-    add_proj4text (p, 1,
-        "0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Kusaie 1951\",DATUM[\"Kusaie_1951\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 2,
-        "22\"]],TOWGS84[647,1777,-1124,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6735\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 6,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4735\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4736, "epsg", 4736,
-        "Deception Island", 1, 1,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Deception_Island", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +towgs84=260,12,-147,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Deception Island\",DATUM[\"Deception_Island\",S");
-    add_srs_wkt (p, 1,
-        "PHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7012\"]],TOWGS84[260,12,-147,0,0,0,0],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6736\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4736\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4737, "epsg", 4737,
-        "Korea 2000", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Geocentric_datum_of_Korea", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Korea 2000\",DATUM[\"Geocentric_datum_of_Korea\"");
-    add_srs_wkt (p, 1,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6737\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 6,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4737\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4738, "epsg", 4738,
-        "Hong Kong 1963", 1, 1,
-        "Clarke 1858", "Greenwich",
-        "Hong_Kong_1963", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378293.645208759 +b=6356617.987679838 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Hong Kong 1963\",DATUM[\"Hong_Kong_1963\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"Clarke 1858\",6378293.645208759,294.2606763692606,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7007\"]],AUTHORITY[\"EPSG\",\"6738\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 6,
-        "T],AUTHORITY[\"EPSG\",\"4738\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4739, "epsg", 4739,
-        "Hong Kong 1963(67)", 1, 1,
-        "International 1924", "Greenwich",
-        "Hong_Kong_1963_67", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-156,-271,-189,0,0,0,");
-    add_proj4text (p, 1,
-        "0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Hong Kong 1963(67)\",DATUM[\"Hong_Kong_1963_67\"");
-    add_srs_wkt (p, 1,
-        ",SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7022\"]],TOWGS84[-156,-271,-189,0,0,0,0],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6739\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4739\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4740, "epsg", 4740,
-        "PZ-90", 1, 1,
-        "PZ-90", "Greenwich",
-        "Parametrop_Zemp_1990", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378136 +b=6356751.361745712 +towgs84=0");
-    add_proj4text (p, 1,
-        ",0,1.5,0,0,0.076,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"PZ-90\",DATUM[\"Parametrop_Zemp_1990\",SPHEROID");
-    add_srs_wkt (p, 1,
-        "[\"PZ-90\",6378136,298.257839303,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 2,
-        "54\"]],TOWGS84[0,0,1.5,0,0,0.076,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6740\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 6,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4740\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4741, "epsg", 4741,
-        "FD54", 1, 1,
-        "International 1924", "Greenwich",
-        "Faroe_Datum_1954", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"FD54\",DATUM[\"Faroe_Datum_1954\",SPHEROID[\"In");
-    add_srs_wkt (p, 1,
-        "ternational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022");
-    add_srs_wkt (p, 2,
-        "\"]],AUTHORITY[\"EPSG\",\"6741\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 3,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 4,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 5,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4741\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4742, "epsg", 4742,
-        "GDM2000", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Geodetic_Datum_of_Malaysia_2000", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"GDM2000\",DATUM[\"Geodetic_Datum_of_Malaysia_20");
-    add_srs_wkt (p, 1,
-        "00\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 2,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6742\"]],PRI");
-    add_srs_wkt (p, 3,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 4,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 5,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4742\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4743, "epsg", 4743,
-        "Karbala 1979", 1, 1,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Karbala_1979", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +towgs84=70.995,-335.916,262");
-    add_proj4text (p, 1,
-        ".898,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Karbala 1979\",DATUM[\"Karbala_1979\",SPHEROID[");
-    add_srs_wkt (p, 1,
-        "\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EP");
-    add_srs_wkt (p, 2,
-        "SG\",\"7012\"]],TOWGS84[70.995,-335.916,262.898,0,0,0,0]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6743\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 6,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4743");
-    add_srs_wkt (p, 7,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4744, "epsg", 4744,
-        "Nahrwan 1934", 1, 1,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Nahrwan_1934", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Nahrwan 1934\",DATUM[\"Nahrwan_1934\",SPHEROID[");
-    add_srs_wkt (p, 1,
-        "\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EP");
-    add_srs_wkt (p, 2,
-        "SG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6744\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 3,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 4,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 5,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"4744\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4745, "epsg", 4745,
-        "RD/83", 1, 1,
-        "Bessel 1841", "Greenwich",
-        "Rauenberg_Datum_83", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"RD/83\",DATUM[\"Rauenberg_Datum_83\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 2,
-        ",\"7004\"]],AUTHORITY[\"EPSG\",\"6745\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 3,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 4,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 5,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4745\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4746, "epsg", 4746,
-        "PD/83", 1, 1,
-        "Bessel 1841", "Greenwich",
-        "Potsdam_Datum_83", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"PD/83\",DATUM[\"Potsdam_Datum_83\",SPHEROID[\"B");
-    add_srs_wkt (p, 1,
-        "essel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 2,
-        "\"7004\"]],AUTHORITY[\"EPSG\",\"6746\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 3,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 4,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 5,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4746\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4747, "epsg", 4747,
-        "GR96", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Greenland_1996", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"GR96\",DATUM[\"Greenland_1996\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 1,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 2,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6747\"]],");
-    add_srs_wkt (p, 3,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 4,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 5,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"4747\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4748, "epsg", 4748,
-        "Vanua Levu 1915", 1, 1,
-        "Clarke 1880 (international foot)", "Greenwich",
-        "Vanua_Levu_1915", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378306.3696 +b=6356571.996 +towgs84=51");
-    add_proj4text (p, 1,
-        ",391,-36,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Vanua Levu 1915\",DATUM[\"Vanua_Levu_1915\",SPH");
-    add_srs_wkt (p, 1,
-        "EROID[\"Clarke 1880 (international foot)\",6378306.3696,");
-    add_srs_wkt (p, 2,
-        "293.4663076556355,AUTHORITY[\"EPSG\",\"7055\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "51,391,-36,0,0,0,0],AUTHORITY[\"EPSG\",\"6748\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4748\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
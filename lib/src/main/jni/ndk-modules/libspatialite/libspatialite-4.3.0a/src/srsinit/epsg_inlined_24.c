@@ -1,3255 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_24 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 4749, "epsg", 4749,
-        "RGNC91-93", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Reseau_Geodesique_de_Nouvelle_Caledonie_91_93", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"RGNC91-93\",DATUM[\"Reseau_Geodesique_de_Nouvel");
-    add_srs_wkt (p, 1,
-        "le_Caledonie_91_93\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 2,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0");
-    add_srs_wkt (p, 3,
-        ",0,0],AUTHORITY[\"EPSG\",\"6749\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 6,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4749\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4750, "epsg", 4750,
-        "ST87 Ouvea", 1, 1,
-        "WGS 84", "Greenwich",
-        "ST87_Ouvea", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=-56.263,16.136,-22.8");
-    add_proj4text (p, 1,
-        "56,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ST87 Ouvea\",DATUM[\"ST87_Ouvea\",SPHEROID[\"WG");
-    add_srs_wkt (p, 1,
-        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"");
-    add_srs_wkt (p, 2,
-        "]],TOWGS84[-56.263,16.136,-22.856,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6750\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4750\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4751, "epsg", 4751,
-        "Kertau (RSO)", 1, 1,
-        "Everest 1830 (RSO 1969)", "Greenwich",
-        "Kertau_RSO", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377295.664 +b=6356094.667915204 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Kertau (RSO)\",DATUM[\"Kertau_RSO\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "Everest 1830 (RSO 1969)\",6377295.664,300.8017,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7056\"]],AUTHORITY[\"EPSG\",\"6751\"]],PRIME");
-    add_srs_wkt (p, 3,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 4,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 5,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 6,
-        "RITY[\"EPSG\",\"4751\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4752, "epsg", 4752,
-        "Viti Levu 1912", 1, 1,
-        "Clarke 1880 (international foot)", "Greenwich",
-        "Viti_Levu_1912", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378306.3696 +b=6356571.996 +towgs84=51");
-    add_proj4text (p, 1,
-        ",391,-36,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Viti Levu 1912\",DATUM[\"Viti_Levu_1912\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"Clarke 1880 (international foot)\",6378306.3696,29");
-    add_srs_wkt (p, 2,
-        "3.4663076556355,AUTHORITY[\"EPSG\",\"7055\"]],TOWGS84[51");
-    add_srs_wkt (p, 3,
-        ",391,-36,0,0,0,0],AUTHORITY[\"EPSG\",\"6752\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4752\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4753, "epsg", 4753,
-        "fk89", 1, 1,
-        "International 1924", "Greenwich",
-        "fk89", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"fk89\",DATUM[\"fk89\",SPHEROID[\"International ");
-    add_srs_wkt (p, 1,
-        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORI");
-    add_srs_wkt (p, 2,
-        "TY[\"EPSG\",\"6753\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AX");
-    add_srs_wkt (p, 5,
-        "IS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4753\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4754, "epsg", 4754,
-        "LGD2006", 1, 1,
-        "International 1924", "Greenwich",
-        "Libyan_Geodetic_Datum_2006", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-208.4058,-109.8777,-");
-    add_proj4text (p, 1,
-        "2.5764,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"LGD2006\",DATUM[\"Libyan_Geodetic_Datum_2006\",");
-    add_srs_wkt (p, 1,
-        "SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7022\"]],TOWGS84[-208.4058,-109.8777,-2.5764,0,");
-    add_srs_wkt (p, 3,
-        "0,0,0],AUTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 6,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4754\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4755, "epsg", 4755,
-        "DGN95", 1, 1,
-        "WGS 84", "Greenwich",
-        "Datum_Geodesi_Nasional_1995", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"DGN95\",DATUM[\"Datum_Geodesi_Nasional_1995\",S");
-    add_srs_wkt (p, 1,
-        "PHEROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7030\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6755\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 6,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4755\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4756, "epsg", 4756,
-        "VN-2000", 1, 1,
-        "WGS 84", "Greenwich",
-        "Vietnam_2000", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=-192.873,-39.382,-11");
-    add_proj4text (p, 1,
-        "1.202,-0.00205,-0.0005,0.00335,0.0188 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"VN-2000\",DATUM[\"Vietnam_2000\",SPHEROID[\"WGS");
-    add_srs_wkt (p, 1,
-        " 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]");
-    add_srs_wkt (p, 2,
-        "],TOWGS84[-192.873,-39.382,-111.202,-0.00205,-0.0005,0.0");
-    add_srs_wkt (p, 3,
-        "0335,0.0188],AUTHORITY[\"EPSG\",\"6756\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4756\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4757, "epsg", 4757,
-        "SVY21", 1, 1,
-        "WGS 84", "Greenwich",
-        "SVY21", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"SVY21\",DATUM[\"SVY21\",SPHEROID[\"WGS 84\",637");
-    add_srs_wkt (p, 1,
-        "8137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORI");
-    add_srs_wkt (p, 2,
-        "TY[\"EPSG\",\"6757\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AX");
-    add_srs_wkt (p, 5,
-        "IS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4757\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4758, "epsg", 4758,
-        "JAD2001", 1, 1,
-        "WGS 84", "Greenwich",
-        "Jamaica_2001", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"JAD2001\",DATUM[\"Jamaica_2001\",SPHEROID[\"WGS");
-    add_srs_wkt (p, 1,
-        " 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]");
-    add_srs_wkt (p, 2,
-        "],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6758\"]],P");
-    add_srs_wkt (p, 3,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 4,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 5,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 6,
-        "UTHORITY[\"EPSG\",\"4758\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4759, "epsg", 4759,
-        "NAD83(NSRS2007)", 1, 1,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatia");
-    add_srs_wkt (p, 1,
-        "l_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,");
-    add_srs_wkt (p, 2,
-        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 6,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"4759\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4760, "epsg", 4760,
-        "WGS 66", 1, 1,
-        "NWL 9D", "Greenwich",
-        "World_Geodetic_System_1966", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS66 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"WGS 66\",DATUM[\"World_Geodetic_System_1966\",S");
-    add_srs_wkt (p, 1,
-        "PHEROID[\"NWL 9D\",6378145,298.25,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 2,
-        "025\"]],AUTHORITY[\"EPSG\",\"6760\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 3,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 4,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 5,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4760\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4761, "epsg", 4761,
-        "HTRS96", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Croatian_Terrestrial_Reference_System", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"HTRS96\",DATUM[\"Croatian_Terrestrial_Reference");
-    add_srs_wkt (p, 1,
-        "_System\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 2,
-        "THORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6761\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4761\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4762, "epsg", 4762,
-        "BDA2000", 1, 1,
-        "WGS 84", "Greenwich",
-        "Bermuda_2000", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"BDA2000\",DATUM[\"Bermuda_2000\",SPHEROID[\"WGS");
-    add_srs_wkt (p, 1,
-        " 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]");
-    add_srs_wkt (p, 2,
-        "],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6762\"]],P");
-    add_srs_wkt (p, 3,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 4,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 5,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 6,
-        "UTHORITY[\"EPSG\",\"4762\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4763, "epsg", 4763,
-        "Pitcairn 2006", 1, 1,
-        "WGS 84", "Greenwich",
-        "Pitcairn_2006", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Pitcairn 2006\",DATUM[\"Pitcairn_2006\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 2,
-        "7030\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"676");
-    add_srs_wkt (p, 3,
-        "3\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"4763\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4764, "epsg", 4764,
-        "RSRGD2000", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Ross_Sea_Region_Geodetic_Datum_2000", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"RSRGD2000\",DATUM[\"Ross_Sea_Region_Geodetic_Da");
-    add_srs_wkt (p, 1,
-        "tum_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 2,
-        "UTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6764\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4764\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4765, "epsg", 4765,
-        "Slovenia 1996", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Slovenia_Geodetic_Datum_1996", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Slovenia 1996\",DATUM[\"Slovenia_Geodetic_Datum");
-    add_srs_wkt (p, 1,
-        "_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 2,
-        "ORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6765\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AX");
-    add_srs_wkt (p, 6,
-        "IS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4765\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4766, "epsg", 4766,
-        "New Beijing / 3-degree Gauss-Kruger zone 30", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=30500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 30\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",30500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 11,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4766\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4767, "epsg", 4767,
-        "New Beijing / 3-degree Gauss-Kruger zone 31", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=31500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 31\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9");
-    add_srs_wkt (p, 9,
-        "3],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",31500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 11,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4767\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4768, "epsg", 4768,
-        "New Beijing / 3-degree Gauss-Kruger zone 32", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=32500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 32\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9");
-    add_srs_wkt (p, 9,
-        "6],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",32500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 11,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4768\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4769, "epsg", 4769,
-        "New Beijing / 3-degree Gauss-Kruger zone 33", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=33500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 33\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9");
-    add_srs_wkt (p, 9,
-        "9],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",33500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 11,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4769\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4770, "epsg", 4770,
-        "New Beijing / 3-degree Gauss-Kruger zone 34", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=34500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 34\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "02],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",34500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4770\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4771, "epsg", 4771,
-        "New Beijing / 3-degree Gauss-Kruger zone 35", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=35500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 35\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "05],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",35500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4771\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4772, "epsg", 4772,
-        "New Beijing / 3-degree Gauss-Kruger zone 36", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=36500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 36\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "08],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",36500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4772\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4773, "epsg", 4773,
-        "New Beijing / 3-degree Gauss-Kruger zone 37", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=37500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 37\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "11],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",37500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4773\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4774, "epsg", 4774,
-        "New Beijing / 3-degree Gauss-Kruger zone 38", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=38500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 38\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "14],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",38500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4774\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4775, "epsg", 4775,
-        "New Beijing / 3-degree Gauss-Kruger zone 39", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=39500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 39\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "17],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",39500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4775\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4776, "epsg", 4776,
-        "New Beijing / 3-degree Gauss-Kruger zone 40", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=40500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 40\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "20],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",40500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4776\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4777, "epsg", 4777,
-        "New Beijing / 3-degree Gauss-Kruger zone 41", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=41500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 41\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "23],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",41500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4777\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4778, "epsg", 4778,
-        "New Beijing / 3-degree Gauss-Kruger zone 42", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=42500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 42\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "26],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",42500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4778\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4779, "epsg", 4779,
-        "New Beijing / 3-degree Gauss-Kruger zone 43", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=43500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 43\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "29],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",43500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4779\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4780, "epsg", 4780,
-        "New Beijing / 3-degree Gauss-Kruger zone 44", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=44500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 44\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "32],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",44500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4780\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4781, "epsg", 4781,
-        "New Beijing / 3-degree Gauss-Kruger zone 45", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=45500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger zone 45\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "35],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",45500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4781\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4782, "epsg", 4782,
-        "New Beijing / 3-degree Gauss-Kruger CM 75E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 75E\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"Kr");
-    add_srs_wkt (p, 2,
-        "assowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"45");
-    add_srs_wkt (p, 7,
-        "55\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 8,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",75");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4782\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4783, "epsg", 4783,
-        "New Beijing / 3-degree Gauss-Kruger CM 78E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 78E\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"Kr");
-    add_srs_wkt (p, 2,
-        "assowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"45");
-    add_srs_wkt (p, 7,
-        "55\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 8,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",78");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4783\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4784, "epsg", 4784,
-        "New Beijing / 3-degree Gauss-Kruger CM 81E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 81E\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"Kr");
-    add_srs_wkt (p, 2,
-        "assowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"45");
-    add_srs_wkt (p, 7,
-        "55\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 8,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",81");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4784\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4785, "epsg", 4785,
-        "New Beijing / 3-degree Gauss-Kruger CM 84E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 84E\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"Kr");
-    add_srs_wkt (p, 2,
-        "assowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"45");
-    add_srs_wkt (p, 7,
-        "55\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 8,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",84");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4785\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4786, "epsg", 4786,
-        "New Beijing / 3-degree Gauss-Kruger CM 87E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 87E\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"Kr");
-    add_srs_wkt (p, 2,
-        "assowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"45");
-    add_srs_wkt (p, 7,
-        "55\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 8,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",87");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4786\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4787, "epsg", 4787,
-        "New Beijing / 3-degree Gauss-Kruger CM 90E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 90E\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"Kr");
-    add_srs_wkt (p, 2,
-        "assowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"45");
-    add_srs_wkt (p, 7,
-        "55\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 8,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",90");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4787\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4788, "epsg", 4788,
-        "New Beijing / 3-degree Gauss-Kruger CM 93E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 93E\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"Kr");
-    add_srs_wkt (p, 2,
-        "assowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"45");
-    add_srs_wkt (p, 7,
-        "55\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 8,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",93");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4788\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4789, "epsg", 4789,
-        "New Beijing / 3-degree Gauss-Kruger CM 96E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 96E\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"Kr");
-    add_srs_wkt (p, 2,
-        "assowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"45");
-    add_srs_wkt (p, 7,
-        "55\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 8,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",96");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4789\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4790, "epsg", 4790,
-        "New Beijing / 3-degree Gauss-Kruger CM 99E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 99E\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"Kr");
-    add_srs_wkt (p, 2,
-        "assowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"45");
-    add_srs_wkt (p, 7,
-        "55\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 8,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",99");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4790\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4791, "epsg", 4791,
-        "New Beijing / 3-degree Gauss-Kruger CM 102E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 102E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "02],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4791\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4792, "epsg", 4792,
-        "New Beijing / 3-degree Gauss-Kruger CM 105E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 105E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "05],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4792\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4793, "epsg", 4793,
-        "New Beijing / 3-degree Gauss-Kruger CM 108E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 108E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "08],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4793\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4794, "epsg", 4794,
-        "New Beijing / 3-degree Gauss-Kruger CM 111E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 111E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "11],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4794\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4795, "epsg", 4795,
-        "New Beijing / 3-degree Gauss-Kruger CM 114E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 114E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "14],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4795\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4796, "epsg", 4796,
-        "New Beijing / 3-degree Gauss-Kruger CM 117E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 117E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "17],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4796\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4797, "epsg", 4797,
-        "New Beijing / 3-degree Gauss-Kruger CM 120E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 120E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "20],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4797\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4798, "epsg", 4798,
-        "New Beijing / 3-degree Gauss-Kruger CM 123E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 123E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "23],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4798\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4799, "epsg", 4799,
-        "New Beijing / 3-degree Gauss-Kruger CM 126E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 126E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "26],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4799\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4800, "epsg", 4800,
-        "New Beijing / 3-degree Gauss-Kruger CM 129E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 129E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "29],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4800\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4801, "epsg", 4801,
-        "Bern 1898 (Bern)", 1, 1,
-        "Bessel 1841", "Bern",
-        "CH1903_Bern", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=674.4,15.1,405.3,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +pm=bern +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Bern 1898 (Bern)\",DATUM[\"CH1903_Bern\",SPHERO");
-    add_srs_wkt (p, 1,
-        "ID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"E");
-    add_srs_wkt (p, 2,
-        "PSG\",\"7004\"]],TOWGS84[674.4,15.1,405.3,0,0,0,0],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6801\"]],PRIMEM[\"Bern\",7.4395833333333");
-    add_srs_wkt (p, 4,
-        "33,AUTHORITY[\"EPSG\",\"8907\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 6,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4801\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4802, "epsg", 4802,
-        "Bogota 1975 (Bogota)", 1, 1,
-        "International 1924", "Bogota",
-        "Bogota_1975_Bogota", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=307,304,-318,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+pm=bogota +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Bogota 1975 (Bogota)\",DATUM[\"Bogota_1975_Bogo");
-    add_srs_wkt (p, 1,
-        "ta\",SPHEROID[\"International 1924\",6378388,297,AUTHORI");
-    add_srs_wkt (p, 2,
-        "TY[\"EPSG\",\"7022\"]],TOWGS84[307,304,-318,0,0,0,0],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6802\"]],PRIMEM[\"Bogota\",-74.0809166");
-    add_srs_wkt (p, 4,
-        "6666667,AUTHORITY[\"EPSG\",\"8904\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 6,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"4802\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4803, "epsg", 4803,
-        "Lisbon (Lisbon)", 1, 1,
-        "International 1924", "Lisbon",
-        "Lisbon_1937_Lisbon", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-304.046,-60.576,103.");
-    add_proj4text (p, 1,
-        "64,0,0,0,0 +pm=lisbon +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Lisbon (Lisbon)\",DATUM[\"Lisbon_1937_Lisbon\",");
-    add_srs_wkt (p, 1,
-        "SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7022\"]],TOWGS84[-304.046,-60.576,103.64,0,0,0,");
-    add_srs_wkt (p, 3,
-        "0],AUTHORITY[\"EPSG\",\"6803\"]],PRIMEM[\"Lisbon\",-9.13");
-    add_srs_wkt (p, 4,
-        "1906111111112,AUTHORITY[\"EPSG\",\"8902\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4803\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4804, "epsg", 4804,
-        "Makassar (Jakarta)", 1, 1,
-        "Bessel 1841", "Jakarta",
-        "Makassar_Jakarta", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=-587.8,519.75,145.7");
-    add_proj4text (p, 1,
-        "6,0,0,0,0 +pm=jakarta +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Makassar (Jakarta)\",DATUM[\"Makassar_Jakarta\"");
-    add_srs_wkt (p, 1,
-        ",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7004\"]],TOWGS84[-587.8,519.75,145.76,0,0");
-    add_srs_wkt (p, 3,
-        ",0,0],AUTHORITY[\"EPSG\",\"6804\"]],PRIMEM[\"Jakarta\",1");
-    add_srs_wkt (p, 4,
-        "06.8077194444444,AUTHORITY[\"EPSG\",\"8908\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4804\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4805, "epsg", 4805,
-        "MGI (Ferro)", 1, 1,
-        "Bessel 1841", "Ferro",
-        "Militar_Geographische_Institut_Ferro", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=682,-203,480,0,0,0,");
-    add_proj4text (p, 1,
-        "0 +pm=ferro +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"MGI (Ferro)\",DATUM[\"Militar_Geographische_Ins");
-    add_srs_wkt (p, 1,
-        "titut_Ferro\",SPHEROID[\"Bessel 1841\",6377397.155,299.1");
-    add_srs_wkt (p, 2,
-        "528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[682,-203,48");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0],AUTHORITY[\"EPSG\",\"6805\"]],PRIMEM[\"Ferro\"");
-    add_srs_wkt (p, 4,
-        ",-17.66666666666667,AUTHORITY[\"EPSG\",\"8909\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4805\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4806, "epsg", 4806,
-        "Monte Mario (Rome)", 1, 1,
-        "International 1924", "Rome",
-        "Monte_Mario_Rome", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-104.1,-49.1,-9.9,0.9");
-    add_proj4text (p, 1,
-        "71,-2.917,0.714,-11.68 +pm=rome +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Monte Mario (Rome)\",DATUM[\"Monte_Mario_Rome\"");
-    add_srs_wkt (p, 1,
-        ",SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7022\"]],TOWGS84[-104.1,-49.1,-9.9,0.971,-2.917");
-    add_srs_wkt (p, 3,
-        ",0.714,-11.68],AUTHORITY[\"EPSG\",\"6806\"]],PRIMEM[\"Ro");
-    add_srs_wkt (p, 4,
-        "me\",12.45233333333333,AUTHORITY[\"EPSG\",\"8906\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4806\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4807, "epsg", 4807,
-        "NTF (Paris)", 1, 1,
-        "Clarke 1880 (IGN)", "Paris",
-        "Nouvelle_Triangulation_Francaise_Paris", "none", "grad",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378249.2 +b=6356515 +towgs84=-168,-60,");
-    add_proj4text (p, 1,
-        "320,0,0,0,0 +pm=paris +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NTF (Paris)\",DATUM[\"Nouvelle_Triangulation_Fr");
-    add_srs_wkt (p, 1,
-        "ancaise_Paris\",SPHEROID[\"Clarke 1880 (IGN)\",6378249.2");
-    add_srs_wkt (p, 2,
-        ",293.4660212936269,AUTHORITY[\"EPSG\",\"7011\"]],TOWGS84");
-    add_srs_wkt (p, 3,
-        "[-168,-60,320,0,0,0,0],AUTHORITY[\"EPSG\",\"6807\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Paris\",2.33722917,AUTHORITY[\"EPSG\",\"8903\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"grad\",0.01570796326794897,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "05\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"4807\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4808, "epsg", 4808,
-        "Padang (Jakarta)", 1, 1,
-        "Bessel 1841", "Jakarta",
-        "Padang_1884_Jakarta", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +pm=jakarta +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Padang (Jakarta)\",DATUM[\"Padang_1884_Jakarta\"");
-    add_srs_wkt (p, 1,
-        ",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6808\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Jakarta\",106.8077194444444,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8908\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 6,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4808\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4809, "epsg", 4809,
-        "Belge 1950 (Brussels)", 1, 1,
-        "International 1924", "Brussels",
-        "Reseau_National_Belge_1950_Brussels", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +pm=brussels +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Belge 1950 (Brussels)\",DATUM[\"Reseau_National");
-    add_srs_wkt (p, 1,
-        "_Belge_1950_Brussels\",SPHEROID[\"International 1924\",6");
-    add_srs_wkt (p, 2,
-        "378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6809\"]],PRIMEM[\"Brussels\",4.367975,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8910\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4809\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4810, "epsg", 4810,
-        "Tananarive (Paris)", 1, 1,
-        "International 1924", "Paris",
-        "Tananarive_1925_Paris", "none", "grad",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-189,-242,-91,0,0,0,0");
-    add_proj4text (p, 1,
-        " +pm=paris +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Tananarive (Paris)\",DATUM[\"Tananarive_1925_Pa");
-    add_srs_wkt (p, 1,
-        "ris\",SPHEROID[\"International 1924\",6378388,297,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7022\"]],TOWGS84[-189,-242,-91,0,0,0,0],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6810\"]],PRIMEM[\"Paris\",2.33722917");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"8903\"]],UNIT[\"grad\",0.015707963");
-    add_srs_wkt (p, 5,
-        "26794897,AUTHORITY[\"EPSG\",\"9105\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"48");
-    add_srs_wkt (p, 7,
-        "10\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4811, "epsg", 4811,
-        "Voirol 1875 (Paris)", 1, 1,
-        "Clarke 1880 (IGN)", "Paris",
-        "Voirol_1875_Paris", "none", "grad",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378249.2 +b=6356515 +towgs84=-73,-247,");
-    add_proj4text (p, 1,
-        "227,0,0,0,0 +pm=paris +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Voirol 1875 (Paris)\",DATUM[\"Voirol_1875_Paris");
-    add_srs_wkt (p, 1,
-        "\",SPHEROID[\"Clarke 1880 (IGN)\",6378249.2,293.46602129");
-    add_srs_wkt (p, 2,
-        "36269,AUTHORITY[\"EPSG\",\"7011\"]],TOWGS84[-73,-247,227");
-    add_srs_wkt (p, 3,
-        ",0,0,0,0],AUTHORITY[\"EPSG\",\"6811\"]],PRIMEM[\"Paris\"");
-    add_srs_wkt (p, 4,
-        ",2.33722917,AUTHORITY[\"EPSG\",\"8903\"]],UNIT[\"grad\",");
-    add_srs_wkt (p, 5,
-        "0.01570796326794897,AUTHORITY[\"EPSG\",\"9105\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4811\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4812, "epsg", 4812,
-        "New Beijing / 3-degree Gauss-Kruger CM 132E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 132E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "32],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4812\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4813, "epsg", 4813,
-        "Batavia (Jakarta)", 1, 1,
-        "Bessel 1841", "Jakarta",
-        "Batavia_Jakarta", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=-377,681,-50,0,0,0,");
-    add_proj4text (p, 1,
-        "0 +pm=jakarta +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Batavia (Jakarta)\",DATUM[\"Batavia_Jakarta\",S");
-    add_srs_wkt (p, 1,
-        "PHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORIT");
-    add_srs_wkt (p, 2,
-        "Y[\"EPSG\",\"7004\"]],TOWGS84[-377,681,-50,0,0,0,0],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6813\"]],PRIMEM[\"Jakarta\",106.8077194");
-    add_srs_wkt (p, 4,
-        "444444,AUTHORITY[\"EPSG\",\"8908\"]],UNIT[\"degree\",0.0");
-    add_srs_wkt (p, 5,
-        "174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lat");
-    add_srs_wkt (p, 6,
-        "itude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 7,
-        "\",\"4813\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4814, "epsg", 4814,
-        "RT38 (Stockholm)", 1, 1,
-        "Bessel 1841", "Stockholm",
-        "Stockholm_1938_Stockholm", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +pm=stockholm +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"RT38 (Stockholm)\",DATUM[\"Stockholm_1938_Stock");
-    add_srs_wkt (p, 1,
-        "holm\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6814\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Stockholm\",18.05827777777778,AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"8911\"]],UNIT[\"degree\",0.0174532925199433,AUTHO");
-    add_srs_wkt (p, 5,
-        "RITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4814\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4815, "epsg", 4815,
-        "Greek (Athens)", 1, 1,
-        "Bessel 1841", "Athens",
-        "Greek_Athens", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +pm=athens +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Greek (Athens)\",DATUM[\"Greek_Athens\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EP");
-    add_srs_wkt (p, 2,
-        "SG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6815\"]],PRIMEM[\"A");
-    add_srs_wkt (p, 3,
-        "thens\",23.7163375,AUTHORITY[\"EPSG\",\"8912\"]],UNIT[\"");
-    add_srs_wkt (p, 4,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 5,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4815\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4816, "epsg", 4816,
-        "Carthage (Paris)", 1, 1,
-        "Clarke 1880 (IGN)", "Paris",
-        "Carthage_Paris", "none", "grad",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378249.2 +b=6356515 +towgs84=-263,6,43");
-    add_proj4text (p, 1,
-        "1,0,0,0,0 +pm=paris +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Carthage (Paris)\",DATUM[\"Carthage_Paris\",SPH");
-    add_srs_wkt (p, 1,
-        "EROID[\"Clarke 1880 (IGN)\",6378249.2,293.4660212936269,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7011\"]],TOWGS84[-263,6,431,0,0,0,0");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6816\"]],PRIMEM[\"Paris\",2.33722");
-    add_srs_wkt (p, 4,
-        "917,AUTHORITY[\"EPSG\",\"8903\"]],UNIT[\"grad\",0.015707");
-    add_srs_wkt (p, 5,
-        "96326794897,AUTHORITY[\"EPSG\",\"9105\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 6,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4816\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4817, "epsg", 4817,
-        "NGO 1948 (Oslo)", 1, 1,
-        "Bessel Modified", "Oslo",
-        "NGO_1948_Oslo", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377492.018 +b=6356173.508712696 +towgs");
-    add_proj4text (p, 1,
-        "84=278.3,93,474.5,7.889,0.05,-6.61,6.21 +pm=oslo +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NGO 1948 (Oslo)\",DATUM[\"NGO_1948_Oslo\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"Bessel Modified\",6377492.018,299.1528128,AUTHORIT");
-    add_srs_wkt (p, 2,
-        "Y[\"EPSG\",\"7005\"]],TOWGS84[278.3,93,474.5,7.889,0.05,");
-    add_srs_wkt (p, 3,
-        "-6.61,6.21],AUTHORITY[\"EPSG\",\"6817\"]],PRIMEM[\"Oslo\"");
-    add_srs_wkt (p, 4,
-        ",10.72291666666667,AUTHORITY[\"EPSG\",\"8913\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4817\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4818, "epsg", 4818,
-        "S-JTSK (Ferro)", 1, 1,
-        "Bessel 1841", "Ferro",
-        "System_Jednotne_Trigonometricke_Site_Katastralni_Ferro", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=589,76,480,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+pm=ferro +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"S-JTSK (Ferro)\",DATUM[\"System_Jednotne_Trigon");
-    add_srs_wkt (p, 1,
-        "ometricke_Site_Katastralni_Ferro\",SPHEROID[\"Bessel 184");
-    add_srs_wkt (p, 2,
-        "1\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[589,76,480,0,0,0,0],AUTHORITY[\"EPSG\",\"6818\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Ferro\",-17.66666666666667,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8909\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4818\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4819, "epsg", 4819,
-        "Nord Sahara 1959 (Paris)", 1, 1,
-        "Clarke 1880 (RGS)", "Paris",
-        "Nord_Sahara_1959_Paris", "none", "grad",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +towgs84=-209.3622,-87.8162,");
-    add_proj4text (p, 1,
-        "404.6198,0.0046,3.4784,0.5805,-1.4547 +pm=paris +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Nord Sahara 1959 (Paris)\",DATUM[\"Nord_Sahara_");
-    add_srs_wkt (p, 1,
-        "1959_Paris\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,");
-    add_srs_wkt (p, 2,
-        "293.465,AUTHORITY[\"EPSG\",\"7012\"]],TOWGS84[-209.3622,");
-    add_srs_wkt (p, 3,
-        "-87.8162,404.6198,0.0046,3.4784,0.5805,-1.4547],AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"6819\"]],PRIMEM[\"Paris\",2.33722917,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8903\"]],UNIT[\"grad\",0.0157079632679489");
-    add_srs_wkt (p, 6,
-        "7,AUTHORITY[\"EPSG\",\"9105\"]],AXIS[\"Latitude\",NORTH]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4819\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4820, "epsg", 4820,
-        "Segara (Jakarta)", 1, 1,
-        "Bessel 1841", "Jakarta",
-        "Gunung_Segara_Jakarta", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=-403,684,41,0,0,0,0");
-    add_proj4text (p, 1,
-        " +pm=jakarta +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Segara (Jakarta)\",DATUM[\"Gunung_Segara_Jakart");
-    add_srs_wkt (p, 1,
-        "a\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7004\"]],TOWGS84[-403,684,41,0,0,0,0],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6820\"]],PRIMEM[\"Jakarta\",106.807");
-    add_srs_wkt (p, 4,
-        "7194444444,AUTHORITY[\"EPSG\",\"8908\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4820\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4821, "epsg", 4821,
-        "Voirol 1879 (Paris)", 1, 1,
-        "Clarke 1880 (IGN)", "Paris",
-        "Voirol_1879_Paris", "none", "grad",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378249.2 +b=6356515 +pm=paris +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Voirol 1879 (Paris)\",DATUM[\"Voirol_1879_Paris");
-    add_srs_wkt (p, 1,
-        "\",SPHEROID[\"Clarke 1880 (IGN)\",6378249.2,293.46602129");
-    add_srs_wkt (p, 2,
-        "36269,AUTHORITY[\"EPSG\",\"7011\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6821\"]],PRIMEM[\"Paris\",2.33722917,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8903\"]],UNIT[\"grad\",0.01570796326794897,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9105\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 6,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4821\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4822, "epsg", 4822,
-        "New Beijing / 3-degree Gauss-Kruger CM 135E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "New_Beijing", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"New Beijing / 3-degree Gauss-Kruger CM 135E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"New Beijing\",DATUM[\"New_Beijing\",SPHEROID[\"K");
-    add_srs_wkt (p, 2,
-        "rassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"1045\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4555\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 9,
-        "35],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"4822\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4823, "epsg", 4823,
-        "Sao Tome", 1, 1,
-        "International 1924", "Greenwich",
-        "Sao_Tome", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Sao Tome\",DATUM[\"Sao_Tome\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 1,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"1044\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 4,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 5,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4823");
-    add_srs_wkt (p, 6,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4824, "epsg", 4824,
-        "Principe", 1, 1,
-        "International 1924", "Greenwich",
-        "Principe", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Principe\",DATUM[\"Principe\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 1,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"1046\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 4,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 5,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4824");
-    add_srs_wkt (p, 6,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4826, "epsg", 4826,
-        "WGS 84 / Cape Verde National", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "M", "East", "P", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=15 +lat_2=16.66666666666667 +lat_0=15.8");
-    add_proj4text (p, 1,
-        "3333333333333 +lon_0=-24 +x_0=161587.83 +y_0=128511.202 ");
-    add_proj4text (p, 2,
-        "+datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Cape Verde National\",GEOGCS[\"WGS 84\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.2572");
-    add_srs_wkt (p, 2,
-        "23563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 6,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 8,
-        "_1\",15],PARAMETER[\"standard_parallel_2\",16.6666666666");
-    add_srs_wkt (p, 9,
-        "6667],PARAMETER[\"latitude_of_origin\",15.83333333333333");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"central_meridian\",-24],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",161587.83],PARAMETER[\"false_northing\",128511");
-    add_srs_wkt (p, 12,
-        ".202],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"M\",EAST],AXIS[\"P\",NORTH],AUTHORITY[\"EPSG\",\"482");
-    add_srs_wkt (p, 14,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4839, "epsg", 4839,
-        "ETRS89 / LCC Germany (N-E)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.66666666666666 +lat_2=53.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=51 +lon_0=10.5 +x_0=0 +y_0=0 +ellps=GRS80 +to");
-    add_proj4text (p, 2,
-        "wgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / LCC Germany (N-E)\",GEOGCS[\"ETRS89\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"European_Terrestrial_Reference_System_1989\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 8,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 9,
-        "lel_1\",48.66666666666666],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 10,
-        "_2\",53.66666666666666],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 11,
-        ",51],PARAMETER[\"central_meridian\",10.5],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 13,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4839");
-    add_srs_wkt (p, 15,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4855, "epsg", 4855,
-        "ETRS89 / NTM zone 5 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=5.5 +k=1 +x_0=100000 +y_0=10");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 5 (deprecated)\",GEOGCS[\"ETR");
-    add_srs_wkt (p, 1,
-        "S89\",DATUM[\"European_Terrestrial_Reference_System_1989");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",5.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4855\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4856, "epsg", 4856,
-        "ETRS89 / NTM zone 6 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=6.5 +k=1 +x_0=100000 +y_0=10");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 6 (deprecated)\",GEOGCS[\"ETR");
-    add_srs_wkt (p, 1,
-        "S89\",DATUM[\"European_Terrestrial_Reference_System_1989");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",6.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4856\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4857, "epsg", 4857,
-        "ETRS89 / NTM zone 7 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=7.5 +k=1 +x_0=100000 +y_0=10");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 7 (deprecated)\",GEOGCS[\"ETR");
-    add_srs_wkt (p, 1,
-        "S89\",DATUM[\"European_Terrestrial_Reference_System_1989");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",7.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4857\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4858, "epsg", 4858,
-        "ETRS89 / NTM zone 8 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=8.5 +k=1 +x_0=100000 +y_0=10");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 8 (deprecated)\",GEOGCS[\"ETR");
-    add_srs_wkt (p, 1,
-        "S89\",DATUM[\"European_Terrestrial_Reference_System_1989");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",8.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4858\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4859, "epsg", 4859,
-        "ETRS89 / NTM zone 9 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9.5 +k=1 +x_0=100000 +y_0=10");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 9 (deprecated)\",GEOGCS[\"ETR");
-    add_srs_wkt (p, 1,
-        "S89\",DATUM[\"European_Terrestrial_Reference_System_1989");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",9.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4859\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4860, "epsg", 4860,
-        "ETRS89 / NTM zone 10 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=10.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 10 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",10.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4860\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4861, "epsg", 4861,
-        "ETRS89 / NTM zone 11 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=11.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 11 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",11.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4861\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4862, "epsg", 4862,
-        "ETRS89 / NTM zone 12 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 12 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",12.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4862\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4863, "epsg", 4863,
-        "ETRS89 / NTM zone 13 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 13 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",13.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4863\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4864, "epsg", 4864,
-        "ETRS89 / NTM zone 14 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=14.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 14 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",14.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4864\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4865, "epsg", 4865,
-        "ETRS89 / NTM zone 15 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 15 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",15.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4865\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4866, "epsg", 4866,
-        "ETRS89 / NTM zone 16 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=16.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 16 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",16.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4866\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4867, "epsg", 4867,
-        "ETRS89 / NTM zone 17 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=17.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 17 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",17.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4867\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4868, "epsg", 4868,
-        "ETRS89 / NTM zone 18 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 18 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",18.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4868\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4869, "epsg", 4869,
-        "ETRS89 / NTM zone 19 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=19.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 19 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",19.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4869\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4870, "epsg", 4870,
-        "ETRS89 / NTM zone 20 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=20.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 20 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",20.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4870\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4871, "epsg", 4871,
-        "ETRS89 / NTM zone 21 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 21 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",21.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4871\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4872, "epsg", 4872,
-        "ETRS89 / NTM zone 22 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=22.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 22 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",22.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4872\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4873, "epsg", 4873,
-        "ETRS89 / NTM zone 23 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=23.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 23 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",23.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4873\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4874, "epsg", 4874,
-        "ETRS89 / NTM zone 24 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 24 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",24.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4874\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4875, "epsg", 4875,
-        "ETRS89 / NTM zone 25 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=25.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 25 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",25.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4875\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4876, "epsg", 4876,
-        "ETRS89 / NTM zone 26 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=26.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 26 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",26.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4876\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4877, "epsg", 4877,
-        "ETRS89 / NTM zone 27 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 27 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",27.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4877\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
@@ -1,3745 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_25 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 4878, "epsg", 4878,
-        "ETRS89 / NTM zone 28 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=28.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 28 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",28.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4878\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4879, "epsg", 4879,
-        "ETRS89 / NTM zone 29 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=29.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 29 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",29.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4879\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4880, "epsg", 4880,
-        "ETRS89 / NTM zone 30 (deprecated)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 30 (deprecated)\",GEOGCS[\"ET");
-    add_srs_wkt (p, 1,
-        "RS89\",DATUM[\"European_Terrestrial_Reference_System_198");
-    add_srs_wkt (p, 2,
-        "9\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 9,
-        "in\",0],PARAMETER[\"central_meridian\",30.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",1],PARAMETER[\"false_easting\",100000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4880\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4901, "epsg", 4901,
-        "ATF (Paris)", 1, 1,
-        "Plessis 1817", "Paris RGS",
-        "Ancienne_Triangulation_Francaise_Paris", "none", "grad",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6376523 +b=6355862.933255573 +pm=2.3372");
-    add_proj4text (p, 1,
-        "08333333333 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ATF (Paris)\",DATUM[\"Ancienne_Triangulation_Fr");
-    add_srs_wkt (p, 1,
-        "ancaise_Paris\",SPHEROID[\"Plessis 1817\",6376523,308.64");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7027\"]],AUTHORITY[\"EPSG\",\"6901");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Paris RGS\",2.337208333333333,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8914\"]],UNIT[\"grad\",0.01570796326794897,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9105\"]],AXIS[\"Latitude\",NORTH],AXIS[");
-    add_srs_wkt (p, 6,
-        "\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4901\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4902, "epsg", 4902,
-        "NDG (Paris)", 1, 1,
-        "Plessis 1817", "Paris",
-        "Nord_de_Guerre_Paris", "none", "grad",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6376523 +b=6355862.933255573 +pm=paris ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NDG (Paris)\",DATUM[\"Nord_de_Guerre_Paris\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Plessis 1817\",6376523,308.64,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 2,
-        ",\"7027\"]],AUTHORITY[\"EPSG\",\"6902\"]],PRIMEM[\"Paris");
-    add_srs_wkt (p, 3,
-        "\",2.33722917,AUTHORITY[\"EPSG\",\"8903\"]],UNIT[\"grad\"");
-    add_srs_wkt (p, 4,
-        ",0.01570796326794897,AUTHORITY[\"EPSG\",\"9105\"]],AXIS[");
-    add_srs_wkt (p, 5,
-        "\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4902\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4903, "epsg", 4903,
-        "Madrid 1870 (Madrid)", 1, 1,
-        "Struve 1860", "Madrid",
-        "Madrid_1870_Madrid", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378298.3 +b=6356657.142669562 +pm=madr");
-    add_proj4text (p, 1,
-        "id +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Madrid 1870 (Madrid)\",DATUM[\"Madrid_1870_Madr");
-    add_srs_wkt (p, 1,
-        "id\",SPHEROID[\"Struve 1860\",6378298.3,294.73,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7028\"]],AUTHORITY[\"EPSG\",\"6903\"]],PRIME");
-    add_srs_wkt (p, 3,
-        "M[\"Madrid\",-3.687938888888889,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "5\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 6,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4903\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4904, "epsg", 4904,
-        "Lisbon 1890 (Lisbon)", 1, 1,
-        "Bessel 1841", "Lisbon",
-        "Lisbon_1890_Lisbon", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=508.088,-191.042,56");
-    add_proj4text (p, 1,
-        "5.223,0,0,0,0 +pm=lisbon +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Lisbon 1890 (Lisbon)\",DATUM[\"Lisbon_1890_Lisb");
-    add_srs_wkt (p, 1,
-        "on\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,AU");
-    add_srs_wkt (p, 2,
-        "THORITY[\"EPSG\",\"7004\"]],TOWGS84[508.088,-191.042,565");
-    add_srs_wkt (p, 3,
-        ".223,0,0,0,0],AUTHORITY[\"EPSG\",\"6904\"]],PRIMEM[\"Lis");
-    add_srs_wkt (p, 4,
-        "bon\",-9.131906111111112,AUTHORITY[\"EPSG\",\"8902\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"4904\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5013, "epsg", 5013,
-        "PTRA08", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Autonomous_Regions_of_Portugal_2008", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"PTRA08\",DATUM[\"Autonomous_Regions_of_Portugal");
-    add_srs_wkt (p, 1,
-        "_2008\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 2,
-        "ORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"1041\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AX");
-    add_srs_wkt (p, 6,
-        "IS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"5013\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5014, "epsg", 5014,
-        "PTRA08 / UTM zone 25N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Autonomous_Regions_of_Portugal_2008", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=25 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"PTRA08 / UTM zone 25N\",GEOGCS[\"PTRA08\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Autonomous_Regions_of_Portugal_2008\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1041\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"5013\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"central_meridian\",-33],PARAMETER[\"scale_factor\",0.9");
-    add_srs_wkt (p, 10,
-        "996],PARAMETER[\"false_easting\",500000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"5014\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5015, "epsg", 5015,
-        "PTRA08 / UTM zone 26N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Autonomous_Regions_of_Portugal_2008", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=26 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"PTRA08 / UTM zone 26N\",GEOGCS[\"PTRA08\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Autonomous_Regions_of_Portugal_2008\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1041\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"5013\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"central_meridian\",-27],PARAMETER[\"scale_factor\",0.9");
-    add_srs_wkt (p, 10,
-        "996],PARAMETER[\"false_easting\",500000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"5015\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5016, "epsg", 5016,
-        "PTRA08 / UTM zone 28N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Autonomous_Regions_of_Portugal_2008", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"PTRA08 / UTM zone 28N\",GEOGCS[\"PTRA08\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Autonomous_Regions_of_Portugal_2008\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1041\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"5013\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"central_meridian\",-15],PARAMETER[\"scale_factor\",0.9");
-    add_srs_wkt (p, 10,
-        "996],PARAMETER[\"false_easting\",500000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"5016\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5018, "epsg", 5018,
-        "Lisbon / Portuguese Grid New", 0, 0,
-        "International 1924", "Greenwich",
-        "Lisbon_1937", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=39.66666666666666 +lon_0=-8.131906111");
-    add_proj4text (p, 1,
-        "111112 +k=1 +x_0=0 +y_0=0 +ellps=intl +towgs84=-304.046,");
-    add_proj4text (p, 2,
-        "-60.576,103.64,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Lisbon / Portuguese Grid New\",GEOGCS[\"Lisbon\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Lisbon_1937\",SPHEROID[\"International 1924\",6");
-    add_srs_wkt (p, 2,
-        "378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-304.04");
-    add_srs_wkt (p, 3,
-        "6,-60.576,103.64,0,0,0,0],AUTHORITY[\"EPSG\",\"6207\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4207\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",39.6666666666");
-    add_srs_wkt (p, 9,
-        "6666],PARAMETER[\"central_meridian\",-8.131906111111112]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 11,
-        "\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"5018\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5041, "epsg", 5041,
-        "WGS 84 / UPS North (E,N)", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=90 +lat_ts=90 +lon_0=0 +k=0.994 +x_0=");
-    add_proj4text (p, 1,
-        "2000000 +y_0=2000000 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / UPS North (E,N)\",GEOGCS[\"WGS 84\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.2572235");
-    add_srs_wkt (p, 2,
-        "63,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"63");
-    add_srs_wkt (p, 3,
-        "26\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Polar_S");
-    add_srs_wkt (p, 7,
-        "tereographic\"],PARAMETER[\"latitude_of_origin\",90],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",0],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.994],PARAMETER[\"false_easting\",2000000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",2000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"5041\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5042, "epsg", 5042,
-        "WGS 84 / UPS South (E,N)", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-90 +lon_0=0 +k=0.994 +x_");
-    add_proj4text (p, 1,
-        "0=2000000 +y_0=2000000 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / UPS South (E,N)\",GEOGCS[\"WGS 84\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.2572235");
-    add_srs_wkt (p, 2,
-        "63,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"63");
-    add_srs_wkt (p, 3,
-        "26\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Polar_S");
-    add_srs_wkt (p, 7,
-        "tereographic\"],PARAMETER[\"latitude_of_origin\",-90],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"central_meridian\",0],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 9,
-        "\",0.994],PARAMETER[\"false_easting\",2000000],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_northing\",2000000],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 12,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"5042\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5048, "epsg", 5048,
-        "ETRS89 / TM35FIN(N,E)", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=35 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / TM35FIN(N,E)\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",27],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 13,
-        "T],AUTHORITY[\"EPSG\",\"5048\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5069, "epsg", 5069,
-        "NAD27 / Conus Albers", 0, 0,
-        "Clarke 1866", "Greenwich",
-        "North_American_Datum_1927", "Albers_Conic_Equal_Area", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=29.5 +lat_2=45.5 +lat_0=23 +lon_0=-96 +");
-    add_proj4text (p, 1,
-        "x_0=0 +y_0=0 +datum=NAD27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Conus Albers\",GEOGCS[\"NAD27\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",637");
-    add_srs_wkt (p, 2,
-        "8206.4,294.9786982138982,AUTHORITY[\"EPSG\",\"7008\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 6,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4267\"");
-    add_srs_wkt (p, 7,
-        "]],PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"s");
-    add_srs_wkt (p, 8,
-        "tandard_parallel_1\",29.5],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_2\",45.5],PARAMETER[\"latitude_of_center\",23],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"longitude_of_center\",-96],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 11,
-        "\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"5069\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5070, "epsg", 5070,
-        "NAD83 / Conus Albers", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Albers_Conic_Equal_Area", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=29.5 +lat_2=45.5 +lat_0=23 +lon_0=-96 +");
-    add_proj4text (p, 1,
-        "x_0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Conus Albers\",GEOGCS[\"NAD83\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4269\"]],PROJECTION[\"Albers_Conic_Equal_Area\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"standard_parallel_1\",29.5],PARAMETER[\"sta");
-    add_srs_wkt (p, 9,
-        "ndard_parallel_2\",45.5],PARAMETER[\"latitude_of_center\"");
-    add_srs_wkt (p, 10,
-        ",23],PARAMETER[\"longitude_of_center\",-96],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAS");
-    add_srs_wkt (p, 13,
-        "T],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"5070\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5071, "epsg", 5071,
-        "NAD83(HARN) / Conus Albers", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_High_Accuracy_Reference_Network", "Albers_Conic_Equal_Area", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=29.5 +lat_2=45.5 +lat_0=23 +lon_0=-96 +");
-    add_proj4text (p, 1,
-        "x_0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Conus Albers\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"A");
-    add_srs_wkt (p, 8,
-        "lbers_Conic_Equal_Area\"],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 9,
-        "1\",29.5],PARAMETER[\"standard_parallel_2\",45.5],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"latitude_of_center\",23],PARAMETER[\"longitude_of_");
-    add_srs_wkt (p, 11,
-        "center\",-96],PARAMETER[\"false_easting\",0],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 14,
-        "\"EPSG\",\"5071\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5072, "epsg", 5072,
-        "NAD83(NSRS2007) / Conus Albers", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Albers_Conic_Equal_Area", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=29.5 +lat_2=45.5 +lat_0=23 +lon_0=-96 +");
-    add_proj4text (p, 1,
-        "x_0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Conus Albers\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4759\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"sta");
-    add_srs_wkt (p, 9,
-        "ndard_parallel_1\",29.5],PARAMETER[\"standard_parallel_2");
-    add_srs_wkt (p, 10,
-        "\",45.5],PARAMETER[\"latitude_of_center\",23],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"longitude_of_center\",-96],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 12,
-        ",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",N");
-    add_srs_wkt (p, 14,
-        "ORTH],AUTHORITY[\"EPSG\",\"5072\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5105, "epsg", 5105,
-        "ETRS89 / NTM zone 5", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=5.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 5\",GEOGCS[\"ETRS89\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Terrestrial_Reference_System_1989\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6258\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"central_meridian\",5.5],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AUTHORITY[\"EPSG\",\"5105\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5106, "epsg", 5106,
-        "ETRS89 / NTM zone 6", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=6.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 6\",GEOGCS[\"ETRS89\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Terrestrial_Reference_System_1989\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6258\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"central_meridian\",6.5],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AUTHORITY[\"EPSG\",\"5106\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5107, "epsg", 5107,
-        "ETRS89 / NTM zone 7", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=7.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 7\",GEOGCS[\"ETRS89\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Terrestrial_Reference_System_1989\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6258\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"central_meridian\",7.5],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AUTHORITY[\"EPSG\",\"5107\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5108, "epsg", 5108,
-        "ETRS89 / NTM zone 8", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=8.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 8\",GEOGCS[\"ETRS89\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Terrestrial_Reference_System_1989\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6258\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"central_meridian\",8.5],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AUTHORITY[\"EPSG\",\"5108\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5109, "epsg", 5109,
-        "ETRS89 / NTM zone 9", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=9.5 +k=1 +x_0=100000 +y_0=1");
-    add_proj4text (p, 1,
-        "000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 9\",GEOGCS[\"ETRS89\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "European_Terrestrial_Reference_System_1989\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6258\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"central_meridian\",9.5],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AUTHORITY[\"EPSG\",\"5109\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5110, "epsg", 5110,
-        "ETRS89 / NTM zone 10", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=10.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 10\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",10.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5110\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5111, "epsg", 5111,
-        "ETRS89 / NTM zone 11", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=11.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 11\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",11.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5111\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5112, "epsg", 5112,
-        "ETRS89 / NTM zone 12", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=12.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 12\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",12.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5112\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5113, "epsg", 5113,
-        "ETRS89 / NTM zone 13", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=13.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 13\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",13.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5113\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5114, "epsg", 5114,
-        "ETRS89 / NTM zone 14", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=14.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 14\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",14.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5114\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5115, "epsg", 5115,
-        "ETRS89 / NTM zone 15", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=15.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 15\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",15.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5115\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5116, "epsg", 5116,
-        "ETRS89 / NTM zone 16", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=16.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 16\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",16.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5116\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5117, "epsg", 5117,
-        "ETRS89 / NTM zone 17", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=17.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 17\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",17.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5117\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5118, "epsg", 5118,
-        "ETRS89 / NTM zone 18", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=18.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 18\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",18.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5118\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5119, "epsg", 5119,
-        "ETRS89 / NTM zone 19", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=19.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 19\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",19.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5119\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5120, "epsg", 5120,
-        "ETRS89 / NTM zone 20", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=20.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 20\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",20.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5120\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5121, "epsg", 5121,
-        "ETRS89 / NTM zone 21", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=21.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 21\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",21.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5121\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5122, "epsg", 5122,
-        "ETRS89 / NTM zone 22", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=22.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 22\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",22.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5122\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5123, "epsg", 5123,
-        "ETRS89 / NTM zone 23", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=23.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 23\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",23.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5123\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5124, "epsg", 5124,
-        "ETRS89 / NTM zone 24", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=24.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 24\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",24.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5124\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5125, "epsg", 5125,
-        "ETRS89 / NTM zone 25", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=25.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 25\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",25.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5125\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5126, "epsg", 5126,
-        "ETRS89 / NTM zone 26", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=26.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 26\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",26.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5126\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5127, "epsg", 5127,
-        "ETRS89 / NTM zone 27", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=27.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 27\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",27.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5127\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5128, "epsg", 5128,
-        "ETRS89 / NTM zone 28", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=28.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 28\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",28.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5128\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5129, "epsg", 5129,
-        "ETRS89 / NTM zone 29", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=29.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 29\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",29.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5129\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5130, "epsg", 5130,
-        "ETRS89 / NTM zone 30", 0, 1,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=58 +lon_0=30.5 +k=1 +x_0=100000 +y_0=");
-    add_proj4text (p, 1,
-        "1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / NTM zone 30\",GEOGCS[\"ETRS89\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"European_Terrestrial_Reference_System_1989\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"625");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",58],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",30.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",100000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5130\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5132, "epsg", 5132,
-        "Tokyo 1892", 1, 1,
-        "Bessel 1841", "Greenwich",
-        "Tokyo_1892", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Tokyo 1892\",DATUM[\"Tokyo_1892\",SPHEROID[\"Be");
-    add_srs_wkt (p, 1,
-        "ssel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 2,
-        "7004\"]],AUTHORITY[\"EPSG\",\"1048\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 3,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 4,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati");
-    add_srs_wkt (p, 5,
-        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5132\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5167, "epsg", 5167,
-        "Korean 1985 / East Sea Belt", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Korean_Datum_1985", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=131 +k=1 +x_0=200000 +y_0=5");
-    add_proj4text (p, 1,
-        "00000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korean 1985 / East Sea Belt\",GEOGCS[\"Korean 1");
-    add_srs_wkt (p, 1,
-        "985\",DATUM[\"Korean_Datum_1985\",SPHEROID[\"Bessel 1841");
-    add_srs_wkt (p, 2,
-        "\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6162\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 6,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4162");
-    add_srs_wkt (p, 7,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",38],PARAMETER[\"central_meridian\",131");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",200000],PARAMETER[\"false_northing\",500000],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"5167\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5168, "epsg", 5168,
-        "Korean 1985 / Central Belt Jeju", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Korean_Datum_1985", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=127 +k=1 +x_0=200000 +y_0=5");
-    add_proj4text (p, 1,
-        "50000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korean 1985 / Central Belt Jeju\",GEOGCS[\"Kore");
-    add_srs_wkt (p, 1,
-        "an 1985\",DATUM[\"Korean_Datum_1985\",SPHEROID[\"Bessel ");
-    add_srs_wkt (p, 2,
-        "1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6162\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4162\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",38],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "127],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",200000],PARAMETER[\"false_northing\",550000],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NO");
-    add_srs_wkt (p, 12,
-        "RTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"5168\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5169, "epsg", 5169,
-        "Tokyo 1892 / Korea West Belt", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Tokyo_1892", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=125 +k=1 +x_0=200000 +y_0=5");
-    add_proj4text (p, 1,
-        "00000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo 1892 / Korea West Belt\",GEOGCS[\"Tokyo 1");
-    add_srs_wkt (p, 1,
-        "892\",DATUM[\"Tokyo_1892\",SPHEROID[\"Bessel 1841\",6377");
-    add_srs_wkt (p, 2,
-        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"1048\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"5132\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",38],PARAMETER[\"central_meridian\",125],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",200");
-    add_srs_wkt (p, 10,
-        "000],PARAMETER[\"false_northing\",500000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"5169\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5170, "epsg", 5170,
-        "Tokyo 1892 / Korea Central Belt", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Tokyo_1892", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=127 +k=1 +x_0=200000 +y_0=5");
-    add_proj4text (p, 1,
-        "00000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo 1892 / Korea Central Belt\",GEOGCS[\"Toky");
-    add_srs_wkt (p, 1,
-        "o 1892\",DATUM[\"Tokyo_1892\",SPHEROID[\"Bessel 1841\",6");
-    add_srs_wkt (p, 2,
-        "377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"1048\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"5132\"]]");
-    add_srs_wkt (p, 7,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 8,
-        "e_of_origin\",38],PARAMETER[\"central_meridian\",127],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "200000],PARAMETER[\"false_northing\",500000],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"5170\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5171, "epsg", 5171,
-        "Tokyo 1892 / Korea East Belt", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Tokyo_1892", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=129 +k=1 +x_0=200000 +y_0=5");
-    add_proj4text (p, 1,
-        "00000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo 1892 / Korea East Belt\",GEOGCS[\"Tokyo 1");
-    add_srs_wkt (p, 1,
-        "892\",DATUM[\"Tokyo_1892\",SPHEROID[\"Bessel 1841\",6377");
-    add_srs_wkt (p, 2,
-        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"1048\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"5132\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",38],PARAMETER[\"central_meridian\",129],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",200");
-    add_srs_wkt (p, 10,
-        "000],PARAMETER[\"false_northing\",500000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Y\",EAST],AUTHORITY[\"EPSG\",\"5171\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5172, "epsg", 5172,
-        "Tokyo 1892 / Korea East Sea Belt", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Tokyo_1892", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=131 +k=1 +x_0=200000 +y_0=5");
-    add_proj4text (p, 1,
-        "00000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo 1892 / Korea East Sea Belt\",GEOGCS[\"Tok");
-    add_srs_wkt (p, 1,
-        "yo 1892\",DATUM[\"Tokyo_1892\",SPHEROID[\"Bessel 1841\",");
-    add_srs_wkt (p, 2,
-        "6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"1048\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 5,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORT");
-    add_srs_wkt (p, 6,
-        "H],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"5132\"]");
-    add_srs_wkt (p, 7,
-        "],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 8,
-        "de_of_origin\",38],PARAMETER[\"central_meridian\",131],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",200000],PARAMETER[\"false_northing\",500000],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"5172\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5173, "epsg", 5173,
-        "Korean 1985 / Modified West Belt", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Korean_Datum_1985", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=125.0028902777778 +k=1 +x_0");
-    add_proj4text (p, 1,
-        "=200000 +y_0=500000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korean 1985 / Modified West Belt\",GEOGCS[\"Kor");
-    add_srs_wkt (p, 1,
-        "ean 1985\",DATUM[\"Korean_Datum_1985\",SPHEROID[\"Bessel");
-    add_srs_wkt (p, 2,
-        " 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"700");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6162\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 6,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4162\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",38],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "125.0028902777778],PARAMETER[\"scale_factor\",1],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",200000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "5173\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5174, "epsg", 5174,
-        "Korean 1985 / Modified Central Belt", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Korean_Datum_1985", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=127.0028902777778 +k=1 +x_0");
-    add_proj4text (p, 1,
-        "=200000 +y_0=500000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korean 1985 / Modified Central Belt\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Korean 1985\",DATUM[\"Korean_Datum_1985\",SPHEROID[\"Bes");
-    add_srs_wkt (p, 2,
-        "sel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7004\"]],AUTHORITY[\"EPSG\",\"6162\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati");
-    add_srs_wkt (p, 6,
-        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4162\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"latitude_of_origin\",38],PARAMETER[\"central_meridia");
-    add_srs_wkt (p, 9,
-        "n\",127.0028902777778],PARAMETER[\"scale_factor\",1],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_easting\",200000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"5174\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5175, "epsg", 5175,
-        "Korean 1985 / Modified Central Belt Jeju", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Korean_Datum_1985", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=127.0028902777778 +k=1 +x_0");
-    add_proj4text (p, 1,
-        "=200000 +y_0=550000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korean 1985 / Modified Central Belt Jeju\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Korean 1985\",DATUM[\"Korean_Datum_1985\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7004\"]],AUTHORITY[\"EPSG\",\"6162\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4162\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",38],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",127.0028902777778],PARAMETER[\"scale_factor\",1");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_easting\",200000],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",550000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"5175\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5176, "epsg", 5176,
-        "Korean 1985 / Modified East Belt", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Korean_Datum_1985", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=129.0028902777778 +k=1 +x_0");
-    add_proj4text (p, 1,
-        "=200000 +y_0=500000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korean 1985 / Modified East Belt\",GEOGCS[\"Kor");
-    add_srs_wkt (p, 1,
-        "ean 1985\",DATUM[\"Korean_Datum_1985\",SPHEROID[\"Bessel");
-    add_srs_wkt (p, 2,
-        " 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"700");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6162\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 6,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4162\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",38],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "129.0028902777778],PARAMETER[\"scale_factor\",1],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",200000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "5176\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5177, "epsg", 5177,
-        "Korean 1985 / Modified East Sea Belt", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Korean_Datum_1985", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=131.0028902777778 +k=1 +x_0");
-    add_proj4text (p, 1,
-        "=200000 +y_0=500000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korean 1985 / Modified East Sea Belt\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Korean 1985\",DATUM[\"Korean_Datum_1985\",SPHEROID[\"Bes");
-    add_srs_wkt (p, 2,
-        "sel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7004\"]],AUTHORITY[\"EPSG\",\"6162\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati");
-    add_srs_wkt (p, 6,
-        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4162\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"latitude_of_origin\",38],PARAMETER[\"central_meridia");
-    add_srs_wkt (p, 9,
-        "n\",131.0028902777778],PARAMETER[\"scale_factor\",1],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_easting\",200000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"5177\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5178, "epsg", 5178,
-        "Korean 1985 / Unified CS", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Korean_Datum_1985", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=127.5 +k=0.9996 +x_0=100000");
-    add_proj4text (p, 1,
-        "0 +y_0=2000000 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korean 1985 / Unified CS\",GEOGCS[\"Korean 1985");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Korean_Datum_1985\",SPHEROID[\"Bessel 1841\",");
-    add_srs_wkt (p, 2,
-        "6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"6162\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 5,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORT");
-    add_srs_wkt (p, 6,
-        "H],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4162\"]");
-    add_srs_wkt (p, 7,
-        "],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 8,
-        "de_of_origin\",38],PARAMETER[\"central_meridian\",127.5]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",1000000],PARAMETER[\"false_northing\",2000000],U");
-    add_srs_wkt (p, 11,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"5178\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5179, "epsg", 5179,
-        "Korea 2000 / Unified CS", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Geocentric_datum_of_Korea", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=127.5 +k=0.9996 +x_0=100000");
-    add_proj4text (p, 1,
-        "0 +y_0=2000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korea 2000 / Unified CS\",GEOGCS[\"Korea 2000\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Geocentric_datum_of_Korea\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6737\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4737\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",38],PARAMETER[\"c");
-    add_srs_wkt (p, 9,
-        "entral_meridian\",127.5],PARAMETER[\"scale_factor\",0.99");
-    add_srs_wkt (p, 10,
-        "96],PARAMETER[\"false_easting\",1000000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",2000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"5179\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5180, "epsg", 5180,
-        "Korea 2000 / West Belt", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Geocentric_datum_of_Korea", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=125 +k=1 +x_0=200000 +y_0=5");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korea 2000 / West Belt\",GEOGCS[\"Korea 2000\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Geocentric_datum_of_Korea\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6737\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4737\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",38],PARAMETER[\"cen");
-    add_srs_wkt (p, 9,
-        "tral_meridian\",125],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",200000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 11,
-        "g\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"5180\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5181, "epsg", 5181,
-        "Korea 2000 / Central Belt", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Geocentric_datum_of_Korea", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=127 +k=1 +x_0=200000 +y_0=5");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korea 2000 / Central Belt\",GEOGCS[\"Korea 2000");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Geocentric_datum_of_Korea\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6737\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"4737\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 8,
-        "tor\"],PARAMETER[\"latitude_of_origin\",38],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "central_meridian\",127],PARAMETER[\"scale_factor\",1],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_easting\",200000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 11,
-        "hing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "1\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"5181\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5182, "epsg", 5182,
-        "Korea 2000 / Central Belt Jeju", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Geocentric_datum_of_Korea", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=127 +k=1 +x_0=200000 +y_0=5");
-    add_proj4text (p, 1,
-        "50000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korea 2000 / Central Belt Jeju\",GEOGCS[\"Korea");
-    add_srs_wkt (p, 1,
-        " 2000\",DATUM[\"Geocentric_datum_of_Korea\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6737\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4737\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",38],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"central_meridian\",127],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",200000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",550000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"5182\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5183, "epsg", 5183,
-        "Korea 2000 / East Belt", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Geocentric_datum_of_Korea", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=129 +k=1 +x_0=200000 +y_0=5");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korea 2000 / East Belt\",GEOGCS[\"Korea 2000\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Geocentric_datum_of_Korea\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6737\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4737\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",38],PARAMETER[\"cen");
-    add_srs_wkt (p, 9,
-        "tral_meridian\",129],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",200000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 11,
-        "g\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"5183\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5184, "epsg", 5184,
-        "Korea 2000 / East Sea Belt", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Geocentric_datum_of_Korea", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=131 +k=1 +x_0=200000 +y_0=5");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korea 2000 / East Sea Belt\",GEOGCS[\"Korea 200");
-    add_srs_wkt (p, 1,
-        "0\",DATUM[\"Geocentric_datum_of_Korea\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6737\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"4737\"]],PROJECTION[\"Transverse_Mer");
-    add_srs_wkt (p, 8,
-        "cator\"],PARAMETER[\"latitude_of_origin\",38],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"central_meridian\",131],PARAMETER[\"scale_factor\",1],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"false_easting\",200000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 11,
-        "rthing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"5184\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5185, "epsg", 5185,
-        "Korea 2000 / West Belt 2010", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Geocentric_datum_of_Korea", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=125 +k=1 +x_0=200000 +y_0=6");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korea 2000 / West Belt 2010\",GEOGCS[\"Korea 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Geocentric_datum_of_Korea\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6737\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4737\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",38],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"central_meridian\",125],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",200000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",600000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"5185\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5186, "epsg", 5186,
-        "Korea 2000 / Central Belt 2010", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Geocentric_datum_of_Korea", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=127 +k=1 +x_0=200000 +y_0=6");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korea 2000 / Central Belt 2010\",GEOGCS[\"Korea");
-    add_srs_wkt (p, 1,
-        " 2000\",DATUM[\"Geocentric_datum_of_Korea\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6737\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4737\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",38],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"central_meridian\",127],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",200000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",600000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"5186\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5187, "epsg", 5187,
-        "Korea 2000 / East Belt 2010", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Geocentric_datum_of_Korea", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=129 +k=1 +x_0=200000 +y_0=6");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korea 2000 / East Belt 2010\",GEOGCS[\"Korea 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Geocentric_datum_of_Korea\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6737\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4737\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",38],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"central_meridian\",129],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",200000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",600000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"5187\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5188, "epsg", 5188,
-        "Korea 2000 / East Sea Belt 2010", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Geocentric_datum_of_Korea", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=131 +k=1 +x_0=200000 +y_0=6");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Korea 2000 / East Sea Belt 2010\",GEOGCS[\"Kore");
-    add_srs_wkt (p, 1,
-        "a 2000\",DATUM[\"Geocentric_datum_of_Korea\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6737\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4737\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",38],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"central_meridian\",131],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",200000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",600000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"5188\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5221, "epsg", 5221,
-        "S-JTSK (Ferro) / Krovak East North", 0, 0,
-        "Bessel 1841", "Ferro",
-        "System_Jednotne_Trigonometricke_Site_Katastralni_Ferro", "Krovak", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=krovak +lat_0=49.5 +lon_0=42.5 +alpha=30.288139722");
-    add_proj4text (p, 1,
-        "22222 +k=0.9999 +x_0=0 +y_0=0 +ellps=bessel +towgs84=589");
-    add_proj4text (p, 2,
-        ",76,480,0,0,0,0 +pm=ferro +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"S-JTSK (Ferro) / Krovak East North\",GEOGCS[\"S");
-    add_srs_wkt (p, 1,
-        "-JTSK (Ferro)\",DATUM[\"System_Jednotne_Trigonometricke_");
-    add_srs_wkt (p, 2,
-        "Site_Katastralni_Ferro\",SPHEROID[\"Bessel 1841\",637739");
-    add_srs_wkt (p, 3,
-        "7.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[");
-    add_srs_wkt (p, 4,
-        "589,76,480,0,0,0,0],AUTHORITY[\"EPSG\",\"6818\"]],PRIMEM");
-    add_srs_wkt (p, 5,
-        "[\"Ferro\",-17.66666666666667,AUTHORITY[\"EPSG\",\"8909\"");
-    add_srs_wkt (p, 6,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 8,
-        "EAST],AUTHORITY[\"EPSG\",\"4818\"]],PROJECTION[\"Krovak\"");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"latitude_of_center\",49.5],PARAMETER[\"lon");
-    add_srs_wkt (p, 10,
-        "gitude_of_center\",42.5],PARAMETER[\"azimuth\",30.288139");
-    add_srs_wkt (p, 11,
-        "72222222],PARAMETER[\"pseudo_standard_parallel_1\",78.5]");
-    add_srs_wkt (p, 12,
-        ",PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 13,
-        "sting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 14,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"");
-    add_srs_wkt (p, 15,
-        "Y\",NORTH],AUTHORITY[\"EPSG\",\"5221\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5223, "epsg", 5223,
-        "WGS 84 / Gabon TM", 0, 0,
-        "WGS 84", "Greenwich",
-        "WGS_1984", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=0.9996 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=500000 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Gabon TM\",GEOGCS[\"WGS 84\",DATUM[\"W");
-    add_srs_wkt (p, 1,
-        "GS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTH");
-    add_srs_wkt (p, 2,
-        "ORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"]],");
-    add_srs_wkt (p, 3,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 4,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 5,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 7,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",12],PARAMETER[\"scale_factor\",0.99");
-    add_srs_wkt (p, 9,
-        "96],PARAMETER[\"false_easting\",500000],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_northing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"5223\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5228, "epsg", 5228,
-        "S-JTSK/05", 1, 1,
-        "Bessel 1841", "Greenwich",
-        "System_Jednotne_Trigonometricke_Site_Katastralni_05", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=572.213,85.334,461.");
-    add_proj4text (p, 1,
-        "94,4.9732,1.529,5.2484,3.5378 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"S-JTSK/05\",DATUM[\"System_Jednotne_Trigonometr");
-    add_srs_wkt (p, 1,
-        "icke_Site_Katastralni_05\",SPHEROID[\"Bessel 1841\",6377");
-    add_srs_wkt (p, 2,
-        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[572.213,85.334,461.94,4.9732,1.529,5.2484,3.5378],AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"1052\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 6,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"5228\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5229, "epsg", 5229,
-        "S-JTSK/05 (Ferro)", 1, 1,
-        "Bessel 1841", "Ferro",
-        "System_Jednotne_Trigonometricke_Site_Katastralni_05_Ferro", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=572.213,85.334,461.");
-    add_proj4text (p, 1,
-        "94,4.9732,1.529,5.2484,3.5378 +pm=ferro +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"S-JTSK/05 (Ferro)\",DATUM[\"System_Jednotne_Tri");
-    add_srs_wkt (p, 1,
-        "gonometricke_Site_Katastralni_05_Ferro\",SPHEROID[\"Bess");
-    add_srs_wkt (p, 2,
-        "el 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "004\"]],TOWGS84[572.213,85.334,461.94,4.9732,1.529,5.248");
-    add_srs_wkt (p, 4,
-        "4,3.5378],AUTHORITY[\"EPSG\",\"1055\"]],PRIMEM[\"Ferro\"");
-    add_srs_wkt (p, 5,
-        ",-17.66666666666667,AUTHORITY[\"EPSG\",\"8909\"]],UNIT[\"");
-    add_srs_wkt (p, 6,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 8,
-        "ORITY[\"EPSG\",\"5229\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5233, "epsg", 5233,
-        "SLD99", 1, 1,
-        "Everest 1830 (1937 Adjustment)", "Greenwich",
-        "Sri_Lanka_Datum_1999", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377276.345 +b=6356075.413140239 +towgs");
-    add_proj4text (p, 1,
-        "84=-0.293,766.95,87.713,0.195704,1.695068,3.473016,-0.03");
-    add_proj4text (p, 2,
-        "9338 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"SLD99\",DATUM[\"Sri_Lanka_Datum_1999\",SPHEROID");
-    add_srs_wkt (p, 1,
-        "[\"Everest 1830 (1937 Adjustment)\",6377276.345,300.8017");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7015\"]],TOWGS84[-0.293,766.95,87.");
-    add_srs_wkt (p, 3,
-        "713,0.195704,1.695068,3.473016,-0.039338],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"1053\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"5233\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5234, "epsg", 5234,
-        "Kandawala / Sri Lanka Grid", 0, 0,
-        "Everest 1830 (1937 Adjustment)", "Greenwich",
-        "Kandawala", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=7.000480277777778 +lon_0=80.771711111");
-    add_proj4text (p, 1,
-        "11112 +k=0.9999238418 +x_0=200000 +y_0=200000 +a=6377276");
-    add_proj4text (p, 2,
-        ".345 +b=6356075.413140239 +towgs84=-97,787,86,0,0,0,0 +u");
-    add_proj4text (p, 3,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Kandawala / Sri Lanka Grid\",GEOGCS[\"Kandawala");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Kandawala\",SPHEROID[\"Everest 1830 (1937 Adj");
-    add_srs_wkt (p, 2,
-        "ustment)\",6377276.345,300.8017,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "5\"]],TOWGS84[-97,787,86,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "244\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4244\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 8,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",7.0004");
-    add_srs_wkt (p, 9,
-        "80277777778],PARAMETER[\"central_meridian\",80.771711111");
-    add_srs_wkt (p, 10,
-        "11112],PARAMETER[\"scale_factor\",0.9999238418],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_easting\",200000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",200000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"5234\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5235, "epsg", 5235,
-        "SLD99 / Sri Lanka Grid 1999", 0, 0,
-        "Everest 1830 (1937 Adjustment)", "Greenwich",
-        "Sri_Lanka_Datum_1999", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=7.000471527777778 +lon_0=80.771713083");
-    add_proj4text (p, 1,
-        "33334 +k=0.9999238418 +x_0=500000 +y_0=500000 +a=6377276");
-    add_proj4text (p, 2,
-        ".345 +b=6356075.413140239 +towgs84=-0.293,766.95,87.713,");
-    add_proj4text (p, 3,
-        "0.195704,1.695068,3.473016,-0.039338 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SLD99 / Sri Lanka Grid 1999\",GEOGCS[\"SLD99\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Sri_Lanka_Datum_1999\",SPHEROID[\"Everest 1830 (");
-    add_srs_wkt (p, 2,
-        "1937 Adjustment)\",6377276.345,300.8017,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7015\"]],TOWGS84[-0.293,766.95,87.713,0.195704,1.69");
-    add_srs_wkt (p, 4,
-        "5068,3.473016,-0.039338],AUTHORITY[\"EPSG\",\"1053\"]],P");
-    add_srs_wkt (p, 5,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 6,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 7,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 8,
-        "UTHORITY[\"EPSG\",\"5233\"]],PROJECTION[\"Transverse_Mer");
-    add_srs_wkt (p, 9,
-        "cator\"],PARAMETER[\"latitude_of_origin\",7.000471527777");
-    add_srs_wkt (p, 10,
-        "778],PARAMETER[\"central_meridian\",80.77171308333334],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"scale_factor\",0.9999238418],PARAMETER[\"fals");
-    add_srs_wkt (p, 12,
-        "e_easting\",500000],PARAMETER[\"false_northing\",500000]");
-    add_srs_wkt (p, 13,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 14,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 15,
-        "\",\"5235\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5243, "epsg", 5243,
-        "ETRS89 / LCC Germany (E-N)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "European_Terrestrial_Reference_System_1989", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.66666666666666 +lat_2=53.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=51 +lon_0=10.5 +x_0=0 +y_0=0 +ellps=GRS80 +to");
-    add_proj4text (p, 2,
-        "wgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / LCC Germany (E-N)\",GEOGCS[\"ETRS89\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"European_Terrestrial_Reference_System_1989\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 8,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 9,
-        "lel_1\",48.66666666666666],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 10,
-        "_2\",53.66666666666666],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 11,
-        ",51],PARAMETER[\"central_meridian\",10.5],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 13,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"524");
-    add_srs_wkt (p, 15,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5246, "epsg", 5246,
-        "GDBD2009", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Geocentric_Datum_Brunei_Darussalam_2009", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"GDBD2009\",DATUM[\"Geocentric_Datum_Brunei_Daru");
-    add_srs_wkt (p, 1,
-        "ssalam_2009\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 2,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"1056\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 6,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"5246\"");
-    add_srs_wkt (p, 7,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 5247, "epsg", 5247,
-        "GDBD2009 / Brunei BRSO", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Geocentric_Datum_Brunei_Darussalam_2009", "Hotine_Oblique_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=4 +lonc=115 +alpha=53.31580995 +k=0.9");
-    add_proj4text (p, 1,
-        "9984 +x_0=0 +y_0=0 +no_uoff +gamma=53.13010236111111 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDBD2009 / Brunei BRSO\",GEOGCS[\"GDBD2009\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Geocentric_Datum_Brunei_Darussalam_2009\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"105");
-    add_srs_wkt (p, 4,
-        "6\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"5246\"]],PROJECTION[\"Hotine_");
-    add_srs_wkt (p, 8,
-        "Oblique_Mercator\"],PARAMETER[\"latitude_of_center\",4],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"longitude_of_center\",115],PARAMETER[\"azimu");
-    add_srs_wkt (p, 10,
-        "th\",53.31580995],PARAMETER[\"rectified_grid_angle\",53.");
-    add_srs_wkt (p, 11,
-        "13010236111111],PARAMETER[\"scale_factor\",0.99984],PARA");
-    add_srs_wkt (p, 12,
-        "METER[\"false_easting\",0],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 13,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"5247\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5252, "epsg", 5252,
-        "TUREF", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"TUREF\",DATUM[\"Turkish_National_Reference_Fram");
-    add_srs_wkt (p, 1,
-        "e\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 2,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1057\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"5252\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5253, "epsg", 5253,
-        "TUREF / TM27", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TUREF / TM27\",GEOGCS[\"TUREF\",DATUM[\"Turkish");
-    add_srs_wkt (p, 1,
-        "_National_Reference_Frame\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1057\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"5252\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",27],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 12,
-        "NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"5253\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5254, "epsg", 5254,
-        "TUREF / TM30", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TUREF / TM30\",GEOGCS[\"TUREF\",DATUM[\"Turkish");
-    add_srs_wkt (p, 1,
-        "_National_Reference_Frame\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1057\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"5252\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",30],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 12,
-        "NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"5254\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5255, "epsg", 5255,
-        "TUREF / TM33", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TUREF / TM33\",GEOGCS[\"TUREF\",DATUM[\"Turkish");
-    add_srs_wkt (p, 1,
-        "_National_Reference_Frame\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1057\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"5252\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",33],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 12,
-        "NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"5255\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5256, "epsg", 5256,
-        "TUREF / TM36", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TUREF / TM36\",GEOGCS[\"TUREF\",DATUM[\"Turkish");
-    add_srs_wkt (p, 1,
-        "_National_Reference_Frame\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1057\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"5252\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",36],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 12,
-        "NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"5256\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5257, "epsg", 5257,
-        "TUREF / TM39", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TUREF / TM39\",GEOGCS[\"TUREF\",DATUM[\"Turkish");
-    add_srs_wkt (p, 1,
-        "_National_Reference_Frame\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1057\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"5252\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",39],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 12,
-        "NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"5257\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5258, "epsg", 5258,
-        "TUREF / TM42", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TUREF / TM42\",GEOGCS[\"TUREF\",DATUM[\"Turkish");
-    add_srs_wkt (p, 1,
-        "_National_Reference_Frame\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1057\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"5252\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",42],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 12,
-        "NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"5258\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5259, "epsg", 5259,
-        "TUREF / TM45", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TUREF / TM45\",GEOGCS[\"TUREF\",DATUM[\"Turkish");
-    add_srs_wkt (p, 1,
-        "_National_Reference_Frame\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1057\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"5252\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",45],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 12,
-        "NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"5259\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5264, "epsg", 5264,
-        "DRUKREF 03", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Bhutan_National_Geodetic_Datum", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"DRUKREF 03\",DATUM[\"Bhutan_National_Geodetic_D");
-    add_srs_wkt (p, 1,
-        "atum\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 2,
-        "RITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"5264\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5266, "epsg", 5266,
-        "DRUKREF 03 / Bhutan National Grid", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=250000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Bhutan National Grid\",GEOGCS[\"DR");
-    add_srs_wkt (p, 1,
-        "UKREF 03\",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"1058\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"5264\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"central_meridian\",90],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",1],PARAMETER[\"false_easting\",250000],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"5266\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5269, "epsg", 5269,
-        "TUREF / 3-degree Gauss-Kruger zone 9", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=9500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TUREF / 3-degree Gauss-Kruger zone 9\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "TUREF\",DATUM[\"Turkish_National_Reference_Frame\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1057\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"5252\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",27],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",9500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"5269\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5270, "epsg", 5270,
-        "TUREF / 3-degree Gauss-Kruger zone 10", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=10500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TUREF / 3-degree Gauss-Kruger zone 10\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"TUREF\",DATUM[\"Turkish_National_Reference_Frame\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1057\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"5252\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",30],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 10,
-        "actor\",1],PARAMETER[\"false_easting\",10500000],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"5270\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5271, "epsg", 5271,
-        "TUREF / 3-degree Gauss-Kruger zone 11", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=11500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TUREF / 3-degree Gauss-Kruger zone 11\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"TUREF\",DATUM[\"Turkish_National_Reference_Frame\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1057\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"5252\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",33],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 10,
-        "actor\",1],PARAMETER[\"false_easting\",11500000],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"5271\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5272, "epsg", 5272,
-        "TUREF / 3-degree Gauss-Kruger zone 12", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=12500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TUREF / 3-degree Gauss-Kruger zone 12\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"TUREF\",DATUM[\"Turkish_National_Reference_Frame\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1057\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"5252\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",36],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 10,
-        "actor\",1],PARAMETER[\"false_easting\",12500000],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"5272\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5273, "epsg", 5273,
-        "TUREF / 3-degree Gauss-Kruger zone 13", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=13500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TUREF / 3-degree Gauss-Kruger zone 13\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"TUREF\",DATUM[\"Turkish_National_Reference_Frame\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1057\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"5252\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",39],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 10,
-        "actor\",1],PARAMETER[\"false_easting\",13500000],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"5273\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5274, "epsg", 5274,
-        "TUREF / 3-degree Gauss-Kruger zone 14", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=14500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TUREF / 3-degree Gauss-Kruger zone 14\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"TUREF\",DATUM[\"Turkish_National_Reference_Frame\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1057\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"5252\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",42],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 10,
-        "actor\",1],PARAMETER[\"false_easting\",14500000],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"5274\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5275, "epsg", 5275,
-        "TUREF / 3-degree Gauss-Kruger zone 15", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Turkish_National_Reference_Frame", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=15500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TUREF / 3-degree Gauss-Kruger zone 15\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"TUREF\",DATUM[\"Turkish_National_Reference_Frame\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1057\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"5252\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",45],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 10,
-        "actor\",1],PARAMETER[\"false_easting\",15500000],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"5275\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5292, "epsg", 5292,
-        "DRUKREF 03 / Bumthang TM", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90.73333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Bumthang TM\",GEOGCS[\"DRUKREF 03\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1058\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"5264\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"central_meridian\",90.73333333333333],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",1],PARAMETER[\"false_easting\",250000],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_northing\",-2500000],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 13,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"5292\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5293, "epsg", 5293,
-        "DRUKREF 03 / Chhukha TM", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=89.55 +k=1 +x_0=250000 +y_0=");
-    add_proj4text (p, 1,
-        "-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Chhukha TM\",GEOGCS[\"DRUKREF 03\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1058\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"5264\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"central_meridian\",89.55],PARAMETER[\"scale_factor\",1");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_easting\",250000],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"5293\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5294, "epsg", 5294,
-        "DRUKREF 03 / Dagana TM", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=89.84999999999999 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Dagana TM\",GEOGCS[\"DRUKREF 03\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1058\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"5264\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"central_meridian\",89.85],PARAMETER[\"scale_factor\",1");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_easting\",250000],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"5294\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5295, "epsg", 5295,
-        "DRUKREF 03 / Gasa TM", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90.03333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Gasa TM\",GEOGCS[\"DRUKREF 03\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1058\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"5264\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 8,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 9,
-        "entral_meridian\",90.03333333333333],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 10,
-        "actor\",1],PARAMETER[\"false_easting\",250000],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_northing\",-2500000],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 13,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"5295\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5296, "epsg", 5296,
-        "DRUKREF 03 / Ha TM", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90.15000000000001 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Ha TM\",GEOGCS[\"DRUKREF 03\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1058\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"5264\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 9,
-        "ntral_meridian\",90.15],PARAMETER[\"scale_factor\",1],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_easting\",250000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 11,
-        "hing\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"5296\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5297, "epsg", 5297,
-        "DRUKREF 03 / Lhuentse TM", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=91.13333333333334 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Lhuentse TM\",GEOGCS[\"DRUKREF 03\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"1058\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"5264\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"central_meridian\",91.13333333333334],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",1],PARAMETER[\"false_easting\",250000],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_northing\",-2500000],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 13,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"5297\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
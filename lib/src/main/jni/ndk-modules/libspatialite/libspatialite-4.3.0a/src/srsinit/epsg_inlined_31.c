@@ -1,4201 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_31 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 6462, "epsg", 6462,
-        "NAD83(2011) / Iowa North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=1000000 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Iowa North\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 8,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",43.2666666666");
-    add_srs_wkt (p, 9,
-        "6667],PARAMETER[\"standard_parallel_2\",42.0666666666666");
-    add_srs_wkt (p, 10,
-        "7],PARAMETER[\"latitude_of_origin\",41.5],PARAMETER[\"ce");
-    add_srs_wkt (p, 11,
-        "ntral_meridian\",-93.5],PARAMETER[\"false_easting\",1500");
-    add_srs_wkt (p, 12,
-        "000],PARAMETER[\"false_northing\",1000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 13,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Y\",NORTH],AUTHORITY[\"EPSG\",\"6462\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6463, "epsg", 6463,
-        "NAD83(2011) / Iowa North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=999999.99");
-    add_proj4text (p, 2,
-        "99898402 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Iowa North (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 8,
-        "ormal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",43.");
-    add_srs_wkt (p, 9,
-        "26666666666667],PARAMETER[\"standard_parallel_2\",42.066");
-    add_srs_wkt (p, 10,
-        "66666666667],PARAMETER[\"latitude_of_origin\",41.5],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"central_meridian\",-93.5],PARAMETER[\"false_east");
-    add_srs_wkt (p, 12,
-        "ing\",4921250],PARAMETER[\"false_northing\",3280833.3333");
-    add_srs_wkt (p, 13,
-        "00001],UNIT[\"US survey foot\",0.3048006096012192,AUTHOR");
-    add_srs_wkt (p, 14,
-        "ITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORT");
-    add_srs_wkt (p, 15,
-        "H],AUTHORITY[\"EPSG\",\"6463\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6464, "epsg", 6464,
-        "NAD83(2011) / Iowa South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Iowa South\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 8,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",41.7833333333");
-    add_srs_wkt (p, 9,
-        "3333],PARAMETER[\"standard_parallel_2\",40.6166666666666");
-    add_srs_wkt (p, 10,
-        "7],PARAMETER[\"latitude_of_origin\",40],PARAMETER[\"cent");
-    add_srs_wkt (p, 11,
-        "ral_meridian\",-93.5],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 12,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"6464\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6465, "epsg", 6465,
-        "NAD83(2011) / Iowa South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000.00001016 +y_0=0 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Iowa South (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 8,
-        "ormal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",41.");
-    add_srs_wkt (p, 9,
-        "78333333333333],PARAMETER[\"standard_parallel_2\",40.616");
-    add_srs_wkt (p, 10,
-        "66666666667],PARAMETER[\"latitude_of_origin\",40],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"central_meridian\",-93.5],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 12,
-        "g\",1640416.6667],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 13,
-        "US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 15,
-        "EPSG\",\"6465\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6466, "epsg", 6466,
-        "NAD83(2011) / Kansas North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=400000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kansas North\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",39.78333");
-    add_srs_wkt (p, 9,
-        "333333333],PARAMETER[\"standard_parallel_2\",38.71666666");
-    add_srs_wkt (p, 10,
-        "666667],PARAMETER[\"latitude_of_origin\",38.333333333333");
-    add_srs_wkt (p, 11,
-        "34],PARAMETER[\"central_meridian\",-98],PARAMETER[\"fals");
-    add_srs_wkt (p, 12,
-        "e_easting\",400000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 13,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 14,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6466\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6467, "epsg", 6467,
-        "NAD83(2011) / Kansas North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=399999.9999");
-    add_proj4text (p, 2,
-        "8984 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kansas North (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",3");
-    add_srs_wkt (p, 9,
-        "9.78333333333333],PARAMETER[\"standard_parallel_2\",38.7");
-    add_srs_wkt (p, 10,
-        "1666666666667],PARAMETER[\"latitude_of_origin\",38.33333");
-    add_srs_wkt (p, 11,
-        "333333334],PARAMETER[\"central_meridian\",-98],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_easting\",1312333.3333],PARAMETER[\"false_north");
-    add_srs_wkt (p, 13,
-        "ing\",0],UNIT[\"US survey foot\",0.3048006096012192,AUTH");
-    add_srs_wkt (p, 14,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 15,
-        "RTH],AUTHORITY[\"EPSG\",\"6467\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6468, "epsg", 6468,
-        "NAD83(2011) / Kansas South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=400000 +y");
-    add_proj4text (p, 2,
-        "_0=400000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kansas South\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",38.56666");
-    add_srs_wkt (p, 9,
-        "666666667],PARAMETER[\"standard_parallel_2\",37.26666666");
-    add_srs_wkt (p, 10,
-        "666667],PARAMETER[\"latitude_of_origin\",36.666666666666");
-    add_srs_wkt (p, 11,
-        "66],PARAMETER[\"central_meridian\",-98.5],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_easting\",400000],PARAMETER[\"false_northing\",40000");
-    add_srs_wkt (p, 13,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6468\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6469, "epsg", 6469,
-        "NAD83(2011) / Kansas South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=399999.99");
-    add_proj4text (p, 2,
-        "998984 +y_0=399999.99998984 +ellps=GRS80 +units=us-ft +n");
-    add_proj4text (p, 3,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kansas South (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",3");
-    add_srs_wkt (p, 9,
-        "8.56666666666667],PARAMETER[\"standard_parallel_2\",37.2");
-    add_srs_wkt (p, 10,
-        "6666666666667],PARAMETER[\"latitude_of_origin\",36.66666");
-    add_srs_wkt (p, 11,
-        "666666666],PARAMETER[\"central_meridian\",-98.5],PARAMET");
-    add_srs_wkt (p, 12,
-        "ER[\"false_easting\",1312333.3333],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 13,
-        "thing\",1312333.3333],UNIT[\"US survey foot\",0.30480060");
-    add_srs_wkt (p, 14,
-        "96012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],");
-    add_srs_wkt (p, 15,
-        "AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6469\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6470, "epsg", 6470,
-        "NAD83(2011) / Kentucky North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000 +y_0=0 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kentucky North\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 8,
-        "l_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",37.9666");
-    add_srs_wkt (p, 9,
-        "6666666667],PARAMETER[\"standard_parallel_2\",38.9666666");
-    add_srs_wkt (p, 10,
-        "6666667],PARAMETER[\"latitude_of_origin\",37.5],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"central_meridian\",-84.25],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 12,
-        "\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 13,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Y\",NORTH],AUTHORITY[\"EPSG\",\"6470\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6471, "epsg", 6471,
-        "NAD83(2011) / Kentucky North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000.0001016001 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kentucky North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",37.96666666666667],PARAMETER[\"standard_parallel_2\",38");
-    add_srs_wkt (p, 10,
-        ".96666666666667],PARAMETER[\"latitude_of_origin\",37.5],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"central_meridian\",-84.25],PARAMETER[\"false");
-    add_srs_wkt (p, 12,
-        "_easting\",1640416.667],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 13,
-        "UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"E");
-    add_srs_wkt (p, 14,
-        "PSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTH");
-    add_srs_wkt (p, 15,
-        "ORITY[\"EPSG\",\"6471\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6472, "epsg", 6472,
-        "NAD83(2011) / Kentucky Single Zone", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 ");
-    add_proj4text (p, 2,
-        "+y_0=1000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kentucky Single Zone\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",3");
-    add_srs_wkt (p, 9,
-        "7.08333333333334],PARAMETER[\"standard_parallel_2\",38.6");
-    add_srs_wkt (p, 10,
-        "6666666666666],PARAMETER[\"latitude_of_origin\",36.33333");
-    add_srs_wkt (p, 11,
-        "333333334],PARAMETER[\"central_meridian\",-85.75],PARAME");
-    add_srs_wkt (p, 12,
-        "TER[\"false_easting\",1500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 13,
-        "g\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 14,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 15,
-        ",\"6472\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6473, "epsg", 6473,
-        "NAD83(2011) / Kentucky Single Zone (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 ");
-    add_proj4text (p, 2,
-        "+y_0=999999.9998983998 +ellps=GRS80 +units=us-ft +no_def");
-    add_proj4text (p, 3,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kentucky Single Zone (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 8,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 9,
-        "el_1\",37.08333333333334],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",38.66666666666666],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 11,
-        "36.33333333333334],PARAMETER[\"central_meridian\",-85.75");
-    add_srs_wkt (p, 12,
-        "],PARAMETER[\"false_easting\",4921250],PARAMETER[\"false");
-    add_srs_wkt (p, 13,
-        "_northing\",3280833.333],UNIT[\"US survey foot\",0.30480");
-    add_srs_wkt (p, 14,
-        "06096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAS");
-    add_srs_wkt (p, 15,
-        "T],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6473\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6474, "epsg", 6474,
-        "NAD83(2011) / Kentucky South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000 +");
-    add_proj4text (p, 2,
-        "y_0=500000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kentucky South\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 8,
-        "l_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",37.9333");
-    add_srs_wkt (p, 9,
-        "3333333333],PARAMETER[\"standard_parallel_2\",36.7333333");
-    add_srs_wkt (p, 10,
-        "3333333],PARAMETER[\"latitude_of_origin\",36.33333333333");
-    add_srs_wkt (p, 11,
-        "334],PARAMETER[\"central_meridian\",-85.75],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_easting\",500000],PARAMETER[\"false_northing\",500");
-    add_srs_wkt (p, 13,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 14,
-        "[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6474");
-    add_srs_wkt (p, 15,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6475, "epsg", 6475,
-        "NAD83(2011) / Kentucky South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001016001 +y_0=500000.0001016001 +ellps=GRS80 +units=us-");
-    add_proj4text (p, 3,
-        "ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kentucky South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",37.93333333333333],PARAMETER[\"standard_parallel_2\",36");
-    add_srs_wkt (p, 10,
-        ".73333333333333],PARAMETER[\"latitude_of_origin\",36.333");
-    add_srs_wkt (p, 11,
-        "33333333334],PARAMETER[\"central_meridian\",-85.75],PARA");
-    add_srs_wkt (p, 12,
-        "METER[\"false_easting\",1640416.667],PARAMETER[\"false_n");
-    add_srs_wkt (p, 13,
-        "orthing\",1640416.667],UNIT[\"US survey foot\",0.3048006");
-    add_srs_wkt (p, 14,
-        "096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 15,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6475\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6476, "epsg", 6476,
-        "NAD83(2011) / Louisiana North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=1000000 +y_0=0 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Louisiana North\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Confor");
-    add_srs_wkt (p, 8,
-        "mal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",32.66");
-    add_srs_wkt (p, 9,
-        "666666666666],PARAMETER[\"standard_parallel_2\",31.16666");
-    add_srs_wkt (p, 10,
-        "666666667],PARAMETER[\"latitude_of_origin\",30.5],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"central_meridian\",-92.5],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 12,
-        "g\",1000000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 13,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6476\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6477, "epsg", 6477,
-        "NAD83(2011) / Louisiana North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=999999.9999898402 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Louisiana North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",32.66666666666666],PARAMETER[\"standard_parallel_2\",31");
-    add_srs_wkt (p, 10,
-        ".16666666666667],PARAMETER[\"latitude_of_origin\",30.5],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"central_meridian\",-92.5],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "easting\",3280833.333300001],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",0],UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],");
-    add_srs_wkt (p, 15,
-        "AUTHORITY[\"EPSG\",\"6477\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6478, "epsg", 6478,
-        "NAD83(2011) / Louisiana South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91");
-    add_proj4text (p, 1,
-        ".33333333333333 +x_0=1000000 +y_0=0 +ellps=GRS80 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Louisiana South\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Confor");
-    add_srs_wkt (p, 8,
-        "mal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",30.7]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"standard_parallel_2\",29.3],PARAMETER[\"lat");
-    add_srs_wkt (p, 10,
-        "itude_of_origin\",28.5],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 11,
-        "91.33333333333333],PARAMETER[\"false_easting\",1000000],");
-    add_srs_wkt (p, 12,
-        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH");
-    add_srs_wkt (p, 14,
-        "],AUTHORITY[\"EPSG\",\"6478\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6479, "epsg", 6479,
-        "NAD83(2011) / Louisiana South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91");
-    add_proj4text (p, 1,
-        ".33333333333333 +x_0=999999.9999898402 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Louisiana South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",30.7],PARAMETER[\"standard_parallel_2\",29.3],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"latitude_of_origin\",28.5],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 11,
-        "an\",-91.33333333333333],PARAMETER[\"false_easting\",328");
-    add_srs_wkt (p, 12,
-        "0833.333300001],PARAMETER[\"false_northing\",0],UNIT[\"U");
-    add_srs_wkt (p, 13,
-        "S survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 15,
-        "EPSG\",\"6479\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6480, "epsg", 6480,
-        "NAD83(2011) / Maine CS2000 Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.5 +lon_0=-69.125 +k=0.99998 +x_0=5");
-    add_proj4text (p, 1,
-        "00000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maine CS2000 Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",43.5],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",-69.125],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.99998],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"6480\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6481, "epsg", 6481,
-        "NAD83(2011) / Maine CS2000 East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.83333333333334 +lon_0=-67.875 +k=0");
-    add_proj4text (p, 1,
-        ".99998 +x_0=700000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maine CS2000 East\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 8,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",43.833333333");
-    add_srs_wkt (p, 9,
-        "33334],PARAMETER[\"central_meridian\",-67.875],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"scale_factor\",0.99998],PARAMETER[\"false_easting\",7");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"6481\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6482, "epsg", 6482,
-        "NAD83(2011) / Maine CS2000 West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.375 +k=0");
-    add_proj4text (p, 1,
-        ".99998 +x_0=300000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maine CS2000 West\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 8,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",42.833333333");
-    add_srs_wkt (p, 9,
-        "33334],PARAMETER[\"central_meridian\",-70.375],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"scale_factor\",0.99998],PARAMETER[\"false_easting\",3");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"6482\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6483, "epsg", 6483,
-        "NAD83(2011) / Maine East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.66666666666666 +lon_0=-68.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=300000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maine East\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",43.66666666666666],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",-68.5],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 10,
-        "tor\",0.9999],PARAMETER[\"false_easting\",300000],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTH");
-    add_srs_wkt (p, 13,
-        "ORITY[\"EPSG\",\"6483\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6484, "epsg", 6484,
-        "NAD83(2011) / Maine East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.66666666666666 +lon_0=-68.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +units=us");
-    add_proj4text (p, 2,
-        "-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maine East (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 8,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",43.666666666");
-    add_srs_wkt (p, 9,
-        "66666],PARAMETER[\"central_meridian\",-68.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",98425");
-    add_srs_wkt (p, 11,
-        "0.0000000002],PARAMETER[\"false_northing\",0],UNIT[\"US ");
-    add_srs_wkt (p, 12,
-        "survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 13,
-        "03\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EP");
-    add_srs_wkt (p, 14,
-        "SG\",\"6484\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6485, "epsg", 6485,
-        "NAD83(2011) / Maine West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999966667 +x_0=900000 +y_0=0 +ellps=GRS80 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maine West\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",42.83333333333334],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",-70.16666666666667],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"scale_factor\",0.999966667],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",900000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 12,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6485\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6486, "epsg", 6486,
-        "NAD83(2011) / Maine West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999966667 +x_0=900000 +y_0=0 +ellps=GRS80 +u");
-    add_proj4text (p, 2,
-        "nits=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maine West (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 8,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",42.833333333");
-    add_srs_wkt (p, 9,
-        "33334],PARAMETER[\"central_meridian\",-70.16666666666667");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"scale_factor\",0.999966667],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",2952750],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EP");
-    add_srs_wkt (p, 13,
-        "SG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"6486\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6487, "epsg", 6487,
-        "NAD83(2011) / Maryland", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666");
-    add_proj4text (p, 1,
-        "666 +lon_0=-77 +x_0=400000 +y_0=0 +ellps=GRS80 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maryland\",GEOGCS[\"NAD83(2011)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"NAD83_National_Spatial_Reference_System_2011\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 8,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",39.45],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_2\",38.3],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 10,
-        "f_origin\",37.66666666666666],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 11,
-        "an\",-77],PARAMETER[\"false_easting\",400000],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"6487\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6488, "epsg", 6488,
-        "NAD83(2011) / Maryland (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666");
-    add_proj4text (p, 1,
-        "666 +lon_0=-77 +x_0=399999.9998983998 +y_0=0 +ellps=GRS8");
-    add_proj4text (p, 2,
-        "0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maryland (ftUS)\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Confor");
-    add_srs_wkt (p, 8,
-        "mal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",39.45");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_2\",38.3],PARAMETER[\"la");
-    add_srs_wkt (p, 10,
-        "titude_of_origin\",37.66666666666666],PARAMETER[\"centra");
-    add_srs_wkt (p, 11,
-        "l_meridian\",-77],PARAMETER[\"false_easting\",1312333.33");
-    add_srs_wkt (p, 12,
-        "3],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot");
-    add_srs_wkt (p, 13,
-        "\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS");
-    add_srs_wkt (p, 14,
-        "[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6488");
-    add_srs_wkt (p, 15,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6489, "epsg", 6489,
-        "NAD83(2011) / Massachusetts Island", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Massachusetts Island\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",4");
-    add_srs_wkt (p, 9,
-        "1.48333333333333],PARAMETER[\"standard_parallel_2\",41.2");
-    add_srs_wkt (p, 10,
-        "8333333333333],PARAMETER[\"latitude_of_origin\",41],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"central_meridian\",-70.5],PARAMETER[\"false_east");
-    add_srs_wkt (p, 12,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 13,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AX");
-    add_srs_wkt (p, 14,
-        "IS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6489\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6490, "epsg", 6490,
-        "NAD83(2011) / Massachusetts Island (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000.0001016001 +y_0=0");
-    add_proj4text (p, 2,
-        " +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Massachusetts Island (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 8,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 9,
-        "el_1\",41.48333333333333],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",41.28333333333333],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 11,
-        "41],PARAMETER[\"central_meridian\",-70.5],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_easting\",1640416.667],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 13,
-        "0],UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY[");
-    add_srs_wkt (p, 14,
-        "\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],A");
-    add_srs_wkt (p, 15,
-        "UTHORITY[\"EPSG\",\"6490\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6491, "epsg", 6491,
-        "NAD83(2011) / Massachusetts Mainland", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000 +y_0=750000 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Massachusetts Mainland\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",42.68333333333333],PARAMETER[\"standard_parallel_2\",41");
-    add_srs_wkt (p, 10,
-        ".71666666666667],PARAMETER[\"latitude_of_origin\",41],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"central_meridian\",-71.5],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 12,
-        "sting\",200000],PARAMETER[\"false_northing\",750000],UNI");
-    add_srs_wkt (p, 13,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",E");
-    add_srs_wkt (p, 14,
-        "AST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6491\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6492, "epsg", 6492,
-        "NAD83(2011) / Massachusetts Mainland (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000.0001016002 +y_0=7");
-    add_proj4text (p, 2,
-        "50000 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Massachusetts Mainland (ftUS)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 8,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 9,
-        "lel_1\",42.68333333333333],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 10,
-        "_2\",41.71666666666667],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 11,
-        ",41],PARAMETER[\"central_meridian\",-71.5],PARAMETER[\"f");
-    add_srs_wkt (p, 12,
-        "alse_easting\",656166.667],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 13,
-        "2460625],UNIT[\"US survey foot\",0.3048006096012192,AUTH");
-    add_srs_wkt (p, 14,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 15,
-        "RTH],AUTHORITY[\"EPSG\",\"6492\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6493, "epsg", 6493,
-        "NAD83(2011) / Michigan Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43");
-    add_proj4text (p, 1,
-        ".31666666666667 +lon_0=-84.36666666666666 +x_0=6000000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Michigan Central\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",45.7");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_2\",44.18333333333333],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"latitude_of_origin\",43.31666666666667],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"central_meridian\",-84.36666666666666],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_easting\",6000000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 13,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6493\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6494, "epsg", 6494,
-        "NAD83(2011) / Michigan Central (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43");
-    add_proj4text (p, 1,
-        ".31666666666667 +lon_0=-84.36666666666666 +x_0=5999999.9");
-    add_proj4text (p, 2,
-        "99976001 +y_0=0 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Michigan Central (ft)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",45.7],PARAMETER[\"standard_parallel_2\",44.183333333333");
-    add_srs_wkt (p, 10,
-        "33],PARAMETER[\"latitude_of_origin\",43.31666666666667],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"central_meridian\",-84.36666666666666],PARAM");
-    add_srs_wkt (p, 12,
-        "ETER[\"false_easting\",19685039.37],PARAMETER[\"false_no");
-    add_srs_wkt (p, 13,
-        "rthing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 14,
-        "02\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EP");
-    add_srs_wkt (p, 15,
-        "SG\",\"6494\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6495, "epsg", 6495,
-        "NAD83(2011) / Michigan North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=8000000 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Michigan North\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 8,
-        "l_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",47.0833");
-    add_srs_wkt (p, 9,
-        "3333333334],PARAMETER[\"standard_parallel_2\",45.4833333");
-    add_srs_wkt (p, 10,
-        "3333333],PARAMETER[\"latitude_of_origin\",44.78333333333");
-    add_srs_wkt (p, 11,
-        "333],PARAMETER[\"central_meridian\",-87],PARAMETER[\"fal");
-    add_srs_wkt (p, 12,
-        "se_easting\",8000000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 13,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 14,
-        "EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6495\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6496, "epsg", 6496,
-        "NAD83(2011) / Michigan North (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=7999999.999");
-    add_proj4text (p, 2,
-        "968001 +y_0=0 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Michigan North (ft)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",4");
-    add_srs_wkt (p, 9,
-        "7.08333333333334],PARAMETER[\"standard_parallel_2\",45.4");
-    add_srs_wkt (p, 10,
-        "8333333333333],PARAMETER[\"latitude_of_origin\",44.78333");
-    add_srs_wkt (p, 11,
-        "333333333],PARAMETER[\"central_meridian\",-87],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_easting\",26246719.16],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 13,
-        "ng\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"");
-    add_srs_wkt (p, 14,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 15,
-        ",\"6496\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6497, "epsg", 6497,
-        "NAD83(2011) / Michigan Oblique Mercator", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Hotine_Oblique_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=45.30916666666666 +lonc=-86 +alpha=33");
-    add_proj4text (p, 1,
-        "7.25556 +k=0.9996 +x_0=2546731.496 +y_0=-4354009.816 +no");
-    add_proj4text (p, 2,
-        "_uoff +gamma=337.25556 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Michigan Oblique Mercator\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Hoti");
-    add_srs_wkt (p, 8,
-        "ne_Oblique_Mercator\"],PARAMETER[\"latitude_of_center\",");
-    add_srs_wkt (p, 9,
-        "45.30916666666666],PARAMETER[\"longitude_of_center\",-86");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"azimuth\",337.25556],PARAMETER[\"rectified");
-    add_srs_wkt (p, 11,
-        "_grid_angle\",337.25556],PARAMETER[\"scale_factor\",0.99");
-    add_srs_wkt (p, 12,
-        "96],PARAMETER[\"false_easting\",2546731.496],PARAMETER[\"");
-    add_srs_wkt (p, 13,
-        "false_northing\",-4354009.816],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH]");
-    add_srs_wkt (p, 15,
-        ",AUTHORITY[\"EPSG\",\"6497\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6498, "epsg", 6498,
-        "NAD83(2011) / Michigan South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41");
-    add_proj4text (p, 1,
-        ".5 +lon_0=-84.36666666666666 +x_0=4000000 +y_0=0 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Michigan South\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 8,
-        "l_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",43.6666");
-    add_srs_wkt (p, 9,
-        "6666666666],PARAMETER[\"standard_parallel_2\",42.1],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"latitude_of_origin\",41.5],PARAMETER[\"central_m");
-    add_srs_wkt (p, 11,
-        "eridian\",-84.36666666666666],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 12,
-        ",4000000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 13,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Y\",NORTH],AUTHORITY[\"EPSG\",\"6498\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6499, "epsg", 6499,
-        "NAD83(2011) / Michigan South (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41");
-    add_proj4text (p, 1,
-        ".5 +lon_0=-84.36666666666666 +x_0=3999999.999984 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Michigan South (ft)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",4");
-    add_srs_wkt (p, 9,
-        "3.66666666666666],PARAMETER[\"standard_parallel_2\",42.1");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"latitude_of_origin\",41.5],PARAMETER[\"cen");
-    add_srs_wkt (p, 11,
-        "tral_meridian\",-84.36666666666666],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 12,
-        "sting\",13123359.58],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 13,
-        "T[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X");
-    add_srs_wkt (p, 14,
-        "\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6499\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6500, "epsg", 6500,
-        "NAD83(2011) / Minnesota Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.05 +lat_2=45.61666666666667 +lat_0=4");
-    add_proj4text (p, 1,
-        "5 +lon_0=-94.25 +x_0=800000 +y_0=100000 +ellps=GRS80 +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Minnesota Central\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 8,
-        "ormal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",47.");
-    add_srs_wkt (p, 9,
-        "05],PARAMETER[\"standard_parallel_2\",45.61666666666667]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"latitude_of_origin\",45],PARAMETER[\"centra");
-    add_srs_wkt (p, 11,
-        "l_meridian\",-94.25],PARAMETER[\"false_easting\",800000]");
-    add_srs_wkt (p, 12,
-        ",PARAMETER[\"false_northing\",100000],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"6500\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6501, "epsg", 6501,
-        "NAD83(2011) / Minnesota Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.05 +lat_2=45.61666666666667 +lat_0=4");
-    add_proj4text (p, 1,
-        "5 +lon_0=-94.25 +x_0=800000.0000101599 +y_0=99999.999989");
-    add_proj4text (p, 2,
-        "83997 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Minnesota Central (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 4,
-        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 8,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1");
-    add_srs_wkt (p, 9,
-        "\",47.05],PARAMETER[\"standard_parallel_2\",45.616666666");
-    add_srs_wkt (p, 10,
-        "66667],PARAMETER[\"latitude_of_origin\",45],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "central_meridian\",-94.25],PARAMETER[\"false_easting\",2");
-    add_srs_wkt (p, 12,
-        "624666.6667],PARAMETER[\"false_northing\",328083.3333],U");
-    add_srs_wkt (p, 13,
-        "NIT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EP");
-    add_srs_wkt (p, 14,
-        "SG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHO");
-    add_srs_wkt (p, 15,
-        "RITY[\"EPSG\",\"6501\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6502, "epsg", 6502,
-        "NAD83(2011) / Minnesota North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.63333333333333 +lat_2=47.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=46.5 +lon_0=-93.09999999999999 +x_0=800000 +y");
-    add_proj4text (p, 2,
-        "_0=100000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Minnesota North\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Confor");
-    add_srs_wkt (p, 8,
-        "mal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",48.63");
-    add_srs_wkt (p, 9,
-        "333333333333],PARAMETER[\"standard_parallel_2\",47.03333");
-    add_srs_wkt (p, 10,
-        "333333333],PARAMETER[\"latitude_of_origin\",46.5],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"central_meridian\",-93.1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 12,
-        "g\",800000],PARAMETER[\"false_northing\",100000],UNIT[\"");
-    add_srs_wkt (p, 13,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6502\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6503, "epsg", 6503,
-        "NAD83(2011) / Minnesota North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.63333333333333 +lat_2=47.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=46.5 +lon_0=-93.09999999999999 +x_0=800000.00");
-    add_proj4text (p, 2,
-        "00101599 +y_0=99999.99998983997 +ellps=GRS80 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Minnesota North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",48.63333333333333],PARAMETER[\"standard_parallel_2\",47");
-    add_srs_wkt (p, 10,
-        ".03333333333333],PARAMETER[\"latitude_of_origin\",46.5],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"central_meridian\",-93.1],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "easting\",2624666.6667],PARAMETER[\"false_northing\",328");
-    add_srs_wkt (p, 13,
-        "083.3333],UNIT[\"US survey foot\",0.3048006096012192,AUT");
-    add_srs_wkt (p, 14,
-        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",N");
-    add_srs_wkt (p, 15,
-        "ORTH],AUTHORITY[\"EPSG\",\"6503\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6504, "epsg", 6504,
-        "NAD83(2011) / Minnesota South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.21666666666667 +lat_2=43.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=43 +lon_0=-94 +x_0=800000 +y_0=100000 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Minnesota South\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Confor");
-    add_srs_wkt (p, 8,
-        "mal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",45.21");
-    add_srs_wkt (p, 9,
-        "666666666667],PARAMETER[\"standard_parallel_2\",43.78333");
-    add_srs_wkt (p, 10,
-        "333333333],PARAMETER[\"latitude_of_origin\",43],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"central_meridian\",-94],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 12,
-        "800000],PARAMETER[\"false_northing\",100000],UNIT[\"metr");
-    add_srs_wkt (p, 13,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6504\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6505, "epsg", 6505,
-        "NAD83(2011) / Minnesota South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.21666666666667 +lat_2=43.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=43 +lon_0=-94 +x_0=800000.0000101599 +y_0=999");
-    add_proj4text (p, 2,
-        "99.99998983997 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Minnesota South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",45.21666666666667],PARAMETER[\"standard_parallel_2\",43");
-    add_srs_wkt (p, 10,
-        ".78333333333333],PARAMETER[\"latitude_of_origin\",43],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"central_meridian\",-94],PARAMETER[\"false_east");
-    add_srs_wkt (p, 12,
-        "ing\",2624666.6667],PARAMETER[\"false_northing\",328083.");
-    add_srs_wkt (p, 13,
-        "3333],UNIT[\"US survey foot\",0.3048006096012192,AUTHORI");
-    add_srs_wkt (p, 14,
-        "TY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH");
-    add_srs_wkt (p, 15,
-        "],AUTHORITY[\"EPSG\",\"6505\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6506, "epsg", 6506,
-        "NAD83(2011) / Mississippi East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=300000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Mississippi East\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",29.5],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"central_meridian\",-88.83333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",0.99995],PARAMETER[\"false_easting\",3000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"6506\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6507, "epsg", 6507,
-        "NAD83(2011) / Mississippi East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +units=u");
-    add_proj4text (p, 2,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Mississippi East (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",29.5],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",-88.83333333333333],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",0.99995],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",984250.0000000002],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"6507\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6508, "epsg", 6508,
-        "NAD83(2011) / Mississippi TM", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=32.5 +lon_0=-89.75 +k=0.9998335 +x_0=");
-    add_proj4text (p, 1,
-        "500000 +y_0=1300000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Mississippi TM\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 8,
-        "tor\"],PARAMETER[\"latitude_of_origin\",32.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"central_meridian\",-89.75],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 10,
-        "0.9998335],PARAMETER[\"false_easting\",500000],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_northing\",1300000],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"6508\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6509, "epsg", 6509,
-        "NAD83(2011) / Mississippi West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=700000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Mississippi West\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",29.5],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"central_meridian\",-90.33333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",0.99995],PARAMETER[\"false_easting\",7000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"6509\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6510, "epsg", 6510,
-        "NAD83(2011) / Mississippi West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +units=u");
-    add_proj4text (p, 2,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Mississippi West (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",29.5],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",-90.33333333333333],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",0.99995],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",2296583.333],PARAMETER[\"false_northing\",0],UNIT[\"US ");
-    add_srs_wkt (p, 12,
-        "survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 13,
-        "03\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EP");
-    add_srs_wkt (p, 14,
-        "SG\",\"6510\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6511, "epsg", 6511,
-        "NAD83(2011) / Missouri Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=35.83333333333334 +lon_0=-92.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99933333 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Missouri Central\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",35.8333333333");
-    add_srs_wkt (p, 9,
-        "3334],PARAMETER[\"central_meridian\",-92.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",0.999933333],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"6511\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6512, "epsg", 6512,
-        "NAD83(2011) / Missouri East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=35.83333333333334 +lon_0=-90.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99933333 +x_0=250000 +y_0=0 +ellps=GRS80 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Missouri East\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",35.83333333333334");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-90.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.999933333],PARAMETER[\"false_easting\",2500");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"6512\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6513, "epsg", 6513,
-        "NAD83(2011) / Missouri West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.16666666666666 +lon_0=-94.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99941177 +x_0=850000 +y_0=0 +ellps=GRS80 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Missouri West\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",36.16666666666666");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-94.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.999941177],PARAMETER[\"false_easting\",8500");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"6513\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6514, "epsg", 6514,
-        "NAD83(2011) / Montana", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5");
-    add_proj4text (p, 1,
-        " +x_0=600000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Montana\",GEOGCS[\"NAD83(2011)\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"NAD83_National_Spatial_Reference_System_2011\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 8,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",49],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_2\",45],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 10,
-        "gin\",44.25],PARAMETER[\"central_meridian\",-109.5],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",600000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 14,
-        "514\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6515, "epsg", 6515,
-        "NAD83(2011) / Montana (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5");
-    add_proj4text (p, 1,
-        " +x_0=599999.9999976 +y_0=0 +ellps=GRS80 +units=ft +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Montana (ft)\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",49],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_2\",45],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 10,
-        "f_origin\",44.25],PARAMETER[\"central_meridian\",-109.5]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_easting\",1968503.937],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9002\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"6515\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6516, "epsg", 6516,
-        "NAD83(2011) / Nebraska", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=40 +lat_0=39.83333333333334 +");
-    add_proj4text (p, 1,
-        "lon_0=-100 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nebraska\",GEOGCS[\"NAD83(2011)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"NAD83_National_Spatial_Reference_System_2011\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 8,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",43],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_2\",40],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 10,
-        "gin\",39.83333333333334],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 11,
-        "-100],PARAMETER[\"false_easting\",500000],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"6516\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6517, "epsg", 6517,
-        "NAD83(2011) / Nebraska (ftUS) (deprecated)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=40 +lat_0=39.83333333333334 +");
-    add_proj4text (p, 1,
-        "lon_0=-100 +x_0=500000.00001016 +y_0=0 +ellps=GRS80 +tow");
-    add_proj4text (p, 2,
-        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nebraska (ftUS) (deprecated)\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_");
-    add_srs_wkt (p, 2,
-        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 3,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,");
-    add_srs_wkt (p, 4,
-        "0,0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 5,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 6,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati");
-    add_srs_wkt (p, 7,
-        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 8,
-        ",\"4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",43],PARAMETER[\"standa");
-    add_srs_wkt (p, 10,
-        "rd_parallel_2\",40],PARAMETER[\"latitude_of_origin\",39.");
-    add_srs_wkt (p, 11,
-        "83333333333334],PARAMETER[\"central_meridian\",-100],PAR");
-    add_srs_wkt (p, 12,
-        "AMETER[\"false_easting\",1640416.6667],PARAMETER[\"false");
-    add_srs_wkt (p, 13,
-        "_northing\",0],UNIT[\"US survey foot\",0.304800609601219");
-    add_srs_wkt (p, 14,
-        "2,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"");
-    add_srs_wkt (p, 15,
-        "Y\",NORTH],AUTHORITY[\"EPSG\",\"6517\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6518, "epsg", 6518,
-        "NAD83(2011) / Nevada Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=500000 +y_0=6000000 +ellps=GRS80 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nevada Central\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 8,
-        "tor\"],PARAMETER[\"latitude_of_origin\",34.75],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"central_meridian\",-116.6666666666667],PARAMETER[\"sc");
-    add_srs_wkt (p, 10,
-        "ale_factor\",0.9999],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_northing\",6000000],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"6518\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6519, "epsg", 6519,
-        "NAD83(2011) / Nevada Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=500000.00001016 +y_0=6000000 +ellps=GRS80 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nevada Central (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 8,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",34.75],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",-116.6666666666667],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",1640416.6667],PARAMETER[\"false_northing\",19685000],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHOR");
-    add_srs_wkt (p, 14,
-        "ITY[\"EPSG\",\"6519\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6520, "epsg", 6520,
-        "NAD83(2011) / Nevada East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=200000 +y_0=8000000 +ellps=GRS80 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nevada East\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 7,
-        "RITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 8,
-        "r\"],PARAMETER[\"latitude_of_origin\",34.75],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "central_meridian\",-115.5833333333333],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",200000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",8000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"6520\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6521, "epsg", 6521,
-        "NAD83(2011) / Nevada East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=200000.00001016 +y_0=8000000.000010163 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nevada East (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",34.75],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",-115.5833333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",65");
-    add_srs_wkt (p, 11,
-        "6166.6667],PARAMETER[\"false_northing\",26246666.6667000");
-    add_srs_wkt (p, 12,
-        "1],UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],A");
-    add_srs_wkt (p, 14,
-        "UTHORITY[\"EPSG\",\"6521\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6522, "epsg", 6522,
-        "NAD83(2011) / Nevada West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=800000 +y_0=4000000 +ellps=GRS80 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nevada West\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 7,
-        "RITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 8,
-        "r\"],PARAMETER[\"latitude_of_origin\",34.75],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "central_meridian\",-118.5833333333333],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",800000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",4000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"6522\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6523, "epsg", 6523,
-        "NAD83(2011) / Nevada West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=800000.0000101599 +y_0=3999999.99998984 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nevada West (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",34.75],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",-118.5833333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",26");
-    add_srs_wkt (p, 11,
-        "24666.6667],PARAMETER[\"false_northing\",13123333.3333],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTH");
-    add_srs_wkt (p, 14,
-        "ORITY[\"EPSG\",\"6523\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6524, "epsg", 6524,
-        "NAD83(2011) / New Hampshire", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=300000 +y_0=0 +ellps=GRS80 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Hampshire\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",42.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "central_meridian\",-71.66666666666667],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.999966667],PARAMETER[\"false_easting\",30000");
-    add_srs_wkt (p, 11,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 13,
-        "RTH],AUTHORITY[\"EPSG\",\"6524\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6525, "epsg", 6525,
-        "NAD83(2011) / New Hampshire (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Hampshire (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",42.5],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",-71.66666666666667],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"scale_factor\",0.999966667],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 11,
-        "\",984250.0000000002],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHOR");
-    add_srs_wkt (p, 14,
-        "ITY[\"EPSG\",\"6525\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6526, "epsg", 6526,
-        "NAD83(2011) / New Jersey", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Jersey\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",38.83333333333334],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",-74.5],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 10,
-        "tor\",0.9999],PARAMETER[\"false_easting\",150000],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTH");
-    add_srs_wkt (p, 13,
-        "ORITY[\"EPSG\",\"6526\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6527, "epsg", 6527,
-        "NAD83(2011) / New Jersey (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +units=us-ft +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Jersey (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 8,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",38.833333333");
-    add_srs_wkt (p, 9,
-        "33334],PARAMETER[\"central_meridian\",-74.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",49212");
-    add_srs_wkt (p, 11,
-        "5],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot");
-    add_srs_wkt (p, 12,
-        "\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6527");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6528, "epsg", 6528,
-        "NAD83(2011) / New Mexico Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000");
-    add_proj4text (p, 1,
-        "00 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Mexico Central\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 8,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"central_meridian\",-106.25],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",0.9999],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"6528\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6529, "epsg", 6529,
-        "NAD83(2011) / New Mexico Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000");
-    add_proj4text (p, 1,
-        "00.0001016001 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Mexico Central (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"central_meridian\",-106.25],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",1640416.6");
-    add_srs_wkt (p, 11,
-        "67],PARAMETER[\"false_northing\",0],UNIT[\"US survey foo");
-    add_srs_wkt (p, 12,
-        "t\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"652");
-    add_srs_wkt (p, 14,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6530, "epsg", 6530,
-        "NAD83(2011) / New Mexico East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Mexico East\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mer");
-    add_srs_wkt (p, 8,
-        "cator\"],PARAMETER[\"latitude_of_origin\",31],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"central_meridian\",-104.3333333333333],PARAMETER[\"sca");
-    add_srs_wkt (p, 10,
-        "le_factor\",0.999909091],PARAMETER[\"false_easting\",165");
-    add_srs_wkt (p, 11,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"6530\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6531, "epsg", 6531,
-        "NAD83(2011) / New Mexico East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +units=us-ft +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Mexico East (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 8,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",-104.3333333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"scale_factor\",0.999909091],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 11,
-        "\",541337.5],PARAMETER[\"false_northing\",0],UNIT[\"US s");
-    add_srs_wkt (p, 12,
-        "urvey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "3\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"6531\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6532, "epsg", 6532,
-        "NAD83(2011) / New Mexico West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "916667 +x_0=830000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Mexico West\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mer");
-    add_srs_wkt (p, 8,
-        "cator\"],PARAMETER[\"latitude_of_origin\",31],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"central_meridian\",-107.8333333333333],PARAMETER[\"sca");
-    add_srs_wkt (p, 10,
-        "le_factor\",0.999916667],PARAMETER[\"false_easting\",830");
-    add_srs_wkt (p, 11,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"6532\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6533, "epsg", 6533,
-        "NAD83(2011) / New Mexico West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "916667 +x_0=830000.0001016001 +y_0=0 +ellps=GRS80 +units");
-    add_proj4text (p, 2,
-        "=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Mexico West (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 8,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",-107.8333333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"scale_factor\",0.999916667],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 11,
-        "\",2723091.667],PARAMETER[\"false_northing\",0],UNIT[\"U");
-    add_srs_wkt (p, 12,
-        "S survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"6533\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6534, "epsg", 6534,
-        "NAD83(2011) / New York Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=250000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York Central\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 8,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",40],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"central_meridian\",-76.58333333333333],PARAMETER[\"sc");
-    add_srs_wkt (p, 10,
-        "ale_factor\",0.9999375],PARAMETER[\"false_easting\",2500");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"6534\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6535, "epsg", 6535,
-        "NAD83(2011) / New York Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=249999.9998983998 +y_0=0 +ellps=GRS80 +units=u");
-    add_proj4text (p, 2,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York Central (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",40],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",-76.58333333333333],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"scale_factor\",0.9999375],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",820208.3330000002],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"6535\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6536, "epsg", 6536,
-        "NAD83(2011) / New York East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York East\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",38.83333333333334");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-74.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",150000],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"6536\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6537, "epsg", 6537,
-        "NAD83(2011) / New York East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +units=us-ft +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York East (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",38.8333333");
-    add_srs_wkt (p, 9,
-        "3333334],PARAMETER[\"central_meridian\",-74.5],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",49");
-    add_srs_wkt (p, 11,
-        "2125],PARAMETER[\"false_northing\",0],UNIT[\"US survey f");
-    add_srs_wkt (p, 12,
-        "oot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 14,
-        "537\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6538, "epsg", 6538,
-        "NAD83(2011) / New York Long Island", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York Long Island\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",4");
-    add_srs_wkt (p, 9,
-        "1.03333333333333],PARAMETER[\"standard_parallel_2\",40.6");
-    add_srs_wkt (p, 10,
-        "6666666666666],PARAMETER[\"latitude_of_origin\",40.16666");
-    add_srs_wkt (p, 11,
-        "666666666],PARAMETER[\"central_meridian\",-74],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_easting\",300000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 13,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6538\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6539, "epsg", 6539,
-        "NAD83(2011) / New York Long Island (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000.0000");
-    add_proj4text (p, 2,
-        "000001 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York Long Island (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 8,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 9,
-        "el_1\",41.03333333333333],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",40.66666666666666],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 11,
-        "40.16666666666666],PARAMETER[\"central_meridian\",-74],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_easting\",984250.0000000002],PARAMETER[");
-    add_srs_wkt (p, 13,
-        "\"false_northing\",0],UNIT[\"US survey foot\",0.30480060");
-    add_srs_wkt (p, 14,
-        "96012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],");
-    add_srs_wkt (p, 15,
-        "AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6539\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6540, "epsg", 6540,
-        "NAD83(2011) / New York West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=350000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York West\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",40],PARAMETER[\"c");
-    add_srs_wkt (p, 9,
-        "entral_meridian\",-78.58333333333333],PARAMETER[\"scale_");
-    add_srs_wkt (p, 10,
-        "factor\",0.9999375],PARAMETER[\"false_easting\",350000],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 12,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH");
-    add_srs_wkt (p, 13,
-        "],AUTHORITY[\"EPSG\",\"6540\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6541, "epsg", 6541,
-        "NAD83(2011) / New York West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=350000.0001016001 +y_0=0 +ellps=GRS80 +units=u");
-    add_proj4text (p, 2,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York West (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",40],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"central_meridian\",-78.58333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",0.9999375],PARAMETER[\"false_easting\",11");
-    add_srs_wkt (p, 11,
-        "48291.667],PARAMETER[\"false_northing\",0],UNIT[\"US sur");
-    add_srs_wkt (p, 12,
-        "vey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"6541\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6542, "epsg", 6542,
-        "NAD83(2011) / North Carolina", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.22 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / North Carolina\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 8,
-        "l_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",36.1666");
-    add_srs_wkt (p, 9,
-        "6666666666],PARAMETER[\"standard_parallel_2\",34.3333333");
-    add_srs_wkt (p, 10,
-        "3333334],PARAMETER[\"latitude_of_origin\",33.75],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"central_meridian\",-79],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 12,
-        ",609601.22],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 13,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS");
-    add_srs_wkt (p, 14,
-        "[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6542\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6543, "epsg", 6543,
-        "NAD83(2011) / North Carolina (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.2192024384 +y_0=");
-    add_proj4text (p, 2,
-        "0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / North Carolina (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",36.16666666666666],PARAMETER[\"standard_parallel_2\",34");
-    add_srs_wkt (p, 10,
-        ".33333333333334],PARAMETER[\"latitude_of_origin\",33.75]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"central_meridian\",-79],PARAMETER[\"false_e");
-    add_srs_wkt (p, 12,
-        "asting\",2000000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 13,
-        "US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 15,
-        "EPSG\",\"6543\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6544, "epsg", 6544,
-        "NAD83(2011) / North Dakota North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=47 +lon_0=-100.5 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / North Dakota North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 8,
-        "formal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",48");
-    add_srs_wkt (p, 9,
-        ".73333333333333],PARAMETER[\"standard_parallel_2\",47.43");
-    add_srs_wkt (p, 10,
-        "333333333333],PARAMETER[\"latitude_of_origin\",47],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"central_meridian\",-100.5],PARAMETER[\"false_east");
-    add_srs_wkt (p, 12,
-        "ing\",600000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 13,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AX");
-    add_srs_wkt (p, 14,
-        "IS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6544\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6545, "epsg", 6545,
-        "NAD83(2011) / North Dakota North (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=47 +lon_0=-100.5 +x_0=599999.9999976 +y_0=0 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / North Dakota North (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 8,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",48.73333333333333],PARAMETER[\"standard_parallel_2\",47");
-    add_srs_wkt (p, 10,
-        ".43333333333333],PARAMETER[\"latitude_of_origin\",47],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"central_meridian\",-100.5],PARAMETER[\"false_e");
-    add_srs_wkt (p, 12,
-        "asting\",1968503.937],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 13,
-        "IT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6545\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6546, "epsg", 6546,
-        "NAD83(2011) / North Dakota South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / North Dakota South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 8,
-        "formal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",47");
-    add_srs_wkt (p, 9,
-        ".48333333333333],PARAMETER[\"standard_parallel_2\",46.18");
-    add_srs_wkt (p, 10,
-        "333333333333],PARAMETER[\"latitude_of_origin\",45.666666");
-    add_srs_wkt (p, 11,
-        "66666666],PARAMETER[\"central_meridian\",-100.5],PARAMET");
-    add_srs_wkt (p, 12,
-        "ER[\"false_easting\",600000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 14,
-        "\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6546\"");
-    add_srs_wkt (p, 15,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 6547, "epsg", 6547,
-        "NAD83(2011) / North Dakota South (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=599999.9");
-    add_proj4text (p, 2,
-        "999976 +y_0=0 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / North Dakota South (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 8,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",47.48333333333333],PARAMETER[\"standard_parallel_2\",46");
-    add_srs_wkt (p, 10,
-        ".18333333333333],PARAMETER[\"latitude_of_origin\",45.666");
-    add_srs_wkt (p, 11,
-        "66666666666],PARAMETER[\"central_meridian\",-100.5],PARA");
-    add_srs_wkt (p, 12,
-        "METER[\"false_easting\",1968503.937],PARAMETER[\"false_n");
-    add_srs_wkt (p, 13,
-        "orthing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 14,
-        "002\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 15,
-        "PSG\",\"6547\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6548, "epsg", 6548,
-        "NAD83(2011) / Ohio North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Ohio North\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 8,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",41.7],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_2\",40.43333333333333],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"latitude_of_origin\",39.66666666666666],PARAMETER[\"ce");
-    add_srs_wkt (p, 11,
-        "ntral_meridian\",-82.5],PARAMETER[\"false_easting\",6000");
-    add_srs_wkt (p, 12,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",N");
-    add_srs_wkt (p, 14,
-        "ORTH],AUTHORITY[\"EPSG\",\"6548\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6549, "epsg", 6549,
-        "NAD83(2011) / Ohio North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Ohio North (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 8,
-        "ormal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",41.");
-    add_srs_wkt (p, 9,
-        "7],PARAMETER[\"standard_parallel_2\",40.43333333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"latitude_of_origin\",39.66666666666666],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"central_meridian\",-82.5],PARAMETER[\"false_east");
-    add_srs_wkt (p, 12,
-        "ing\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"US");
-    add_srs_wkt (p, 13,
-        " survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 14,
-        "003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 15,
-        "PSG\",\"6549\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6550, "epsg", 6550,
-        "NAD83(2011) / Ohio South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Ohio South\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 8,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",40.0333333333");
-    add_srs_wkt (p, 9,
-        "3333],PARAMETER[\"standard_parallel_2\",38.7333333333333");
-    add_srs_wkt (p, 10,
-        "3],PARAMETER[\"latitude_of_origin\",38],PARAMETER[\"cent");
-    add_srs_wkt (p, 11,
-        "ral_meridian\",-82.5],PARAMETER[\"false_easting\",600000");
-    add_srs_wkt (p, 12,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"6550\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6551, "epsg", 6551,
-        "NAD83(2011) / Ohio South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Ohio South (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 8,
-        "ormal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",40.");
-    add_srs_wkt (p, 9,
-        "03333333333333],PARAMETER[\"standard_parallel_2\",38.733");
-    add_srs_wkt (p, 10,
-        "33333333333],PARAMETER[\"latitude_of_origin\",38],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"central_meridian\",-82.5],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 12,
-        "g\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"US s");
-    add_srs_wkt (p, 13,
-        "urvey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 14,
-        "3\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"6551\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6552, "epsg", 6552,
-        "NAD83(2011) / Oklahoma North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oklahoma North\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 8,
-        "l_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",36.7666");
-    add_srs_wkt (p, 9,
-        "6666666667],PARAMETER[\"standard_parallel_2\",35.5666666");
-    add_srs_wkt (p, 10,
-        "6666667],PARAMETER[\"latitude_of_origin\",35],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"central_meridian\",-98],PARAMETER[\"false_easting\",60");
-    add_srs_wkt (p, 12,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"6552\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6553, "epsg", 6553,
-        "NAD83(2011) / Oklahoma North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oklahoma North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",36.76666666666667],PARAMETER[\"standard_parallel_2\",35");
-    add_srs_wkt (p, 10,
-        ".56666666666667],PARAMETER[\"latitude_of_origin\",35],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"central_meridian\",-98],PARAMETER[\"false_east");
-    add_srs_wkt (p, 12,
-        "ing\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"US");
-    add_srs_wkt (p, 13,
-        " survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 14,
-        "003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 15,
-        "PSG\",\"6553\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6554, "epsg", 6554,
-        "NAD83(2011) / Oklahoma South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oklahoma South\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 8,
-        "l_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",35.2333");
-    add_srs_wkt (p, 9,
-        "3333333333],PARAMETER[\"standard_parallel_2\",33.9333333");
-    add_srs_wkt (p, 10,
-        "3333333],PARAMETER[\"latitude_of_origin\",33.33333333333");
-    add_srs_wkt (p, 11,
-        "334],PARAMETER[\"central_meridian\",-98],PARAMETER[\"fal");
-    add_srs_wkt (p, 12,
-        "se_easting\",600000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 13,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",E");
-    add_srs_wkt (p, 14,
-        "AST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6554\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6555, "epsg", 6555,
-        "NAD83(2011) / Oklahoma South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oklahoma South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",35.23333333333333],PARAMETER[\"standard_parallel_2\",33");
-    add_srs_wkt (p, 10,
-        ".93333333333333],PARAMETER[\"latitude_of_origin\",33.333");
-    add_srs_wkt (p, 11,
-        "33333333334],PARAMETER[\"central_meridian\",-98],PARAMET");
-    add_srs_wkt (p, 12,
-        "ER[\"false_easting\",1968500],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 13,
-        "\",0],UNIT[\"US survey foot\",0.3048006096012192,AUTHORI");
-    add_srs_wkt (p, 14,
-        "TY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH");
-    add_srs_wkt (p, 15,
-        "],AUTHORITY[\"EPSG\",\"6555\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6556, "epsg", 6556,
-        "NAD83(2011) / Oregon LCC (m)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=400000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon LCC (m)\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 8,
-        "l_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",43],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_2\",45.5],PARAMETER[\"latitud");
-    add_srs_wkt (p, 10,
-        "e_of_origin\",41.75],PARAMETER[\"central_meridian\",-120");
-    add_srs_wkt (p, 11,
-        ".5],PARAMETER[\"false_easting\",400000],PARAMETER[\"fals");
-    add_srs_wkt (p, 12,
-        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 13,
-        "01\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EP");
-    add_srs_wkt (p, 14,
-        "SG\",\"6556\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6557, "epsg", 6557,
-        "NAD83(2011) / Oregon GIC Lambert (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=399999.9999984 +y_0=0 +ellps=GRS80 +units=ft +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon GIC Lambert (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 8,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",43],PARAMETER[\"standard_parallel_2\",45.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "latitude_of_origin\",41.75],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 11,
-        "\",-120.5],PARAMETER[\"false_easting\",1312335.958],PARA");
-    add_srs_wkt (p, 12,
-        "METER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"9002\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH");
-    add_srs_wkt (p, 14,
-        "],AUTHORITY[\"EPSG\",\"6557\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6558, "epsg", 6558,
-        "NAD83(2011) / Oregon North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=2500000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon North\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",46],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_2\",44.33333333333334],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"latitude_of_origin\",43.66666666666666],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "central_meridian\",-120.5],PARAMETER[\"false_easting\",2");
-    add_srs_wkt (p, 12,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y");
-    add_srs_wkt (p, 14,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"6558\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6559, "epsg", 6559,
-        "NAD83(2011) / Oregon North (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=2500000.0001424 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon North (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 8,
-        "ormal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",46]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"standard_parallel_2\",44.33333333333334],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"latitude_of_origin\",43.66666666666666],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"central_meridian\",-120.5],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 12,
-        "ng\",8202099.738],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 13,
-        "foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X\",E");
-    add_srs_wkt (p, 14,
-        "AST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6559\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6560, "epsg", 6560,
-        "NAD83(2011) / Oregon South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=1500000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon South\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",44],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_2\",42.33333333333334],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"latitude_of_origin\",41.66666666666666],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "central_meridian\",-120.5],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 12,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y");
-    add_srs_wkt (p, 14,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"6560\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6561, "epsg", 6561,
-        "NAD83(2011) / Oregon South (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=1500000.0001464 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon South (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 8,
-        "ormal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",44]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"standard_parallel_2\",42.33333333333334],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"latitude_of_origin\",41.66666666666666],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"central_meridian\",-120.5],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 12,
-        "ng\",4921259.843],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 13,
-        "foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X\",E");
-    add_srs_wkt (p, 14,
-        "AST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6561\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6562, "epsg", 6562,
-        "NAD83(2011) / Pennsylvania North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4");
-    add_proj4text (p, 1,
-        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Pennsylvania North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 8,
-        "formal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",41");
-    add_srs_wkt (p, 9,
-        ".95],PARAMETER[\"standard_parallel_2\",40.88333333333333");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"latitude_of_origin\",40.16666666666666],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"central_meridian\",-77.75],PARAMETER[\"false_e");
-    add_srs_wkt (p, 12,
-        "asting\",600000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 13,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6562\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
@@ -1,4275 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_32 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 6563, "epsg", 6563,
-        "NAD83(2011) / Pennsylvania North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4");
-    add_proj4text (p, 1,
-        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Pennsylvania North (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 8,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",41.95],PARAMETER[\"standard_parallel_2\",40.8833333");
-    add_srs_wkt (p, 10,
-        "3333333],PARAMETER[\"latitude_of_origin\",40.16666666666");
-    add_srs_wkt (p, 11,
-        "666],PARAMETER[\"central_meridian\",-77.75],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_easting\",1968500],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 13,
-        ",UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 15,
-        "HORITY[\"EPSG\",\"6563\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6564, "epsg", 6564,
-        "NAD83(2011) / Pennsylvania South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Pennsylvania South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 8,
-        "formal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",40");
-    add_srs_wkt (p, 9,
-        ".96666666666667],PARAMETER[\"standard_parallel_2\",39.93");
-    add_srs_wkt (p, 10,
-        "333333333333],PARAMETER[\"latitude_of_origin\",39.333333");
-    add_srs_wkt (p, 11,
-        "33333334],PARAMETER[\"central_meridian\",-77.75],PARAMET");
-    add_srs_wkt (p, 12,
-        "ER[\"false_easting\",600000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 14,
-        "\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6564\"");
-    add_srs_wkt (p, 15,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 6565, "epsg", 6565,
-        "NAD83(2011) / Pennsylvania South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Pennsylvania South (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 8,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",40.96666666666667],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",39.93333333333333],PARAMETER[\"latitude_of_origin\",39.");
-    add_srs_wkt (p, 11,
-        "33333333333334],PARAMETER[\"central_meridian\",-77.75],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_easting\",1968500],PARAMETER[\"false_no");
-    add_srs_wkt (p, 13,
-        "rthing\",0],UNIT[\"US survey foot\",0.3048006096012192,A");
-    add_srs_wkt (p, 14,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 15,
-        ",NORTH],AUTHORITY[\"EPSG\",\"6565\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6566, "epsg", 6566,
-        "NAD83(2011) / Puerto Rico and Virgin Is.", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=18.43333333333333 +lat_2=18.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=17.83333333333333 +lon_0=-66.43333333333334 +");
-    add_proj4text (p, 2,
-        "x_0=200000 +y_0=200000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Puerto Rico and Virgin Is.\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere");
-    add_srs_wkt (p, 2,
-        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 3,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 8,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",18.43333333333333],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",18.03333333333333],PARAMETER[\"latitude_of_origin\",17.");
-    add_srs_wkt (p, 11,
-        "83333333333333],PARAMETER[\"central_meridian\",-66.43333");
-    add_srs_wkt (p, 12,
-        "333333334],PARAMETER[\"false_easting\",200000],PARAMETER");
-    add_srs_wkt (p, 13,
-        "[\"false_northing\",200000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 15,
-        "HORITY[\"EPSG\",\"6566\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6567, "epsg", 6567,
-        "NAD83(2011) / Rhode Island", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9");
-    add_proj4text (p, 1,
-        "9999375 +x_0=100000 +y_0=0 +ellps=GRS80 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Rhode Island\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",41.08333333333334");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-71.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.99999375],PARAMETER[\"false_easting\",10000");
-    add_srs_wkt (p, 11,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 13,
-        "RTH],AUTHORITY[\"EPSG\",\"6567\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6568, "epsg", 6568,
-        "NAD83(2011) / Rhode Island (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9");
-    add_proj4text (p, 1,
-        "9999375 +x_0=99999.99998983997 +y_0=0 +ellps=GRS80 +unit");
-    add_proj4text (p, 2,
-        "s=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Rhode Island (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",41.0833333");
-    add_srs_wkt (p, 9,
-        "3333334],PARAMETER[\"central_meridian\",-71.5],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"scale_factor\",0.99999375],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",328083.3333],PARAMETER[\"false_northing\",0],UNIT[\"US ");
-    add_srs_wkt (p, 12,
-        "survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 13,
-        "03\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EP");
-    add_srs_wkt (p, 14,
-        "SG\",\"6568\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6569, "epsg", 6569,
-        "NAD83(2011) / South Carolina", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31");
-    add_proj4text (p, 1,
-        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / South Carolina\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 8,
-        "l_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",34.8333");
-    add_srs_wkt (p, 9,
-        "3333333334],PARAMETER[\"standard_parallel_2\",32.5],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"latitude_of_origin\",31.83333333333333],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"central_meridian\",-81],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 12,
-        "609600],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y");
-    add_srs_wkt (p, 14,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"6569\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6570, "epsg", 6570,
-        "NAD83(2011) / South Carolina (ft)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31");
-    add_proj4text (p, 1,
-        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / South Carolina (ft)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",3");
-    add_srs_wkt (p, 9,
-        "4.83333333333334],PARAMETER[\"standard_parallel_2\",32.5");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"latitude_of_origin\",31.83333333333333],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"central_meridian\",-81],PARAMETER[\"false_east");
-    add_srs_wkt (p, 12,
-        "ing\",2000000],PARAMETER[\"false_northing\",0],UNIT[\"fo");
-    add_srs_wkt (p, 13,
-        "ot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"X\",EAS");
-    add_srs_wkt (p, 14,
-        "T],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6570\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6571, "epsg", 6571,
-        "NAD83(2011) / South Dakota North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / South Dakota North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 8,
-        "formal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",45");
-    add_srs_wkt (p, 9,
-        ".68333333333333],PARAMETER[\"standard_parallel_2\",44.41");
-    add_srs_wkt (p, 10,
-        "666666666666],PARAMETER[\"latitude_of_origin\",43.833333");
-    add_srs_wkt (p, 11,
-        "33333334],PARAMETER[\"central_meridian\",-100],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_easting\",600000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 13,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6571\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6572, "epsg", 6572,
-        "NAD83(2011) / South Dakota North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / South Dakota North (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 8,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",45.68333333333333],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",44.41666666666666],PARAMETER[\"latitude_of_origin\",43.");
-    add_srs_wkt (p, 11,
-        "83333333333334],PARAMETER[\"central_meridian\",-100],PAR");
-    add_srs_wkt (p, 12,
-        "AMETER[\"false_easting\",1968500],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 13,
-        "hing\",0],UNIT[\"US survey foot\",0.3048006096012192,AUT");
-    add_srs_wkt (p, 14,
-        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",N");
-    add_srs_wkt (p, 15,
-        "ORTH],AUTHORITY[\"EPSG\",\"6572\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6573, "epsg", 6573,
-        "NAD83(2011) / South Dakota South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42");
-    add_proj4text (p, 1,
-        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / South Dakota South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 8,
-        "formal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",44");
-    add_srs_wkt (p, 9,
-        ".4],PARAMETER[\"standard_parallel_2\",42.83333333333334]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"latitude_of_origin\",42.33333333333334],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"central_meridian\",-100.3333333333333],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"false_easting\",600000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 14,
-        "\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6573\"");
-    add_srs_wkt (p, 15,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 6574, "epsg", 6574,
-        "NAD83(2011) / South Dakota South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42");
-    add_proj4text (p, 1,
-        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / South Dakota South (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 8,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",44.4],PARAMETER[\"standard_parallel_2\",42.83333333");
-    add_srs_wkt (p, 10,
-        "333334],PARAMETER[\"latitude_of_origin\",42.333333333333");
-    add_srs_wkt (p, 11,
-        "34],PARAMETER[\"central_meridian\",-100.3333333333333],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_easting\",1968500],PARAMETER[\"false_no");
-    add_srs_wkt (p, 13,
-        "rthing\",0],UNIT[\"US survey foot\",0.3048006096012192,A");
-    add_srs_wkt (p, 14,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 15,
-        ",NORTH],AUTHORITY[\"EPSG\",\"6574\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6575, "epsg", 6575,
-        "NAD83(2011) / Tennessee", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3");
-    add_proj4text (p, 1,
-        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Tennessee\",GEOGCS[\"NAD83(2011)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"NAD83_National_Spatial_Reference_System_2011\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 8,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",36.4166666666");
-    add_srs_wkt (p, 9,
-        "6666],PARAMETER[\"standard_parallel_2\",35.25],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"latitude_of_origin\",34.33333333333334],PARAMETER[\"c");
-    add_srs_wkt (p, 11,
-        "entral_meridian\",-86],PARAMETER[\"false_easting\",60000");
-    add_srs_wkt (p, 12,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 13,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 14,
-        "RTH],AUTHORITY[\"EPSG\",\"6575\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6576, "epsg", 6576,
-        "NAD83(2011) / Tennessee (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3");
-    add_proj4text (p, 1,
-        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Tennessee (ftUS)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",36.4");
-    add_srs_wkt (p, 9,
-        "1666666666666],PARAMETER[\"standard_parallel_2\",35.25],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"latitude_of_origin\",34.33333333333334],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"central_meridian\",-86],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 12,
-        "g\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"US s");
-    add_srs_wkt (p, 13,
-        "urvey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 14,
-        "3\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"6576\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6577, "epsg", 6577,
-        "NAD83(2011) / Texas Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +");
-    add_proj4text (p, 2,
-        "x_0=700000 +y_0=3000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas Central\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",31.88333");
-    add_srs_wkt (p, 9,
-        "333333333],PARAMETER[\"standard_parallel_2\",30.11666666");
-    add_srs_wkt (p, 10,
-        "666667],PARAMETER[\"latitude_of_origin\",29.666666666666");
-    add_srs_wkt (p, 11,
-        "67],PARAMETER[\"central_meridian\",-100.3333333333333],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_easting\",700000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 13,
-        "thing\",3000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 14,
-        "001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 15,
-        "PSG\",\"6577\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6578, "epsg", 6578,
-        "NAD83(2011) / Texas Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +");
-    add_proj4text (p, 2,
-        "x_0=699999.9998983998 +y_0=3000000 +ellps=GRS80 +units=u");
-    add_proj4text (p, 3,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas Central (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",3");
-    add_srs_wkt (p, 9,
-        "1.88333333333333],PARAMETER[\"standard_parallel_2\",30.1");
-    add_srs_wkt (p, 10,
-        "1666666666667],PARAMETER[\"latitude_of_origin\",29.66666");
-    add_srs_wkt (p, 11,
-        "666666667],PARAMETER[\"central_meridian\",-100.333333333");
-    add_srs_wkt (p, 12,
-        "3333],PARAMETER[\"false_easting\",2296583.333],PARAMETER");
-    add_srs_wkt (p, 13,
-        "[\"false_northing\",9842500.000000002],UNIT[\"US survey ");
-    add_srs_wkt (p, 14,
-        "foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],");
-    add_srs_wkt (p, 15,
-        "AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 16,
-        "6578\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6579, "epsg", 6579,
-        "NAD83(2011) / Texas Centric Albers Equal Area", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Albers_Conic_Equal_Area", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x");
-    add_proj4text (p, 1,
-        "_0=1500000 +y_0=6000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas Centric Albers Equal Area\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Albers_Conic_Equal_Area\"],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 9,
-        "el_1\",27.5],PARAMETER[\"standard_parallel_2\",35],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"latitude_of_center\",18],PARAMETER[\"longitude_of");
-    add_srs_wkt (p, 11,
-        "_center\",-100],PARAMETER[\"false_easting\",1500000],PAR");
-    add_srs_wkt (p, 12,
-        "AMETER[\"false_northing\",6000000],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 13,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 14,
-        "RTH],AUTHORITY[\"EPSG\",\"6579\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6580, "epsg", 6580,
-        "NAD83(2011) / Texas Centric Lambert Conformal", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x");
-    add_proj4text (p, 1,
-        "_0=1500000 +y_0=5000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas Centric Lambert Conformal\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",27.5],PARAMETER[\"standard_parallel_2\",35],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"latitude_of_origin\",18],PARAMETER[\"central_");
-    add_srs_wkt (p, 11,
-        "meridian\",-100],PARAMETER[\"false_easting\",1500000],PA");
-    add_srs_wkt (p, 12,
-        "RAMETER[\"false_northing\",5000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",N");
-    add_srs_wkt (p, 14,
-        "ORTH],AUTHORITY[\"EPSG\",\"6580\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6581, "epsg", 6581,
-        "NAD83(2011) / Texas North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3");
-    add_proj4text (p, 1,
-        "4 +lon_0=-101.5 +x_0=200000 +y_0=1000000 +ellps=GRS80 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas North\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 7,
-        "RITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal_");
-    add_srs_wkt (p, 8,
-        "Conic_2SP\"],PARAMETER[\"standard_parallel_1\",36.183333");
-    add_srs_wkt (p, 9,
-        "33333333],PARAMETER[\"standard_parallel_2\",34.65],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"latitude_of_origin\",34],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 11,
-        "dian\",-101.5],PARAMETER[\"false_easting\",200000],PARAM");
-    add_srs_wkt (p, 12,
-        "ETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORT");
-    add_srs_wkt (p, 14,
-        "H],AUTHORITY[\"EPSG\",\"6581\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6582, "epsg", 6582,
-        "NAD83(2011) / Texas North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3");
-    add_proj4text (p, 1,
-        "4 +lon_0=-101.5 +x_0=200000.0001016002 +y_0=999999.99989");
-    add_proj4text (p, 2,
-        "83998 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas North (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 8,
-        "formal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",36");
-    add_srs_wkt (p, 9,
-        ".18333333333333],PARAMETER[\"standard_parallel_2\",34.65");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"latitude_of_origin\",34],PARAMETER[\"centr");
-    add_srs_wkt (p, 11,
-        "al_meridian\",-101.5],PARAMETER[\"false_easting\",656166");
-    add_srs_wkt (p, 12,
-        ".667],PARAMETER[\"false_northing\",3280833.333],UNIT[\"U");
-    add_srs_wkt (p, 13,
-        "S survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 15,
-        "EPSG\",\"6582\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6583, "epsg", 6583,
-        "NAD83(2011) / Texas North Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=2000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas North Central\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",3");
-    add_srs_wkt (p, 9,
-        "3.96666666666667],PARAMETER[\"standard_parallel_2\",32.1");
-    add_srs_wkt (p, 10,
-        "3333333333333],PARAMETER[\"latitude_of_origin\",31.66666");
-    add_srs_wkt (p, 11,
-        "666666667],PARAMETER[\"central_meridian\",-98.5],PARAMET");
-    add_srs_wkt (p, 12,
-        "ER[\"false_easting\",600000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",2000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 15,
-        "6583\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6584, "epsg", 6584,
-        "NAD83(2011) / Texas North Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=2000000.0001016 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas North Central (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere");
-    add_srs_wkt (p, 2,
-        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 3,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 8,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",33.96666666666667],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",32.13333333333333],PARAMETER[\"latitude_of_origin\",31.");
-    add_srs_wkt (p, 11,
-        "66666666666667],PARAMETER[\"central_meridian\",-98.5],PA");
-    add_srs_wkt (p, 12,
-        "RAMETER[\"false_easting\",1968500],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 13,
-        "thing\",6561666.667],UNIT[\"US survey foot\",0.304800609");
-    add_srs_wkt (p, 14,
-        "6012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],A");
-    add_srs_wkt (p, 15,
-        "XIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6584\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6585, "epsg", 6585,
-        "NAD83(2011) / Texas South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000 +y");
-    add_proj4text (p, 2,
-        "_0=5000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas South\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 7,
-        "RITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal_");
-    add_srs_wkt (p, 8,
-        "Conic_2SP\"],PARAMETER[\"standard_parallel_1\",27.833333");
-    add_srs_wkt (p, 9,
-        "33333333],PARAMETER[\"standard_parallel_2\",26.166666666");
-    add_srs_wkt (p, 10,
-        "66667],PARAMETER[\"latitude_of_origin\",25.6666666666666");
-    add_srs_wkt (p, 11,
-        "7],PARAMETER[\"central_meridian\",-98.5],PARAMETER[\"fal");
-    add_srs_wkt (p, 12,
-        "se_easting\",300000],PARAMETER[\"false_northing\",500000");
-    add_srs_wkt (p, 13,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6585\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6586, "epsg", 6586,
-        "NAD83(2011) / Texas South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000.00");
-    add_proj4text (p, 2,
-        "00000001 +y_0=5000000.0001016 +ellps=GRS80 +units=us-ft ");
-    add_proj4text (p, 3,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas South (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 7,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 8,
-        "formal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",27");
-    add_srs_wkt (p, 9,
-        ".83333333333333],PARAMETER[\"standard_parallel_2\",26.16");
-    add_srs_wkt (p, 10,
-        "666666666667],PARAMETER[\"latitude_of_origin\",25.666666");
-    add_srs_wkt (p, 11,
-        "66666667],PARAMETER[\"central_meridian\",-98.5],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"false_easting\",984250.0000000002],PARAMETER[\"false");
-    add_srs_wkt (p, 13,
-        "_northing\",16404166.667],UNIT[\"US survey foot\",0.3048");
-    add_srs_wkt (p, 14,
-        "006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 15,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6586\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6587, "epsg", 6587,
-        "NAD83(2011) / Texas South Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=4000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas South Central\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",3");
-    add_srs_wkt (p, 9,
-        "0.28333333333333],PARAMETER[\"standard_parallel_2\",28.3");
-    add_srs_wkt (p, 10,
-        "8333333333333],PARAMETER[\"latitude_of_origin\",27.83333");
-    add_srs_wkt (p, 11,
-        "333333333],PARAMETER[\"central_meridian\",-99],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_easting\",600000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 13,
-        "4000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 15,
-        "6587\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6588, "epsg", 6588,
-        "NAD83(2011) / Texas South Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=3999999.9998984 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas South Central (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere");
-    add_srs_wkt (p, 2,
-        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 3,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 8,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",30.28333333333333],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",28.38333333333333],PARAMETER[\"latitude_of_origin\",27.");
-    add_srs_wkt (p, 11,
-        "83333333333333],PARAMETER[\"central_meridian\",-99],PARA");
-    add_srs_wkt (p, 12,
-        "METER[\"false_easting\",1968500],PARAMETER[\"false_north");
-    add_srs_wkt (p, 13,
-        "ing\",13123333.333],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 14,
-        "012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AX");
-    add_srs_wkt (p, 15,
-        "IS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6588\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6589, "epsg", 6589,
-        "NAD83(2011) / Vermont", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-72.5 +k=0.999964286 +x_0");
-    add_proj4text (p, 1,
-        "=500000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Vermont\",GEOGCS[\"NAD83(2011)\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"NAD83_National_Spatial_Reference_System_2011\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",42.5],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",-72.5],PARAMETER[\"scale_factor\",0.99996");
-    add_srs_wkt (p, 10,
-        "4286],PARAMETER[\"false_easting\",500000],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"6589\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6590, "epsg", 6590,
-        "NAD83(2011) / Vermont (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-72.5 +k=0.999964286 +x_0");
-    add_proj4text (p, 1,
-        "=500000.00001016 +y_0=0 +ellps=GRS80 +units=us-ft +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Vermont (ftUS)\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 8,
-        "tor\"],PARAMETER[\"latitude_of_origin\",42.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"central_meridian\",-72.5],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 10,
-        ".999964286],PARAMETER[\"false_easting\",1640416.6667],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0.");
-    add_srs_wkt (p, 12,
-        "3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6590\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6591, "epsg", 6591,
-        "NAD83(2011) / Virginia Lambert", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37 +lat_2=39.5 +lat_0=36 +lon_0=-79.5 +");
-    add_proj4text (p, 1,
-        "x_0=0 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Virginia Lambert\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",37],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_2\",39.5],PARAMETER[\"lati");
-    add_srs_wkt (p, 10,
-        "tude_of_origin\",36],PARAMETER[\"central_meridian\",-79.");
-    add_srs_wkt (p, 11,
-        "5],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 12,
-        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "6591\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6592, "epsg", 6592,
-        "NAD83(2011) / Virginia North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-78.5 +x_0=3500000 +y_0=2000000 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Virginia North\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 8,
-        "l_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",39.2],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_2\",38.03333333333333],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"latitude_of_origin\",37.66666666666666],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"central_meridian\",-78.5],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 12,
-        ",3500000],PARAMETER[\"false_northing\",2000000],UNIT[\"m");
-    add_srs_wkt (p, 13,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6592\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6593, "epsg", 6593,
-        "NAD83(2011) / Virginia North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-78.5 +x_0=3500000.0001016 +y_0=2");
-    add_proj4text (p, 2,
-        "000000.0001016 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Virginia North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",39.2],PARAMETER[\"standard_parallel_2\",38.033333333333");
-    add_srs_wkt (p, 10,
-        "33],PARAMETER[\"latitude_of_origin\",37.66666666666666],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"central_meridian\",-78.5],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "easting\",11482916.667],PARAMETER[\"false_northing\",656");
-    add_srs_wkt (p, 13,
-        "1666.667],UNIT[\"US survey foot\",0.3048006096012192,AUT");
-    add_srs_wkt (p, 14,
-        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",N");
-    add_srs_wkt (p, 15,
-        "ORTH],AUTHORITY[\"EPSG\",\"6593\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6594, "epsg", 6594,
-        "NAD83(2011) / Virginia South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000 +");
-    add_proj4text (p, 2,
-        "y_0=1000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Virginia South\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 8,
-        "l_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",37.9666");
-    add_srs_wkt (p, 9,
-        "6666666667],PARAMETER[\"standard_parallel_2\",36.7666666");
-    add_srs_wkt (p, 10,
-        "6666667],PARAMETER[\"latitude_of_origin\",36.33333333333");
-    add_srs_wkt (p, 11,
-        "334],PARAMETER[\"central_meridian\",-78.5],PARAMETER[\"f");
-    add_srs_wkt (p, 12,
-        "alse_easting\",3500000],PARAMETER[\"false_northing\",100");
-    add_srs_wkt (p, 13,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"659");
-    add_srs_wkt (p, 15,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6595, "epsg", 6595,
-        "NAD83(2011) / Virginia South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000.0");
-    add_proj4text (p, 2,
-        "001016 +y_0=999999.9998983998 +ellps=GRS80 +units=us-ft ");
-    add_proj4text (p, 3,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Virginia South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",37.96666666666667],PARAMETER[\"standard_parallel_2\",36");
-    add_srs_wkt (p, 10,
-        ".76666666666667],PARAMETER[\"latitude_of_origin\",36.333");
-    add_srs_wkt (p, 11,
-        "33333333334],PARAMETER[\"central_meridian\",-78.5],PARAM");
-    add_srs_wkt (p, 12,
-        "ETER[\"false_easting\",11482916.667],PARAMETER[\"false_n");
-    add_srs_wkt (p, 13,
-        "orthing\",3280833.333],UNIT[\"US survey foot\",0.3048006");
-    add_srs_wkt (p, 14,
-        "096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 15,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6595\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6596, "epsg", 6596,
-        "NAD83(2011) / Washington North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47");
-    add_proj4text (p, 1,
-        " +lon_0=-120.8333333333333 +x_0=500000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Washington North\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",48.7");
-    add_srs_wkt (p, 9,
-        "3333333333333],PARAMETER[\"standard_parallel_2\",47.5],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"latitude_of_origin\",47],PARAMETER[\"central_");
-    add_srs_wkt (p, 11,
-        "meridian\",-120.8333333333333],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 12,
-        "\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 13,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Y\",NORTH],AUTHORITY[\"EPSG\",\"6596\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6597, "epsg", 6597,
-        "NAD83(2011) / Washington North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47");
-    add_proj4text (p, 1,
-        " +lon_0=-120.8333333333333 +x_0=500000.0001016001 +y_0=0");
-    add_proj4text (p, 2,
-        " +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Washington North (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 8,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",48.73333333333333],PARAMETER[\"standard_parallel_2\",47");
-    add_srs_wkt (p, 10,
-        ".5],PARAMETER[\"latitude_of_origin\",47],PARAMETER[\"cen");
-    add_srs_wkt (p, 11,
-        "tral_meridian\",-120.8333333333333],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 12,
-        "sting\",1640416.667],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 13,
-        "T[\"US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 15,
-        "TY[\"EPSG\",\"6597\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6598, "epsg", 6598,
-        "NAD83(2011) / Washington South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Washington South\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Confo");
-    add_srs_wkt (p, 8,
-        "rmal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",47.3");
-    add_srs_wkt (p, 9,
-        "3333333333334],PARAMETER[\"standard_parallel_2\",45.8333");
-    add_srs_wkt (p, 10,
-        "3333333334],PARAMETER[\"latitude_of_origin\",45.33333333");
-    add_srs_wkt (p, 11,
-        "333334],PARAMETER[\"central_meridian\",-120.5],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 13,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6598\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6599, "epsg", 6599,
-        "NAD83(2011) / Washington South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001016001 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Washington South (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 8,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",47.33333333333334],PARAMETER[\"standard_parallel_2\",45");
-    add_srs_wkt (p, 10,
-        ".83333333333334],PARAMETER[\"latitude_of_origin\",45.333");
-    add_srs_wkt (p, 11,
-        "33333333334],PARAMETER[\"central_meridian\",-120.5],PARA");
-    add_srs_wkt (p, 12,
-        "METER[\"false_easting\",1640416.667],PARAMETER[\"false_n");
-    add_srs_wkt (p, 13,
-        "orthing\",0],UNIT[\"US survey foot\",0.3048006096012192,");
-    add_srs_wkt (p, 14,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 15,
-        ",NORTH],AUTHORITY[\"EPSG\",\"6599\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6600, "epsg", 6600,
-        "NAD83(2011) / West Virginia North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.25 +lat_2=39 +lat_0=38.5 +lon_0=-79.");
-    add_proj4text (p, 1,
-        "5 +x_0=600000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / West Virginia North\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",4");
-    add_srs_wkt (p, 9,
-        "0.25],PARAMETER[\"standard_parallel_2\",39],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "latitude_of_origin\",38.5],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 11,
-        ",-79.5],PARAMETER[\"false_easting\",600000],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 14,
-        "\"EPSG\",\"6600\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6601, "epsg", 6601,
-        "NAD83(2011) / West Virginia North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.25 +lat_2=39 +lat_0=38.5 +lon_0=-79.");
-    add_proj4text (p, 1,
-        "5 +x_0=600000 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / West Virginia North (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere");
-    add_srs_wkt (p, 2,
-        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 3,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 8,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",40.25],PARAMETER[\"standard_parallel_2\",39],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"latitude_of_origin\",38.5],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 11,
-        "idian\",-79.5],PARAMETER[\"false_easting\",1968500],PARA");
-    add_srs_wkt (p, 12,
-        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30");
-    add_srs_wkt (p, 13,
-        "48006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 14,
-        "EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6601\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6602, "epsg", 6602,
-        "NAD83(2011) / West Virginia South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.88333333333333 +lat_2=37.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=37 +lon_0=-81 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / West Virginia South\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",3");
-    add_srs_wkt (p, 9,
-        "8.88333333333333],PARAMETER[\"standard_parallel_2\",37.4");
-    add_srs_wkt (p, 10,
-        "8333333333333],PARAMETER[\"latitude_of_origin\",37],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"central_meridian\",-81],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 12,
-        "g\",600000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 13,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS");
-    add_srs_wkt (p, 14,
-        "[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6602\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6603, "epsg", 6603,
-        "NAD83(2011) / West Virginia South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.88333333333333 +lat_2=37.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=37 +lon_0=-81 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / West Virginia South (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere");
-    add_srs_wkt (p, 2,
-        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 3,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 8,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",38.88333333333333],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",37.48333333333333],PARAMETER[\"latitude_of_origin\",37]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"central_meridian\",-81],PARAMETER[\"false_e");
-    add_srs_wkt (p, 12,
-        "asting\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 13,
-        "US survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 15,
-        "EPSG\",\"6603\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6604, "epsg", 6604,
-        "NAD83(2011) / Wisconsin Central (deprecated)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333");
-    add_proj4text (p, 1,
-        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wisconsin Central (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatia");
-    add_srs_wkt (p, 2,
-        "l_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,");
-    add_srs_wkt (p, 3,
-        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,");
-    add_srs_wkt (p, 4,
-        "0,0,0,0,0],AUTHORITY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 5,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 6,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 7,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 8,
-        "G\",\"4759\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",45.5],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",44.25],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 11,
-        "n\",43.83333333333334],PARAMETER[\"central_meridian\",-9");
-    add_srs_wkt (p, 12,
-        "0],PARAMETER[\"false_easting\",600000],PARAMETER[\"false");
-    add_srs_wkt (p, 13,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 14,
-        "1\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"6604\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6605, "epsg", 6605,
-        "NAD83(2011) / Wisconsin Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333");
-    add_proj4text (p, 1,
-        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +units=us");
-    add_proj4text (p, 2,
-        "-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wisconsin Central (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 4,
-        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 8,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1");
-    add_srs_wkt (p, 9,
-        "\",45.5],PARAMETER[\"standard_parallel_2\",44.25],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"latitude_of_origin\",43.83333333333334],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"central_meridian\",-90],PARAMETER[\"false_easting\",19");
-    add_srs_wkt (p, 12,
-        "68500],PARAMETER[\"false_northing\",0],UNIT[\"US survey ");
-    add_srs_wkt (p, 13,
-        "foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 15,
-        "6605\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6606, "epsg", 6606,
-        "NAD83(2011) / Wisconsin North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wisconsin North\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Confor");
-    add_srs_wkt (p, 8,
-        "mal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",46.76");
-    add_srs_wkt (p, 9,
-        "666666666667],PARAMETER[\"standard_parallel_2\",45.56666");
-    add_srs_wkt (p, 10,
-        "666666667],PARAMETER[\"latitude_of_origin\",45.166666666");
-    add_srs_wkt (p, 11,
-        "66666],PARAMETER[\"central_meridian\",-90],PARAMETER[\"f");
-    add_srs_wkt (p, 12,
-        "alse_easting\",600000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 13,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6606\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6607, "epsg", 6607,
-        "NAD83(2011) / Wisconsin North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wisconsin North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",46.76666666666667],PARAMETER[\"standard_parallel_2\",45");
-    add_srs_wkt (p, 10,
-        ".56666666666667],PARAMETER[\"latitude_of_origin\",45.166");
-    add_srs_wkt (p, 11,
-        "66666666666],PARAMETER[\"central_meridian\",-90],PARAMET");
-    add_srs_wkt (p, 12,
-        "ER[\"false_easting\",1968500],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 13,
-        "\",0],UNIT[\"US survey foot\",0.3048006096012192,AUTHORI");
-    add_srs_wkt (p, 14,
-        "TY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH");
-    add_srs_wkt (p, 15,
-        "],AUTHORITY[\"EPSG\",\"6607\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6608, "epsg", 6608,
-        "NAD83(2011) / Wisconsin South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wisconsin South\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Confor");
-    add_srs_wkt (p, 8,
-        "mal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",44.06");
-    add_srs_wkt (p, 9,
-        "666666666667],PARAMETER[\"standard_parallel_2\",42.73333");
-    add_srs_wkt (p, 10,
-        "333333333],PARAMETER[\"latitude_of_origin\",42],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"central_meridian\",-90],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 12,
-        "600000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y");
-    add_srs_wkt (p, 14,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"6608\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6609, "epsg", 6609,
-        "NAD83(2011) / Wisconsin South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wisconsin South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 8,
-        "Conformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",44.06666666666667],PARAMETER[\"standard_parallel_2\",42");
-    add_srs_wkt (p, 10,
-        ".73333333333333],PARAMETER[\"latitude_of_origin\",42],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"central_meridian\",-90],PARAMETER[\"false_east");
-    add_srs_wkt (p, 12,
-        "ing\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"US");
-    add_srs_wkt (p, 13,
-        " survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 14,
-        "003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 15,
-        "PSG\",\"6609\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6610, "epsg", 6610,
-        "NAD83(2011) / Wisconsin Transverse Mercator", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-90 +k=0.9996 +x_0=520000 +y");
-    add_proj4text (p, 1,
-        "_0=-4480000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wisconsin Transverse Mercator\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-90],PARAMETER[\"scale_");
-    add_srs_wkt (p, 10,
-        "factor\",0.9996],PARAMETER[\"false_easting\",520000],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_northing\",-4480000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"6610\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6611, "epsg", 6611,
-        "NAD83(2011) / Wyoming East", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=200000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming East\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",40.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "central_meridian\",-105.1666666666667],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.9999375],PARAMETER[\"false_easting\",200000]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"6611\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6612, "epsg", 6612,
-        "NAD83(2011) / Wyoming East (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=200000.00001016 +y_0=0 +ellps=GRS80 +units=u");
-    add_proj4text (p, 2,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming East (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",-105.1666666666667],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"scale_factor\",0.9999375],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",656166.6667],PARAMETER[\"false_northing\",0],UNIT[\"US ");
-    add_srs_wkt (p, 12,
-        "survey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 13,
-        "03\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EP");
-    add_srs_wkt (p, 14,
-        "SG\",\"6612\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6613, "epsg", 6613,
-        "NAD83(2011) / Wyoming East Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=400000 +y_0=100000 +ellps=GRS80 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming East Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",-107.3333333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"scale_factor\",0.9999375],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",400000],PARAMETER[\"false_northing\",100000],UNIT[\"met");
-    add_srs_wkt (p, 12,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6613\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6614, "epsg", 6614,
-        "NAD83(2011) / Wyoming East Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=399999.99998984 +y_0=99999.99998983997 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming East Central (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40");
-    add_srs_wkt (p, 9,
-        ".5],PARAMETER[\"central_meridian\",-107.3333333333333],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"false_e");
-    add_srs_wkt (p, 11,
-        "asting\",1312333.3333],PARAMETER[\"false_northing\",3280");
-    add_srs_wkt (p, 12,
-        "83.3333],UNIT[\"US survey foot\",0.3048006096012192,AUTH");
-    add_srs_wkt (p, 13,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NO");
-    add_srs_wkt (p, 14,
-        "RTH],AUTHORITY[\"EPSG\",\"6614\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6615, "epsg", 6615,
-        "NAD83(2011) / Wyoming West", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=800000 +y_0=100000 +ellps=GRS80 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming West\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",40.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "central_meridian\",-110.0833333333333],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.9999375],PARAMETER[\"false_easting\",800000]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_northing\",100000],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"6615\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6616, "epsg", 6616,
-        "NAD83(2011) / Wyoming West (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=800000.0000101599 +y_0=99999.99998983997 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming West (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",-110.0833333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"scale_factor\",0.9999375],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",2624666.6667],PARAMETER[\"false_northing\",328083.3333]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"US survey foot\",0.3048006096012192,AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUT");
-    add_srs_wkt (p, 14,
-        "HORITY[\"EPSG\",\"6616\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6617, "epsg", 6617,
-        "NAD83(2011) / Wyoming West Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0");
-    add_proj4text (p, 1,
-        "=600000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming West Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",-108.75],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",0.9999375],PARAMETER[\"false_easting\",600000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"6617\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6618, "epsg", 6618,
-        "NAD83(2011) / Wyoming West Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0");
-    add_proj4text (p, 1,
-        "=600000 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming West Central (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40");
-    add_srs_wkt (p, 9,
-        ".5],PARAMETER[\"central_meridian\",-108.75],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "scale_factor\",0.9999375],PARAMETER[\"false_easting\",19");
-    add_srs_wkt (p, 11,
-        "68500],PARAMETER[\"false_northing\",0],UNIT[\"US survey ");
-    add_srs_wkt (p, 12,
-        "foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "6618\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6619, "epsg", 6619,
-        "NAD83(2011) / Utah Central", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000 +y_0=2000000 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Utah Central\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",40.65],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_2\",39.01666666666667],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"latitude_of_origin\",38.33333333333334],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"central_meridian\",-111.5],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 12,
-        "\",500000],PARAMETER[\"false_northing\",2000000],UNIT[\"");
-    add_srs_wkt (p, 13,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6619\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6620, "epsg", 6620,
-        "NAD83(2011) / Utah North", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000 +");
-    add_proj4text (p, 2,
-        "y_0=1000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Utah North\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 8,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",41.7833333333");
-    add_srs_wkt (p, 9,
-        "3333],PARAMETER[\"standard_parallel_2\",40.7166666666666");
-    add_srs_wkt (p, 10,
-        "7],PARAMETER[\"latitude_of_origin\",40.33333333333334],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"central_meridian\",-111.5],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "easting\",500000],PARAMETER[\"false_northing\",1000000],");
-    add_srs_wkt (p, 13,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6620\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6621, "epsg", 6621,
-        "NAD83(2011) / Utah South", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000 +y_0=3000000 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Utah South\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 8,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",38.35],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_2\",37.21666666666667],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"latitude_of_origin\",36.66666666666666],PARAMETER[\"c");
-    add_srs_wkt (p, 11,
-        "entral_meridian\",-111.5],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 12,
-        "0000],PARAMETER[\"false_northing\",3000000],UNIT[\"metre");
-    add_srs_wkt (p, 13,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS");
-    add_srs_wkt (p, 14,
-        "[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6621\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6622, "epsg", 6622,
-        "NAD83(CSRS) / Quebec Lambert", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=60 +lat_2=46 +lat_0=44 +lon_0=-68.5 +x_");
-    add_proj4text (p, 1,
-        "0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Quebec Lambert\",GEOGCS[\"NAD83(C");
-    add_srs_wkt (p, 1,
-        "SRS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",60],PARAMETER[\"standard_parallel_2\",46],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"latitude_of_origin\",44],PARAMETER[\"central_me");
-    add_srs_wkt (p, 11,
-        "ridian\",-68.5],PARAMETER[\"false_easting\",0],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 14,
-        "TY[\"EPSG\",\"6622\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6623, "epsg", 6623,
-        "NAD83 / Quebec Albers", 0, 0,
-        "GRS 1980", "Greenwich",
-        "North_American_Datum_1983", "Albers_Conic_Equal_Area", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=60 +lat_2=46 +lat_0=44 +lon_0=-68.5 +x_");
-    add_proj4text (p, 1,
-        "0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Quebec Albers\",GEOGCS[\"NAD83\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4269\"]],PROJECTION[\"Albers_Conic_Equal_Area\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"standard_parallel_1\",60],PARAMETER[\"stand");
-    add_srs_wkt (p, 9,
-        "ard_parallel_2\",46],PARAMETER[\"latitude_of_center\",44");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"longitude_of_center\",-68.5],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6623\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6624, "epsg", 6624,
-        "NAD83(CSRS) / Quebec Albers", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Albers_Conic_Equal_Area", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=60 +lat_2=46 +lat_0=44 +lon_0=-68.5 +x_");
-    add_proj4text (p, 1,
-        "0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Quebec Albers\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 1,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Albers_Conic_Equal_Area\"],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 9,
-        "el_1\",60],PARAMETER[\"standard_parallel_2\",46],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"latitude_of_center\",44],PARAMETER[\"longitude_of_c");
-    add_srs_wkt (p, 11,
-        "enter\",-68.5],PARAMETER[\"false_easting\",0],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"6624\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6625, "epsg", 6625,
-        "NAD83(2011) / Utah Central (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000.00001016 +y_0");
-    add_proj4text (p, 2,
-        "=2000000.00001016 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Utah Central (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 8,
-        "nformal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",4");
-    add_srs_wkt (p, 9,
-        "0.65],PARAMETER[\"standard_parallel_2\",39.0166666666666");
-    add_srs_wkt (p, 10,
-        "7],PARAMETER[\"latitude_of_origin\",38.33333333333334],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"central_meridian\",-111.5],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "easting\",1640416.6667],PARAMETER[\"false_northing\",656");
-    add_srs_wkt (p, 13,
-        "1666.666700001],UNIT[\"US survey foot\",0.30480060960121");
-    add_srs_wkt (p, 14,
-        "92,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"");
-    add_srs_wkt (p, 15,
-        "Y\",NORTH],AUTHORITY[\"EPSG\",\"6625\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6626, "epsg", 6626,
-        "NAD83(2011) / Utah North (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "0001016 +y_0=999999.9999898402 +ellps=GRS80 +units=us-ft");
-    add_proj4text (p, 3,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Utah North (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 8,
-        "ormal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",41.");
-    add_srs_wkt (p, 9,
-        "78333333333333],PARAMETER[\"standard_parallel_2\",40.716");
-    add_srs_wkt (p, 10,
-        "66666666667],PARAMETER[\"latitude_of_origin\",40.3333333");
-    add_srs_wkt (p, 11,
-        "3333334],PARAMETER[\"central_meridian\",-111.5],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"false_easting\",1640416.6667],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 13,
-        "hing\",3280833.333300001],UNIT[\"US survey foot\",0.3048");
-    add_srs_wkt (p, 14,
-        "006096012192,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 15,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6626\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6627, "epsg", 6627,
-        "NAD83(2011) / Utah South (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000.00001016 +y_0");
-    add_proj4text (p, 2,
-        "=3000000 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Utah South (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 8,
-        "ormal_Conic_2SP\"],PARAMETER[\"standard_parallel_1\",38.");
-    add_srs_wkt (p, 9,
-        "35],PARAMETER[\"standard_parallel_2\",37.21666666666667]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"latitude_of_origin\",36.66666666666666],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"central_meridian\",-111.5],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 12,
-        "sting\",1640416.6667],PARAMETER[\"false_northing\",98425");
-    add_srs_wkt (p, 13,
-        "00.000000002],UNIT[\"US survey foot\",0.3048006096012192");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"X\",EAST],AXIS[\"Y");
-    add_srs_wkt (p, 15,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"6627\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6628, "epsg", 6628,
-        "NAD83(PA11) / Hawaii zone 1", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_PA11", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=18.83333333333333 +lon_0=-155.5 +k=0.");
-    add_proj4text (p, 1,
-        "999966667 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(PA11) / Hawaii zone 1\",GEOGCS[\"NAD83(PA");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",18.83333333333333");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-155.5],PARAMETER[\"sca");
-    add_srs_wkt (p, 10,
-        "le_factor\",0.999966667],PARAMETER[\"false_easting\",500");
-    add_srs_wkt (p, 11,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"6628\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6629, "epsg", 6629,
-        "NAD83(PA11) / Hawaii zone 2", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_PA11", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=20.33333333333333 +lon_0=-156.6666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999966667 +x_0=500000 +y_0=0 +ellps=GRS80 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(PA11) / Hawaii zone 2\",GEOGCS[\"NAD83(PA");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",20.33333333333333");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-156.6666666666667],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",0.999966667],PARAMETER[\"false_e");
-    add_srs_wkt (p, 11,
-        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"6629\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6630, "epsg", 6630,
-        "NAD83(PA11) / Hawaii zone 3", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_PA11", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.16666666666667 +lon_0=-158 +k=0.99");
-    add_proj4text (p, 1,
-        "999 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(PA11) / Hawaii zone 3\",GEOGCS[\"NAD83(PA");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",21.16666666666667");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-158],PARAMETER[\"scale");
-    add_srs_wkt (p, 10,
-        "_factor\",0.99999],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"6630\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6631, "epsg", 6631,
-        "NAD83(PA11) / Hawaii zone 4", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_PA11", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.83333333333333 +lon_0=-159.5 +k=0.");
-    add_proj4text (p, 1,
-        "99999 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(PA11) / Hawaii zone 4\",GEOGCS[\"NAD83(PA");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",21.83333333333333");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-159.5],PARAMETER[\"sca");
-    add_srs_wkt (p, 10,
-        "le_factor\",0.99999],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"6631\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6632, "epsg", 6632,
-        "NAD83(PA11) / Hawaii zone 5", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_PA11", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.66666666666667 +lon_0=-160.1666666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(PA11) / Hawaii zone 5\",GEOGCS[\"NAD83(PA");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",21.66666666666667");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"central_meridian\",-160.1666666666667],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"6632\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6633, "epsg", 6633,
-        "NAD83(PA11) / Hawaii zone 3 (ftUS)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_PA11", "Transverse_Mercator", "US survey foot",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.16666666666667 +lon_0=-158 +k=0.99");
-    add_proj4text (p, 1,
-        "999 +x_0=500000.00001016 +y_0=0 +ellps=GRS80 +units=us-f");
-    add_proj4text (p, 2,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(PA11) / Hawaii zone 3 (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(PA11)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_PA11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",21.1666666");
-    add_srs_wkt (p, 9,
-        "6666667],PARAMETER[\"central_meridian\",-158],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"scale_factor\",0.99999],PARAMETER[\"false_easting\",16");
-    add_srs_wkt (p, 11,
-        "40416.6667],PARAMETER[\"false_northing\",0],UNIT[\"US su");
-    add_srs_wkt (p, 12,
-        "rvey foot\",0.3048006096012192,AUTHORITY[\"EPSG\",\"9003");
-    add_srs_wkt (p, 13,
-        "\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"6633\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6634, "epsg", 6634,
-        "NAD83(PA11) / UTM zone 4N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_PA11", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=4 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(PA11) / UTM zone 4N\",GEOGCS[\"NAD83(PA11");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_PA11");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 7,
-        "RITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 8,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 9,
-        "tral_meridian\",-159],PARAMETER[\"scale_factor\",0.9996]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"6634\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6635, "epsg", 6635,
-        "NAD83(PA11) / UTM zone 5N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_PA11", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=5 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(PA11) / UTM zone 5N\",GEOGCS[\"NAD83(PA11");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_PA11");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 7,
-        "RITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 8,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 9,
-        "tral_meridian\",-153],PARAMETER[\"scale_factor\",0.9996]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"6635\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6636, "epsg", 6636,
-        "NAD83(PA11) / UTM zone 2S", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_PA11", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=2 +south +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(PA11) / UTM zone 2S\",GEOGCS[\"NAD83(PA11");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_PA11");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 7,
-        "RITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 8,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 9,
-        "tral_meridian\",-171],PARAMETER[\"scale_factor\",0.9996]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"6636\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6637, "epsg", 6637,
-        "NAD83(MA11) / Guam Map Grid", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_National_Spatial_Reference_System_MA11", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=13.5 +lon_0=144.75 +k=1 +x_0=100000 +");
-    add_proj4text (p, 1,
-        "y_0=200000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(MA11) / Guam Map Grid\",GEOGCS[\"NAD83(MA");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_MA");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1118\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"6325\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",13.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "central_meridian\",144.75],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",100000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",200000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"6637\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6646, "epsg", 6646,
-        "Karbala 1979 / Iraq National Grid", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Karbala_1979", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.02626833333333 +lon_0=46.5 +k=0.99");
-    add_proj4text (p, 1,
-        "94 +x_0=800000 +y_0=0 +ellps=clrk80 +towgs84=70.995,-335");
-    add_proj4text (p, 2,
-        ".916,262.898,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Karbala 1979 / Iraq National Grid\",GEOGCS[\"Ka");
-    add_srs_wkt (p, 1,
-        "rbala 1979\",DATUM[\"Karbala_1979\",SPHEROID[\"Clarke 18");
-    add_srs_wkt (p, 2,
-        "80 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012");
-    add_srs_wkt (p, 3,
-        "\"]],TOWGS84[70.995,-335.916,262.898,0,0,0,0],AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"6743\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[");
-    add_srs_wkt (p, 7,
-        "\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4743\"]],PROJEC");
-    add_srs_wkt (p, 8,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 9,
-        "igin\",29.02626833333333],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 10,
-        ",46.5],PARAMETER[\"scale_factor\",0.9994],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",800000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 13,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 14,
-        "\"6646\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6649, "epsg", 6649,
-        "NAD83(CSRS)", 1, 1,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +vunit");
-    add_proj4text (p, 1,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) + CGVD2013 height\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],VERT_CS[");
-    add_srs_wkt (p, 8,
-        "\"CGVD2013 height\",VERT_DATUM[\"Canadian Geodetic Verti");
-    add_srs_wkt (p, 9,
-        "cal Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\"");
-    add_srs_wkt (p, 11,
-        ",UP],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "6649\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6650, "epsg", 6650,
-        "NAD83(CSRS) / UTM zone 7N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=7 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 7N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 7N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 2,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 3,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 8,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"");
-    add_srs_wkt (p, 9,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"central_meridian\",-141],PARAMETER[\"scal");
-    add_srs_wkt (p, 11,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3154\"]],VERT_CS[\"CG");
-    add_srs_wkt (p, 15,
-        "VD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical ");
-    add_srs_wkt (p, 16,
-        "Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT[");
-    add_srs_wkt (p, 17,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",UP");
-    add_srs_wkt (p, 18,
-        "],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"665");
-    add_srs_wkt (p, 19,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6651, "epsg", 6651,
-        "NAD83(CSRS) / UTM zone 8N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=8 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 8N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 8N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 2,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 3,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 8,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"");
-    add_srs_wkt (p, 9,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"central_meridian\",-135],PARAMETER[\"scal");
-    add_srs_wkt (p, 11,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3155\"]],VERT_CS[\"CG");
-    add_srs_wkt (p, 15,
-        "VD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical ");
-    add_srs_wkt (p, 16,
-        "Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT[");
-    add_srs_wkt (p, 17,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",UP");
-    add_srs_wkt (p, 18,
-        "],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"665");
-    add_srs_wkt (p, 19,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6652, "epsg", 6652,
-        "NAD83(CSRS) / UTM zone 9N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=9 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 9N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 9N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 2,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 3,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 8,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"");
-    add_srs_wkt (p, 9,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"central_meridian\",-129],PARAMETER[\"scal");
-    add_srs_wkt (p, 11,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3156\"]],VERT_CS[\"CG");
-    add_srs_wkt (p, 15,
-        "VD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical ");
-    add_srs_wkt (p, 16,
-        "Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT[");
-    add_srs_wkt (p, 17,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",UP");
-    add_srs_wkt (p, 18,
-        "],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"665");
-    add_srs_wkt (p, 19,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6653, "epsg", 6653,
-        "NAD83(CSRS) / UTM zone 10N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=10 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 10N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 10N\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 2,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 3,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 8,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 9,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",0],PARAMETER[\"central_meridian\",-123],PARAMETER[\"sca");
-    add_srs_wkt (p, 11,
-        "le_factor\",0.9996],PARAMETER[\"false_easting\",500000],");
-    add_srs_wkt (p, 12,
-        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor");
-    add_srs_wkt (p, 14,
-        "thing\",NORTH],AUTHORITY[\"EPSG\",\"3157\"]],VERT_CS[\"C");
-    add_srs_wkt (p, 15,
-        "GVD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical");
-    add_srs_wkt (p, 16,
-        " Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT");
-    add_srs_wkt (p, 17,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",U");
-    add_srs_wkt (p, 18,
-        "P],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"66");
-    add_srs_wkt (p, 19,
-        "53\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6654, "epsg", 6654,
-        "NAD83(CSRS) / UTM zone 11N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=11 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 11N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 11N\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 2,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 3,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 8,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 9,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",0],PARAMETER[\"central_meridian\",-117],PARAMETER[\"sca");
-    add_srs_wkt (p, 11,
-        "le_factor\",0.9996],PARAMETER[\"false_easting\",500000],");
-    add_srs_wkt (p, 12,
-        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor");
-    add_srs_wkt (p, 14,
-        "thing\",NORTH],AUTHORITY[\"EPSG\",\"2955\"]],VERT_CS[\"C");
-    add_srs_wkt (p, 15,
-        "GVD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical");
-    add_srs_wkt (p, 16,
-        " Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT");
-    add_srs_wkt (p, 17,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",U");
-    add_srs_wkt (p, 18,
-        "P],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"66");
-    add_srs_wkt (p, 19,
-        "54\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6655, "epsg", 6655,
-        "NAD83(CSRS) / UTM zone 12N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=12 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 12N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 12N\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 2,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 3,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 8,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 9,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",0],PARAMETER[\"central_meridian\",-111],PARAMETER[\"sca");
-    add_srs_wkt (p, 11,
-        "le_factor\",0.9996],PARAMETER[\"false_easting\",500000],");
-    add_srs_wkt (p, 12,
-        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor");
-    add_srs_wkt (p, 14,
-        "thing\",NORTH],AUTHORITY[\"EPSG\",\"2956\"]],VERT_CS[\"C");
-    add_srs_wkt (p, 15,
-        "GVD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical");
-    add_srs_wkt (p, 16,
-        " Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT");
-    add_srs_wkt (p, 17,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",U");
-    add_srs_wkt (p, 18,
-        "P],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"66");
-    add_srs_wkt (p, 19,
-        "55\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6656, "epsg", 6656,
-        "NAD83(CSRS) / UTM zone 13N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=13 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 13N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 13N\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 2,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 3,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 8,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 9,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",0],PARAMETER[\"central_meridian\",-105],PARAMETER[\"sca");
-    add_srs_wkt (p, 11,
-        "le_factor\",0.9996],PARAMETER[\"false_easting\",500000],");
-    add_srs_wkt (p, 12,
-        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor");
-    add_srs_wkt (p, 14,
-        "thing\",NORTH],AUTHORITY[\"EPSG\",\"2957\"]],VERT_CS[\"C");
-    add_srs_wkt (p, 15,
-        "GVD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical");
-    add_srs_wkt (p, 16,
-        " Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT");
-    add_srs_wkt (p, 17,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",U");
-    add_srs_wkt (p, 18,
-        "P],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"66");
-    add_srs_wkt (p, 19,
-        "56\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6657, "epsg", 6657,
-        "NAD83(CSRS) / UTM zone 14N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=14 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 14N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 14N\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 2,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 3,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 8,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 9,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",0],PARAMETER[\"central_meridian\",-99],PARAMETER[\"scal");
-    add_srs_wkt (p, 11,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3158\"]],VERT_CS[\"CG");
-    add_srs_wkt (p, 15,
-        "VD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical ");
-    add_srs_wkt (p, 16,
-        "Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT[");
-    add_srs_wkt (p, 17,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",UP");
-    add_srs_wkt (p, 18,
-        "],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"665");
-    add_srs_wkt (p, 19,
-        "7\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6658, "epsg", 6658,
-        "NAD83(CSRS) / UTM zone 15N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=15 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 15N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 15N\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 2,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 3,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 8,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 9,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",0],PARAMETER[\"central_meridian\",-93],PARAMETER[\"scal");
-    add_srs_wkt (p, 11,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3159\"]],VERT_CS[\"CG");
-    add_srs_wkt (p, 15,
-        "VD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical ");
-    add_srs_wkt (p, 16,
-        "Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT[");
-    add_srs_wkt (p, 17,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",UP");
-    add_srs_wkt (p, 18,
-        "],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"665");
-    add_srs_wkt (p, 19,
-        "8\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6659, "epsg", 6659,
-        "NAD83(CSRS) / UTM zone 16N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=16 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 16N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 16N\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 2,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 3,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 8,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 9,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",0],PARAMETER[\"central_meridian\",-87],PARAMETER[\"scal");
-    add_srs_wkt (p, 11,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3160\"]],VERT_CS[\"CG");
-    add_srs_wkt (p, 15,
-        "VD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical ");
-    add_srs_wkt (p, 16,
-        "Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT[");
-    add_srs_wkt (p, 17,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",UP");
-    add_srs_wkt (p, 18,
-        "],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"665");
-    add_srs_wkt (p, 19,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6660, "epsg", 6660,
-        "NAD83(CSRS) / UTM zone 17N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 17N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 17N\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 2,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 3,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 8,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 9,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",0],PARAMETER[\"central_meridian\",-81],PARAMETER[\"scal");
-    add_srs_wkt (p, 11,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2958\"]],VERT_CS[\"CG");
-    add_srs_wkt (p, 15,
-        "VD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical ");
-    add_srs_wkt (p, 16,
-        "Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT[");
-    add_srs_wkt (p, 17,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",UP");
-    add_srs_wkt (p, 18,
-        "],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"666");
-    add_srs_wkt (p, 19,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6661, "epsg", 6661,
-        "NAD83(CSRS) / UTM zone 18N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 18N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 18N\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 2,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 3,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 8,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 9,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",0],PARAMETER[\"central_meridian\",-75],PARAMETER[\"scal");
-    add_srs_wkt (p, 11,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2959\"]],VERT_CS[\"CG");
-    add_srs_wkt (p, 15,
-        "VD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical ");
-    add_srs_wkt (p, 16,
-        "Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT[");
-    add_srs_wkt (p, 17,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",UP");
-    add_srs_wkt (p, 18,
-        "],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"666");
-    add_srs_wkt (p, 19,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6662, "epsg", 6662,
-        "NAD83(CSRS) / UTM zone 19N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 19N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 19N\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 2,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 3,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 8,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 9,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",0],PARAMETER[\"central_meridian\",-69],PARAMETER[\"scal");
-    add_srs_wkt (p, 11,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2960\"]],VERT_CS[\"CG");
-    add_srs_wkt (p, 15,
-        "VD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical ");
-    add_srs_wkt (p, 16,
-        "Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT[");
-    add_srs_wkt (p, 17,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",UP");
-    add_srs_wkt (p, 18,
-        "],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"666");
-    add_srs_wkt (p, 19,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6663, "epsg", 6663,
-        "NAD83(CSRS) / UTM zone 20N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 20N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 20N\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 2,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 3,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 8,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 9,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",0],PARAMETER[\"central_meridian\",-63],PARAMETER[\"scal");
-    add_srs_wkt (p, 11,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2961\"]],VERT_CS[\"CG");
-    add_srs_wkt (p, 15,
-        "VD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical ");
-    add_srs_wkt (p, 16,
-        "Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT[");
-    add_srs_wkt (p, 17,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",UP");
-    add_srs_wkt (p, 18,
-        "],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"666");
-    add_srs_wkt (p, 19,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6664, "epsg", 6664,
-        "NAD83(CSRS) / UTM zone 21N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 21N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 21N\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 2,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 3,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 8,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 9,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",0],PARAMETER[\"central_meridian\",-57],PARAMETER[\"scal");
-    add_srs_wkt (p, 11,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2962\"]],VERT_CS[\"CG");
-    add_srs_wkt (p, 15,
-        "VD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical ");
-    add_srs_wkt (p, 16,
-        "Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT[");
-    add_srs_wkt (p, 17,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",UP");
-    add_srs_wkt (p, 18,
-        "],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"666");
-    add_srs_wkt (p, 19,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6665, "epsg", 6665,
-        "NAD83(CSRS) / UTM zone 22N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(CSRS) / UTM zone 22N + CGVD2013 height\"");
-    add_srs_wkt (p, 1,
-        ",PROJCS[\"NAD83(CSRS) / UTM zone 22N\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 2,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 3,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 8,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[");
-    add_srs_wkt (p, 9,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 10,
-        ",0],PARAMETER[\"central_meridian\",-51],PARAMETER[\"scal");
-    add_srs_wkt (p, 11,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3761\"]],VERT_CS[\"CG");
-    add_srs_wkt (p, 15,
-        "VD2013 height\",VERT_DATUM[\"Canadian Geodetic Vertical ");
-    add_srs_wkt (p, 16,
-        "Datum of 2013\",2005,AUTHORITY[\"EPSG\",\"1127\"]],UNIT[");
-    add_srs_wkt (p, 17,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Up\",UP");
-    add_srs_wkt (p, 18,
-        "],AUTHORITY[\"EPSG\",\"6647\"]],AUTHORITY[\"EPSG\",\"666");
-    add_srs_wkt (p, 19,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6668, "epsg", 6668,
-        "JGD2011", 1, 1,
-        "GRS 1980", "Greenwich",
-        "Japanese_Geodetic_Datum_2011", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"JGD2011\",DATUM[\"Japanese_Geodetic_Datum_2011\"");
-    add_srs_wkt (p, 1,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1128\"]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 4,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 5,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"6668\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6669, "epsg", 6669,
-        "JGD2011 / Japan Plane Rectangular CS I", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Japanese_Geodetic_Datum_2011", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=33 +lon_0=129.5 +k=0.9999 +x_0=0 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JGD2011 / Japan Plane Rectangular CS I\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"JGD2011\",DATUM[\"Japanese_Geodetic_Datum_2011\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"1128\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"6668\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",33],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",129.5],PARAMETER[\"scale_factor\",0.9999],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",0],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"6669\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6670, "epsg", 6670,
-        "JGD2011 / Japan Plane Rectangular CS II", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Japanese_Geodetic_Datum_2011", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=33 +lon_0=131 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JGD2011 / Japan Plane Rectangular CS II\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"JGD2011\",DATUM[\"Japanese_Geodetic_Datum_2011\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"1128\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"6668\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",33],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",131],PARAMETER[\"scale_factor\",0.9999],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"6670\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6671, "epsg", 6671,
-        "JGD2011 / Japan Plane Rectangular CS III", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Japanese_Geodetic_Datum_2011", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36 +lon_0=132.1666666666667 +k=0.9999");
-    add_proj4text (p, 1,
-        " +x_0=0 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JGD2011 / Japan Plane Rectangular CS III\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"JGD2011\",DATUM[\"Japanese_Geodetic_Datum_2011\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1128\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"6668\"]],PROJECTION[\"Transverse_Mercator\"],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"latitude_of_origin\",36],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",132.1666666666667],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",0.9999],PARAMETER[\"false_easting\",0],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "01\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 13,
-        "SG\",\"6671\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6672, "epsg", 6672,
-        "JGD2011 / Japan Plane Rectangular CS IV", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Japanese_Geodetic_Datum_2011", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=33 +lon_0=133.5 +k=0.9999 +x_0=0 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JGD2011 / Japan Plane Rectangular CS IV\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"JGD2011\",DATUM[\"Japanese_Geodetic_Datum_2011\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"1128\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"6668\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",33],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",133.5],PARAMETER[\"scale_factor\",0.9999],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",0],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"6672\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6673, "epsg", 6673,
-        "JGD2011 / Japan Plane Rectangular CS V", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Japanese_Geodetic_Datum_2011", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36 +lon_0=134.3333333333333 +k=0.9999");
-    add_proj4text (p, 1,
-        " +x_0=0 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JGD2011 / Japan Plane Rectangular CS V\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"JGD2011\",DATUM[\"Japanese_Geodetic_Datum_2011\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"1128\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"6668\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",36],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",134.3333333333333],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 10,
-        ".9999],PARAMETER[\"false_easting\",0],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"6673\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6674, "epsg", 6674,
-        "JGD2011 / Japan Plane Rectangular CS VI", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Japanese_Geodetic_Datum_2011", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36 +lon_0=136 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JGD2011 / Japan Plane Rectangular CS VI\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"JGD2011\",DATUM[\"Japanese_Geodetic_Datum_2011\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"1128\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"6668\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",36],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",136],PARAMETER[\"scale_factor\",0.9999],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"6674\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6675, "epsg", 6675,
-        "JGD2011 / Japan Plane Rectangular CS VII", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Japanese_Geodetic_Datum_2011", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36 +lon_0=137.1666666666667 +k=0.9999");
-    add_proj4text (p, 1,
-        " +x_0=0 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JGD2011 / Japan Plane Rectangular CS VII\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"JGD2011\",DATUM[\"Japanese_Geodetic_Datum_2011\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1128\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"6668\"]],PROJECTION[\"Transverse_Mercator\"],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"latitude_of_origin\",36],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",137.1666666666667],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",0.9999],PARAMETER[\"false_easting\",0],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "01\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 13,
-        "SG\",\"6675\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
@@ -1,3935 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_35 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 21459, "epsg", 21459,
-        "Beijing 1954 / Gauss-Kruger CM 111E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger CM 111E\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"Krassow");
-    add_srs_wkt (p, 2,
-        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 8,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",111],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"21459\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21460, "epsg", 21460,
-        "Beijing 1954 / Gauss-Kruger CM 117E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger CM 117E\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"Krassow");
-    add_srs_wkt (p, 2,
-        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 8,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",117],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"21460\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21461, "epsg", 21461,
-        "Beijing 1954 / Gauss-Kruger CM 123E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger CM 123E\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"Krassow");
-    add_srs_wkt (p, 2,
-        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 8,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",123],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"21461\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21462, "epsg", 21462,
-        "Beijing 1954 / Gauss-Kruger CM 129E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger CM 129E\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"Krassow");
-    add_srs_wkt (p, 2,
-        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 8,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",129],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"21462\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21463, "epsg", 21463,
-        "Beijing 1954 / Gauss-Kruger CM 135E", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger CM 135E\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"Krassow");
-    add_srs_wkt (p, 2,
-        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 8,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",135],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"21463\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21473, "epsg", 21473,
-        "Beijing 1954 / Gauss-Kruger 13N (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger 13N (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTIO");
-    add_srs_wkt (p, 8,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 9,
-        "n\",0],PARAMETER[\"central_meridian\",75],PARAMETER[\"sc");
-    add_srs_wkt (p, 10,
-        "ale_factor\",1],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"21473\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21474, "epsg", 21474,
-        "Beijing 1954 / Gauss-Kruger 14N (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger 14N (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTIO");
-    add_srs_wkt (p, 8,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 9,
-        "n\",0],PARAMETER[\"central_meridian\",81],PARAMETER[\"sc");
-    add_srs_wkt (p, 10,
-        "ale_factor\",1],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"21474\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21475, "epsg", 21475,
-        "Beijing 1954 / Gauss-Kruger 15N (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger 15N (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTIO");
-    add_srs_wkt (p, 8,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 9,
-        "n\",0],PARAMETER[\"central_meridian\",87],PARAMETER[\"sc");
-    add_srs_wkt (p, 10,
-        "ale_factor\",1],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"21475\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21476, "epsg", 21476,
-        "Beijing 1954 / Gauss-Kruger 16N (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger 16N (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTIO");
-    add_srs_wkt (p, 8,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 9,
-        "n\",0],PARAMETER[\"central_meridian\",93],PARAMETER[\"sc");
-    add_srs_wkt (p, 10,
-        "ale_factor\",1],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"21476\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21477, "epsg", 21477,
-        "Beijing 1954 / Gauss-Kruger 17N (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger 17N (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTIO");
-    add_srs_wkt (p, 8,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 9,
-        "n\",0],PARAMETER[\"central_meridian\",99],PARAMETER[\"sc");
-    add_srs_wkt (p, 10,
-        "ale_factor\",1],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"21477\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21478, "epsg", 21478,
-        "Beijing 1954 / Gauss-Kruger 18N (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger 18N (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTIO");
-    add_srs_wkt (p, 8,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 9,
-        "n\",0],PARAMETER[\"central_meridian\",105],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "cale_factor\",1],PARAMETER[\"false_easting\",500000],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"21478\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21479, "epsg", 21479,
-        "Beijing 1954 / Gauss-Kruger 19N (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger 19N (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTIO");
-    add_srs_wkt (p, 8,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 9,
-        "n\",0],PARAMETER[\"central_meridian\",111],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "cale_factor\",1],PARAMETER[\"false_easting\",500000],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"21479\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21480, "epsg", 21480,
-        "Beijing 1954 / Gauss-Kruger 20N (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger 20N (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTIO");
-    add_srs_wkt (p, 8,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 9,
-        "n\",0],PARAMETER[\"central_meridian\",117],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "cale_factor\",1],PARAMETER[\"false_easting\",500000],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"21480\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21481, "epsg", 21481,
-        "Beijing 1954 / Gauss-Kruger 21N (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger 21N (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTIO");
-    add_srs_wkt (p, 8,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 9,
-        "n\",0],PARAMETER[\"central_meridian\",123],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "cale_factor\",1],PARAMETER[\"false_easting\",500000],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"21481\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21482, "epsg", 21482,
-        "Beijing 1954 / Gauss-Kruger 22N (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger 22N (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTIO");
-    add_srs_wkt (p, 8,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 9,
-        "n\",0],PARAMETER[\"central_meridian\",129],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "cale_factor\",1],PARAMETER[\"false_easting\",500000],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"21482\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21483, "epsg", 21483,
-        "Beijing 1954 / Gauss-Kruger 23N (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Beijing_1954", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger 23N (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],TOWGS84[15.8,-154.4,-82.3,0,0,0,0],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4214\"]],PROJECTIO");
-    add_srs_wkt (p, 8,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 9,
-        "n\",0],PARAMETER[\"central_meridian\",135],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "cale_factor\",1],PARAMETER[\"false_easting\",500000],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"21483\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21500, "epsg", 21500,
-        "Belge 1950 (Brussels) / Belge Lambert 50", 0, 0,
-        "International 1924", "Brussels",
-        "Reseau_National_Belge_1950_Brussels", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49.83333333333334 +lat_2=51.16666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=90 +lon_0=0 +x_0=150000 +y_0=5400000 +ellps=i");
-    add_proj4text (p, 2,
-        "ntl +pm=brussels +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Belge 1950 (Brussels) / Belge Lambert 50\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Belge 1950 (Brussels)\",DATUM[\"Reseau_National_Bel");
-    add_srs_wkt (p, 2,
-        "ge_1950_Brussels\",SPHEROID[\"International 1924\",63783");
-    add_srs_wkt (p, 3,
-        "88,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6809\"]],PRIMEM[\"Brussels\",4.367975,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8910\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4809\"]],PROJECTIO");
-    add_srs_wkt (p, 8,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"standard_");
-    add_srs_wkt (p, 9,
-        "parallel_1\",49.83333333333334],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 10,
-        "allel_2\",51.16666666666666],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 11,
-        "gin\",90],PARAMETER[\"central_meridian\",0],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_easting\",150000],PARAMETER[\"false_northing\",540");
-    add_srs_wkt (p, 13,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"215");
-    add_srs_wkt (p, 15,
-        "00\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21780, "epsg", 21780,
-        "Bern 1898 (Bern) / LV03C", 0, 0,
-        "Bessel 1841", "Bern",
-        "CH1903_Bern", "Hotine_Oblique_Mercator_Azimuth_Center", "metre",
-        "Y", "East", "X", "North");
-    add_proj4text (p, 0,
-        "+proj=somerc +lat_0=46.95240555555556 +lon_0=0 +k_0=1 +x");
-    add_proj4text (p, 1,
-        "_0=0 +y_0=0 +ellps=bessel +towgs84=674.4,15.1,405.3,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +pm=bern +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bern 1898 (Bern) / LV03C\",GEOGCS[\"Bern 1898 (");
-    add_srs_wkt (p, 1,
-        "Bern)\",DATUM[\"CH1903_Bern\",SPHEROID[\"Bessel 1841\",6");
-    add_srs_wkt (p, 2,
-        "377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[674.4,15.1,405.3,0,0,0,0],AUTHORITY[\"EPSG\",\"6801");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Bern\",7.439583333333333,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8907\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4801\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Hotine_Oblique_Mercator_Azimuth_Center\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "latitude_of_center\",46.95240555555556],PARAMETER[\"long");
-    add_srs_wkt (p, 10,
-        "itude_of_center\",0],PARAMETER[\"azimuth\",90],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"rectified_grid_angle\",90],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 12,
-        ",1],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 13,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 14,
-        "],AXIS[\"Y\",EAST],AXIS[\"X\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 15,
-        "\"21780\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21781, "epsg", 21781,
-        "CH1903 / LV03", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "CH1903", "Hotine_Oblique_Mercator_Azimuth_Center", "metre",
-        "Y", "East", "X", "North");
-    add_proj4text (p, 0,
-        "+proj=somerc +lat_0=46.95240555555556 +lon_0=7.439583333");
-    add_proj4text (p, 1,
-        "333333 +k_0=1 +x_0=600000 +y_0=200000 +ellps=bessel +tow");
-    add_proj4text (p, 2,
-        "gs84=674.4,15.1,405.3,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CH1903 / LV03\",GEOGCS[\"CH1903\",DATUM[\"CH190");
-    add_srs_wkt (p, 1,
-        "3\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7004\"]],TOWGS84[674.4,15.1,405.3,0,0,");
-    add_srs_wkt (p, 3,
-        "0,0],AUTHORITY[\"EPSG\",\"6149\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4149\"]],PROJECTION[\"Hotine_Oblique_Mercator_Azimuth_Ce");
-    add_srs_wkt (p, 8,
-        "nter\"],PARAMETER[\"latitude_of_center\",46.952405555555");
-    add_srs_wkt (p, 9,
-        "56],PARAMETER[\"longitude_of_center\",7.439583333333333]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"azimuth\",90],PARAMETER[\"rectified_grid_an");
-    add_srs_wkt (p, 11,
-        "gle\",90],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 12,
-        "e_easting\",600000],PARAMETER[\"false_northing\",200000]");
-    add_srs_wkt (p, 13,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Y");
-    add_srs_wkt (p, 14,
-        "\",EAST],AXIS[\"X\",NORTH],AUTHORITY[\"EPSG\",\"21781\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 21782, "epsg", 21782,
-        "CH1903 / LV03C-G", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "CH1903", "Hotine_Oblique_Mercator_Azimuth_Center", "metre",
-        "Y", "East", "X", "North");
-    add_proj4text (p, 0,
-        "+proj=somerc +lat_0=46.95240555555556 +lon_0=7.439583333");
-    add_proj4text (p, 1,
-        "333333 +k_0=1 +x_0=0 +y_0=0 +ellps=bessel +towgs84=674.4");
-    add_proj4text (p, 2,
-        ",15.1,405.3,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CH1903 / LV03C-G\",GEOGCS[\"CH1903\",DATUM[\"CH");
-    add_srs_wkt (p, 1,
-        "1903\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[674.4,15.1,405.3,0");
-    add_srs_wkt (p, 3,
-        ",0,0,0],AUTHORITY[\"EPSG\",\"6149\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 6,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4149\"]],PROJECTION[\"Hotine_Oblique_Mercator_Azimuth");
-    add_srs_wkt (p, 8,
-        "_Center\"],PARAMETER[\"latitude_of_center\",46.952405555");
-    add_srs_wkt (p, 9,
-        "55556],PARAMETER[\"longitude_of_center\",7.4395833333333");
-    add_srs_wkt (p, 10,
-        "33],PARAMETER[\"azimuth\",90],PARAMETER[\"rectified_grid");
-    add_srs_wkt (p, 11,
-        "_angle\",90],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 12,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 13,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Y\",EAST]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"X\",NORTH],AUTHORITY[\"EPSG\",\"21782\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21817, "epsg", 21817,
-        "Bogota 1975 / UTM zone 17N (deprecated)", 0, 0,
-        "International 1924", "Greenwich",
-        "Bogota_1975", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=intl +towgs84=307,304,-318,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / UTM zone 17N (deprecated)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"Bogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Inter");
-    add_srs_wkt (p, 2,
-        "national 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]");
-    add_srs_wkt (p, 3,
-        "],TOWGS84[307,304,-318,0,0,0,0],AUTHORITY[\"EPSG\",\"621");
-    add_srs_wkt (p, 4,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4218\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"central_meridian\",-81],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 10,
-        "\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"21817\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21818, "epsg", 21818,
-        "Bogota 1975 / UTM zone 18N", 0, 0,
-        "International 1924", "Greenwich",
-        "Bogota_1975", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=intl +towgs84=307,304,-318,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / UTM zone 18N\",GEOGCS[\"Bogota 19");
-    add_srs_wkt (p, 1,
-        "75\",DATUM[\"Bogota_1975\",SPHEROID[\"International 1924");
-    add_srs_wkt (p, 2,
-        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[307");
-    add_srs_wkt (p, 3,
-        ",304,-318,0,0,0,0],AUTHORITY[\"EPSG\",\"6218\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4218\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 9,
-        "l_meridian\",-75],PARAMETER[\"scale_factor\",0.9996],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_easting\",500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"21818\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21891, "epsg", 21891,
-        "Bogota 1975 / Colombia West zone (deprecated)", 0, 0,
-        "International 1924", "Greenwich",
-        "Bogota_1975", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-77.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia West zone (deprecated)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"Bogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "22\"]],TOWGS84[307,304,-318,0,0,0,0],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 7,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4218\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 8,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",4.");
-    add_srs_wkt (p, 9,
-        "599047222222222],PARAMETER[\"central_meridian\",-77.0809");
-    add_srs_wkt (p, 10,
-        "1666666667],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",1000000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 12,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"2189");
-    add_srs_wkt (p, 14,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21892, "epsg", 21892,
-        "Bogota 1975 / Colombia Bogota zone (deprecated)", 0, 0,
-        "International 1924", "Greenwich",
-        "Bogota_1975", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-74.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia Bogota zone (deprecated)");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Bogota 1975\",DATUM[\"Bogota_1975\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7022\"]],TOWGS84[307,304,-318,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 7,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4218\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 8,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",4");
-    add_srs_wkt (p, 9,
-        ".599047222222222],PARAMETER[\"central_meridian\",-74.080");
-    add_srs_wkt (p, 10,
-        "91666666667],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",1000000],PARAMETER[\"false_northing\",100");
-    add_srs_wkt (p, 12,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"218");
-    add_srs_wkt (p, 14,
-        "92\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21893, "epsg", 21893,
-        "Bogota 1975 / Colombia East Central zone (deprecated)", 0, 0,
-        "International 1924", "Greenwich",
-        "Bogota_1975", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-71.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia East Central zone (depre");
-    add_srs_wkt (p, 1,
-        "cated)\",GEOGCS[\"Bogota 1975\",DATUM[\"Bogota_1975\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"International 1924\",6378388,297,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7022\"]],TOWGS84[307,304,-318,0,0,0,0],AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[");
-    add_srs_wkt (p, 7,
-        "\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4218\"]],PROJEC");
-    add_srs_wkt (p, 8,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 9,
-        "igin\",4.599047222222222],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 10,
-        ",-71.08091666666667],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_easting\",1000000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 13,
-        "\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"21893\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21894, "epsg", 21894,
-        "Bogota 1975 / Colombia East (deprecated)", 0, 0,
-        "International 1924", "Greenwich",
-        "Bogota_1975", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-68.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia East (deprecated)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Bogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Inte");
-    add_srs_wkt (p, 2,
-        "rnational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[307,304,-318,0,0,0,0],AUTHORITY[\"EPSG\",\"62");
-    add_srs_wkt (p, 4,
-        "18\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4218\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",4.59904");
-    add_srs_wkt (p, 9,
-        "7222222222],PARAMETER[\"central_meridian\",-68.080916666");
-    add_srs_wkt (p, 10,
-        "66667],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e");
-    add_srs_wkt (p, 11,
-        "asting\",1000000],PARAMETER[\"false_northing\",1000000],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"21894\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21896, "epsg", 21896,
-        "Bogota 1975 / Colombia West zone", 0, 1,
-        "International 1924", "Greenwich",
-        "Bogota_1975", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-77.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia West zone\",GEOGCS[\"Bog");
-    add_srs_wkt (p, 1,
-        "ota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Internationa");
-    add_srs_wkt (p, 2,
-        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS");
-    add_srs_wkt (p, 3,
-        "84[307,304,-318,0,0,0,0],AUTHORITY[\"EPSG\",\"6218\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"4218\"]],PROJECTION[\"Transverse_Mer");
-    add_srs_wkt (p, 8,
-        "cator\"],PARAMETER[\"latitude_of_origin\",4.599047222222");
-    add_srs_wkt (p, 9,
-        "222],PARAMETER[\"central_meridian\",-77.08091666666667],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",1000000],PARAMETER[\"false_northing\",1000000],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"21896\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21897, "epsg", 21897,
-        "Bogota 1975 / Colombia Bogota zone", 0, 1,
-        "International 1924", "Greenwich",
-        "Bogota_1975", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-74.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia Bogota zone\",GEOGCS[\"B");
-    add_srs_wkt (p, 1,
-        "ogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Internatio");
-    add_srs_wkt (p, 2,
-        "nal 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[307,304,-318,0,0,0,0],AUTHORITY[\"EPSG\",\"6218\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"4218\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 8,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",4.5990472222");
-    add_srs_wkt (p, 9,
-        "22222],PARAMETER[\"central_meridian\",-74.08091666666667");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",1000000],PARAMETER[\"false_northing\",1000000],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"21897\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21898, "epsg", 21898,
-        "Bogota 1975 / Colombia East Central zone", 0, 1,
-        "International 1924", "Greenwich",
-        "Bogota_1975", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-71.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia East Central zone\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Bogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Inte");
-    add_srs_wkt (p, 2,
-        "rnational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[307,304,-318,0,0,0,0],AUTHORITY[\"EPSG\",\"62");
-    add_srs_wkt (p, 4,
-        "18\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4218\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",4.59904");
-    add_srs_wkt (p, 9,
-        "7222222222],PARAMETER[\"central_meridian\",-71.080916666");
-    add_srs_wkt (p, 10,
-        "66667],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e");
-    add_srs_wkt (p, 11,
-        "asting\",1000000],PARAMETER[\"false_northing\",1000000],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"21898\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21899, "epsg", 21899,
-        "Bogota 1975 / Colombia East", 0, 1,
-        "International 1924", "Greenwich",
-        "Bogota_1975", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-68.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia East\",GEOGCS[\"Bogota 1");
-    add_srs_wkt (p, 1,
-        "975\",DATUM[\"Bogota_1975\",SPHEROID[\"International 192");
-    add_srs_wkt (p, 2,
-        "4\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[30");
-    add_srs_wkt (p, 3,
-        "7,304,-318,0,0,0,0],AUTHORITY[\"EPSG\",\"6218\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHOR");
-    add_srs_wkt (p, 7,
-        "ITY[\"EPSG\",\"4218\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",4.599047222222222],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"central_meridian\",-68.08091666666667],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",100");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",1000000],UNIT[\"metre");
-    add_srs_wkt (p, 12,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Y\",EAST],AUTHORITY[\"EPSG\",\"21899\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22032, "epsg", 22032,
-        "Camacupa / UTM zone 32S", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Camacupa", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +south +ellps=clrk80 +towgs84=-50.9,-");
-    add_proj4text (p, 1,
-        "347.6,-231,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Camacupa / UTM zone 32S\",GEOGCS[\"Camacupa\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Camacupa\",SPHEROID[\"Clarke 1880 (RGS)\",6378249");
-    add_srs_wkt (p, 2,
-        ".145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],TOWGS84[-50.9");
-    add_srs_wkt (p, 3,
-        ",-347.6,-231,0,0,0,0],AUTHORITY[\"EPSG\",\"6220\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4220\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 9,
-        "ntral_meridian\",9],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"22032\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22033, "epsg", 22033,
-        "Camacupa / UTM zone 33S", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Camacupa", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +south +ellps=clrk80 +towgs84=-50.9,-");
-    add_proj4text (p, 1,
-        "347.6,-231,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Camacupa / UTM zone 33S\",GEOGCS[\"Camacupa\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Camacupa\",SPHEROID[\"Clarke 1880 (RGS)\",6378249");
-    add_srs_wkt (p, 2,
-        ".145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],TOWGS84[-50.9");
-    add_srs_wkt (p, 3,
-        ",-347.6,-231,0,0,0,0],AUTHORITY[\"EPSG\",\"6220\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4220\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 9,
-        "ntral_meridian\",15],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 11,
-        "rthing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"22033\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22091, "epsg", 22091,
-        "Camacupa / TM 11.30 SE", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Camacupa", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=11.5 +k=0.9996 +x_0=500000 +");
-    add_proj4text (p, 1,
-        "y_0=10000000 +ellps=clrk80 +towgs84=-50.9,-347.6,-231,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Camacupa / TM 11.30 SE\",GEOGCS[\"Camacupa\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Camacupa\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.");
-    add_srs_wkt (p, 2,
-        "145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],TOWGS84[-50.9,");
-    add_srs_wkt (p, 3,
-        "-347.6,-231,0,0,0,0],AUTHORITY[\"EPSG\",\"6220\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 7,
-        "RITY[\"EPSG\",\"4220\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 8,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 9,
-        "tral_meridian\",11.5],PARAMETER[\"scale_factor\",0.9996]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"22091\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22092, "epsg", 22092,
-        "Camacupa / TM 12 SE", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Camacupa", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=0.9996 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +towgs84=-50.9,-347.6,-231,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Camacupa / TM 12 SE\",GEOGCS[\"Camacupa\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Camacupa\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145");
-    add_srs_wkt (p, 2,
-        ",293.465,AUTHORITY[\"EPSG\",\"7012\"]],TOWGS84[-50.9,-34");
-    add_srs_wkt (p, 3,
-        "7.6,-231,0,0,0,0],AUTHORITY[\"EPSG\",\"6220\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4220\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",12],PARAMETER[\"scale_factor\",0.9996],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 11,
-        "g\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"22092\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22171, "epsg", 22171,
-        "POSGAR 98 / Argentina 1", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1998", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 98 / Argentina 1\",GEOGCS[\"POSGAR 98\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"619");
-    add_srs_wkt (p, 4,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4190\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",-72],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",1500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22171\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22172, "epsg", 22172,
-        "POSGAR 98 / Argentina 2", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1998", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 98 / Argentina 2\",GEOGCS[\"POSGAR 98\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"619");
-    add_srs_wkt (p, 4,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4190\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",-69],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",2500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22172\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22173, "epsg", 22173,
-        "POSGAR 98 / Argentina 3", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1998", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-66 +k=1 +x_0=3500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 98 / Argentina 3\",GEOGCS[\"POSGAR 98\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"619");
-    add_srs_wkt (p, 4,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4190\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",-66],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",3500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22173\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22174, "epsg", 22174,
-        "POSGAR 98 / Argentina 4", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1998", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-63 +k=1 +x_0=4500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 98 / Argentina 4\",GEOGCS[\"POSGAR 98\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"619");
-    add_srs_wkt (p, 4,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4190\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",-63],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",4500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22174\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22175, "epsg", 22175,
-        "POSGAR 98 / Argentina 5", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1998", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-60 +k=1 +x_0=5500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 98 / Argentina 5\",GEOGCS[\"POSGAR 98\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"619");
-    add_srs_wkt (p, 4,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4190\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",-60],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",5500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22175\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22176, "epsg", 22176,
-        "POSGAR 98 / Argentina 6", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1998", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-57 +k=1 +x_0=6500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 98 / Argentina 6\",GEOGCS[\"POSGAR 98\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"619");
-    add_srs_wkt (p, 4,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4190\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",-57],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",6500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22176\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22177, "epsg", 22177,
-        "POSGAR 98 / Argentina 7", 0, 1,
-        "GRS 1980", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1998", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-54 +k=1 +x_0=7500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 98 / Argentina 7\",GEOGCS[\"POSGAR 98\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"619");
-    add_srs_wkt (p, 4,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4190\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 8,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"central_meridian\",-54],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",7500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22177\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22181, "epsg", 22181,
-        "POSGAR 94 / Argentina 1", 0, 1,
-        "WGS 84", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1994", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 94 / Argentina 1\",GEOGCS[\"POSGAR 94\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6694");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"4694\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 8,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",-72],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",1500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22181\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22182, "epsg", 22182,
-        "POSGAR 94 / Argentina 2", 0, 1,
-        "WGS 84", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1994", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 94 / Argentina 2\",GEOGCS[\"POSGAR 94\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6694");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"4694\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 8,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",-69],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",2500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22182\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22183, "epsg", 22183,
-        "POSGAR 94 / Argentina 3", 0, 1,
-        "WGS 84", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1994", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-66 +k=1 +x_0=3500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 94 / Argentina 3\",GEOGCS[\"POSGAR 94\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6694");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"4694\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 8,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",-66],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",3500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22183\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22184, "epsg", 22184,
-        "POSGAR 94 / Argentina 4", 0, 1,
-        "WGS 84", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1994", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-63 +k=1 +x_0=4500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 94 / Argentina 4\",GEOGCS[\"POSGAR 94\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6694");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"4694\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 8,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",-63],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",4500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22184\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22185, "epsg", 22185,
-        "POSGAR 94 / Argentina 5", 0, 1,
-        "WGS 84", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1994", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-60 +k=1 +x_0=5500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 94 / Argentina 5\",GEOGCS[\"POSGAR 94\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6694");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"4694\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 8,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",-60],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",5500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22185\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22186, "epsg", 22186,
-        "POSGAR 94 / Argentina 6", 0, 1,
-        "WGS 84", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1994", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-57 +k=1 +x_0=6500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 94 / Argentina 6\",GEOGCS[\"POSGAR 94\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6694");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"4694\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 8,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",-57],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",6500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22186\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22187, "epsg", 22187,
-        "POSGAR 94 / Argentina 7", 0, 1,
-        "WGS 84", "Greenwich",
-        "Posiciones_Geodesicas_Argentinas_1994", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-54 +k=1 +x_0=7500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 94 / Argentina 7\",GEOGCS[\"POSGAR 94\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],TOWGS84[0,0,0,0,0,0,0],AUTHORITY[\"EPSG\",\"6694");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 7,
-        "AST],AUTHORITY[\"EPSG\",\"4694\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 8,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",-54],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",1],PARAMETER[\"false_easting\",7500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22187\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22191, "epsg", 22191,
-        "Campo Inchauspe / Argentina 1", 0, 1,
-        "International 1924", "Greenwich",
-        "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / Argentina 1\",GEOGCS[\"Campo ");
-    add_srs_wkt (p, 1,
-        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "TOWGS84[-148,136,90,0,0,0,0],AUTHORITY[\"EPSG\",\"6221\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4221\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"central_meridian\",-72],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",1500000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"22191\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22192, "epsg", 22192,
-        "Campo Inchauspe / Argentina 2", 0, 1,
-        "International 1924", "Greenwich",
-        "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / Argentina 2\",GEOGCS[\"Campo ");
-    add_srs_wkt (p, 1,
-        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "TOWGS84[-148,136,90,0,0,0,0],AUTHORITY[\"EPSG\",\"6221\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4221\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"central_meridian\",-69],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",2500000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"22192\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22193, "epsg", 22193,
-        "Campo Inchauspe / Argentina 3", 0, 1,
-        "International 1924", "Greenwich",
-        "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-66 +k=1 +x_0=3500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / Argentina 3\",GEOGCS[\"Campo ");
-    add_srs_wkt (p, 1,
-        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "TOWGS84[-148,136,90,0,0,0,0],AUTHORITY[\"EPSG\",\"6221\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4221\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"central_meridian\",-66],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",3500000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"22193\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22194, "epsg", 22194,
-        "Campo Inchauspe / Argentina 4", 0, 1,
-        "International 1924", "Greenwich",
-        "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-63 +k=1 +x_0=4500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / Argentina 4\",GEOGCS[\"Campo ");
-    add_srs_wkt (p, 1,
-        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "TOWGS84[-148,136,90,0,0,0,0],AUTHORITY[\"EPSG\",\"6221\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4221\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"central_meridian\",-63],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",4500000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"22194\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22195, "epsg", 22195,
-        "Campo Inchauspe / Argentina 5", 0, 1,
-        "International 1924", "Greenwich",
-        "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-60 +k=1 +x_0=5500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / Argentina 5\",GEOGCS[\"Campo ");
-    add_srs_wkt (p, 1,
-        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "TOWGS84[-148,136,90,0,0,0,0],AUTHORITY[\"EPSG\",\"6221\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4221\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"central_meridian\",-60],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",5500000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"22195\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22196, "epsg", 22196,
-        "Campo Inchauspe / Argentina 6", 0, 1,
-        "International 1924", "Greenwich",
-        "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-57 +k=1 +x_0=6500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / Argentina 6\",GEOGCS[\"Campo ");
-    add_srs_wkt (p, 1,
-        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "TOWGS84[-148,136,90,0,0,0,0],AUTHORITY[\"EPSG\",\"6221\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4221\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"central_meridian\",-57],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",6500000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"22196\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22197, "epsg", 22197,
-        "Campo Inchauspe / Argentina 7", 0, 1,
-        "International 1924", "Greenwich",
-        "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-54 +k=1 +x_0=7500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / Argentina 7\",GEOGCS[\"Campo ");
-    add_srs_wkt (p, 1,
-        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "TOWGS84[-148,136,90,0,0,0,0],AUTHORITY[\"EPSG\",\"6221\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4221\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 8,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",-90],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"central_meridian\",-54],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1],PARAMETER[\"false_easting\",7500000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"22197\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22234, "epsg", 22234,
-        "Cape / UTM zone 34S", 0, 0,
-        "Clarke 1880 (Arc)", "Greenwich",
-        "Cape", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=34 +south +a=6378249.145 +b=6356514.9663");
-    add_proj4text (p, 1,
-        "98753 +towgs84=-136,-108,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / UTM zone 34S\",GEOGCS[\"Cape\",DATUM[\"C");
-    add_srs_wkt (p, 1,
-        "ape\",SPHEROID[\"Clarke 1880 (Arc)\",6378249.145,293.466");
-    add_srs_wkt (p, 2,
-        "3077,AUTHORITY[\"EPSG\",\"7013\"]],TOWGS84[-136,-108,-29");
-    add_srs_wkt (p, 3,
-        "2,0,0,0,0],AUTHORITY[\"EPSG\",\"6222\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 6,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"4222\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",21],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",500000],PARAMETER[\"false_northing\",100");
-    add_srs_wkt (p, 11,
-        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22234\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22235, "epsg", 22235,
-        "Cape / UTM zone 35S", 0, 0,
-        "Clarke 1880 (Arc)", "Greenwich",
-        "Cape", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=35 +south +a=6378249.145 +b=6356514.9663");
-    add_proj4text (p, 1,
-        "98753 +towgs84=-136,-108,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / UTM zone 35S\",GEOGCS[\"Cape\",DATUM[\"C");
-    add_srs_wkt (p, 1,
-        "ape\",SPHEROID[\"Clarke 1880 (Arc)\",6378249.145,293.466");
-    add_srs_wkt (p, 2,
-        "3077,AUTHORITY[\"EPSG\",\"7013\"]],TOWGS84[-136,-108,-29");
-    add_srs_wkt (p, 3,
-        "2,0,0,0,0],AUTHORITY[\"EPSG\",\"6222\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 6,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"4222\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",27],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",500000],PARAMETER[\"false_northing\",100");
-    add_srs_wkt (p, 11,
-        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"22235\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22236, "epsg", 22236,
-        "Cape / UTM zone 36S (deprecated)", 0, 0,
-        "Clarke 1880 (Arc)", "Greenwich",
-        "Cape", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=36 +south +a=6378249.145 +b=6356514.9663");
-    add_proj4text (p, 1,
-        "98753 +towgs84=-136,-108,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / UTM zone 36S (deprecated)\",GEOGCS[\"Cap");
-    add_srs_wkt (p, 1,
-        "e\",DATUM[\"Cape\",SPHEROID[\"Clarke 1880 (Arc)\",637824");
-    add_srs_wkt (p, 2,
-        "9.145,293.4663077,AUTHORITY[\"EPSG\",\"7013\"]],TOWGS84[");
-    add_srs_wkt (p, 3,
-        "-136,-108,-292,0,0,0,0],AUTHORITY[\"EPSG\",\"6222\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 8,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 9,
-        "entral_meridian\",33],PARAMETER[\"scale_factor\",0.9996]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"22236\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22275, "epsg", 22275,
-        "Cape / Lo15", 0, 0,
-        "Clarke 1880 (Arc)", "Greenwich",
-        "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo15\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],TOWGS84[-136,-108,-292,0,0,0,");
-    add_srs_wkt (p, 3,
-        "0],AUTHORITY[\"EPSG\",\"6222\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 7,
-        "22\"]],PROJECTION[\"Transverse_Mercator_South_Orientated");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",15],PARAMETER[\"scale_factor\",1],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Y\"");
-    add_srs_wkt (p, 12,
-        ",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG\",\"22275\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22277, "epsg", 22277,
-        "Cape / Lo17", 0, 0,
-        "Clarke 1880 (Arc)", "Greenwich",
-        "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=17 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo17\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],TOWGS84[-136,-108,-292,0,0,0,");
-    add_srs_wkt (p, 3,
-        "0],AUTHORITY[\"EPSG\",\"6222\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 7,
-        "22\"]],PROJECTION[\"Transverse_Mercator_South_Orientated");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",17],PARAMETER[\"scale_factor\",1],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Y\"");
-    add_srs_wkt (p, 12,
-        ",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG\",\"22277\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22279, "epsg", 22279,
-        "Cape / Lo19", 0, 0,
-        "Clarke 1880 (Arc)", "Greenwich",
-        "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=19 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo19\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],TOWGS84[-136,-108,-292,0,0,0,");
-    add_srs_wkt (p, 3,
-        "0],AUTHORITY[\"EPSG\",\"6222\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 7,
-        "22\"]],PROJECTION[\"Transverse_Mercator_South_Orientated");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",19],PARAMETER[\"scale_factor\",1],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Y\"");
-    add_srs_wkt (p, 12,
-        ",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG\",\"22279\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22281, "epsg", 22281,
-        "Cape / Lo21", 0, 0,
-        "Clarke 1880 (Arc)", "Greenwich",
-        "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo21\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],TOWGS84[-136,-108,-292,0,0,0,");
-    add_srs_wkt (p, 3,
-        "0],AUTHORITY[\"EPSG\",\"6222\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 7,
-        "22\"]],PROJECTION[\"Transverse_Mercator_South_Orientated");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",21],PARAMETER[\"scale_factor\",1],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Y\"");
-    add_srs_wkt (p, 12,
-        ",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG\",\"22281\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22283, "epsg", 22283,
-        "Cape / Lo23", 0, 0,
-        "Clarke 1880 (Arc)", "Greenwich",
-        "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=23 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo23\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],TOWGS84[-136,-108,-292,0,0,0,");
-    add_srs_wkt (p, 3,
-        "0],AUTHORITY[\"EPSG\",\"6222\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 7,
-        "22\"]],PROJECTION[\"Transverse_Mercator_South_Orientated");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",23],PARAMETER[\"scale_factor\",1],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Y\"");
-    add_srs_wkt (p, 12,
-        ",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG\",\"22283\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22285, "epsg", 22285,
-        "Cape / Lo25", 0, 0,
-        "Clarke 1880 (Arc)", "Greenwich",
-        "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=25 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo25\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],TOWGS84[-136,-108,-292,0,0,0,");
-    add_srs_wkt (p, 3,
-        "0],AUTHORITY[\"EPSG\",\"6222\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 7,
-        "22\"]],PROJECTION[\"Transverse_Mercator_South_Orientated");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",25],PARAMETER[\"scale_factor\",1],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Y\"");
-    add_srs_wkt (p, 12,
-        ",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG\",\"22285\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22287, "epsg", 22287,
-        "Cape / Lo27", 0, 0,
-        "Clarke 1880 (Arc)", "Greenwich",
-        "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo27\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],TOWGS84[-136,-108,-292,0,0,0,");
-    add_srs_wkt (p, 3,
-        "0],AUTHORITY[\"EPSG\",\"6222\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 7,
-        "22\"]],PROJECTION[\"Transverse_Mercator_South_Orientated");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",27],PARAMETER[\"scale_factor\",1],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Y\"");
-    add_srs_wkt (p, 12,
-        ",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG\",\"22287\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22289, "epsg", 22289,
-        "Cape / Lo29", 0, 0,
-        "Clarke 1880 (Arc)", "Greenwich",
-        "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=29 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo29\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],TOWGS84[-136,-108,-292,0,0,0,");
-    add_srs_wkt (p, 3,
-        "0],AUTHORITY[\"EPSG\",\"6222\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 7,
-        "22\"]],PROJECTION[\"Transverse_Mercator_South_Orientated");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",29],PARAMETER[\"scale_factor\",1],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Y\"");
-    add_srs_wkt (p, 12,
-        ",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG\",\"22289\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22291, "epsg", 22291,
-        "Cape / Lo31", 0, 0,
-        "Clarke 1880 (Arc)", "Greenwich",
-        "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=31 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo31\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],TOWGS84[-136,-108,-292,0,0,0,");
-    add_srs_wkt (p, 3,
-        "0],AUTHORITY[\"EPSG\",\"6222\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 7,
-        "22\"]],PROJECTION[\"Transverse_Mercator_South_Orientated");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",31],PARAMETER[\"scale_factor\",1],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Y\"");
-    add_srs_wkt (p, 12,
-        ",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG\",\"22291\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22293, "epsg", 22293,
-        "Cape / Lo33", 0, 0,
-        "Clarke 1880 (Arc)", "Greenwich",
-        "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Y", "West", "X", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo33\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],TOWGS84[-136,-108,-292,0,0,0,");
-    add_srs_wkt (p, 3,
-        "0],AUTHORITY[\"EPSG\",\"6222\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 7,
-        "22\"]],PROJECTION[\"Transverse_Mercator_South_Orientated");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 9,
-        "ral_meridian\",33],PARAMETER[\"scale_factor\",1],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Y\"");
-    add_srs_wkt (p, 12,
-        ",WEST],AXIS[\"X\",SOUTH],AUTHORITY[\"EPSG\",\"22293\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22332, "epsg", 22332,
-        "Carthage / UTM zone 32N", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Carthage", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +a=6378249.2 +b=6356515 +towgs84=-263");
-    add_proj4text (p, 1,
-        ",6,431,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Carthage / UTM zone 32N\",GEOGCS[\"Carthage\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Carthage\",SPHEROID[\"Clarke 1880 (IGN)\",6378249");
-    add_srs_wkt (p, 2,
-        ".2,293.4660212936269,AUTHORITY[\"EPSG\",\"7011\"]],TOWGS");
-    add_srs_wkt (p, 3,
-        "84[-263,6,431,0,0,0,0],AUTHORITY[\"EPSG\",\"6223\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4223\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 8,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 9,
-        "ntral_meridian\",9],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"22332\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22391, "epsg", 22391,
-        "Carthage / Nord Tunisie", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Carthage", "Lambert_Conformal_Conic_1SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36 +lat_0=36 +lon_0=9.9 +k_0=0.99962554");
-    add_proj4text (p, 1,
-        "4 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +towgs");
-    add_proj4text (p, 2,
-        "84=-263,6,431,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Carthage / Nord Tunisie\",GEOGCS[\"Carthage\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Carthage\",SPHEROID[\"Clarke 1880 (IGN)\",6378249");
-    add_srs_wkt (p, 2,
-        ".2,293.4660212936269,AUTHORITY[\"EPSG\",\"7011\"]],TOWGS");
-    add_srs_wkt (p, 3,
-        "84[-263,6,431,0,0,0,0],AUTHORITY[\"EPSG\",\"6223\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4223\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",36],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"central_meridian\",9.9],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",0.999625544],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_northing\",300000],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"22391\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22392, "epsg", 22392,
-        "Carthage / Sud Tunisie", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Carthage", "Lambert_Conformal_Conic_1SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.3 +lat_0=33.3 +lon_0=9.9 +k_0=0.9996");
-    add_proj4text (p, 1,
-        "25769 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +t");
-    add_proj4text (p, 2,
-        "owgs84=-263,6,431,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Carthage / Sud Tunisie\",GEOGCS[\"Carthage\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Carthage\",SPHEROID[\"Clarke 1880 (IGN)\",6378249.");
-    add_srs_wkt (p, 2,
-        "2,293.4660212936269,AUTHORITY[\"EPSG\",\"7011\"]],TOWGS8");
-    add_srs_wkt (p, 3,
-        "4[-263,6,431,0,0,0,0],AUTHORITY[\"EPSG\",\"6223\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 7,
-        "ORITY[\"EPSG\",\"4223\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 8,
-        "_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",33.3],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"central_meridian\",9.9],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 10,
-        "r\",0.999625769],PARAMETER[\"false_easting\",500000],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_northing\",300000],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"22392\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22521, "epsg", 22521,
-        "Corrego Alegre 1970-72 / UTM zone 21S", 0, 0,
-        "International 1924", "Greenwich",
-        "Corrego_Alegre_1970_72", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +south +ellps=intl +towgs84=-205.57,1");
-    add_proj4text (p, 1,
-        "68.77,-4.12,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 21S\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970_7");
-    add_srs_wkt (p, 2,
-        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7022\"]],TOWGS84[-205.57,168.77,-4.12,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0],AUTHORITY[\"EPSG\",\"6225\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 6,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 8,
-        "25\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 9,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",-5");
-    add_srs_wkt (p, 10,
-        "7],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",500000],PARAMETER[\"false_northing\",10000000]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"22521\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22522, "epsg", 22522,
-        "Corrego Alegre 1970-72 / UTM zone 22S", 0, 0,
-        "International 1924", "Greenwich",
-        "Corrego_Alegre_1970_72", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +south +ellps=intl +towgs84=-205.57,1");
-    add_proj4text (p, 1,
-        "68.77,-4.12,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 22S\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970_7");
-    add_srs_wkt (p, 2,
-        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7022\"]],TOWGS84[-205.57,168.77,-4.12,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0],AUTHORITY[\"EPSG\",\"6225\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 6,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 8,
-        "25\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 9,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",-5");
-    add_srs_wkt (p, 10,
-        "1],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",500000],PARAMETER[\"false_northing\",10000000]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"22522\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22523, "epsg", 22523,
-        "Corrego Alegre 1970-72 / UTM zone 23S", 0, 0,
-        "International 1924", "Greenwich",
-        "Corrego_Alegre_1970_72", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=23 +south +ellps=intl +towgs84=-205.57,1");
-    add_proj4text (p, 1,
-        "68.77,-4.12,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 23S\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970_7");
-    add_srs_wkt (p, 2,
-        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7022\"]],TOWGS84[-205.57,168.77,-4.12,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0],AUTHORITY[\"EPSG\",\"6225\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 6,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 8,
-        "25\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 9,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",-4");
-    add_srs_wkt (p, 10,
-        "5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",500000],PARAMETER[\"false_northing\",10000000]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"22523\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22524, "epsg", 22524,
-        "Corrego Alegre 1970-72 / UTM zone 24S", 0, 0,
-        "International 1924", "Greenwich",
-        "Corrego_Alegre_1970_72", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=24 +south +ellps=intl +towgs84=-205.57,1");
-    add_proj4text (p, 1,
-        "68.77,-4.12,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 24S\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970_7");
-    add_srs_wkt (p, 2,
-        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7022\"]],TOWGS84[-205.57,168.77,-4.12,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0],AUTHORITY[\"EPSG\",\"6225\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 6,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 8,
-        "25\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 9,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",-3");
-    add_srs_wkt (p, 10,
-        "9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",500000],PARAMETER[\"false_northing\",10000000]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"22524\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22525, "epsg", 22525,
-        "Corrego Alegre 1970-72 / UTM zone 25S", 0, 0,
-        "International 1924", "Greenwich",
-        "Corrego_Alegre_1970_72", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=25 +south +ellps=intl +towgs84=-205.57,1");
-    add_proj4text (p, 1,
-        "68.77,-4.12,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 25S\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970_7");
-    add_srs_wkt (p, 2,
-        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7022\"]],TOWGS84[-205.57,168.77,-4.12,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0],AUTHORITY[\"EPSG\",\"6225\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 6,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 8,
-        "25\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 9,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",-3");
-    add_srs_wkt (p, 10,
-        "3],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",500000],PARAMETER[\"false_northing\",10000000]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"22525\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22700, "epsg", 22700,
-        "Deir ez Zor / Levant Zone", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Deir_ez_Zor", "Lambert_Conformal_Conic_1SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.65 +lat_0=34.65 +lon_0=37.35 +k_0=0.");
-    add_proj4text (p, 1,
-        "9996256 +x_0=300000 +y_0=300000 +a=6378249.2 +b=6356515 ");
-    add_proj4text (p, 2,
-        "+towgs84=-190.421,8.532,238.69,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Deir ez Zor / Levant Zone\",GEOGCS[\"Deir ez Zo");
-    add_srs_wkt (p, 1,
-        "r\",DATUM[\"Deir_ez_Zor\",SPHEROID[\"Clarke 1880 (IGN)\"");
-    add_srs_wkt (p, 2,
-        ",6378249.2,293.4660212936269,AUTHORITY[\"EPSG\",\"7011\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[-190.421,8.532,238.69,0,0,0,0],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"6227\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4227\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 9,
-        "_origin\",34.65],PARAMETER[\"central_meridian\",37.35],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",0.9996256],PARAMETER[\"false_e");
-    add_srs_wkt (p, 11,
-        "asting\",300000],PARAMETER[\"false_northing\",300000],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"22700\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22770, "epsg", 22770,
-        "Deir ez Zor / Syria Lambert", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Deir_ez_Zor", "Lambert_Conformal_Conic_1SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.65 +lat_0=34.65 +lon_0=37.35 +k_0=0.");
-    add_proj4text (p, 1,
-        "9996256 +x_0=300000 +y_0=300000 +a=6378249.2 +b=6356515 ");
-    add_proj4text (p, 2,
-        "+towgs84=-190.421,8.532,238.69,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Deir ez Zor / Syria Lambert\",GEOGCS[\"Deir ez ");
-    add_srs_wkt (p, 1,
-        "Zor\",DATUM[\"Deir_ez_Zor\",SPHEROID[\"Clarke 1880 (IGN)");
-    add_srs_wkt (p, 2,
-        "\",6378249.2,293.4660212936269,AUTHORITY[\"EPSG\",\"7011");
-    add_srs_wkt (p, 3,
-        "\"]],TOWGS84[-190.421,8.532,238.69,0,0,0,0],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6227\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4227\"]],PROJECTI");
-    add_srs_wkt (p, 8,
-        "ON[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 9,
-        "_of_origin\",34.65],PARAMETER[\"central_meridian\",37.35");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"scale_factor\",0.9996256],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",300000],PARAMETER[\"false_northing\",300000]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X");
-    add_srs_wkt (p, 13,
-        "\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"22770\"]");
-    add_srs_wkt (p, 14,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 22780, "epsg", 22780,
-        "Deir ez Zor / Levant Stereographic", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Deir_ez_Zor", "Oblique_Stereographic", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=34.2 +lon_0=39.15 +k=0.9995341 +x_0=");
-    add_proj4text (p, 1,
-        "0 +y_0=0 +a=6378249.2 +b=6356515 +towgs84=-190.421,8.532");
-    add_proj4text (p, 2,
-        ",238.69,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Deir ez Zor / Levant Stereographic\",GEOGCS[\"D");
-    add_srs_wkt (p, 1,
-        "eir ez Zor\",DATUM[\"Deir_ez_Zor\",SPHEROID[\"Clarke 188");
-    add_srs_wkt (p, 2,
-        "0 (IGN)\",6378249.2,293.4660212936269,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7011\"]],TOWGS84[-190.421,8.532,238.69,0,0,0,0],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6227\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4227\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Oblique_Stereographic\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",34.2],PARAMETER[\"central_meridian\",39.15");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"scale_factor\",0.9995341],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 12,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"22780\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22832, "epsg", 22832,
-        "Douala / UTM zone 32N (deprecated)", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Douala", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +a=6378249.2 +b=6356515 +units=m +no_");
-    add_proj4text (p, 1,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Douala / UTM zone 32N (deprecated)\",GEOGCS[\"D");
-    add_srs_wkt (p, 1,
-        "ouala\",DATUM[\"Douala\",SPHEROID[\"Clarke 1880 (IGN)\",");
-    add_srs_wkt (p, 2,
-        "6378249.2,293.4660212936269,AUTHORITY[\"EPSG\",\"7011\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6228\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9108\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 6,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"422");
-    add_srs_wkt (p, 7,
-        "8\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",9],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 11,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 12,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"22832");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22991, "epsg", 22991,
-        "Egypt 1907 / Blue Belt", 0, 0,
-        "Helmert 1906", "Greenwich",
-        "Egypt_1907", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=35 +k=1 +x_0=300000 +y_0=11");
-    add_proj4text (p, 1,
-        "00000 +ellps=helmert +towgs84=-130,110,-13,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Egypt 1907 / Blue Belt\",GEOGCS[\"Egypt 1907\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Egypt_1907\",SPHEROID[\"Helmert 1906\",6378200,2");
-    add_srs_wkt (p, 2,
-        "98.3,AUTHORITY[\"EPSG\",\"7020\"]],TOWGS84[-130,110,-13,");
-    add_srs_wkt (p, 3,
-        "0,0,0,0],AUTHORITY[\"EPSG\",\"6229\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati");
-    add_srs_wkt (p, 6,
-        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4229\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"latitude_of_origin\",30],PARAMETER[\"central_meridia");
-    add_srs_wkt (p, 9,
-        "n\",35],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",300000],PARAMETER[\"false_northing\",1100000],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 12,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"22991\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22992, "epsg", 22992,
-        "Egypt 1907 / Red Belt", 0, 0,
-        "Helmert 1906", "Greenwich",
-        "Egypt_1907", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=31 +k=1 +x_0=615000 +y_0=81");
-    add_proj4text (p, 1,
-        "0000 +ellps=helmert +towgs84=-130,110,-13,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Egypt 1907 / Red Belt\",GEOGCS[\"Egypt 1907\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Egypt_1907\",SPHEROID[\"Helmert 1906\",6378200,29");
-    add_srs_wkt (p, 2,
-        "8.3,AUTHORITY[\"EPSG\",\"7020\"]],TOWGS84[-130,110,-13,0");
-    add_srs_wkt (p, 3,
-        ",0,0,0],AUTHORITY[\"EPSG\",\"6229\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 6,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4229\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"latitude_of_origin\",30],PARAMETER[\"central_meridia");
-    add_srs_wkt (p, 9,
-        "n\",31],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",615000],PARAMETER[\"false_northing\",810000],U");
-    add_srs_wkt (p, 11,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 12,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"22992\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22993, "epsg", 22993,
-        "Egypt 1907 / Purple Belt", 0, 0,
-        "Helmert 1906", "Greenwich",
-        "Egypt_1907", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=27 +k=1 +x_0=700000 +y_0=20");
-    add_proj4text (p, 1,
-        "0000 +ellps=helmert +towgs84=-130,110,-13,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Egypt 1907 / Purple Belt\",GEOGCS[\"Egypt 1907\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Egypt_1907\",SPHEROID[\"Helmert 1906\",6378200,");
-    add_srs_wkt (p, 2,
-        "298.3,AUTHORITY[\"EPSG\",\"7020\"]],TOWGS84[-130,110,-13");
-    add_srs_wkt (p, 3,
-        ",0,0,0,0],AUTHORITY[\"EPSG\",\"6229\"]],PRIMEM[\"Greenwi");
-    add_srs_wkt (p, 4,
-        "ch\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0");
-    add_srs_wkt (p, 5,
-        "174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lat");
-    add_srs_wkt (p, 6,
-        "itude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 7,
-        "\",\"4229\"]],PROJECTION[\"Transverse_Mercator\"],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"latitude_of_origin\",30],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",27],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_easting\",700000],PARAMETER[\"false_northing\",200000]");
-    add_srs_wkt (p, 11,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 12,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"22993\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22994, "epsg", 22994,
-        "Egypt 1907 / Extended Purple Belt", 0, 0,
-        "Helmert 1906", "Greenwich",
-        "Egypt_1907", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=27 +k=1 +x_0=700000 +y_0=12");
-    add_proj4text (p, 1,
-        "00000 +ellps=helmert +towgs84=-130,110,-13,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Egypt 1907 / Extended Purple Belt\",GEOGCS[\"Eg");
-    add_srs_wkt (p, 1,
-        "ypt 1907\",DATUM[\"Egypt_1907\",SPHEROID[\"Helmert 1906\"");
-    add_srs_wkt (p, 2,
-        ",6378200,298.3,AUTHORITY[\"EPSG\",\"7020\"]],TOWGS84[-13");
-    add_srs_wkt (p, 3,
-        "0,110,-13,0,0,0,0],AUTHORITY[\"EPSG\",\"6229\"]],PRIMEM[");
-    add_srs_wkt (p, 4,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 7,
-        "TY[\"EPSG\",\"4229\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"latitude_of_origin\",30],PARAMETER[\"centr");
-    add_srs_wkt (p, 9,
-        "al_meridian\",27],PARAMETER[\"scale_factor\",1],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_easting\",700000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",1200000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"22994\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23028, "epsg", 23028,
-        "ED50 / UTM zone 28N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 28N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-");
-    add_srs_wkt (p, 3,
-        "121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4230\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-15],PARAMETER[\"scale_factor\",0.9996],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_easting\",500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"23028\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23029, "epsg", 23029,
-        "ED50 / UTM zone 29N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 29N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-");
-    add_srs_wkt (p, 3,
-        "121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4230\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-9],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"23029\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23030, "epsg", 23030,
-        "ED50 / UTM zone 30N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=30 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 30N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-");
-    add_srs_wkt (p, 3,
-        "121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4230\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-3],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"23030\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23031, "epsg", 23031,
-        "ED50 / UTM zone 31N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=31 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 31N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-");
-    add_srs_wkt (p, 3,
-        "121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4230\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",3],PARAMETER[\"scale_factor\",0.9996],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"23031\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23032, "epsg", 23032,
-        "ED50 / UTM zone 32N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 32N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-");
-    add_srs_wkt (p, 3,
-        "121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4230\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"23032\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23033, "epsg", 23033,
-        "ED50 / UTM zone 33N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 33N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-");
-    add_srs_wkt (p, 3,
-        "121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4230\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",15],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"23033\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23034, "epsg", 23034,
-        "ED50 / UTM zone 34N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=34 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 34N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-");
-    add_srs_wkt (p, 3,
-        "121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4230\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",21],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"23034\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23035, "epsg", 23035,
-        "ED50 / UTM zone 35N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=35 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 35N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-");
-    add_srs_wkt (p, 3,
-        "121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4230\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",27],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"23035\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23036, "epsg", 23036,
-        "ED50 / UTM zone 36N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=36 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 36N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-");
-    add_srs_wkt (p, 3,
-        "121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4230\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",33],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"23036\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23037, "epsg", 23037,
-        "ED50 / UTM zone 37N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=37 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 37N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-");
-    add_srs_wkt (p, 3,
-        "121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4230\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",39],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"23037\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23038, "epsg", 23038,
-        "ED50 / UTM zone 38N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 38N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-");
-    add_srs_wkt (p, 3,
-        "121,0,0,0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4230\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",45],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"23038\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23090, "epsg", 23090,
-        "ED50 / TM 0 N", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=0 +k=0.9996 +x_0=500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM 0 N\",GEOGCS[\"ED50\",DATUM[\"Europea");
-    add_srs_wkt (p, 1,
-        "n_Datum_1950\",SPHEROID[\"International 1924\",6378388,2");
-    add_srs_wkt (p, 2,
-        "97,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-121,0,");
-    add_srs_wkt (p, 3,
-        "0,0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 6,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",0");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"230");
-    add_srs_wkt (p, 13,
-        "90\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23095, "epsg", 23095,
-        "ED50 / TM 5 NE", 0, 0,
-        "International 1924", "Greenwich",
-        "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=5 +k=0.9996 +x_0=500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM 5 NE\",GEOGCS[\"ED50\",DATUM[\"Europe");
-    add_srs_wkt (p, 1,
-        "an_Datum_1950\",SPHEROID[\"International 1924\",6378388,");
-    add_srs_wkt (p, 2,
-        "297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-87,-98,-121,0");
-    add_srs_wkt (p, 3,
-        ",0,0,0],AUTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 6,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "23095\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23239, "epsg", 23239,
-        "Fahud / UTM zone 39N", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Fahud", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=39 +ellps=clrk80 +towgs84=-346,-1,224,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Fahud / UTM zone 39N\",GEOGCS[\"Fahud\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Fahud\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.4");
-    add_srs_wkt (p, 2,
-        "65,AUTHORITY[\"EPSG\",\"7012\"]],TOWGS84[-346,-1,224,0,0");
-    add_srs_wkt (p, 3,
-        ",0,0],AUTHORITY[\"EPSG\",\"6232\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 6,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4232\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",5");
-    add_srs_wkt (p, 9,
-        "1],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"232");
-    add_srs_wkt (p, 13,
-        "39\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23240, "epsg", 23240,
-        "Fahud / UTM zone 40N", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Fahud", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=40 +ellps=clrk80 +towgs84=-346,-1,224,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Fahud / UTM zone 40N\",GEOGCS[\"Fahud\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Fahud\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.4");
-    add_srs_wkt (p, 2,
-        "65,AUTHORITY[\"EPSG\",\"7012\"]],TOWGS84[-346,-1,224,0,0");
-    add_srs_wkt (p, 3,
-        ",0,0],AUTHORITY[\"EPSG\",\"6232\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 6,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4232\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",5");
-    add_srs_wkt (p, 9,
-        "7],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"232");
-    add_srs_wkt (p, 13,
-        "40\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23433, "epsg", 23433,
-        "Garoua / UTM zone 33N (deprecated)", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Garoua", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +a=6378249.2 +b=6356515 +units=m +no_");
-    add_proj4text (p, 1,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Garoua / UTM zone 33N (deprecated)\",GEOGCS[\"G");
-    add_srs_wkt (p, 1,
-        "aroua\",DATUM[\"Garoua\",SPHEROID[\"Clarke 1880 (IGN)\",");
-    add_srs_wkt (p, 2,
-        "6378249.2,293.4660212936269,AUTHORITY[\"EPSG\",\"7011\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6234\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9108\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 6,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"423");
-    add_srs_wkt (p, 7,
-        "4\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",15]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2343");
-    add_srs_wkt (p, 13,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23700, "epsg", 23700,
-        "HD72 / EOV", 0, 0,
-        "GRS 1967", "Greenwich",
-        "Hungarian_Datum_1972", "Hotine_Oblique_Mercator_Azimuth_Center", "metre",
-        "Y", "East", "X", "North");
-    add_proj4text (p, 0,
-        "+proj=somerc +lat_0=47.14439372222222 +lon_0=19.04857177");
-    add_proj4text (p, 1,
-        "777778 +k_0=0.99993 +x_0=650000 +y_0=200000 +ellps=GRS67");
-    add_proj4text (p, 2,
-        " +towgs84=52.17,-71.82,-14.9,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"HD72 / EOV\",GEOGCS[\"HD72\",DATUM[\"Hungarian_");
-    add_srs_wkt (p, 1,
-        "Datum_1972\",SPHEROID[\"GRS 1967\",6378160,298.247167427");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7036\"]],TOWGS84[52.17,-71.82,-14.");
-    add_srs_wkt (p, 3,
-        "9,0,0,0,0],AUTHORITY[\"EPSG\",\"6237\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 6,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"4237\"]],PROJECTION[\"Hotine_Oblique_Mercator_Azim");
-    add_srs_wkt (p, 8,
-        "uth_Center\"],PARAMETER[\"latitude_of_center\",47.144393");
-    add_srs_wkt (p, 9,
-        "72222222],PARAMETER[\"longitude_of_center\",19.048571777");
-    add_srs_wkt (p, 10,
-        "77778],PARAMETER[\"azimuth\",90],PARAMETER[\"rectified_g");
-    add_srs_wkt (p, 11,
-        "rid_angle\",90],PARAMETER[\"scale_factor\",0.99993],PARA");
-    add_srs_wkt (p, 12,
-        "METER[\"false_easting\",650000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 13,
-        "ng\",200000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 14,
-        "]],AXIS[\"Y\",EAST],AXIS[\"X\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 15,
-        ",\"23700\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
@@ -1,4015 +0,0 @@
-/*
-
- helper function for srs_init.c -- populating the SPATIAL_REF_SYS table
-
- this code was autogenerated by "auto_epsg_ext" on Wed May 27 18:50:23 2015
-
- Author: Sandro Furieri a.furieri@lqt.it
-
- -----------------------------------------------------------------------------
-
- Version: MPL 1.1/GPL 2.0/LGPL 2.1
-
- The contents of this file are subject to the Mozilla Public License Version
- 1.1 (the "License"); you may not use this file except in compliance with
- the License. You may obtain a copy of the License at
- http://www.mozilla.org/MPL/
-
-Software distributed under the License is distributed on an "AS IS" basis,
-WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
-for the specific language governing rights and limitations under the
-License.
-
-The Original Code is the SpatiaLite library
-
-The Initial Developer of the Original Code is Alessandro Furieri
-
-Portions created by the Initial Developer are Copyright (C) 2008
-the Initial Developer. All Rights Reserved.
-
-Contributor(s):
-
-Alternatively, the contents of this file may be used under the terms of
-either the GNU General Public License Version 2 or later (the "GPL"), or
-the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
-in which case the provisions of the GPL or the LGPL are applicable instead
-of those above. If you wish to allow use of your version of this file only
-under the terms of either the GPL or the LGPL, and not to allow others to
-use your version of this file under the terms of the MPL, indicate your
-decision by deleting the provisions above and replace them with the notice
-and other provisions required by the GPL or the LGPL. If you do not delete
-the provisions above, a recipient may use your version of this file under
-the terms of any one of the MPL, the GPL or the LGPL.
-
-*/
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "config-msvc.h"
-#else
-#include "config.h"
-#endif
-
-#include <spatialite_private.h>
-
-#ifndef OMIT_EPSG    /* full EPSG initialization enabled */
-
-SPATIALITE_PRIVATE void
-initialize_epsg_42 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 30492, "epsg", 30492,
-        "Voirol 1875 / Sud Algerie (ancienne)", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Voirol_1875", "Lambert_Conformal_Conic_1SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.3 +lat_0=33.3 +lon_0=2.7 +k_0=0.9996");
-    add_proj4text (p, 1,
-        "25769 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +t");
-    add_proj4text (p, 2,
-        "owgs84=-73,-247,227,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Voirol 1875 / Sud Algerie (ancienne)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Voirol 1875\",DATUM[\"Voirol_1875\",SPHEROID[\"Clarke 18");
-    add_srs_wkt (p, 2,
-        "80 (IGN)\",6378249.2,293.4660212936269,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7011\"]],TOWGS84[-73,-247,227,0,0,0,0],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"6304\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4304\"]],PROJECTION[");
-    add_srs_wkt (p, 8,
-        "\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 9,
-        "_origin\",33.3],PARAMETER[\"central_meridian\",2.7],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"scale_factor\",0.999625769],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",300000],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"30492\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30493, "epsg", 30493,
-        "Voirol 1879 / Nord Algerie (ancienne)", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Voirol_1879", "Lambert_Conformal_Conic_1SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36 +lat_0=36 +lon_0=2.7 +k_0=0.99962554");
-    add_proj4text (p, 1,
-        "4 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Voirol 1879 / Nord Algerie (ancienne)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Voirol 1879\",DATUM[\"Voirol_1879\",SPHEROID[\"Clarke ");
-    add_srs_wkt (p, 2,
-        "1880 (IGN)\",6378249.2,293.4660212936269,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7011\"]],AUTHORITY[\"EPSG\",\"6671\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4671\"]],PROJECTION[\"Lambert_Conformal_Conic_1S");
-    add_srs_wkt (p, 8,
-        "P\"],PARAMETER[\"latitude_of_origin\",36],PARAMETER[\"ce");
-    add_srs_wkt (p, 9,
-        "ntral_meridian\",2.7],PARAMETER[\"scale_factor\",0.99962");
-    add_srs_wkt (p, 10,
-        "5544],PARAMETER[\"false_easting\",500000],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_northing\",300000],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"30493\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30494, "epsg", 30494,
-        "Voirol 1879 / Sud Algerie (ancienne)", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Voirol_1879", "Lambert_Conformal_Conic_1SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.3 +lat_0=33.3 +lon_0=2.7 +k_0=0.9996");
-    add_proj4text (p, 1,
-        "25769 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Voirol 1879 / Sud Algerie (ancienne)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Voirol 1879\",DATUM[\"Voirol_1879\",SPHEROID[\"Clarke 18");
-    add_srs_wkt (p, 2,
-        "80 (IGN)\",6378249.2,293.4660212936269,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7011\"]],AUTHORITY[\"EPSG\",\"6671\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4671\"]],PROJECTION[\"Lambert_Conformal_Conic_1SP");
-    add_srs_wkt (p, 8,
-        "\"],PARAMETER[\"latitude_of_origin\",33.3],PARAMETER[\"c");
-    add_srs_wkt (p, 9,
-        "entral_meridian\",2.7],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 10,
-        "25769],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",300000],UNIT[\"metre\",1,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"30494\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30729, "epsg", 30729,
-        "Nord Sahara 1959 / UTM zone 29N", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Nord_Sahara_1959", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +ellps=clrk80 +towgs84=-209.3622,-87.");
-    add_proj4text (p, 1,
-        "8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Nord Sahara 1959 / UTM zone 29N\",GEOGCS[\"Nord");
-    add_srs_wkt (p, 1,
-        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7012\"]],TOWGS84[-209.3622,-87.8162,404.6198,0.0046,3.");
-    add_srs_wkt (p, 4,
-        "4784,0.5805,-1.4547],AUTHORITY[\"EPSG\",\"6307\"]],PRIME");
-    add_srs_wkt (p, 5,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 6,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 8,
-        "RITY[\"EPSG\",\"4307\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 9,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 10,
-        "tral_meridian\",-9],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 14,
-        "ITY[\"EPSG\",\"30729\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30730, "epsg", 30730,
-        "Nord Sahara 1959 / UTM zone 30N", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Nord_Sahara_1959", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=30 +ellps=clrk80 +towgs84=-209.3622,-87.");
-    add_proj4text (p, 1,
-        "8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Nord Sahara 1959 / UTM zone 30N\",GEOGCS[\"Nord");
-    add_srs_wkt (p, 1,
-        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7012\"]],TOWGS84[-209.3622,-87.8162,404.6198,0.0046,3.");
-    add_srs_wkt (p, 4,
-        "4784,0.5805,-1.4547],AUTHORITY[\"EPSG\",\"6307\"]],PRIME");
-    add_srs_wkt (p, 5,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 6,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 8,
-        "RITY[\"EPSG\",\"4307\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 9,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 10,
-        "tral_meridian\",-3],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 14,
-        "ITY[\"EPSG\",\"30730\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30731, "epsg", 30731,
-        "Nord Sahara 1959 / UTM zone 31N", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Nord_Sahara_1959", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=31 +ellps=clrk80 +towgs84=-209.3622,-87.");
-    add_proj4text (p, 1,
-        "8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Nord Sahara 1959 / UTM zone 31N\",GEOGCS[\"Nord");
-    add_srs_wkt (p, 1,
-        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7012\"]],TOWGS84[-209.3622,-87.8162,404.6198,0.0046,3.");
-    add_srs_wkt (p, 4,
-        "4784,0.5805,-1.4547],AUTHORITY[\"EPSG\",\"6307\"]],PRIME");
-    add_srs_wkt (p, 5,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 6,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 8,
-        "RITY[\"EPSG\",\"4307\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 9,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 10,
-        "tral_meridian\",3],PARAMETER[\"scale_factor\",0.9996],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 12,
-        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 14,
-        "TY[\"EPSG\",\"30731\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30732, "epsg", 30732,
-        "Nord Sahara 1959 / UTM zone 32N", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Nord_Sahara_1959", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +ellps=clrk80 +towgs84=-209.3622,-87.");
-    add_proj4text (p, 1,
-        "8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Nord Sahara 1959 / UTM zone 32N\",GEOGCS[\"Nord");
-    add_srs_wkt (p, 1,
-        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7012\"]],TOWGS84[-209.3622,-87.8162,404.6198,0.0046,3.");
-    add_srs_wkt (p, 4,
-        "4784,0.5805,-1.4547],AUTHORITY[\"EPSG\",\"6307\"]],PRIME");
-    add_srs_wkt (p, 5,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 6,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 8,
-        "RITY[\"EPSG\",\"4307\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 9,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 10,
-        "tral_meridian\",9],PARAMETER[\"scale_factor\",0.9996],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 12,
-        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 14,
-        "TY[\"EPSG\",\"30732\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30791, "epsg", 30791,
-        "Nord Sahara 1959 / Nord Algerie", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Nord_Sahara_1959", "Lambert_Conformal_Conic_1SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36 +lat_0=36 +lon_0=2.7 +k_0=0.99962554");
-    add_proj4text (p, 1,
-        "4 +x_0=500135 +y_0=300090 +ellps=clrk80 +towgs84=-209.36");
-    add_proj4text (p, 2,
-        "22,-87.8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units");
-    add_proj4text (p, 3,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Nord Sahara 1959 / Nord Algerie\",GEOGCS[\"Nord");
-    add_srs_wkt (p, 1,
-        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7012\"]],TOWGS84[-209.3622,-87.8162,404.6198,0.0046,3.");
-    add_srs_wkt (p, 4,
-        "4784,0.5805,-1.4547],AUTHORITY[\"EPSG\",\"6307\"]],PRIME");
-    add_srs_wkt (p, 5,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 6,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 8,
-        "RITY[\"EPSG\",\"4307\"]],PROJECTION[\"Lambert_Conformal_");
-    add_srs_wkt (p, 9,
-        "Conic_1SP\"],PARAMETER[\"latitude_of_origin\",36],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"central_meridian\",2.7],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 11,
-        ",0.999625544],PARAMETER[\"false_easting\",500135],PARAME");
-    add_srs_wkt (p, 12,
-        "TER[\"false_northing\",300090],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"30791\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30792, "epsg", 30792,
-        "Nord Sahara 1959 / Sud Algerie", 0, 0,
-        "Clarke 1880 (RGS)", "Greenwich",
-        "Nord_Sahara_1959", "Lambert_Conformal_Conic_1SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.3 +lat_0=33.3 +lon_0=2.7 +k_0=0.9996");
-    add_proj4text (p, 1,
-        "25769 +x_0=500135 +y_0=300090 +ellps=clrk80 +towgs84=-20");
-    add_proj4text (p, 2,
-        "9.3622,-87.8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +u");
-    add_proj4text (p, 3,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Nord Sahara 1959 / Sud Algerie\",GEOGCS[\"Nord ");
-    add_srs_wkt (p, 1,
-        "Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 2,
-        "ke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7012\"]],TOWGS84[-209.3622,-87.8162,404.6198,0.0046,3.47");
-    add_srs_wkt (p, 4,
-        "84,0.5805,-1.4547],AUTHORITY[\"EPSG\",\"6307\"]],PRIMEM[");
-    add_srs_wkt (p, 5,
-        "\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"deg");
-    add_srs_wkt (p, 6,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 7,
-        "XIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORI");
-    add_srs_wkt (p, 8,
-        "TY[\"EPSG\",\"4307\"]],PROJECTION[\"Lambert_Conformal_Co");
-    add_srs_wkt (p, 9,
-        "nic_1SP\"],PARAMETER[\"latitude_of_origin\",33.3],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"central_meridian\",2.7],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 11,
-        ",0.999625769],PARAMETER[\"false_easting\",500135],PARAME");
-    add_srs_wkt (p, 12,
-        "TER[\"false_northing\",300090],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"30792\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30800, "epsg", 30800,
-        "RT38 2.5 gon W (deprecated)", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Stockholm_1938", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15.80827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT38 2.5 gon W (deprecated)\",GEOGCS[\"RT38\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Stockholm_1938\",SPHEROID[\"Bessel 1841\",6377397");
-    add_srs_wkt (p, 2,
-        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6308\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4308\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",0],PARAMETER[\"central_meridian\",15.80827777777");
-    add_srs_wkt (p, 9,
-        "778],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",1500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"30800\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31028, "epsg", 31028,
-        "Yoff / UTM zone 28N", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Yoff", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +a=6378249.2 +b=6356515 +units=m +no_");
-    add_proj4text (p, 1,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Yoff / UTM zone 28N\",GEOGCS[\"Yoff\",DATUM[\"Y");
-    add_srs_wkt (p, 1,
-        "off\",SPHEROID[\"Clarke 1880 (IGN)\",6378249.2,293.46602");
-    add_srs_wkt (p, 2,
-        "12936269,AUTHORITY[\"EPSG\",\"7011\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6310\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 6,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4310\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-15],PARAMETER[\"scale_");
-    add_srs_wkt (p, 9,
-        "factor\",0.9996],PARAMETER[\"false_easting\",500000],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 12,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"31028\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31121, "epsg", 31121,
-        "Zanderij / UTM zone 21N", 0, 0,
-        "International 1924", "Greenwich",
-        "Zanderij", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=intl +towgs84=-265,120,-358,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Zanderij / UTM zone 21N\",GEOGCS[\"Zanderij\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Zanderij\",SPHEROID[\"International 1924\",637838");
-    add_srs_wkt (p, 2,
-        "8,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-265,120,-35");
-    add_srs_wkt (p, 3,
-        "8,0,0,0,0],AUTHORITY[\"EPSG\",\"6311\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 6,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"4311\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-57],PARAMETER[\"scale_factor\",0.9996],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"31121\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31154, "epsg", 31154,
-        "Zanderij / TM 54 NW", 0, 0,
-        "International 1924", "Greenwich",
-        "Zanderij", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-54 +k=0.9996 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=intl +towgs84=-265,120,-358,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Zanderij / TM 54 NW\",GEOGCS[\"Zanderij\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Zanderij\",SPHEROID[\"International 1924\",6378388,29");
-    add_srs_wkt (p, 2,
-        "7,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-265,120,-358,0,");
-    add_srs_wkt (p, 3,
-        "0,0,0],AUTHORITY[\"EPSG\",\"6311\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 6,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4311\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "54],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false");
-    add_srs_wkt (p, 10,
-        "_easting\",500000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "1154\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31170, "epsg", 31170,
-        "Zanderij / Suriname Old TM", 0, 0,
-        "International 1924", "Greenwich",
-        "Zanderij", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-55.68333333333333 +k=0.9996");
-    add_proj4text (p, 1,
-        " +x_0=500000 +y_0=0 +ellps=intl +towgs84=-265,120,-358,0");
-    add_proj4text (p, 2,
-        ",0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Zanderij / Suriname Old TM\",GEOGCS[\"Zanderij\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Zanderij\",SPHEROID[\"International 1924\",6378");
-    add_srs_wkt (p, 2,
-        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-265,120,-");
-    add_srs_wkt (p, 3,
-        "358,0,0,0,0],AUTHORITY[\"EPSG\",\"6311\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 4,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 5,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"4311\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-55.68333333333333],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 10,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"31170\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31171, "epsg", 31171,
-        "Zanderij / Suriname TM", 0, 0,
-        "International 1924", "Greenwich",
-        "Zanderij", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-55.68333333333333 +k=0.9999");
-    add_proj4text (p, 1,
-        " +x_0=500000 +y_0=0 +ellps=intl +towgs84=-265,120,-358,0");
-    add_proj4text (p, 2,
-        ",0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Zanderij / Suriname TM\",GEOGCS[\"Zanderij\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Zanderij\",SPHEROID[\"International 1924\",6378388");
-    add_srs_wkt (p, 2,
-        ",297,AUTHORITY[\"EPSG\",\"7022\"]],TOWGS84[-265,120,-358");
-    add_srs_wkt (p, 3,
-        ",0,0,0,0],AUTHORITY[\"EPSG\",\"6311\"]],PRIMEM[\"Greenwi");
-    add_srs_wkt (p, 4,
-        "ch\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0");
-    add_srs_wkt (p, 5,
-        "174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lat");
-    add_srs_wkt (p, 6,
-        "itude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 7,
-        "\",\"4311\"]],PROJECTION[\"Transverse_Mercator\"],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"latitude_of_origin\",0],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 9,
-        "an\",-55.68333333333333],PARAMETER[\"scale_factor\",0.99");
-    add_srs_wkt (p, 10,
-        "99],PARAMETER[\"false_easting\",500000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "01\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"31171\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31251, "epsg", 31251,
-        "MGI (Ferro) / Austria GK West Zone", 0, 1,
-        "Bessel 1841", "Ferro",
-        "Militar_Geographische_Institut_Ferro", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=28 +k=1 +x_0=0 +y_0=-5000000");
-    add_proj4text (p, 1,
-        " +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +pm=ferro +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI (Ferro) / Austria GK West Zone\",GEOGCS[\"M");
-    add_srs_wkt (p, 1,
-        "GI (Ferro)\",DATUM[\"Militar_Geographische_Institut_Ferr");
-    add_srs_wkt (p, 2,
-        "o\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7004\"]],TOWGS84[682,-203,480,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6805\"]],PRIMEM[\"Ferro\",-17.6666");
-    add_srs_wkt (p, 5,
-        "6666666667,AUTHORITY[\"EPSG\",\"8909\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 6,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 8,
-        "PSG\",\"4805\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 10,
-        "idian\",28],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",0],PARAMETER[\"false_northing\",-5000000],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31251\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31252, "epsg", 31252,
-        "MGI (Ferro) / Austria GK Central Zone", 0, 1,
-        "Bessel 1841", "Ferro",
-        "Militar_Geographische_Institut_Ferro", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=31 +k=1 +x_0=0 +y_0=-5000000");
-    add_proj4text (p, 1,
-        " +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +pm=ferro +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI (Ferro) / Austria GK Central Zone\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"MGI (Ferro)\",DATUM[\"Militar_Geographische_Institut_F");
-    add_srs_wkt (p, 2,
-        "erro\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[682,-203,480,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0],AUTHORITY[\"EPSG\",\"6805\"]],PRIMEM[\"Ferro\",-17.6");
-    add_srs_wkt (p, 5,
-        "6666666666667,AUTHORITY[\"EPSG\",\"8909\"]],UNIT[\"degre");
-    add_srs_wkt (p, 6,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 7,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 8,
-        "[\"EPSG\",\"4805\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 10,
-        "_meridian\",31],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",0],PARAMETER[\"false_northing\",-50000");
-    add_srs_wkt (p, 12,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31252");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31253, "epsg", 31253,
-        "MGI (Ferro) / Austria GK East Zone", 0, 1,
-        "Bessel 1841", "Ferro",
-        "Militar_Geographische_Institut_Ferro", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=34 +k=1 +x_0=0 +y_0=-5000000");
-    add_proj4text (p, 1,
-        " +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +pm=ferro +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI (Ferro) / Austria GK East Zone\",GEOGCS[\"M");
-    add_srs_wkt (p, 1,
-        "GI (Ferro)\",DATUM[\"Militar_Geographische_Institut_Ferr");
-    add_srs_wkt (p, 2,
-        "o\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7004\"]],TOWGS84[682,-203,480,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6805\"]],PRIMEM[\"Ferro\",-17.6666");
-    add_srs_wkt (p, 5,
-        "6666666667,AUTHORITY[\"EPSG\",\"8909\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 6,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 8,
-        "PSG\",\"4805\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 10,
-        "idian\",34],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",0],PARAMETER[\"false_northing\",-5000000],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31253\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31254, "epsg", 31254,
-        "MGI / Austria GK West", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=10.33333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "0 +y_0=-5000000 +ellps=bessel +towgs84=577.326,90.129,46");
-    add_proj4text (p, 2,
-        "3.919,5.137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Austria GK West\",GEOGCS[\"MGI\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Militar_Geographische_Institute\",SPHEROID[\"Bessel 1841");
-    add_srs_wkt (p, 2,
-        "\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[577.326,90.129,463.919,5.137,1.474,5.297,2.4232");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"431");
-    add_srs_wkt (p, 8,
-        "2\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 9,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",10.");
-    add_srs_wkt (p, 10,
-        "33333333333333],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",0],PARAMETER[\"false_northing\",-50000");
-    add_srs_wkt (p, 12,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31254");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31255, "epsg", 31255,
-        "MGI / Austria GK Central", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13.33333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "0 +y_0=-5000000 +ellps=bessel +towgs84=577.326,90.129,46");
-    add_proj4text (p, 2,
-        "3.919,5.137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Austria GK Central\",GEOGCS[\"MGI\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Militar_Geographische_Institute\",SPHEROID[\"Bessel 1");
-    add_srs_wkt (p, 2,
-        "841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"");
-    add_srs_wkt (p, 3,
-        "]],TOWGS84[577.326,90.129,463.919,5.137,1.474,5.297,2.42");
-    add_srs_wkt (p, 4,
-        "32],AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 6,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"43");
-    add_srs_wkt (p, 8,
-        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 9,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",13");
-    add_srs_wkt (p, 10,
-        ".33333333333333],PARAMETER[\"scale_factor\",1],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",0],PARAMETER[\"false_northing\",-5000");
-    add_srs_wkt (p, 12,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"3125");
-    add_srs_wkt (p, 14,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31256, "epsg", 31256,
-        "MGI / Austria GK East", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=16.33333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "0 +y_0=-5000000 +ellps=bessel +towgs84=577.326,90.129,46");
-    add_proj4text (p, 2,
-        "3.919,5.137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Austria GK East\",GEOGCS[\"MGI\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Militar_Geographische_Institute\",SPHEROID[\"Bessel 1841");
-    add_srs_wkt (p, 2,
-        "\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[577.326,90.129,463.919,5.137,1.474,5.297,2.4232");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"431");
-    add_srs_wkt (p, 8,
-        "2\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 9,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",16.");
-    add_srs_wkt (p, 10,
-        "33333333333333],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",0],PARAMETER[\"false_northing\",-50000");
-    add_srs_wkt (p, 12,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31256");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31257, "epsg", 31257,
-        "MGI / Austria GK M28", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=10.33333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "150000 +y_0=-5000000 +ellps=bessel +towgs84=577.326,90.1");
-    add_proj4text (p, 2,
-        "29,463.919,5.137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Austria GK M28\",GEOGCS[\"MGI\",DATUM[\"M");
-    add_srs_wkt (p, 1,
-        "ilitar_Geographische_Institute\",SPHEROID[\"Bessel 1841\"");
-    add_srs_wkt (p, 2,
-        ",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[577.326,90.129,463.919,5.137,1.474,5.297,2.4232],");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 6,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 7,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4312\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",10.333");
-    add_srs_wkt (p, 10,
-        "33333333333],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",150000],PARAMETER[\"false_northing\",-500");
-    add_srs_wkt (p, 12,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"312");
-    add_srs_wkt (p, 14,
-        "57\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31258, "epsg", 31258,
-        "MGI / Austria GK M31", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13.33333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "450000 +y_0=-5000000 +ellps=bessel +towgs84=577.326,90.1");
-    add_proj4text (p, 2,
-        "29,463.919,5.137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Austria GK M31\",GEOGCS[\"MGI\",DATUM[\"M");
-    add_srs_wkt (p, 1,
-        "ilitar_Geographische_Institute\",SPHEROID[\"Bessel 1841\"");
-    add_srs_wkt (p, 2,
-        ",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[577.326,90.129,463.919,5.137,1.474,5.297,2.4232],");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 6,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 7,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4312\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",13.333");
-    add_srs_wkt (p, 10,
-        "33333333333],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",450000],PARAMETER[\"false_northing\",-500");
-    add_srs_wkt (p, 12,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"312");
-    add_srs_wkt (p, 14,
-        "58\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31259, "epsg", 31259,
-        "MGI / Austria GK M34", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=16.33333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "750000 +y_0=-5000000 +ellps=bessel +towgs84=577.326,90.1");
-    add_proj4text (p, 2,
-        "29,463.919,5.137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Austria GK M34\",GEOGCS[\"MGI\",DATUM[\"M");
-    add_srs_wkt (p, 1,
-        "ilitar_Geographische_Institute\",SPHEROID[\"Bessel 1841\"");
-    add_srs_wkt (p, 2,
-        ",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],T");
-    add_srs_wkt (p, 3,
-        "OWGS84[577.326,90.129,463.919,5.137,1.474,5.297,2.4232],");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 6,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NO");
-    add_srs_wkt (p, 7,
-        "RTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4312\"");
-    add_srs_wkt (p, 8,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",16.333");
-    add_srs_wkt (p, 10,
-        "33333333333],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",750000],PARAMETER[\"false_northing\",-500");
-    add_srs_wkt (p, 12,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"312");
-    add_srs_wkt (p, 14,
-        "59\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31265, "epsg", 31265,
-        "MGI / 3-degree Gauss zone 5 (deprecated)", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=5500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=577.326,90.129,463.919,5.137,1.47");
-    add_proj4text (p, 2,
-        "4,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / 3-degree Gauss zone 5 (deprecated)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"MGI\",DATUM[\"Militar_Geographische_Institute\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7004\"]],TOWGS84[577.326,90.129,463.919,5.137");
-    add_srs_wkt (p, 4,
-        ",1.474,5.297,2.4232],AUTHORITY[\"EPSG\",\"6312\"]],PRIME");
-    add_srs_wkt (p, 5,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 6,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 8,
-        "RITY[\"EPSG\",\"4312\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 9,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 10,
-        "tral_meridian\",15],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",5500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31");
-    add_srs_wkt (p, 14,
-        "265\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31266, "epsg", 31266,
-        "MGI / 3-degree Gauss zone 6 (deprecated)", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=6500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=577.326,90.129,463.919,5.137,1.47");
-    add_proj4text (p, 2,
-        "4,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / 3-degree Gauss zone 6 (deprecated)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"MGI\",DATUM[\"Militar_Geographische_Institute\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7004\"]],TOWGS84[577.326,90.129,463.919,5.137");
-    add_srs_wkt (p, 4,
-        ",1.474,5.297,2.4232],AUTHORITY[\"EPSG\",\"6312\"]],PRIME");
-    add_srs_wkt (p, 5,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 6,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 8,
-        "RITY[\"EPSG\",\"4312\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 9,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 10,
-        "tral_meridian\",18],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",6500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31");
-    add_srs_wkt (p, 14,
-        "266\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31267, "epsg", 31267,
-        "MGI / 3-degree Gauss zone 7 (deprecated)", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=7500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=577.326,90.129,463.919,5.137,1.47");
-    add_proj4text (p, 2,
-        "4,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / 3-degree Gauss zone 7 (deprecated)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"MGI\",DATUM[\"Militar_Geographische_Institute\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7004\"]],TOWGS84[577.326,90.129,463.919,5.137");
-    add_srs_wkt (p, 4,
-        ",1.474,5.297,2.4232],AUTHORITY[\"EPSG\",\"6312\"]],PRIME");
-    add_srs_wkt (p, 5,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 6,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 8,
-        "RITY[\"EPSG\",\"4312\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 9,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 10,
-        "tral_meridian\",21],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",7500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31");
-    add_srs_wkt (p, 14,
-        "267\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31268, "epsg", 31268,
-        "MGI / 3-degree Gauss zone 8 (deprecated)", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=8500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=577.326,90.129,463.919,5.137,1.47");
-    add_proj4text (p, 2,
-        "4,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / 3-degree Gauss zone 8 (deprecated)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"MGI\",DATUM[\"Militar_Geographische_Institute\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7004\"]],TOWGS84[577.326,90.129,463.919,5.137");
-    add_srs_wkt (p, 4,
-        ",1.474,5.297,2.4232],AUTHORITY[\"EPSG\",\"6312\"]],PRIME");
-    add_srs_wkt (p, 5,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 6,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 8,
-        "RITY[\"EPSG\",\"4312\"]],PROJECTION[\"Transverse_Mercato");
-    add_srs_wkt (p, 9,
-        "r\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cen");
-    add_srs_wkt (p, 10,
-        "tral_meridian\",24],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",8500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31");
-    add_srs_wkt (p, 14,
-        "268\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31275, "epsg", 31275,
-        "MGI / Balkans zone 5 (deprecated)", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9999 +x_0=5500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=bessel +towgs84=577.326,90.129,463.919,5.137");
-    add_proj4text (p, 2,
-        ",1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Balkans zone 5 (deprecated)\",GEOGCS[\"MG");
-    add_srs_wkt (p, 1,
-        "I\",DATUM[\"Militar_Geographische_Institute\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7004\"]],TOWGS84[577.326,90.129,463.919,5.137,1.474,5");
-    add_srs_wkt (p, 4,
-        ".297,2.4232],AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 5,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 6,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 8,
-        "PSG\",\"4312\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 10,
-        "idian\",15],PARAMETER[\"scale_factor\",0.9999],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",5500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31275");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31276, "epsg", 31276,
-        "MGI / Balkans zone 6 (deprecated)", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=0.9999 +x_0=6500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=bessel +towgs84=577.326,90.129,463.919,5.137");
-    add_proj4text (p, 2,
-        ",1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Balkans zone 6 (deprecated)\",GEOGCS[\"MG");
-    add_srs_wkt (p, 1,
-        "I\",DATUM[\"Militar_Geographische_Institute\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7004\"]],TOWGS84[577.326,90.129,463.919,5.137,1.474,5");
-    add_srs_wkt (p, 4,
-        ".297,2.4232],AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 5,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 6,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 8,
-        "PSG\",\"4312\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 10,
-        "idian\",18],PARAMETER[\"scale_factor\",0.9999],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",6500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31276");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31277, "epsg", 31277,
-        "MGI / Balkans zone 7 (deprecated)", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=0.9999 +x_0=7500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=bessel +towgs84=577.326,90.129,463.919,5.137");
-    add_proj4text (p, 2,
-        ",1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Balkans zone 7 (deprecated)\",GEOGCS[\"MG");
-    add_srs_wkt (p, 1,
-        "I\",DATUM[\"Militar_Geographische_Institute\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7004\"]],TOWGS84[577.326,90.129,463.919,5.137,1.474,5");
-    add_srs_wkt (p, 4,
-        ".297,2.4232],AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 5,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 6,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 8,
-        "PSG\",\"4312\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 10,
-        "idian\",21],PARAMETER[\"scale_factor\",0.9999],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",7500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31277");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31278, "epsg", 31278,
-        "MGI / Balkans zone 8 (deprecated)", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=0.9999 +x_0=7500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=bessel +towgs84=577.326,90.129,463.919,5.137");
-    add_proj4text (p, 2,
-        ",1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Balkans zone 8 (deprecated)\",GEOGCS[\"MG");
-    add_srs_wkt (p, 1,
-        "I\",DATUM[\"Militar_Geographische_Institute\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7004\"]],TOWGS84[577.326,90.129,463.919,5.137,1.474,5");
-    add_srs_wkt (p, 4,
-        ".297,2.4232],AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 5,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 6,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 8,
-        "PSG\",\"4312\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 10,
-        "idian\",21],PARAMETER[\"scale_factor\",0.9999],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",7500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31278");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31279, "epsg", 31279,
-        "MGI / Balkans zone 8 (deprecated)", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9999 +x_0=8500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=bessel +towgs84=577.326,90.129,463.919,5.137");
-    add_proj4text (p, 2,
-        ",1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Balkans zone 8 (deprecated)\",GEOGCS[\"MG");
-    add_srs_wkt (p, 1,
-        "I\",DATUM[\"Militar_Geographische_Institute\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7004\"]],TOWGS84[577.326,90.129,463.919,5.137,1.474,5");
-    add_srs_wkt (p, 4,
-        ".297,2.4232],AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Gree");
-    add_srs_wkt (p, 5,
-        "nwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",");
-    add_srs_wkt (p, 6,
-        "0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 8,
-        "PSG\",\"4312\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 10,
-        "idian\",24],PARAMETER[\"scale_factor\",0.9999],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",8500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31279");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31281, "epsg", 31281,
-        "MGI (Ferro) / Austria West Zone", 0, 1,
-        "Bessel 1841", "Ferro",
-        "Militar_Geographische_Institut_Ferro", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=28 +k=1 +x_0=0 +y_0=0 +ellps");
-    add_proj4text (p, 1,
-        "=bessel +towgs84=682,-203,480,0,0,0,0 +pm=ferro +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI (Ferro) / Austria West Zone\",GEOGCS[\"MGI ");
-    add_srs_wkt (p, 1,
-        "(Ferro)\",DATUM[\"Militar_Geographische_Institut_Ferro\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7004\"]],TOWGS84[682,-203,480,0,0,0,0],AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"6805\"]],PRIMEM[\"Ferro\",-17.6666666");
-    add_srs_wkt (p, 5,
-        "6666667,AUTHORITY[\"EPSG\",\"8909\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 6,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 7,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 8,
-        "G\",\"4805\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 10,
-        "ian\",28],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 12,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31281\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31282, "epsg", 31282,
-        "MGI (Ferro) / Austria Central Zone", 0, 1,
-        "Bessel 1841", "Ferro",
-        "Militar_Geographische_Institut_Ferro", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=31 +k=1 +x_0=0 +y_0=0 +ellps");
-    add_proj4text (p, 1,
-        "=bessel +towgs84=682,-203,480,0,0,0,0 +pm=ferro +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI (Ferro) / Austria Central Zone\",GEOGCS[\"M");
-    add_srs_wkt (p, 1,
-        "GI (Ferro)\",DATUM[\"Militar_Geographische_Institut_Ferr");
-    add_srs_wkt (p, 2,
-        "o\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7004\"]],TOWGS84[682,-203,480,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6805\"]],PRIMEM[\"Ferro\",-17.6666");
-    add_srs_wkt (p, 5,
-        "6666666667,AUTHORITY[\"EPSG\",\"8909\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 6,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 8,
-        "PSG\",\"4805\"]],PROJECTION[\"Transverse_Mercator\"],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"latitude_of_origin\",0],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 10,
-        "idian\",31],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31282\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31283, "epsg", 31283,
-        "MGI (Ferro) / Austria East Zone", 0, 1,
-        "Bessel 1841", "Ferro",
-        "Militar_Geographische_Institut_Ferro", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=34 +k=1 +x_0=0 +y_0=0 +ellps");
-    add_proj4text (p, 1,
-        "=bessel +towgs84=682,-203,480,0,0,0,0 +pm=ferro +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI (Ferro) / Austria East Zone\",GEOGCS[\"MGI ");
-    add_srs_wkt (p, 1,
-        "(Ferro)\",DATUM[\"Militar_Geographische_Institut_Ferro\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7004\"]],TOWGS84[682,-203,480,0,0,0,0],AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"6805\"]],PRIMEM[\"Ferro\",-17.6666666");
-    add_srs_wkt (p, 5,
-        "6666667,AUTHORITY[\"EPSG\",\"8909\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 6,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 7,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 8,
-        "G\",\"4805\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 10,
-        "ian\",34],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 12,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31283\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31284, "epsg", 31284,
-        "MGI / Austria M28", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=10.33333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "150000 +y_0=0 +ellps=bessel +towgs84=577.326,90.129,463.");
-    add_proj4text (p, 2,
-        "919,5.137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Austria M28\",GEOGCS[\"MGI\",DATUM[\"Mili");
-    add_srs_wkt (p, 1,
-        "tar_Geographische_Institute\",SPHEROID[\"Bessel 1841\",6");
-    add_srs_wkt (p, 2,
-        "377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[577.326,90.129,463.919,5.137,1.474,5.297,2.4232],AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 5,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 6,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORT");
-    add_srs_wkt (p, 7,
-        "H],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4312\"]");
-    add_srs_wkt (p, 8,
-        "],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 9,
-        "de_of_origin\",0],PARAMETER[\"central_meridian\",10.3333");
-    add_srs_wkt (p, 10,
-        "3333333333],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",150000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31284\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31285, "epsg", 31285,
-        "MGI / Austria M31", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13.33333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "450000 +y_0=0 +ellps=bessel +towgs84=577.326,90.129,463.");
-    add_proj4text (p, 2,
-        "919,5.137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Austria M31\",GEOGCS[\"MGI\",DATUM[\"Mili");
-    add_srs_wkt (p, 1,
-        "tar_Geographische_Institute\",SPHEROID[\"Bessel 1841\",6");
-    add_srs_wkt (p, 2,
-        "377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[577.326,90.129,463.919,5.137,1.474,5.297,2.4232],AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 5,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 6,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORT");
-    add_srs_wkt (p, 7,
-        "H],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4312\"]");
-    add_srs_wkt (p, 8,
-        "],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 9,
-        "de_of_origin\",0],PARAMETER[\"central_meridian\",13.3333");
-    add_srs_wkt (p, 10,
-        "3333333333],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",450000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31285\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31286, "epsg", 31286,
-        "MGI / Austria M34", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=16.33333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "750000 +y_0=0 +ellps=bessel +towgs84=577.326,90.129,463.");
-    add_proj4text (p, 2,
-        "919,5.137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Austria M34\",GEOGCS[\"MGI\",DATUM[\"Mili");
-    add_srs_wkt (p, 1,
-        "tar_Geographische_Institute\",SPHEROID[\"Bessel 1841\",6");
-    add_srs_wkt (p, 2,
-        "377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOW");
-    add_srs_wkt (p, 3,
-        "GS84[577.326,90.129,463.919,5.137,1.474,5.297,2.4232],AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 5,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 6,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORT");
-    add_srs_wkt (p, 7,
-        "H],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4312\"]");
-    add_srs_wkt (p, 8,
-        "],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 9,
-        "de_of_origin\",0],PARAMETER[\"central_meridian\",16.3333");
-    add_srs_wkt (p, 10,
-        "3333333333],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",750000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31286\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31287, "epsg", 31287,
-        "MGI / Austria Lambert", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=46 +lat_0=47.5 +lon_0=13.3333");
-    add_proj4text (p, 1,
-        "3333333333 +x_0=400000 +y_0=400000 +ellps=bessel +towgs8");
-    add_proj4text (p, 2,
-        "4=577.326,90.129,463.919,5.137,1.474,5.297,2.4232 +units");
-    add_proj4text (p, 3,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Austria Lambert\",GEOGCS[\"MGI\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Militar_Geographische_Institute\",SPHEROID[\"Bessel 1841");
-    add_srs_wkt (p, 2,
-        "\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[577.326,90.129,463.919,5.137,1.474,5.297,2.4232");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"431");
-    add_srs_wkt (p, 8,
-        "2\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_1\",49],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 10,
-        "allel_2\",46],PARAMETER[\"latitude_of_origin\",47.5],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"central_meridian\",13.33333333333333],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_easting\",400000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 13,
-        "400000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 14,
-        "XIS[\"X\",NORTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 15,
-        "1287\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31288, "epsg", 31288,
-        "MGI (Ferro) / M28", 0, 1,
-        "Bessel 1841", "Ferro",
-        "Militar_Geographische_Institut_Ferro", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=28 +k=1 +x_0=150000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=bessel +towgs84=682,-203,480,0,0,0,0 +pm=ferro +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI (Ferro) / M28\",GEOGCS[\"MGI (Ferro)\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Militar_Geographische_Institut_Ferro\",SPHEROID[\"Be");
-    add_srs_wkt (p, 2,
-        "ssel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7004\"]],TOWGS84[682,-203,480,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6805\"]],PRIMEM[\"Ferro\",-17.66666666666667,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8909\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4805\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",28],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",1500");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"31288\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31289, "epsg", 31289,
-        "MGI (Ferro) / M31", 0, 1,
-        "Bessel 1841", "Ferro",
-        "Militar_Geographische_Institut_Ferro", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=31 +k=1 +x_0=450000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=bessel +towgs84=682,-203,480,0,0,0,0 +pm=ferro +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI (Ferro) / M31\",GEOGCS[\"MGI (Ferro)\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Militar_Geographische_Institut_Ferro\",SPHEROID[\"Be");
-    add_srs_wkt (p, 2,
-        "ssel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7004\"]],TOWGS84[682,-203,480,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6805\"]],PRIMEM[\"Ferro\",-17.66666666666667,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8909\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4805\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",31],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",4500");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"31289\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31290, "epsg", 31290,
-        "MGI (Ferro) / M34", 0, 1,
-        "Bessel 1841", "Ferro",
-        "Militar_Geographische_Institut_Ferro", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=34 +k=1 +x_0=750000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=bessel +towgs84=682,-203,480,0,0,0,0 +pm=ferro +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI (Ferro) / M34\",GEOGCS[\"MGI (Ferro)\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Militar_Geographische_Institut_Ferro\",SPHEROID[\"Be");
-    add_srs_wkt (p, 2,
-        "ssel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7004\"]],TOWGS84[682,-203,480,0,0,0,0],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6805\"]],PRIMEM[\"Ferro\",-17.66666666666667,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8909\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4805\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 9,
-        "of_origin\",0],PARAMETER[\"central_meridian\",34],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",7500");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AXIS[\"Y\",");
-    add_srs_wkt (p, 13,
-        "EAST],AUTHORITY[\"EPSG\",\"31290\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31291, "epsg", 31291,
-        "MGI (Ferro) / Austria West Zone (deprecated)", 0, 0,
-        "Bessel 1841", "Ferro",
-        "Militar_Geographische_Institut_Ferro", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=28 +k=1 +x_0=0 +y_0=0 +ellps");
-    add_proj4text (p, 1,
-        "=bessel +towgs84=682,-203,480,0,0,0,0 +pm=ferro +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI (Ferro) / Austria West Zone (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"MGI (Ferro)\",DATUM[\"Militar_Geographische_Ins");
-    add_srs_wkt (p, 2,
-        "titut_Ferro\",SPHEROID[\"Bessel 1841\",6377397.155,299.1");
-    add_srs_wkt (p, 3,
-        "528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[682,-203,48");
-    add_srs_wkt (p, 4,
-        "0,0,0,0,0],AUTHORITY[\"EPSG\",\"6805\"]],PRIMEM[\"Ferro\"");
-    add_srs_wkt (p, 5,
-        ",-17.66666666666667,AUTHORITY[\"EPSG\",\"8909\"]],UNIT[\"");
-    add_srs_wkt (p, 6,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 8,
-        "ORITY[\"EPSG\",\"4805\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 9,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 10,
-        "ntral_meridian\",28],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_easting\",0],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 12,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31291\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 31292, "epsg", 31292,
-        "MGI (Ferro) / Austria Central Zone (deprecated)", 0, 0,
-        "Bessel 1841", "Ferro",
-        "Militar_Geographische_Institut_Ferro", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=31 +k=1 +x_0=0 +y_0=0 +ellps");
-    add_proj4text (p, 1,
-        "=bessel +towgs84=682,-203,480,0,0,0,0 +pm=ferro +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI (Ferro) / Austria Central Zone (deprecated)");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"MGI (Ferro)\",DATUM[\"Militar_Geographische_");
-    add_srs_wkt (p, 2,
-        "Institut_Ferro\",SPHEROID[\"Bessel 1841\",6377397.155,29");
-    add_srs_wkt (p, 3,
-        "9.1528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[682,-203");
-    add_srs_wkt (p, 4,
-        ",480,0,0,0,0],AUTHORITY[\"EPSG\",\"6805\"]],PRIMEM[\"Fer");
-    add_srs_wkt (p, 5,
-        "ro\",-17.66666666666667,AUTHORITY[\"EPSG\",\"8909\"]],UN");
-    add_srs_wkt (p, 6,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 7,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 8,
-        ",AUTHORITY[\"EPSG\",\"4805\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 9,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"central_meridian\",31],PARAMETER[\"scale_factor\",1],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31");
-    add_srs_wkt (p, 14,
-        "292\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31293, "epsg", 31293,
-        "MGI (Ferro) / Austria East Zone (deprecated)", 0, 0,
-        "Bessel 1841", "Ferro",
-        "Militar_Geographische_Institut_Ferro", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=34 +k=1 +x_0=0 +y_0=0 +ellps");
-    add_proj4text (p, 1,
-        "=bessel +towgs84=682,-203,480,0,0,0,0 +pm=ferro +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI (Ferro) / Austria East Zone (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"MGI (Ferro)\",DATUM[\"Militar_Geographische_Ins");
-    add_srs_wkt (p, 2,
-        "titut_Ferro\",SPHEROID[\"Bessel 1841\",6377397.155,299.1");
-    add_srs_wkt (p, 3,
-        "528128,AUTHORITY[\"EPSG\",\"7004\"]],TOWGS84[682,-203,48");
-    add_srs_wkt (p, 4,
-        "0,0,0,0,0],AUTHORITY[\"EPSG\",\"6805\"]],PRIMEM[\"Ferro\"");
-    add_srs_wkt (p, 5,
-        ",-17.66666666666667,AUTHORITY[\"EPSG\",\"8909\"]],UNIT[\"");
-    add_srs_wkt (p, 6,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 8,
-        "ORITY[\"EPSG\",\"4805\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 9,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 10,
-        "ntral_meridian\",34],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_easting\",0],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 12,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31293\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 31294, "epsg", 31294,
-        "MGI / M28 (deprecated)", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=10.33333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "150000 +y_0=0 +ellps=bessel +towgs84=577.326,90.129,463.");
-    add_proj4text (p, 2,
-        "919,5.137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / M28 (deprecated)\",GEOGCS[\"MGI\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Militar_Geographische_Institute\",SPHEROID[\"Bessel 1841");
-    add_srs_wkt (p, 2,
-        "\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[577.326,90.129,463.919,5.137,1.474,5.297,2.4232");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"431");
-    add_srs_wkt (p, 8,
-        "2\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 9,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",10.");
-    add_srs_wkt (p, 10,
-        "33333333333333],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",150000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 12,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31294\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 31295, "epsg", 31295,
-        "MGI / M31 (deprecated)", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13.33333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "450000 +y_0=0 +ellps=bessel +towgs84=577.326,90.129,463.");
-    add_proj4text (p, 2,
-        "919,5.137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / M31 (deprecated)\",GEOGCS[\"MGI\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Militar_Geographische_Institute\",SPHEROID[\"Bessel 1841");
-    add_srs_wkt (p, 2,
-        "\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[577.326,90.129,463.919,5.137,1.474,5.297,2.4232");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"431");
-    add_srs_wkt (p, 8,
-        "2\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 9,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",13.");
-    add_srs_wkt (p, 10,
-        "33333333333333],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",450000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 12,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31295\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 31296, "epsg", 31296,
-        "MGI / M34 (deprecated)", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=16.33333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "750000 +y_0=0 +ellps=bessel +towgs84=577.326,90.129,463.");
-    add_proj4text (p, 2,
-        "919,5.137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / M34 (deprecated)\",GEOGCS[\"MGI\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Militar_Geographische_Institute\",SPHEROID[\"Bessel 1841");
-    add_srs_wkt (p, 2,
-        "\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]]");
-    add_srs_wkt (p, 3,
-        ",TOWGS84[577.326,90.129,463.919,5.137,1.474,5.297,2.4232");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 7,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"431");
-    add_srs_wkt (p, 8,
-        "2\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 9,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",16.");
-    add_srs_wkt (p, 10,
-        "33333333333333],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",750000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 12,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31296\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 31297, "epsg", 31297,
-        "MGI / Austria Lambert (deprecated)", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Militar_Geographische_Institute", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=46 +lat_0=47.5 +lon_0=13.3333");
-    add_proj4text (p, 1,
-        "3333333333 +x_0=400000 +y_0=400000 +ellps=bessel +towgs8");
-    add_proj4text (p, 2,
-        "4=577.326,90.129,463.919,5.137,1.474,5.297,2.4232 +units");
-    add_proj4text (p, 3,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Austria Lambert (deprecated)\",GEOGCS[\"M");
-    add_srs_wkt (p, 1,
-        "GI\",DATUM[\"Militar_Geographische_Institute\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7004\"]],TOWGS84[577.326,90.129,463.919,5.137,1.474");
-    add_srs_wkt (p, 4,
-        ",5.297,2.4232],AUTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 5,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 6,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 8,
-        "PSG\",\"4312\"]],PROJECTION[\"Lambert_Conformal_Conic_2S");
-    add_srs_wkt (p, 9,
-        "P\"],PARAMETER[\"standard_parallel_1\",49],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",46],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 11,
-        ",47.5],PARAMETER[\"central_meridian\",13.33333333333333]");
-    add_srs_wkt (p, 12,
-        ",PARAMETER[\"false_easting\",400000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 13,
-        "orthing\",400000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "9001\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 15,
-        "EPSG\",\"31297\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31300, "epsg", 31300,
-        "Belge 1972 / Belge Lambert 72", 0, 0,
-        "International 1924", "Greenwich",
-        "Reseau_National_Belge_1972", "Lambert_Conformal_Conic_2SP_Belgium", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49.83333333333334 +lat_2=51.16666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=90 +lon_0=4.356939722222222 +x_0=150000.01256");
-    add_proj4text (p, 2,
-        " +y_0=5400088.4378 +ellps=intl +towgs84=-106.8686,52.297");
-    add_proj4text (p, 3,
-        "8,-103.7239,0.3366,-0.457,1.8422,-1.2747 +units=m +no_de");
-    add_proj4text (p, 4,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Belge 1972 / Belge Lambert 72\",GEOGCS[\"Belge ");
-    add_srs_wkt (p, 1,
-        "1972\",DATUM[\"Reseau_National_Belge_1972\",SPHEROID[\"I");
-    add_srs_wkt (p, 2,
-        "nternational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "2\"]],TOWGS84[-106.8686,52.2978,-103.7239,0.3366,-0.457,");
-    add_srs_wkt (p, 4,
-        "1.8422,-1.2747],AUTHORITY[\"EPSG\",\"6313\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 5,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 6,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 7,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 8,
-        "\"EPSG\",\"4313\"]],PROJECTION[\"Lambert_Conformal_Conic");
-    add_srs_wkt (p, 9,
-        "_2SP_Belgium\"],PARAMETER[\"standard_parallel_1\",49.833");
-    add_srs_wkt (p, 10,
-        "33333333334],PARAMETER[\"standard_parallel_2\",51.166666");
-    add_srs_wkt (p, 11,
-        "66666666],PARAMETER[\"latitude_of_origin\",90],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"central_meridian\",4.356939722222222],PARAMETER[\"fal");
-    add_srs_wkt (p, 13,
-        "se_easting\",150000.01256],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 14,
-        "5400088.4378],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 15,
-        "\"]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 16,
-        "\",\"31300\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31370, "epsg", 31370,
-        "Belge 1972 / Belgian Lambert 72", 0, 0,
-        "International 1924", "Greenwich",
-        "Reseau_National_Belge_1972", "Lambert_Conformal_Conic_2SP", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=51.16666723333333 +lat_2=49.8333339 +la");
-    add_proj4text (p, 1,
-        "t_0=90 +lon_0=4.367486666666666 +x_0=150000.013 +y_0=540");
-    add_proj4text (p, 2,
-        "0088.438 +ellps=intl +towgs84=-106.8686,52.2978,-103.723");
-    add_proj4text (p, 3,
-        "9,0.3366,-0.457,1.8422,-1.2747 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Belge 1972 / Belgian Lambert 72\",GEOGCS[\"Belg");
-    add_srs_wkt (p, 1,
-        "e 1972\",DATUM[\"Reseau_National_Belge_1972\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "22\"]],TOWGS84[-106.8686,52.2978,-103.7239,0.3366,-0.457");
-    add_srs_wkt (p, 4,
-        ",1.8422,-1.2747],AUTHORITY[\"EPSG\",\"6313\"]],PRIMEM[\"");
-    add_srs_wkt (p, 5,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 6,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 7,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 8,
-        "[\"EPSG\",\"4313\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 9,
-        "c_2SP\"],PARAMETER[\"standard_parallel_1\",51.1666672333");
-    add_srs_wkt (p, 10,
-        "3333],PARAMETER[\"standard_parallel_2\",49.8333339],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"latitude_of_origin\",90],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 12,
-        "idian\",4.367486666666666],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 13,
-        "50000.013],PARAMETER[\"false_northing\",5400088.438],UNI");
-    add_srs_wkt (p, 14,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",E");
-    add_srs_wkt (p, 15,
-        "AST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31370\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31461, "epsg", 31461,
-        "DHDN / 3-degree Gauss zone 1 (deprecated)", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=3 +k=1 +x_0=1500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=bessel +towgs84=598.1,73.7,418.2,0.202,0.045,-2.45");
-    add_proj4text (p, 2,
-        "5,6.7 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DHDN / 3-degree Gauss zone 1 (deprecated)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"DHDN\",DATUM[\"Deutsches_Hauptdreiecksnetz\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7004\"]],TOWGS84[598.1,73.7,418.2,0.202,0.045,-");
-    add_srs_wkt (p, 4,
-        "2.455,6.7],AUTHORITY[\"EPSG\",\"6314\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 5,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 6,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 7,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 8,
-        "G\",\"4314\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 10,
-        "ian\",3],PARAMETER[\"scale_factor\",1],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",1500000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31461\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31462, "epsg", 31462,
-        "DHDN / 3-degree Gauss zone 2 (deprecated)", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=6 +k=1 +x_0=2500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=bessel +towgs84=598.1,73.7,418.2,0.202,0.045,-2.45");
-    add_proj4text (p, 2,
-        "5,6.7 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DHDN / 3-degree Gauss zone 2 (deprecated)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"DHDN\",DATUM[\"Deutsches_Hauptdreiecksnetz\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7004\"]],TOWGS84[598.1,73.7,418.2,0.202,0.045,-");
-    add_srs_wkt (p, 4,
-        "2.455,6.7],AUTHORITY[\"EPSG\",\"6314\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 5,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 6,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 7,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 8,
-        "G\",\"4314\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 10,
-        "ian\",6],PARAMETER[\"scale_factor\",1],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",2500000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31462\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31463, "epsg", 31463,
-        "DHDN / 3-degree Gauss zone 3 (deprecated)", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=3500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=bessel +towgs84=598.1,73.7,418.2,0.202,0.045,-2.45");
-    add_proj4text (p, 2,
-        "5,6.7 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DHDN / 3-degree Gauss zone 3 (deprecated)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"DHDN\",DATUM[\"Deutsches_Hauptdreiecksnetz\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7004\"]],TOWGS84[598.1,73.7,418.2,0.202,0.045,-");
-    add_srs_wkt (p, 4,
-        "2.455,6.7],AUTHORITY[\"EPSG\",\"6314\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 5,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 6,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 7,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 8,
-        "G\",\"4314\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 10,
-        "ian\",9],PARAMETER[\"scale_factor\",1],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",3500000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31463\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31464, "epsg", 31464,
-        "DHDN / 3-degree Gauss zone 4 (deprecated)", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=1 +x_0=4500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=598.1,73.7,418.2,0.202,0.045,-2.4");
-    add_proj4text (p, 2,
-        "55,6.7 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DHDN / 3-degree Gauss zone 4 (deprecated)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"DHDN\",DATUM[\"Deutsches_Hauptdreiecksnetz\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7004\"]],TOWGS84[598.1,73.7,418.2,0.202,0.045,-");
-    add_srs_wkt (p, 4,
-        "2.455,6.7],AUTHORITY[\"EPSG\",\"6314\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 5,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 6,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 7,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 8,
-        "G\",\"4314\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 10,
-        "ian\",12],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",4500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31464\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31465, "epsg", 31465,
-        "DHDN / 3-degree Gauss zone 5 (deprecated)", 0, 0,
-        "Bessel 1841", "Greenwich",
-        "Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=5500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=598.1,73.7,418.2,0.202,0.045,-2.4");
-    add_proj4text (p, 2,
-        "55,6.7 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DHDN / 3-degree Gauss zone 5 (deprecated)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"DHDN\",DATUM[\"Deutsches_Hauptdreiecksnetz\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7004\"]],TOWGS84[598.1,73.7,418.2,0.202,0.045,-");
-    add_srs_wkt (p, 4,
-        "2.455,6.7],AUTHORITY[\"EPSG\",\"6314\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 5,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 6,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 7,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 8,
-        "G\",\"4314\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 10,
-        "ian\",15],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",5500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\",\"31465\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31466, "epsg", 31466,
-        "DHDN / 3-degree Gauss-Kruger zone 2", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=6 +k=1 +x_0=2500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=bessel +towgs84=598.1,73.7,418.2,0.202,0.045,-2.45");
-    add_proj4text (p, 2,
-        "5,6.7 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DHDN / 3-degree Gauss-Kruger zone 2\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "DHDN\",DATUM[\"Deutsches_Hauptdreiecksnetz\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7004\"]],TOWGS84[598.1,73.7,418.2,0.202,0.045,-2.455,");
-    add_srs_wkt (p, 4,
-        "6.7],AUTHORITY[\"EPSG\",\"6314\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 5,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 6,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 7,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4314\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",6");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",2500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 12,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31466\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31467, "epsg", 31467,
-        "DHDN / 3-degree Gauss-Kruger zone 3", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=3500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=bessel +towgs84=598.1,73.7,418.2,0.202,0.045,-2.45");
-    add_proj4text (p, 2,
-        "5,6.7 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DHDN / 3-degree Gauss-Kruger zone 3\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "DHDN\",DATUM[\"Deutsches_Hauptdreiecksnetz\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7004\"]],TOWGS84[598.1,73.7,418.2,0.202,0.045,-2.455,");
-    add_srs_wkt (p, 4,
-        "6.7],AUTHORITY[\"EPSG\",\"6314\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 5,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 6,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 7,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4314\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",3500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 12,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31467\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31468, "epsg", 31468,
-        "DHDN / 3-degree Gauss-Kruger zone 4", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=1 +x_0=4500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=598.1,73.7,418.2,0.202,0.045,-2.4");
-    add_proj4text (p, 2,
-        "55,6.7 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DHDN / 3-degree Gauss-Kruger zone 4\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "DHDN\",DATUM[\"Deutsches_Hauptdreiecksnetz\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7004\"]],TOWGS84[598.1,73.7,418.2,0.202,0.045,-2.455,");
-    add_srs_wkt (p, 4,
-        "6.7],AUTHORITY[\"EPSG\",\"6314\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 5,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 6,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 7,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4314\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 10,
-        "2],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 11,
-        "ng\",4500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 12,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31468\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31469, "epsg", 31469,
-        "DHDN / 3-degree Gauss-Kruger zone 5", 0, 1,
-        "Bessel 1841", "Greenwich",
-        "Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=5500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=598.1,73.7,418.2,0.202,0.045,-2.4");
-    add_proj4text (p, 2,
-        "55,6.7 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DHDN / 3-degree Gauss-Kruger zone 5\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "DHDN\",DATUM[\"Deutsches_Hauptdreiecksnetz\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7004\"]],TOWGS84[598.1,73.7,418.2,0.202,0.045,-2.455,");
-    add_srs_wkt (p, 4,
-        "6.7],AUTHORITY[\"EPSG\",\"6314\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 5,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 6,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 7,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4314\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 10,
-        "5],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 11,
-        "ng\",5500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 12,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NORTH],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31469\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31491, "epsg", 31491,
-        "Germany_Zone_1", 0, 0,
-        "Bessel_1841", "Greenwich",
-        "D_Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "Meter",
-        "unknown", "unknown", "unknown", "unknown");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=3 +k=1 +x_0=1500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Germany_Zone_1\",GEOGCS[\"GCS_Deutsches_Hauptdr");
-    add_srs_wkt (p, 1,
-        "eiecksnetz\",DATUM[\"D_Deutsches_Hauptdreiecksnetz\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"Bessel_1841\",6377397.155,299.1528128]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0.0],UNIT[\"Degree\",0.0174532925199433]],PR");
-    add_srs_wkt (p, 4,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"False_East");
-    add_srs_wkt (p, 5,
-        "ing\",1500000.0],PARAMETER[\"False_Northing\",0.0],PARAM");
-    add_srs_wkt (p, 6,
-        "ETER[\"Central_Meridian\",3.0],PARAMETER[\"Scale_Factor\"");
-    add_srs_wkt (p, 7,
-        ",1.0],PARAMETER[\"Latitude_Of_Origin\",0.0],UNIT[\"Meter");
-    add_srs_wkt (p, 8,
-        "\",1.0],AUTHORITY[\"EPSG\",\"31491\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31492, "epsg", 31492,
-        "Germany_Zone_2", 0, 0,
-        "Bessel_1841", "Greenwich",
-        "D_Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "Meter",
-        "unknown", "unknown", "unknown", "unknown");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=6 +k=1 +x_0=2500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Germany_Zone_2\",GEOGCS[\"GCS_Deutsches_Hauptdr");
-    add_srs_wkt (p, 1,
-        "eiecksnetz\",DATUM[\"D_Deutsches_Hauptdreiecksnetz\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"Bessel_1841\",6377397.155,299.1528128]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0.0],UNIT[\"Degree\",0.0174532925199433]],PR");
-    add_srs_wkt (p, 4,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"False_East");
-    add_srs_wkt (p, 5,
-        "ing\",2500000.0],PARAMETER[\"False_Northing\",0.0],PARAM");
-    add_srs_wkt (p, 6,
-        "ETER[\"Central_Meridian\",6.0],PARAMETER[\"Scale_Factor\"");
-    add_srs_wkt (p, 7,
-        ",1.0],PARAMETER[\"Latitude_Of_Origin\",0.0],UNIT[\"Meter");
-    add_srs_wkt (p, 8,
-        "\",1.0],AUTHORITY[\"EPSG\",\"31492\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31493, "epsg", 31493,
-        "Germany_Zone_3", 0, 0,
-        "Bessel_1841", "Greenwich",
-        "D_Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "Meter",
-        "unknown", "unknown", "unknown", "unknown");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=3500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Germany_Zone_3\",GEOGCS[\"GCS_Deutsches_Hauptdr");
-    add_srs_wkt (p, 1,
-        "eiecksnetz\",DATUM[\"D_Deutsches_Hauptdreiecksnetz\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"Bessel_1841\",6377397.155,299.1528128]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0.0],UNIT[\"Degree\",0.0174532925199433]],PR");
-    add_srs_wkt (p, 4,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"False_East");
-    add_srs_wkt (p, 5,
-        "ing\",3500000.0],PARAMETER[\"False_Northing\",0.0],PARAM");
-    add_srs_wkt (p, 6,
-        "ETER[\"Central_Meridian\",9.0],PARAMETER[\"Scale_Factor\"");
-    add_srs_wkt (p, 7,
-        ",1.0],PARAMETER[\"Latitude_Of_Origin\",0.0],UNIT[\"Meter");
-    add_srs_wkt (p, 8,
-        "\",1.0],AUTHORITY[\"EPSG\",\"31493\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31494, "epsg", 31494,
-        "Germany_Zone_4", 0, 0,
-        "Bessel_1841", "Greenwich",
-        "D_Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "Meter",
-        "unknown", "unknown", "unknown", "unknown");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=1 +x_0=4500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Germany_Zone_4\",GEOGCS[\"GCS_Deutsches_Hauptdr");
-    add_srs_wkt (p, 1,
-        "eiecksnetz\",DATUM[\"D_Deutsches_Hauptdreiecksnetz\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"Bessel_1841\",6377397.155,299.1528128]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0.0],UNIT[\"Degree\",0.0174532925199433]],PR");
-    add_srs_wkt (p, 4,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"False_East");
-    add_srs_wkt (p, 5,
-        "ing\",4500000.0],PARAMETER[\"False_Northing\",0.0],PARAM");
-    add_srs_wkt (p, 6,
-        "ETER[\"Central_Meridian\",12.0],PARAMETER[\"Scale_Factor");
-    add_srs_wkt (p, 7,
-        "\",1.0],PARAMETER[\"Latitude_Of_Origin\",0.0],UNIT[\"Met");
-    add_srs_wkt (p, 8,
-        "er\",1.0],AUTHORITY[\"EPSG\",\"31494\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31495, "epsg", 31495,
-        "Germany_Zone_5", 0, 0,
-        "Bessel_1841", "Greenwich",
-        "D_Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "Meter",
-        "unknown", "unknown", "unknown", "unknown");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=5500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Germany_Zone_5\",GEOGCS[\"GCS_Deutsches_Hauptdr");
-    add_srs_wkt (p, 1,
-        "eiecksnetz\",DATUM[\"D_Deutsches_Hauptdreiecksnetz\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"Bessel_1841\",6377397.155,299.1528128]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0.0],UNIT[\"Degree\",0.0174532925199433]],PR");
-    add_srs_wkt (p, 4,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"False_East");
-    add_srs_wkt (p, 5,
-        "ing\",5500000.0],PARAMETER[\"False_Northing\",0.0],PARAM");
-    add_srs_wkt (p, 6,
-        "ETER[\"Central_Meridian\",15.0],PARAMETER[\"Scale_Factor");
-    add_srs_wkt (p, 7,
-        "\",1.0],PARAMETER[\"Latitude_Of_Origin\",0.0],UNIT[\"Met");
-    add_srs_wkt (p, 8,
-        "er\",1.0],AUTHORITY[\"EPSG\",\"31495\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31528, "epsg", 31528,
-        "Conakry 1905 / UTM zone 28N", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Conakry_1905", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +a=6378249.2 +b=6356515 +towgs84=-23,");
-    add_proj4text (p, 1,
-        "259,-9,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Conakry 1905 / UTM zone 28N\",GEOGCS[\"Conakry ");
-    add_srs_wkt (p, 1,
-        "1905\",DATUM[\"Conakry_1905\",SPHEROID[\"Clarke 1880 (IG");
-    add_srs_wkt (p, 2,
-        "N)\",6378249.2,293.4660212936269,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "11\"]],TOWGS84[-23,259,-9,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6315\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4315\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",-15],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 10,
-        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"31528\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31529, "epsg", 31529,
-        "Conakry 1905 / UTM zone 29N", 0, 0,
-        "Clarke 1880 (IGN)", "Greenwich",
-        "Conakry_1905", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +a=6378249.2 +b=6356515 +towgs84=-23,");
-    add_proj4text (p, 1,
-        "259,-9,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Conakry 1905 / UTM zone 29N\",GEOGCS[\"Conakry ");
-    add_srs_wkt (p, 1,
-        "1905\",DATUM[\"Conakry_1905\",SPHEROID[\"Clarke 1880 (IG");
-    add_srs_wkt (p, 2,
-        "N)\",6378249.2,293.4660212936269,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "11\"]],TOWGS84[-23,259,-9,0,0,0,0],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6315\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4315\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",-9],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",0.9996],PARAMETER[\"false_easting\",500000],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"31529\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31600, "epsg", 31600,
-        "Dealul Piscului 1930 / Stereo 33", 0, 0,
-        "International 1924", "Greenwich",
-        "Dealul_Piscului_1930", "Oblique_Stereographic", "metre",
-        "X", "East", "Y", "North");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=45.9 +lon_0=25.39246588888889 +k=0.9");
-    add_proj4text (p, 1,
-        "996667 +x_0=500000 +y_0=500000 +ellps=intl +towgs84=103.");
-    add_proj4text (p, 2,
-        "25,-100.4,-307.19,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Dealul Piscului 1930 / Stereo 33\",GEOGCS[\"Dea");
-    add_srs_wkt (p, 1,
-        "lul Piscului 1930\",DATUM[\"Dealul_Piscului_1930\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7022\"]],TOWGS84[103.25,-100.4,-307.19,0,0,0,0],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6316\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4316\"]],P");
-    add_srs_wkt (p, 8,
-        "ROJECTION[\"Oblique_Stereographic\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 9,
-        "e_of_origin\",45.9],PARAMETER[\"central_meridian\",25.39");
-    add_srs_wkt (p, 10,
-        "246588888889],PARAMETER[\"scale_factor\",0.9996667],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"X\",EAST],AXIS[\"Y\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"31600\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31700, "epsg", 31700,
-        "Dealul Piscului 1970/ Stereo 70 (deprecated)", 0, 1,
-        "Krassowsky 1940", "Greenwich",
-        "Dealul_Piscului_1970", "Oblique_Stereographic", "metre",
-        "X", "North", "Y", "East");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=46 +lon_0=25 +k=0.99975 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=500000 +ellps=krass +towgs84=28,-121,-77,0,0,0,0 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Dealul Piscului 1970/ Stereo 70 (deprecated)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Dealul Piscului 1970\",DATUM[\"Dealul_Piscului_");
-    add_srs_wkt (p, 2,
-        "1970\",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7024\"]],TOWGS84[28,-121,-77,0,0,0,0],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6317\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4317\"]]");
-    add_srs_wkt (p, 8,
-        ",PROJECTION[\"Oblique_Stereographic\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 9,
-        "ude_of_origin\",46],PARAMETER[\"central_meridian\",25],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",0.99975],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",500000],PARAMETER[\"false_northing\",500000],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"X\",NO");
-    add_srs_wkt (p, 13,
-        "RTH],AXIS[\"Y\",EAST],AUTHORITY[\"EPSG\",\"31700\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31838, "epsg", 31838,
-        "NGN / UTM zone 38N", 0, 0,
-        "WGS 84", "Greenwich",
-        "National_Geodetic_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +ellps=WGS84 +towgs84=-3.2,-5.7,2.8,0");
-    add_proj4text (p, 1,
-        ",0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NGN / UTM zone 38N\",GEOGCS[\"NGN\",DATUM[\"Nat");
-    add_srs_wkt (p, 1,
-        "ional_Geodetic_Network\",SPHEROID[\"WGS 84\",6378137,298");
-    add_srs_wkt (p, 2,
-        ".257223563,AUTHORITY[\"EPSG\",\"7030\"]],TOWGS84[-3.2,-5");
-    add_srs_wkt (p, 3,
-        ".7,2.8,0,0,0,0],AUTHORITY[\"EPSG\",\"6318\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"4318\"]],PROJECTION[\"Transverse_Mercator\"],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",45],PARAMETER[\"scale_factor\",0.9996],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_easting\",500000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 11,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"31838\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31839, "epsg", 31839,
-        "NGN / UTM zone 39N", 0, 0,
-        "WGS 84", "Greenwich",
-        "National_Geodetic_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=39 +ellps=WGS84 +towgs84=-3.2,-5.7,2.8,0");
-    add_proj4text (p, 1,
-        ",0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NGN / UTM zone 39N\",GEOGCS[\"NGN\",DATUM[\"Nat");
-    add_srs_wkt (p, 1,
-        "ional_Geodetic_Network\",SPHEROID[\"WGS 84\",6378137,298");
-    add_srs_wkt (p, 2,
-        ".257223563,AUTHORITY[\"EPSG\",\"7030\"]],TOWGS84[-3.2,-5");
-    add_srs_wkt (p, 3,
-        ".7,2.8,0,0,0,0],AUTHORITY[\"EPSG\",\"6318\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"4318\"]],PROJECTION[\"Transverse_Mercator\"],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",51],PARAMETER[\"scale_factor\",0.9996],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_easting\",500000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 11,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"31839\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31900, "epsg", 31900,
-        "KUDAMS / KTM (deprecated)", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Kuwait_Utility", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=48 +k=0.9996 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=GRS80 +towgs84=-20.8,11.3,2.4,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"KUDAMS / KTM (deprecated)\",GEOGCS[\"KUDAMS\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Kuwait_Utility\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 2,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[-20.8,");
-    add_srs_wkt (p, 3,
-        "11.3,2.4,0,0,0,0],AUTHORITY[\"EPSG\",\"6319\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4319\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",48],PARAMETER[\"scale_factor\",0.9996],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 11,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"31900\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31901, "epsg", 31901,
-        "KUDAMS / KTM", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Kuwait_Utility", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=48 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=-20.8,11.3,2.4,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"KUDAMS / KTM\",GEOGCS[\"KUDAMS\",DATUM[\"Kuwait");
-    add_srs_wkt (p, 1,
-        "_Utility\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 2,
-        "UTHORITY[\"EPSG\",\"7019\"]],TOWGS84[-20.8,11.3,2.4,0,0,");
-    add_srs_wkt (p, 3,
-        "0,0],AUTHORITY[\"EPSG\",\"6319\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 6,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "4319\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",4");
-    add_srs_wkt (p, 9,
-        "8],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"31901\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 31965, "epsg", 31965,
-        "SIRGAS 2000 / UTM zone 11N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=11 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 11N\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-117");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 11,
-        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"319");
-    add_srs_wkt (p, 14,
-        "65\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31966, "epsg", 31966,
-        "SIRGAS 2000 / UTM zone 12N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=12 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 12N\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-111");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 11,
-        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"319");
-    add_srs_wkt (p, 14,
-        "66\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31967, "epsg", 31967,
-        "SIRGAS 2000 / UTM zone 13N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=13 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 13N\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-105");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 11,
-        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"319");
-    add_srs_wkt (p, 14,
-        "67\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31968, "epsg", 31968,
-        "SIRGAS 2000 / UTM zone 14N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=14 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 14N\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-99]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3196");
-    add_srs_wkt (p, 14,
-        "8\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31969, "epsg", 31969,
-        "SIRGAS 2000 / UTM zone 15N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=15 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 15N\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-93]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3196");
-    add_srs_wkt (p, 14,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31970, "epsg", 31970,
-        "SIRGAS 2000 / UTM zone 16N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=16 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 16N\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-87]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3197");
-    add_srs_wkt (p, 14,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31971, "epsg", 31971,
-        "SIRGAS 2000 / UTM zone 17N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 17N\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-81]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3197");
-    add_srs_wkt (p, 14,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31972, "epsg", 31972,
-        "SIRGAS 2000 / UTM zone 18N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 18N\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-75]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3197");
-    add_srs_wkt (p, 14,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31973, "epsg", 31973,
-        "SIRGAS 2000 / UTM zone 19N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 19N\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-69]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3197");
-    add_srs_wkt (p, 14,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31974, "epsg", 31974,
-        "SIRGAS 2000 / UTM zone 20N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 20N\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-63]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3197");
-    add_srs_wkt (p, 14,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31975, "epsg", 31975,
-        "SIRGAS 2000 / UTM zone 21N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 21N\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-57]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3197");
-    add_srs_wkt (p, 14,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31976, "epsg", 31976,
-        "SIRGAS 2000 / UTM zone 22N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 22N\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-51]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3197");
-    add_srs_wkt (p, 14,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31977, "epsg", 31977,
-        "SIRGAS 2000 / UTM zone 17S", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 17S\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-81]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",10000000],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"31977\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31978, "epsg", 31978,
-        "SIRGAS 2000 / UTM zone 18S", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 18S\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-75]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",10000000],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"31978\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31979, "epsg", 31979,
-        "SIRGAS 2000 / UTM zone 19S", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 19S\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-69]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",10000000],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"31979\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31980, "epsg", 31980,
-        "SIRGAS 2000 / UTM zone 20S", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 20S\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-63]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",10000000],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"31980\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31981, "epsg", 31981,
-        "SIRGAS 2000 / UTM zone 21S", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 21S\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-57]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",10000000],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"31981\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31982, "epsg", 31982,
-        "SIRGAS 2000 / UTM zone 22S", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 22S\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-51]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",10000000],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"31982\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31983, "epsg", 31983,
-        "SIRGAS 2000 / UTM zone 23S", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=23 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 23S\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-45]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",10000000],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"31983\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31984, "epsg", 31984,
-        "SIRGAS 2000 / UTM zone 24S", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=24 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 24S\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-39]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",10000000],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"31984\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31985, "epsg", 31985,
-        "SIRGAS 2000 / UTM zone 25S", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=25 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 25S\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0,0]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6674\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4674");
-    add_srs_wkt (p, 8,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 9,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-33]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",10000000],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"31985\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31986, "epsg", 31986,
-        "SIRGAS 1995 / UTM zone 17N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_America_del_Sur_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 1995 / UTM zone 17N\",GEOGCS[\"SIRGAS 19");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_Amer");
-    add_srs_wkt (p, 2,
-        "ica_del_Sur_1995\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0],AUTHORITY[\"EPSG\",\"6170\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 6,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41");
-    add_srs_wkt (p, 8,
-        "70\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 9,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",-8");
-    add_srs_wkt (p, 10,
-        "1],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"319");
-    add_srs_wkt (p, 14,
-        "86\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31987, "epsg", 31987,
-        "SIRGAS 1995 / UTM zone 18N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_America_del_Sur_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 1995 / UTM zone 18N\",GEOGCS[\"SIRGAS 19");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_Amer");
-    add_srs_wkt (p, 2,
-        "ica_del_Sur_1995\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0],AUTHORITY[\"EPSG\",\"6170\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 6,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41");
-    add_srs_wkt (p, 8,
-        "70\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 9,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",-7");
-    add_srs_wkt (p, 10,
-        "5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"319");
-    add_srs_wkt (p, 14,
-        "87\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31988, "epsg", 31988,
-        "SIRGAS 1995 / UTM zone 19N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_America_del_Sur_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 1995 / UTM zone 19N\",GEOGCS[\"SIRGAS 19");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_Amer");
-    add_srs_wkt (p, 2,
-        "ica_del_Sur_1995\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0],AUTHORITY[\"EPSG\",\"6170\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 6,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41");
-    add_srs_wkt (p, 8,
-        "70\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 9,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",-6");
-    add_srs_wkt (p, 10,
-        "9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"319");
-    add_srs_wkt (p, 14,
-        "88\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31989, "epsg", 31989,
-        "SIRGAS 1995 / UTM zone 20N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_America_del_Sur_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 1995 / UTM zone 20N\",GEOGCS[\"SIRGAS 19");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_Amer");
-    add_srs_wkt (p, 2,
-        "ica_del_Sur_1995\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0],AUTHORITY[\"EPSG\",\"6170\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 6,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41");
-    add_srs_wkt (p, 8,
-        "70\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 9,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",-6");
-    add_srs_wkt (p, 10,
-        "3],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"319");
-    add_srs_wkt (p, 14,
-        "89\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31990, "epsg", 31990,
-        "SIRGAS 1995 / UTM zone 21N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_America_del_Sur_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 1995 / UTM zone 21N\",GEOGCS[\"SIRGAS 19");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_Amer");
-    add_srs_wkt (p, 2,
-        "ica_del_Sur_1995\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0],AUTHORITY[\"EPSG\",\"6170\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 6,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41");
-    add_srs_wkt (p, 8,
-        "70\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 9,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",-5");
-    add_srs_wkt (p, 10,
-        "7],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"319");
-    add_srs_wkt (p, 14,
-        "90\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31991, "epsg", 31991,
-        "SIRGAS 1995 / UTM zone 22N", 0, 0,
-        "GRS 1980", "Greenwich",
-        "Sistema_de_Referencia_Geocentrico_para_America_del_Sur_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 1995 / UTM zone 22N\",GEOGCS[\"SIRGAS 19");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_Amer");
-    add_srs_wkt (p, 2,
-        "ica_del_Sur_1995\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],TOWGS84[0,0,0,0,0,0");
-    add_srs_wkt (p, 4,
-        ",0],AUTHORITY[\"EPSG\",\"6170\"]],PRIMEM[\"Greenwich\",0");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 6,
-        "925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41");
-    add_srs_wkt (p, 8,
-        "70\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 9,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",-5");
-    add_srs_wkt (p, 10,
-        "1],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"319");
-    add_srs_wkt (p, 14,
-        "91\"]]");
-}
-
-#endif /* full EPSG initialization enabled/disabled */
-
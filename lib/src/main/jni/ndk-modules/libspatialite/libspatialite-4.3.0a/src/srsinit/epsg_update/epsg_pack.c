@@ -0,0 +1,548 @@
+/*
+/ epsg_pack
+/
+/ a tool autogenerating C code for SpatiaLite
+/ [packing the inlined EPSG dataset into a compact binary table]
+/
+/ version 1.0, 2026 October 18
+/
+/ Author: Sandro Furieri a.furieri@lqt.it
+/
+/ Copyright (C) 2026  Alessandro Furieri
+/
+/    This program is free software: you can redistribute it and/or modify
+/    it under the terms of the GNU General Public License as published by
+/    the Free Software Foundation, either version 3 of the License, or
+/    (at your option) any later version.
+/
+/    This program is distributed in the hope that it will be useful,
+/    but WITHOUT ANY WARRANTY; without even the implied warranty of
+/    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/    GNU General Public License for more details.
+/
+/    You should have received a copy of the GNU General Public License
+/    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+/
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <zlib.h>
+
+#include <spatialite_private.h>
+
+#define PACKED_BLOCK_SIZE	32768
+
+/*
+/ the inlined EPSG dataset as generated by "auto_epsg_ext" is
+/ directly linked to this tool: the following functions simply
+/ collect all its definitions into a plain list
+*/
+
+SPATIALITE_PRIVATE struct epsg_defs *
+add_epsg_def_ex (int filter_srid, struct epsg_defs **first,
+		 struct epsg_defs **last, int srid, const char *auth_name,
+		 int auth_srid, const char *ref_sys_name, int is_geographic,
+		 int flipped_axes, const char *spheroid,
+		 const char *prime_meridian, const char *datum,
+		 const char *projection, const char *unit, const char *axis_1,
+		 const char *orientation_1, const char *axis_2,
+		 const char *orientation_2)
+{
+/* appending an EPSG def to the list */
+    struct epsg_defs *p;
+    if (filter_srid == GAIA_EPSG_NONE)
+	return NULL;
+    if (filter_srid == GAIA_EPSG_ANY || filter_srid == GAIA_EPSG_WGS84_ONLY)
+	;
+    else if (srid != filter_srid)
+	return NULL;
+    p = calloc (1, sizeof (struct epsg_defs));
+    p->srid = srid;
+    p->auth_srid = auth_srid;
+    if (auth_name != NULL && *auth_name != '\0')
+	p->auth_name = strdup (auth_name);
+    if (ref_sys_name != NULL && *ref_sys_name != '\0')
+	p->ref_sys_name = strdup (ref_sys_name);
+    p->is_geographic = is_geographic;
+    p->flipped_axes = flipped_axes;
+    if (spheroid != NULL)
+	p->spheroid = strdup (spheroid);
+    if (prime_meridian != NULL)
+	p->prime_meridian = strdup (prime_meridian);
+    if (datum != NULL)
+	p->datum = strdup (datum);
+    if (projection != NULL)
+	p->projection = strdup (projection);
+    if (unit != NULL)
+	p->unit = strdup (unit);
+    if (axis_1 != NULL)
+	p->axis_1 = strdup (axis_1);
+    if (orientation_1 != NULL)
+	p->orientation_1 = strdup (orientation_1);
+    if (axis_2 != NULL)
+	p->axis_2 = strdup (axis_2);
+    if (orientation_2 != NULL)
+	p->orientation_2 = strdup (orientation_2);
+    if (*first == NULL)
+	*first = p;
+    if (*last != NULL)
+	(*last)->next = p;
+    *last = p;
+    return p;
+}
+
+SPATIALITE_PRIVATE struct epsg_defs *
+add_epsg_def (int filter_srid, struct epsg_defs **first,
+	      struct epsg_defs **last, int srid, const char *auth_name,
+	      int auth_srid, const char *ref_sys_name)
+{
+/* appending an EPSG def to the list */
+    return add_epsg_def_ex (filter_srid, first, last, srid, auth_name,
+			    auth_srid, ref_sys_name, -1, -1, NULL, NULL, NULL,
+			    NULL, NULL, NULL, NULL, NULL, NULL);
+}
+
+static void
+append_text (char **string, int count, const char *text)
+{
+/* appending a chunk of text */
+    char *old = *string;
+    if (text == NULL)
+	return;
+    if (!count)
+      {
+	  *string = strdup (text);
+	  return;
+      }
+    if (old == NULL)
+	return;
+    *string = malloc (strlen (old) + strlen (text) + 1);
+    strcpy (*string, old);
+    strcat (*string, text);
+    free (old);
+}
+
+SPATIALITE_PRIVATE void
+add_proj4text (struct epsg_defs *p, int count, const char *text)
+{
+/* creating the PROJ4TEXT string */
+    if (p != NULL)
+	append_text (&(p->proj4text), count, text);
+}
+
+SPATIALITE_PRIVATE void
+add_srs_wkt (struct epsg_defs *p, int count, const char *text)
+{
+/* creating the SRS_WKT string */
+    if (p != NULL)
+	append_text (&(p->srs_wkt), count, text);
+}
+
+struct packed_entry
+{
+/* a struct wrapping an EPSG def to be packed */
+    struct epsg_defs *def;
+    int wgs84;
+    int block;
+    unsigned int offset;
+};
+
+struct packed_output
+{
+/* the packed dataset being generated */
+    FILE *out;
+    const char *prefix;
+    int compress;
+    unsigned char *raw;
+    unsigned int raw_len;
+    unsigned int raw_alloc;
+    int n_blocks;
+    unsigned int *packed_len;
+    unsigned int *raw_lens;
+    unsigned long total_raw;
+    unsigned long total_packed;
+};
+
+static int
+cmp_srid (const void *p1, const void *p2)
+{
+/* sorting the EPSG defs by SRID */
+    const struct packed_entry *e1 = (const struct packed_entry *) p1;
+    const struct packed_entry *e2 = (const struct packed_entry *) p2;
+    if (e1->def->srid < e2->def->srid)
+	return -1;
+    if (e1->def->srid > e2->def->srid)
+	return 1;
+    return 0;
+}
+
+static const char *
+field_value (struct epsg_defs *p, int i)
+{
+/* returning the Nth packed string of an EPSG def */
+    switch (i)
+      {
+      case 0:
+	  return p->auth_name;
+      case 1:
+	  return p->ref_sys_name;
+      case 2:
+	  return p->proj4text;
+      case 3:
+	  return p->srs_wkt;
+      case 4:
+	  return p->spheroid;
+      case 5:
+	  return p->prime_meridian;
+      case 6:
+	  return p->datum;
+      case 7:
+	  return p->projection;
+      case 8:
+	  return p->unit;
+      case 9:
+	  return p->axis_1;
+      case 10:
+	  return p->orientation_1;
+      case 11:
+	  return p->axis_2;
+      case 12:
+	  return p->orientation_2;
+      };
+    return NULL;
+}
+
+static unsigned int
+null_mask (struct epsg_defs *p)
+{
+/* computing the NULL strings bitmask */
+    unsigned int mask = 0;
+    int i;
+    for (i = 0; i < 13; i++)
+      {
+	  if (field_value (p, i) == NULL)
+	      mask |= 1 << i;
+      }
+    return mask;
+}
+
+static void
+append_raw (struct packed_output *pk, const char *str)
+{
+/* appending a NUL-terminated string to the current block */
+    unsigned int len = strlen (str) + 1;
+    if (pk->raw_len + len > pk->raw_alloc)
+      {
+	  pk->raw_alloc = (pk->raw_len + len) * 2;
+	  pk->raw = realloc (pk->raw, pk->raw_alloc);
+      }
+    memcpy (pk->raw + pk->raw_len, str, len);
+    pk->raw_len += len;
+}
+
+static int
+flush_block (struct packed_output *pk)
+{
+/* writing the current block as a C array */
+    uLongf zlen = compressBound (pk->raw_len);
+    unsigned char *zbuf = malloc (zlen);
+    const unsigned char *data = pk->raw;
+    unsigned int len = pk->raw_len;
+    unsigned int i;
+    if (pk->compress)
+      {
+	  if (compress2 (zbuf, &zlen, pk->raw, pk->raw_len, 9) != Z_OK)
+	    {
+		fprintf (stderr, "ERROR: unable to compress block #%d\n",
+			 pk->n_blocks);
+		free (zbuf);
+		return 0;
+	    }
+	  if (zlen < pk->raw_len)
+	    {
+		/* blocks not shrinking at all will be stored uncompressed */
+		data = zbuf;
+		len = zlen;
+	    }
+      }
+    fprintf (pk->out, "static const unsigned char %s_block_%03d[%u] = {",
+	     pk->prefix, pk->n_blocks, len);
+    for (i = 0; i < len; i++)
+      {
+	  if ((i % 16) == 0)
+	      fprintf (pk->out, "\n    ");
+	  fprintf (pk->out, "0x%02x,", data[i]);
+      }
+    fprintf (pk->out, "\n};\n\n");
+    free (zbuf);
+    pk->packed_len =
+	realloc (pk->packed_len, sizeof (unsigned int) * (pk->n_blocks + 1));
+    pk->raw_lens =
+	realloc (pk->raw_lens, sizeof (unsigned int) * (pk->n_blocks + 1));
+    pk->packed_len[pk->n_blocks] = len;
+    pk->raw_lens[pk->n_blocks] = pk->raw_len;
+    pk->total_raw += pk->raw_len;
+    pk->total_packed += len;
+    pk->n_blocks++;
+    pk->raw_len = 0;
+    return 1;
+}
+
+static int
+output_dataset (FILE * out, const char *prefix, struct packed_entry *entries,
+		int count, int compress)
+{
+/* generating a whole packed dataset */
+    struct packed_output pk;
+    struct packed_entry *e;
+    int i;
+    int f;
+    int ret = 0;
+    memset (&pk, 0, sizeof (pk));
+    pk.out = out;
+    pk.prefix = prefix;
+    pk.compress = compress;
+
+/* packing all records into independent blocks */
+    for (i = 0; i < count; i++)
+      {
+	  e = entries + i;
+	  e->block = pk.n_blocks;
+	  e->offset = pk.raw_len;
+	  for (f = 0; f < 13; f++)
+	    {
+		const char *value = field_value (e->def, f);
+		append_raw (&pk, value == NULL ? "" : value);
+	    }
+	  if (pk.raw_len >= PACKED_BLOCK_SIZE)
+	    {
+		if (!flush_block (&pk))
+		    goto stop;
+	    }
+      }
+    if (pk.raw_len > 0)
+      {
+	  if (!flush_block (&pk))
+	      goto stop;
+      }
+
+/* the blocks table */
+    fprintf (out, "static const struct epsg_packed_block %s_blocks[%d] = {\n",
+	     prefix, pk.n_blocks);
+    for (i = 0; i < pk.n_blocks; i++)
+	fprintf (out, "    {%s_block_%03d, %u, %u},\n", prefix, i,
+		 pk.packed_len[i], pk.raw_lens[i]);
+    fprintf (out, "};\n\n");
+
+/* the SRID index */
+    fprintf (out, "static const struct epsg_packed_def %s_defs[%d] = {\n",
+	     prefix, count);
+    for (i = 0; i < count; i++)
+      {
+	  e = entries + i;
+	  fprintf (out, "    {%d, %d, %u, %d, 0x%04x, %d, %d, %d},\n",
+		   e->def->srid, e->def->auth_srid, e->offset, e->block,
+		   null_mask (e->def), e->def->is_geographic,
+		   e->def->flipped_axes, e->wgs84);
+      }
+    fprintf (out, "};\n\n");
+    fprintf (out,
+	     "static const struct epsg_packed_dataset %s_dataset = {\n"
+	     "    %s_defs, %d, %s_blocks, %d\n};\n\n", prefix, prefix, count,
+	     prefix, pk.n_blocks);
+    fprintf (stderr, "%s: %d defs, %d blocks, %lu bytes packed into %lu\n",
+	     prefix, count, pk.n_blocks, pk.total_raw, pk.total_packed);
+    ret = 1;
+  stop:
+    if (pk.raw)
+	free (pk.raw);
+    if (pk.packed_len)
+	free (pk.packed_len);
+    if (pk.raw_lens)
+	free (pk.raw_lens);
+    return ret;
+}
+
+static void
+do_header (FILE * out)
+{
+/* writing the generated file header */
+    time_t now;
+    time (&now);
+    fprintf (out, "/*\n\n");
+    fprintf (out,
+	     " epsg_packed.c -- the built-in EPSG dataset for srs_init.c\n\n");
+    fprintf (out, " this code was autogenerated by \"epsg_pack\" on %s\n",
+	     ctime (&now));
+    fprintf (out, " Author: Sandro Furieri a.furieri@lqt.it\n\n");
+    fprintf (out,
+	     " -----------------------------------------------------------------------------\n\n");
+    fprintf (out, " Version: MPL 1.1/GPL 2.0/LGPL 2.1\n\n");
+    fprintf (out,
+	     " The contents of this file are subject to the Mozilla Public License Version\n");
+    fprintf (out,
+	     " 1.1 (the \"License\"); you may not use this file except in compliance with\n");
+    fprintf (out,
+	     " the License. You may obtain a copy of the License at\n");
+    fprintf (out, " http://www.mozilla.org/MPL/\n\n");
+    fprintf (out,
+	     "Software distributed under the License is distributed on an \"AS IS\" basis,\n");
+    fprintf (out,
+	     "WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License\n");
+    fprintf (out,
+	     "for the specific language governing rights and limitations under the\n");
+    fprintf (out, "License.\n\n");
+    fprintf (out,
+	     "The Original Code is the SpatiaLite library\n\n");
+    fprintf (out,
+	     "The Initial Developer of the Original Code is Alessandro Furieri\n\n");
+    fprintf (out,
+	     "Portions created by the Initial Developer are Copyright (C) 2008\n");
+    fprintf (out, "the Initial Developer. All Rights Reserved.\n\n");
+    fprintf (out, "Contributor(s):\n\n");
+    fprintf (out,
+	     "Alternatively, the contents of this file may be used under the terms of\n");
+    fprintf (out,
+	     "either the GNU General Public License Version 2 or later (the \"GPL\"), or\n");
+    fprintf (out,
+	     "the GNU Lesser General Public License Version 2.1 or later (the \"LGPL\"),\n");
+    fprintf (out,
+	     "in which case the provisions of the GPL or the LGPL are applicable instead\n");
+    fprintf (out,
+	     "of those above. If you wish to allow use of your version of this file only\n");
+    fprintf (out,
+	     "under the terms of either the GPL or the LGPL, and not to allow others to\n");
+    fprintf (out,
+	     "use your version of this file under the terms of the MPL, indicate your\n");
+    fprintf (out,
+	     "decision by deleting the provisions above and replace them with the notice\n");
+    fprintf (out,
+	     "and other provisions required by the GPL or the LGPL. If you do not delete\n");
+    fprintf (out,
+	     "the provisions above, a recipient may use your version of this file under\n");
+    fprintf (out, "the terms of any one of the MPL, the GPL or the LGPL.\n\n");
+    fprintf (out, "*/\n\n");
+    fprintf (out, "#if defined(_WIN32) && !defined(__MINGW32__)\n");
+    fprintf (out, "#include \"config-msvc.h\"\n");
+    fprintf (out, "#else\n");
+    fprintf (out, "#include \"config.h\"\n");
+    fprintf (out, "#endif\n\n");
+    fprintf (out, "#include <spatialite_private.h>\n\n");
+    fprintf (out, "/*\n");
+    fprintf (out,
+	     "/ each record is a sequence of NUL-terminated strings:\n");
+    fprintf (out,
+	     "/ auth_name, ref_sys_name, proj4text, srs_wkt, spheroid,\n");
+    fprintf (out,
+	     "/ prime_meridian, datum, projection, unit, axis_1,\n");
+    fprintf (out, "/ orientation_1, axis_2, orientation_2\n");
+    fprintf (out, "*/\n\n");
+}
+
+int
+main (int argc, char *argv[])
+{
+/*
+/
+/ usage: epsg_pack [-raw]
+/
+/ the C code will be generated into: epsg_packed.c
+/ "-raw" will store all blocks uncompressed
+/
+*/
+    FILE *out = NULL;
+    struct epsg_defs *first = NULL;
+    struct epsg_defs *last = NULL;
+    struct epsg_defs *wgs_first = NULL;
+    struct epsg_defs *wgs_last = NULL;
+    struct epsg_defs *p;
+    struct epsg_defs *pw;
+    struct packed_entry *entries = NULL;
+    struct packed_entry *wgs84 = NULL;
+    int count = 0;
+    int n_wgs84 = 0;
+    int compress = 1;
+    int i;
+    int ret = 1;
+
+    if (argc == 2 && strcmp (argv[1], "-raw") == 0)
+	compress = 0;
+    else if (argc > 1)
+      {
+	  fprintf (stderr, "usage: epsg_pack [-raw]\n");
+	  return 1;
+      }
+
+/* loading the inlined EPSG dataset */
+    initialize_epsg (GAIA_EPSG_ANY, &first, &last);
+    initialize_epsg (GAIA_EPSG_WGS84_ONLY, &wgs_first, &wgs_last);
+    for (p = first; p != NULL; p = p->next)
+	count++;
+    for (p = wgs_first; p != NULL; p = p->next)
+	n_wgs84++;
+    entries = malloc (sizeof (struct packed_entry) * count);
+    wgs84 = malloc (sizeof (struct packed_entry) * n_wgs84);
+    for (i = 0, p = first; p != NULL; p = p->next, i++)
+      {
+	  entries[i].def = p;
+	  entries[i].wgs84 = 0;
+	  for (pw = wgs_first; pw != NULL; pw = pw->next)
+	    {
+		if (pw->srid == p->srid)
+		    entries[i].wgs84 = 1;
+	    }
+      }
+    for (i = 0, p = wgs_first; p != NULL; p = p->next, i++)
+      {
+	  wgs84[i].def = p;
+	  wgs84[i].wgs84 = 1;
+      }
+    qsort (entries, count, sizeof (struct packed_entry), cmp_srid);
+    qsort (wgs84, n_wgs84, sizeof (struct packed_entry), cmp_srid);
+    for (i = 1; i < count; i++)
+      {
+	  if (entries[i].def->srid == entries[i - 1].def->srid)
+	    {
+		fprintf (stderr, "ERROR: duplicate SRID %d\n",
+			 entries[i].def->srid);
+		goto stop;
+	    }
+      }
+
+    out = fopen ("epsg_packed.c", "wb");
+    if (out == NULL)
+      {
+	  fprintf (stderr,
+		   "ERROR: unable to open the \"epsg_packed.c\" output file\n");
+	  goto stop;
+      }
+    do_header (out);
+    fprintf (out,
+	     "#ifndef OMIT_EPSG    /* full EPSG initialization enabled */\n\n");
+    if (!output_dataset (out, "epsg", entries, count, compress))
+	goto stop;
+    fprintf (out, "#else    /* WGS84 definitions only */\n\n");
+    if (!output_dataset (out, "epsg", wgs84, n_wgs84, compress))
+	goto stop;
+    fprintf (out, "#endif\n\n");
+    fprintf (out, "SPATIALITE_PRIVATE const struct epsg_packed_dataset *\n");
+    fprintf (out, "epsg_packed_dataset (void)\n");
+    fprintf (out, "{\n");
+    fprintf (out, "/* returning the built-in EPSG dataset */\n");
+    fprintf (out, "    return &epsg_dataset;\n");
+    fprintf (out, "}\n");
+    ret = 0;
+
+  stop:
+    if (out)
+	fclose (out);
+    if (entries)
+	free (entries);
+    if (wgs84)
+	free (wgs84);
+    return ret;
+}
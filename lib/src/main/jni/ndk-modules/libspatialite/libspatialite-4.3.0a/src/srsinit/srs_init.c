@@ -189,6 +189,7 @@ add_epsg_def_ex (int filter_srid, struct epsg_defs **first,
     p->spheroid = NULL;
     p->prime_meridian = NULL;
     p->datum = NULL;
+    p->projection = NULL;
     p->unit = NULL;
     p->axis_1 = NULL;
     p->orientation_1 = NULL;
@@ -376,6 +377,221 @@ free_epsg (struct epsg_defs *first)
       }
 }
 
+/*
+/ the built-in EPSG dataset
+/
+/ all EPSG defs are packed (sorted by SRID) into independent blocks
+/ each one containing a sequence of NUL-terminated strings; any block
+/ will be unpacked only when one of its defs is actually required
+*/
+
+struct epsg_packed_cursor
+{
+/* a struct supporting sequential access to the built-in EPSG dataset */
+    const struct epsg_packed_dataset *dataset;
+    int block;
+    const unsigned char *raw;
+    unsigned char *buffer;
+};
+
+static void
+epsg_cursor_init (struct epsg_packed_cursor *cursor)
+{
+/* initializing a cursor */
+    cursor->dataset = epsg_packed_dataset ();
+    cursor->block = -1;
+    cursor->raw = NULL;
+    cursor->buffer = NULL;
+}
+
+static void
+epsg_cursor_reset (struct epsg_packed_cursor *cursor)
+{
+/* memory cleanup - releasing the current unpacked block */
+    if (cursor->buffer != NULL)
+	free (cursor->buffer);
+    cursor->block = -1;
+    cursor->raw = NULL;
+    cursor->buffer = NULL;
+}
+
+static int
+epsg_cursor_block (struct epsg_packed_cursor *cursor, int block)
+{
+/* unpacking a block of EPSG defs, if not already current */
+    const struct epsg_packed_block *blk;
+    uLongf len;
+    if (block == cursor->block)
+	return 1;
+    epsg_cursor_reset (cursor);
+    if (block < 0 || block >= cursor->dataset->n_blocks)
+	return 0;
+    blk = cursor->dataset->blocks + block;
+    if (blk->packed_len == blk->raw_len)
+      {
+	  /* stored uncompressed */
+	  cursor->raw = blk->data;
+	  cursor->block = block;
+	  return 1;
+      }
+    cursor->buffer = malloc (blk->raw_len);
+    if (cursor->buffer == NULL)
+	return 0;
+    len = blk->raw_len;
+    if (uncompress (cursor->buffer, &len, blk->data, blk->packed_len) != Z_OK
+	|| len != blk->raw_len)
+      {
+	  spatialite_e ("corrupted EPSG dataset: block #%d\n", block);
+	  epsg_cursor_reset (cursor);
+	  return 0;
+      }
+    cursor->raw = cursor->buffer;
+    cursor->block = block;
+    return 1;
+}
+
+static const char *
+epsg_cursor_string (const char **p, unsigned short null_mask, int i)
+{
+/* fetching the Nth string from an unpacked record */
+    const char *str = *p;
+    *p += strlen (str) + 1;
+    if (null_mask & (1 << i))
+	return NULL;
+    return str;
+}
+
+static int
+epsg_cursor_row (struct epsg_packed_cursor *cursor, int index,
+		 struct epsg_defs *row)
+{
+/* 
+/ fetching the Nth EPSG def
+/ all strings simply point into the current unpacked block
+*/
+    const struct epsg_packed_def *def = cursor->dataset->defs + index;
+    const char *p;
+    if (!epsg_cursor_block (cursor, def->block))
+	return 0;
+    p = (const char *) (cursor->raw + def->offset);
+    row->srid = def->srid;
+    row->auth_srid = def->auth_srid;
+    row->is_geographic = def->is_geographic;
+    row->flipped_axes = def->flipped_axes;
+    row->auth_name = (char *) epsg_cursor_string (&p, def->null_mask, 0);
+    row->ref_sys_name = (char *) epsg_cursor_string (&p, def->null_mask, 1);
+    row->proj4text = (char *) epsg_cursor_string (&p, def->null_mask, 2);
+    row->srs_wkt = (char *) epsg_cursor_string (&p, def->null_mask, 3);
+    row->spheroid = (char *) epsg_cursor_string (&p, def->null_mask, 4);
+    row->prime_meridian = (char *) epsg_cursor_string (&p, def->null_mask, 5);
+    row->datum = (char *) epsg_cursor_string (&p, def->null_mask, 6);
+    row->projection = (char *) epsg_cursor_string (&p, def->null_mask, 7);
+    row->unit = (char *) epsg_cursor_string (&p, def->null_mask, 8);
+    row->axis_1 = (char *) epsg_cursor_string (&p, def->null_mask, 9);
+    row->orientation_1 = (char *) epsg_cursor_string (&p, def->null_mask, 10);
+    row->axis_2 = (char *) epsg_cursor_string (&p, def->null_mask, 11);
+    row->orientation_2 = (char *) epsg_cursor_string (&p, def->null_mask, 12);
+    row->next = NULL;
+    return 1;
+}
+
+static int
+epsg_packed_find (const struct epsg_packed_dataset *dataset, int srid)
+{
+/* binary search: returns the index of the EPSG def, -1 if not found */
+    int lo = 0;
+    int hi = dataset->count - 1;
+    while (lo <= hi)
+      {
+	  int mid = lo + (hi - lo) / 2;
+	  int cur = dataset->defs[mid].srid;
+	  if (cur == srid)
+	      return mid;
+	  if (cur < srid)
+	      lo = mid + 1;
+	  else
+	      hi = mid - 1;
+      }
+    return -1;
+}
+
+static int
+epsg_packed_filter (int filter, const struct epsg_packed_def *def)
+{
+/* checking if an EPSG def is selected by the current filter */
+    if (filter == GAIA_EPSG_NONE)
+	return 0;
+    if (filter == GAIA_EPSG_ANY)
+	return 1;
+    if (filter == GAIA_EPSG_WGS84_ONLY)
+	return def->wgs84;
+    if (filter == GAIA_EPSG_LAZY)
+	return (def->srid == -1 || def->srid == 0);
+    return (def->srid == filter);
+}
+
+SPATIALITE_PRIVATE void
+initialize_epsg (int filter, struct epsg_defs **first, struct epsg_defs **last)
+{
+/* initializing the EPSG defs list */
+    struct epsg_packed_cursor cursor;
+    struct epsg_defs row;
+    struct epsg_defs *p;
+    int i;
+    int begin = 0;
+    int end;
+    epsg_cursor_init (&cursor);
+    end = cursor.dataset->count;
+    if (filter != GAIA_EPSG_ANY && filter != GAIA_EPSG_WGS84_ONLY
+	&& filter != GAIA_EPSG_NONE && filter != GAIA_EPSG_LAZY)
+      {
+	  /* direct lookup of a single SRID */
+	  begin = epsg_packed_find (cursor.dataset, filter);
+	  if (begin < 0)
+	      return;
+	  end = begin + 1;
+      }
+    for (i = begin; i < end; i++)
+      {
+	  if (!epsg_packed_filter (filter, cursor.dataset->defs + i))
+	      continue;
+	  if (!epsg_cursor_row (&cursor, i, &row))
+	      break;
+	  p = add_epsg_def_ex (GAIA_EPSG_ANY, first, last, row.srid,
+			       row.auth_name, row.auth_srid, row.ref_sys_name,
+			       row.is_geographic, row.flipped_axes,
+			       row.spheroid, row.prime_meridian, row.datum,
+			       row.projection, row.unit, row.axis_1,
+			       row.orientation_1, row.axis_2,
+			       row.orientation_2);
+	  add_proj4text (p, 0, row.proj4text);
+	  add_srs_wkt (p, 0, row.srs_wkt);
+      }
+    epsg_cursor_reset (&cursor);
+}
+
+SPATIALITE_PRIVATE char *
+epsg_get_proj4text (int srid)
+{
+/* returning the PROJ params of some built-in EPSG def (if any) */
+    struct epsg_packed_cursor cursor;
+    struct epsg_defs row;
+    char *proj4text = NULL;
+    int i;
+    epsg_cursor_init (&cursor);
+    i = epsg_packed_find (cursor.dataset, srid);
+    if (i >= 0 && epsg_cursor_row (&cursor, i, &row))
+      {
+	  if (row.proj4text != NULL && *(row.proj4text) != '\0')
+	    {
+		proj4text = malloc (strlen (row.proj4text) + 1);
+		strcpy (proj4text, row.proj4text);
+	    }
+      }
+    epsg_cursor_reset (&cursor);
+    return proj4text;
+}
+
 static void
 create_spatial_ref_sys_aux (sqlite3 * handle)
 {
@@ -415,32 +631,68 @@ create_spatial_ref_sys_aux (sqlite3 * handle)
 }
 
 static int
-populate_spatial_ref_sys (sqlite3 * handle, int mode)
+create_spatial_ref_sys_lazy (sqlite3 * handle)
 {
-/* populating the EPSG dataset into the SPATIAL_REF_SYS table */
-    struct epsg_defs *first = NULL;
-    struct epsg_defs *last = NULL;
-    struct epsg_defs *p;
-    char sql[1024];
-    int ret;
-    sqlite3_stmt *stmt = NULL;
-    sqlite3_stmt *stmt_aux = NULL;
-    int ok_aux;
+/* 
+/ creating the SPATIAL_REF_SYS_LAZY table: it marks a "lazy" DB, whose
+/ SPATIAL_REF_SYS only contains the EPSG defs actually used
+*/
+    const char *sql = "CREATE TABLE IF NOT EXISTS spatial_ref_sys_lazy (\n"
+	"\tenabled INTEGER NOT NULL CONSTRAINT ck_srs_lazy "
+	"CHECK (enabled IN (0, 1)))";
+    int ret = sqlite3_exec (handle, sql, NULL, NULL, NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    sql = "INSERT INTO spatial_ref_sys_lazy (enabled) VALUES (1)";
+    ret = sqlite3_exec (handle, sql, NULL, NULL, NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    return 1;
+}
 
-/* initializing the EPSG defs list */
-    initialize_epsg (mode, &first, &last);
+SPATIALITE_PRIVATE int
+epsg_lazy_mode (void *p_sqlite)
+{
+/* 
+/ checking if the DB was initialized in "lazy" mode
+/ returns 1 only if SPATIAL_REF_SYS_LAZY exists and is enabled
+*/
+    sqlite3 *handle = (sqlite3 *) p_sqlite;
+    sqlite3_stmt *stmt = NULL;
+    int lazy = 0;
+    int ret = sqlite3_prepare_v2 (handle,
+				  "SELECT enabled FROM spatial_ref_sys_lazy",
+				  -1, &stmt, NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    while (sqlite3_step (stmt) == SQLITE_ROW)
+      {
+	  if (sqlite3_column_int (stmt, 0) == 1)
+	      lazy = 1;
+      }
+    sqlite3_finalize (stmt);
+    return lazy;
+}
 
-    create_spatial_ref_sys_aux (handle);
+static int
+prepare_epsg_inserts (sqlite3 * handle, sqlite3_stmt ** stmt,
+		      sqlite3_stmt ** stmt_aux)
+{
+/* preparing the SQL parameterized statements */
+    char sql[1024];
+    int ret;
+    *stmt = NULL;
+    *stmt_aux = NULL;
 /* preparing the SQL parameterized statement (main) */
     strcpy (sql, "INSERT INTO spatial_ref_sys ");
     strcat (sql,
 	    "(srid, auth_name, auth_srid, ref_sys_name, proj4text, srtext) ");
     strcat (sql, "VALUES (?, ?, ?, ?, ?, ?)");
-    ret = sqlite3_prepare_v2 (handle, sql, strlen (sql), &stmt, NULL);
+    ret = sqlite3_prepare_v2 (handle, sql, strlen (sql), stmt, NULL);
     if (ret != SQLITE_OK)
       {
 	  spatialite_e ("%s\n", sqlite3_errmsg (handle));
-	  goto error;
+	  return 0;
       }
 /* preparing the SQL parameterized statement (aux) */
     strcpy (sql, "INSERT INTO spatial_ref_sys_aux ");
@@ -449,163 +701,146 @@ populate_spatial_ref_sys (sqlite3 * handle, int mode)
     strcat (sql, "datum, projection, unit, axis_1_name, axis_1_orientation, ");
     strcat (sql, "axis_2_name, axis_2_orientation) ");
     strcat (sql, "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
-    ret = sqlite3_prepare_v2 (handle, sql, strlen (sql), &stmt_aux, NULL);
+    ret = sqlite3_prepare_v2 (handle, sql, strlen (sql), stmt_aux, NULL);
     if (ret != SQLITE_OK)
       {
 	  spatialite_e ("%s\n", sqlite3_errmsg (handle));
-	  goto error;
+	  sqlite3_finalize (*stmt);
+	  *stmt = NULL;
+	  return 0;
       }
+    return 1;
+}
 
-    p = first;
-    while (p)
+static int
+bind_epsg_aux_text (sqlite3_stmt * stmt_aux, int icol, const char *value)
+{
+/* binding a SPATIAL_REF_SYS_AUX text value */
+    if (value == NULL)
       {
-	  if (p->auth_name == NULL)
-	      break;
-	  /* inserting into SPATIAL_REF_SYS */
-	  sqlite3_reset (stmt);
-	  sqlite3_clear_bindings (stmt);
-	  sqlite3_bind_int (stmt, 1, p->srid);
-	  sqlite3_bind_text (stmt, 2, p->auth_name, strlen (p->auth_name),
-			     SQLITE_STATIC);
-	  sqlite3_bind_int (stmt, 3, p->auth_srid);
-	  sqlite3_bind_text (stmt, 4, p->ref_sys_name, strlen (p->ref_sys_name),
-			     SQLITE_STATIC);
-	  sqlite3_bind_text (stmt, 5, p->proj4text, strlen (p->proj4text),
-			     SQLITE_STATIC);
-	  if (strlen (p->srs_wkt) == 0)
-	      sqlite3_bind_text (stmt, 6, "Undefined", 9, SQLITE_STATIC);
-	  else
-	      sqlite3_bind_text (stmt, 6, p->srs_wkt, strlen (p->srs_wkt),
-				 SQLITE_STATIC);
-	  ret = sqlite3_step (stmt);
+	  sqlite3_bind_null (stmt_aux, icol);
+	  return 0;
+      }
+    sqlite3_bind_text (stmt_aux, icol, value, strlen (value), SQLITE_STATIC);
+    return 1;
+}
+
+static int
+insert_epsg_def (sqlite3 * handle, sqlite3_stmt * stmt,
+		 sqlite3_stmt * stmt_aux, struct epsg_defs *p)
+{
+/* inserting an EPSG def into SPATIAL_REF_SYS and SPATIAL_REF_SYS_AUX */
+    int ret;
+    int ok_aux = 0;
+
+/* inserting into SPATIAL_REF_SYS */
+    sqlite3_reset (stmt);
+    sqlite3_clear_bindings (stmt);
+    sqlite3_bind_int (stmt, 1, p->srid);
+    sqlite3_bind_text (stmt, 2, p->auth_name, strlen (p->auth_name),
+		       SQLITE_STATIC);
+    sqlite3_bind_int (stmt, 3, p->auth_srid);
+    sqlite3_bind_text (stmt, 4, p->ref_sys_name, strlen (p->ref_sys_name),
+		       SQLITE_STATIC);
+    sqlite3_bind_text (stmt, 5, p->proj4text, strlen (p->proj4text),
+		       SQLITE_STATIC);
+    if (strlen (p->srs_wkt) == 0)
+	sqlite3_bind_text (stmt, 6, "Undefined", 9, SQLITE_STATIC);
+    else
+	sqlite3_bind_text (stmt, 6, p->srs_wkt, strlen (p->srs_wkt),
+			   SQLITE_STATIC);
+    ret = sqlite3_step (stmt);
+    if (ret == SQLITE_DONE || ret == SQLITE_ROW)
+	;
+    else
+      {
+	  spatialite_e ("%s\n", sqlite3_errmsg (handle));
+	  return 0;
+      }
+
+/* inserting into SPATIAL_REF_SYS_AUX */
+    sqlite3_reset (stmt_aux);
+    sqlite3_clear_bindings (stmt_aux);
+    sqlite3_bind_int (stmt_aux, 1, p->srid);
+    if (p->is_geographic < 0)
+	sqlite3_bind_null (stmt_aux, 2);
+    else
+      {
+	  sqlite3_bind_int (stmt_aux, 2, p->is_geographic);
+	  ok_aux = 1;
+      }
+    if (p->flipped_axes < 0)
+	sqlite3_bind_null (stmt_aux, 3);
+    else
+      {
+	  sqlite3_bind_int (stmt_aux, 3, p->flipped_axes);
+	  ok_aux = 1;
+      }
+    ok_aux |= bind_epsg_aux_text (stmt_aux, 4, p->spheroid);
+    ok_aux |= bind_epsg_aux_text (stmt_aux, 5, p->prime_meridian);
+    ok_aux |= bind_epsg_aux_text (stmt_aux, 6, p->datum);
+    ok_aux |= bind_epsg_aux_text (stmt_aux, 7, p->projection);
+    ok_aux |= bind_epsg_aux_text (stmt_aux, 8, p->unit);
+    ok_aux |= bind_epsg_aux_text (stmt_aux, 9, p->axis_1);
+    ok_aux |= bind_epsg_aux_text (stmt_aux, 10, p->orientation_1);
+    ok_aux |= bind_epsg_aux_text (stmt_aux, 11, p->axis_2);
+    ok_aux |= bind_epsg_aux_text (stmt_aux, 12, p->orientation_2);
+    if (ok_aux)
+      {
+	  ret = sqlite3_step (stmt_aux);
 	  if (ret == SQLITE_DONE || ret == SQLITE_ROW)
 	      ;
 	  else
 	    {
 		spatialite_e ("%s\n", sqlite3_errmsg (handle));
-		goto error;
+		return 0;
 	    }
+      }
+    return 1;
+}
 
-	  /* inserting into SPATIAL_REF_SYS_AUX */
-	  ok_aux = 0;
-	  sqlite3_reset (stmt_aux);
-	  sqlite3_clear_bindings (stmt_aux);
-	  sqlite3_bind_int (stmt_aux, 1, p->srid);
-	  if (p->is_geographic < 0)
-	      sqlite3_bind_null (stmt_aux, 2);
-	  else
-	    {
-		sqlite3_bind_int (stmt_aux, 2, p->is_geographic);
-		ok_aux = 1;
-	    }
-	  if (p->flipped_axes < 0)
-	      sqlite3_bind_null (stmt_aux, 3);
-	  else
-	    {
-		sqlite3_bind_int (stmt_aux, 3, p->flipped_axes);
-		ok_aux = 1;
-	    }
-	  if (p->spheroid == NULL)
-	      sqlite3_bind_null (stmt_aux, 4);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 4, p->spheroid,
-				   strlen (p->spheroid), SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (p->prime_meridian == NULL)
-	      sqlite3_bind_null (stmt_aux, 5);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 5, p->prime_meridian,
-				   strlen (p->prime_meridian), SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (p->datum == NULL)
-	      sqlite3_bind_null (stmt_aux, 6);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 6, p->datum, strlen (p->datum),
-				   SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (p->projection == NULL)
-	      sqlite3_bind_null (stmt_aux, 7);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 7, p->projection,
-				   strlen (p->projection), SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (p->unit == NULL)
-	      sqlite3_bind_null (stmt_aux, 8);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 8, p->unit, strlen (p->unit),
-				   SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (p->axis_1 == NULL)
-	      sqlite3_bind_null (stmt_aux, 9);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 9, p->axis_1, strlen (p->axis_1),
-				   SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (p->orientation_1 == NULL)
-	      sqlite3_bind_null (stmt_aux, 10);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 10, p->orientation_1,
-				   strlen (p->orientation_1), SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (p->axis_2 == NULL)
-	      sqlite3_bind_null (stmt_aux, 11);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 11, p->axis_2, strlen (p->axis_2),
-				   SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (p->orientation_2 == NULL)
-	      sqlite3_bind_null (stmt_aux, 12);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 12, p->orientation_2,
-				   strlen (p->orientation_2), SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (ok_aux)
-	    {
-		ret = sqlite3_step (stmt_aux);
-		if (ret == SQLITE_DONE || ret == SQLITE_ROW)
-		    ;
-		else
-		  {
-		      spatialite_e ("%s\n", sqlite3_errmsg (handle));
-		      goto error;
-		  }
-	    }
-	  p = p->next;
+static int
+populate_spatial_ref_sys (sqlite3 * handle, int mode)
+{
+/* 
+/ populating the EPSG dataset into the SPATIAL_REF_SYS table
+/ rows are directly streamed from the built-in EPSG dataset
+*/
+    struct epsg_packed_cursor cursor;
+    struct epsg_defs row;
+    sqlite3_stmt *stmt = NULL;
+    sqlite3_stmt *stmt_aux = NULL;
+    int i;
+    int ok = 0;
+
+    create_spatial_ref_sys_aux (handle);
+    if (mode == GAIA_EPSG_LAZY)
+      {
+	  if (!create_spatial_ref_sys_lazy (handle))
+	      return 0;
       }
-    sqlite3_finalize (stmt);
-    sqlite3_finalize (stmt_aux);
+    if (!prepare_epsg_inserts (handle, &stmt, &stmt_aux))
+	return 0;
 
-/* freeing the EPSG defs list */
-    free_epsg (first);
-    return 1;
+    epsg_cursor_init (&cursor);
+    for (i = 0; i < cursor.dataset->count; i++)
+      {
+	  if (!epsg_packed_filter (mode, cursor.dataset->defs + i))
+	      continue;
+	  if (!epsg_cursor_row (&cursor, i, &row))
+	      goto error;
+	  if (row.auth_name == NULL)
+	      continue;
+	  if (!insert_epsg_def (handle, stmt, stmt_aux, &row))
+	      goto error;
+      }
+    ok = 1;
 
   error:
-    if (stmt)
-	sqlite3_finalize (stmt);
-    if (stmt_aux)
-	sqlite3_finalize (stmt_aux);
-/* freeing the EPSG defs list */
-    free_epsg (first);
-
-    return 0;
+    epsg_cursor_reset (&cursor);
+    sqlite3_finalize (stmt);
+    sqlite3_finalize (stmt_aux);
+    return ok;
 }
 
 SPATIALITE_PRIVATE int
@@ -768,7 +1003,7 @@ spatial_ref_sys_init2 (sqlite3 * handle, int mode, int verbose)
 	  return 0;
       }
     if (mode == GAIA_EPSG_ANY || mode == GAIA_EPSG_NONE
-	|| mode == GAIA_EPSG_WGS84_ONLY)
+	|| mode == GAIA_EPSG_WGS84_ONLY || mode == GAIA_EPSG_LAZY)
 	;
     else
 	mode = GAIA_EPSG_ANY;
@@ -782,18 +1017,34 @@ spatial_ref_sys_init2 (sqlite3 * handle, int mode, int verbose)
     return 0;
 }
 
+static int
+insert_epsg_row (sqlite3 * handle, struct epsg_packed_cursor *cursor,
+		 int index)
+{
+/* inserting a single built-in EPSG def into the SPATIAL_REF_SYS table */
+    struct epsg_defs row;
+    sqlite3_stmt *stmt = NULL;
+    sqlite3_stmt *stmt_aux = NULL;
+    int ok;
+
+    if (!epsg_cursor_row (cursor, index, &row))
+	return 0;
+    create_spatial_ref_sys_aux (handle);
+    if (!prepare_epsg_inserts (handle, &stmt, &stmt_aux))
+	return 0;
+    ok = insert_epsg_def (handle, stmt, stmt_aux, &row);
+    sqlite3_finalize (stmt);
+    sqlite3_finalize (stmt_aux);
+    return ok;
+}
+
 SPATIALITE_DECLARE int
 insert_epsg_srid (sqlite3 * handle, int srid)
 {
 /* inserting a single EPSG definition into the SPATIAL_REF_SYS table */
-    struct epsg_defs *first = NULL;
-    struct epsg_defs *last = NULL;
-    char sql[1024];
-    int ret;
-    int error = 0;
-    sqlite3_stmt *stmt = NULL;
-    sqlite3_stmt *stmt_aux = NULL;
-    int ok_aux;
+    struct epsg_packed_cursor cursor;
+    int i;
+    int ok;
 
     if (!exists_spatial_ref_sys (handle))
       {
@@ -807,180 +1058,57 @@ insert_epsg_srid (sqlite3 * handle, int srid)
 	  return 0;
       }
 
-/* initializing the EPSG defs list */
-    initialize_epsg (srid, &first, &last);
-    if (first == NULL)
+/* directly searching the built-in EPSG dataset */
+    epsg_cursor_init (&cursor);
+    i = epsg_packed_find (cursor.dataset, srid);
+    if (i < 0)
       {
-	  spatialite_e ("SRID=%d isn't defined in the EPSG inlined dataset\n",
+	  spatialite_e ("SRID=%d isn't defined in the built-in EPSG dataset\n",
 			srid);
 	  return 0;
       }
+    ok = insert_epsg_row (handle, &cursor, i);
+    epsg_cursor_reset (&cursor);
+    return ok;
+}
 
-    create_spatial_ref_sys_aux (handle);
-/* preparing the SQL parameterized statement */
-    strcpy (sql, "INSERT INTO spatial_ref_sys ");
-    strcat (sql,
-	    "(srid, auth_name, auth_srid, ref_sys_name, proj4text, srtext) ");
-    strcat (sql, "VALUES (?, ?, ?, ?, ?, ?)");
-    ret = sqlite3_prepare_v2 (handle, sql, strlen (sql), &stmt, NULL);
-    if (ret != SQLITE_OK)
-      {
-	  spatialite_e ("%s\n", sqlite3_errmsg (handle));
-	  error = 1;
-	  goto stop;
-      }
-/* preparing the SQL parameterized statement (aux) */
-    strcpy (sql, "INSERT INTO spatial_ref_sys_aux ");
-    strcat (sql,
-	    "(srid, is_geographic, has_flipped_axes, spheroid, prime_meridian, ");
-    strcat (sql, "datum, projection, unit, axis_1_name, axis_1_orientation, ");
-    strcat (sql, "axis_2_name, axis_2_orientation) ");
-    strcat (sql, "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
-    ret = sqlite3_prepare_v2 (handle, sql, strlen (sql), &stmt_aux, NULL);
-    if (ret != SQLITE_OK)
-      {
-	  spatialite_e ("%s\n", sqlite3_errmsg (handle));
-	  error = 1;
-	  goto stop;
-      }
-
-    /* inserting into SPATIAL_REF_SYS_AUX */
-    sqlite3_reset (stmt);
-    sqlite3_clear_bindings (stmt);
-    sqlite3_bind_int (stmt, 1, first->srid);
-    sqlite3_bind_text (stmt, 2, first->auth_name, strlen (first->auth_name),
-		       SQLITE_STATIC);
-    sqlite3_bind_int (stmt, 3, first->auth_srid);
-    sqlite3_bind_text (stmt, 4, first->ref_sys_name,
-		       strlen (first->ref_sys_name), SQLITE_STATIC);
-    sqlite3_bind_text (stmt, 5, first->proj4text, strlen (first->proj4text),
-		       SQLITE_STATIC);
-    if (strlen (first->srs_wkt) == 0)
-	sqlite3_bind_text (stmt, 6, "Undefined", 9, SQLITE_STATIC);
-    else
-	sqlite3_bind_text (stmt, 6, first->srs_wkt, strlen (first->srs_wkt),
-			   SQLITE_STATIC);
-    ret = sqlite3_step (stmt);
-    if (ret == SQLITE_DONE || ret == SQLITE_ROW)
-	;
-    else
-      {
-	  spatialite_e ("%s\n", sqlite3_errmsg (handle));
-	  error = 1;
-	  goto stop;
-      }
-
-    /* inserting into SPATIAL_REF_SYS_AUX */
-    ok_aux = 0;
-    sqlite3_reset (stmt_aux);
-    sqlite3_clear_bindings (stmt_aux);
-    sqlite3_bind_int (stmt_aux, 1, first->srid);
-    if (first->is_geographic < 0)
-	sqlite3_bind_null (stmt_aux, 2);
-    else
-      {
-	  sqlite3_bind_int (stmt_aux, 2, first->is_geographic);
-	  ok_aux = 1;
-      }
-    if (first->flipped_axes < 0)
-	sqlite3_bind_null (stmt_aux, 3);
-    else
-      {
-	  sqlite3_bind_int (stmt_aux, 3, first->flipped_axes);
-	  ok_aux = 1;
-      }
-    if (first->spheroid == NULL)
-	sqlite3_bind_null (stmt_aux, 4);
-    else
-      {
-	  sqlite3_bind_text (stmt_aux, 4, first->spheroid,
-			     strlen (first->spheroid), SQLITE_STATIC);
-	  ok_aux = 1;
-      }
-    if (first->prime_meridian == NULL)
-	sqlite3_bind_null (stmt_aux, 5);
-    else
-      {
-	  sqlite3_bind_text (stmt_aux, 5, first->prime_meridian,
-			     strlen (first->prime_meridian), SQLITE_STATIC);
-	  ok_aux = 1;
-      }
-    if (first->datum == NULL)
-	sqlite3_bind_null (stmt_aux, 6);
-    else
-      {
-	  sqlite3_bind_text (stmt_aux, 6, first->datum, strlen (first->datum),
-			     SQLITE_STATIC);
-	  ok_aux = 1;
-      }
-    if (first->projection == NULL)
-	sqlite3_bind_null (stmt_aux, 7);
-    else
-      {
-	  sqlite3_bind_text (stmt_aux, 7, first->projection,
-			     strlen (first->projection), SQLITE_STATIC);
-	  ok_aux = 1;
-      }
-    if (first->unit == NULL)
-	sqlite3_bind_null (stmt_aux, 8);
-    else
-      {
-	  sqlite3_bind_text (stmt_aux, 8, first->unit, strlen (first->unit),
-			     SQLITE_STATIC);
-	  ok_aux = 1;
-      }
-    if (first->axis_1 == NULL)
-	sqlite3_bind_null (stmt_aux, 9);
-    else
-      {
-	  sqlite3_bind_text (stmt_aux, 9, first->axis_1, strlen (first->axis_1),
-			     SQLITE_STATIC);
-	  ok_aux = 1;
-      }
-    if (first->orientation_1 == NULL)
-	sqlite3_bind_null (stmt_aux, 10);
-    else
-      {
-	  sqlite3_bind_text (stmt_aux, 10, first->orientation_1,
-			     strlen (first->orientation_1), SQLITE_STATIC);
-	  ok_aux = 1;
-      }
-    if (first->axis_2 == NULL)
-	sqlite3_bind_null (stmt_aux, 11);
-    else
-      {
-	  sqlite3_bind_text (stmt_aux, 11, first->axis_2,
-			     strlen (first->axis_2), SQLITE_STATIC);
-	  ok_aux = 1;
-      }
-    if (first->orientation_2 == NULL)
-	sqlite3_bind_null (stmt_aux, 11);
-    else
-      {
-	  sqlite3_bind_text (stmt_aux, 11, first->orientation_2,
-			     strlen (first->orientation_2), SQLITE_STATIC);
-	  ok_aux = 1;
-      }
-    if (ok_aux)
-      {
-	  ret = sqlite3_step (stmt_aux);
-	  if (ret == SQLITE_DONE || ret == SQLITE_ROW)
-	      ;
-	  else
-	    {
-		spatialite_e ("%s\n", sqlite3_errmsg (handle));
-		goto stop;
-	    }
-      }
-  stop:
-    if (stmt != NULL)
-	sqlite3_finalize (stmt);
-    if (stmt_aux != NULL)
-	sqlite3_finalize (stmt_aux);
+SPATIALITE_PRIVATE int
+epsg_materialize_srid (void *p_sqlite, int srid)
+{
+/* 
+/ inserting on demand a built-in EPSG def into the SPATIAL_REF_SYS table
+/ (only for "lazy" DBs containing just the SRIDs actually used: any
+/ other DB is left untouched)
+/ returns 1 if a new row has been inserted, 0 otherwise
+*/
+    sqlite3 *handle = (sqlite3 *) p_sqlite;
+    struct epsg_packed_cursor cursor;
+    sqlite3_stmt *stmt = NULL;
+    int i;
+    int ret;
+    int exists = 1;
+    int ok = 0;
 
-/* freeing the EPSG defs list */
-    free_epsg (first);
-    if (error)
+    if (!epsg_lazy_mode (handle))
 	return 0;
-    return 1;
+    if (!check_spatial_ref_sys (handle))
+	return 0;
+    epsg_cursor_init (&cursor);
+    i = epsg_packed_find (cursor.dataset, srid);
+    if (i < 0)
+	return 0;
+    ret =
+	sqlite3_prepare_v2 (handle,
+			    "SELECT srid FROM spatial_ref_sys WHERE srid = ?",
+			    -1, &stmt, NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    sqlite3_bind_int (stmt, 1, srid);
+    if (sqlite3_step (stmt) == SQLITE_DONE)
+	exists = 0;
+    sqlite3_finalize (stmt);
+    if (!exists)
+	ok = insert_epsg_row (handle, &cursor, i);
+    epsg_cursor_reset (&cursor);
+    return ok;
 }
@@ -1383,6 +1383,120 @@ test_clone_table (int base, int with_extra, int ignore, int resequence,
 }
 
 
+int
+test_cluster_geo_table (int base)
+{
+/* performing a ClusterGeoTable testcase */
+    int ret;
+    int i;
+    sqlite3 *handle;
+    char *err_msg = NULL;
+    const char *sql;
+    int retcode = 0;
+    void *cache = spatialite_alloc_connection ();
+    const char *checks[] = {
+	"SELECT ClusterGeoTable('towns', 'geom') = 0",
+	"SELECT ClusterGeoTable('parcels', 'geom')",
+	"SELECT CheckSpatialIndex('parcels', 'geom')",
+	"SELECT Count(*) = 400 FROM parcels WHERE name = 'n' || Substr(code, 2) "
+	    "AND X(geom) = (CAST(Substr(code, 2) AS INTEGER) * 37) % 100",
+	"SELECT Count(*) = 400 FROM parcels AS p JOIN owners AS o "
+	    "ON (o.parcel = p.code AND o.id = CAST(Substr(p.code, 2) AS INTEGER))",
+	"SELECT ClusterGeoTable('towns', 'geom', 1)",
+	"SELECT CheckSpatialIndex('towns', 'geom')",
+	"SELECT Count(*) = 400 FROM towns AS t JOIN mayors AS m "
+	    "ON (m.town = t.id AND t.name = 't' || m.id)",
+	"SELECT Max(id) = 400 AND Min(id) = 1 FROM towns",
+	"SELECT Count(*) = 1 FROM ("
+	    "SELECT t1.id FROM towns AS t1 JOIN towns AS t2 ON (t2.id = t1.id + 1) "
+	    "WHERE t1.id = 1 AND Distance(t1.geom, t2.geom) < 10)",
+	NULL
+    };
+
+    ret =
+	sqlite3_open_v2 (":memory:", &handle,
+			 SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open in-memory database: %s\n",
+		   sqlite3_errmsg (handle));
+	  sqlite3_close (handle);
+	  retcode = -1;
+	  goto end;
+      }
+
+    spatialite_init_ex (handle, cache, 0);
+
+    ret =
+	sqlite3_exec (handle, "SELECT InitSpatialMetadata(1)", NULL, NULL,
+		      &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "InitSpatialMetadata() error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  sqlite3_close (handle);
+	  retcode = -2;
+	  goto end;
+      }
+
+/* creating and populating the input tables */
+    sql = "CREATE TABLE parcels (code TEXT NOT NULL PRIMARY KEY, name TEXT);"
+	"SELECT AddGeometryColumn('parcels', 'geom', 4326, 'POINT', 'XY');"
+	"SELECT CreateSpatialIndex('parcels', 'geom');"
+	"CREATE TABLE owners (id INTEGER PRIMARY KEY, "
+	"parcel TEXT REFERENCES parcels (code));"
+	"CREATE TABLE towns (id INTEGER PRIMARY KEY AUTOINCREMENT, name TEXT);"
+	"SELECT AddGeometryColumn('towns', 'geom', 4326, 'POINT', 'XY');"
+	"SELECT CreateSpatialIndex('towns', 'geom');"
+	"CREATE TABLE mayors (id INTEGER PRIMARY KEY, "
+	"town INTEGER REFERENCES towns (id));"
+	"WITH RECURSIVE seq(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM seq "
+	"WHERE i < 400) INSERT INTO parcels (code, name, geom) "
+	"SELECT 'P' || i, 'n' || i, MakePoint((i * 37) % 100, (i * 91) % 97, 4326) "
+	"FROM seq;"
+	"INSERT INTO owners (id, parcel) SELECT CAST(Substr(code, 2) AS INTEGER), "
+	"code FROM parcels;"
+	"INSERT INTO towns (name, geom) SELECT 't' || ROWID, geom FROM parcels;"
+	"INSERT INTO mayors (id, town) SELECT id, id FROM towns";
+    ret = sqlite3_exec (handle, sql, NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  retcode = -3;
+	  goto end;
+      }
+
+    for (i = 0; checks[i] != NULL; i++)
+      {
+	  ret = execute_check (handle, checks[i], &err_msg);
+	  if (ret != SQLITE_OK)
+	    {
+		fprintf (stderr, "Error: %s\n%s\n", checks[i], err_msg);
+		sqlite3_free (err_msg);
+		retcode = -4 - i;
+		goto end;
+	    }
+      }
+
+    ret = sqlite3_close (handle);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "sqlite3_close() error: %s\n",
+		   sqlite3_errmsg (handle));
+	  retcode = -20;
+	  goto end;
+      }
+
+    spatialite_cleanup_ex (cache);
+
+  end:
+    if (retcode < 0)
+	return base + retcode;
+    return 0;
+}
+
+
 int
 main (int argc, char *argv[])
 {
@@ -1433,6 +1547,13 @@ main (int argc, char *argv[])
 	  retcode = ret;
 	  goto end;
       }
+/* clustering test */
+    ret = test_cluster_geo_table (-500);
+    if (ret < 0)
+      {
+	  retcode = ret;
+	  goto end;
+      }
 
   end:
 /* removing the origin DB */
@@ -0,0 +1,646 @@
+/*
+
+ check_coords_kernels.c -- SpatiaLite Test Case
+
+ Author: Brad Hards <bradh@frogmouth.net>
+
+ ------------------------------------------------------------------------------
+
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+
+Portions created by the Initial Developer are Copyright (C) 2015
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+Brad Hards <bradh@frogmouth.net>
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+
+*/
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+#include "sqlite3.h"
+#include "spatialite.h"
+#include "spatialite/gaiageo.h"
+#include "spatialite/gaiamatrix.h"
+
+#define MAX_RESULTS	65536
+
+/* Z and M values poisoning any result if a kernel gets the stride wrong */
+#define POISON_Z	1.0e300
+#define POISON_M	-1.0e300
+
+struct kernel_results
+{
+/* all values computed by a single run of the coordinate kernels */
+    int count;
+    double values[MAX_RESULTS];
+};
+
+static unsigned int seed;
+
+static double
+next_value (void)
+{
+/* a repeatable pseudo-random coordinate */
+    seed = seed * 1103515245 + 12345;
+    return ((double) ((seed >> 8) % 2000001) - 1000000.0) / 1024.0;
+}
+
+static int
+coords_stride (int dims)
+{
+/* number of doubles for each vertex */
+    if (dims == GAIA_XY_Z || dims == GAIA_XY_M)
+	return 3;
+    if (dims == GAIA_XY_Z_M)
+	return 4;
+    return 2;
+}
+
+static gaiaGeomCollPtr
+alloc_geom (int dims)
+{
+/* allocating an empty Geometry of the required DimensionModel */
+    if (dims == GAIA_XY_Z)
+	return gaiaAllocGeomCollXYZ ();
+    if (dims == GAIA_XY_M)
+	return gaiaAllocGeomCollXYM ();
+    if (dims == GAIA_XY_Z_M)
+	return gaiaAllocGeomCollXYZM ();
+    return gaiaAllocGeomColl ();
+}
+
+static void
+fill_coords (double *coords, int points, int dims, int closed)
+{
+/*
+/ filling a Coords array: some X values are signed zeros, so to
+/ check the MBR tie-break as well
+*/
+    int iv;
+    int stride = coords_stride (dims);
+    double *p = coords;
+    int last = closed ? points - 1 : points;
+    for (iv = 0; iv < last; iv++, p += stride)
+      {
+	  p[0] = next_value ();
+	  p[1] = next_value ();
+	  if (iv % 7 == 3)
+	      p[0] = -0.0;
+	  if (iv % 7 == 4)
+	      p[0] = 0.0;
+	  if (dims == GAIA_XY_Z || dims == GAIA_XY_Z_M)
+	      p[2] = POISON_Z;
+	  if (dims == GAIA_XY_M)
+	      p[2] = POISON_M;
+	  if (dims == GAIA_XY_Z_M)
+	      p[3] = POISON_M;
+      }
+    if (closed)
+	memcpy (p, coords, sizeof (double) * stride);
+}
+
+static int
+check_zm (const double *coords, int points, int dims)
+{
+/* checking that no Z or M value has been touched */
+    int iv;
+    int stride = coords_stride (dims);
+    const double *p = coords;
+    for (iv = 0; iv < points; iv++, p += stride)
+      {
+	  if ((dims == GAIA_XY_Z || dims == GAIA_XY_Z_M) && p[2] != POISON_Z)
+	      return 0;
+	  if (dims == GAIA_XY_M && p[2] != POISON_M)
+	      return 0;
+	  if (dims == GAIA_XY_Z_M && p[3] != POISON_M)
+	      return 0;
+      }
+    return 1;
+}
+
+static int
+check_mbr (const double *coords, int points, int dims, double min_x,
+	   double min_y, double max_x, double max_y)
+{
+/* checking an MBR against a plain scan of the Coords */
+    int iv;
+    int stride = coords_stride (dims);
+    const double *p = coords;
+    double x0 = p[0];
+    double y0 = p[1];
+    double x1 = p[0];
+    double y1 = p[1];
+    for (iv = 1, p += stride; iv < points; iv++, p += stride)
+      {
+	  if (p[0] < x0)
+	      x0 = p[0];
+	  if (p[0] > x1)
+	      x1 = p[0];
+	  if (p[1] < y0)
+	      y0 = p[1];
+	  if (p[1] > y1)
+	      y1 = p[1];
+      }
+    return (min_x == x0 && min_y == y0 && max_x == x1 && max_y == y1);
+}
+
+static int
+close_enough (double value, double expected, double scale)
+{
+/* comparing with a tolerance relative to the magnitude of the operands */
+    return fabs (value - expected) <= 1e-12 * scale;
+}
+
+static void
+push_value (struct kernel_results *res, double value)
+{
+/* collecting a result */
+    if (res->count < MAX_RESULTS)
+	res->values[res->count] = value;
+    res->count++;
+}
+
+static void
+push_coords (struct kernel_results *res, const double *coords, int points,
+	     int dims)
+{
+/* collecting all the XY values of a Coords array */
+    int iv;
+    int stride = coords_stride (dims);
+    for (iv = 0; iv < points; iv++)
+      {
+	  push_value (res, coords[iv * stride]);
+	  push_value (res, coords[(iv * stride) + 1]);
+      }
+}
+
+static int
+test_linestring (struct kernel_results *res, int dims, int points)
+{
+/* MBR, length, shift, scale, rotate and affine on a Linestring */
+    gaiaGeomCollPtr geom;
+    gaiaGeomCollPtr result;
+    gaiaLinestringPtr line;
+    double *orig;
+    double *p;
+    double *q;
+    double length;
+    double expected;
+    double scale;
+    double dx;
+    double dy;
+    double angle;
+    unsigned char *blob;
+    int blob_sz;
+    int stride = coords_stride (dims);
+    int iv;
+    int ret = 0;
+
+    geom = alloc_geom (dims);
+    line = gaiaAddLinestringToGeomColl (geom, points);
+    fill_coords (line->Coords, points, dims, 0);
+    orig = malloc (sizeof (double) * stride * points);
+    memcpy (orig, line->Coords, sizeof (double) * stride * points);
+
+/* MBR */
+    gaiaMbrLinestring (line);
+    if (!check_mbr
+	(orig, points, dims, line->MinX, line->MinY, line->MaxX, line->MaxY))
+      {
+	  ret = -1;
+	  goto stop;
+      }
+    push_value (res, line->MinX);
+    push_value (res, line->MinY);
+    push_value (res, line->MaxX);
+    push_value (res, line->MaxY);
+
+/* length */
+    length = gaiaMeasureLength (line->DimensionModel, line->Coords,
+				line->Points);
+    expected = 0.0;
+    for (iv = 1; iv < points; iv++)
+      {
+	  dx = orig[iv * stride] - orig[(iv - 1) * stride];
+	  dy = orig[(iv * stride) + 1] - orig[((iv - 1) * stride) + 1];
+	  expected += sqrt ((dx * dx) + (dy * dy));
+      }
+    if (!close_enough (length, expected, expected))
+      {
+	  ret = -2;
+	  goto stop;
+      }
+    push_value (res, length);
+
+/* shift and scale: exactly the same IEEE operations */
+    gaiaShiftCoords (geom, 1.5, -2.25);
+    gaiaScaleCoords (geom, 2.0, 0.5);
+    for (iv = 0; iv < points; iv++)
+      {
+	  p = line->Coords + (iv * stride);
+	  q = orig + (iv * stride);
+	  if (p[0] != (q[0] + 1.5) * 2.0 || p[1] != (q[1] + -2.25) * 0.5)
+	    {
+		ret = -3;
+		goto stop;
+	    }
+	  q[0] = p[0];
+	  q[1] = p[1];
+      }
+    if (!check_zm (line->Coords, points, dims))
+      {
+	  ret = -4;
+	  goto stop;
+      }
+    push_coords (res, line->Coords, points, dims);
+
+/* rotate */
+    gaiaRotateCoords (geom, 30.0);
+    angle = 30.0 * 3.14159265358979323846 / 180.0;
+    for (iv = 0; iv < points; iv++)
+      {
+	  p = line->Coords + (iv * stride);
+	  q = orig + (iv * stride);
+	  scale = fabs (q[0]) + fabs (q[1]);
+	  if (!close_enough
+	      (p[0], (q[0] * cos (angle)) + (q[1] * sin (angle)), scale)
+	      || !close_enough (p[1],
+				(q[1] * cos (angle)) - (q[0] * sin (angle)),
+				scale))
+	    {
+		ret = -5;
+		goto stop;
+	    }
+	  q[0] = p[0];
+	  q[1] = p[1];
+      }
+    if (!check_zm (line->Coords, points, dims))
+      {
+	  ret = -6;
+	  goto stop;
+      }
+    push_coords (res, line->Coords, points, dims);
+
+/* 2D affine transform */
+    if (!gaia_matrix_create
+	(0.8, -0.6, 0.0, 0.6, 0.8, 0.0, 0.0, 0.0, 1.0, 10.0, -20.0, 0.0, &blob,
+	 &blob_sz))
+      {
+	  ret = -7;
+	  goto stop;
+      }
+    result = gaia_matrix_transform_geometry (geom, blob, blob_sz);
+    free (blob);
+    if (result == NULL || result->FirstLinestring == NULL
+	|| result->FirstLinestring->Points != points
+	|| result->FirstLinestring->DimensionModel != dims)
+      {
+	  if (result != NULL)
+	      gaiaFreeGeomColl (result);
+	  ret = -8;
+	  goto stop;
+      }
+    for (iv = 0; iv < points; iv++)
+      {
+	  p = result->FirstLinestring->Coords + (iv * stride);
+	  q = orig + (iv * stride);
+	  scale = fabs (q[0]) + fabs (q[1]) + 20.0;
+	  if (!close_enough (p[0], (0.8 * q[0]) + (-0.6 * q[1]) + 10.0, scale)
+	      || !close_enough (p[1], (0.6 * q[0]) + (0.8 * q[1]) + -20.0,
+				scale))
+	    {
+		gaiaFreeGeomColl (result);
+		ret = -9;
+		goto stop;
+	    }
+      }
+    if (!check_zm (result->FirstLinestring->Coords, points, dims))
+      {
+	  gaiaFreeGeomColl (result);
+	  ret = -10;
+	  goto stop;
+      }
+    push_coords (res, result->FirstLinestring->Coords, points, dims);
+    gaiaFreeGeomColl (result);
+
+  stop:
+    free (orig);
+    gaiaFreeGeomColl (geom);
+    return ret;
+}
+
+static int
+test_ring (struct kernel_results *res, int dims, int points)
+{
+/* MBR and area of a closed Ring */
+    gaiaGeomCollPtr geom;
+    gaiaPolygonPtr polyg;
+    gaiaRingPtr ring;
+    double area;
+    double expected = 0.0;
+    double scale = 0.0;
+    double term;
+    int stride = coords_stride (dims);
+    int iv;
+    int ret = 0;
+    const double *p;
+
+    geom = alloc_geom (dims);
+    polyg = gaiaAddPolygonToGeomColl (geom, points, 0);
+    ring = polyg->Exterior;
+    fill_coords (ring->Coords, points, dims, 1);
+
+    gaiaMbrRing (ring);
+    if (!check_mbr
+	(ring->Coords, points, dims, ring->MinX, ring->MinY, ring->MaxX,
+	 ring->MaxY))
+      {
+	  ret = -11;
+	  goto stop;
+      }
+    push_value (res, ring->MinX);
+    push_value (res, ring->MinY);
+    push_value (res, ring->MaxX);
+    push_value (res, ring->MaxY);
+
+    area = gaiaMeasureArea (ring);
+    for (iv = 1; iv < points; iv++)
+      {
+	  p = ring->Coords + (iv * stride);
+	  term = (p[-stride] * p[1]) - (p[0] * p[1 - stride]);
+	  expected += term;
+	  scale += fabs (term);
+      }
+    expected = fabs (expected / 2.0);
+    if (!close_enough (area, expected, scale))
+      {
+	  ret = -12;
+	  goto stop;
+      }
+    push_value (res, area);
+
+  stop:
+    gaiaFreeGeomColl (geom);
+    return ret;
+}
+
+static int
+test_distance_matrix (struct kernel_results *res, int points)
+{
+/* Great Circle distances between a few Points and a set of Points */
+    double a = 6378137.0;
+    double b = 6356752.314245;
+    double coords1[6];
+    double *coords2;
+    double *matrix;
+    double expected;
+    int i;
+    int j;
+    int ret = 0;
+
+    coords2 = malloc (sizeof (double) * 2 * points);
+    matrix = malloc (sizeof (double) * 3 * points);
+    for (i = 0; i < 3; i++)
+      {
+	  coords1[i * 2] = next_value () / 5.5;
+	  coords1[(i * 2) + 1] = next_value () / 11.0;
+      }
+    for (j = 0; j < points; j++)
+      {
+	  coords2[j * 2] = next_value () / 5.5;
+	  coords2[(j * 2) + 1] = next_value () / 11.0;
+      }
+    if (!gaiaGreatCircleDistanceMatrix (a, b, coords1, 3, coords2, points,
+					matrix))
+      {
+	  ret = -13;
+	  goto stop;
+      }
+    for (i = 0; i < 3; i++)
+      {
+	  for (j = 0; j < points; j++)
+	    {
+		expected =
+		    gaiaGreatCircleDistance (a, b, coords1[(i * 2) + 1],
+					     coords1[i * 2],
+					     coords2[(j * 2) + 1],
+					     coords2[j * 2]);
+		if (fabs (matrix[(i * points) + j] - expected) >
+		    1e-9 * expected + 1e-6)
+		  {
+		      ret = -14;
+		      goto stop;
+		  }
+		push_value (res, matrix[(i * points) + j]);
+	    }
+      }
+
+  stop:
+    free (coords2);
+    free (matrix);
+    return ret;
+}
+
+static int
+run_kernels (struct kernel_results *res)
+{
+/*
+/ running all the coordinate kernels: odd and even lengths, shorter
+/ and longer than a vector register, on every DimensionModel
+*/
+    int dims_models[4] = { GAIA_XY, GAIA_XY_Z, GAIA_XY_M, GAIA_XY_Z_M };
+    int lengths[10] = { 1, 2, 3, 4, 5, 7, 8, 9, 31, 33 };
+    int d;
+    int l;
+    int ret;
+
+    res->count = 0;
+    for (d = 0; d < 4; d++)
+      {
+	  for (l = 0; l < 10; l++)
+	    {
+		seed = (d * 100) + lengths[l];
+		ret = test_linestring (res, dims_models[d], lengths[l]);
+		if (ret != 0)
+		    return ret - (d * 1000) - (lengths[l] * 10000);
+		if (lengths[l] >= 4)
+		  {
+		      ret = test_ring (res, dims_models[d], lengths[l]);
+		      if (ret != 0)
+			  return ret - (d * 1000) - (lengths[l] * 10000);
+		  }
+	    }
+      }
+    for (l = 0; l < 10; l++)
+      {
+	  seed = 1000 + lengths[l];
+	  ret = test_distance_matrix (res, lengths[l]);
+	  if (ret != 0)
+	      return ret - (lengths[l] * 10000);
+      }
+    if (res->count > MAX_RESULTS)
+	return -15;
+    return 0;
+}
+
+int
+main (int argc, char *argv[])
+{
+    int ret;
+    struct kernel_results *results;
+#ifndef _WIN32
+    struct kernel_results *scalar;
+    int fd[2];
+    pid_t pid;
+    int status;
+    size_t done;
+    ssize_t rd;
+    int i;
+#endif
+
+    if (argc > 1 || argv[0] == NULL)
+	argc = 1;		/* silencing stupid compiler warnings */
+
+    results = malloc (sizeof (struct kernel_results));
+#ifndef _WIN32
+/*
+/ the kernels are selected once and forever at first use, so the
+/ scalar ones are run by a child process started beforehand
+*/
+    if (pipe (fd) != 0)
+      {
+	  fprintf (stderr, "unable to create a pipe\n");
+	  return -1;
+      }
+    pid = fork ();
+    if (pid < 0)
+      {
+	  fprintf (stderr, "unable to fork\n");
+	  return -2;
+      }
+    if (pid == 0)
+      {
+	  /* child process: forcing the scalar kernels */
+	  close (fd[0]);
+	  setenv ("SPATIALITE_SIMD", "scalar", 1);
+	  ret = run_kernels (results);
+	  if (ret != 0)
+	    {
+		fprintf (stderr, "scalar kernels: unexpected result %d\n",
+			 ret);
+		_exit (1);
+	    }
+	  if (strcmp (gaiaCoordsKernelsName (), "scalar") != 0)
+	    {
+		fprintf (stderr, "SPATIALITE_SIMD=scalar ignored: \"%s\"\n",
+			 gaiaCoordsKernelsName ());
+		_exit (2);
+	    }
+	  done = 0;
+	  while (done < sizeof (struct kernel_results))
+	    {
+		rd = write (fd[1], (char *) results + done,
+			    sizeof (struct kernel_results) - done);
+		if (rd <= 0)
+		    _exit (3);
+		done += rd;
+	    }
+	  close (fd[1]);
+	  _exit (0);
+      }
+    close (fd[1]);
+#endif
+
+/* the default kernels: SIMD whenever supported */
+    ret = run_kernels (results);
+    if (ret != 0)
+      {
+	  fprintf (stderr, "%s kernels: unexpected result %d\n",
+		   gaiaCoordsKernelsName (), ret);
+	  return -3;
+      }
+
+#ifndef _WIN32
+/* the vectorized kernels must be bit-identical to the scalar ones */
+    scalar = malloc (sizeof (struct kernel_results));
+    done = 0;
+    while (done < sizeof (struct kernel_results))
+      {
+	  rd = read (fd[0], (char *) scalar + done,
+		     sizeof (struct kernel_results) - done);
+	  if (rd <= 0)
+	      break;
+	  done += rd;
+      }
+    close (fd[0]);
+    if (waitpid (pid, &status, 0) != pid || !WIFEXITED (status)
+	|| WEXITSTATUS (status) != 0)
+      {
+	  fprintf (stderr, "scalar kernels: child process failure\n");
+	  return -4;
+      }
+    if (done != sizeof (struct kernel_results))
+      {
+	  fprintf (stderr, "scalar kernels: short read\n");
+	  return -5;
+      }
+    if (scalar->count != results->count)
+      {
+	  fprintf (stderr, "mismatching result counts: %d/%d\n",
+		   scalar->count, results->count);
+	  return -6;
+      }
+    for (i = 0; i < results->count; i++)
+      {
+	  if (memcmp
+	      (&(scalar->values[i]), &(results->values[i]),
+	       sizeof (double)) != 0)
+	    {
+		fprintf (stderr,
+			 "%s kernels: result #%d %1.17g differs from scalar %1.17g\n",
+			 gaiaCoordsKernelsName (), i, results->values[i],
+			 scalar->values[i]);
+		return -7;
+	    }
+      }
+    free (scalar);
+#endif
+
+    free (results);
+    return 0;
+}
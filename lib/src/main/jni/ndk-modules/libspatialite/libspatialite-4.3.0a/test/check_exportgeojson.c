@@ -0,0 +1,384 @@
+/*
+
+ check_exportgeojson.c -- SpatiaLite Test Case
+
+ Author: Brad Hards <bradh@frogmouth.net>
+
+ ------------------------------------------------------------------------------
+
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+
+Portions created by the Initial Developer are Copyright (C) 2015
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+Brad Hards <bradh@frogmouth.net>
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+
+*/
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "sqlite3.h"
+#include "spatialite.h"
+
+#define GEOJSON_PATH	"exportgeojson_test.geojson"
+
+static char *
+load_file (const char *path)
+{
+/* loading a whole text file into memory */
+    FILE *in;
+    long size;
+    char *text;
+    in = fopen (path, "rb");
+    if (in == NULL)
+	return NULL;
+    fseek (in, 0, SEEK_END);
+    size = ftell (in);
+    fseek (in, 0, SEEK_SET);
+    text = malloc (size + 1);
+    if (fread (text, 1, size, in) != (size_t) size)
+      {
+	  free (text);
+	  fclose (in);
+	  return NULL;
+      }
+    text[size] = '\0';
+    fclose (in);
+    return text;
+}
+
+static char *
+extract_object (const char *p)
+{
+/* extracting a JSON object (or the null literal) starting at P */
+    int depth = 0;
+    const char *start = p;
+    char *object;
+    if (strncmp (p, "null", 4) == 0)
+	return NULL;
+    if (*p != '{')
+	return NULL;
+    for (; *p != '\0'; p++)
+      {
+	  if (*p == '{')
+	      depth++;
+	  if (*p == '}')
+	    {
+		depth--;
+		if (depth == 0)
+		    break;
+	    }
+      }
+    if (*p == '\0')
+	return NULL;
+    object = malloc (p - start + 2);
+    memcpy (object, start, p - start + 1);
+    object[p - start + 1] = '\0';
+    return object;
+}
+
+static int
+check_feature (sqlite3 * handle, sqlite3_stmt * stmt, const char *feature,
+	       int *id)
+{
+/* checking a Feature against the corresponding table row */
+    const char *p;
+    char *geometry;
+    int ret;
+
+    p = strstr (feature, "\"properties\":{\"id\":");
+    if (p == NULL || sscanf (p + 19, "%d", id) != 1)
+	return 0;
+    p = strstr (feature, "\"geometry\":");
+    if (p == NULL)
+	return 0;
+    geometry = extract_object (p + 11);
+    if (geometry == NULL && strncmp (p + 11, "null", 4) != 0)
+	return 0;
+
+    sqlite3_reset (stmt);
+    sqlite3_clear_bindings (stmt);
+    if (geometry == NULL)
+	sqlite3_bind_null (stmt, 1);
+    else
+	sqlite3_bind_text (stmt, 1, geometry, strlen (geometry), free);
+    sqlite3_bind_int (stmt, 2, *id);
+    ret = sqlite3_step (stmt);
+    if (ret != SQLITE_ROW)
+      {
+	  fprintf (stderr, "Feature #%d: %s\n", *id, sqlite3_errmsg (handle));
+	  return 0;
+      }
+    if (sqlite3_column_int (stmt, 0) != 1)
+      {
+	  fprintf (stderr, "Feature #%d: mismatching Geometry\n", *id);
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+test_export_geojson2 (sqlite3 * handle)
+{
+/* exporting a FeatureCollection, then reading it back */
+    int ret;
+    char *err_msg = NULL;
+    char **results;
+    int rows;
+    int columns;
+    char *text;
+    const char *p;
+    int id;
+    int found = 0;
+    sqlite3_stmt *stmt;
+
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE TABLE features (id INTEGER PRIMARY KEY, name TEXT, value DOUBLE); "
+		      "SELECT AddGeometryColumn('features', 'geom', 4326, 'GEOMETRY', 'XY'); "
+		      "INSERT INTO features VALUES "
+		      "(1, 'alpha', 1.5, GeomFromText('POINT(12.5 -41.25)', 4326)), "
+		      "(2, 'a \"quoted\" \\ name', NULL, "
+		      "GeomFromText('LINESTRING(0 0, 1.125 2.5, -3 4)', 4326)), "
+		      "(3, 'gamma', 3, GeomFromText('POLYGON((0 0, 10 0, 10 10, 0 10, 0 0), "
+		      "(2 2, 2 3, 3 3, 2 2))', 4326)), "
+		      "(4, 'none', 4, NULL), "
+		      "(5, 'multi', 5, GeomFromText('MULTIPOINT(1 2, -3.5 4.75)', 4326))",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "ExportGeoJSON2 setup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -10;
+      }
+    ret =
+	sqlite3_get_table (handle,
+			   "SELECT ExportGeoJSON2('features', 'geom', '"
+			   GEOJSON_PATH "', 'none', 6)", &results, &rows,
+			   &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "ExportGeoJSON2 error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -11;
+      }
+    if (rows != 1 || columns != 1 || results[1] == NULL
+	|| strcmp (results[1], "5") != 0)
+      {
+	  fprintf (stderr, "ExportGeoJSON2 unexpected result: %s\n",
+		   results[1] == NULL ? "NULL" : results[1]);
+	  sqlite3_free_table (results);
+	  return -12;
+      }
+    sqlite3_free_table (results);
+
+    text = load_file (GEOJSON_PATH);
+    unlink (GEOJSON_PATH);
+    if (text == NULL)
+      {
+	  fprintf (stderr, "ExportGeoJSON2: unable to read the output\n");
+	  return -13;
+      }
+    if (strncmp
+	(text, "{\"type\":\"FeatureCollection\",\"features\":[", 40) != 0)
+      {
+	  fprintf (stderr, "ExportGeoJSON2: not a FeatureCollection\n");
+	  free (text);
+	  return -14;
+      }
+    if (strstr (text, "\"name\":\"a \\\"quoted\\\" \\\\ name\",\"value\":null")
+	== NULL)
+      {
+	  fprintf (stderr, "ExportGeoJSON2: badly escaped Properties\n");
+	  free (text);
+	  return -15;
+      }
+
+/* each Feature must match the corresponding row */
+    ret =
+	sqlite3_prepare_v2 (handle,
+			    "SELECT CASE WHEN ?1 IS NULL THEN geom IS NULL "
+			    "ELSE AsText(geom) = AsText(GeomFromGeoJSON(?1)) END "
+			    "FROM features WHERE id = ?2", -1, &stmt, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "ExportGeoJSON2 prepare error: %s\n",
+		   sqlite3_errmsg (handle));
+	  free (text);
+	  return -16;
+      }
+    p = text;
+    while ((p = strstr (p, "{\"type\":\"Feature\",")) != NULL)
+      {
+	  if (!check_feature (handle, stmt, p, &id))
+	    {
+		sqlite3_finalize (stmt);
+		free (text);
+		return -17;
+	    }
+	  found |= 1 << id;
+	  p++;
+      }
+    sqlite3_finalize (stmt);
+    free (text);
+    if (found != 0x3e)
+      {
+	  fprintf (stderr, "ExportGeoJSON2: missing Features (%x)\n", found);
+	  return -18;
+      }
+    return 0;
+}
+
+static int
+test_dump_geojson_invalid (sqlite3 * handle)
+{
+/* values not being a valid Geometry are exported as null */
+    int ret;
+    char *err_msg = NULL;
+    char *text;
+    int rows;
+
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE TABLE raw_geoms (geom BLOB); "
+		      "INSERT INTO raw_geoms VALUES (GeomFromText('POINT(1 2)', 4326)), "
+		      "(zeroblob(8)), ('text'), (NULL)", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "dump_geojson_ex setup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -20;
+      }
+    ret =
+	dump_geojson_ex (handle, "raw_geoms", "geom", GEOJSON_PATH, 6, 0,
+			 &rows);
+    if (!ret || rows != 3)
+      {
+	  fprintf (stderr, "dump_geojson_ex unexpected result: %d/%d\n", ret,
+		   rows);
+	  unlink (GEOJSON_PATH);
+	  return -21;
+      }
+    text = load_file (GEOJSON_PATH);
+    unlink (GEOJSON_PATH);
+    if (text == NULL
+	|| strcmp (text,
+		   "{\"type\":\"Point\",\"coordinates\":[1,2]}\r\nnull\r\nnull\r\n")
+	!= 0)
+      {
+	  fprintf (stderr, "dump_geojson_ex unexpected output\n");
+	  if (text != NULL)
+	      free (text);
+	  return -22;
+      }
+    free (text);
+    return 0;
+}
+
+int
+main (int argc, char *argv[])
+{
+    int ret;
+    sqlite3 *handle;
+    char *err_msg = NULL;
+    void *cache = spatialite_alloc_connection ();
+    char *old_SPATIALITE_SECURITY_ENV = NULL;
+#ifdef _WIN32
+    char *env;
+#endif /* not WIN32 */
+
+    if (argc > 1 || argv[0] == NULL)
+	argc = 1;		/* silencing stupid compiler warnings */
+
+/* exporting into external files requires relaxed security */
+    old_SPATIALITE_SECURITY_ENV = getenv ("SPATIALITE_SECURITY");
+#ifdef _WIN32
+    putenv ("SPATIALITE_SECURITY=relaxed");
+#else /* not WIN32 */
+    setenv ("SPATIALITE_SECURITY", "relaxed", 1);
+#endif
+
+    ret =
+	sqlite3_open_v2 (":memory:", &handle,
+			 SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+    spatialite_init_ex (handle, cache, 0);
+
+    if (old_SPATIALITE_SECURITY_ENV)
+      {
+#ifdef _WIN32
+	  env =
+	      sqlite3_mprintf ("SPATIALITE_SECURITY=%s",
+			       old_SPATIALITE_SECURITY_ENV);
+	  putenv (env);
+	  sqlite3_free (env);
+#else /* not WIN32 */
+	  setenv ("SPATIALITE_SECURITY", old_SPATIALITE_SECURITY_ENV, 1);
+#endif
+      }
+    else
+      {
+#ifdef _WIN32
+	  putenv ("SPATIALITE_SECURITY=");
+#else /* not WIN32 */
+	  unsetenv ("SPATIALITE_SECURITY");
+#endif
+      }
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open in-memory db: %s\n",
+		   sqlite3_errmsg (handle));
+	  sqlite3_close (handle);
+	  return -1;
+      }
+
+    ret =
+	sqlite3_exec (handle, "SELECT InitSpatialMetadata(1)", NULL, NULL,
+		      &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "InitSpatialMetadata() error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -2;
+      }
+
+    ret = test_export_geojson2 (handle);
+    if (ret != 0)
+	return ret;
+    ret = test_dump_geojson_invalid (handle);
+    if (ret != 0)
+	return ret;
+
+    sqlite3_close (handle);
+    spatialite_cleanup_ex (cache);
+    spatialite_shutdown ();
+    return 0;
+}
@@ -54,12 +54,330 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include "spatialite.h"
 #include "spatialite/gaiageo.h"
 
+#ifndef OMIT_GEOS		/* including GEOS */
+#include <geos_c.h>
+#endif
+
+#ifndef OMIT_GEOS		/* only if GEOS is supported */
+static unsigned int seed = 1;
+
+static double
+next_value (void)
+{
+/* a repeatable pseudo-random coordinate, using all the mantissa bits */
+    seed = seed * 1103515245 + 12345;
+    return ((double) ((int) (seed >> 4) - 134217728)) / 3.0;
+}
+
+static void
+get_vertex (const double *coords, int dims, int iv, double *v)
+{
+/* fetching X, Y, Z and M (zero if missing) of some vertex */
+    v[2] = 0.0;
+    v[3] = 0.0;
+    if (dims == GAIA_XY_Z)
+      {
+	  gaiaGetPointXYZ (coords, iv, &v[0], &v[1], &v[2]);
+      }
+    else if (dims == GAIA_XY_M)
+      {
+	  gaiaGetPointXYM (coords, iv, &v[0], &v[1], &v[3]);
+      }
+    else if (dims == GAIA_XY_Z_M)
+      {
+	  gaiaGetPointXYZM (coords, iv, &v[0], &v[1], &v[2], &v[3]);
+      }
+    else
+      {
+	  gaiaGetPoint (coords, iv, &v[0], &v[1]);
+      }
+}
+
+static void
+fill_coords (double *coords, int dims, int points, int closed)
+{
+/* filling a coordinate array, optionally closed */
+    int iv;
+    int last = closed ? points - 1 : points;
+    for (iv = 0; iv < last; iv++)
+      {
+	  double x = next_value ();
+	  double y = next_value ();
+	  double z = next_value ();
+	  double m = next_value ();
+	  if (dims == GAIA_XY_Z)
+	    {
+	        gaiaSetPointXYZ (coords, iv, x, y, z);
+	    }
+	  else if (dims == GAIA_XY_M)
+	    {
+	        gaiaSetPointXYM (coords, iv, x, y, m);
+	    }
+	  else if (dims == GAIA_XY_Z_M)
+	    {
+	        gaiaSetPointXYZM (coords, iv, x, y, z, m);
+	    }
+	  else
+	    {
+	        gaiaSetPoint (coords, iv, x, y);
+	    }
+      }
+    if (closed)
+      {
+	  double v[4];
+	  get_vertex (coords, dims, 0, v);
+	  if (dims == GAIA_XY_Z)
+	    {
+	        gaiaSetPointXYZ (coords, last, v[0], v[1], v[2]);
+	    }
+	  else if (dims == GAIA_XY_M)
+	    {
+	        gaiaSetPointXYM (coords, last, v[0], v[1], v[3]);
+	    }
+	  else if (dims == GAIA_XY_Z_M)
+	    {
+	        gaiaSetPointXYZM (coords, last, v[0], v[1], v[2], v[3]);
+	    }
+	  else
+	    {
+	        gaiaSetPoint (coords, last, v[0], v[1]);
+	    }
+      }
+}
+
+static gaiaGeomCollPtr
+build_geometry (int dims)
+{
+/* 
+/ building a collection of Points, Linestrings and Polygons; the
+/ last Polygon has unclosed rings, GEOS requiring an extra vertex
+*/
+    int i;
+    gaiaLinestringPtr ln;
+    gaiaPolygonPtr pg;
+    gaiaRingPtr rng;
+    gaiaGeomCollPtr geom;
+    if (dims == GAIA_XY_Z)
+	geom = gaiaAllocGeomCollXYZ ();
+    else if (dims == GAIA_XY_M)
+	geom = gaiaAllocGeomCollXYM ();
+    else if (dims == GAIA_XY_Z_M)
+	geom = gaiaAllocGeomCollXYZM ();
+    else
+	geom = gaiaAllocGeomColl ();
+    for (i = 0; i < 3; i++)
+      {
+	  double x = next_value ();
+	  double y = next_value ();
+	  double z = next_value ();
+	  double m = next_value ();
+	  if (dims == GAIA_XY_Z)
+	      gaiaAddPointToGeomCollXYZ (geom, x, y, z);
+	  else if (dims == GAIA_XY_M)
+	      gaiaAddPointToGeomCollXYM (geom, x, y, m);
+	  else if (dims == GAIA_XY_Z_M)
+	      gaiaAddPointToGeomCollXYZM (geom, x, y, z, m);
+	  else
+	      gaiaAddPointToGeomColl (geom, x, y);
+      }
+    ln = gaiaAddLinestringToGeomColl (geom, 2);
+    fill_coords (ln->Coords, dims, 2, 0);
+    ln = gaiaAddLinestringToGeomColl (geom, 257);
+    fill_coords (ln->Coords, dims, 257, 0);
+    pg = gaiaAddPolygonToGeomColl (geom, 64, 2);
+    fill_coords (pg->Exterior->Coords, dims, 64, 1);
+    rng = gaiaAddInteriorRing (pg, 0, 4);
+    fill_coords (rng->Coords, dims, 4, 1);
+    rng = gaiaAddInteriorRing (pg, 1, 33);
+    fill_coords (rng->Coords, dims, 33, 1);
+    pg = gaiaAddPolygonToGeomColl (geom, 9, 1);
+    fill_coords (pg->Exterior->Coords, dims, 9, 0);
+    rng = gaiaAddInteriorRing (pg, 0, 5);
+    fill_coords (rng->Coords, dims, 5, 0);
+    return geom;
+}
+
+static int
+check_coords (const double *org, int org_dims, int org_points,
+	      const double *dst, int dst_dims, int dst_points)
+{
+/*
+/ checking a round-tripped coordinate array: X and Y are unchanged,
+/ Z is kept if both sides have it (0.0 when added), GEOS has no M
+/ (always 0.0); an unclosed ring gets the first vertex repeated at its end
+*/
+    int iv;
+    double a[4];
+    double b[4];
+    int has_z = (org_dims == GAIA_XY_Z || org_dims == GAIA_XY_Z_M)
+	&& (dst_dims == GAIA_XY_Z || dst_dims == GAIA_XY_Z_M);
+    if (dst_points != org_points)
+      {
+	  get_vertex (org, org_dims, 0, a);
+	  get_vertex (org, org_dims, org_points - 1, b);
+	  if (dst_points != org_points + 1
+	      || (a[0] == b[0] && a[1] == b[1] && a[2] == b[2]))
+	      return 0;
+      }
+    for (iv = 0; iv < dst_points; iv++)
+      {
+	  get_vertex (org, org_dims, (iv < org_points) ? iv : 0, a);
+	  get_vertex (dst, dst_dims, iv, b);
+	  if (!has_z)
+	      a[2] = 0.0;
+	  if (memcmp (a, b, sizeof (double) * 2) != 0 || a[2] != b[2]
+	      || b[3] != 0.0)
+	      return 0;
+      }
+    return 1;
+}
+
+static int
+check_round_trip (gaiaGeomCollPtr org, gaiaGeomCollPtr dst)
+{
+/* checking all Points, Linestrings and Polygons of a round trip */
+    int ib;
+    double v[4];
+    gaiaPointPtr pt = org->FirstPoint;
+    gaiaPointPtr pt2 = dst->FirstPoint;
+    gaiaLinestringPtr ln = org->FirstLinestring;
+    gaiaLinestringPtr ln2 = dst->FirstLinestring;
+    gaiaPolygonPtr pg = org->FirstPolygon;
+    gaiaPolygonPtr pg2 = dst->FirstPolygon;
+    while (pt)
+      {
+	  v[0] = pt->X;
+	  v[1] = pt->Y;
+	  v[2] = pt->Z;
+	  v[3] = pt->M;
+	  if (pt2 == NULL)
+	      return 0;
+	  if (org->DimensionModel == GAIA_XY || org->DimensionModel == GAIA_XY_M)
+	      v[2] = 0.0;
+	  if (pt2->X != v[0] || pt2->Y != v[1])
+	      return 0;
+	  if ((dst->DimensionModel == GAIA_XY_Z
+	       || dst->DimensionModel == GAIA_XY_Z_M) && pt2->Z != v[2])
+	      return 0;
+	  if ((dst->DimensionModel == GAIA_XY_M
+	       || dst->DimensionModel == GAIA_XY_Z_M) && pt2->M != 0.0)
+	      return 0;
+	  pt = pt->Next;
+	  pt2 = pt2->Next;
+      }
+    while (ln)
+      {
+	  if (ln2 == NULL
+	      || !check_coords (ln->Coords, ln->DimensionModel, ln->Points,
+				ln2->Coords, ln2->DimensionModel,
+				ln2->Points))
+	      return 0;
+	  ln = ln->Next;
+	  ln2 = ln2->Next;
+      }
+    while (pg)
+      {
+	  if (pg2 == NULL || pg2->NumInteriors != pg->NumInteriors
+	      || !check_coords (pg->Exterior->Coords,
+				pg->Exterior->DimensionModel,
+				pg->Exterior->Points, pg2->Exterior->Coords,
+				pg2->Exterior->DimensionModel,
+				pg2->Exterior->Points))
+	      return 0;
+	  for (ib = 0; ib < pg->NumInteriors; ib++)
+	    {
+		gaiaRingPtr rng = pg->Interiors + ib;
+		gaiaRingPtr rng2 = pg2->Interiors + ib;
+		if (!check_coords
+		    (rng->Coords, rng->DimensionModel, rng->Points,
+		     rng2->Coords, rng2->DimensionModel, rng2->Points))
+		    return 0;
+	    }
+	  pg = pg->Next;
+	  pg2 = pg2->Next;
+      }
+    if (pt2 != NULL || ln2 != NULL || pg2 != NULL)
+	return 0;
+    return 1;
+}
+
+static int
+test_round_trips (const void *cache)
+{
+/* 
+/ converting Geometries of any DimensionModel into GEOS and back into
+/ any DimensionModel, both with and without a connection cache
+*/
+    int dims[4] = { GAIA_XY, GAIA_XY_Z, GAIA_XY_M, GAIA_XY_Z_M };
+    int i;
+    int j;
+    for (i = 0; i < 4; i++)
+      {
+	  gaiaGeomCollPtr org = build_geometry (dims[i]);
+	  void *geos;
+	  if (cache != NULL)
+	      geos = gaiaToGeos_r (cache, org);
+	  else
+	      geos = gaiaToGeos (org);
+	  if (geos == NULL)
+	    {
+		gaiaFreeGeomColl (org);
+		return -(i * 10) - 1;
+	    }
+	  for (j = 0; j < 4; j++)
+	    {
+		gaiaGeomCollPtr dst;
+		int ok;
+		if (cache != NULL)
+		  {
+		      if (dims[j] == GAIA_XY_Z)
+			  dst = gaiaFromGeos_XYZ_r (cache, geos);
+		      else if (dims[j] == GAIA_XY_M)
+			  dst = gaiaFromGeos_XYM_r (cache, geos);
+		      else if (dims[j] == GAIA_XY_Z_M)
+			  dst = gaiaFromGeos_XYZM_r (cache, geos);
+		      else
+			  dst = gaiaFromGeos_XY_r (cache, geos);
+		  }
+		else
+		  {
+		      if (dims[j] == GAIA_XY_Z)
+			  dst = gaiaFromGeos_XYZ (geos);
+		      else if (dims[j] == GAIA_XY_M)
+			  dst = gaiaFromGeos_XYM (geos);
+		      else if (dims[j] == GAIA_XY_Z_M)
+			  dst = gaiaFromGeos_XYZM (geos);
+		      else
+			  dst = gaiaFromGeos_XY (geos);
+		  }
+		ok = (dst != NULL && check_round_trip (org, dst));
+		if (dst != NULL)
+		    gaiaFreeGeomColl (dst);
+		if (!ok)
+		  {
+		      fprintf (stderr,
+			       "round trip %d -> GEOS -> %d failed (cache=%s)\n",
+			       dims[i], dims[j], cache ? "yes" : "no");
+		      GEOSGeom_destroy (geos);
+		      gaiaFreeGeomColl (org);
+		      return -(i * 10) - j - 2;
+		  }
+	    }
+	  GEOSGeom_destroy (geos);
+	  gaiaFreeGeomColl (org);
+      }
+    return 0;
+}
+#endif /* end GEOS conditional */
+
 int
 main (int argc, char *argv[])
 {
 #ifndef OMIT_GEOS		/* only if GEOS is supported */
     gaiaGeomCollPtr result;
     void *resultVoid;
+    void *cache;
+    int ret;
     int returnValue = 0;
 
     /* Common setup */
@@ -96,6 +414,23 @@ main (int argc, char *argv[])
 	  goto exit;
       }
 
+    /* round trips through GEOS, with and without a connection cache */
+    spatialite_init_geos ();
+    ret = test_round_trips (NULL);
+    if (ret != 0)
+      {
+	  returnValue = -100 + ret;
+	  goto exit;
+      }
+    cache = spatialite_alloc_connection ();
+    ret = test_round_trips (cache);
+    spatialite_cleanup_ex (cache);
+    if (ret != 0)
+      {
+	  returnValue = -150 + ret;
+	  goto exit;
+      }
+
     /* Cleanup and exit */
   exit:
     gaiaFreeGeomColl (emptyGeometry);
@@ -50,6 +50,40 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include "sqlite3.h"
 #include "spatialite.h"
 
+static int
+check_single_value (sqlite3 * handle, const char *sql, const char *expected)
+{
+/* executing a query expected to return a single value */
+    int ret;
+    char *err_msg = NULL;
+    char **results;
+    int rows;
+    int columns;
+    ret = sqlite3_get_table (handle, sql, &results, &rows, &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    if ((rows != 1) || (columns != 1))
+      {
+	  fprintf (stderr, "Unexpected result %s bad result: %i/%i.\n", sql,
+		   rows, columns);
+	  sqlite3_free_table (results);
+	  return 0;
+      }
+    if (results[1] == NULL || strcmp (results[1], expected) != 0)
+      {
+	  fprintf (stderr, "Unexpected result %s: %s (expected %s).\n", sql,
+		   results[1] ? results[1] : "NULL", expected);
+	  sqlite3_free_table (results);
+	  return 0;
+      }
+    sqlite3_free_table (results);
+    return 1;
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -421,5 +455,141 @@ main (int argc, char *argv[])
 
     spatialite_cleanup_ex (cache);
 
+    cache = spatialite_alloc_connection ();
+    ret =
+	sqlite3_open_v2 (":memory:", &handle,
+			 SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open in-memory db: %s\n",
+		   sqlite3_errmsg (handle));
+	  sqlite3_close (handle);
+	  return -37;
+      }
+
+    spatialite_init_ex (handle, cache, 0);
+
+/* "lazy" spatial_ref_sys: EPSG defs are inserted on demand */
+    if (!check_single_value
+	(handle, "SELECT InitSpatialMetadata(1, \"LAZY\")", "1"))
+	return -38;
+    if (!check_single_value
+	(handle, "SELECT Count(*) FROM spatial_ref_sys", "2"))
+	return -39;
+    ret =
+	sqlite3_exec (handle, "CREATE TABLE lazy (id INTEGER PRIMARY KEY)",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "CREATE TABLE lazy error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  sqlite3_close (handle);
+	  return -40;
+      }
+    if (!check_single_value
+	(handle,
+	 "SELECT AddGeometryColumn('lazy', 'geom', 32632, 'POINT', 'XY')",
+	 "1"))
+	return -41;
+    if (!check_single_value
+	(handle, "SELECT ref_sys_name FROM spatial_ref_sys WHERE srid = 32632",
+	 "WGS 84 / UTM zone 32N"))
+	return -42;
+    if (!check_single_value
+	(handle, "SELECT SridGetUnit(32632)", "metre"))
+	return -43;
+    if (!check_single_value
+	(handle, "SELECT Count(*) FROM spatial_ref_sys", "3"))
+	return -44;
+/* not yet inserted SRIDs are anyway supported by Transform() */
+    if (!check_single_value
+	(handle,
+	 "SELECT AsText(SnapToGrid(Transform(MakePoint(9, 0, 4326), 32632), 1))",
+	 "POINT(500000 0)"))
+	return -45;
+    if (!check_single_value
+	(handle,
+	 "SELECT Transform(MakePoint(9, 0, 4326), 3003) IS NOT NULL", "1"))
+	return -47;
+    if (!check_single_value
+	(handle, "SELECT Count(*) FROM spatial_ref_sys", "3"))
+	return -48;
+/* once the "lazy" mode is disabled, missing SRIDs are unknown */
+    ret =
+	sqlite3_exec (handle, "UPDATE spatial_ref_sys_lazy SET enabled = 0",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "UPDATE spatial_ref_sys_lazy error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  sqlite3_close (handle);
+	  return -49;
+      }
+    if (!check_single_value
+	(handle, "SELECT Transform(MakePoint(9, 0, 4326), 3004) IS NULL",
+	 "1"))
+	return -50;
+
+    ret = sqlite3_close (handle);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "sqlite3_close() error: %s\n",
+		   sqlite3_errmsg (handle));
+	  return -46;
+      }
+
+    spatialite_cleanup_ex (cache);
+
+    cache = spatialite_alloc_connection ();
+    ret =
+	sqlite3_open_v2 (":memory:", &handle,
+			 SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open in-memory db: %s\n",
+		   sqlite3_errmsg (handle));
+	  sqlite3_close (handle);
+	  return -51;
+      }
+
+    spatialite_init_ex (handle, cache, 0);
+
+/* any other DB: spatial_ref_sys is never silently extended */
+    if (!check_single_value
+	(handle, "SELECT InitSpatialMetadata(1, \"NONE\")", "1"))
+	return -52;
+    ret =
+	sqlite3_exec (handle, "CREATE TABLE not_lazy (id INTEGER PRIMARY KEY)",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "CREATE TABLE not_lazy error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  sqlite3_close (handle);
+	  return -53;
+      }
+    if (!check_single_value
+	(handle,
+	 "SELECT AddGeometryColumn('not_lazy', 'geom', 32632, 'POINT', 'XY')",
+	 "1"))
+	return -54;
+    if (!check_single_value
+	(handle, "SELECT Count(*) FROM spatial_ref_sys", "0"))
+	return -55;
+    if (!check_single_value
+	(handle, "SELECT Transform(MakePoint(9, 0, 4326), 32632) IS NULL",
+	 "1"))
+	return -56;
+
+    ret = sqlite3_close (handle);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "sqlite3_close() error: %s\n",
+		   sqlite3_errmsg (handle));
+	  return -57;
+      }
+
+    spatialite_cleanup_ex (cache);
+
     return 0;
 }
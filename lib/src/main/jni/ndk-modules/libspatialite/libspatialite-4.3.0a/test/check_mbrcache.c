@@ -50,6 +50,94 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include "sqlite3.h"
 #include "spatialite.h"
 
+static int
+check_pt_window (sqlite3 * handle, double minx, double miny, double maxx,
+		 double maxy)
+{
+/* cross-checking the MbrCache against a plain scan of the Point table */
+    int ret;
+    char *sql;
+    char **results;
+    int rows;
+    int columns;
+    char *err_msg = NULL;
+    int ok = 0;
+
+    sql =
+	sqlite3_mprintf
+	("SELECT (SELECT Count(*) FROM cache_pt_g WHERE mbr = "
+	 "FilterMbrIntersects(%1.6f, %1.6f, %1.6f, %1.6f)), "
+	 "(SELECT Count(*) FROM pt WHERE MbrIntersects(g, "
+	 "BuildMbr(%1.6f, %1.6f, %1.6f, %1.6f)))", minx, miny, maxx, maxy,
+	 minx, miny, maxx, maxy);
+    ret = sqlite3_get_table (handle, sql, &results, &rows, &columns, &err_msg);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Error in MbrCache cross-check: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    if (rows == 1 && columns == 2 && results[2] != NULL
+	&& results[3] != NULL && strcmp (results[2], results[3]) == 0)
+	ok = 1;
+    else
+	fprintf (stderr, "MbrCache mismatch: cache=%s table=%s\n",
+		 (rows == 1) ? results[2] : "?", (rows == 1) ? results[3] : "?");
+    sqlite3_free_table (results);
+    return ok;
+}
+
+static int
+check_pt_cache (sqlite3 * handle, int expected)
+{
+/* checking the unfiltered MbrCache scan and a few spatial windows */
+    int ret;
+    char **results;
+    int rows;
+    int columns;
+    char *err_msg = NULL;
+    int i;
+
+    ret =
+	sqlite3_get_table (handle, "SELECT rowid FROM cache_pt_g", &results,
+			   &rows, &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Error in MbrCache scan: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    if (rows != expected)
+      {
+	  fprintf (stderr, "MbrCache scan: unexpected %d rows\n", rows);
+	  sqlite3_free_table (results);
+	  return 0;
+      }
+    for (i = 2; i <= rows; i++)
+      {
+	  /* the unfiltered scan always returns ROWIDs in ascending order */
+	  if (atoll (results[i - 1]) >= atoll (results[i]))
+	    {
+		fprintf (stderr, "MbrCache scan: unsorted ROWID %s\n",
+			 results[i]);
+		sqlite3_free_table (results);
+		return 0;
+	    }
+      }
+    sqlite3_free_table (results);
+
+    if (!check_pt_window (handle, 11.005, 43.005, 11.255, 43.255))
+	return 0;
+    if (!check_pt_window (handle, 11.695, 43.695, 11.805, 43.805))
+	return 0;
+    if (!check_pt_window (handle, 12.505, 42.505, 12.555, 42.555))
+	return 0;
+    if (!check_pt_window (handle, 10.0, 42.0, 13.0, 44.0))
+	return 0;
+    return 1;
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -429,6 +517,28 @@ main (int argc, char *argv[])
       }
     sqlite3_free_table (results);
 
+    rows = 0;
+    columns = 0;
+    ret =
+	sqlite3_get_table (handle,
+			   "SELECT memory_usage > 0 FROM cache_Councils_geom "
+			   "WHERE rowid = 6;", &results, &rows, &columns,
+			   &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Error in memory_usage SELECT: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -43;
+      }
+    if ((rows != 1) || (columns != 1) || strcmp (results[1], "1") != 0)
+      {
+	  fprintf (stderr, "Unexpected error: bad memory_usage result.\n");
+	  sqlite3_free_table (results);
+	  sqlite3_close (handle);
+	  return -43;
+      }
+    sqlite3_free_table (results);
+
     ret = sqlite3_exec (handle, "DROP TABLE Councils;", NULL, NULL, &err_msg);
     if (ret != SQLITE_OK)
       {
@@ -531,6 +641,8 @@ main (int argc, char *argv[])
 		return -53;
 	    }
       }
+    if (!check_pt_cache (handle, 10000))
+	return -63;
     for (pt = 5000; pt < 6000; pt++)
       {
 	  /* updating Points */
@@ -546,6 +658,8 @@ main (int argc, char *argv[])
 		return -54;
 	    }
       }
+    if (!check_pt_cache (handle, 10000))
+	return -64;
     for (pt = 7000; pt < 8000; pt++)
       {
 	  /* deleting Points */
@@ -559,6 +673,20 @@ main (int argc, char *argv[])
 		return -55;
 	    }
       }
+    if (!check_pt_cache (handle, 9000))
+	return -65;
+/* deleting enough Points to force repacking the cache */
+    ret =
+	sqlite3_exec (handle, "DELETE FROM pt WHERE id < 3000;", NULL, NULL,
+		      &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "DELETE pt error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -66;
+      }
+    if (!check_pt_cache (handle, 6000))
+	return -67;
 
     ret = sqlite3_exec (handle, "SELECT CreateMbrCache(1, 'geom');",
 			NULL, NULL, &err_msg);
@@ -387,6 +387,1457 @@ do_test_without_rowid_false (sqlite3 * handle)
     return 0;
 }
 
+static int
+check_int_result (sqlite3 * handle, const char *sql, const char *expected)
+{
+/* executes a single-value query, checking its result */
+    char *err_msg = NULL;
+    char **results;
+    int rows;
+    int columns;
+    int ret = sqlite3_get_table (handle, sql, &results, &rows, &columns,
+				 &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "\"%s\" error: %s\n", sql, err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    if ((rows != 1) || (columns != 1) || results[1] == NULL
+	|| strcmp (results[1], expected) != 0)
+      {
+	  fprintf (stderr, "\"%s\" unexpected result\n", sql);
+	  sqlite3_free_table (results);
+	  return 0;
+      }
+    sqlite3_free_table (results);
+    return 1;
+}
+
+static int
+check_query_plan (sqlite3 * handle, const char *sql, const char *expected)
+{
+/* checks that the query plan of a SELECT contains the expected detail */
+    char *err_msg = NULL;
+    char **results;
+    int rows;
+    int columns;
+    int i;
+    int found = 0;
+    char *plan = sqlite3_mprintf ("EXPLAIN QUERY PLAN %s", sql);
+    int ret = sqlite3_get_table (handle, plan, &results, &rows, &columns,
+				 &err_msg);
+    sqlite3_free (plan);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "\"%s\" plan error: %s\n", sql, err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    for (i = 1; i <= rows; i++)
+      {
+	  const char *detail = results[(i * columns) + columns - 1];
+	  if (detail != NULL && strstr (detail, expected) != NULL)
+	      found = 1;
+      }
+    sqlite3_free_table (results);
+    if (!found)
+	fprintf (stderr, "\"%s\" unexpected query plan\n", sql);
+    return found;
+}
+
+int
+do_test_deferred (sqlite3 * handle)
+{
+/* testing deferred SpatialIndex maintenance */
+    char *err_msg = NULL;
+    int ret;
+
+    if (!check_int_result
+	(handle, "SELECT SetDeferredSpatialIndex('Councils', 'geom', 1)", "1"))
+	return -341;
+    ret =
+	sqlite3_exec (handle,
+		      "UPDATE Councils SET geom = ST_Translate(geom, 10, 10, 0) "
+		      "WHERE PK_UID % 3 = 0; DELETE FROM Councils WHERE PK_UID = 7",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Deferred SpatialIndex edit error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -342;
+      }
+    if (!check_int_result
+	(handle, "SELECT Count(*) FROM idx_Councils_geom_deferred", "21"))
+	return -343;
+    if (!check_int_result
+	(handle, "SELECT FlushDeferredSpatialIndex('Councils', 'geom')", "1"))
+	return -344;
+    if (!check_int_result
+	(handle, "SELECT Count(*) FROM idx_Councils_geom_deferred", "0"))
+	return -345;
+    if (!check_int_result
+	(handle, "SELECT CheckSpatialIndex('Councils', 'geom')", "1"))
+	return -346;
+    ret =
+	sqlite3_exec (handle,
+		      "DELETE FROM Councils WHERE PK_UID = 8", NULL, NULL,
+		      &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Deferred SpatialIndex edit error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -347;
+      }
+    if (!check_int_result
+	(handle, "SELECT SetDeferredSpatialIndex('Councils', 'geom', 0)", "1"))
+	return -348;
+    if (!check_int_result
+	(handle, "SELECT CheckSpatialIndex('Councils', 'geom')", "1"))
+	return -349;
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM sqlite_master WHERE name = 'idx_Councils_geom_deferred'",
+	 "0"))
+	return -350;
+    if (!check_int_result
+	(handle, "SELECT SetDeferredSpatialIndex('Councils', 'none', 1)",
+	 "0"))
+	return -351;
+
+/* rebuilding the triggers flushes, but keeps the deferred mode */
+    ret =
+	sqlite3_exec (handle,
+		      "SELECT SetDeferredSpatialIndex('Councils', 'geom', 1); "
+		      "UPDATE Councils SET geom = ST_Translate(geom, -10, -10, 0) "
+		      "WHERE PK_UID % 3 = 0; "
+		      "SELECT RebuildGeometryTriggers('Councils', 'geom')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Deferred SpatialIndex rebuild error: %s\n",
+		   err_msg);
+	  sqlite3_free (err_msg);
+	  return -352;
+      }
+    if (!check_int_result
+	(handle, "SELECT Count(*) FROM idx_Councils_geom_deferred", "0"))
+	return -353;
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM sqlite_master WHERE type = 'trigger' "
+	 "AND name IN ('gii_Councils_geom', 'giu_Councils_geom', 'gid_Councils_geom') "
+	 "AND sql LIKE '%idx_Councils_geom_deferred%'", "3"))
+	return -354;
+
+/* CheckSpatialIndex applies pending changes before comparing */
+    ret =
+	sqlite3_exec (handle,
+		      "UPDATE Councils SET geom = ST_Translate(geom, 5, 5, 0) "
+		      "WHERE PK_UID % 5 = 0", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Deferred SpatialIndex edit error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -355;
+      }
+    if (!check_int_result
+	(handle, "SELECT CheckSpatialIndex('Councils', 'geom')", "1"))
+	return -356;
+
+/* a full recovery supersedes any pending change */
+    ret =
+	sqlite3_exec (handle,
+		      "UPDATE Councils SET geom = ST_Translate(geom, -5, -5, 0) "
+		      "WHERE PK_UID % 5 = 0; "
+		      "SELECT RecoverSpatialIndex('Councils', 'geom')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Deferred SpatialIndex recover error: %s\n",
+		   err_msg);
+	  sqlite3_free (err_msg);
+	  return -357;
+      }
+    if (!check_int_result
+	(handle, "SELECT Count(*) FROM idx_Councils_geom_deferred", "0"))
+	return -358;
+
+/* disabling the SpatialIndex discards the pending changes */
+    ret =
+	sqlite3_exec (handle,
+		      "UPDATE Councils SET geom = ST_Translate(geom, 1, 1, 0) "
+		      "WHERE PK_UID % 4 = 0; "
+		      "SELECT DisableSpatialIndex('Councils', 'geom'); "
+		      "DROP TABLE idx_Councils_geom", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Deferred SpatialIndex disable error: %s\n",
+		   err_msg);
+	  sqlite3_free (err_msg);
+	  return -359;
+      }
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM sqlite_master WHERE name = 'idx_Councils_geom_deferred'",
+	 "0"))
+	return -360;
+    if (!check_int_result
+	(handle, "SELECT CreateSpatialIndex('Councils', 'geom')", "1"))
+	return -423;
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM sqlite_master WHERE type = 'trigger' "
+	 "AND name IN ('gii_Councils_geom', 'giu_Councils_geom', 'gid_Councils_geom') "
+	 "AND sql LIKE '%RTreeAlign%'", "2"))
+	return -424;
+    if (!check_int_result
+	(handle, "SELECT CheckSpatialIndex('Councils', 'geom')", "1"))
+	return -425;
+    return 0;
+}
+
+int
+do_test_knn (sqlite3 * handle)
+{
+/* testing the VirtualKNN module */
+    char *err_msg = NULL;
+    int ret;
+
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE VIRTUAL TABLE test_knn USING VirtualKNN(); "
+		      "CREATE TABLE knn_pts (id INTEGER PRIMARY KEY); "
+		      "SELECT AddGeometryColumn('knn_pts', 'geom', 4326, 'POINT', 'XY'); "
+		      "INSERT INTO knn_pts VALUES (1, MakePoint(11.0, 43.0, 4326)); "
+		      "INSERT INTO knn_pts VALUES (2, MakePoint(11.5, 43.5, 4326)); "
+		      "INSERT INTO knn_pts VALUES (3, MakePoint(10.9, 42.8, 4326)); "
+		      "INSERT INTO knn_pts VALUES (4, MakePoint(-179.9, 43.1, 4326)); "
+		      "INSERT INTO knn_pts VALUES (5, MakePoint(12.0, 43.0, 4326)); "
+		      "SELECT CreateSpatialIndex('knn_pts', 'geom')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "VirtualKNN setup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -361;
+      }
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT group_concat(fid) FROM (SELECT fid FROM test_knn "
+	 "WHERE f_table_name = 'Councils' AND f_geometry_column = 'geom' "
+	 "AND ref_geometry = MakePoint(1019000, 4592000, 23032) "
+	 "AND max_items = 5 ORDER BY pos)) = (SELECT group_concat(PK_UID) "
+	 "FROM (SELECT PK_UID FROM Councils ORDER BY Distance(geom, "
+	 "MakePoint(1019000, 4592000, 23032)) LIMIT 5))", "1"))
+	return -362;
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM test_knn WHERE f_table_name = 'Councils' "
+	 "AND ref_geometry = MakePoint(1019000, 4592000, 23032)", "3"))
+	return -363;
+    if (!check_int_result
+	(handle,
+	 "SELECT group_concat(fid) FROM test_knn WHERE f_table_name = 'knn_pts' "
+	 "AND ref_geometry = MakePoint(179.9, 43.0, 4326) AND max_items = 2",
+	 "4,2"))
+	return -364;
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM test_knn WHERE f_table_name = 'knn_pts' "
+	 "AND ref_geometry = MakePoint(11.0, 43.0, 3003)", "0"))
+	return -365;
+    ret =
+	sqlite3_exec (handle,
+		      "DROP TABLE test_knn; SELECT DisableSpatialIndex('knn_pts', 'geom'); "
+		      "DROP TABLE idx_knn_pts_geom; "
+		      "SELECT DiscardGeometryColumn('knn_pts', 'geom'); "
+		      "DROP TABLE knn_pts", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "VirtualKNN cleanup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -366;
+      }
+    return 0;
+}
+
+int
+do_test_sjoin (sqlite3 * handle)
+{
+/* testing the VirtualSpatialJoin module */
+    char *err_msg = NULL;
+    int ret;
+
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE VIRTUAL TABLE test_sjoin USING VirtualSpatialJoin()",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "VirtualSpatialJoin setup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -371;
+      }
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT Count(*) FROM test_sjoin WHERE left_table = 'Councils' "
+	 "AND right_table = 'Councils' AND predicate = 'mbr') = "
+	 "(SELECT Count(*) FROM Councils AS a, Councils AS b "
+	 "WHERE MbrIntersects(a.geom, b.geom))", "1"))
+	return -372;
+#ifndef OMIT_GEOS		/* GEOS is supported */
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT Sum(left_rowid * 1000 + right_rowid) FROM test_sjoin "
+	 "WHERE left_table = 'Councils' AND left_geometry = 'geom' "
+	 "AND right_table = 'Councils' AND right_geometry = 'geom') = "
+	 "(SELECT Sum(a.PK_UID * 1000 + b.PK_UID) FROM Councils AS a, "
+	 "Councils AS b WHERE ST_Intersects(a.geom, b.geom))", "1"))
+	return -373;
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM test_sjoin WHERE left_table = 'Councils' "
+	 "AND right_table = 'Councils' AND predicate = 'equals' "
+	 "AND left_rowid <> right_rowid", "0"))
+	return -374;
+#endif /* end GEOS conditional */
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM test_sjoin WHERE left_table = 'Councils' "
+	 "AND right_table = 'Councils' AND predicate = 'unknown'", "0"))
+	return -375;
+    ret =
+	sqlite3_exec (handle, "DROP TABLE test_sjoin", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "VirtualSpatialJoin cleanup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -376;
+      }
+    return 0;
+}
+
+static int
+check_qmbr_filter (sqlite3 * handle, const char *relation, const char *frame)
+{
+/* 
+/ checks that the SpatialIndex candidates for a FilterMbr<relation>
+/ frame are a proper superset of the exact Mbr<relation> matches
+*/
+    int ret;
+    char *sql = sqlite3_mprintf ("SELECT "
+				 "(SELECT Count(*) FROM qmbr_councils WHERE Mbr%s(geom, BuildMbr(%s))) > 0 "
+				 "AND (SELECT Count(*) FROM qmbr_councils WHERE Mbr%s(geom, BuildMbr(%s)) "
+				 "AND id NOT IN (SELECT ROWID FROM SpatialIndex "
+				 "WHERE f_table_name = 'qmbr_councils' AND search_frame = FilterMbr%s(%s))) = 0 "
+				 "AND (SELECT Count(*) FROM SpatialIndex "
+				 "WHERE f_table_name = 'qmbr_councils' AND search_frame = FilterMbr%s(%s)) < "
+				 "(SELECT Count(*) FROM qmbr_councils)",
+				 relation, frame, relation, frame, relation,
+				 frame, relation, frame);
+    ret = check_int_result (handle, sql, "1");
+    sqlite3_free (sql);
+    return ret;
+}
+
+int
+do_test_qmbr (sqlite3 * handle)
+{
+/* testing the Quantized MBR index */
+    char *err_msg = NULL;
+    int ret;
+
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE TABLE qmbr_councils (id INTEGER PRIMARY KEY); "
+		      "SELECT AddGeometryColumn('qmbr_councils', 'geom', 23032, 'MULTIPOLYGON', 'XY'); "
+		      "INSERT INTO qmbr_councils SELECT PK_UID, geom FROM Councils",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Quantized MBR index setup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -381;
+      }
+    if (!check_int_result
+	(handle, "SELECT CreateQuantizedMbrIndex('qmbr_councils', 'geom')",
+	 "1"))
+	return -382;
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT group_concat(ROWID) FROM SpatialIndex "
+	 "WHERE f_table_name = 'qmbr_councils' AND search_frame = "
+	 "BuildMbr(1000000, 4600000, 1040000, 4640000)) = "
+	 "(SELECT group_concat(id) FROM qmbr_councils "
+	 "WHERE MbrIntersects(geom, BuildMbr(1000000, 4600000, 1040000, 4640000)))",
+	 "1"))
+	return -383;
+    ret =
+	sqlite3_exec (handle,
+		      "DELETE FROM qmbr_councils WHERE id = 1; "
+		      "UPDATE qmbr_councils SET geom = ST_Translate(geom, 1000000, 0, 0) WHERE id = 2; "
+		      "INSERT INTO qmbr_councils VALUES (1000, "
+		      "CastToMultiPolygon(BuildMbr(0, 0, 10, 10, 23032)))",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Quantized MBR index edit error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -384;
+      }
+    if (!check_int_result
+	(handle,
+	 "SELECT group_concat(ROWID) FROM SpatialIndex WHERE f_table_name = 'qmbr_councils' "
+	 "AND f_geometry_column = 'geom' AND search_frame = BuildMbr(-5, -5, 5, 5)",
+	 "1000"))
+	return -385;
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT Count(*) FROM SpatialIndex WHERE f_table_name = 'qmbr_councils' "
+	 "AND search_frame = BuildMbr(-1e9, -1e9, 1e9, 1e9)) = "
+	 "(SELECT Count(*) FROM qmbr_councils WHERE geom IS NOT NULL)", "1"))
+	return -386;
+    if (!check_qmbr_filter
+	(handle, "Within", "900000, 4500000, 1100000, 4700000"))
+	return -426;
+    if (!check_qmbr_filter
+	(handle, "Contains",
+	 "(SELECT MbrMinX(geom) + 10 FROM qmbr_councils WHERE id = 10), "
+	 "(SELECT MbrMinY(geom) + 10 FROM qmbr_councils WHERE id = 10), "
+	 "(SELECT MbrMinX(geom) + 20 FROM qmbr_councils WHERE id = 10), "
+	 "(SELECT MbrMinY(geom) + 20 FROM qmbr_councils WHERE id = 10)"))
+	return -427;
+
+/* rebuilding the Quantized MBR index as INT16 grid cells */
+    if (!check_int_result
+	(handle, "SELECT CreateQuantizedMbrIndex('qmbr_councils', 'geom', 8)",
+	 "0"))
+	return -428;
+    if (!check_int_result
+	(handle, "SELECT DisableQuantizedMbrIndex('qmbr_councils', 'geom')",
+	 "1"))
+	return -429;
+    if (!check_int_result
+	(handle,
+	 "SELECT CreateQuantizedMbrIndex('qmbr_councils', 'geom', 16)", "1"))
+	return -430;
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM idx_qmbr_councils_geom_qmbr WHERE Length(data) <> 544",
+	 "0"))
+	return -439;
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT group_concat(ROWID) FROM SpatialIndex "
+	 "WHERE f_table_name = 'qmbr_councils' AND search_frame = "
+	 "BuildMbr(1000000, 4600000, 1040000, 4640000)) = "
+	 "(SELECT group_concat(id) FROM qmbr_councils "
+	 "WHERE MbrIntersects(geom, BuildMbr(1000000, 4600000, 1040000, 4640000)))",
+	 "1"))
+	return -440;
+    if (!check_qmbr_filter
+	(handle, "Within", "900000, 4500000, 1100000, 4700000"))
+	return -441;
+    if (!check_qmbr_filter
+	(handle, "Contains",
+	 "(SELECT MbrMinX(geom) + 10 FROM qmbr_councils WHERE id = 10), "
+	 "(SELECT MbrMinY(geom) + 10 FROM qmbr_councils WHERE id = 10), "
+	 "(SELECT MbrMinX(geom) + 20 FROM qmbr_councils WHERE id = 10), "
+	 "(SELECT MbrMinY(geom) + 20 FROM qmbr_councils WHERE id = 10)"))
+	return -442;
+    ret =
+	sqlite3_exec (handle,
+		      "INSERT INTO qmbr_councils VALUES (2000, "
+		      "CastToMultiPolygon(BuildMbr(-1e8, -1e8, -1e8 + 10, -1e8 + 10, 23032)))",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Quantized MBR index INT16 edit error: %s\n",
+		   err_msg);
+	  sqlite3_free (err_msg);
+	  return -443;
+      }
+    if (!check_int_result
+	(handle,
+	 "SELECT 2000 IN (SELECT ROWID FROM SpatialIndex WHERE f_table_name = 'qmbr_councils' "
+	 "AND search_frame = BuildMbr(-1e8 - 5, -1e8 - 5, -1e8 + 5, -1e8 + 5))",
+	 "1"))
+	return -444;
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT Count(*) FROM SpatialIndex WHERE f_table_name = 'qmbr_councils' "
+	 "AND search_frame = BuildMbr(-1e9, -1e9, 1e9, 1e9)) = "
+	 "(SELECT Count(*) FROM qmbr_councils WHERE geom IS NOT NULL)", "1"))
+	return -445;
+    if (!check_int_result
+	(handle, "SELECT DisableQuantizedMbrIndex('qmbr_councils', 'geom')",
+	 "1"))
+	return -387;
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM sqlite_master WHERE name LIKE 'idx_qmbr_councils_%'",
+	 "0"))
+	return -388;
+    ret =
+	sqlite3_exec (handle,
+		      "SELECT DiscardGeometryColumn('qmbr_councils', 'geom'); "
+		      "DROP TABLE qmbr_councils", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Quantized MBR index cleanup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -389;
+      }
+    return 0;
+}
+
+int
+do_test_resolve_cache (sqlite3 * handle)
+{
+/* 
+/ testing that VirtualSpatialIndex re-resolves its cached R*Tree
+/ after a schema change on the same connection
+*/
+    char *err_msg = NULL;
+    int ret;
+
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE TABLE rc_pts (id INTEGER PRIMARY KEY); "
+		      "SELECT AddGeometryColumn('rc_pts', 'geom', 4326, 'POINT', 'XY'); "
+		      "INSERT INTO rc_pts VALUES (1, MakePoint(1, 1, 4326)); "
+		      "INSERT INTO rc_pts VALUES (2, MakePoint(2, 2, 4326)); "
+		      "INSERT INTO rc_pts VALUES (3, MakePoint(3, 3, 4326)); "
+		      "SELECT CreateSpatialIndex('rc_pts', 'geom')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "resolve cache setup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -446;
+      }
+    if (!check_int_result
+	(handle,
+	 "SELECT group_concat(ROWID) FROM SpatialIndex WHERE f_table_name = 'rc_pts' "
+	 "AND search_frame = BuildMbr(0, 0, 10, 10)", "1,2,3"))
+	return -447;
+
+/* replacing the indexed Geometry column by another one */
+    ret =
+	sqlite3_exec (handle,
+		      "SELECT DisableSpatialIndex('rc_pts', 'geom'); "
+		      "DROP TABLE idx_rc_pts_geom; "
+		      "SELECT DiscardGeometryColumn('rc_pts', 'geom'); "
+		      "SELECT AddGeometryColumn('rc_pts', 'geom2', 4326, 'POINT', 'XY'); "
+		      "UPDATE rc_pts SET geom2 = MakePoint(5, 5, 4326) WHERE id = 2; "
+		      "SELECT CreateSpatialIndex('rc_pts', 'geom2')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "resolve cache column error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -448;
+      }
+    if (!check_int_result
+	(handle,
+	 "SELECT group_concat(ROWID) FROM SpatialIndex WHERE f_table_name = 'rc_pts' "
+	 "AND search_frame = BuildMbr(0, 0, 10, 10)", "2"))
+	return -449;
+    if (!check_int_result
+	(handle,
+	 "SELECT group_concat(ROWID) FROM SpatialIndex WHERE f_table_name = 'rc_pts' "
+	 "AND f_geometry_column = 'geom2' AND search_frame = BuildMbr(0, 0, 10, 10)",
+	 "2"))
+	return -450;
+
+/* replacing the R*Tree by a Quantized MBR index */
+    ret =
+	sqlite3_exec (handle,
+		      "SELECT DisableSpatialIndex('rc_pts', 'geom2'); "
+		      "DROP TABLE idx_rc_pts_geom2; "
+		      "UPDATE rc_pts SET geom2 = MakePoint(6, 6, 4326) WHERE id = 3; "
+		      "SELECT CreateQuantizedMbrIndex('rc_pts', 'geom2')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "resolve cache index error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -451;
+      }
+    if (!check_int_result
+	(handle,
+	 "SELECT group_concat(ROWID) FROM SpatialIndex WHERE f_table_name = 'rc_pts' "
+	 "AND f_geometry_column = 'geom2' AND search_frame = BuildMbr(0, 0, 10, 10)",
+	 "2,3"))
+	return -452;
+
+/* dropping and recreating the whole indexed table */
+    ret =
+	sqlite3_exec (handle,
+		      "SELECT DisableQuantizedMbrIndex('rc_pts', 'geom2'); "
+		      "SELECT DiscardGeometryColumn('rc_pts', 'geom2'); "
+		      "DROP TABLE rc_pts; "
+		      "CREATE TABLE rc_pts (id INTEGER PRIMARY KEY); "
+		      "SELECT AddGeometryColumn('rc_pts', 'geom2', 4326, 'POINT', 'XY'); "
+		      "INSERT INTO rc_pts VALUES (7, MakePoint(7, 7, 4326)); "
+		      "SELECT CreateSpatialIndex('rc_pts', 'geom2')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "resolve cache table error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -453;
+      }
+    if (!check_int_result
+	(handle,
+	 "SELECT group_concat(ROWID) FROM SpatialIndex WHERE f_table_name = 'rc_pts' "
+	 "AND f_geometry_column = 'geom2' AND search_frame = BuildMbr(0, 0, 10, 10)",
+	 "7"))
+	return -454;
+
+    ret =
+	sqlite3_exec (handle,
+		      "SELECT DisableSpatialIndex('rc_pts', 'geom2'); "
+		      "DROP TABLE idx_rc_pts_geom2; "
+		      "SELECT DiscardGeometryColumn('rc_pts', 'geom2'); "
+		      "DROP TABLE rc_pts", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "resolve cache cleanup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -455;
+      }
+    return 0;
+}
+
+int
+do_test_geo_radius (sqlite3 * handle)
+{
+/* testing SpatialIndex searches by geodesic radius (meters) */
+    char *err_msg = NULL;
+    int ret;
+    sqlite3_stmt *stmt;
+    int i;
+    char *sql;
+    double centers[] = {
+	179.5, 10.0, 800000.0, -179.9, -35.0, 450000.0, 5.0, 88.5, 400000.0,
+	-60.0, 45.0, 250000.0
+    };
+
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE TABLE geo_pts (id INTEGER PRIMARY KEY); "
+		      "SELECT AddGeometryColumn('geo_pts', 'geom', 4326, 'POINT', 'XY'); "
+		      "WITH RECURSIVE lon(x) AS (SELECT -180.0 UNION ALL "
+		      "SELECT x + 2.5 FROM lon WHERE x < 180.0), "
+		      "lat(y) AS (SELECT -89.0 UNION ALL SELECT y + 1.5 FROM lat WHERE y < 89.0) "
+		      "INSERT INTO geo_pts (geom) SELECT MakePoint(x, y, 4326) FROM lon, lat; "
+		      "SELECT CreateSpatialIndex('geo_pts', 'geom')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Geodesic radius setup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -411;
+      }
+    for (i = 0; i < 12; i += 3)
+      {
+	  /* no missing features, no duplicates, and only a few extra candidates */
+	  sql =
+	      sqlite3_mprintf
+	      ("SELECT (SELECT Count(*) FROM geo_pts WHERE PtDistWithin(geom, "
+	       "MakePoint(%f, %f, 4326), %f, 1) AND id NOT IN (SELECT ROWID FROM "
+	       "SpatialIndex WHERE f_table_name = 'geo_pts' AND search_frame = "
+	       "MakePoint(%f, %f, 4326) AND search_radius = %f)) = 0",
+	       centers[i], centers[i + 1], centers[i + 2], centers[i],
+	       centers[i + 1], centers[i + 2]);
+	  ret = check_int_result (handle, sql, "1");
+	  sqlite3_free (sql);
+	  if (!ret)
+	      return -412;
+	  sql =
+	      sqlite3_mprintf
+	      ("SELECT Count(*) = Count(DISTINCT ROWID) AND Count(*) > 0 AND "
+	       "Count(*) < 1.05 * (SELECT Count(*) FROM geo_pts WHERE PtDistWithin(geom, "
+	       "MakePoint(%f, %f, 4326), %f, 1)) FROM SpatialIndex "
+	       "WHERE f_table_name = 'geo_pts' AND f_geometry_column = 'geom' "
+	       "AND search_frame = MakePoint(%f, %f, 4326) AND search_radius = %f",
+	       centers[i], centers[i + 1], centers[i + 2], centers[i],
+	       centers[i + 1], centers[i + 2]);
+	  ret = check_int_result (handle, sql, "1");
+	  sqlite3_free (sql);
+	  if (!ret)
+	      return -413;
+      }
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM SpatialIndex WHERE f_table_name = 'geo_pts' "
+	 "AND search_frame = BuildMbr(0, 0, 1, 1, 4326) AND search_radius = 1000",
+	 "0"))
+	return -414;
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM SpatialIndex WHERE f_table_name = 'geo_pts' "
+	 "AND search_frame = MakePoint(0, 0, 4326) AND search_radius = -1",
+	 "0"))
+	return -415;
+
+/* a radius in meters is meaningless for a non-geographic SRID */
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE TABLE geo_utm (id INTEGER PRIMARY KEY); "
+		      "SELECT AddGeometryColumn('geo_utm', 'geom', 23032, 'POINT', 'XY'); "
+		      "INSERT INTO geo_utm SELECT id, MakePoint(X(geom), Y(geom), 23032) "
+		      "FROM geo_pts; SELECT CreateSpatialIndex('geo_utm', 'geom')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Geodesic radius setup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -417;
+      }
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) > 0 FROM SpatialIndex WHERE f_table_name = 'geo_utm' "
+	 "AND search_frame = BuildMbr(-65, 40, -55, 50)", "1"))
+	return -418;
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM SpatialIndex WHERE f_table_name = 'geo_utm' "
+	 "AND search_frame = MakePoint(-60, 45) AND search_radius = 250000",
+	 "0"))
+	return -419;
+
+/* R*Tree geometry callbacks may be disabled at build time */
+    ret =
+	sqlite3_prepare_v2 (handle, "SELECT RTreeGeoDistWithin(0, 0, 1)", -1,
+			    &stmt, NULL);
+    if (ret == SQLITE_OK)
+      {
+	  sqlite3_finalize (stmt);
+	  for (i = 0; i < 12; i += 3)
+	    {
+		/* the MATCH callback and SpatialIndex agree on the candidates */
+		sql =
+		    sqlite3_mprintf
+		    ("SELECT (SELECT group_concat(pkid) FROM (SELECT pkid "
+		     "FROM idx_geo_pts_geom WHERE pkid MATCH "
+		     "RTreeGeoDistWithin(%f, %f, %f) ORDER BY pkid)) = "
+		     "(SELECT group_concat(ROWID) FROM (SELECT ROWID "
+		     "FROM SpatialIndex WHERE f_table_name = 'geo_pts' AND "
+		     "search_frame = MakePoint(%f, %f, 4326) AND "
+		     "search_radius = %f ORDER BY ROWID))", centers[i],
+		     centers[i + 1], centers[i + 2], centers[i],
+		     centers[i + 1], centers[i + 2]);
+		ret = check_int_result (handle, sql, "1");
+		sqlite3_free (sql);
+		if (!ret)
+		    return -420;
+		sql =
+		    sqlite3_mprintf
+		    ("SELECT (SELECT group_concat(pkid) FROM idx_geo_pts_geom "
+		     "WHERE pkid MATCH RTreeGeoDistWithin(%f, %f, %f)) = "
+		     "(SELECT group_concat(pkid) FROM idx_geo_pts_geom "
+		     "WHERE pkid MATCH RTreeGeoDistWithin(%f, %f, %f, 4326))",
+		     centers[i], centers[i + 1], centers[i + 2], centers[i],
+		     centers[i + 1], centers[i + 2]);
+		ret = check_int_result (handle, sql, "1");
+		sqlite3_free (sql);
+		if (!ret)
+		    return -421;
+	    }
+	  ret =
+	      sqlite3_exec (handle,
+			    "SELECT pkid FROM idx_geo_utm_geom WHERE pkid MATCH "
+			    "RTreeGeoDistWithin(-60, 45, 250000, 23032)", NULL,
+			    NULL, NULL);
+	  if (ret == SQLITE_OK)
+	    {
+		fprintf (stderr,
+			 "RTreeGeoDistWithin: unexpected success (non-geographic SRID)\n");
+		return -422;
+	    }
+      }
+    ret =
+	sqlite3_exec (handle,
+		      "SELECT DisableSpatialIndex('geo_utm', 'geom'); "
+		      "DROP TABLE idx_geo_utm_geom; "
+		      "SELECT DiscardGeometryColumn('geo_utm', 'geom'); "
+		      "DROP TABLE geo_utm; "
+		      "SELECT DisableSpatialIndex('geo_pts', 'geom'); "
+		      "DROP TABLE idx_geo_pts_geom; "
+		      "SELECT DiscardGeometryColumn('geo_pts', 'geom'); "
+		      "DROP TABLE geo_pts", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Geodesic radius cleanup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -416;
+      }
+    return 0;
+}
+
+struct rtree_check
+{
+/* prepared statements used while walking an R*Tree */
+    sqlite3_stmt *node;
+    sqlite3_stmt *parent;
+    sqlite3_stmt *rowid;
+    int nodes;
+    int entries;
+};
+
+static float
+rtree_cell_coord (const unsigned char *cell, int i)
+{
+/* decoding a big-endian 32 bit float from an R*Tree cell */
+    float value;
+    unsigned int bits;
+    const unsigned char *p = cell + 8 + (i * 4);
+    bits = ((unsigned int) p[0] << 24) | ((unsigned int) p[1] << 16) |
+	((unsigned int) p[2] << 8) | (unsigned int) p[3];
+    memcpy (&value, &bits, sizeof (float));
+    return value;
+}
+
+static sqlite3_int64
+rtree_cell_id (const unsigned char *cell)
+{
+/* decoding the big-endian 64 bit rowid/child of an R*Tree cell */
+    sqlite3_int64 id = 0;
+    int i;
+    for (i = 0; i < 8; i++)
+	id = (id << 8) | cell[i];
+    return id;
+}
+
+static int
+rtree_lookup (sqlite3_stmt * stmt, sqlite3_int64 key, sqlite3_int64 * value)
+{
+/* single-value lookup into one of the R*Tree shadow tables */
+    int ok = 0;
+    sqlite3_reset (stmt);
+    sqlite3_bind_int64 (stmt, 1, key);
+    if (sqlite3_step (stmt) == SQLITE_ROW)
+      {
+	  *value = sqlite3_column_int64 (stmt, 0);
+	  ok = 1;
+      }
+    sqlite3_reset (stmt);
+    return ok;
+}
+
+static int
+check_rtree_node (struct rtree_check *chk, sqlite3_int64 nodeno, int depth,
+		  const float *box)
+{
+/* recursively validating an R*Tree node and all its descendants */
+    unsigned char *data;
+    int bytes;
+    int count;
+    int height;
+    int i;
+    int k;
+    float cbox[4];
+    sqlite3_int64 id;
+    sqlite3_int64 value;
+
+    sqlite3_reset (chk->node);
+    sqlite3_bind_int64 (chk->node, 1, nodeno);
+    if (sqlite3_step (chk->node) != SQLITE_ROW)
+      {
+	  fprintf (stderr, "R*Tree: missing node %lld\n", nodeno);
+	  return 0;
+      }
+    bytes = sqlite3_column_bytes (chk->node, 0);
+    data = malloc (bytes);
+    memcpy (data, sqlite3_column_blob (chk->node, 0), bytes);
+    sqlite3_reset (chk->node);
+    chk->nodes++;
+    count = (data[2] << 8) | data[3];
+    height = (data[0] << 8) | data[1];
+    if (depth < 0)
+	depth = height;
+    if (count > (bytes - 4) / 24 || (count == 0 && nodeno != 1))
+      {
+	  fprintf (stderr, "R*Tree: node %lld holds %d cells\n", nodeno,
+		   count);
+	  free (data);
+	  return 0;
+      }
+    for (i = 0; i < count; i++)
+      {
+	  const unsigned char *cell = data + 4 + (i * 24);
+	  id = rtree_cell_id (cell);
+	  for (k = 0; k < 4; k++)
+	      cbox[k] = rtree_cell_coord (cell, k);
+	  if (cbox[0] > cbox[1] || cbox[2] > cbox[3])
+	    {
+		fprintf (stderr, "R*Tree: node %lld cell %d is inverted\n",
+			 nodeno, i);
+		free (data);
+		return 0;
+	    }
+	  if (box != NULL
+	      && (cbox[0] < box[0] || cbox[1] > box[1] || cbox[2] < box[2]
+		  || cbox[3] > box[3]))
+	    {
+		fprintf (stderr,
+			 "R*Tree: node %lld cell %d exceeds its parent\n",
+			 nodeno, i);
+		free (data);
+		return 0;
+	    }
+	  if (depth > 0)
+	    {
+		/* interior cell: the child must point back to this node */
+		if (!rtree_lookup (chk->parent, id, &value) || value != nodeno)
+		  {
+		      fprintf (stderr, "R*Tree: bad parent for node %lld\n",
+			       id);
+		      free (data);
+		      return 0;
+		  }
+		if (!check_rtree_node (chk, id, depth - 1, cbox))
+		  {
+		      free (data);
+		      return 0;
+		  }
+	    }
+	  else
+	    {
+		/* leaf cell: the rowid must map to this very node */
+		if (!rtree_lookup (chk->rowid, id, &value) || value != nodeno)
+		  {
+		      fprintf (stderr, "R*Tree: bad node for rowid %lld\n",
+			       id);
+		      free (data);
+		      return 0;
+		  }
+		chk->entries++;
+	    }
+      }
+    free (data);
+    return 1;
+}
+
+static int
+check_rtree_structure (sqlite3 * handle, const char *rtree)
+{
+/*
+/ validating the internal structure of an R*Tree: cells nested into
+/ their parents, all leaves at the same depth, and the _parent and
+/ _rowid shadow tables consistent with the nodes actually reachable
+/ (the same checks as rtreecheck(), missing from older SQLite)
+*/
+    struct rtree_check chk;
+    char *sql;
+    char *count;
+    int ok = 0;
+
+    memset (&chk, 0, sizeof (chk));
+    sql = sqlite3_mprintf ("SELECT data FROM \"%w_node\" WHERE nodeno = ?",
+			   rtree);
+    sqlite3_prepare_v2 (handle, sql, -1, &chk.node, NULL);
+    sqlite3_free (sql);
+    sql =
+	sqlite3_mprintf
+	("SELECT parentnode FROM \"%w_parent\" WHERE nodeno = ?", rtree);
+    sqlite3_prepare_v2 (handle, sql, -1, &chk.parent, NULL);
+    sqlite3_free (sql);
+    sql = sqlite3_mprintf ("SELECT nodeno FROM \"%w_rowid\" WHERE rowid = ?",
+			   rtree);
+    sqlite3_prepare_v2 (handle, sql, -1, &chk.rowid, NULL);
+    sqlite3_free (sql);
+    if (chk.node == NULL || chk.parent == NULL || chk.rowid == NULL)
+      {
+	  fprintf (stderr, "R*Tree %s: %s\n", rtree, sqlite3_errmsg (handle));
+	  goto stop;
+      }
+    if (!check_rtree_node (&chk, 1, -1, NULL))
+	goto stop;
+
+/* no orphan nodes, parents or rowids left behind */
+    sql = sqlite3_mprintf ("SELECT (SELECT Count(*) FROM \"%w_node\") || ' ' "
+			   "|| (SELECT Count(*) FROM \"%w_parent\") || ' ' || "
+			   "(SELECT Count(*) FROM \"%w_rowid\")", rtree, rtree,
+			   rtree);
+    count = sqlite3_mprintf ("%d %d %d", chk.nodes, chk.nodes - 1,
+			     chk.entries);
+    ok = check_int_result (handle, sql, count);
+    sqlite3_free (sql);
+    sqlite3_free (count);
+  stop:
+    sqlite3_finalize (chk.node);
+    sqlite3_finalize (chk.parent);
+    sqlite3_finalize (chk.rowid);
+    return ok;
+}
+
+int
+do_test_bulk_load (sqlite3 * handle)
+{
+/* testing the R*Tree bulk load performed by CreateSpatialIndex */
+    char *err_msg = NULL;
+    int ret;
+    int i;
+    int max_cells;
+    int partial = 0;
+    int depth = 0;
+    char *sql;
+    sqlite3_stmt *stmt;
+    const unsigned char *blob;
+    double windows[] = {
+	0.0, 0.0, 24.75, 12.25, 10.125, 3.125, 10.375, 3.375, -5.0, -5.0,
+	100.0, 100.0, 24.75, 0.0, 24.75, 12.25, 30.0, 30.0, 40.0, 40.0
+    };
+
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE TABLE bulk_pts (id INTEGER PRIMARY KEY); "
+		      "SELECT AddGeometryColumn('bulk_pts', 'geom', 4326, 'POINT', 'XY'); "
+		      "WITH RECURSIVE gx(x) AS (SELECT 0 UNION ALL "
+		      "SELECT x + 1 FROM gx WHERE x < 99), "
+		      "gy(y) AS (SELECT 0 UNION ALL SELECT y + 1 FROM gy WHERE y < 49) "
+		      "INSERT INTO bulk_pts (geom) SELECT MakePoint(x * 0.25, y * 0.25, 4326) "
+		      "FROM gx, gy; INSERT INTO bulk_pts (geom) VALUES (NULL); "
+		      "SELECT CreateSpatialIndex('bulk_pts', 'geom')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "R*Tree bulk load setup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -431;
+      }
+    if (!check_int_result
+	(handle, "SELECT CheckSpatialIndex('bulk_pts', 'geom')", "1"))
+	return -432;
+    if (!check_rtree_structure (handle, "idx_bulk_pts_geom"))
+	return -474;
+
+/* the same points indexed one by one by the triggers */
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE TABLE bulk_ref (id INTEGER PRIMARY KEY); "
+		      "SELECT AddGeometryColumn('bulk_ref', 'geom', 4326, 'POINT', 'XY'); "
+		      "SELECT CreateSpatialIndex('bulk_ref', 'geom'); "
+		      "INSERT INTO bulk_ref (id, geom) SELECT id, geom FROM bulk_pts",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "R*Tree trigger load error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -475;
+      }
+    if (!check_rtree_structure (handle, "idx_bulk_ref_geom"))
+	return -476;
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT Count(*) FROM (SELECT * FROM idx_bulk_pts_geom "
+	 "EXCEPT SELECT * FROM idx_bulk_ref_geom)) + (SELECT Count(*) FROM "
+	 "(SELECT * FROM idx_bulk_ref_geom EXCEPT SELECT * FROM "
+	 "idx_bulk_pts_geom)) + (SELECT Count(*) FROM idx_bulk_pts_geom) - "
+	 "(SELECT Count(*) FROM idx_bulk_ref_geom)", "0"))
+	return -477;
+
+/* bulk loaded nodes are fully packed: at most one partial node per level */
+    ret =
+	sqlite3_prepare_v2 (handle,
+			    "SELECT nodeno, data FROM idx_bulk_pts_geom_node",
+			    -1, &stmt, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "R*Tree bulk load nodes error: %s\n",
+		   sqlite3_errmsg (handle));
+	  return -433;
+      }
+    while (sqlite3_step (stmt) == SQLITE_ROW)
+      {
+	  blob = sqlite3_column_blob (stmt, 1);
+	  max_cells = (sqlite3_column_bytes (stmt, 1) - 4) / 24;
+	  if (sqlite3_column_int (stmt, 0) == 1)
+	      depth = (blob[0] << 8) | blob[1];
+	  else if (((blob[2] << 8) | blob[3]) < max_cells)
+	      partial++;
+      }
+    sqlite3_finalize (stmt);
+    if (depth < 1 || partial > depth)
+      {
+	  fprintf (stderr, "R*Tree bulk load: %d partial nodes\n", partial);
+	  return -434;
+      }
+
+/* the packed R*Tree returns exactly the expected items */
+    for (i = 0; i < 20; i += 4)
+      {
+	  sql =
+	      sqlite3_mprintf
+	      ("SELECT (SELECT group_concat(pkid) FROM (SELECT pkid FROM "
+	       "idx_bulk_pts_geom WHERE xmin <= %f AND xmax >= %f AND "
+	       "ymin <= %f AND ymax >= %f ORDER BY pkid)) IS "
+	       "(SELECT group_concat(id) FROM (SELECT id FROM bulk_pts "
+	       "WHERE MbrIntersects(geom, BuildMbr(%f, %f, %f, %f)) ORDER BY id)) "
+	       "AND (SELECT group_concat(pkid) FROM (SELECT pkid FROM "
+	       "idx_bulk_ref_geom WHERE xmin <= %f AND xmax >= %f AND "
+	       "ymin <= %f AND ymax >= %f ORDER BY pkid)) IS "
+	       "(SELECT group_concat(id) FROM (SELECT id FROM bulk_pts "
+	       "WHERE MbrIntersects(geom, BuildMbr(%f, %f, %f, %f)) ORDER BY id))",
+	       windows[i + 2], windows[i], windows[i + 3], windows[i + 1],
+	       windows[i], windows[i + 1], windows[i + 2], windows[i + 3],
+	       windows[i + 2], windows[i], windows[i + 3], windows[i + 1],
+	       windows[i], windows[i + 1], windows[i + 2], windows[i + 3]);
+	  ret = check_int_result (handle, sql, "1");
+	  sqlite3_free (sql);
+	  if (!ret)
+	      return -435;
+      }
+
+/* the R*Tree module keeps on maintaining the packed tree */
+    ret =
+	sqlite3_exec (handle,
+		      "DELETE FROM bulk_pts WHERE id % 7 = 0; "
+		      "UPDATE bulk_pts SET geom = MakePoint(50.0, 50.0, 4326) WHERE id % 11 = 0; "
+		      "INSERT INTO bulk_pts (geom) SELECT MakePoint(X(geom) + 0.125, "
+		      "Y(geom), 4326) FROM bulk_pts WHERE id % 5 = 0",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "R*Tree bulk load edit error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -436;
+      }
+    if (!check_int_result
+	(handle, "SELECT CheckSpatialIndex('bulk_pts', 'geom')", "1"))
+	return -437;
+    if (!check_rtree_structure (handle, "idx_bulk_pts_geom"))
+	return -478;
+    if (sqlite3_libversion_number () >= 3024000)
+      {
+	  /* rtreecheck() is only available since SQLite 3.24.0 */
+	  if (!check_int_result
+	      (handle, "SELECT rtreecheck('idx_bulk_pts_geom')", "ok"))
+	      return -479;
+      }
+    ret =
+	sqlite3_exec (handle,
+		      "SELECT DisableSpatialIndex('bulk_ref', 'geom'); "
+		      "DROP TABLE idx_bulk_ref_geom; "
+		      "SELECT DiscardGeometryColumn('bulk_ref', 'geom'); "
+		      "DROP TABLE bulk_ref; "
+		      "SELECT DisableSpatialIndex('bulk_pts', 'geom'); "
+		      "DROP TABLE idx_bulk_pts_geom; "
+		      "SELECT DiscardGeometryColumn('bulk_pts', 'geom'); "
+		      "DROP TABLE bulk_pts", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "R*Tree bulk load cleanup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -438;
+      }
+    return 0;
+}
+
+int
+do_test_slayer (sqlite3 * handle)
+{
+/* testing the VirtualSpatialLayer module */
+    char *err_msg = NULL;
+    int ret;
+
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE VIRTUAL TABLE test_slayer USING VirtualSpatialLayer(Councils, geom)",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "VirtualSpatialLayer setup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -391;
+      }
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT group_concat(PK_UID) FROM test_slayer "
+	 "WHERE geom MATCH BuildMbr(1000000, 4600000, 1040000, 4640000)) = "
+	 "(SELECT group_concat(PK_UID) FROM Councils "
+	 "WHERE MbrIntersects(geom, BuildMbr(1000000, 4600000, 1040000, 4640000)))",
+	 "1"))
+	return -392;
+/* MATCH is the indexed form, while the overloaded predicates are not */
+    if (!check_query_plan
+	(handle,
+	 "SELECT PK_UID FROM test_slayer "
+	 "WHERE geom MATCH BuildMbr(1000000, 4600000, 1040000, 4640000)",
+	 "VIRTUAL TABLE INDEX 1:"))
+	return -398;
+    if (!check_query_plan
+	(handle,
+	 "SELECT PK_UID FROM test_slayer "
+	 "WHERE MbrWithin(geom, BuildMbr(1000000, 4600000, 1040000, 4640000))",
+	 "VIRTUAL TABLE INDEX 0:"))
+	return -399;
+#ifndef OMIT_GEOS		/* GEOS is supported */
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT group_concat(PK_UID) FROM test_slayer "
+	 "WHERE ST_Intersects(geom, BuildCircleMbr(1020000, 4620000, 15000))) = "
+	 "(SELECT group_concat(PK_UID) FROM Councils "
+	 "WHERE ST_Intersects(geom, BuildCircleMbr(1020000, 4620000, 15000)))",
+	 "1"))
+	return -393;
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT group_concat(PK_UID) FROM test_slayer "
+	 "WHERE geom MATCH BuildCircleMbr(1020000, 4620000, 15000) "
+	 "AND ST_Intersects(geom, BuildCircleMbr(1020000, 4620000, 15000))) = "
+	 "(SELECT group_concat(PK_UID) FROM Councils "
+	 "WHERE ST_Intersects(geom, BuildCircleMbr(1020000, 4620000, 15000)))",
+	 "1"))
+	return -390;
+#endif /* end GEOS conditional */
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM test_slayer WHERE MbrWithin(geom, NULL)", "0"))
+	return -394;
+/* invalid arguments: same results as the standard SQL functions */
+    if (!check_int_result
+	(handle,
+	 "SELECT MbrWithin(geom, NULL) IS NULL AND "
+	 "MbrIntersects(geom, zeroblob(8)) IS NULL FROM test_slayer "
+	 "WHERE ROWID = 5", "1"))
+	return -380;
+#ifndef OMIT_GEOS		/* GEOS is supported */
+    if (!check_int_result
+	(handle,
+	 "SELECT ST_Intersects(geom, NULL) || ',' || "
+	 "ST_Within(geom, zeroblob(8)) FROM test_slayer WHERE ROWID = 5",
+	 "-1,-1"))
+	return -379;
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT Count(*) FROM test_slayer "
+	 "WHERE NOT ST_Intersects(geom, zeroblob(8))) = "
+	 "(SELECT Count(*) FROM Councils "
+	 "WHERE NOT ST_Intersects(geom, zeroblob(8)))", "1"))
+	return -378;
+#endif /* end GEOS conditional */
+    if (!check_int_result
+	(handle, "SELECT PK_UID FROM test_slayer WHERE ROWID = 5", "5"))
+	return -395;
+    ret =
+	sqlite3_exec (handle, "DELETE FROM test_slayer", NULL, NULL, &err_msg);
+    if (ret != SQLITE_READONLY)
+      {
+	  fprintf (stderr, "VirtualSpatialLayer unexpected DELETE result\n");
+	  sqlite3_free (err_msg);
+	  return -396;
+      }
+    sqlite3_free (err_msg);
+    err_msg = NULL;
+    ret =
+	sqlite3_exec (handle, "DROP TABLE test_slayer", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "VirtualSpatialLayer cleanup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -397;
+      }
+    return 0;
+}
+
+int
+do_test_pyramid (sqlite3 * handle)
+{
+/* testing the Geometry Pyramid */
+    char *err_msg = NULL;
+    int ret;
+
+/* working on a private copy, so that Councils stays untouched */
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE TABLE pyramid_src (PK_UID INTEGER PRIMARY KEY); "
+		      "SELECT AddGeometryColumn('pyramid_src', 'geom', 23032, 'MULTIPOLYGON', 'XY'); "
+		      "INSERT INTO pyramid_src SELECT PK_UID, geom FROM Councils; "
+		      "SELECT CreateSpatialIndex('pyramid_src', 'geom')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Geometry Pyramid setup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -400;
+      }
+    if (!check_int_result
+	(handle, "SELECT CreateGeometryPyramid('pyramid_src', 'geom', 50, 3)",
+	 "1"))
+	return -401;
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT Sum(ST_NPoints(geom)) FROM pyr_pyramid_src_geom_3) < "
+	 "(SELECT Sum(ST_NPoints(geom)) FROM pyr_pyramid_src_geom_1)", "1"))
+	return -402;
+    if (!check_int_result
+	(handle,
+	 "SELECT GeometryPyramidTable('pyramid_src', 'geom', 10) || ',' || "
+	 "GeometryPyramidTable('pyramid_src', 'geom', 300) || ',' || "
+	 "GeometryPyramidTable('pyramid_src', 'geom', 1e9)",
+	 "pyramid_src,pyr_pyramid_src_geom_2,pyr_pyramid_src_geom_3"))
+	return -403;
+    ret =
+	sqlite3_exec (handle,
+		      "UPDATE pyramid_src SET geom = ST_Translate(geom, 100, 0, 0) "
+		      "WHERE PK_UID = 3; DELETE FROM pyramid_src WHERE PK_UID = 4",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Geometry Pyramid edit error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -404;
+      }
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT Count(*) FROM pyr_pyramid_src_geom_2) = "
+	 "(SELECT Count(*) FROM pyramid_src)", "1"))
+	return -405;
+    if (!check_int_result
+	(handle,
+	 "SELECT MbrIntersects(p.geom, c.geom) FROM pyr_pyramid_src_geom_3 AS p "
+	 "JOIN pyramid_src AS c ON (c.PK_UID = p.id) WHERE p.id = 3", "1"))
+	return -406;
+    if (!check_int_result
+	(handle, "SELECT CheckSpatialIndex('pyr_pyramid_src_geom_1', 'geom')",
+	 "1"))
+	return -407;
+    if (!check_int_result
+	(handle, "SELECT DropGeometryPyramid('pyramid_src', 'geom')", "1"))
+	return -408;
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM sqlite_master WHERE name LIKE 'pyr_pyramid_src_%' "
+	 "OR name LIKE 'idx_pyr_pyramid_src_%'", "0"))
+	return -409;
+
+/* discarding the Geometry Column drops its Pyramid as well */
+    if (!check_int_result
+	(handle, "SELECT CreateGeometryPyramid('pyramid_src', 'geom', 50, 2)",
+	 "1"))
+	return -480;
+    ret =
+	sqlite3_exec (handle,
+		      "SELECT DisableSpatialIndex('pyramid_src', 'geom'); "
+		      "DROP TABLE idx_pyramid_src_geom", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Geometry Pyramid cleanup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -410;
+      }
+    if (!check_int_result
+	(handle, "SELECT DiscardGeometryColumn('pyramid_src', 'geom')", "1"))
+	return -481;
+    if (!check_int_result
+	(handle,
+	 "SELECT (SELECT Count(*) FROM sqlite_master WHERE "
+	 "name LIKE 'pyr_pyramid_src_%' OR name LIKE 'idx_pyr_pyramid_src_%' "
+	 "OR name LIKE 'py__pyramid_src_geom') + (SELECT Count(*) FROM "
+	 "geometry_pyramids WHERE f_table_name = 'pyramid_src') + "
+	 "(SELECT Count(*) FROM geometry_columns WHERE "
+	 "f_table_name LIKE 'pyr_pyramid_src_%')", "0"))
+	return -482;
+    ret =
+	sqlite3_exec (handle, "DROP TABLE pyramid_src", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Geometry Pyramid cleanup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -410;
+      }
+    return 0;
+}
+
+int
+do_test_quantization (sqlite3 * handle)
+{
+/* testing the per-column quantization settings */
+    char *err_msg = NULL;
+    int ret;
+
+    if (!check_int_result
+	(handle, "SELECT SetGeometryQuantization('Councils', 'geom', 3, 64)",
+	 "1"))
+	return -460;
+    if (!check_int_result
+	(handle, "SELECT GetGeometryQuantization('councils', 'GEOM')", "3"))
+	return -461;
+    if (!check_int_result
+	(handle,
+	 "SELECT precision || ',' || block_size FROM geometry_columns_quantization "
+	 "WHERE f_table_name = 'councils' AND f_geometry_column = 'geom'",
+	 "3,64"))
+	return -462;
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM Councils WHERE "
+	 "QuantizeGeometry('Councils', 'geom', geom) IS NOT "
+	 "CompressGeometry(geom, 3, 64)", "0"))
+	return -463;
+    if (!check_int_result
+	(handle, "SELECT SetGeometryQuantization('Councils', 'geom', 16)", "0"))
+	return -464;
+    if (!check_int_result
+	(handle, "SELECT SetGeometryQuantization('Councils', 'none', 3)", "0"))
+	return -465;
+    if (!check_int_result
+	(handle, "SELECT SetGeometryQuantization('Councils', 'geom', 5)", "1"))
+	return -466;
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM Councils WHERE "
+	 "QuantizeGeometry('Councils', 'geom', geom) IS NOT "
+	 "CompressGeometry(geom, 5)", "0"))
+	return -467;
+    if (!check_int_result
+	(handle, "SELECT SetGeometryQuantization('Councils', 'geom', NULL)",
+	 "1"))
+	return -468;
+    if (!check_int_result
+	(handle,
+	 "SELECT QuantizeGeometry('Councils', 'geom', geom) IS NULL "
+	 "FROM Councils WHERE PK_UID = 1", "1"))
+	return -469;
+
+/* discarding the Geometry Column removes its settings as well */
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE TABLE quantized_src (PK_UID INTEGER PRIMARY KEY); "
+		      "SELECT AddGeometryColumn('quantized_src', 'geom', 23032, 'MULTIPOLYGON', 'XY'); "
+		      "SELECT SetGeometryQuantization('quantized_src', 'geom', 2)",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Quantization setup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -470;
+      }
+    if (!check_int_result
+	(handle, "SELECT DiscardGeometryColumn('quantized_src', 'geom')", "1"))
+	return -471;
+    if (!check_int_result
+	(handle,
+	 "SELECT Count(*) FROM geometry_columns_quantization "
+	 "WHERE f_table_name = 'quantized_src'", "0"))
+	return -472;
+    ret =
+	sqlite3_exec (handle, "DROP TABLE quantized_src", NULL, NULL,
+		      &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Quantization cleanup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -473;
+      }
+    return 0;
+}
+
 int
 do_test (sqlite3 * handle, int legacy)
 {
@@ -966,6 +2417,60 @@ do_test (sqlite3 * handle, int legacy)
 	  return -71;
       }
 
+    if (!legacy)
+      {
+	  ret = do_test_deferred (handle);
+	  if (ret != 0)
+	      return ret;
+      }
+
+    ret = do_test_knn (handle);
+    if (ret != 0)
+	return ret;
+
+    ret = do_test_sjoin (handle);
+    if (ret != 0)
+	return ret;
+
+    ret = do_test_qmbr (handle);
+    if (ret != 0)
+	return ret;
+
+    ret = do_test_resolve_cache (handle);
+    if (ret != 0)
+	return ret;
+
+    ret = do_test_geo_radius (handle);
+    if (ret != 0)
+	return ret;
+
+    if (!legacy)
+      {
+	  ret = do_test_bulk_load (handle);
+	  if (ret != 0)
+	      return ret;
+      }
+
+    ret = do_test_slayer (handle);
+    if (ret != 0)
+	return ret;
+
+    if (!legacy)
+      {
+	  ret = do_test_quantization (handle);
+	  if (ret != 0)
+	      return ret;
+      }
+
+#ifndef OMIT_GEOS		/* GEOS is supported */
+    if (!legacy)
+      {
+	  ret = do_test_pyramid (handle);
+	  if (ret != 0)
+	      return ret;
+      }
+#endif /* end GEOS conditional */
+
     ret =
 	sqlite3_exec (handle,
 		      "SELECT RebuildGeometryTriggers('Councils', 'geom');",
@@ -44,6 +44,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <unistd.h>
 
 #include "config.h"
 
@@ -326,6 +327,433 @@ test_srid (sqlite3 * sqlite, int extended)
     return 0;
 }
 
+static int
+srid_unit_is (sqlite3 * sqlite, const char *expected)
+{
+/* checking SridGetUnit(32632) */
+    int ret;
+    const char *sql;
+    sqlite3_stmt *stmt = NULL;
+    int ok = 0;
+
+    sql = "SELECT SridGetUnit(32632)";
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "SridGetUnit: \"%s\"\n", sqlite3_errmsg (sqlite));
+	  return 0;
+      }
+    ret = sqlite3_step (stmt);
+    if (ret == SQLITE_ROW && sqlite3_column_type (stmt, 0) == SQLITE_TEXT)
+      {
+	  const char *value = (const char *) sqlite3_column_text (stmt, 0);
+	  if (strcasecmp (value, expected) == 0)
+	      ok = 1;
+	  else
+	      fprintf (stderr, "32632: Unexpected GetUnit result (%s)\n",
+		       value);
+      }
+    sqlite3_finalize (stmt);
+    return ok;
+}
+
+static int
+test_srs_catalog (sqlite3 * sqlite)
+{
+/* testing that the per-connection SRS catalogue never goes stale */
+    int ret;
+    char *err_msg = NULL;
+
+    if (!srid_unit_is (sqlite, "metre"))
+	return 0;
+    if (!srid_unit_is (sqlite, "metre"))
+	return 0;
+    ret =
+	sqlite3_exec (sqlite,
+		      "UPDATE spatial_ref_sys_aux SET unit = 'foot' "
+		      "WHERE srid = 32632", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "UPDATE unit error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    if (!srid_unit_is (sqlite, "foot"))
+	return 0;
+    ret =
+	sqlite3_exec (sqlite,
+		      "UPDATE spatial_ref_sys_aux SET unit = 'metre' "
+		      "WHERE srid = 32632", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "UPDATE unit error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    return srid_unit_is (sqlite, "metre");
+}
+
+#ifndef OMIT_PROJ		/* only if PROJ is supported */
+static int
+proj_cache_stats (sqlite3 * sqlite, int *hits, int *misses)
+{
+/* retrieving the PROJ.4 cache statistics */
+    int ret;
+    const char *sql;
+    sqlite3_stmt *stmt = NULL;
+    int ok = 0;
+
+    sql = "SELECT PROJ_GetCacheHits(), PROJ_GetCacheMisses()";
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "PROJ cache stats: \"%s\"\n",
+		   sqlite3_errmsg (sqlite));
+	  return 0;
+      }
+    ret = sqlite3_step (stmt);
+    if (ret == SQLITE_ROW)
+      {
+	  if (sqlite3_column_type (stmt, 0) == SQLITE_INTEGER
+	      && sqlite3_column_type (stmt, 1) == SQLITE_INTEGER)
+	    {
+		*hits = sqlite3_column_int (stmt, 0);
+		*misses = sqlite3_column_int (stmt, 1);
+		ok = 1;
+	    }
+      }
+    sqlite3_finalize (stmt);
+    return ok;
+}
+
+static int
+test_proj_cache (sqlite3 * sqlite)
+{
+/* testing the per-connection PROJ.4 cache used by Transform() */
+    int ret;
+    char *err_msg = NULL;
+    int hits;
+    int misses;
+    const char *transform =
+	"WITH RECURSIVE c(n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM c "
+	"WHERE n < 10) SELECT Count(Transform(MakePoint(10 + n, 43, 4326), "
+	"32632)) FROM c";
+
+    ret = sqlite3_exec (sqlite, "SELECT PROJ_ResetCache()", NULL, NULL,
+			&err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "PROJ_ResetCache() error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    ret = sqlite3_exec (sqlite, transform, NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Transform() error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    if (!proj_cache_stats (sqlite, &hits, &misses))
+	return 0;
+    if (hits != 9 || misses != 1)
+      {
+	  fprintf (stderr, "PROJ cache #1: unexpected hits=%d misses=%d\n",
+		   hits, misses);
+	  return 0;
+      }
+
+/* changing the definition must invalidate the cached pair */
+    ret =
+	sqlite3_exec (sqlite,
+		      "UPDATE spatial_ref_sys SET proj4text = proj4text || ' ' "
+		      "WHERE srid = 32632", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "UPDATE proj4text error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    ret = sqlite3_exec (sqlite, transform, NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Transform() error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    if (!proj_cache_stats (sqlite, &hits, &misses))
+	return 0;
+    if (hits != 18 || misses != 2)
+      {
+	  fprintf (stderr, "PROJ cache #2: unexpected hits=%d misses=%d\n",
+		   hits, misses);
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+exec_or_fail (sqlite3 * sqlite, const char *sql)
+{
+/* executing some SQL statement, complaining on failure */
+    char *err_msg = NULL;
+    int ret = sqlite3_exec (sqlite, sql, NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "\"%s\" error: %s\n", sql, err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+expect_proj_misses (sqlite3 * sqlite, const char *transform, int expected,
+		    const char *label)
+{
+/* running Transform() and checking the PROJ.4 cache misses */
+    int hits;
+    int misses;
+    if (!exec_or_fail (sqlite, transform))
+	return 0;
+    if (!proj_cache_stats (sqlite, &hits, &misses))
+	return 0;
+    if (misses != expected)
+      {
+	  fprintf (stderr, "PROJ cache (%s): unexpected misses=%d\n", label,
+		   misses);
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+test_proj_cache_versions (void)
+{
+/*
+/ testing that the PROJ.4 cache and the SRS catalogue notice changes
+/ made by DDL or by some other connection: none of them are counted
+/ by sqlite3_total_changes()
+*/
+    int ret;
+    int ok = 0;
+    sqlite3 *sqlite = NULL;
+    sqlite3 *other = NULL;
+    void *cache = spatialite_alloc_connection ();
+    const char *path = "check_srid_versions.sqlite";
+    const char *transform =
+	"WITH RECURSIVE c(n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM c "
+	"WHERE n < 10) SELECT Count(Transform(MakePoint(10 + n, 43, 4326), "
+	"32632)) FROM c";
+
+    unlink (path);
+    ret =
+	sqlite3_open_v2 (path, &sqlite,
+			 SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+    if (ret != SQLITE_OK)
+	goto stop;
+    spatialite_init_ex (sqlite, cache, 0);
+    ret = sqlite3_open_v2 (path, &other, SQLITE_OPEN_READWRITE, NULL);
+    if (ret != SQLITE_OK)
+	goto stop;
+    if (!exec_or_fail
+	(sqlite,
+	 "CREATE TABLE spatial_ref_sys (srid INTEGER PRIMARY KEY, "
+	 "proj4text TEXT)"))
+	goto stop;
+    if (!exec_or_fail
+	(sqlite,
+	 "INSERT INTO spatial_ref_sys VALUES "
+	 "(4326, '+proj=longlat +datum=WGS84 +no_defs'), "
+	 "(32632, '+proj=utm +zone=32 +datum=WGS84 +units=m +no_defs')"))
+	goto stop;
+    if (!exec_or_fail
+	(sqlite,
+	 "CREATE TABLE spatial_ref_sys_aux (srid INTEGER PRIMARY KEY, "
+	 "unit TEXT)"))
+	goto stop;
+    if (!exec_or_fail
+	(sqlite, "INSERT INTO spatial_ref_sys_aux VALUES (32632, 'metre')"))
+	goto stop;
+    if (!exec_or_fail (sqlite, "SELECT PROJ_ResetCache()"))
+	goto stop;
+    if (!srid_unit_is (sqlite, "metre"))
+	goto stop;
+    if (!expect_proj_misses (sqlite, transform, 1, "initial"))
+	goto stop;
+    if (!expect_proj_misses (sqlite, transform, 1, "unchanged"))
+	goto stop;
+
+/* another connection changes the definition */
+    if (!exec_or_fail
+	(other,
+	 "UPDATE spatial_ref_sys SET proj4text = proj4text || ' ' "
+	 "WHERE srid = 32632"))
+	goto stop;
+    if (!expect_proj_misses (sqlite, transform, 2, "other connection"))
+	goto stop;
+    if (!srid_unit_is (sqlite, "metre"))
+	goto stop;
+    if (!exec_or_fail
+	(other,
+	 "UPDATE spatial_ref_sys_aux SET unit = 'foot' WHERE srid = 32632"))
+	goto stop;
+    if (!srid_unit_is (sqlite, "foot"))
+	goto stop;
+
+/* spatial_ref_sys is dropped and recreated with a changed definition */
+    if (!exec_or_fail
+	(sqlite,
+	 "CREATE TABLE srs_copy AS SELECT srid, CASE WHEN srid = 32632 "
+	 "THEN proj4text || ' ' ELSE proj4text END AS proj4text "
+	 "FROM spatial_ref_sys"))
+	goto stop;
+    if (!exec_or_fail (sqlite, "DROP TABLE spatial_ref_sys"))
+	goto stop;
+    if (!exec_or_fail
+	(sqlite, "ALTER TABLE srs_copy RENAME TO spatial_ref_sys"))
+	goto stop;
+    if (!expect_proj_misses (sqlite, transform, 3, "DDL"))
+	goto stop;
+    if (!srid_unit_is (sqlite, "foot"))
+	goto stop;
+    if (!exec_or_fail
+	(sqlite,
+	 "CREATE TABLE aux_copy AS SELECT srid, 'yard' AS unit "
+	 "FROM spatial_ref_sys_aux"))
+	goto stop;
+    if (!exec_or_fail (sqlite, "DROP TABLE spatial_ref_sys_aux"))
+	goto stop;
+    if (!exec_or_fail
+	(sqlite, "ALTER TABLE aux_copy RENAME TO spatial_ref_sys_aux"))
+	goto stop;
+    if (!srid_unit_is (sqlite, "yard"))
+	goto stop;
+    if (!expect_proj_misses (sqlite, transform, 3, "unchanged again"))
+	goto stop;
+    ok = 1;
+
+  stop:
+    if (other != NULL)
+	sqlite3_close (other);
+    if (sqlite != NULL)
+	sqlite3_close (sqlite);
+    spatialite_cleanup_ex (cache);
+    unlink (path);
+    return ok;
+}
+
+static int
+approx_matches_exact (sqlite3 * sqlite, const char *wkt, int srid_to)
+{
+/* comparing TransformApprox() against the exact Transform() */
+    int ret;
+    char *sql;
+    sqlite3_stmt *stmt = NULL;
+    int ok = 0;
+
+    sql =
+	sqlite3_mprintf
+	("SELECT Srid(a) = %d AND NumPoints(a) = NumPoints(e) "
+	 "AND Abs(X(StartPoint(a)) - X(StartPoint(e))) < 0.01 "
+	 "AND Abs(Y(StartPoint(a)) - Y(StartPoint(e))) < 0.01 "
+	 "AND Abs(X(EndPoint(a)) - X(EndPoint(e))) < 0.01 "
+	 "AND Abs(Y(EndPoint(a)) - Y(EndPoint(e))) < 0.01 "
+	 "FROM (SELECT TransformApprox(GeomFromText(%Q, 4326), %d, 0.01) AS a, "
+	 "Transform(GeomFromText(%Q, 4326), %d) AS e)", srid_to, wkt,
+	 srid_to, wkt, srid_to);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "TransformApprox: \"%s\"\n",
+		   sqlite3_errmsg (sqlite));
+	  return 0;
+      }
+    ret = sqlite3_step (stmt);
+    if (ret == SQLITE_ROW && sqlite3_column_type (stmt, 0) == SQLITE_INTEGER
+	&& sqlite3_column_int (stmt, 0) == 1)
+	ok = 1;
+    else
+	fprintf (stderr, "TransformApprox mismatch: %s -> %d\n", wkt,
+		 srid_to);
+    sqlite3_finalize (stmt);
+    return ok;
+}
+
+static int
+approx_observed_error (sqlite3 * sqlite, double step, double max_error)
+{
+/* measuring the TransformApprox() error on every vertex of a dense line */
+    int ret;
+    char *sql;
+    sqlite3_stmt *stmt = NULL;
+    int ok = 0;
+
+    sql =
+	sqlite3_mprintf
+	("WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n "
+	 "WHERE i < 250), g AS (SELECT MakeLine(MakePoint(11.0 + (i * %f), "
+	 "43.0 + (((i * 37) %% 101) * %f), 4326)) AS geom FROM n), "
+	 "t AS (SELECT TransformApprox(geom, 32632, %f) AS a, "
+	 "Transform(geom, 32632) AS e FROM g) "
+	 "SELECT Max(Distance(PointN(a, i), PointN(e, i))), "
+	 "Min(NumPoints(a) = NumPoints(e)) FROM t, n", step, step / 2.0,
+	 max_error);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "TransformApprox: \"%s\"\n",
+		   sqlite3_errmsg (sqlite));
+	  return 0;
+      }
+    ret = sqlite3_step (stmt);
+    if (ret == SQLITE_ROW && sqlite3_column_type (stmt, 0) == SQLITE_FLOAT
+	&& sqlite3_column_double (stmt, 0) <= max_error
+	&& sqlite3_column_int (stmt, 1) == 1)
+	ok = 1;
+    else
+	fprintf (stderr, "TransformApprox error %1.6f exceeds %1.6f\n",
+		 sqlite3_column_double (stmt, 0), max_error);
+    sqlite3_finalize (stmt);
+    return ok;
+}
+
+static int
+test_transform_approx (sqlite3 * sqlite)
+{
+/* testing TransformApprox() and its cached tiles */
+    int i;
+
+    for (i = 0; i < 2; i++)
+      {
+	  /* the second pass is served by the already fitted tiles */
+	  if (!approx_matches_exact
+	      (sqlite, "LINESTRING(11 43, 11.01 43.005, 11.02 43.01)", 32632))
+	      return 0;
+	  /* BBOXes straddling X = 0 or Y = 0 fit no aligned tile */
+	  if (!approx_matches_exact
+	      (sqlite, "LINESTRING(-0.01 51.5, 0.01 51.51)", 3857))
+	      return 0;
+	  if (!approx_matches_exact
+	      (sqlite, "LINESTRING(10 -0.01, 10.01 0.01)", 3857))
+	      return 0;
+	  if (!approx_matches_exact
+	      (sqlite, "LINESTRING(-0.01 -0.01, 0.01 0.01)", 3857))
+	      return 0;
+      }
+/* the error observed off the sample points stays within max_error */
+    if (!approx_observed_error (sqlite, 0.0001, 0.01))
+	return 0;
+    if (!approx_observed_error (sqlite, 0.001, 0.01))
+	return 0;
+    if (!approx_observed_error (sqlite, 0.001, 1.0))
+	return 0;
+    return 1;
+}
+#endif /* end PROJ conditional */
+
 int
 main (int argc, char *argv[])
 {
@@ -362,6 +790,36 @@ main (int argc, char *argv[])
 	  return -2;
       }
 
+    ret = test_srs_catalog (db_handle);
+    if (!ret)
+      {
+	  sqlite3_close (db_handle);
+	  return -9;
+      }
+
+#ifndef OMIT_PROJ		/* only if PROJ is supported */
+    ret = test_proj_cache (db_handle);
+    if (!ret)
+      {
+	  sqlite3_close (db_handle);
+	  return -8;
+      }
+
+    ret = test_transform_approx (db_handle);
+    if (!ret)
+      {
+	  sqlite3_close (db_handle);
+	  return -10;
+      }
+
+    ret = test_proj_cache_versions ();
+    if (!ret)
+      {
+	  sqlite3_close (db_handle);
+	  return -11;
+      }
+#endif /* end PROJ conditional */
+
 /* Step #1: testing via "spatial_ref_sys_aux" */
     ret = test_srid (db_handle, 1);
     if (!ret)
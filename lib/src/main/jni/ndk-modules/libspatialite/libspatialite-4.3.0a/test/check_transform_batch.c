@@ -0,0 +1,279 @@
+/*
+
+ check_transform_batch.c -- SpatiaLite Test Case
+
+ Author: Brad Hards <bradh@frogmouth.net>
+
+ ------------------------------------------------------------------------------
+
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+
+Portions created by the Initial Developer are Copyright (C) 2015
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+Brad Hards <bradh@frogmouth.net>
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+
+*/
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "config.h"
+
+#include "sqlite3.h"
+#include "spatialite.h"
+#include "spatialite/gaiageo.h"
+
+#ifndef OMIT_PROJ		/* only if PROJ is supported */
+#include <proj_api.h>
+
+#define NUM_POINTS	300
+
+static const char *geographic = "+proj=longlat +datum=WGS84 +no_defs";
+
+struct test_projection
+{
+/* a projection supporting batch kernels */
+    const char *proj;
+    int pole;			/* TRUE if the North Pole can be projected */
+};
+
+static struct test_projection projections[] = {
+    /* merc, spherical [EPSG:3857] */
+    {"+proj=merc +a=6378137 +b=6378137 +lat_ts=0.0 +lon_0=0.0 +x_0=0.0 "
+     "+y_0=0 +k=1.0 +units=m +nadgrids=@null +wktext +no_defs", 0},
+    /* merc, ellipsoidal */
+    {"+proj=merc +lon_0=0 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+     0},
+    /* tmerc [UTM 32N] */
+    {"+proj=utm +zone=32 +datum=WGS84 +units=m +no_defs", 1},
+    /* lcc [RGF93 / Lambert-93] */
+    {"+proj=lcc +lat_1=49 +lat_2=44 +lat_0=46.5 +lon_0=3 +x_0=700000 "
+     "+y_0=6600000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs", 1},
+    {NULL, 0}
+};
+
+static unsigned int seed;
+
+static double
+next_value (double min, double max)
+{
+/* a repeatable pseudo-random value in the given range */
+    seed = seed * 1103515245 + 12345;
+    return min + (max - min) * ((double) ((seed >> 8) % 100001) / 100000.0);
+}
+
+static int
+transform_point (projPJ from, projPJ to, int from_angle, int to_angle,
+		 double *x, double *y, double *z)
+{
+/*
+/ reprojecting a single Point: a strided pj_transform() call never
+/ takes the batch kernels, so this is the generic per-point path
+*/
+    double xx[2];
+    double yy[2];
+    double zz[2];
+    xx[0] = from_angle ? *x * DEG_TO_RAD : *x;
+    yy[0] = from_angle ? *y * DEG_TO_RAD : *y;
+    zz[0] = *z;
+    if (pj_transform (from, to, 1, 2, xx, yy, zz) != 0)
+	return 0;
+    *x = to_angle ? xx[0] * RAD_TO_DEG : xx[0];
+    *y = to_angle ? yy[0] * RAD_TO_DEG : yy[0];
+    *z = zz[0];
+    return 1;
+}
+
+static int
+same_double (double a, double b)
+{
+/* bit-identical comparison */
+    return memcmp (&a, &b, sizeof (double)) == 0;
+}
+
+static int
+check_transform (const char *proj_from, const char *proj_to,
+		 const double *xs, const double *ys, double *out_x,
+		 double *out_y)
+{
+/*
+/ reprojecting a Linestring XYZM and a MultiPoint XY as a whole, then
+/ checking every vertex against the per-point path
+*/
+    int i;
+    int from_angle = strstr (proj_from, "+proj=longlat") != NULL;
+    int to_angle = strstr (proj_to, "+proj=longlat") != NULL;
+    double x;
+    double y;
+    double z;
+    double m;
+    projPJ from;
+    projPJ to;
+    gaiaLinestringPtr ln;
+    gaiaPointPtr pt;
+    gaiaGeomCollPtr line = gaiaAllocGeomCollXYZM ();
+    gaiaGeomCollPtr multi = gaiaAllocGeomColl ();
+    gaiaGeomCollPtr line_dst;
+    gaiaGeomCollPtr multi_dst;
+    int ret = 0;
+
+    ln = gaiaAddLinestringToGeomColl (line, NUM_POINTS);
+    for (i = 0; i < NUM_POINTS; i++)
+      {
+	  gaiaSetPointXYZM (ln->Coords, i, xs[i], ys[i], 0.0, (double) i);
+	  gaiaAddPointToGeomColl (multi, xs[i], ys[i]);
+      }
+    line_dst = gaiaTransform (line, (char *) proj_from, (char *) proj_to);
+    multi_dst = gaiaTransform (multi, (char *) proj_from, (char *) proj_to);
+    from = pj_init_plus (proj_from);
+    to = pj_init_plus (proj_to);
+    if (line_dst == NULL || multi_dst == NULL || from == NULL || to == NULL)
+      {
+	  fprintf (stderr, "unable to transform \"%s\"\n", proj_to);
+	  ret = -1;
+	  goto stop;
+      }
+    ln = line_dst->FirstLinestring;
+    if (ln == NULL || ln->Points != NUM_POINTS)
+      {
+	  fprintf (stderr, "\"%s\": unexpected Linestring\n", proj_to);
+	  ret = -2;
+	  goto stop;
+      }
+    pt = multi_dst->FirstPoint;
+    for (i = 0; i < NUM_POINTS; i++)
+      {
+	  double rx = xs[i];
+	  double ry = ys[i];
+	  double rz = 0.0;
+	  if (!transform_point (from, to, from_angle, to_angle, &rx, &ry, &rz))
+	    {
+		fprintf (stderr, "\"%s\": point #%d failed\n", proj_to, i);
+		ret = -3;
+		goto stop;
+	    }
+	  gaiaGetPointXYZM (ln->Coords, i, &x, &y, &z, &m);
+	  if (!same_double (x, rx) || !same_double (y, ry)
+	      || !same_double (z, rz) || m != (double) i)
+	    {
+		fprintf (stderr,
+			 "\"%s\": Linestring vertex #%d %1.17g %1.17g differs from %1.17g %1.17g\n",
+			 proj_to, i, x, y, rx, ry);
+		ret = -4;
+		goto stop;
+	    }
+	  if (pt == NULL || !same_double (pt->X, rx) || !same_double (pt->Y, ry))
+	    {
+		fprintf (stderr, "\"%s\": MultiPoint item #%d differs\n",
+			 proj_to, i);
+		ret = -5;
+		goto stop;
+	    }
+	  out_x[i] = rx;
+	  out_y[i] = ry;
+	  pt = pt->Next;
+      }
+
+  stop:
+    if (from != NULL)
+	pj_free (from);
+    if (to != NULL)
+	pj_free (to);
+    gaiaFreeGeomColl (line);
+    gaiaFreeGeomColl (multi);
+    if (line_dst != NULL)
+	gaiaFreeGeomColl (line_dst);
+    if (multi_dst != NULL)
+	gaiaFreeGeomColl (multi_dst);
+    return ret;
+}
+
+static int
+test_projection (const char *proj, int pole)
+{
+/* forward and inverse batch transforms for a single projection */
+    int i;
+    int ret;
+    double lon[NUM_POINTS];
+    double lat[NUM_POINTS];
+    double x[NUM_POINTS];
+    double y[NUM_POINTS];
+    double back_lon[NUM_POINTS];
+    double back_lat[NUM_POINTS];
+    seed = 0x5eed;
+    for (i = 0; i < NUM_POINTS; i++)
+      {
+	  /* some points around the projection center */
+	  lon[i] = next_value (-2.0, 12.0);
+	  lat[i] = next_value (40.0, 52.0);
+      }
+    lat[102] = 0.0;
+    if (pole)
+      {
+	  /* 
+	  / the batch kernels stop at the Pole, leaving it to the per-point 
+	  / path, and then resume
+	  */
+	  lat[17] = 90.0;
+      }
+    ret = check_transform (geographic, proj, lon, lat, x, y);
+    if (ret != 0)
+	return ret;
+    ret = check_transform (proj, geographic, x, y, back_lon, back_lat);
+    if (ret != 0)
+	return ret - 10;
+    return 0;
+}
+#endif /* end PROJ conditional */
+
+int
+main (int argc, char *argv[])
+{
+#ifndef OMIT_PROJ		/* only if PROJ is supported */
+    int i;
+    int ret;
+#endif
+
+    if (argc > 1 || argv[0] == NULL)
+	argc = 1;		/* silencing stupid compiler warnings */
+
+#ifndef OMIT_PROJ		/* only if PROJ is supported */
+    for (i = 0; projections[i].proj != NULL; i++)
+      {
+	  ret = test_projection (projections[i].proj, projections[i].pole);
+	  if (ret != 0)
+	      return (ret * 10) - i;
+      }
+#endif /* end PROJ conditional */
+
+    return 0;
+}
@@ -23,6 +23,8 @@
 
 #include <math.h>
 #include <string.h>
+#include <pthread.h>
+#include <unistd.h>
 
 #define PJ_LIB__
 #include "projects.h"
@@ -35,6 +37,9 @@
 #define PJ_MAX_DIMENSION 100
 /* The PJ_MAX_DIMENSION value appears also in quoted strings.
    Please perform a search-and-replace if this value is changed. */
+#define PJ_MAX_THREADS 16
+#define PJ_MIN_POINTS_PER_THREAD 16384
+#define PJ_BLOCK_POINTS 256
 
 #define GRIDINFO_FIELD_GRIDNAME "gridName"
 #define GRIDINFO_FIELD_FILENAME "fileName"
@@ -711,6 +716,59 @@ void convertAngularOrdinates(PJ *pj, double* data, jint numPts, int dimension, d
     }
 }
 
+/*!
+ * \brief
+ * Transforms in-place a sequence of (x,y,<z>,...) tuples. The batch projection kernels of
+ * Proj4 (fwd_n / inv_n) only apply to contiguous ordinates (point_offset == 1), so the
+ * tuples are copied block by block into separated x, y and z arrays before pj_transform
+ * and copied back afterward. The angular ordinates must already be in radians.
+ *
+ * \param src_pj    - The source PJ structure.
+ * \param dst_pj    - The target PJ structure.
+ * \param dimension - The dimension of each coordinate value.
+ * \param data      - The first ordinate of the first point.
+ * \param numPts    - Number of points to transform.
+ * \return The error code of the first failed block, or 0 on success.
+ */
+static int transformTuples(PJ *src_pj, PJ *dst_pj, int dimension, double *data, jint numPts) {
+    double x[PJ_BLOCK_POINTS];
+    double y[PJ_BLOCK_POINTS];
+    double z[PJ_BLOCK_POINTS];
+    double *zs = (dimension >= 3) ? z : NULL;
+    jint done = 0;
+    jint n;
+    jint i;
+    int err = 0;
+    if (numPts <= 1) {
+        return pj_transform(src_pj, dst_pj, numPts, dimension, data, data+1,
+                            (dimension >= 3) ? data+2 : NULL);
+    }
+    while (done < numPts && !err) {
+        double *p = data + (size_t) dimension * done;
+        n = numPts - done;
+        if (n > PJ_BLOCK_POINTS) {
+            n = PJ_BLOCK_POINTS;
+        }
+        if (numPts - done - n == 1) {
+            /* pj_transform reports any error of a single point call, so never leave one alone */
+            n--;
+        }
+        for (i = 0; i < n; i++) {
+            x[i] = p[i*dimension];
+            y[i] = p[i*dimension + 1];
+            if (zs) z[i] = p[i*dimension + 2];
+        }
+        err = pj_transform(src_pj, dst_pj, n, 1, x, y, zs);
+        for (i = 0; i < n; i++) {
+            p[i*dimension]     = x[i];
+            p[i*dimension + 1] = y[i];
+            if (zs) p[i*dimension + 2] = z[i];
+        }
+        done += n;
+    }
+    return err;
+}
+
 /*!
  * \brief
  * Transforms in-place the coordinates in the given array.
@@ -752,10 +810,8 @@ JNIEXPORT void JNICALL Java_org_proj4_PJ_transform
         double *data = (*env)->GetPrimitiveArrayCritical(env, coordinates, NULL);
         if (data) {
             double *x = data + offset;
-            double *y = x + 1;
-            double *z = (dimension >= 3) ? y+1 : NULL;
             convertAngularOrdinates(src_pj, x, numPts, dimension, M_PI/180);
-            int err = pj_transform(src_pj, dst_pj, numPts, dimension, x, y, z);
+            int err = transformTuples(src_pj, dst_pj, dimension, x, numPts);
             convertAngularOrdinates(dst_pj, x, numPts, dimension, 180/M_PI);
             (*env)->ReleasePrimitiveArrayCritical(env, coordinates, data, 0);
             if (err) {
@@ -766,6 +822,234 @@ JNIEXPORT void JNICALL Java_org_proj4_PJ_transform
     }
 }
 
+/*!
+ * \brief
+ * A slice of a batch transform, run either by the calling thread or by a worker thread.
+ * Each worker owns its context and its own copies of the source and target PJ structures,
+ * since a PJ records its errors in its context and can not be shared between threads.
+ */
+typedef struct {
+    PJ     *src_pj;
+    PJ     *dst_pj;
+    projCtx ctx;
+    double *x;
+    int     dimension;
+    jint    numPts;
+    int     err;
+} TransformSlice;
+
+/*!
+ * \brief
+ * Transforms in-place one slice of coordinates. Used as the worker thread entry point.
+ *
+ * \param arg - The TransformSlice to process.
+ * \return Always NULL; the result is stored in the "err" field of the slice.
+ */
+static void *transformSlice(void *arg) {
+    TransformSlice *slice = (TransformSlice*) arg;
+    double *x = slice->x;
+    convertAngularOrdinates(slice->src_pj, x, slice->numPts, slice->dimension, M_PI/180);
+    slice->err = transformTuples(slice->src_pj, slice->dst_pj, slice->dimension, x, slice->numPts);
+    convertAngularOrdinates(slice->dst_pj, x, slice->numPts, slice->dimension, 180/M_PI);
+    return NULL;
+}
+
+/*!
+ * \brief
+ * Loads the shift values of a grid and all its sub-grids.
+ *
+ * \param ctx - The context to report errors to.
+ * \param gi  - The grid to load.
+ */
+static void preloadGrid(projCtx ctx, PJ_GRIDINFO *gi) {
+    PJ_GRIDINFO *child;
+    if (gi->ct && gi->ct->cvs == NULL) {
+        pj_gridinfo_load(ctx, gi);
+    }
+    for (child = gi->child; child; child = child->next) {
+        preloadGrid(ctx, child);
+    }
+}
+
+/*!
+ * \brief
+ * Loads every grid used by the given PJ structure. Grid loading is lazy and not locked
+ * in Proj4, so this must be done by the calling thread before any worker starts: the
+ * workers then only read grids that are already in memory.
+ *
+ * \param pj - The PJ structure whose grids are to be loaded.
+ */
+static void preloadGrids(PJ *pj) {
+    int i;
+    for (i = 0; i < pj->gridlist_count; i++) {
+        preloadGrid(pj->ctx, pj->gridlist[i]);
+    }
+    for (i = 0; i < pj->vgridlist_geoid_count; i++) {
+        preloadGrid(pj->ctx, pj->vgridlist_geoid[i]);
+    }
+}
+
+/*!
+ * \brief
+ * Allocates a copy of the given PJ structure bound to the given context, by parsing again
+ * its expanded definition string.
+ *
+ * \param ctx - The context of the new PJ structure.
+ * \param pj  - The PJ structure to copy.
+ * \return The new PJ structure, or NULL in case of failure.
+ */
+static PJ *clonePJ(projCtx ctx, PJ *pj) {
+    PJ *copy = NULL;
+    char *def = pj_get_def(pj, 0);
+    if (def) {
+        copy = pj_init_plus_ctx(ctx, def);
+        pj_dalloc(def);
+    }
+    return copy;
+}
+
+/*!
+ * \brief
+ * Transforms in-place numPts coordinates, splitting the work between up to numThreads
+ * threads. The calling thread processes the first slice itself. Falls back to a single
+ * slice if the array is small or if the per-thread structures can not be allocated.
+ *
+ * \param src_pj     - The source CRS.
+ * \param dst_pj     - The target CRS.
+ * \param dimension  - The dimension of each coordinate value.
+ * \param x          - The first ordinate of the first point to transform.
+ * \param numPts     - Number of points to transform.
+ * \param numThreads - Maximal number of threads, or 0 for the number of online processors.
+ * \return 0 on success, or the Proj4 error code of the first slice which failed.
+ */
+static int transformThreaded(PJ *src_pj, PJ *dst_pj, int dimension, double *x, jint numPts, int numThreads) {
+    TransformSlice slices[PJ_MAX_THREADS];
+    pthread_t threads[PJ_MAX_THREADS];
+    int started[PJ_MAX_THREADS];
+    int count, i, err;
+    jint start, step;
+
+    if (numThreads <= 0) {
+        numThreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (numThreads > PJ_MAX_THREADS) {
+        numThreads = PJ_MAX_THREADS;
+    }
+    count = numPts / PJ_MIN_POINTS_PER_THREAD;
+    if (count > numThreads) {
+        count = numThreads;
+    }
+    if (count < 1) {
+        count = 1;      /* Small batch, or no processor count: the calling thread does it all. */
+    }
+    if (count > 1) {
+        /* Build the grid lists with a throw-away copy of the first point, then load the
+           grids, so the workers neither allocate nor load anything shared. */
+        double pt[3] = {x[0], x[1], (dimension >= 3) ? x[2] : 0};
+        convertAngularOrdinates(src_pj, pt, 1, 3, M_PI/180);
+        pj_transform(src_pj, dst_pj, 1, 1, pt, pt+1, pt+2);
+        preloadGrids(src_pj);
+        preloadGrids(dst_pj);
+    }
+    memset(slices, 0, sizeof(slices));
+    memset(started, 0, sizeof(started));
+    for (i = 1; i < count; i++) {
+        slices[i].ctx = pj_ctx_alloc();
+        if (slices[i].ctx) {
+            slices[i].src_pj = clonePJ(slices[i].ctx, src_pj);
+            slices[i].dst_pj = clonePJ(slices[i].ctx, dst_pj);
+        }
+        if (!slices[i].src_pj || !slices[i].dst_pj) {
+            count = 1;
+        }
+    }
+    step = (count > 1) ? (numPts + count - 1) / count : numPts;
+    start = 0;
+    for (i = 0; i < count; i++) {
+        slices[i].x = x + (size_t) dimension * start;
+        slices[i].dimension = dimension;
+        slices[i].numPts = (numPts - start < step) ? numPts - start : step;
+        start += slices[i].numPts;
+    }
+    slices[0].src_pj = src_pj;
+    slices[0].dst_pj = dst_pj;
+    for (i = 1; i < count; i++) {
+        started[i] = (pthread_create(&threads[i], NULL, transformSlice, &slices[i]) == 0);
+    }
+    transformSlice(&slices[0]);
+    /* A thread which could not be started has its slice done here instead. */
+    for (i = 1; i < count; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        } else {
+            transformSlice(&slices[i]);
+        }
+    }
+    err = 0;
+    for (i = 0; i < PJ_MAX_THREADS; i++) {
+        if (!err && i < count) {
+            err = slices[i].err;
+        }
+        if (i > 0) {
+            if (slices[i].src_pj) pj_free(slices[i].src_pj);
+            if (slices[i].dst_pj) pj_free(slices[i].dst_pj);
+            if (slices[i].ctx) pj_ctx_free(slices[i].ctx);
+        }
+    }
+    return err;
+}
+
+/*!
+ * \brief
+ * Transforms in-place the coordinates in the given direct buffer. Unlike the array variant,
+ * no JVM critical section is entered: the buffer memory does not move, so the garbage
+ * collector is never blocked and the work can be split between native threads.
+ *
+ * \param env         - The JNI environment.
+ * \param object      - The Java object wrapping the PJ structure (not allowed to be NULL).
+ * \param target      - The target CRS.
+ * \param dimension   - The dimension of each coordinate value. Must be equals or greater than 2.
+ * \param coordinates - A direct buffer of native-order doubles, as a sequence of (x,y,<z>,...) tuples.
+ * \param capacity    - The buffer capacity, in number of doubles.
+ * \param offset      - Offset (in number of doubles) of the first coordinate in the given buffer.
+ * \param numPts      - Number of points to transform.
+ * \param numThreads  - Maximal number of threads, or 0 for the number of online processors.
+ */
+JNIEXPORT void JNICALL Java_org_proj4_PJ_transformDirect
+  (JNIEnv *env, jobject object, jobject target, jint dimension, jobject coordinates, jint capacity, jint offset, jint numPts, jint numThreads)
+{
+    if (!target || !coordinates) {
+        jclass c = (*env)->FindClass(env, "java/lang/NullPointerException");
+        if (c) (*env)->ThrowNew(env, c, "The target CRS and the coordinates buffer can not be null.");
+        return;
+    }
+    if (dimension < 2 || dimension > PJ_MAX_DIMENSION) { /* Arbitrary upper value for catching potential misuse. */
+        jclass c = (*env)->FindClass(env, "java/lang/IllegalArgumentException");
+        if (c) (*env)->ThrowNew(env, c, "Illegal dimension. Must be in the [2-100] range.");
+        return;
+    }
+    if ((offset < 0) || (numPts < 0) || ((jlong) offset + (jlong) dimension*numPts) > capacity) {
+        jclass c = (*env)->FindClass(env, "java/lang/IndexOutOfBoundsException");
+        if (c) (*env)->ThrowNew(env, c, "Illegal offset or illegal number of points.");
+        return;
+    }
+    double *data = (*env)->GetDirectBufferAddress(env, coordinates);
+    if (!data || ((size_t) data % sizeof(double)) != 0) {
+        jclass c = (*env)->FindClass(env, "java/lang/IllegalArgumentException");
+        if (c) (*env)->ThrowNew(env, c, "The coordinates buffer must be a direct buffer aligned on doubles.");
+        return;
+    }
+    PJ *src_pj = getPJ(env, object);
+    PJ *dst_pj = getPJ(env, target);
+    if (src_pj && dst_pj && numPts > 0) {
+        int err = transformThreaded(src_pj, dst_pj, dimension, data + offset, numPts, numThreads);
+        if (err) {
+            jclass c = (*env)->FindClass(env, "org/proj4/PJException");
+            if (c) (*env)->ThrowNew(env, c, pj_strerrno(err));
+        }
+    }
+}
+
 /*!
  * \brief
  * Returns a description of the last error that occurred, or NULL if none.
@@ -157,6 +157,7 @@ LOCAL_SRC_FILES := \
 	 $(PROJ4_PATH)/proj/src/pj_utils.c \
 	 $(PROJ4_PATH)/proj/src/pj_gridinfo.c \
 	 $(PROJ4_PATH)/proj/src/pj_gridlist.c \
+	 $(PROJ4_PATH)/proj/src/pj_gridmap.c \
 	 $(PROJ4_PATH)/proj/src/jniproj.c \
 	 $(PROJ4_PATH)/proj/src/pj_mutex.c \
 	 $(PROJ4_PATH)/proj/src/pj_initcache.c \
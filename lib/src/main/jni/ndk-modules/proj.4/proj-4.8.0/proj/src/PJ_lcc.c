@@ -59,6 +59,52 @@ SPECIAL(fac) {
 		pj_msfn(sin(lp.phi), cos(lp.phi), P->es);
 	fac->conv = - P->n * lp.lam;
 }
+/* batch kernels for pj_transform(), see pj_fwd_n_begin() */
+	static long
+e_forward_n(PJ *P, long n, double *x, double *y) { /* ellipsoid & spheroid */
+	long i, m = pj_fwd_n_begin(P, n, x, y, EPS10, HUGE_VAL);
+	double k0 = P->k0, c = P->c, nn = P->n, rho0 = P->rho0, e = P->e;
+	double hfe = .5 * P->e;
+
+	for (i = 0; i < m; ++i) {
+		double rho, lam, esinphi;
+
+		if (P->ellips) { /* pj_tsfn() */
+			esinphi = e * sin(y[i]);
+			rho = c * pow(tan(.5 * (HALFPI - y[i])) /
+				pow((1. - esinphi) / (1. + esinphi), hfe), nn);
+		} else
+			rho = c * pow(tan(FORTPI + .5 * y[i]), -nn);
+		lam = x[i] * nn;
+		x[i] = k0 * (rho * sin(lam));
+		y[i] = k0 * (rho0 - rho * cos(lam));
+	}
+	pj_fwd_n_end(P, m, x, y);
+	return m;
+}
+	static long
+e_inverse_n(PJ *P, long n, double *x, double *y) { /* ellipsoid & spheroid */
+	long i;
+
+	P->ctx->last_errno = 0;
+	for (i = 0; i < n; ++i) {
+		XY xy;
+		LP lp;
+
+		if (x[i] == HUGE_VAL || y[i] == HUGE_VAL)
+			break;
+		xy.x = (x[i] * P->to_meter - P->x0) * P->ra;
+		xy.y = (y[i] * P->to_meter - P->y0) * P->ra;
+		lp = e_inverse(xy, P);
+		if (P->ctx->last_errno)
+			break;
+		x[i] = lp.lam;
+		y[i] = lp.phi;
+	}
+	P->ctx->last_errno = 0;
+	pj_inv_n_end(P, i, x, y);
+	return i;
+}
 FREEUP; if (P) pj_dalloc(P); }
 ENTRY0(lcc)
 	double cosphi, sinphi;
@@ -101,5 +147,7 @@ ENTRY0(lcc)
 	}
 	P->inv = e_inverse;
 	P->fwd = e_forward;
+	P->inv_n = e_inverse_n;
+	P->fwd_n = e_forward_n;
 	P->spc = fac;
 ENDENTRY(P)
@@ -24,6 +24,72 @@ INVERSE(s_inverse); /* spheroid */
 	lp.lam = xy.x / P->k0;
 	return (lp);
 }
+/* batch kernels for pj_transform(), see pj_fwd_n_begin() */
+	static long
+e_forward_n(PJ *P, long n, double *x, double *y) { /* ellipsoid */
+	long i, m = pj_fwd_n_begin(P, n, x, y, EPS10, HUGE_VAL);
+	double k0 = P->k0, e = P->e, hfe = .5 * P->e;
+
+	for (i = 0; i < m; ++i) {
+		double esinphi = e * sin(y[i]);
+
+		x[i] = k0 * x[i];
+		y[i] = - k0 * log(tan(.5 * (HALFPI - y[i])) /
+			pow((1. - esinphi) / (1. + esinphi), hfe));
+	}
+	pj_fwd_n_end(P, m, x, y);
+	return m;
+}
+	static long
+s_forward_n(PJ *P, long n, double *x, double *y) { /* spheroid */
+	long i, m = pj_fwd_n_begin(P, n, x, y, EPS10, HUGE_VAL);
+	double k0 = P->k0;
+
+	for (i = 0; i < m; ++i) {
+		x[i] = k0 * x[i];
+		y[i] = k0 * log(tan(FORTPI + .5 * y[i]));
+	}
+	pj_fwd_n_end(P, m, x, y);
+	return m;
+}
+	static long
+e_inverse_n(PJ *P, long n, double *x, double *y) { /* ellipsoid */
+	long i;
+	double k0 = P->k0, phi;
+
+	P->ctx->last_errno = 0;
+	for (i = 0; i < n; ++i) {
+		if (x[i] == HUGE_VAL || y[i] == HUGE_VAL)
+			break;
+		phi = pj_phi2(P->ctx, exp(- (y[i] * P->to_meter - P->y0) * P->ra
+			/ k0), P->e);
+		if (P->ctx->last_errno)
+			break;
+		x[i] = (x[i] * P->to_meter - P->x0) * P->ra / k0;
+		y[i] = phi;
+	}
+	P->ctx->last_errno = 0;
+	pj_inv_n_end(P, i, x, y);
+	return i;
+}
+	static long
+s_inverse_n(PJ *P, long n, double *x, double *y) { /* spheroid */
+	long i;
+	double k0 = P->k0, ra = P->ra, to_meter = P->to_meter;
+	double x0 = P->x0, y0 = P->y0;
+
+	for (i = 0; i < n; ++i) {
+		if (x[i] == HUGE_VAL || y[i] == HUGE_VAL)
+			break;
+	}
+	n = i;
+	for (i = 0; i < n; ++i) {
+		y[i] = HALFPI - 2. * atan(exp(-((y[i] * to_meter - y0) * ra) / k0));
+		x[i] = ((x[i] * to_meter - x0) * ra) / k0;
+	}
+	pj_inv_n_end(P, n, x, y);
+	return n;
+}
 FREEUP; if (P) pj_dalloc(P); }
 ENTRY0(merc)
 	double phits=0.0;
@@ -38,10 +104,14 @@ ENTRY0(merc)
 			P->k0 = pj_msfn(sin(phits), cos(phits), P->es);
 		P->inv = e_inverse;
 		P->fwd = e_forward;
+		P->inv_n = e_inverse_n;
+		P->fwd_n = e_forward_n;
 	} else { /* sphere */
 		if (is_phits)
 			P->k0 = cos(phits);
 		P->inv = s_inverse;
 		P->fwd = s_forward;
+		P->inv_n = s_inverse_n;
+		P->fwd_n = s_forward_n;
 	}
 ENDENTRY(P)
@@ -127,6 +127,67 @@ INVERSE(s_inverse); /* sphere */
 	lp.lam = (g || h) ? atan2(g, h) : 0.;
 	return (lp);
 }
+/* batch kernels for pj_transform(), see pj_fwd_n_begin() */
+	static long
+e_forward_n(PJ *P, long n, double *x, double *y) { /* ellipse */
+	long i, m = pj_fwd_n_begin(P, n, x, y, 0., HALFPI);
+	double k0 = P->k0, es = P->es, esp = P->esp, ml0 = P->ml0;
+	double en0 = P->en[0], en1 = P->en[1], en2 = P->en[2];
+	double en3 = P->en[3], en4 = P->en[4];
+
+	for (i = 0; i < m; ++i) {
+		double al, als, n, cosphi, sinphi, t, ml, s2;
+		double lam = x[i], phi = y[i];
+
+		sinphi = sin(phi); cosphi = cos(phi);
+		t = fabs(cosphi) > 1e-10 ? sinphi/cosphi : 0.;
+		t *= t;
+		al = cosphi * lam;
+		als = al * al;
+		al /= sqrt(1. - es * sinphi * sinphi);
+		n = esp * cosphi * cosphi;
+		/* pj_mlfn() */
+		s2 = sinphi * sinphi;
+		ml = en0 * phi - cosphi * sinphi * (en1 + s2*(en2
+			+ s2*(en3 + s2*en4)));
+		x[i] = k0 * al * (FC1 +
+			FC3 * als * (1. - t + n +
+			FC5 * als * (5. + t * (t - 18.) + n * (14. - 58. * t)
+			+ FC7 * als * (61. + t * ( t * (179. - t) - 479. ) )
+			)));
+		y[i] = k0 * (ml - ml0 +
+			sinphi * al * lam * FC2 * ( 1. +
+			FC4 * als * (5. - t + n * (9. + 4. * n) +
+			FC6 * als * (61. + t * (t - 58.) + n * (270. - 330 * t)
+			+ FC8 * als * (1385. + t * ( t * (543. - t) - 3111.) )
+			))));
+	}
+	pj_fwd_n_end(P, m, x, y);
+	return m;
+}
+	static long
+e_inverse_n(PJ *P, long n, double *x, double *y) { /* ellipsoid */
+	long i;
+
+	P->ctx->last_errno = 0;
+	for (i = 0; i < n; ++i) {
+		XY xy;
+		LP lp;
+
+		if (x[i] == HUGE_VAL || y[i] == HUGE_VAL)
+			break;
+		xy.x = (x[i] * P->to_meter - P->x0) * P->ra;
+		xy.y = (y[i] * P->to_meter - P->y0) * P->ra;
+		lp = e_inverse(xy, P);
+		if (P->ctx->last_errno)
+			break;
+		x[i] = lp.lam;
+		y[i] = lp.phi;
+	}
+	P->ctx->last_errno = 0;
+	pj_inv_n_end(P, i, x, y);
+	return i;
+}
 FREEUP;
 	if (P) {
 		if (P->en)
@@ -143,6 +204,8 @@ setup(PJ *P) { /* general initialization */
 		P->esp = P->es / (1. - P->es);
 		P->inv = e_inverse;
 		P->fwd = e_forward;
+		P->inv_n = e_inverse_n;
+		P->fwd_n = e_forward_n;
 	} else {
 		aks0 = P->k0;
 		aks5 = .5 * aks0;
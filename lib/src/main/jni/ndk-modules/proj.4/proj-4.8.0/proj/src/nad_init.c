@@ -87,10 +87,17 @@ int nad_ctable_load( projCtx ctx, struct CTABLE *ct, FILE *fid )
 {
     int  a_size;
 
+    a_size = ct->lim.lam * ct->lim.phi;
+
+    /* the shift values are stored in native layout: map them if we can */
+    ct->cvs = (FLP *) pj_gridmap( ctx, fid, sizeof(struct CTABLE),
+                                  sizeof(FLP) * a_size );
+    if( ct->cvs != NULL )
+        return 1;
+
     fseek( fid, sizeof(struct CTABLE), SEEK_SET );
 
     /* read all the actual shift values */
-    a_size = ct->lim.lam * ct->lim.phi;
     ct->cvs = (FLP *) pj_malloc(sizeof(FLP) * a_size);
     if( ct->cvs == NULL 
         || fread(ct->cvs, sizeof(FLP), a_size, fid) != a_size )
@@ -160,10 +167,19 @@ int nad_ctable2_load( projCtx ctx, struct CTABLE *ct, FILE *fid )
 {
     int  a_size;
 
+    a_size = ct->lim.lam * ct->lim.phi;
+
+    /* little endian shift values match the native layout on LSB hosts */
+    if( IS_LSB )
+    {
+        ct->cvs = (FLP *) pj_gridmap( ctx, fid, 160, sizeof(FLP) * a_size );
+        if( ct->cvs != NULL )
+            return 1;
+    }
+
     fseek( fid, 160, SEEK_SET );
 
     /* read all the actual shift values */
-    a_size = ct->lim.lam * ct->lim.phi;
     ct->cvs = (FLP *) pj_malloc(sizeof(FLP) * a_size);
     if( ct->cvs == NULL 
         || fread(ct->cvs, sizeof(FLP), a_size, fid) != a_size )
@@ -298,12 +314,13 @@ struct CTABLE *nad_init(projCtx ctx, char *name)
 /*                              nad_free()                              */
 /*                                                                      */
 /*      Free a CTABLE grid shift structure produced by nad_init().      */
+/*      The shift values may be a mapping rather than a heap block.     */
 /************************************************************************/
 
 void nad_free(struct CTABLE *ct) 
 {
     if (ct) {
-        if( ct->cvs != NULL )
+        if( ct->cvs != NULL && !pj_gridmap_release(ct->cvs) )
             pj_dalloc(ct->cvs);
 
         pj_dalloc(ct);
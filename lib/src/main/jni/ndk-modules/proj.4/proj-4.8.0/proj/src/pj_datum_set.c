@@ -90,6 +90,10 @@ int pj_datum_set(projCtx ctx, paralist *pl, PJ *projdef)
            to exist int he param list for use in pj_apply_gridshift.c */
 
         projdef->datum_type = PJD_GRIDSHIFT;
+
+        /* the @null grid shifts nothing, remember that so datum
+           transforms against WGS84 can be skipped altogether */
+        projdef->datum_null_grid = (strcmp( nadgrids, "@null" ) == 0);
     }
 
 /* -------------------------------------------------------------------- */
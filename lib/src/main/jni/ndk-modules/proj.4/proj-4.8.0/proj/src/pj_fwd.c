@@ -35,3 +35,47 @@ pj_fwd(LP lp, PJ *P) {
 	}
 	return xy;
 }
+/*
+** Helpers for the optional batch forward kernels (P->fwd_n) used by
+** pj_transform() on contiguous coordinate arrays.  A kernel takes the
+** leading run of points it can handle exactly like pj_fwd() would, and
+** returns how many it did; the point it stopped at goes through pj_fwd().
+*/
+	long /* prepare the leading run of points for a batch kernel */
+pj_fwd_n_begin(PJ *P, long n, double *x, double *y, double phi_eps,
+	double max_dlam) {
+	long i;
+	double lam;
+
+	if (P->geoc)
+		return 0;
+	/* stay clear of the poles, so no snapping to +/- HALFPI is needed */
+	if (phi_eps < EPS)
+		phi_eps = EPS;
+	for (i = 0; i < n; ++i) {
+		if (!(fabs(y[i]) < HALFPI - phi_eps) || !(fabs(x[i]) <= 10.))
+			break;
+		lam = x[i] - P->lam0;
+		if (!P->over)
+			lam = adjlon(lam);
+		if (fabs(lam) > max_dlam)
+			break;
+		x[i] = lam;
+	}
+	return i;
+}
+	void /* apply major axis, easting/northing and units to a batch */
+pj_fwd_n_end(PJ *P, long m, double *x, double *y) {
+	long i;
+	double a = P->a, x0 = P->x0, y0 = P->y0, fr_meter = P->fr_meter;
+
+	for (i = 0; i < m; ++i) {
+		x[i] = fr_meter * (a * x[i] + x0);
+		y[i] = fr_meter * (a * y[i] + y0);
+	}
+	if (m > 0) {
+		P->ctx->last_errno = 0;
+		pj_errno = 0;
+		errno = 0;
+	}
+}
@@ -173,6 +173,8 @@ int pj_gridinfo_load( projCtx ctx, PJ_GRIDINFO *gi )
 /*      direction (e-w) is different in the NTv1 file and what          */
 /*      the CTABLE is supposed to have.  The phi/lam are also           */
 /*      reversed, and we have to be aware of byte swapping.             */
+/*      The converted grid is kept in the grid cache when configured,   */
+/*      and mapped from there on later loads (see pj_gridmap.c).        */
 /* -------------------------------------------------------------------- */
     else if( strcmp(gi->format,"ntv1") == 0 )
     {
@@ -188,6 +190,13 @@ int pj_gridinfo_load( projCtx ctx, PJ_GRIDINFO *gi )
             return 0;
         }
 
+        if( pj_gridmap_load_cache( ctx, gi, fid, gi->ct->lim.lam
+                                   * gi->ct->lim.phi * sizeof(FLP) ) )
+        {
+            fclose( fid );
+            return 1;
+        }
+
         fseek( fid, gi->grid_offset, SEEK_SET );
 
         row_buf = (double *) pj_malloc(gi->ct->lim.lam * sizeof(double) * 2);
@@ -231,6 +240,9 @@ int pj_gridinfo_load( projCtx ctx, PJ_GRIDINFO *gi )
 
         pj_dalloc( row_buf );
 
+        pj_gridmap_store_cache( ctx, gi, fid, gi->ct->lim.lam
+                                * gi->ct->lim.phi * sizeof(FLP) );
+
         fclose( fid );
 
         return 1;
@@ -242,6 +254,8 @@ int pj_gridinfo_load( projCtx ctx, PJ_GRIDINFO *gi )
 /*      direction (e-w) is different in the NTv2 file and what          */
 /*      the CTABLE is supposed to have.  The phi/lam are also           */
 /*      reversed, and we have to be aware of byte swapping.             */
+/*      The converted grid is kept in the grid cache when configured,   */
+/*      and mapped from there on later loads (see pj_gridmap.c).        */
 /* -------------------------------------------------------------------- */
     else if( strcmp(gi->format,"ntv2") == 0 )
     {
@@ -260,6 +274,13 @@ int pj_gridinfo_load( projCtx ctx, PJ_GRIDINFO *gi )
             return 0;
         }
 
+        if( pj_gridmap_load_cache( ctx, gi, fid, gi->ct->lim.lam
+                                   * gi->ct->lim.phi * sizeof(FLP) ) )
+        {
+            fclose( fid );
+            return 1;
+        }
+
         fseek( fid, gi->grid_offset, SEEK_SET );
 
         row_buf = (float *) pj_malloc(gi->ct->lim.lam * sizeof(float) * 4);
@@ -306,6 +327,9 @@ int pj_gridinfo_load( projCtx ctx, PJ_GRIDINFO *gi )
 
         pj_dalloc( row_buf );
 
+        pj_gridmap_store_cache( ctx, gi, fid, gi->ct->lim.lam
+                                * gi->ct->lim.phi * sizeof(FLP) );
+
         fclose( fid );
 
         return 1;
@@ -327,6 +351,12 @@ int pj_gridinfo_load( projCtx ctx, PJ_GRIDINFO *gi )
             return 0;
         }
 
+        if( pj_gridmap_load_cache( ctx, gi, fid, words*sizeof(float) ) )
+        {
+            fclose( fid );
+            return 1;
+        }
+
         fseek( fid, gi->grid_offset, SEEK_SET );
 
         gi->ct->cvs = (FLP *) pj_malloc(words*sizeof(float));
@@ -346,6 +376,8 @@ int pj_gridinfo_load( projCtx ctx, PJ_GRIDINFO *gi )
         if( IS_LSB )
             swap_words( (unsigned char *) gi->ct->cvs, 4, words );
 
+        pj_gridmap_store_cache( ctx, gi, fid, words*sizeof(float) );
+
         fclose( fid );
         return 1;
     }
@@ -0,0 +1,448 @@
+/******************************************************************************
+ * $Id$
+ *
+ * Project:  PROJ.4
+ * Purpose:  Memory mapped access to datum shift grids.  Grids whose on-disk
+ *           layout matches the in-memory CTABLE layout are mapped directly,
+ *           other formats are converted once into a cache file which is
+ *           then mapped.  See pj_gridinfo.c and nad_init.c for the loaders.
+ *
+ ******************************************************************************
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *****************************************************************************/
+
+#define PJ_LIB__
+
+#include <projects.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#if !defined(_WIN32) && !defined(_WIN32_WCE)
+#  define PJ_GRIDMAP_ENABLED
+#  include <unistd.h>
+#  include <sys/types.h>
+#  include <sys/stat.h>
+#  include <sys/mman.h>
+#  include <assert.h>
+#endif
+
+static char *grid_cache_dir = NULL;
+
+/************************************************************************/
+/*                          pj_set_gridcache()                          */
+/*                                                                      */
+/*      Set the directory used to keep converted (mappable) copies      */
+/*      of NTv1, NTv2 and GTX grids.  Call with NULL to fall back to    */
+/*      the PROJ_GRID_CACHE environment variable.  Without either,      */
+/*      those formats are loaded on the heap as before.                 */
+/*                                                                      */
+/*      The directory is shared by all contexts, so it is only read     */
+/*      and replaced while holding the PROJ lock.                       */
+/************************************************************************/
+
+void pj_set_gridcache( const char *path )
+
+{
+    char *dir = NULL;
+
+    if( path != NULL )
+    {
+        dir = pj_malloc( strlen(path) + 1 );
+        if( dir != NULL )
+            strcpy( dir, path );
+    }
+
+    pj_acquire_lock();
+    if( grid_cache_dir != NULL )
+        pj_dalloc( grid_cache_dir );
+    grid_cache_dir = dir;
+    pj_release_lock();
+}
+
+#ifdef PJ_GRIDMAP_ENABLED
+
+/* -------------------------------------------------------------------- */
+/*      Live mappings, so nad_free() can tell a mapping from a heap     */
+/*      block.                                                          */
+/* -------------------------------------------------------------------- */
+typedef struct _pj_gridmap {
+    void   *data;    /* pointer handed out as ct->cvs */
+    void   *base;    /* page aligned start of the mapping */
+    size_t  length;  /* length of the mapping */
+    struct _pj_gridmap *next;
+} PJ_GRIDMAP;
+
+static PJ_GRIDMAP *map_list = NULL;
+
+/* -------------------------------------------------------------------- */
+/*      Cache file header.  The cache is a private, per-machine file    */
+/*      so native types and byte order are fine here.                   */
+/* -------------------------------------------------------------------- */
+#define GRIDMAP_MAGIC       "PJ_GRIDMAP_1"
+#define GRIDMAP_DATA_OFFSET 64
+
+typedef struct {
+    char    magic[16];
+    off_t   src_size;     /* size of the source grid file */
+    time_t  src_mtime;    /* modification time of the source grid file */
+    int     grid_offset;  /* offset of the (sub)grid in the source file */
+    int     lim_lam;
+    int     lim_phi;
+    size_t  data_size;    /* bytes of converted grid data that follow */
+} PJ_GRIDMAP_HEADER;
+
+/************************************************************************/
+/*                          gridmap_disabled()                          */
+/*                                                                      */
+/*      PROJ_GRID_MMAP=OFF restores the plain heap loading.             */
+/************************************************************************/
+
+static int gridmap_disabled()
+
+{
+    const char *value = getenv( "PROJ_GRID_MMAP" );
+
+    if( value == NULL )
+        return 0;
+
+    return strcmp(value,"OFF") == 0 || strcmp(value,"NO") == 0
+        || strcmp(value,"0") == 0;
+}
+
+/************************************************************************/
+/*                           gridmap_region()                           */
+/*                                                                      */
+/*      Map size bytes at offset of the open file, and register the     */
+/*      mapping.  Returns NULL if the file is too short or the          */
+/*      mapping fails, in which case callers load on the heap.          */
+/************************************************************************/
+
+static void *gridmap_region( int fd, long offset, size_t size )
+
+{
+    struct stat  st;
+    long         page_size, delta;
+    void        *base;
+    PJ_GRIDMAP  *map;
+
+    if( size == 0 || fstat( fd, &st ) != 0
+        || (off_t) (offset + size) > st.st_size )
+        return NULL;
+
+    page_size = sysconf( _SC_PAGESIZE );
+    if( page_size <= 0 )
+        page_size = 4096;
+    delta = offset % page_size;
+
+    base = mmap( NULL, size + delta, PROT_READ, MAP_PRIVATE, fd,
+                 offset - delta );
+    if( base == MAP_FAILED )
+        return NULL;
+
+    map = (PJ_GRIDMAP *) pj_malloc(sizeof(PJ_GRIDMAP));
+    if( map == NULL )
+    {
+        munmap( base, size + delta );
+        return NULL;
+    }
+
+    map->base = base;
+    map->length = size + delta;
+    map->data = ((char *) base) + delta;
+
+    pj_acquire_lock();
+    map->next = map_list;
+    map_list = map;
+    pj_release_lock();
+
+    return map->data;
+}
+
+/************************************************************************/
+/*                         gridmap_cachename()                          */
+/*                                                                      */
+/*      Build the cache file name for a (sub)grid, or return 0 if no    */
+/*      cache directory is configured.                                  */
+/************************************************************************/
+
+static int gridmap_cachename( PJ_GRIDINFO *gi, char *fname, int fname_size )
+
+{
+    const char *dir;
+    const char *name;
+    char *p;
+    int dir_len;
+
+    if( gi->filename == NULL )
+        return 0;
+
+    /* only keep the last path component of the grid name */
+    name = strrchr( gi->filename, '/' );
+    name = (name != NULL) ? name + 1 : gi->filename;
+
+    /* pj_set_gridcache() may replace the directory at any time */
+    pj_acquire_lock();
+    dir = grid_cache_dir;
+    if( dir == NULL )
+        dir = getenv( "PROJ_GRID_CACHE" );
+    if( dir == NULL || *dir == '\0'
+        || strlen(dir) + strlen(name) + 32 > (size_t) fname_size )
+    {
+        pj_release_lock();
+        return 0;
+    }
+    dir_len = strlen(dir);
+    sprintf( fname, "%s%c%s.%d.pjgm", dir, DIR_CHAR, name, gi->grid_offset );
+    pj_release_lock();
+
+    /* the grid name may still carry characters unfit for a file name */
+    for( p = fname + dir_len + 1; *p != '\0'; p++ )
+    {
+        if( *p == '\\' || *p == ':' )
+            *p = '_';
+    }
+
+    return 1;
+}
+
+/************************************************************************/
+/*                            pj_gridmap()                              */
+/*                                                                      */
+/*      Map size bytes of grid data located at offset in an open        */
+/*      grid file whose layout already matches the in-memory layout.    */
+/************************************************************************/
+
+void *pj_gridmap( projCtx ctx, FILE *fid, long offset, size_t size )
+
+{
+    void *data;
+
+    if( gridmap_disabled() )
+        return NULL;
+
+    data = gridmap_region( fileno(fid), offset, size );
+    if( data != NULL )
+        pj_log( ctx, PJ_LOG_DEBUG_MINOR,
+                "grid data mapped (%ld bytes at offset %ld)",
+                (long) size, offset );
+
+    return data;
+}
+
+/************************************************************************/
+/*                       pj_gridmap_load_cache()                        */
+/*                                                                      */
+/*      Map a previously converted copy of the grid, if there is one    */
+/*      matching the source file.  Sets gi->ct->cvs and returns 1 on    */
+/*      success.                                                        */
+/************************************************************************/
+
+int pj_gridmap_load_cache( projCtx ctx, PJ_GRIDINFO *gi, FILE *src,
+                           size_t size )
+
+{
+    char              fname[MAX_PATH_FILENAME+1];
+    PJ_GRIDMAP_HEADER header;
+    struct stat       st;
+    FILE             *fid;
+    void             *data = NULL;
+
+    if( gridmap_disabled() || !gridmap_cachename( gi, fname, sizeof(fname) )
+        || fstat( fileno(src), &st ) != 0 )
+        return 0;
+
+    fid = fopen( fname, "rb" );
+    if( fid == NULL )
+        return 0;
+
+    if( fread( &header, sizeof(header), 1, fid ) == 1
+        && strncmp( header.magic, GRIDMAP_MAGIC, sizeof(header.magic) ) == 0
+        && header.src_size == st.st_size
+        && header.src_mtime == st.st_mtime
+        && header.grid_offset == gi->grid_offset
+        && header.lim_lam == gi->ct->lim.lam
+        && header.lim_phi == gi->ct->lim.phi
+        && header.data_size == size )
+    {
+        data = gridmap_region( fileno(fid), GRIDMAP_DATA_OFFSET, size );
+    }
+
+    fclose( fid );
+
+    if( data == NULL )
+        return 0;
+
+    pj_log( ctx, PJ_LOG_DEBUG_MINOR, "grid %s mapped from cache %s",
+            gi->ct->id, fname );
+    gi->ct->cvs = (FLP *) data;
+    return 1;
+}
+
+/************************************************************************/
+/*                       pj_gridmap_store_cache()                       */
+/*                                                                      */
+/*      Write the freshly converted gi->ct->cvs heap array into the     */
+/*      cache, and swap it for a mapping of the cache file.  Failure    */
+/*      is not an error: the heap copy simply stays in use.             */
+/************************************************************************/
+
+int pj_gridmap_store_cache( projCtx ctx, PJ_GRIDINFO *gi, FILE *src,
+                            size_t size )
+
+{
+    char              fname[MAX_PATH_FILENAME+1];
+    char              tmpname[MAX_PATH_FILENAME+64];
+    char              padding[GRIDMAP_DATA_OFFSET];
+    PJ_GRIDMAP_HEADER header;
+    struct stat       st;
+    FILE             *fid;
+    int               ok;
+
+    assert( sizeof(header) <= GRIDMAP_DATA_OFFSET );
+
+    if( gridmap_disabled() || gi->ct->cvs == NULL
+        || !gridmap_cachename( gi, fname, sizeof(fname) )
+        || fstat( fileno(src), &st ) != 0 )
+        return 0;
+
+    memset( &header, 0, sizeof(header) );
+    strcpy( header.magic, GRIDMAP_MAGIC );
+    header.src_size = st.st_size;
+    header.src_mtime = st.st_mtime;
+    header.grid_offset = gi->grid_offset;
+    header.lim_lam = gi->ct->lim.lam;
+    header.lim_phi = gi->ct->lim.phi;
+    header.data_size = size;
+    memset( padding, 0, sizeof(padding) );
+
+/* -------------------------------------------------------------------- */
+/*      Write to a private temporary name and rename it into place,     */
+/*      so concurrent readers never see a partial file.                 */
+/* -------------------------------------------------------------------- */
+    sprintf( tmpname, "%s.%ld.%lx.tmp", fname, (long) getpid(),
+             (unsigned long) gi );
+    fid = fopen( tmpname, "wb" );
+    if( fid == NULL )
+    {
+        pj_log( ctx, PJ_LOG_DEBUG_MINOR,
+                "unable to create grid cache file %s", tmpname );
+        return 0;
+    }
+
+    ok = fwrite( &header, sizeof(header), 1, fid ) == 1
+        && fwrite( padding, GRIDMAP_DATA_OFFSET - sizeof(header), 1, fid ) == 1
+        && fwrite( gi->ct->cvs, size, 1, fid ) == 1;
+    if( fclose( fid ) != 0 )
+        ok = 0;
+
+    if( !ok || rename( tmpname, fname ) != 0 )
+    {
+        unlink( tmpname );
+        return 0;
+    }
+
+/* -------------------------------------------------------------------- */
+/*      Replace the heap copy with the mapping.                         */
+/* -------------------------------------------------------------------- */
+    fid = fopen( fname, "rb" );
+    if( fid != NULL )
+    {
+        void *data = gridmap_region( fileno(fid), GRIDMAP_DATA_OFFSET, size );
+
+        fclose( fid );
+        if( data != NULL )
+        {
+            pj_dalloc( gi->ct->cvs );
+            gi->ct->cvs = (FLP *) data;
+        }
+    }
+
+    pj_log( ctx, PJ_LOG_DEBUG_MINOR, "grid %s stored in cache %s",
+            gi->ct->id, fname );
+    return 1;
+}
+
+/************************************************************************/
+/*                         pj_gridmap_release()                         */
+/*                                                                      */
+/*      Unmap data if it was handed out by this module.  Returns 0      */
+/*      if data is not a mapping (and so must be pj_dalloc()'d).        */
+/************************************************************************/
+
+int pj_gridmap_release( void *data )
+
+{
+    PJ_GRIDMAP *map, *prev = NULL;
+
+    if( data == NULL )
+        return 0;
+
+    pj_acquire_lock();
+    for( map = map_list; map != NULL; prev = map, map = map->next )
+    {
+        if( map->data == data )
+        {
+            if( prev == NULL )
+                map_list = map->next;
+            else
+                prev->next = map->next;
+            break;
+        }
+    }
+    pj_release_lock();
+
+    if( map == NULL )
+        return 0;
+
+    munmap( map->base, map->length );
+    pj_dalloc( map );
+    return 1;
+}
+
+#else /* ndef PJ_GRIDMAP_ENABLED */
+
+/* -------------------------------------------------------------------- */
+/*      No mmap() on this platform: every grid is loaded on the heap.   */
+/* -------------------------------------------------------------------- */
+
+void *pj_gridmap( projCtx ctx, FILE *fid, long offset, size_t size )
+{
+    return NULL;
+}
+
+int pj_gridmap_load_cache( projCtx ctx, PJ_GRIDINFO *gi, FILE *src,
+                           size_t size )
+{
+    return 0;
+}
+
+int pj_gridmap_store_cache( projCtx ctx, PJ_GRIDINFO *gi, FILE *src,
+                            size_t size )
+{
+    return 0;
+}
+
+int pj_gridmap_release( void *data )
+{
+    return 0;
+}
+
+#endif /* def PJ_GRIDMAP_ENABLED */
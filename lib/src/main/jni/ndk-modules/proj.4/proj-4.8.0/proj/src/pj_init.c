@@ -307,6 +307,7 @@ pj_init_ctx(projCtx ctx, int argc, char **argv) {
 
     PIN->gridlist = NULL;
     PIN->gridlist_count = 0;
+    PIN->datum_null_grid = 0;
 
     PIN->vgridlist_geoid = NULL;
     PIN->vgridlist_geoid_count = 0;
@@ -31,3 +31,26 @@ pj_inv(XY xy, PJ *P) {
 	}
 	return lp;
 }
+/*
+** Helper for the optional batch inverse kernels (P->inv_n) used by
+** pj_transform().  Kernels descale each point as pj_inv() does, stop at
+** the first point they cannot handle and leave it untouched; this then
+** applies the central meridian and latitude adjustments to the run.
+*/
+	void
+pj_inv_n_end(PJ *P, long m, double *x, double *y) {
+	long i;
+
+	for (i = 0; i < m; ++i) {
+		x[i] += P->lam0; /* reduce from del lp.lam */
+		if (!P->over)
+			x[i] = adjlon(x[i]); /* adjust longitude to CM */
+		if (P->geoc && fabs(fabs(y[i])-HALFPI) > EPS)
+			y[i] = atan(P->one_es * tan(y[i]));
+	}
+	if (m > 0) {
+		P->ctx->last_errno = 0;
+		pj_errno = 0;
+		errno = 0;
+	}
+}
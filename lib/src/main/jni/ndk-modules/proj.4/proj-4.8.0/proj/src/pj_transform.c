@@ -169,6 +169,14 @@ int pj_transform( PJ *srcdefn, PJ *dstdefn, long point_count, int point_offset,
             XY         projected_loc;
             LP	       geodetic_loc;
 
+            /* let a batch kernel take the run of points it can handle */
+            if( srcdefn->inv_n != NULL && point_offset == 1 )
+            {
+                i += srcdefn->inv_n( srcdefn, point_count - i, x + i, y + i );
+                if( i >= point_count )
+                    break;
+            }
+
             projected_loc.u = x[point_offset*i];
             projected_loc.v = y[point_offset*i];
 
@@ -298,6 +306,14 @@ int pj_transform( PJ *srcdefn, PJ *dstdefn, long point_count, int point_offset,
             XY         projected_loc;
             LP	       geodetic_loc;
 
+            /* let a batch kernel take the run of points it can handle */
+            if( dstdefn->fwd_n != NULL && point_offset == 1 )
+            {
+                i += dstdefn->fwd_n( dstdefn, point_count - i, x + i, y + i );
+                if( i >= point_count )
+                    break;
+            }
+
             geodetic_loc.u = x[point_offset*i];
             geodetic_loc.v = y[point_offset*i];
 
@@ -629,6 +645,34 @@ int pj_datum_transform( PJ *srcdefn, PJ *dstdefn,
     dst_a = dstdefn->a_orig;
     dst_es = dstdefn->es_orig;
 
+/* -------------------------------------------------------------------- */
+/*      Short cut if both sides are WGS84, or a grid shift that is      */
+/*      only the @null grid (a zero shift, as in the usual Web          */
+/*      Mercator definition), and they end up on the same ellipsoid.    */
+/*      The grid lookups would leave every point unchanged.             */
+/* -------------------------------------------------------------------- */
+    if( (srcdefn->datum_type == PJD_WGS84 || srcdefn->datum_null_grid)
+        && (dstdefn->datum_type == PJD_WGS84 || dstdefn->datum_null_grid) )
+    {
+        if( srcdefn->datum_null_grid )
+        {
+            src_a = SRS_WGS84_SEMIMAJOR;
+            src_es = SRS_WGS84_ESQUARED;
+        }
+        if( dstdefn->datum_null_grid )
+        {
+            dst_a = SRS_WGS84_SEMIMAJOR;
+            dst_es = SRS_WGS84_ESQUARED;
+        }
+        if( src_a == dst_a && src_es == dst_es )
+            return 0;
+
+        src_a = srcdefn->a_orig;
+        src_es = srcdefn->es_orig;
+        dst_a = dstdefn->a_orig;
+        dst_es = dstdefn->es_orig;
+    }
+
 /* -------------------------------------------------------------------- */
 /*      Create a temporary Z array if one is not provided.              */
 /* -------------------------------------------------------------------- */
@@ -91,6 +91,7 @@ void pj_pr_list(projPJ);
 void pj_free(projPJ);
 void pj_set_finder( const char *(*)(const char *) );
 void pj_set_searchpath ( int count, const char **path );
+void pj_set_gridcache( const char *path );
 projPJ pj_init(int, char **);
 projPJ pj_init_plus(const char *);
 projPJ pj_init_ctx( projCtx, int, char ** );
@@ -232,6 +232,9 @@ typedef struct PJconsts {
 	LP  (*inv)(XY, struct PJconsts *);
 	void (*spc)(LP, struct PJconsts *, struct FACTORS *);
 	void (*pfree)(struct PJconsts *);
+	/* optional batch kernels over contiguous x/y arrays, see pj_fwd_n_begin() */
+	long (*fwd_n)(struct PJconsts *, long, double *, double *);
+	long (*inv_n)(struct PJconsts *, long, double *, double *);
 	const char *descr;
 	paralist *params;   /* parameter list */
 	int over;   /* over-range flag */
@@ -256,6 +259,7 @@ typedef struct PJconsts {
         double  datum_params[7];
         struct _pj_gi **gridlist;
         int     gridlist_count;
+        int     datum_null_grid; /* nadgrids is just @null, a zero shift */
 
         int     has_geoid_vgrids;
         struct _pj_gi **vgridlist_geoid;
@@ -483,6 +487,11 @@ PJ_GRIDINFO *pj_gridinfo_init( projCtx, const char * );
 int pj_gridinfo_load( projCtx, PJ_GRIDINFO * );
 void pj_gridinfo_free( projCtx, PJ_GRIDINFO * );
 
+void *pj_gridmap( projCtx, FILE *, long, size_t );
+int pj_gridmap_load_cache( projCtx, PJ_GRIDINFO *, FILE *, size_t );
+int pj_gridmap_store_cache( projCtx, PJ_GRIDINFO *, FILE *, size_t );
+int pj_gridmap_release( void * );
+
 PJ_GridCatalog *pj_gc_findcatalog( projCtx, const char * );
 PJ_GridCatalog *pj_gc_readcatalog( projCtx, const char * );
 void pj_gc_unloadall( projCtx );
@@ -508,6 +517,10 @@ void *pj_gauss_ini(double, double, double *,double *);
 LP pj_gauss(projCtx, LP, const void *);
 LP pj_inv_gauss(projCtx, LP, const void *);
 
+long pj_fwd_n_begin(PJ *, long, double *, double *, double, double);
+void pj_fwd_n_end(PJ *, long, double *, double *);
+void pj_inv_n_end(PJ *, long, double *, double *);
+
 extern char const pj_release[];
 
 struct PJ_ELLPS *pj_get_ellps_ref( void );